@@ -0,0 +1,285 @@
+/*
+cmake -S . -B build && cmake --build build --target bench_engines && ./build/bench_engines > bench.csv
+
+  bench_engines [numbers] [engine]
+
+Times every engine, or those whose name contains [engine], at [numbers]
+numbers a run (default 2^22), and writes one CSV line a run to stdout:
+
+  engine,method,mode,batch,bits,numbers,ns_per_number,bytes_per_sec,
+  samples,p50_ns,p90_ns,p99_ns,p999_ns,max_ns
+
+mode is scalar, one number a call, or bulk, batch numbers a call, by
+fill() where the engine has it and by std::generate where not; the
+methods _Adaptor and uniform_real_adaptor make one double a call.  bits
+is that of the range of the numbers and bytes_per_sec counts only those.
+The percentiles are of the time of single calls, samples of them, and
+include the cost of one steady_clock::now(), which is the row "clock".
+A percentile is left empty when there are too few samples to have one
+above it: p99.9 needs 1000, p99 100.
+*/
+
+#include <random>
+#include <vector>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <type_traits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cmath>
+
+#include <ext/pcg_engine.h>
+#include <ext/xoshiro_engine.h>
+#include <ext/jsf_engine.h>
+#include <ext/counter_based_engine.h>
+#include <ext/chacha_engine.h>
+#include <ext/ranluxpp_engine.h>
+#include <ext/uniform_real_adaptor.h>
+#include "mixmax.hpp"
+
+extern "C"
+{
+  void* bench_mixmax_c_alloc(void);
+  void bench_mixmax_c_free(void* X);
+  std::uint64_t bench_mixmax_c_get_next(void* X);
+  std::uint64_t bench_mixmax_c_get_next_n(void* X, std::size_t n);
+  void bench_mixmax_c_fill_array(void* X, unsigned int n, double* out);
+}
+
+using bench_clock = std::chrono::steady_clock;
+
+const std::size_t batches[] = {16, 256, 4096, 65536};
+
+//  Whatever the calls return goes here, so that they are not optimized away.
+volatile std::uint64_t sink;
+
+template<typename Engine, typename = void>
+  struct has_fill
+  : std::false_type
+  { };
+
+template<typename Engine>
+  struct has_fill<Engine, std::void_t<decltype(std::declval<Engine&>()
+		.fill(static_cast<typename Engine::result_type*>(nullptr), std::size_t()))>>
+  : std::true_type
+  { };
+
+struct options
+{
+  std::size_t numbers = std::size_t(1) << 22;
+  std::string filter;
+};
+
+/*
+ * run(calls) makes calls calls in a loop, once() makes one; each call
+ * makes batch numbers of bits bits.
+ */
+template<typename Run, typename Once>
+  void
+  bench(const options& opt, const char* engine, const char* method,
+	std::size_t batch, double bits, Run run, Once once)
+  {
+    if (engine[0] != '\0' && std::string(engine).find(opt.filter) == std::string::npos)
+      return;
+
+    const std::size_t calls = std::max<std::size_t>(opt.numbers / batch, 1);
+    sink = sink + run(std::min<std::size_t>(calls / 16 + 1, 1 << 12));
+    auto t0 = bench_clock::now();
+    sink = sink + run(calls);
+    auto t1 = bench_clock::now();
+    const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count()
+		    / double(calls * batch);
+
+    const std::size_t samples
+      = std::min<std::size_t>(std::max<std::size_t>(calls / 4, 64), 1 << 18);
+    std::vector<double> lat(samples);
+    for (auto& l : lat)
+      {
+	auto s0 = bench_clock::now();
+	sink = sink + once();
+	auto s1 = bench_clock::now();
+	l = std::chrono::duration<double, std::nano>(s1 - s0).count();
+      }
+    std::sort(lat.begin(), lat.end());
+    //  A percentile needs a sample above it: empty where there is none.
+    char pcts[4][32];
+    const double qs[4] = {0.5, 0.9, 0.99, 0.999};
+    for (int i = 0; i < 4; ++i)
+      if (double(samples) * (1.0 - qs[i]) >= 1.0)
+	std::snprintf(pcts[i], sizeof(pcts[i]), "%.0f",
+		      lat[std::min(lat.size() - 1, std::size_t(qs[i] * lat.size()))]);
+      else
+	pcts[i][0] = '\0';
+
+    std::printf("%s,%s,%s,%zu,%.2f,%zu,%.3f,%.4g,%zu,%s,%s,%s,%s,%.0f\n",
+		engine[0] != '\0' ? engine : "clock", method,
+		batch == 1 ? "scalar" : "bulk", batch, bits, calls * batch,
+		ns, 1e9 / ns * bits / 8, samples,
+		pcts[0], pcts[1], pcts[2], pcts[3], lat.back());
+    std::fflush(stdout);
+  }
+
+template<typename Engine>
+  double
+  range_bits()
+  {
+    return std::log2(double(Engine::max() - Engine::min()) + 1.0);
+  }
+
+template<typename Engine>
+  void
+  bench_engine(const options& opt, const char* name, Engine gen = Engine())
+  {
+    using result_type = typename Engine::result_type;
+    const double bits = range_bits<Engine>();
+
+    bench(opt, name, "operator()", 1, bits,
+	  [&gen](std::size_t calls)
+	  {
+	    std::uint64_t sum = 0;
+	    for (std::size_t k = 0; k < calls; ++k)
+	      sum += gen();
+	    return sum;
+	  },
+	  [&gen]{ return std::uint64_t(gen()); });
+
+    for (std::size_t batch : batches)
+      {
+	std::vector<result_type> out(batch);
+	auto once = [&gen, &out]
+	  {
+	    if constexpr (has_fill<Engine>::value)
+	      gen.fill(out.data(), out.size());
+	    else
+	      std::generate(out.begin(), out.end(), std::ref(gen));
+	    return std::uint64_t(out.front() ^ out.back());
+	  };
+	bench(opt, name, has_fill<Engine>::value ? "fill" : "generate",
+	      batch, bits,
+	      [&once](std::size_t calls)
+	      {
+		std::uint64_t sum = 0;
+		for (std::size_t k = 0; k < calls; ++k)
+		  sum += once();
+		return sum;
+	      },
+	      once);
+      }
+  }
+
+//  A double in [0, 1) a call, by the _Adaptor of the std distributions
+//  and by uniform_real_adaptor.
+template<typename Engine>
+  void
+  bench_uniform_real(const options& opt, const char* name)
+  {
+    Engine g1, g2;
+    std::__detail::_Adaptor<Engine, double> a1(g1);
+    __gnu_cxx::uniform_real_adaptor<Engine, double> a2(g2);
+    auto doubles = [](auto& a)
+      {
+	return [&a](std::size_t calls)
+	  {
+	    std::uint64_t sum = 0;
+	    for (std::size_t k = 0; k < calls; ++k)
+	      sum += std::uint64_t(a() * 0x1p53);
+	    return sum;
+	  };
+      };
+    bench(opt, name, "_Adaptor", 1, 53, doubles(a1),
+	  [&a1]{ return std::uint64_t(a1() * 0x1p53); });
+    bench(opt, name, "uniform_real_adaptor", 1, 53, doubles(a2),
+	  [&a2]{ return std::uint64_t(a2() * 0x1p53); });
+  }
+
+void
+bench_mixmax_c(const options& opt)
+{
+  const char* name = "mixmax_c N=240";
+  void* X = bench_mixmax_c_alloc();
+
+  bench(opt, name, "get_next", 1, 61,
+	[X](std::size_t calls){ return bench_mixmax_c_get_next_n(X, calls); },
+	[X]{ return bench_mixmax_c_get_next(X); });
+
+  //  The doubles of fill_array have 53 bits of the 61.
+  for (std::size_t batch : batches)
+    {
+      std::vector<double> out(batch);
+      auto once = [X, &out]
+	{
+	  bench_mixmax_c_fill_array(X, unsigned(out.size()), out.data());
+	  return std::uint64_t(out.front() * 0x1p53) ^ std::uint64_t(out.back() * 0x1p53);
+	};
+      bench(opt, name, "fill_array", batch, 53,
+	    [&once](std::size_t calls)
+	    {
+	      std::uint64_t sum = 0;
+	      for (std::size_t k = 0; k < calls; ++k)
+		sum += once();
+	      return sum;
+	    },
+	    once);
+    }
+
+  bench_mixmax_c_free(X);
+}
+
+int
+main(int argc, char* argv[])
+{
+  using namespace __gnu_cxx;
+
+  options opt;
+  if (argc > 1)
+    opt.numbers = std::strtoull(argv[1], nullptr, 10);
+  if (argc > 2)
+    opt.filter = argv[2];
+
+  std::printf("engine,method,mode,batch,bits,numbers,ns_per_number,bytes_per_sec,"
+	      "samples,p50_ns,p90_ns,p99_ns,p999_ns,max_ns\n");
+
+  //  The clock alone: what every latency includes.
+  bench(opt, "", "now", 1, 0,
+	[](std::size_t calls)
+	{
+	  std::uint64_t sum = 0;
+	  for (std::size_t k = 0; k < calls; ++k)
+	    sum += std::uint64_t(bench_clock::now().time_since_epoch().count());
+	  return sum;
+	},
+	[]{ return std::uint64_t(0); });
+
+  bench_engine(opt, "mixmax N=240", mixmax_engine<240>(0, 0, 1, 7));
+  bench_engine(opt, "mixmax N=17", mixmax_engine<17>(0, 0, 1, 7));
+  bench_mixmax_c(opt);
+
+  bench_engine<std::minstd_rand>(opt, "minstd_rand");
+  bench_engine<std::mt19937>(opt, "mt19937");
+  bench_engine<std::mt19937_64>(opt, "mt19937_64");
+  bench_engine<std::ranlux24>(opt, "ranlux24");
+  bench_engine<std::ranlux48>(opt, "ranlux48");
+
+  bench_engine<pcg32>(opt, "pcg32");
+#ifdef __SIZEOF_INT128__
+  bench_engine<pcg64>(opt, "pcg64");
+#endif
+  bench_engine<xoshiro256starstar>(opt, "xoshiro256starstar");
+  bench_engine<jsf32>(opt, "jsf32");
+  bench_engine<jsf64>(opt, "jsf64");
+  bench_engine<philox4x32>(opt, "philox4x32");
+  bench_engine<philox4x64>(opt, "philox4x64");
+  bench_engine<threefry4x64>(opt, "threefry4x64");
+  bench_engine<chacha8>(opt, "chacha8");
+  bench_engine<chacha20>(opt, "chacha20");
+  bench_engine<ranluxpp48>(opt, "ranluxpp48");
+
+  bench_uniform_real<xoshiro256starstar>(opt, "xoshiro256starstar");
+  bench_uniform_real<std::mt19937_64>(opt, "mt19937_64");
+  bench_uniform_real<std::mt19937>(opt, "mt19937");
+  bench_uniform_real<pcg32>(opt, "pcg32");
+
+  return 0;
+}
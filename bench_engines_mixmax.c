@@ -0,0 +1,40 @@
+/*
+ *  The C MIXMAX library, N=240, for bench_engines.cpp.
+ *
+ *  get_next of mixmax.h is a macro over an inline function, so the loop over it
+ *  is here, compiled as C, where it is inlined as in any C program; mixmax.h and
+ *  mixmax.hpp cannot be included in one translation unit anyway.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "mixmax.h"
+
+void* bench_mixmax_c_alloc(void){
+    rng_state_t* X = rng_alloc();
+    seed_uniquestream(X, 0, 0, 1, 7);   // as mixmax_engine<240>(0, 0, 1, 7)
+    return X;
+}
+
+void bench_mixmax_c_free(void* X){
+    rng_free((rng_state_t*)X);
+}
+
+// One call, for the latencies: the call itself is not inlined.
+uint64_t bench_mixmax_c_get_next(void* X){
+    return get_next((rng_state_t*)X);
+}
+
+// n calls; the sum keeps them from being optimized away.
+uint64_t bench_mixmax_c_get_next_n(void* X, size_t n){
+    rng_state_t* S = (rng_state_t*)X;
+    uint64_t sum = 0;
+    for (size_t k=0; k<n; k++){ sum += get_next(S); }
+    return sum;
+}
+
+void bench_mixmax_c_fill_array(void* X, unsigned int n, double* out){
+    fill_array((rng_state_t*)X, n, out);
+}
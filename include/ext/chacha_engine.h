@@ -0,0 +1,238 @@
+#ifndef CHACHA_ENGINE_H
+#define CHACHA_ENGINE_H 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <limits>
+#include <iosfwd>
+#include <type_traits>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  /**
+   * @brief The ChaCha stream cipher of D.J. Bernstein as a random number
+   *        engine: the keystream, 32-bit word by word.
+   *
+   * The state is a 256-bit key, a 64-bit stream (the nonce) and a 64-bit
+   * block counter, as the original ChaCha; with the stream zero the
+   * output is the keystream of the RFC 7539 cipher with a zero nonce.
+   * Knowing any amount of output tells nothing of the key or of the
+   * rest of the stream, so long as the key is secret: seed from a seed
+   * sequence of real entropy, such as std::random_device, not from one
+   * 32-bit number, for that.
+   *
+   * Blocks are made several at a time in vector registers, one block per
+   * lane, four lanes with SSE2 and eight with AVX2; operator() takes
+   * them from a buffer of one such batch, fill() writes whole batches
+   * straight to the output.  discard() is O(1).
+   */
+  template<std::size_t _Rounds>
+    class chacha_engine
+    {
+      static_assert(_Rounds > 0 && _Rounds % 2 == 0,
+		    "the number of rounds must be even");
+
+#ifdef __AVX2__
+      static constexpr std::size_t _S_lanes = 8;
+#else
+      static constexpr std::size_t _S_lanes = 4;
+#endif
+      static constexpr std::size_t _S_buffer = 16 * _S_lanes;
+
+      typedef std::uint32_t __vec_type
+	__attribute__ ((vector_size (sizeof(std::uint32_t) * _S_lanes)));
+
+    public:
+      /** The type of the generated random value. */
+      using result_type = std::uint32_t;
+      using key_type = std::array<std::uint32_t, 8>;
+
+      static constexpr std::size_t rounds = _Rounds;
+      static constexpr result_type default_seed = 0u;
+
+      chacha_engine()
+      : chacha_engine(default_seed)
+      { }
+
+      /**
+       * @brief The key {@p __s, 0, ..., 0}: reproducible, not secret.
+       */
+      explicit
+      chacha_engine(result_type __s)
+      { seed(__s); }
+
+      template<typename _Sseq, typename = typename
+	std::enable_if<!std::is_same<_Sseq, chacha_engine>::value
+		       && !std::is_convertible<_Sseq, result_type>::value
+		       && !std::is_convertible<_Sseq, key_type>::value>::type>
+	explicit
+	chacha_engine(_Sseq& __seq)
+	{ seed(__seq); }
+
+      explicit
+      chacha_engine(const key_type& __k, std::uint64_t __stream = 0)
+      { seed(__k, __stream); }
+
+      void
+      seed(result_type __s = default_seed)
+      {
+	key_type __k = key_type();
+	__k[0] = __s;
+	seed(__k);
+      }
+
+      /**
+       * @brief Seeds the key with eight words of the seed sequence.
+       */
+      template<typename _Sseq>
+	typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value
+				&& !std::is_convertible<_Sseq, key_type>::value>::type
+	seed(_Sseq& __seq);
+
+      /**
+       * @brief Starts stream @p __stream of key @p __k from the beginning.
+       */
+      void
+      seed(const key_type& __k, std::uint64_t __stream = 0)
+      {
+	this->_M_key = __k;
+	this->_M_stream = __stream;
+	this->set_counter(0);
+      }
+
+      /**
+       * @brief Selects stream @p __stream of the same key, from its
+       *        beginning: the streams of a key do not overlap.
+       */
+      void
+      set_stream(std::uint64_t __stream)
+      {
+	this->_M_stream = __stream;
+	this->set_counter(0);
+      }
+
+      std::uint64_t
+      stream() const
+      { return this->_M_stream; }
+
+      const key_type&
+      key() const
+      { return this->_M_key; }
+
+      /**
+       * @brief Places the engine at the first word of block @p __ctr.
+       */
+      void
+      set_counter(std::uint64_t __ctr)
+      {
+	this->_M_ctr = __ctr;
+	this->_M_i = _S_buffer;
+      }
+
+      static constexpr result_type
+      min()
+      { return std::numeric_limits<result_type>::min(); }
+
+      static constexpr result_type
+      max()
+      { return std::numeric_limits<result_type>::max(); }
+
+      result_type
+      operator()()
+      {
+	if (this->_M_i == _S_buffer)
+	  this->_M_refill();
+	return this->_M_buf[this->_M_i++];
+      }
+
+      /**
+       * @brief Skips @p __z numbers in constant time.
+       */
+      void
+      discard(unsigned long long __z);
+
+      /**
+       * @brief Writes the same @p __n numbers to @p __out as @p __n calls
+       *        of operator() would.
+       */
+      void
+      fill(result_type* __out, std::size_t __n);
+
+      friend bool
+      operator==(const chacha_engine& __lhs, const chacha_engine& __rhs)
+      {
+	return __lhs._M_key == __rhs._M_key
+	    && __lhs._M_stream == __rhs._M_stream
+	    && __lhs._M_position() == __rhs._M_position();
+      }
+
+      template<std::size_t _Rounds1, typename _CharT, typename _Traits>
+	friend std::basic_ostream<_CharT, _Traits>&
+	operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+		   const chacha_engine<_Rounds1>& __x);
+
+      template<std::size_t _Rounds1, typename _CharT, typename _Traits>
+	friend std::basic_istream<_CharT, _Traits>&
+	operator>>(std::basic_istream<_CharT, _Traits>& __is,
+		   chacha_engine<_Rounds1>& __x);
+
+    private:
+      //  The number of the next word in the stream, modulo 2^64.
+      std::uint64_t
+      _M_position() const
+      { return 16 * this->_M_ctr - (_S_buffer - this->_M_i); }
+
+      void
+      _M_refill()
+      {
+	this->_M_blocks(this->_M_ctr, this->_M_buf, _S_lanes);
+	this->_M_ctr += _S_lanes;
+	this->_M_i = 0;
+      }
+
+      //  Writes the @p __blocks blocks from @p __ctr on, a multiple of
+      //  the lanes, to @p __out.
+      void
+      _M_blocks(std::uint64_t __ctr, result_type* __out,
+		std::size_t __blocks) const;
+
+      key_type _M_key;
+      std::uint64_t _M_stream;
+      //  The counter of the block after the buffer.
+      std::uint64_t _M_ctr;
+      std::size_t _M_i;
+      result_type _M_buf[_S_buffer];
+    };
+
+  /** ChaCha with 8, 12 and 20 rounds; 8 is still far from any attack. */
+  using chacha8 = chacha_engine<8>;
+  using chacha12 = chacha_engine<12>;
+  using chacha20 = chacha_engine<20>;
+
+  template<std::size_t _Rounds>
+    inline bool
+    operator!=(const chacha_engine<_Rounds>& __lhs,
+	       const chacha_engine<_Rounds>& __rhs)
+    { return !(__lhs == __rhs); }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#include <ext/chacha_engine.tcc>
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // CHACHA_ENGINE_H
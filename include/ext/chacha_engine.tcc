@@ -0,0 +1,230 @@
+#ifndef CHACHA_ENGINE_TCC
+#define CHACHA_ENGINE_TCC 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <iostream>
+#include <cstring>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    //  The vectors go by reference: GCC warns of the ABI of wide vectors
+    //  passed by value.
+    template<int __k, typename _Vec>
+      inline void
+      __chacha_rotl(_Vec& __x)
+      { __x = (__x << __k) | (__x >> (32 - __k)); }
+
+    template<typename _Vec>
+      inline void
+      __chacha_quarter(_Vec& __a, _Vec& __b, _Vec& __c, _Vec& __d)
+      {
+	__a += __b; __d ^= __a; __chacha_rotl<16>(__d);
+	__c += __d; __b ^= __c; __chacha_rotl<12>(__b);
+	__a += __b; __d ^= __a; __chacha_rotl<8>(__d);
+	__c += __d; __b ^= __c; __chacha_rotl<7>(__b);
+      }
+
+    //  Transposes the square of _Lanes vectors of _Lanes words in place
+    //  by interleaving halves: after log2(_Lanes) passes vector l holds
+    //  lane l of them all.
+    template<std::size_t _Lanes, typename _Vec>
+      inline void
+      __chacha_transpose(_Vec* __v)
+      {
+	_Vec __lo, __hi;
+	for (std::size_t __l = 0; __l < _Lanes / 2; ++__l)
+	  {
+	    __lo[2 * __l] = __l;
+	    __lo[2 * __l + 1] = _Lanes + __l;
+	    __hi[2 * __l] = _Lanes / 2 + __l;
+	    __hi[2 * __l + 1] = _Lanes + _Lanes / 2 + __l;
+	  }
+	for (std::size_t __s = 1; __s < _Lanes; __s *= 2)
+	  {
+	    _Vec __t[_Lanes];
+	    for (std::size_t __l = 0; __l < _Lanes / 2; ++__l)
+	      {
+		__t[2 * __l] = __builtin_shuffle(__v[__l], __v[__l + _Lanes / 2], __lo);
+		__t[2 * __l + 1] = __builtin_shuffle(__v[__l], __v[__l + _Lanes / 2], __hi);
+	      }
+	    for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	      __v[__l] = __t[__l];
+	  }
+      }
+  } // namespace __detail
+
+  template<std::size_t _Rounds>
+    template<typename _Sseq>
+      typename std::enable_if<!std::is_convertible<_Sseq, std::uint32_t>::value
+		&& !std::is_convertible<_Sseq, std::array<std::uint32_t, 8>>::value>::type
+      chacha_engine<_Rounds>::
+      seed(_Sseq& __seq)
+      {
+	std::uint_least32_t __arr[8];
+	__seq.generate(__arr + 0, __arr + 8);
+	key_type __k;
+	for (std::size_t __i = 0; __i < 8; ++__i)
+	  __k[__i] = std::uint32_t(__arr[__i]);
+	seed(__k);
+      }
+
+  template<std::size_t _Rounds>
+    void
+    chacha_engine<_Rounds>::
+    _M_blocks(std::uint64_t __ctr, result_type* __out,
+	      std::size_t __blocks) const
+    {
+      //  Block l of the batch in lane l of each of the 16 words.
+      __vec_type __init[16];
+      const std::uint32_t __sigma[4]
+	= { 0x61707865, 0x3320646e, 0x79622d32, 0x6b206574 };
+      for (std::size_t __j = 0; __j < 4; ++__j)
+	__init[__j] = __vec_type{} + __sigma[__j];
+      for (std::size_t __j = 0; __j < 8; ++__j)
+	__init[4 + __j] = __vec_type{} + this->_M_key[__j];
+      __init[14] = __vec_type{} + std::uint32_t(this->_M_stream);
+      __init[15] = __vec_type{} + std::uint32_t(this->_M_stream >> 32);
+
+      for (; __blocks >= _S_lanes; __blocks -= _S_lanes)
+	{
+	  for (std::size_t __l = 0; __l < _S_lanes; ++__l)
+	    {
+	      __init[12][__l] = std::uint32_t(__ctr + __l);
+	      __init[13][__l] = std::uint32_t((__ctr + __l) >> 32);
+	    }
+	  __ctr += _S_lanes;
+
+	  __vec_type __x[16];
+	  for (std::size_t __j = 0; __j < 16; ++__j)
+	    __x[__j] = __init[__j];
+	  for (std::size_t __r = 0; __r < _Rounds; __r += 2)
+	    {
+	      __detail::__chacha_quarter(__x[0], __x[4], __x[8], __x[12]);
+	      __detail::__chacha_quarter(__x[1], __x[5], __x[9], __x[13]);
+	      __detail::__chacha_quarter(__x[2], __x[6], __x[10], __x[14]);
+	      __detail::__chacha_quarter(__x[3], __x[7], __x[11], __x[15]);
+	      __detail::__chacha_quarter(__x[0], __x[5], __x[10], __x[15]);
+	      __detail::__chacha_quarter(__x[1], __x[6], __x[11], __x[12]);
+	      __detail::__chacha_quarter(__x[2], __x[7], __x[8], __x[13]);
+	      __detail::__chacha_quarter(__x[3], __x[4], __x[9], __x[14]);
+	    }
+	  for (std::size_t __j = 0; __j < 16; ++__j)
+	    __x[__j] += __init[__j];
+
+	  //  Back to one block after another: each square of _S_lanes
+	  //  words by _S_lanes lanes is transposed and stored row by row.
+	  for (std::size_t __j = 0; __j < 16; __j += _S_lanes)
+	    {
+	      __detail::__chacha_transpose<_S_lanes>(__x + __j);
+	      for (std::size_t __l = 0; __l < _S_lanes; ++__l)
+		std::memcpy(__out + 16 * __l + __j, &__x[__j + __l],
+			    sizeof(__vec_type));
+	    }
+	  __out += 16 * _S_lanes;
+	}
+    }
+
+  template<std::size_t _Rounds>
+    void
+    chacha_engine<_Rounds>::
+    discard(unsigned long long __z)
+    {
+      const std::uint64_t __left = _S_buffer - this->_M_i;
+      if (__z <= __left)
+	{
+	  this->_M_i += __z;
+	  return;
+	}
+      const std::uint64_t __pos = this->_M_position() + __z;
+      this->_M_ctr = __pos / 16;
+      this->_M_refill();
+      this->_M_i = __pos % 16;
+    }
+
+  template<std::size_t _Rounds>
+    void
+    chacha_engine<_Rounds>::
+    fill(result_type* __out, std::size_t __n)
+    {
+      for (; __n > 0 && this->_M_i < _S_buffer; --__n)
+	*__out++ = this->_M_buf[this->_M_i++];
+      const std::size_t __batches = __n / _S_buffer;
+      if (__batches > 0)
+	{
+	  this->_M_blocks(this->_M_ctr, __out, __batches * _S_lanes);
+	  this->_M_ctr += __batches * _S_lanes;
+	  __out += __batches * _S_buffer;
+	  __n -= __batches * _S_buffer;
+	}
+      for (; __n > 0; --__n)
+	*__out++ = this->operator()();
+    }
+
+  template<std::size_t _Rounds, typename _CharT, typename _Traits>
+    std::basic_ostream<_CharT, _Traits>&
+    operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+	       const chacha_engine<_Rounds>& __x)
+    {
+      typedef std::basic_ostream<_CharT, _Traits>  __ostream_type;
+      typedef typename __ostream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __os.flags();
+      const _CharT __fill = __os.fill();
+      const _CharT __space = __os.widen(' ');
+      __os.flags(__ios_base::dec | __ios_base::fixed | __ios_base::left);
+      __os.fill(__space);
+
+      for (auto __k : __x._M_key)
+	__os << __k << __space;
+      __os << __x._M_stream << __space << __x._M_position();
+
+      __os.flags(__flags);
+      __os.fill(__fill);
+      return __os;
+    }
+
+  template<std::size_t _Rounds, typename _CharT, typename _Traits>
+    std::basic_istream<_CharT, _Traits>&
+    operator>>(std::basic_istream<_CharT, _Traits>& __is,
+	       chacha_engine<_Rounds>& __x)
+    {
+      typedef std::basic_istream<_CharT, _Traits>  __istream_type;
+      typedef typename __istream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __is.flags();
+      __is.flags(__ios_base::dec | __ios_base::skipws);
+
+      typename chacha_engine<_Rounds>::key_type __k;
+      std::uint64_t __stream, __pos;
+      for (auto& __kk : __k)
+	__is >> __kk;
+      __is >> __stream >> __pos;
+      if (!__is.fail())
+	{
+	  __x.seed(__k, __stream);
+	  __x.discard(__pos);
+	}
+
+      __is.flags(__flags);
+      return __is;
+    }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // CHACHA_ENGINE_TCC
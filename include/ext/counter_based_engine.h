@@ -0,0 +1,651 @@
+#ifndef COUNTER_BASED_ENGINE_H
+#define COUNTER_BASED_ENGINE_H 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <limits>
+#include <iosfwd>
+#include <type_traits>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    //  The word of the round functions: one _UIntType, or a vector of
+    //  _Lanes of them, one counter per lane.
+    template<typename _UIntType, std::size_t _Lanes>
+      struct __cbrng_word
+      {
+	typedef _UIntType __type
+	  __attribute__ ((vector_size (sizeof(_UIntType) * _Lanes)));
+      };
+
+    template<typename _UIntType>
+      struct __cbrng_word<_UIntType, 1>
+      { typedef _UIntType __type; };
+
+    //  Adds @p __z to the multiword counter @p __c, word 0 the lowest.
+    template<typename _UIntType, std::size_t __n>
+      inline void
+      __cbrng_add(std::array<_UIntType, __n>& __c, unsigned long long __z)
+      {
+	constexpr int __w = std::numeric_limits<_UIntType>::digits;
+	for (std::size_t __j = 0; __j < __n && __z != 0ULL; ++__j)
+	  {
+	    const _UIntType __d = _UIntType(__z);
+	    __c[__j] += __d;
+	    __z = (__z >> (__w / 2) >> (__w / 2)) + (__c[__j] < __d ? 1 : 0);
+	  }
+      }
+
+    //  The high and low halves of the product of @p __m and @p __x.
+    inline void
+    __philox_mulhilo(std::uint32_t __m, std::uint32_t __x,
+		     std::uint32_t& __hi, std::uint32_t& __lo)
+    {
+      const std::uint64_t __p = std::uint64_t(__m) * __x;
+      __hi = std::uint32_t(__p >> 32);
+      __lo = std::uint32_t(__p);
+    }
+
+    inline void
+    __philox_mulhilo(std::uint64_t __m, std::uint64_t __x,
+		     std::uint64_t& __hi, std::uint64_t& __lo)
+    {
+      const unsigned __int128 __p = (unsigned __int128)__m * __x;
+      __hi = std::uint64_t(__p >> 64);
+      __lo = std::uint64_t(__p);
+    }
+
+    //  The multipliers and Weyl increments of the key of Salmon et al.
+    template<typename _UIntType, std::size_t __n>
+      struct __philox_constants;
+
+    template<>
+      struct __philox_constants<std::uint32_t, 2>
+      {
+	static constexpr std::uint32_t _S_m0 = 0xD256D193u;
+	static constexpr std::uint32_t _S_m1 = 0;
+	static constexpr std::uint32_t _S_w0 = 0x9E3779B9u;
+	static constexpr std::uint32_t _S_w1 = 0;
+      };
+
+    template<>
+      struct __philox_constants<std::uint32_t, 4>
+      {
+	static constexpr std::uint32_t _S_m0 = 0xD2511F53u;
+	static constexpr std::uint32_t _S_m1 = 0xCD9E8D57u;
+	static constexpr std::uint32_t _S_w0 = 0x9E3779B9u;
+	static constexpr std::uint32_t _S_w1 = 0xBB67AE85u;
+      };
+
+    template<>
+      struct __philox_constants<std::uint64_t, 2>
+      {
+	static constexpr std::uint64_t _S_m0 = 0xD2B74407B1CE6E93ULL;
+	static constexpr std::uint64_t _S_m1 = 0;
+	static constexpr std::uint64_t _S_w0 = 0x9E3779B97F4A7C15ULL;
+	static constexpr std::uint64_t _S_w1 = 0;
+      };
+
+    template<>
+      struct __philox_constants<std::uint64_t, 4>
+      {
+	static constexpr std::uint64_t _S_m0 = 0xD2E7470EE14C6C93ULL;
+	static constexpr std::uint64_t _S_m1 = 0xCA5A826395121157ULL;
+	static constexpr std::uint64_t _S_w0 = 0x9E3779B97F4A7C15ULL;
+	static constexpr std::uint64_t _S_w1 = 0xBB67AE8584CAA73BULL;
+      };
+
+    //  The rotations of round i of Threefry, those of Skein for 64 bits.
+    template<typename _UIntType, std::size_t __n>
+      struct __threefry_constants;
+
+    template<>
+      struct __threefry_constants<std::uint32_t, 2>
+      {
+	static constexpr std::uint32_t _S_parity = 0x1BD11BDAu;
+	static constexpr int
+	_S_rot(std::size_t __i, std::size_t)
+	{
+	  return __i % 8 == 0 ? 13 : __i % 8 == 1 ? 15 : __i % 8 == 2 ? 26
+	       : __i % 8 == 3 ? 6 : __i % 8 == 4 ? 17 : __i % 8 == 5 ? 29
+	       : __i % 8 == 6 ? 16 : 24;
+	}
+      };
+
+    template<>
+      struct __threefry_constants<std::uint32_t, 4>
+      {
+	static constexpr std::uint32_t _S_parity = 0x1BD11BDAu;
+	static constexpr int
+	_S_rot(std::size_t __i, std::size_t __j)
+	{
+	  return __i % 8 == 0 ? (__j == 0 ? 10 : 26)
+	       : __i % 8 == 1 ? (__j == 0 ? 11 : 21)
+	       : __i % 8 == 2 ? (__j == 0 ? 13 : 27)
+	       : __i % 8 == 3 ? (__j == 0 ? 23 : 5)
+	       : __i % 8 == 4 ? (__j == 0 ? 6 : 20)
+	       : __i % 8 == 5 ? (__j == 0 ? 17 : 11)
+	       : __i % 8 == 6 ? (__j == 0 ? 25 : 10)
+	       : (__j == 0 ? 18 : 20);
+	}
+      };
+
+    template<>
+      struct __threefry_constants<std::uint64_t, 2>
+      {
+	static constexpr std::uint64_t _S_parity = 0x1BD11BDAA9FC1A22ULL;
+	static constexpr int
+	_S_rot(std::size_t __i, std::size_t)
+	{
+	  return __i % 8 == 0 ? 16 : __i % 8 == 1 ? 42 : __i % 8 == 2 ? 12
+	       : __i % 8 == 3 ? 31 : __i % 8 == 4 ? 16 : __i % 8 == 5 ? 32
+	       : __i % 8 == 6 ? 24 : 21;
+	}
+      };
+
+    template<>
+      struct __threefry_constants<std::uint64_t, 4>
+      {
+	static constexpr std::uint64_t _S_parity = 0x1BD11BDAA9FC1A22ULL;
+	static constexpr int
+	_S_rot(std::size_t __i, std::size_t __j)
+	{
+	  return __i % 8 == 0 ? (__j == 0 ? 14 : 16)
+	       : __i % 8 == 1 ? (__j == 0 ? 52 : 57)
+	       : __i % 8 == 2 ? (__j == 0 ? 23 : 40)
+	       : __i % 8 == 3 ? (__j == 0 ? 5 : 37)
+	       : __i % 8 == 4 ? (__j == 0 ? 25 : 33)
+	       : __i % 8 == 5 ? (__j == 0 ? 46 : 12)
+	       : __i % 8 == 6 ? (__j == 0 ? 58 : 22)
+	       : (__j == 0 ? 32 : 32);
+	}
+      };
+
+    template<typename _Function>
+      struct __cbrng_bulk;
+  } // namespace __detail
+
+  /**
+   * @brief The Philox keyed bijection of Salmon, Moraes, Dror and Shaw,
+   *        "Parallel random numbers: as easy as 1, 2, 3" (SC11).
+   *
+   * Maps a counter of @p __n words to @p __n random words under a key
+   * of @p __n / 2 words in @p __r rounds; each round multiplies pairs
+   * of words and xors the high halves with the other words and the key,
+   * which is bumped by a Weyl sequence between rounds.  The output for
+   * the zero key and counter is the known answer of Random123.
+   */
+  template<typename _UIntType, std::size_t __n, std::size_t __r>
+    class philox_function
+    {
+      static_assert(std::is_same<_UIntType, std::uint32_t>::value
+		    || std::is_same<_UIntType, std::uint64_t>::value,
+		    "the word must be a 32-bit or a 64-bit unsigned integer");
+      static_assert(__n == 2 || __n == 4, "the counter must have 2 or 4 words");
+
+      template<typename> friend struct __detail::__cbrng_bulk;
+
+      typedef __detail::__philox_constants<_UIntType, __n> _Consts;
+
+      //  Counters per vector in generate(): none.  No target has the high
+      //  half of 64-bit lane products, and building the 32-bit products
+      //  in 64-bit lanes loses to the scalar multiplies even with AVX-512;
+      //  the blocks of the plain loop overlap in the pipeline instead.
+      static constexpr std::size_t _S_lanes = 1;
+
+    public:
+      /** The type of the words of the counter, key and result. */
+      using result_type = _UIntType;
+      using counter_type = std::array<_UIntType, __n>;
+      using key_type = std::array<_UIntType, __n / 2>;
+
+      static constexpr std::size_t word_size = std::numeric_limits<_UIntType>::digits;
+      static constexpr std::size_t word_count = __n;
+      static constexpr std::size_t rounds = __r;
+
+      philox_function()
+      : _M_key()
+      { }
+
+      explicit
+      philox_function(const key_type& __k)
+      : _M_key(__k)
+      { }
+
+      const key_type&
+      key() const
+      { return this->_M_key; }
+
+      /**
+       * @brief The random words of the counter @p __ctr.
+       */
+      counter_type
+      operator()(const counter_type& __ctr) const
+      {
+	_UIntType __x[__n];
+	for (std::size_t __j = 0; __j < __n; ++__j)
+	  __x[__j] = __ctr[__j];
+	this->_M_rounds(__x);
+	counter_type __y;
+	for (std::size_t __j = 0; __j < __n; ++__j)
+	  __y[__j] = __x[__j];
+	return __y;
+      }
+
+      /**
+       * @brief Writes the words of the @p __blocks counters from @p __ctr
+       *        on to @p __out, @p __n words per counter.
+       */
+      void
+      generate(const counter_type& __ctr, result_type* __out,
+	       std::size_t __blocks) const;
+
+      friend bool
+      operator==(const philox_function& __lhs, const philox_function& __rhs)
+      { return __lhs._M_key == __rhs._M_key; }
+
+    private:
+      template<typename _Word>
+	void
+	_M_rounds(_Word (&__x)[__n]) const
+	{
+	  //  The words in a local copy, which stays in registers.
+	  _Word __y[__n];
+	  for (std::size_t __j = 0; __j < __n; ++__j)
+	    __y[__j] = __x[__j];
+	  _S_rounds_from<0>(__y, this->_M_key[0], this->_M_key[__n / 2 - 1],
+			    std::integral_constant<bool, (0 < __r)>());
+	  for (std::size_t __j = 0; __j < __n; ++__j)
+	    __x[__j] = __y[__j];
+	}
+
+      //  The rounds are unrolled, the key bumped by constants.
+      template<std::size_t _Ip, typename _Word>
+	static void
+	_S_rounds_from(_Word (&__x)[__n], _UIntType __k0, _UIntType __k1,
+		       std::true_type)
+	{
+	  _S_round(__x, __k0, __k1);
+	  _S_rounds_from<_Ip + 1>(__x, _UIntType(__k0 + _Consts::_S_w0),
+				  _UIntType(__k1 + _Consts::_S_w1),
+				  std::integral_constant<bool, (_Ip + 1 < __r)>());
+	}
+
+      template<std::size_t _Ip, typename _Word>
+	static void
+	_S_rounds_from(_Word (&)[__n], _UIntType, _UIntType, std::false_type)
+	{ }
+
+      template<typename _Word>
+	static void
+	_S_round(_Word (&__x)[2], _UIntType __k0, _UIntType)
+	{
+	  _Word __hi, __lo;
+	  __detail::__philox_mulhilo(_Consts::_S_m0, __x[0], __hi, __lo);
+	  __x[0] = __hi ^ __k0 ^ __x[1];
+	  __x[1] = __lo;
+	}
+
+      template<typename _Word>
+	static void
+	_S_round(_Word (&__x)[4], _UIntType __k0, _UIntType __k1)
+	{
+	  _Word __hi0, __lo0, __hi1, __lo1;
+	  __detail::__philox_mulhilo(_Consts::_S_m0, __x[0], __hi0, __lo0);
+	  __detail::__philox_mulhilo(_Consts::_S_m1, __x[2], __hi1, __lo1);
+	  __x[0] = __hi1 ^ __x[1] ^ __k0;
+	  __x[1] = __lo1;
+	  __x[2] = __hi0 ^ __x[3] ^ __k1;
+	  __x[3] = __lo0;
+	}
+
+      key_type _M_key;
+    };
+
+  /**
+   * @brief The Threefry keyed bijection of Salmon et al., the Threefish
+   *        block cipher of Skein with fewer rounds and no tweak.
+   *
+   * Maps a counter of @p __n words to @p __n random words under a key
+   * of @p __n words in @p __r rounds of add, rotate and xor, with the
+   * key schedule injected every four rounds.
+   */
+  template<typename _UIntType, std::size_t __n, std::size_t __r>
+    class threefry_function
+    {
+      static_assert(std::is_same<_UIntType, std::uint32_t>::value
+		    || std::is_same<_UIntType, std::uint64_t>::value,
+		    "the word must be a 32-bit or a 64-bit unsigned integer");
+      static_assert(__n == 2 || __n == 4, "the counter must have 2 or 4 words");
+
+      template<typename> friend struct __detail::__cbrng_bulk;
+
+      typedef __detail::__threefry_constants<_UIntType, __n> _Consts;
+
+      //  Counters per vector in generate().
+      static constexpr std::size_t _S_lanes = 32 / sizeof(_UIntType);
+
+    public:
+      /** The type of the words of the counter, key and result. */
+      using result_type = _UIntType;
+      using counter_type = std::array<_UIntType, __n>;
+      using key_type = std::array<_UIntType, __n>;
+
+      static constexpr std::size_t word_size = std::numeric_limits<_UIntType>::digits;
+      static constexpr std::size_t word_count = __n;
+      static constexpr std::size_t rounds = __r;
+
+      threefry_function()
+      : _M_key()
+      { }
+
+      explicit
+      threefry_function(const key_type& __k)
+      : _M_key(__k)
+      { }
+
+      const key_type&
+      key() const
+      { return this->_M_key; }
+
+      /**
+       * @brief The random words of the counter @p __ctr.
+       */
+      counter_type
+      operator()(const counter_type& __ctr) const
+      {
+	_UIntType __x[__n];
+	for (std::size_t __j = 0; __j < __n; ++__j)
+	  __x[__j] = __ctr[__j];
+	this->_M_rounds(__x);
+	counter_type __y;
+	for (std::size_t __j = 0; __j < __n; ++__j)
+	  __y[__j] = __x[__j];
+	return __y;
+      }
+
+      /**
+       * @brief Writes the words of the @p __blocks counters from @p __ctr
+       *        on to @p __out, @p __n words per counter, several counters
+       *        at a time in vector registers.
+       */
+      void
+      generate(const counter_type& __ctr, result_type* __out,
+	       std::size_t __blocks) const;
+
+      friend bool
+      operator==(const threefry_function& __lhs, const threefry_function& __rhs)
+      { return __lhs._M_key == __rhs._M_key; }
+
+    private:
+      template<typename _Word>
+	void
+	_M_rounds(_Word (&__x)[__n]) const
+	{
+	  _UIntType __ks[__n + 1];
+	  __ks[__n] = _Consts::_S_parity;
+	  //  The words in a local copy, which stays in registers.
+	  _Word __y[__n];
+	  for (std::size_t __j = 0; __j < __n; ++__j)
+	    {
+	      __ks[__j] = this->_M_key[__j];
+	      __ks[__n] ^= this->_M_key[__j];
+	      __y[__j] = __x[__j] + __ks[__j];
+	    }
+	  _S_rounds_from<0>(__y, __ks, std::integral_constant<bool, (0 < __r)>());
+	  for (std::size_t __j = 0; __j < __n; ++__j)
+	    __x[__j] = __y[__j];
+	}
+
+      //  The rounds are unrolled so that the rotations are constants.
+      template<std::size_t _Ip, typename _Word>
+	static void
+	_S_rounds_from(_Word (&__x)[__n], const _UIntType* __ks, std::true_type)
+	{
+	  _S_round<_Ip>(__x);
+	  if (_Ip % 4 == 3)
+	    {
+	      constexpr std::size_t __s = _Ip / 4 + 1;
+	      for (std::size_t __j = 0; __j < __n; ++__j)
+		__x[__j] += __ks[(__s + __j) % (__n + 1)];
+	      __x[__n - 1] += _UIntType(__s);
+	    }
+	  _S_rounds_from<_Ip + 1>(__x, __ks, std::integral_constant<bool, (_Ip + 1 < __r)>());
+	}
+
+      template<std::size_t _Ip, typename _Word>
+	static void
+	_S_rounds_from(_Word (&)[__n], const _UIntType*, std::false_type)
+	{ }
+
+      template<int __rot, typename _Word>
+	static void
+	_S_mix(_Word& __x0, _Word& __x1)
+	{
+	  constexpr int __w = std::numeric_limits<_UIntType>::digits;
+	  __x0 += __x1;
+	  __x1 = (__x1 << __rot) | (__x1 >> (__w - __rot));
+	  __x1 ^= __x0;
+	}
+
+      template<std::size_t _Ip, typename _Word>
+	static void
+	_S_round(_Word (&__x)[2])
+	{ _S_mix<_Consts::_S_rot(_Ip, 0)>(__x[0], __x[1]); }
+
+      template<std::size_t _Ip, typename _Word>
+	static void
+	_S_round(_Word (&__x)[4])
+	{
+	  if (_Ip % 2 == 0)
+	    {
+	      _S_mix<_Consts::_S_rot(_Ip, 0)>(__x[0], __x[1]);
+	      _S_mix<_Consts::_S_rot(_Ip, 1)>(__x[2], __x[3]);
+	    }
+	  else
+	    {
+	      _S_mix<_Consts::_S_rot(_Ip, 0)>(__x[0], __x[3]);
+	      _S_mix<_Consts::_S_rot(_Ip, 1)>(__x[2], __x[1]);
+	    }
+	}
+
+      key_type _M_key;
+    };
+
+  /**
+   * @brief A random number engine on a counter-based keyed bijection:
+   *        word j of the output of counter c is number c * n + j of
+   *        the stream of the key.
+   *
+   * The state is the key, the counter of the next block, the block
+   * under way and the place in it, as std::philox_engine of C++26;
+   * seed(s) sets the key to {s, 0...} and the counter to zero, and the
+   * defaults give its 10000th numbers.  Random access is O(1): set_counter()
+   * and discard() just move the counter, so the k-th number of stream s
+   * is regenerated from (s, k) with nothing stored.  fill() writes whole
+   * blocks straight from generate() of the function.
+   */
+  template<typename _Function>
+    class counter_based_engine
+    {
+    public:
+      using function_type = _Function;
+      /** The type of the generated random value. */
+      using result_type = typename _Function::result_type;
+      using counter_type = typename _Function::counter_type;
+      using key_type = typename _Function::key_type;
+
+      static constexpr std::size_t word_size = _Function::word_size;
+      static constexpr std::size_t word_count = _Function::word_count;
+      static constexpr result_type default_seed = 20111115u;
+
+      counter_based_engine()
+      : counter_based_engine(default_seed)
+      { }
+
+      explicit
+      counter_based_engine(result_type __s)
+      { seed(__s); }
+
+      template<typename _Sseq, typename = typename
+	std::enable_if<!std::is_same<_Sseq, counter_based_engine>::value
+		       && !std::is_convertible<_Sseq, result_type>::value
+		       && !std::is_convertible<_Sseq, key_type>::value>::type>
+	explicit
+	counter_based_engine(_Sseq& __seq)
+	{ seed(__seq); }
+
+      /**
+       * @brief Starts stream @p __k at block @p __ctr.
+       */
+      explicit
+      counter_based_engine(const key_type& __k,
+			   const counter_type& __ctr = counter_type())
+      : _M_f(__k), _M_x(__ctr), _M_y(), _M_i(word_count)
+      { }
+
+      void
+      seed(result_type __s = default_seed)
+      {
+	key_type __k = key_type();
+	__k[0] = __s;
+	this->_M_f = _Function(__k);
+	this->set_counter(counter_type());
+      }
+
+      /**
+       * @brief Seeds the key from a seed sequence, the counter with zero.
+       */
+      template<typename _Sseq>
+	typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value>::type
+	seed(_Sseq& __seq);
+
+      /**
+       * @brief Places the engine at the first word of block @p __ctr,
+       *        with the key as it is.
+       */
+      void
+      set_counter(const counter_type& __ctr)
+      {
+	this->_M_x = __ctr;
+	this->_M_y = counter_type();
+	this->_M_i = word_count;
+      }
+
+      /** The counter of the next block to be generated. */
+      const counter_type&
+      counter() const
+      { return this->_M_x; }
+
+      const key_type&
+      key() const
+      { return this->_M_f.key(); }
+
+      const function_type&
+      function() const
+      { return this->_M_f; }
+
+      static constexpr result_type
+      min()
+      { return std::numeric_limits<result_type>::min(); }
+
+      static constexpr result_type
+      max()
+      { return std::numeric_limits<result_type>::max(); }
+
+      result_type
+      operator()()
+      {
+	if (this->_M_i == word_count)
+	  {
+	    this->_M_y = this->_M_f(this->_M_x);
+	    __detail::__cbrng_add(this->_M_x, 1);
+	    this->_M_i = 0;
+	  }
+	return this->_M_y[this->_M_i++];
+      }
+
+      /**
+       * @brief Skips @p __n numbers in constant time.
+       */
+      void
+      discard(unsigned long long __n);
+
+      /**
+       * @brief Writes the same @p __n numbers to @p __out as @p __n calls
+       *        of operator() would.
+       */
+      void
+      fill(result_type* __out, std::size_t __n);
+
+      friend bool
+      operator==(const counter_based_engine& __lhs,
+		 const counter_based_engine& __rhs)
+      {
+	if (!(__lhs._M_f == __rhs._M_f) || __lhs._M_x != __rhs._M_x
+	    || __lhs._M_i != __rhs._M_i)
+	  return false;
+	for (std::size_t __j = __lhs._M_i; __j < word_count; ++__j)
+	  if (__lhs._M_y[__j] != __rhs._M_y[__j])
+	    return false;
+	return true;
+      }
+
+      template<typename _Function1, typename _CharT, typename _Traits>
+	friend std::basic_ostream<_CharT, _Traits>&
+	operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+		   const counter_based_engine<_Function1>& __x);
+
+      template<typename _Function1, typename _CharT, typename _Traits>
+	friend std::basic_istream<_CharT, _Traits>&
+	operator>>(std::basic_istream<_CharT, _Traits>& __is,
+		   counter_based_engine<_Function1>& __x);
+
+    private:
+      _Function _M_f;
+      counter_type _M_x;
+      counter_type _M_y;
+      std::size_t _M_i;
+    };
+
+  template<typename _Function>
+    inline bool
+    operator!=(const counter_based_engine<_Function>& __lhs,
+	       const counter_based_engine<_Function>& __rhs)
+    { return !(__lhs == __rhs); }
+
+  /** Philox with 32-bit and 64-bit words, ten rounds, as Random123. */
+  using philox2x32 = counter_based_engine<philox_function<std::uint32_t, 2, 10>>;
+  using philox4x32 = counter_based_engine<philox_function<std::uint32_t, 4, 10>>;
+  using philox2x64 = counter_based_engine<philox_function<std::uint64_t, 2, 10>>;
+  using philox4x64 = counter_based_engine<philox_function<std::uint64_t, 4, 10>>;
+
+  /** Threefry with 32-bit and 64-bit words, twenty rounds, as Random123. */
+  using threefry2x32 = counter_based_engine<threefry_function<std::uint32_t, 2, 20>>;
+  using threefry4x32 = counter_based_engine<threefry_function<std::uint32_t, 4, 20>>;
+  using threefry2x64 = counter_based_engine<threefry_function<std::uint64_t, 2, 20>>;
+  using threefry4x64 = counter_based_engine<threefry_function<std::uint64_t, 4, 20>>;
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#include <ext/counter_based_engine.tcc>
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // COUNTER_BASED_ENGINE_H
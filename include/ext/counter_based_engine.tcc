@@ -0,0 +1,246 @@
+#ifndef COUNTER_BASED_ENGINE_TCC
+#define COUNTER_BASED_ENGINE_TCC 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <iostream>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    /*
+     * The bulk path of the keyed functions: _S_lanes consecutive counters
+     * go through the rounds together, counter l in lane l of each word,
+     * and are written back out block by block.  A group whose low words
+     * would wrap goes through one counter at a time instead, so the
+     * carry into the higher words needs no vector code.  With one lane
+     * it is a plain loop, the blocks overlapping in the pipeline.
+     */
+    template<typename _Function>
+      struct __cbrng_bulk
+      {
+	typedef typename _Function::result_type _UIntType;
+	typedef typename _Function::counter_type _Counter;
+	static constexpr std::size_t _Lanes = _Function::_S_lanes;
+	static constexpr std::size_t __n = _Function::word_count;
+	typedef typename __cbrng_word<_UIntType, _Lanes>::__type __word;
+
+	static void
+	_S_generate(const _Function& __f, _Counter __ctr,
+		    _UIntType* __out, std::size_t __blocks)
+	{
+	  _S_generate(__f, __ctr, __out, __blocks,
+		      std::integral_constant<bool, (_Lanes > 1)>());
+	}
+
+	static void
+	_S_generate(const _Function& __f, _Counter& __ctr,
+		    _UIntType* __out, std::size_t __blocks, std::true_type)
+	{
+	  __word __iota;
+	  for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	    __iota[__l] = _UIntType(__l);
+
+	  while (__blocks > 0)
+	    if (__blocks >= _Lanes
+		&& __ctr[0] <= std::numeric_limits<_UIntType>::max() - (_Lanes - 1))
+	      {
+		__word __x[__n];
+		for (std::size_t __j = 0; __j < __n; ++__j)
+		  __x[__j] = __word{} + __ctr[__j];
+		__x[0] += __iota;
+		__f._M_rounds(__x);
+		for (std::size_t __l = 0; __l < _Lanes; ++__l)
+		  for (std::size_t __j = 0; __j < __n; ++__j)
+		    *__out++ = __x[__j][__l];
+		__cbrng_add(__ctr, _Lanes);
+		__blocks -= _Lanes;
+	      }
+	    else
+	      {
+		_S_one(__f, __ctr, __out);
+		__out += __n;
+		--__blocks;
+	      }
+	}
+
+	static void
+	_S_generate(const _Function& __f, _Counter& __ctr,
+		    _UIntType* __out, std::size_t __blocks, std::false_type)
+	{
+	  _Counter __c = __ctr;
+	  for (; __blocks > 0; --__blocks, __out += __n)
+	    _S_one(__f, __c, __out);
+	  __ctr = __c;
+	}
+
+	static void
+	_S_one(const _Function& __f, _Counter& __ctr, _UIntType* __out)
+	{
+	  _UIntType __x[__n];
+	  for (std::size_t __j = 0; __j < __n; ++__j)
+	    __x[__j] = __ctr[__j];
+	  __f._M_rounds(__x);
+	  for (std::size_t __j = 0; __j < __n; ++__j)
+	    __out[__j] = __x[__j];
+	  __cbrng_add(__ctr, 1);
+	}
+      };
+  } // namespace __detail
+
+  template<typename _UIntType, std::size_t __n, std::size_t __r>
+    void
+    philox_function<_UIntType, __n, __r>::
+    generate(const counter_type& __ctr, result_type* __out,
+	     std::size_t __blocks) const
+    { __detail::__cbrng_bulk<philox_function>::_S_generate(*this, __ctr, __out, __blocks); }
+
+  template<typename _UIntType, std::size_t __n, std::size_t __r>
+    void
+    threefry_function<_UIntType, __n, __r>::
+    generate(const counter_type& __ctr, result_type* __out,
+	     std::size_t __blocks) const
+    { __detail::__cbrng_bulk<threefry_function>::_S_generate(*this, __ctr, __out, __blocks); }
+
+  template<typename _Function>
+    template<typename _Sseq>
+      typename std::enable_if<!std::is_convertible<_Sseq,
+		typename _Function::result_type>::value>::type
+      counter_based_engine<_Function>::
+      seed(_Sseq& __seq)
+      {
+	constexpr std::size_t __p = (word_size + 31) / 32;
+	key_type __k;
+	std::uint_least32_t __arr[std::tuple_size<key_type>::value * __p];
+	__seq.generate(__arr + 0, __arr + std::tuple_size<key_type>::value * __p);
+	for (std::size_t __j = 0; __j < __k.size(); ++__j)
+	  {
+	    result_type __s = 0;
+	    for (std::size_t __i = 0; __i < __p; ++__i)
+	      __s |= result_type(__arr[__j * __p + __i] & 0xffffffffu) << (32 * __i);
+	    __k[__j] = __s;
+	  }
+	this->_M_f = _Function(__k);
+	this->set_counter(counter_type());
+      }
+
+  template<typename _Function>
+    void
+    counter_based_engine<_Function>::
+    discard(unsigned long long __n)
+    {
+      const unsigned long long __left = word_count - this->_M_i;
+      if (__n <= __left)
+	{
+	  this->_M_i += __n;
+	  return;
+	}
+      __n -= __left;
+      __detail::__cbrng_add(this->_M_x, __n / word_count);
+      this->_M_i = word_count;
+      if (__n % word_count != 0)
+	{
+	  this->_M_y = this->_M_f(this->_M_x);
+	  __detail::__cbrng_add(this->_M_x, 1);
+	  this->_M_i = __n % word_count;
+	}
+    }
+
+  template<typename _Function>
+    void
+    counter_based_engine<_Function>::
+    fill(result_type* __out, std::size_t __n)
+    {
+      for (; __n > 0 && this->_M_i < word_count; --__n)
+	*__out++ = this->_M_y[this->_M_i++];
+      const std::size_t __blocks = __n / word_count;
+      if (__blocks > 0)
+	{
+	  this->_M_f.generate(this->_M_x, __out, __blocks);
+	  __detail::__cbrng_add(this->_M_x, __blocks);
+	  __out += __blocks * word_count;
+	  __n -= __blocks * word_count;
+	}
+      for (; __n > 0; --__n)
+	*__out++ = this->operator()();
+    }
+
+  template<typename _Function, typename _CharT, typename _Traits>
+    std::basic_ostream<_CharT, _Traits>&
+    operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+	       const counter_based_engine<_Function>& __x)
+    {
+      typedef std::basic_ostream<_CharT, _Traits>  __ostream_type;
+      typedef typename __ostream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __os.flags();
+      const _CharT __fill = __os.fill();
+      const _CharT __space = __os.widen(' ');
+      __os.flags(__ios_base::dec | __ios_base::fixed | __ios_base::left);
+      __os.fill(__space);
+
+      for (auto __k : __x.key())
+	__os << __k << __space;
+      for (auto __c : __x._M_x)
+	__os << __c << __space;
+      for (auto __y : __x._M_y)
+	__os << __y << __space;
+      __os << __x._M_i;
+
+      __os.flags(__flags);
+      __os.fill(__fill);
+      return __os;
+    }
+
+  template<typename _Function, typename _CharT, typename _Traits>
+    std::basic_istream<_CharT, _Traits>&
+    operator>>(std::basic_istream<_CharT, _Traits>& __is,
+	       counter_based_engine<_Function>& __x)
+    {
+      typedef std::basic_istream<_CharT, _Traits>  __istream_type;
+      typedef typename __istream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __is.flags();
+      __is.flags(__ios_base::dec | __ios_base::skipws);
+
+      typename _Function::key_type __k;
+      typename _Function::counter_type __c, __y;
+      std::size_t __i;
+      for (auto& __kk : __k)
+	__is >> __kk;
+      for (auto& __cc : __c)
+	__is >> __cc;
+      for (auto& __yy : __y)
+	__is >> __yy;
+      __is >> __i;
+      if (!__is.fail() && __i <= _Function::word_count)
+	{
+	  __x._M_f = _Function(__k);
+	  __x._M_x = __c;
+	  __x._M_y = __y;
+	  __x._M_i = __i;
+	}
+      else
+	__is.setstate(__ios_base::failbit);
+
+      __is.flags(__flags);
+      return __is;
+    }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // COUNTER_BASED_ENGINE_TCC
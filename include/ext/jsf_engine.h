@@ -0,0 +1,364 @@
+#ifndef JSF_ENGINE_H
+#define JSF_ENGINE_H 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <iosfwd>
+#include <type_traits>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    template<typename _UIntType, int __k>
+      constexpr _UIntType
+      __jsf_rot(_UIntType __x)
+      {
+	constexpr int __w = std::numeric_limits<_UIntType>::digits;
+	return __k == 0 ? __x : _UIntType((__x << __k) | (__x >> ((__w - __k) % __w)));
+      }
+
+    //  The same for a vector of lanes, with the word width given.
+    //  The result goes out by reference: a wide vector returned by value
+    //  has a different ABI with and without AVX, and GCC warns of it.
+    template<int __w, int __k, typename _Vec>
+      inline void
+      __jsf_rot_vec(const _Vec& __x, _Vec& __y)
+      { __y = __k == 0 ? __x : (__x << __k) | (__x >> ((__w - __k) % __w)); }
+  } // namespace __detail
+
+  /**
+   * @brief The small noncryptographic PRNG of R.J. Jenkins, "ranctx",
+   *        also known as JSF.
+   *
+   * The state is four words a, b, c, d; each step is
+   * @f[
+   *   e = a - (b \lll p), a = b \oplus (c \lll q), b = c + (d \lll r),
+   *   c = d + e, d = e + a
+   * @f]
+   * and returns d.  raninit seeds with a = 0xf1ea5eed, b = c = d = seed,
+   * then makes 20 steps.  A rotation of 0 leaves the word as it is,
+   * as the two-rotation 32-bit version has it.
+   *
+   * @see http://burtleburtle.net/bob/rand/smallprng.html
+   */
+  template<typename _UIntType, int __p, int __q, int __r>
+    class jsf_engine
+    {
+      static_assert(std::is_unsigned<_UIntType>::value,
+		    "result_type must be an unsigned integral type");
+
+      template<typename, std::size_t> friend class jsf_engine_x;
+
+    public:
+      /** The type of the generated random value. */
+      using result_type = _UIntType;
+
+      static constexpr result_type default_seed = 0;
+
+      jsf_engine()
+      : jsf_engine(default_seed)
+      { }
+
+      explicit
+      jsf_engine(result_type __s)
+      { seed(__s); }
+
+      template<typename _Sseq, typename = typename
+	std::enable_if<!std::is_same<_Sseq, jsf_engine>::value
+		       && !std::is_convertible<_Sseq, result_type>::value>::type>
+	explicit
+	jsf_engine(_Sseq& __seq)
+	{ seed(__seq); }
+
+      /**
+       * @brief Seeds the state as raninit of the reference implementation.
+       */
+      void
+      seed(result_type __s = default_seed)
+      {
+	this->_M_a = result_type(0xf1ea5eedUL);
+	this->_M_b = this->_M_c = this->_M_d = __s;
+	for (int __i = 0; __i < 20; ++__i)
+	  this->operator()();
+      }
+
+      /**
+       * @brief Seeds the state from a seed sequence, as seed() with the
+       *        number it generates.
+       */
+      template<typename _Sseq>
+	typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value>::type
+	seed(_Sseq& __seq);
+
+      static constexpr result_type
+      min()
+      { return std::numeric_limits<result_type>::min(); }
+
+      static constexpr result_type
+      max()
+      { return std::numeric_limits<result_type>::max(); }
+
+      result_type
+      operator()()
+      {
+	const result_type __e = this->_M_a - __detail::__jsf_rot<result_type, __p>(this->_M_b);
+	this->_M_a = this->_M_b ^ __detail::__jsf_rot<result_type, __q>(this->_M_c);
+	this->_M_b = this->_M_c + __detail::__jsf_rot<result_type, __r>(this->_M_d);
+	this->_M_c = this->_M_d + __e;
+	this->_M_d = __e + this->_M_a;
+	return this->_M_d;
+      }
+
+      void
+      discard(unsigned long long __n)
+      {
+	for (; __n != 0ULL; --__n)
+	  this->operator()();
+      }
+
+      /**
+       * @brief Writes the same @p __n numbers to @p __out as @p __n calls
+       *        of operator() would.
+       */
+      void
+      fill(result_type* __out, std::size_t __n);
+
+      friend bool
+      operator==(const jsf_engine& __lhs, const jsf_engine& __rhs)
+      {
+	return __lhs._M_a == __rhs._M_a && __lhs._M_b == __rhs._M_b
+	    && __lhs._M_c == __rhs._M_c && __lhs._M_d == __rhs._M_d;
+      }
+
+      template<typename _UIntType1, int __p1, int __q1, int __r1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_ostream<_CharT, _Traits>&
+	operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+		   const jsf_engine<_UIntType1, __p1, __q1, __r1>& __x);
+
+      template<typename _UIntType1, int __p1, int __q1, int __r1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_istream<_CharT, _Traits>&
+	operator>>(std::basic_istream<_CharT, _Traits>& __is,
+		   jsf_engine<_UIntType1, __p1, __q1, __r1>& __x);
+
+    private:
+      result_type _M_a;
+      result_type _M_b;
+      result_type _M_c;
+      result_type _M_d;
+    };
+
+  template<typename _UIntType, int __p, int __q, int __r>
+    inline bool
+    operator!=(const jsf_engine<_UIntType, __p, __q, __r>& __lhs,
+	       const jsf_engine<_UIntType, __p, __q, __r>& __rhs)
+    { return !(__lhs == __rhs); }
+
+  /** 32-bit words, 16 bytes of state: the two-rotation ranctx of Jenkins. */
+  using jsf32 = jsf_engine<std::uint32_t, 27, 17, 0>;
+
+  /** 64-bit words, 32 bytes of state. */
+  using jsf64 = jsf_engine<std::uint64_t, 7, 13, 37>;
+
+  /**
+   * @brief @p _Lanes independent jsf32 or jsf64 streams, stepped together
+   *        in vector registers.
+   *
+   * Lane l gives exactly the numbers of a scalar engine seeded with
+   * seed(__s * _Lanes + l), so that the lanes of engines seeded with
+   * different __s are different streams, as long as __s * _Lanes does
+   * not wrap around; operator() and fill() take the lanes in turn, one number
+   * of each per step, so that fill() is a plain store of the vector
+   * of d.  The lanes are laid out as one vector per state word.
+   */
+  template<typename _Engine, std::size_t _Lanes>
+    class jsf_engine_x;
+
+  template<typename _UIntType, int __p, int __q, int __r, std::size_t _Lanes>
+    class jsf_engine_x<jsf_engine<_UIntType, __p, __q, __r>, _Lanes>
+    {
+      static_assert(_Lanes == 2 || _Lanes == 4 || _Lanes == 8 || _Lanes == 16,
+		    "the number of lanes must be 2, 4, 8 or 16");
+
+      typedef _UIntType __vec_type
+	__attribute__ ((vector_size (sizeof(_UIntType) * _Lanes)));
+      static constexpr int _S_w = std::numeric_limits<_UIntType>::digits;
+
+    public:
+      /** The type of the generated random value. */
+      using result_type = _UIntType;
+      /** The scalar engine of each lane. */
+      using engine_type = jsf_engine<_UIntType, __p, __q, __r>;
+
+      static constexpr std::size_t lanes = _Lanes;
+
+      jsf_engine_x()
+      : jsf_engine_x(engine_type::default_seed)
+      { }
+
+      /**
+       * @brief Seeds lane l with @p __s * _Lanes + l.
+       */
+      explicit
+      jsf_engine_x(result_type __s)
+      { seed(__s); }
+
+      template<typename _Sseq, typename = typename
+	std::enable_if<!std::is_same<_Sseq, jsf_engine_x>::value
+		       && !std::is_convertible<_Sseq, result_type>::value
+		       && !std::is_array<_Sseq>::value>::type>
+	explicit
+	jsf_engine_x(_Sseq& __seq)
+	{ seed(__seq); }
+
+      void
+      seed(result_type __s = engine_type::default_seed)
+      {
+	result_type __seeds[_Lanes];
+	for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	  __seeds[__l] = result_type(__s * _Lanes + __l);
+	seed(__seeds);
+      }
+
+      /**
+       * @brief Seeds lane l with @p __seeds[l].
+       */
+      void
+      seed(const result_type* __seeds);
+
+      /**
+       * @brief Seeds the lanes from a seed sequence, lane l as seed() of
+       *        jsf_engine with the l-th number it generates.  An array
+       *        of seeds goes to the overload above.
+       */
+      template<typename _Sseq>
+	typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value
+				&& !std::is_array<_Sseq>::value>::type
+	seed(_Sseq& __seq);
+
+      static constexpr result_type
+      min()
+      { return std::numeric_limits<result_type>::min(); }
+
+      static constexpr result_type
+      max()
+      { return std::numeric_limits<result_type>::max(); }
+
+      result_type
+      operator()()
+      {
+	if (this->_M_next == _Lanes)
+	  {
+	    this->_M_step();
+	    this->_M_next = 0;
+	  }
+	return this->_M_d[this->_M_next++];
+      }
+
+      void
+      discard(unsigned long long __n)
+      {
+	for (; __n != 0ULL; --__n)
+	  this->operator()();
+      }
+
+      /**
+       * @brief Writes the same @p __n numbers to @p __out as @p __n calls
+       *        of operator() would.
+       */
+      void
+      fill(result_type* __out, std::size_t __n);
+
+      /**
+       * @brief The state of lane @p __l, as a scalar engine; the numbers
+       *        of the current step already taken are not undone.
+       */
+      engine_type
+      lane(std::size_t __l) const
+      {
+	engine_type __e;
+	__e._M_a = this->_M_a[__l];
+	__e._M_b = this->_M_b[__l];
+	__e._M_c = this->_M_c[__l];
+	__e._M_d = this->_M_d[__l];
+	return __e;
+      }
+
+      friend bool
+      operator==(const jsf_engine_x& __lhs, const jsf_engine_x& __rhs)
+      {
+	if (__lhs._M_next != __rhs._M_next)
+	  return false;
+	for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	  if (__lhs._M_a[__l] != __rhs._M_a[__l] || __lhs._M_b[__l] != __rhs._M_b[__l]
+	      || __lhs._M_c[__l] != __rhs._M_c[__l] || __lhs._M_d[__l] != __rhs._M_d[__l])
+	    return false;
+	return true;
+      }
+
+      template<typename _Engine1, std::size_t _Lanes1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_ostream<_CharT, _Traits>&
+	operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+		   const jsf_engine_x<_Engine1, _Lanes1>& __x);
+
+      template<typename _Engine1, std::size_t _Lanes1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_istream<_CharT, _Traits>&
+	operator>>(std::basic_istream<_CharT, _Traits>& __is,
+		   jsf_engine_x<_Engine1, _Lanes1>& __x);
+
+    private:
+      void
+      _M_step()
+      {
+	__vec_type __rb, __rc, __rd;
+	__detail::__jsf_rot_vec<_S_w, __p>(this->_M_b, __rb);
+	__detail::__jsf_rot_vec<_S_w, __q>(this->_M_c, __rc);
+	__detail::__jsf_rot_vec<_S_w, __r>(this->_M_d, __rd);
+	const __vec_type __e = this->_M_a - __rb;
+	this->_M_a = this->_M_b ^ __rc;
+	this->_M_b = this->_M_c + __rd;
+	this->_M_c = this->_M_d + __e;
+	this->_M_d = __e + this->_M_a;
+      }
+
+      __vec_type _M_a;
+      __vec_type _M_b;
+      __vec_type _M_c;
+      __vec_type _M_d;
+      std::size_t _M_next;
+    };
+
+  template<typename _Engine, std::size_t _Lanes>
+    inline bool
+    operator!=(const jsf_engine_x<_Engine, _Lanes>& __lhs,
+	       const jsf_engine_x<_Engine, _Lanes>& __rhs)
+    { return !(__lhs == __rhs); }
+
+  template<std::size_t _Lanes> using jsf32_x = jsf_engine_x<jsf32, _Lanes>;
+  template<std::size_t _Lanes> using jsf64_x = jsf_engine_x<jsf64, _Lanes>;
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#include <ext/jsf_engine.tcc>
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // JSF_ENGINE_H
@@ -0,0 +1,232 @@
+#ifndef JSF_ENGINE_TCC
+#define JSF_ENGINE_TCC 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <iostream>
+#include <cstring>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  template<typename _UIntType, int __p, int __q, int __r>
+    template<typename _Sseq>
+      typename std::enable_if<!std::is_convertible<_Sseq, _UIntType>::value>::type
+      jsf_engine<_UIntType, __p, __q, __r>::
+      seed(_Sseq& __seq)
+      {
+	constexpr int __k = (std::numeric_limits<result_type>::digits + 31) / 32;
+	std::uint_least32_t __arr[__k];
+	__seq.generate(__arr + 0, __arr + __k);
+	result_type __s = 0;
+	for (int __i = 0; __i < __k; ++__i)
+	  __s = result_type((__s << 16 << 16) | (__arr[__i] & 0xffffffffu));
+	this->seed(__s);
+      }
+
+  template<typename _UIntType, int __p, int __q, int __r>
+    void
+    jsf_engine<_UIntType, __p, __q, __r>::
+    fill(result_type* __out, std::size_t __n)
+    {
+      //  The state in registers for the whole loop.
+      result_type __a = this->_M_a, __b = this->_M_b;
+      result_type __c = this->_M_c, __d = this->_M_d;
+      for (; __n > 0; --__n)
+	{
+	  const result_type __e = __a - __detail::__jsf_rot<result_type, __p>(__b);
+	  __a = __b ^ __detail::__jsf_rot<result_type, __q>(__c);
+	  __b = __c + __detail::__jsf_rot<result_type, __r>(__d);
+	  __c = __d + __e;
+	  __d = __e + __a;
+	  *__out++ = __d;
+	}
+      this->_M_a = __a;
+      this->_M_b = __b;
+      this->_M_c = __c;
+      this->_M_d = __d;
+    }
+
+  template<typename _UIntType, int __p, int __q, int __r, std::size_t _Lanes>
+    void
+    jsf_engine_x<jsf_engine<_UIntType, __p, __q, __r>, _Lanes>::
+    seed(const result_type* __seeds)
+    {
+      for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	{
+	  this->_M_a[__l] = result_type(0xf1ea5eedUL);
+	  this->_M_b[__l] = this->_M_c[__l] = this->_M_d[__l] = __seeds[__l];
+	}
+      for (int __i = 0; __i < 20; ++__i)
+	this->_M_step();
+      this->_M_next = _Lanes;
+    }
+
+  template<typename _UIntType, int __p, int __q, int __r, std::size_t _Lanes>
+    template<typename _Sseq>
+      typename std::enable_if<!std::is_convertible<_Sseq, _UIntType>::value
+			      && !std::is_array<_Sseq>::value>::type
+      jsf_engine_x<jsf_engine<_UIntType, __p, __q, __r>, _Lanes>::
+      seed(_Sseq& __seq)
+      {
+	constexpr int __k = (std::numeric_limits<result_type>::digits + 31) / 32;
+	std::uint_least32_t __arr[__k * _Lanes];
+	__seq.generate(__arr + 0, __arr + __k * _Lanes);
+	result_type __seeds[_Lanes];
+	for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	  {
+	    __seeds[__l] = 0;
+	    for (int __i = 0; __i < __k; ++__i)
+	      __seeds[__l] = result_type((__seeds[__l] << 16 << 16)
+					 | (__arr[__l * __k + __i] & 0xffffffffu));
+	  }
+	this->seed(__seeds);
+      }
+
+  template<typename _UIntType, int __p, int __q, int __r, std::size_t _Lanes>
+    void
+    jsf_engine_x<jsf_engine<_UIntType, __p, __q, __r>, _Lanes>::
+    fill(result_type* __out, std::size_t __n)
+    {
+      for (; __n > 0 && this->_M_next < _Lanes; --__n)
+	*__out++ = this->_M_d[this->_M_next++];
+      for (; __n >= _Lanes; __n -= _Lanes, __out += _Lanes)
+	{
+	  this->_M_step();
+	  std::memcpy(__out, &this->_M_d, sizeof(this->_M_d));
+	}
+      if (__n > 0)
+	{
+	  this->_M_step();
+	  for (this->_M_next = 0; this->_M_next < __n; ++this->_M_next)
+	    __out[this->_M_next] = this->_M_d[this->_M_next];
+	}
+    }
+
+  template<typename _UIntType, int __p, int __q, int __r,
+	   typename _CharT, typename _Traits>
+    std::basic_ostream<_CharT, _Traits>&
+    operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+	       const jsf_engine<_UIntType, __p, __q, __r>& __x)
+    {
+      typedef std::basic_ostream<_CharT, _Traits>  __ostream_type;
+      typedef typename __ostream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __os.flags();
+      const _CharT __fill = __os.fill();
+      const _CharT __space = __os.widen(' ');
+      __os.flags(__ios_base::dec | __ios_base::fixed | __ios_base::left);
+      __os.fill(__space);
+
+      __os << __x._M_a << __space << __x._M_b << __space
+	   << __x._M_c << __space << __x._M_d;
+
+      __os.flags(__flags);
+      __os.fill(__fill);
+      return __os;
+    }
+
+  template<typename _UIntType, int __p, int __q, int __r,
+	   typename _CharT, typename _Traits>
+    std::basic_istream<_CharT, _Traits>&
+    operator>>(std::basic_istream<_CharT, _Traits>& __is,
+	       jsf_engine<_UIntType, __p, __q, __r>& __x)
+    {
+      typedef std::basic_istream<_CharT, _Traits>  __istream_type;
+      typedef typename __istream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __is.flags();
+      __is.flags(__ios_base::dec | __ios_base::skipws);
+
+      _UIntType __a, __b, __c, __d;
+      __is >> __a >> __b >> __c >> __d;
+      if (!__is.fail())
+	{
+	  __x._M_a = __a;
+	  __x._M_b = __b;
+	  __x._M_c = __c;
+	  __x._M_d = __d;
+	}
+
+      __is.flags(__flags);
+      return __is;
+    }
+
+  //  The lanes in turn, each as jsf_engine writes it, then the number
+  //  of the current step already taken.
+  template<typename _Engine, std::size_t _Lanes,
+	   typename _CharT, typename _Traits>
+    std::basic_ostream<_CharT, _Traits>&
+    operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+	       const jsf_engine_x<_Engine, _Lanes>& __x)
+    {
+      typedef std::basic_ostream<_CharT, _Traits>  __ostream_type;
+      typedef typename __ostream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __os.flags();
+      const _CharT __fill = __os.fill();
+      const _CharT __space = __os.widen(' ');
+      __os.flags(__ios_base::dec | __ios_base::fixed | __ios_base::left);
+      __os.fill(__space);
+
+      for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	__os << __x._M_a[__l] << __space << __x._M_b[__l] << __space
+	     << __x._M_c[__l] << __space << __x._M_d[__l] << __space;
+      __os << __x._M_next;
+
+      __os.flags(__flags);
+      __os.fill(__fill);
+      return __os;
+    }
+
+  template<typename _Engine, std::size_t _Lanes,
+	   typename _CharT, typename _Traits>
+    std::basic_istream<_CharT, _Traits>&
+    operator>>(std::basic_istream<_CharT, _Traits>& __is,
+	       jsf_engine_x<_Engine, _Lanes>& __x)
+    {
+      typedef std::basic_istream<_CharT, _Traits>  __istream_type;
+      typedef typename __istream_type::ios_base    __ios_base;
+      typedef typename _Engine::result_type        __result_type;
+
+      const typename __ios_base::fmtflags __flags = __is.flags();
+      __is.flags(__ios_base::dec | __ios_base::skipws);
+
+      __result_type __a[_Lanes], __b[_Lanes], __c[_Lanes], __d[_Lanes];
+      std::size_t __next;
+      for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	__is >> __a[__l] >> __b[__l] >> __c[__l] >> __d[__l];
+      __is >> __next;
+      if (!__is.fail() && __next <= _Lanes)
+	{
+	  for (std::size_t __l = 0; __l < _Lanes; ++__l)
+	    {
+	      __x._M_a[__l] = __a[__l];
+	      __x._M_b[__l] = __b[__l];
+	      __x._M_c[__l] = __c[__l];
+	      __x._M_d[__l] = __d[__l];
+	    }
+	  __x._M_next = __next;
+	}
+      else
+	__is.setstate(std::ios_base::failbit);
+
+      __is.flags(__flags);
+      return __is;
+    }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // JSF_ENGINE_TCC
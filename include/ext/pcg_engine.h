@@ -0,0 +1,313 @@
+#ifndef PCG_ENGINE_H
+#define PCG_ENGINE_H 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <iosfwd>
+#include <type_traits>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    /*
+     * The output permutations of the PCG family, applied to the LCG state.
+     * _S_previous says whether the output is taken from the state before
+     * the step (as pcg32 does) or after it (as pcg64 does), _S_cheap
+     * whether the LCG uses the 64-bit multiplier of the DXSM generators.
+     */
+
+    //  XSH RR: xorshift high bits, random rotation; 64-bit state, 32-bit output.
+    struct __pcg_xsh_rr
+    {
+      static constexpr bool _S_previous = true;
+      static constexpr bool _S_cheap = false;
+
+      template<typename _ResultType, typename _UIntType>
+	static _ResultType
+	_S_output(_UIntType __s)
+	{
+	  constexpr int __sbits = std::numeric_limits<_UIntType>::digits;
+	  constexpr int __rbits = std::numeric_limits<_ResultType>::digits;
+	  constexpr int __opbits = __rbits >= 128 ? 7 : __rbits >= 64 ? 6
+				 : __rbits >= 32 ? 5 : __rbits >= 16 ? 4 : 3;
+	  constexpr int __xshift = (__opbits + __rbits) / 2;
+	  constexpr int __bottom = __sbits - __opbits - __rbits;
+	  const unsigned __rot = unsigned(__s >> (__sbits - __opbits));
+	  const _ResultType __x = _ResultType(((__s >> __xshift) ^ __s) >> __bottom);
+	  return _ResultType(__x >> __rot)
+	       | _ResultType(__x << ((-__rot) & (__rbits - 1)));
+	}
+    };
+
+    //  XSL RR: xorshift low bits, random rotation; 128-bit state, 64-bit output.
+    struct __pcg_xsl_rr
+    {
+      static constexpr bool _S_previous = false;
+      static constexpr bool _S_cheap = false;
+
+      template<typename _ResultType, typename _UIntType>
+	static _ResultType
+	_S_output(_UIntType __s)
+	{
+	  constexpr int __sbits = std::numeric_limits<_UIntType>::digits;
+	  constexpr int __rbits = std::numeric_limits<_ResultType>::digits;
+	  constexpr int __opbits = __rbits >= 128 ? 7 : __rbits >= 64 ? 6
+				 : __rbits >= 32 ? 5 : __rbits >= 16 ? 4 : 3;
+	  const unsigned __rot = unsigned(__s >> (__sbits - __opbits));
+	  const _ResultType __x = _ResultType(__s >> (__sbits / 2)) ^ _ResultType(__s);
+	  return _ResultType(__x >> __rot)
+	       | _ResultType(__x << ((-__rot) & (__rbits - 1)));
+	}
+    };
+
+    //  DXSM: double xorshift multiply, of the high half by the low half;
+    //  128-bit state, 64-bit output, as numpy's PCG64DXSM.
+    struct __pcg_dxsm
+    {
+      static constexpr bool _S_previous = true;
+      static constexpr bool _S_cheap = true;
+
+      template<typename _ResultType, typename _UIntType>
+	static _ResultType
+	_S_output(_UIntType __s)
+	{
+	  constexpr int __rbits = std::numeric_limits<_ResultType>::digits;
+	  _ResultType __hi = _ResultType(__s >> __rbits);
+	  const _ResultType __lo = _ResultType(__s) | 1;
+	  __hi ^= __hi >> (__rbits / 2);
+	  __hi *= _ResultType(0xda942042e4dd58b5ULL);
+	  __hi ^= __hi >> (3 * __rbits / 4);
+	  __hi *= __lo;
+	  return __hi;
+	}
+    };
+
+    template<typename _UIntType, bool _Cheap>
+      struct __pcg_constants;
+
+    template<>
+      struct __pcg_constants<std::uint64_t, false>
+      {
+	static constexpr std::uint64_t _S_multiplier = 6364136223846793005ULL;
+	static constexpr std::uint64_t _S_increment = 1442695040888963407ULL;
+      };
+
+#ifdef __SIZEOF_INT128__
+    template<>
+      struct __pcg_constants<unsigned __int128, false>
+      {
+	static constexpr unsigned __int128 _S_multiplier
+	  = ((unsigned __int128)2549297995355413924ULL << 64) + 4865540595714422341ULL;
+	static constexpr unsigned __int128 _S_increment
+	  = ((unsigned __int128)6364136223846793005ULL << 64) + 1442695040888963407ULL;
+      };
+
+    template<>
+      struct __pcg_constants<unsigned __int128, true>
+      {
+	static constexpr unsigned __int128 _S_multiplier = 0xda942042e4dd58b5ULL;
+	static constexpr unsigned __int128 _S_increment
+	  = ((unsigned __int128)6364136223846793005ULL << 64) + 1442695040888963407ULL;
+      };
+#endif
+  } // namespace __detail
+
+  /**
+   * @brief A permuted congruential generator, of M.E. O'Neill.
+   *
+   * The state is an LCG modulo 2^w, w the width of @p _UIntType,
+   * @f[
+   *     s_{i+1} = a s_i + c
+   * @f]
+   * and the output a permutation @p _Output of the state, of the width of
+   * @p _ResultType.  The odd increment @f$ c = 2k + 1 @f$ selects one of
+   * 2^(w-1) streams by @f$ k @f$.  discard(n) jumps by the method of
+   * F.B. Brown in O(log n), backstep(n) by the same jump of -n steps.
+   *
+   * @see http://www.pcg-random.org/
+   * @see "PCG: A Family of Simple Fast Space-Efficient Statistically Good
+   *      Algorithms for Random Number Generation", M.E. O'Neill,
+   *      HMC-CS-2014-0905
+   */
+  template<typename _UIntType, typename _ResultType, typename _Output>
+    class pcg_engine
+    {
+      static_assert(std::is_unsigned<_ResultType>::value,
+		    "result type must be an unsigned integral type");
+      static_assert(std::numeric_limits<_UIntType>::digits
+		    >= 2 * std::numeric_limits<_ResultType>::digits,
+		    "the state must be at least twice as wide as the result");
+
+      using __constants = __detail::__pcg_constants<_UIntType, _Output::_S_cheap>;
+
+    public:
+      /** The type of the generated random value. */
+      using result_type = _ResultType;
+      /** The type of the state and of the stream selector. */
+      using state_type = _UIntType;
+
+      static constexpr state_type multiplier = __constants::_S_multiplier;
+      static constexpr state_type default_stream = __constants::_S_increment >> 1;
+      static constexpr state_type default_seed = 0xcafef00dd15ea5e5ULL;
+
+      pcg_engine()
+      : pcg_engine(default_seed)
+      { }
+
+      explicit
+      pcg_engine(state_type __s, state_type __stream = default_stream)
+      { seed(__s, __stream); }
+
+      template<typename _Sseq, typename = typename
+	std::enable_if<!std::is_same<_Sseq, pcg_engine>::value
+		       && !std::is_convertible<_Sseq, state_type>::value>::type>
+	explicit
+	pcg_engine(_Sseq& __q)
+	{ seed(__q); }
+
+      /**
+       * @brief Seeds the state with @p __s, on the stream @p __stream,
+       *        as pcg32_srandom_r of the reference implementation.
+       */
+      void
+      seed(state_type __s = default_seed, state_type __stream = default_stream)
+      {
+	this->_M_inc = (__stream << 1) | 1;
+	this->_M_state = 0;
+	this->_M_step();
+	this->_M_state += __s;
+	this->_M_step();
+      }
+
+      /**
+       * @brief Seeds the state and the stream from a seed sequence.
+       */
+      template<typename _Sseq>
+	typename std::enable_if<!std::is_convertible<_Sseq, state_type>::value>::type
+	seed(_Sseq& __q);
+
+      /**
+       * @brief Changes the stream, keeping the state.
+       */
+      void
+      set_stream(state_type __stream)
+      { this->_M_inc = (__stream << 1) | 1; }
+
+      state_type
+      stream() const
+      { return this->_M_inc >> 1; }
+
+      static constexpr result_type
+      min()
+      { return std::numeric_limits<result_type>::min(); }
+
+      static constexpr result_type
+      max()
+      { return std::numeric_limits<result_type>::max(); }
+
+      result_type
+      operator()()
+      {
+	if (_Output::_S_previous)
+	  {
+	    const state_type __old = this->_M_state;
+	    this->_M_step();
+	    return _Output::template _S_output<result_type>(__old);
+	  }
+	this->_M_step();
+	return _Output::template _S_output<result_type>(this->_M_state);
+      }
+
+      /**
+       * @brief Advances the state by @p __n steps, in O(log n).
+       */
+      void
+      discard(unsigned long long __n);
+
+      /**
+       * @brief Moves the state back by @p __n steps, in O(log n).
+       */
+      void
+      backstep(unsigned long long __n)
+      { this->_M_advance(state_type(0) - state_type(__n)); }
+
+      /**
+       * @brief Writes the same @p __n numbers to @p __out as @p __n calls
+       *        of operator() would.
+       */
+      void
+      fill(result_type* __out, std::size_t __n);
+
+      /**
+       * @brief Compares the state and the stream of two engines.
+       */
+      friend bool
+      operator==(const pcg_engine& __lhs, const pcg_engine& __rhs)
+      { return __lhs._M_state == __rhs._M_state && __lhs._M_inc == __rhs._M_inc; }
+
+      template<typename _UIntType1, typename _ResultType1, typename _Output1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_ostream<_CharT, _Traits>&
+	operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+		   const pcg_engine<_UIntType1, _ResultType1, _Output1>& __x);
+
+      template<typename _UIntType1, typename _ResultType1, typename _Output1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_istream<_CharT, _Traits>&
+	operator>>(std::basic_istream<_CharT, _Traits>& __is,
+		   pcg_engine<_UIntType1, _ResultType1, _Output1>& __x);
+
+    private:
+      void
+      _M_step()
+      { this->_M_state = this->_M_state * multiplier + this->_M_inc; }
+
+      void
+      _M_advance(state_type __delta);
+
+      state_type _M_state;
+      state_type _M_inc;
+    };
+
+  /**
+   * @brief Return true if two PCG engines differ in state or stream.
+   */
+  template<typename _UIntType, typename _ResultType, typename _Output>
+    inline bool
+    operator!=(const pcg_engine<_UIntType, _ResultType, _Output>& __lhs,
+	       const pcg_engine<_UIntType, _ResultType, _Output>& __rhs)
+    { return !(__lhs == __rhs); }
+
+  /** 64-bit state, 32-bit output, XSH RR: pcg32 of the reference implementation. */
+  using pcg32 = pcg_engine<std::uint64_t, std::uint32_t, __detail::__pcg_xsh_rr>;
+
+#ifdef __SIZEOF_INT128__
+  /** 128-bit state, 64-bit output, XSL RR: pcg64 of the reference implementation. */
+  using pcg64 = pcg_engine<unsigned __int128, std::uint64_t, __detail::__pcg_xsl_rr>;
+
+  /** 128-bit state with the cheap multiplier, 64-bit output, DXSM: numpy's PCG64DXSM. */
+  using pcg64_dxsm = pcg_engine<unsigned __int128, std::uint64_t, __detail::__pcg_dxsm>;
+#endif
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#include <ext/pcg_engine.tcc>
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // PCG_ENGINE_H
@@ -0,0 +1,179 @@
+#ifndef PCG_ENGINE_TCC
+#define PCG_ENGINE_TCC 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <iostream>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    //  The state is written as 64-bit words, high to low, so that
+    //  128-bit states need no support from the streams.
+    template<typename _UIntType, typename _CharT, typename _Traits>
+      void
+      __pcg_put(std::basic_ostream<_CharT, _Traits>& __os, _UIntType __x)
+      {
+	constexpr int __words = (std::numeric_limits<_UIntType>::digits + 63) / 64;
+	const _CharT __space = __os.widen(' ');
+	for (int __i = __words - 1; __i >= 0; --__i)
+	  {
+	    __os << std::uint64_t(__x >> (64 * __i));
+	    if (__i > 0)
+	      __os << __space;
+	  }
+      }
+
+    template<typename _UIntType, typename _CharT, typename _Traits>
+      void
+      __pcg_get(std::basic_istream<_CharT, _Traits>& __is, _UIntType& __x)
+      {
+	constexpr int __words = (std::numeric_limits<_UIntType>::digits + 63) / 64;
+	__x = 0;
+	for (int __i = 0; __i < __words; ++__i)
+	  {
+	    std::uint64_t __w;
+	    __is >> __w;
+	    __x = (__words > 1) ? _UIntType((__x << 32) << 32) | __w : _UIntType(__w);
+	  }
+      }
+  } // namespace __detail
+
+  template<typename _UIntType, typename _ResultType, typename _Output>
+    template<typename _Sseq>
+      typename std::enable_if<!std::is_convertible<_Sseq, _UIntType>::value>::type
+      pcg_engine<_UIntType, _ResultType, _Output>::
+      seed(_Sseq& __q)
+      {
+	constexpr int __k = (std::numeric_limits<state_type>::digits + 31) / 32;
+	std::uint_least32_t __arr[2 * __k];
+	__q.generate(__arr + 0, __arr + 2 * __k);
+	state_type __s = 0, __stream = 0;
+	for (int __i = 0; __i < __k; ++__i)
+	  {
+	    __s = (__s << 16 << 16) | state_type(__arr[__i] & 0xffffffffu);
+	    __stream = (__stream << 16 << 16) | state_type(__arr[__k + __i] & 0xffffffffu);
+	  }
+	this->seed(__s, __stream);
+      }
+
+  template<typename _UIntType, typename _ResultType, typename _Output>
+    void
+    pcg_engine<_UIntType, _ResultType, _Output>::
+    _M_advance(state_type __delta)
+    {
+      //  a^n and c (a^n - 1)/(a - 1) by squaring, which needs no division.
+      state_type __cur_mult = multiplier;
+      state_type __cur_plus = this->_M_inc;
+      state_type __acc_mult = 1;
+      state_type __acc_plus = 0;
+      while (__delta > 0)
+	{
+	  if (__delta & 1)
+	    {
+	      __acc_mult *= __cur_mult;
+	      __acc_plus = __acc_plus * __cur_mult + __cur_plus;
+	    }
+	  __cur_plus = (__cur_mult + 1) * __cur_plus;
+	  __cur_mult *= __cur_mult;
+	  __delta >>= 1;
+	}
+      this->_M_state = __acc_mult * this->_M_state + __acc_plus;
+    }
+
+  template<typename _UIntType, typename _ResultType, typename _Output>
+    void
+    pcg_engine<_UIntType, _ResultType, _Output>::
+    discard(unsigned long long __n)
+    { this->_M_advance(state_type(__n)); }
+
+  template<typename _UIntType, typename _ResultType, typename _Output>
+    void
+    pcg_engine<_UIntType, _ResultType, _Output>::
+    fill(result_type* __out, std::size_t __n)
+    {
+      //  The step is a few cycles of latency against more for the output
+      //  permutation, so interleaving states four steps apart gains nothing:
+      //  this is the loop, with the state kept in a register.
+      state_type __s = this->_M_state;
+      const state_type __c = this->_M_inc;
+      for (; __n > 0; --__n)
+	{
+	  const state_type __old = __s;
+	  __s = __s * multiplier + __c;
+	  *__out++ = _Output::template _S_output<result_type>(_Output::_S_previous ? __old : __s);
+	}
+      this->_M_state = __s;
+    }
+
+  template<typename _UIntType, typename _ResultType, typename _Output,
+	   typename _CharT, typename _Traits>
+    std::basic_ostream<_CharT, _Traits>&
+    operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+	       const pcg_engine<_UIntType, _ResultType, _Output>& __x)
+    {
+      typedef std::basic_ostream<_CharT, _Traits>  __ostream_type;
+      typedef typename __ostream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __os.flags();
+      const _CharT __fill = __os.fill();
+      const _CharT __space = __os.widen(' ');
+      __os.flags(__ios_base::dec | __ios_base::fixed | __ios_base::left);
+      __os.fill(__space);
+
+      __detail::__pcg_put(__os, __x._M_state);
+      __os << __space;
+      __detail::__pcg_put(__os, __x._M_inc);
+
+      __os.flags(__flags);
+      __os.fill(__fill);
+      return __os;
+    }
+
+  template<typename _UIntType, typename _ResultType, typename _Output,
+	   typename _CharT, typename _Traits>
+    std::basic_istream<_CharT, _Traits>&
+    operator>>(std::basic_istream<_CharT, _Traits>& __is,
+	       pcg_engine<_UIntType, _ResultType, _Output>& __x)
+    {
+      typedef std::basic_istream<_CharT, _Traits>  __istream_type;
+      typedef typename __istream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __is.flags();
+      __is.flags(__ios_base::dec | __ios_base::skipws);
+
+      _UIntType __state, __inc;
+      __detail::__pcg_get(__is, __state);
+      __detail::__pcg_get(__is, __inc);
+      if (!__is.fail())
+	{
+	  if (__inc & 1)
+	    {
+	      __x._M_state = __state;
+	      __x._M_inc = __inc;
+	    }
+	  else
+	    __is.setstate(__ios_base::failbit);
+	}
+
+      __is.flags(__flags);
+      return __is;
+    }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // PCG_ENGINE_TCC
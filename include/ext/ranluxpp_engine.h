@@ -0,0 +1,190 @@
+#ifndef RANLUXPP_ENGINE_H
+#define RANLUXPP_ENGINE_H 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <iosfwd>
+#include <type_traits>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  /**
+   * @brief RANLUX++ of A. Sibidanov: RANLUX done as the LCG it is
+   *        equivalent to.
+   *
+   * The subtract-with-borrow generator of RANLUX, base 2^24 with lags 10
+   * and 24, is the LCG x <- a x mod m with m = 2^576 - 2^240 + 1 and
+   * a = m - (m - 1) / 2^24: one step of the LCG for each number of
+   * RANLUX.  The luxury of RANLUX, throwing away all but 24 of every
+   * @p __p numbers, is then a single multiplication by a^@p __p mod m,
+   * whatever @p __p, in place of @p __p steps.  The 576 bits of the state
+   * after each multiplication give 576 / @p __w numbers of @p __w bits,
+   * low bits first.
+   *
+   * p = 2048 is past the decorrelation of any of the luxury levels of
+   * RANLUX, and costs one multiplication of 576-bit numbers for every
+   * 12 numbers of 48 bits.  discard() is O(log n) multiplications, by
+   * powers of a^@p __p; seeds s are 2^96 multiplications apart.
+   */
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    class ranluxpp_engine
+    {
+      static_assert(std::is_unsigned<_UIntType>::value,
+		    "result_type must be an unsigned integral type");
+      static_assert(__w > 0 && 576 % __w == 0
+		    && __w <= std::numeric_limits<_UIntType>::digits,
+		    "template argument substituting __w out of bounds");
+      static_assert(__w <= 64,
+		    "template argument substituting __w out of bounds");
+      static_assert(__p > 0,
+		    "template argument substituting __p out of bounds");
+
+    public:
+      /** The type of the generated random value. */
+      typedef _UIntType result_type;
+
+      static constexpr std::size_t word_size = __w;
+      static constexpr std::size_t luxury = __p;
+      /** The numbers made by each multiplication. */
+      static constexpr std::size_t block_size = 576 / __w;
+      static constexpr result_type default_seed = 314159265u;
+
+      ranluxpp_engine()
+      : ranluxpp_engine(default_seed)
+      { }
+
+      explicit
+      ranluxpp_engine(result_type __s)
+      { seed(__s); }
+
+      template<typename _Sseq, typename = typename
+	std::enable_if<!std::is_same<_Sseq, ranluxpp_engine>::value
+		       && !std::is_convertible<_Sseq, result_type>::value>::type>
+	explicit
+	ranluxpp_engine(_Sseq& __seq)
+	{ seed(__seq); }
+
+      /**
+       * @brief Starts the stream of seed @p __s: the state a^(@p __p 2^96 @p __s).
+       */
+      void
+      seed(result_type __s = default_seed);
+
+      /**
+       * @brief Seeds the 576 bits of the state with a seed sequence.
+       */
+      template<typename _Sseq>
+	typename std::enable_if<!std::is_convertible<_Sseq, _UIntType>::value>::type
+	seed(_Sseq& __seq);
+
+      static constexpr result_type
+      min()
+      { return 0; }
+
+      static constexpr result_type
+      max()
+      { return _S_mask; }
+
+      result_type
+      operator()()
+      {
+	if (this->_M_n == block_size)
+	  this->_M_advance();
+	return this->_M_extract(this->_M_n++);
+      }
+
+      /**
+       * @brief Skips @p __z numbers in O(log @p __z) multiplications.
+       */
+      void
+      discard(unsigned long long __z);
+
+      /**
+       * @brief Writes the same @p __n numbers to @p __out as @p __n calls
+       *        of operator() would.
+       */
+      void
+      fill(result_type* __out, std::size_t __n);
+
+      friend bool
+      operator==(const ranluxpp_engine& __lhs, const ranluxpp_engine& __rhs)
+      {
+	for (std::size_t __i = 0; __i < 9; ++__i)
+	  if (__lhs._M_x[__i] != __rhs._M_x[__i])
+	    return false;
+	return __lhs._M_n == __rhs._M_n;
+      }
+
+      template<typename _UIntType1, std::size_t __w1, std::size_t __p1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_ostream<_CharT, _Traits>&
+	operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+		   const ranluxpp_engine<_UIntType1, __w1, __p1>& __x);
+
+      template<typename _UIntType1, std::size_t __w1, std::size_t __p1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_istream<_CharT, _Traits>&
+	operator>>(std::basic_istream<_CharT, _Traits>& __is,
+		   ranluxpp_engine<_UIntType1, __w1, __p1>& __x);
+
+    private:
+      static constexpr result_type _S_mask
+	= __w == std::numeric_limits<_UIntType>::digits
+	? ~_UIntType(0) : _UIntType((_UIntType(1) << __w) - 1);
+
+      //  a^__p mod m, computed once.
+      static const std::uint64_t*
+      _S_multiplier();
+
+      void
+      _M_advance();
+
+      //  Number @p __k of the current block.
+      result_type
+      _M_extract(std::size_t __k) const
+      {
+	const std::size_t __bit = __k * __w;
+	const std::size_t __i = __bit / 64, __s = __bit % 64;
+	std::uint64_t __v = this->_M_x[__i] >> __s;
+	if (__s + __w > 64)
+	  __v |= this->_M_x[__i + 1] << (64 - __s);
+	return result_type(__v) & _S_mask;
+      }
+
+      //  The LCG state, 0 < x < m, low word first.
+      std::uint64_t _M_x[9];
+      //  The numbers of the block of _M_x given out.
+      std::size_t _M_n;
+    };
+
+  /** RANLUX++ with 48 and 24 bits a number, at p = 2048. */
+  using ranluxpp48 = ranluxpp_engine<std::uint64_t, 48, 2048>;
+  using ranluxpp24 = ranluxpp_engine<std::uint32_t, 24, 2048>;
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    inline bool
+    operator!=(const ranluxpp_engine<_UIntType, __w, __p>& __lhs,
+	       const ranluxpp_engine<_UIntType, __w, __p>& __rhs)
+    { return !(__lhs == __rhs); }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#include <ext/ranluxpp_engine.tcc>
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // RANLUXPP_ENGINE_H
@@ -0,0 +1,306 @@
+#ifndef RANLUXPP_ENGINE_TCC
+#define RANLUXPP_ENGINE_TCC 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <iostream>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    //  Numbers of 576 bits are nine words, low word first;
+    //  m = 2^576 - 2^240 + 1.
+
+    //  From r < 2^576 to r mod m.
+    inline void
+    __ranluxpp_canonical(std::uint64_t* __r)
+    {
+      //  r >= m when r + 2^240 - 1 carries out of 576 bits,
+      //  and then what is left is r - m.
+      std::uint64_t __t[9];
+      __int128 __acc = 0;
+      for (std::size_t __k = 0; __k < 9; ++__k)
+	{
+	  __acc += __r[__k];
+	  if (__k == 0)
+	    __acc -= 1;
+	  if (__k == 3)
+	    __acc += __int128(1) << 48;
+	  __t[__k] = std::uint64_t(__acc);
+	  __acc >>= 64;
+	}
+      if (__acc > 0)
+	for (std::size_t __k = 0; __k < 9; ++__k)
+	  __r[__k] = __t[__k];
+    }
+
+    //  x <- a x mod m.  a and x may be the same.
+    inline void
+    __ranluxpp_mulmod(const std::uint64_t* __a, std::uint64_t* __x)
+    {
+      std::uint64_t __p[18] = { };
+      for (std::size_t __i = 0; __i < 9; ++__i)
+	{
+	  unsigned __int128 __c = 0;
+	  for (std::size_t __j = 0; __j < 9; ++__j)
+	    {
+	      __c += (unsigned __int128)__a[__i] * __x[__j] + __p[__i + __j];
+	      __p[__i + __j] = std::uint64_t(__c);
+	      __c >>= 64;
+	    }
+	  __p[__i + 9] = std::uint64_t(__c);
+	}
+
+      //  The product is L + 2^576 H, and 2^576 = 2^240 - 1 mod m.  With
+      //  H = t0 + 2^336 t1, t1 of 240 bits, 2^240 H = 2^240 t0
+      //  + (2^240 - 1) t1 mod m, so that
+      //  L + 2^576 H = L - H + 2^240 (t0 + t1) - t1 mod m,
+      //  where no term is over 2^577.
+      const std::uint64_t* __l = __p;
+      const std::uint64_t* __h = __p + 9;
+      std::uint64_t __t1[4];
+      for (std::size_t __i = 0; __i < 4; ++__i)
+	__t1[__i] = (__h[5 + __i] >> 16)
+		  | (__i < 3 ? __h[6 + __i] << 48 : 0);
+      std::uint64_t __s[6];
+      unsigned __int128 __c = 0;
+      for (std::size_t __i = 0; __i < 6; ++__i)
+	{
+	  __c += (__i < 5 ? __h[__i] : __h[5] & 0xffff);
+	  if (__i < 4)
+	    __c += __t1[__i];
+	  __s[__i] = std::uint64_t(__c);
+	  __c >>= 64;
+	}
+      std::uint64_t __sh[10] = { };
+      for (std::size_t __i = 0; __i < 6; ++__i)
+	{
+	  __sh[__i + 3] |= __s[__i] << 48;
+	  __sh[__i + 4] |= __s[__i] >> 16;
+	}
+
+      __int128 __acc = 0;
+      for (std::size_t __k = 0; __k < 9; ++__k)
+	{
+	  __acc += __int128(__l[__k]) + __sh[__k] - __h[__k];
+	  if (__k < 4)
+	    __acc -= __t1[__k];
+	  __x[__k] = std::uint64_t(__acc);
+	  __acc >>= 64;
+	}
+      //  Left: x + 2^576 c, with c of a few units either way.
+      std::int64_t __carry = std::int64_t(__acc + __sh[9]);
+      while (__carry != 0)
+	{
+	  __acc = -__int128(__carry);
+	  for (std::size_t __k = 0; __k < 9; ++__k)
+	    {
+	      __acc += __x[__k];
+	      if (__k == 3)
+		__acc += __int128(__carry) * (std::int64_t(1) << 48);
+	      __x[__k] = std::uint64_t(__acc);
+	      __acc >>= 64;
+	    }
+	  __carry = std::int64_t(__acc);
+	}
+      __ranluxpp_canonical(__x);
+    }
+
+    //  __x <- __a^__e mod m.  __a and __x may be the same.
+    inline void
+    __ranluxpp_powmod(const std::uint64_t* __a, std::uint64_t* __x,
+		      std::uint64_t __e)
+    {
+      std::uint64_t __b[9];
+      for (std::size_t __k = 0; __k < 9; ++__k)
+	{
+	  __b[__k] = __a[__k];
+	  __x[__k] = __k == 0;
+	}
+      for (; __e > 0; __e >>= 1)
+	{
+	  if (__e & 1)
+	    __ranluxpp_mulmod(__b, __x);
+	  if (__e > 1)
+	    __ranluxpp_mulmod(__b, __b);
+	}
+    }
+  } // namespace __detail
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    const std::uint64_t*
+    ranluxpp_engine<_UIntType, __w, __p>::
+    _S_multiplier()
+    {
+      struct _Multiplier
+      {
+	std::uint64_t _M_a[9];
+
+	_Multiplier()
+	{
+	  //  a = m - (m - 1) / 2^24 = 2^576 - 2^552 - 2^240 + 2^216 + 1.
+	  const std::uint64_t __a[9]
+	    = { 1, 0, 0, 0xffff000001000000ULL, ~0ULL, ~0ULL, ~0ULL, ~0ULL,
+		0xfffffeffffffffffULL };
+	  __detail::__ranluxpp_powmod(__a, this->_M_a, __p);
+	}
+      };
+      static const _Multiplier __mult;
+      return __mult._M_a;
+    }
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    void
+    ranluxpp_engine<_UIntType, __w, __p>::
+    seed(result_type __s)
+    {
+      //  2^96 multiplications apart: (a^p)^(2^48 2^48 s).
+      __detail::__ranluxpp_powmod(_S_multiplier(), this->_M_x,
+				  std::uint64_t(1) << 48);
+      __detail::__ranluxpp_powmod(this->_M_x, this->_M_x,
+				  std::uint64_t(1) << 48);
+      __detail::__ranluxpp_powmod(this->_M_x, this->_M_x, __s);
+      this->_M_n = block_size;
+    }
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    template<typename _Sseq>
+      typename std::enable_if<!std::is_convertible<_Sseq, _UIntType>::value>::type
+      ranluxpp_engine<_UIntType, __w, __p>::
+      seed(_Sseq& __seq)
+      {
+	std::uint_least32_t __arr[18];
+	__seq.generate(__arr + 0, __arr + 18);
+	for (std::size_t __k = 0; __k < 9; ++__k)
+	  this->_M_x[__k] = std::uint64_t(__arr[2 * __k] & 0xffffffffu)
+			  | std::uint64_t(__arr[2 * __k + 1] & 0xffffffffu) << 32;
+	__detail::__ranluxpp_canonical(this->_M_x);
+	//  0, from 0 or m, is the only state of period 1.
+	bool __zero = true;
+	for (std::size_t __k = 0; __k < 9; ++__k)
+	  __zero = __zero && this->_M_x[__k] == 0;
+	if (__zero)
+	  this->_M_x[0] = 1;
+	this->_M_n = block_size;
+      }
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    void
+    ranluxpp_engine<_UIntType, __w, __p>::
+    _M_advance()
+    {
+      __detail::__ranluxpp_mulmod(_S_multiplier(), this->_M_x);
+      this->_M_n = 0;
+    }
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    void
+    ranluxpp_engine<_UIntType, __w, __p>::
+    discard(unsigned long long __z)
+    {
+      const std::size_t __left = block_size - this->_M_n;
+      if (__z <= __left)
+	{
+	  this->_M_n += __z;
+	  return;
+	}
+      __z -= __left;
+      //  Whole blocks in one multiplication by a power of a^p.
+      std::uint64_t __b[9];
+      __detail::__ranluxpp_powmod(_S_multiplier(), __b, __z / block_size);
+      __detail::__ranluxpp_mulmod(__b, this->_M_x);
+      this->_M_n = block_size;
+      if (__z % block_size != 0)
+	{
+	  this->_M_advance();
+	  this->_M_n = __z % block_size;
+	}
+    }
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p>
+    void
+    ranluxpp_engine<_UIntType, __w, __p>::
+    fill(result_type* __out, std::size_t __n)
+    {
+      for (; __n > 0 && this->_M_n < block_size; --__n)
+	*__out++ = this->_M_extract(this->_M_n++);
+      const std::uint64_t* __a = _S_multiplier();
+      for (; __n >= block_size; __n -= block_size)
+	{
+	  __detail::__ranluxpp_mulmod(__a, this->_M_x);
+	  for (std::size_t __k = 0; __k < block_size; ++__k)
+	    *__out++ = this->_M_extract(__k);
+	}
+      for (; __n > 0; --__n)
+	*__out++ = this->operator()();
+    }
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p,
+	   typename _CharT, typename _Traits>
+    std::basic_ostream<_CharT, _Traits>&
+    operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+	       const ranluxpp_engine<_UIntType, __w, __p>& __x)
+    {
+      typedef std::basic_ostream<_CharT, _Traits>  __ostream_type;
+      typedef typename __ostream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __os.flags();
+      const _CharT __fill = __os.fill();
+      const _CharT __space = __os.widen(' ');
+      __os.flags(__ios_base::dec | __ios_base::fixed | __ios_base::left);
+      __os.fill(__space);
+
+      for (std::size_t __k = 0; __k < 9; ++__k)
+	__os << __x._M_x[__k] << __space;
+      __os << __x._M_n;
+
+      __os.flags(__flags);
+      __os.fill(__fill);
+      return __os;
+    }
+
+  template<typename _UIntType, std::size_t __w, std::size_t __p,
+	   typename _CharT, typename _Traits>
+    std::basic_istream<_CharT, _Traits>&
+    operator>>(std::basic_istream<_CharT, _Traits>& __is,
+	       ranluxpp_engine<_UIntType, __w, __p>& __x)
+    {
+      typedef std::basic_istream<_CharT, _Traits>  __istream_type;
+      typedef typename __istream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __is.flags();
+      __is.flags(__ios_base::dec | __ios_base::skipws);
+
+      std::uint64_t __s[9];
+      std::size_t __n;
+      for (std::size_t __k = 0; __k < 9; ++__k)
+	__is >> __s[__k];
+      __is >> __n;
+      if (!__is.fail())
+	{
+	  for (std::size_t __k = 0; __k < 9; ++__k)
+	    __x._M_x[__k] = __s[__k];
+	  __x._M_n = __n;
+	}
+
+      __is.flags(__flags);
+      return __is;
+    }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // RANLUXPP_ENGINE_TCC
@@ -4,6 +4,7 @@
 #pragma GCC system_header
 
 #include <ext/random>
+#include <ext/uniform_real_adaptor.h>
 
 namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
 {
@@ -29,12 +29,14 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
 		   _UniformRandomNumberGenerator& __urng,
 		   _RealType __radius)
         {
-	  std::__detail::_Adaptor<_UniformRandomNumberGenerator,
-				  _RealType> __aurng(__urng);
+	  __gnu_cxx::uniform_real_adaptor<_UniformRandomNumberGenerator,
+					  _RealType> __aurng(__urng);
 
 	  _RealType __pow = 1 / _RealType(_Dimen);
 	  _RealType __urt = __radius * std::pow(__aurng(), __pow);
-	  result_type __ret = __uosd(__aurng);
+	  //  The engine itself: the normals of __uosd would take the adaptor
+	  //  for an engine of one bit, and call it for every bit.
+	  result_type __ret = __uosd(__urng);
 
 	  std::transform(__ret.begin(), __ret.end(), __ret.begin(),
 			 [__urt](_RealType __val)
@@ -64,8 +66,8 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
 	  result_type __ret;
 	  _RealType __sq;
 	  _RealType __radsq = __radius * __radius;
-	  std::__detail::_Adaptor<_UniformRandomNumberGenerator,
-				  _RealType> __aurng(__urng);
+	  __gnu_cxx::uniform_real_adaptor<_UniformRandomNumberGenerator,
+					  _RealType> __aurng(__urng);
 
 	  do
 	    {
@@ -5,6 +5,7 @@
 
 #include <ext/random>
 #include <ext/simplex.h>
+#include <ext/uniform_real_adaptor.h>
 
 namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
 {
@@ -27,8 +28,8 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
    * Finally, each point is converted to the barycentric coordinates of its
    * containing tetrahedron and returned.
    *
-   * This distribution uses the uniform real distribution over its default range
-   * of @f$ [0, 1) @f$ and is thus stateless.
+   * This distribution takes its coordinates in @f$ (0, 1] @f$ from the bits
+   * of the generator, by __gnu_cxx::uniform_real_adaptor, and is stateless.
    *
    * This technique is a generalization of the procedure used in the uniform
    * inside triangle distribution.  Adapting this to higher dimensions is
@@ -49,11 +50,9 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
       { };
 
       uniform_inside_tetrahedron_distribution()
-      : _M_urd(std::numeric_limits<RealTp>::min(), RealTp{1})
       { }
 
       uniform_inside_tetrahedron_distribution(param_type)
-      : _M_urd(std::numeric_limits<RealTp>::min(), RealTp{1})
       { }
 
       param_type
@@ -66,19 +65,22 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
 
       void
       reset()
-      { this->_M_urd.reset(); }
+      { }
 
       template<typename Generator>
 	result_type
 	operator()(Generator& __gen)
 	{
+	  __gnu_cxx::uniform_real_adaptor<Generator, RealTp,
+					  __gnu_cxx::unit_interval::open_closed>
+	    __urd(__gen);
 	  while (true)
 	  {
 	    //  Pick three random barycentric coordinates.
 	    std::array<RealTp, 3> __point;
-	    __point[0] = this->_M_urd(__gen);
-	    __point[1] = this->_M_urd(__gen);
-	    __point[2] = this->_M_urd(__gen);
+	    __point[0] = __urd();
+	    __point[1] = __urd();
+	    __point[2] = __urd();
 
             if (auto bary = tetra0<RealTp>.barycenter(__point);
 		bary_in_simplex(bary))
@@ -110,10 +112,6 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
       constexpr result_type
       max() const
       { return std::array<RealTp, 3>{1, 1, 1, 1}; }
-
-    private:
-
-      std::uniform_real_distribution<RealTp> _M_urd;
     };
 
   // This thing is really stateless.
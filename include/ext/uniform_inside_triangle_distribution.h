@@ -5,6 +5,7 @@
 
 #include <ext/random>
 #include <ext/simplex.h>
+#include <ext/uniform_real_adaptor.h>
 
 namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
 {
@@ -20,11 +21,9 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
       { };
 
       uniform_inside_triangle_distribution()
-      : _M_urd(std::numeric_limits<_RealType>::min(), _RealType{1})
       { }
 
       uniform_inside_triangle_distribution(param_type)
-      : _M_urd(std::numeric_limits<_RealType>::min(), _RealType{1})
       { }
 
       param_type
@@ -37,16 +36,19 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
 
       void
       reset()
-      { this->_M_urd.reset(); }
+      { }
 
       template<typename Generator>
 	result_type
 	operator()(Generator& __gen)
 	{
-	  //  Pick two random barycentric coordinates.
+	  //  Pick two random barycentric coordinates, in (0, 1].
+	  __gnu_cxx::uniform_real_adaptor<Generator, _RealType,
+					  __gnu_cxx::unit_interval::open_closed>
+	    __urd(__gen);
 	  result_type __bary;
-	  __bary[1] = this->_M_urd(__gen);
-	  __bary[2] = this->_M_urd(__gen);
+	  __bary[1] = __urd();
+	  __bary[2] = __urd();
 	  if (__bary[1] + __bary[2] > _RealType{1})
 	    {
 	      __bary[1] = _RealType{1} - __bary[1];
@@ -68,10 +70,6 @@ namespace __gnu_test //_GLIBCXX_VISIBILITY(default)
       constexpr result_type
       max() const
       { return std::array<_RealType, 3>{1, 1, 1}; }
-
-    private:
-
-      std::uniform_real_distribution<_RealType> _M_urd;
     };
 
   // This thing is really stateless.
@@ -0,0 +1,143 @@
+#ifndef UNIFORM_REAL_ADAPTOR_H
+#define UNIFORM_REAL_ADAPTOR_H 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  /** The interval of the numbers of a uniform_real_adaptor. */
+  enum class unit_interval
+  {
+    closed_open,	///< [0, 1), k 2^-p
+    open_closed		///< (0, 1], (k + 1) 2^-p, for log and for division
+  };
+
+  namespace __detail
+  {
+    //  The bits of an engine whose numbers are all of [0, 2^w), w, by its
+    //  constexpr min() and max(); 0 for any other.
+    template<typename _Engine, typename = void>
+      struct __engine_bits
+      : std::integral_constant<std::size_t, 0>
+      { };
+
+    template<typename _Engine>
+      struct __engine_bits<_Engine,
+	typename std::enable_if<std::is_integral<typename _Engine::result_type>::value
+		 && std::is_unsigned<typename _Engine::result_type>::value
+		 && (_Engine::max() >= _Engine::min())>::type>
+      : std::integral_constant<std::size_t,
+	  _Engine::min() != 0 || _Engine::max() == 0
+	  || (_Engine::max() & (_Engine::max() + 1)) != 0 ? 0
+	  : std::numeric_limits<std::uint64_t>::digits
+	    - __builtin_clzll(std::uint64_t(_Engine::max()))>
+      { };
+  } // namespace __detail
+
+  /**
+   * @brief Uniform reals from an engine, as std::__detail::_Adaptor but
+   *        by bits in place of std::generate_canonical.
+   *
+   * The precision p is that of @p _RealType, 53 bits for double and 24 for
+   * float: k of p bits from the top bits of ceil(p / w) numbers of an
+   * engine of w bits, as k 2^-p or (k + 1) 2^-p by @p _Interval, which
+   * are exact.  One call of a 64-bit engine for a double, one of a 32-bit
+   * one for a float, and no division.
+   *
+   * Where the numbers of the engine are not all of [0, 2^w), or p is over
+   * 64, it is std::generate_canonical, or one less that, as before.
+   */
+  template<typename _Engine, typename _RealType = double,
+	   unit_interval _Interval = unit_interval::closed_open>
+    class uniform_real_adaptor
+    {
+      static_assert(std::is_floating_point<_RealType>::value,
+		    "template argument must be a floating point type");
+
+      static constexpr std::size_t _S_w
+	= __detail::__engine_bits<_Engine>::value;
+
+    public:
+      typedef _RealType result_type;
+
+      /** The bits of each number. */
+      static constexpr std::size_t precision
+	= std::numeric_limits<_RealType>::digits;
+
+      /** Whether the numbers are made by bits. */
+      static constexpr bool by_bits = _S_w != 0 && precision <= 64;
+
+      uniform_real_adaptor(_Engine& __g)
+      : _M_g(__g)
+      { }
+
+      result_type
+      min() const
+      { return _RealType(0); }
+
+      result_type
+      max() const
+      { return _RealType(1); }
+
+      result_type
+      operator()()
+      { return this->_M_generate(std::integral_constant<bool, by_bits>()); }
+
+    private:
+      result_type
+      _M_generate(std::true_type)
+      {
+	constexpr std::size_t __w = by_bits ? _S_w : 1;
+	constexpr _RealType __scale
+	  = _RealType(0.5) / _RealType(std::uint64_t(1) << (precision - 1));
+	std::uint64_t __k = 0;
+	for (std::size_t __left = precision; __left > 0; )
+	  {
+	    const std::size_t __take = __left < __w ? __left : __w;
+	    const std::uint64_t __x = std::uint64_t(this->_M_g());
+	    __k = (__take == 64 ? 0 : __k << __take) | (__x >> (__w - __take));
+	    __left -= __take;
+	  }
+	if (_Interval == unit_interval::open_closed)
+	  return (_RealType(__k) + _RealType(1)) * __scale;
+	else
+	  return _RealType(__k) * __scale;
+      }
+
+      result_type
+      _M_generate(std::false_type)
+      {
+	const _RealType __u
+	  = std::generate_canonical<_RealType,
+				    std::numeric_limits<_RealType>::digits>(this->_M_g);
+	if (_Interval == unit_interval::open_closed)
+	  return _RealType(1) - __u;
+	else
+	  return __u;
+      }
+
+      _Engine& _M_g;
+    };
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // UNIFORM_REAL_ADAPTOR_H
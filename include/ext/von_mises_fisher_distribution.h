@@ -7,6 +7,7 @@
 #include <type_traits>
 #include <ext/random>
 #include <ext/cmath>
+#include <ext/uniform_real_adaptor.h>
 
 #if __cplusplus < 201103L
 # include <bits/c++0x_warning.h>
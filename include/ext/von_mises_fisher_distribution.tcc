@@ -67,7 +67,10 @@ _GLIBCXX_BEGIN_NAMESPACE_VERSION
       operator()(_UniformRandomNumberGenerator& __urng,
 		 const typename von_mises_fisher_distribution<_Dim, _RealTp>::param_type& __p)
       {
-	std::__detail::_Adaptor<_UniformRandomNumberGenerator, typename result_type::value_type>
+	//  In (0, 1], for the log.
+	__gnu_cxx::uniform_real_adaptor<_UniformRandomNumberGenerator,
+					typename result_type::value_type,
+					__gnu_cxx::unit_interval::open_closed>
 	  __aurng(__urng);
 
 	//  The beta distribution depends only on _Dim.
@@ -152,8 +155,8 @@ _GLIBCXX_BEGIN_NAMESPACE_VERSION
       operator()(_UniformRandomNumberGenerator& __urng,
 		 const typename von_mises_fisher_distribution<3, _RealTp>::param_type& __p)
       {
-	std::__detail::_Adaptor<_UniformRandomNumberGenerator,
-				typename result_type::value_type>
+	__gnu_cxx::uniform_real_adaptor<_UniformRandomNumberGenerator,
+					typename result_type::value_type>
 	  __aurng(__urng);
 
 	auto __xi = __aurng();
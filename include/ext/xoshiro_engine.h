@@ -0,0 +1,365 @@
+#ifndef XOSHIRO_ENGINE_H
+#define XOSHIRO_ENGINE_H 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+#include <iosfwd>
+#include <type_traits>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  namespace __detail
+  {
+    template<int __k, typename _UIntType>
+      constexpr _UIntType
+      __xoshiro_rotl(_UIntType __x)
+      {
+	constexpr int __w = std::numeric_limits<_UIntType>::digits;
+	return _UIntType((__x << __k) | (__x >> (__w - __k)));
+      }
+
+    /*
+     * The shifts and rotations of the linear engines of Blackman and
+     * Vigna, the words the scramblers add, and the jump polynomials.
+     * The ++ scrambler is rotl(s[0] + s[_S_pp_j], _S_pp_rot) + s[_S_pp_k],
+     * the + scrambler s[0] + s[_S_pp_j].
+     */
+    template<typename _UIntType, std::size_t __n>
+      struct __xoshiro_constants;
+
+    template<>
+      struct __xoshiro_constants<std::uint32_t, 4>
+      {
+	static constexpr int _S_shift = 9;
+	static constexpr int _S_rot = 11;
+	static constexpr int _S_pp_rot = 7;
+	static constexpr std::size_t _S_pp_j = 3;
+	static constexpr std::size_t _S_pp_k = 0;
+
+	//  2^64 steps.
+	static const std::uint32_t*
+	_S_jump()
+	{
+	  static const std::uint32_t __p[4]
+	    = { 0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b };
+	  return __p;
+	}
+
+	//  2^96 steps.
+	static const std::uint32_t*
+	_S_long_jump()
+	{
+	  static const std::uint32_t __p[4]
+	    = { 0xb523952e, 0x0b6f099f, 0xccf5a0ef, 0x1c580662 };
+	  return __p;
+	}
+      };
+
+    template<>
+      struct __xoshiro_constants<std::uint64_t, 4>
+      {
+	static constexpr int _S_shift = 17;
+	static constexpr int _S_rot = 45;
+	static constexpr int _S_pp_rot = 23;
+	static constexpr std::size_t _S_pp_j = 3;
+	static constexpr std::size_t _S_pp_k = 0;
+
+	//  2^128 steps.
+	static const std::uint64_t*
+	_S_jump()
+	{
+	  static const std::uint64_t __p[4]
+	    = { 0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+		0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL };
+	  return __p;
+	}
+
+	//  2^192 steps.
+	static const std::uint64_t*
+	_S_long_jump()
+	{
+	  static const std::uint64_t __p[4]
+	    = { 0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL,
+		0x77710069854ee241ULL, 0x39109bb02acbe635ULL };
+	  return __p;
+	}
+      };
+
+    template<>
+      struct __xoshiro_constants<std::uint64_t, 8>
+      {
+	static constexpr int _S_shift = 11;
+	static constexpr int _S_rot = 21;
+	static constexpr int _S_pp_rot = 17;
+	static constexpr std::size_t _S_pp_j = 2;
+	static constexpr std::size_t _S_pp_k = 2;
+
+	//  2^256 steps.
+	static const std::uint64_t*
+	_S_jump()
+	{
+	  static const std::uint64_t __p[8]
+	    = { 0x33ed89b6e7a353f9ULL, 0x760083d7955323beULL,
+		0x2837f2fbb5f22faeULL, 0x4b8c5674d309511cULL,
+		0xb11ac47a7ba28c25ULL, 0xf1be7667092bcc1cULL,
+		0x53851efdb6df0aafULL, 0x1ebbc8b23eaf25dbULL };
+	  return __p;
+	}
+
+	//  2^384 steps.
+	static const std::uint64_t*
+	_S_long_jump()
+	{
+	  static const std::uint64_t __p[8]
+	    = { 0x11467fef8f921d28ULL, 0xa2a819f2e79c8ea8ULL,
+		0xa8299fc284b3959aULL, 0xb4d347340ca63ee1ULL,
+		0x1cb0940bedbff6ceULL, 0xd956c5c4fa1f8e17ULL,
+		0x915e38fd4eda93bcULL, 0x5b3ccdfa5d7daca5ULL };
+	  return __p;
+	}
+      };
+
+    //  **: rotl(s[1] * 5, 7) * 9; the same for all the sizes.
+    struct __xoshiro_starstar
+    {
+      template<typename _Consts, typename _UIntType>
+	static _UIntType
+	_S_output(const _UIntType* __s)
+	{ return _UIntType(__xoshiro_rotl<7>(_UIntType(__s[1] * 5)) * 9); }
+    };
+
+    //  ++: the sum of two words, rotated, plus one of them.
+    struct __xoshiro_plusplus
+    {
+      template<typename _Consts, typename _UIntType>
+	static _UIntType
+	_S_output(const _UIntType* __s)
+	{
+	  return _UIntType(__xoshiro_rotl<_Consts::_S_pp_rot>(_UIntType(__s[0] + __s[_Consts::_S_pp_j]))
+			   + __s[_Consts::_S_pp_k]);
+	}
+    };
+
+    //  +: the sum of two words; the low bits are weak, for floating point.
+    struct __xoshiro_plus
+    {
+      template<typename _Consts, typename _UIntType>
+	static _UIntType
+	_S_output(const _UIntType* __s)
+	{ return _UIntType(__s[0] + __s[_Consts::_S_pp_j]); }
+    };
+  } // namespace __detail
+
+  /**
+   * @brief The xoshiro generators of D. Blackman and S. Vigna,
+   *        "Scrambled linear pseudorandom number generators" (2018).
+   *
+   * A xor/shift/rotate linear engine of @p __n words, 128, 256 or 512
+   * bits, with a nonlinear scrambler of the output.  jump() and
+   * long_jump() advance the state by 2^(w n / 2) and 2^(3 w n / 4)
+   * steps, so that one seed splits into that many nonoverlapping
+   * streams.  seed(s) fills the state with splitmix64 of @p s, as
+   * recommended by the authors.
+   *
+   * @see https://prng.di.unimi.it/
+   */
+  template<typename _UIntType, std::size_t __n, typename _Scrambler>
+    class xoshiro_engine
+    {
+      static_assert((std::is_same<_UIntType, std::uint32_t>::value && __n == 4)
+		    || (std::is_same<_UIntType, std::uint64_t>::value
+			&& (__n == 4 || __n == 8)),
+		    "the state must be 4 32-bit words or 4 or 8 64-bit words");
+
+      typedef __detail::__xoshiro_constants<_UIntType, __n> _Consts;
+
+    public:
+      /** The type of the generated random value. */
+      using result_type = _UIntType;
+
+      static constexpr std::size_t word_size = std::numeric_limits<_UIntType>::digits;
+      static constexpr std::size_t state_size = __n;
+      static constexpr result_type default_seed = 0u;
+
+      xoshiro_engine()
+      : xoshiro_engine(default_seed)
+      { }
+
+      explicit
+      xoshiro_engine(result_type __s)
+      { seed(__s); }
+
+      template<typename _Sseq, typename = typename
+	std::enable_if<!std::is_same<_Sseq, xoshiro_engine>::value
+		       && !std::is_convertible<_Sseq, result_type>::value>::type>
+	explicit
+	xoshiro_engine(_Sseq& __seq)
+	{ seed(__seq); }
+
+      /**
+       * @brief Fills the state with the splitmix64 sequence from @p __s.
+       */
+      void
+      seed(result_type __s = default_seed);
+
+      /**
+       * @brief Seeds the state from a seed sequence; an all-zero state,
+       *        which is a fixed point, is replaced.
+       */
+      template<typename _Sseq>
+	typename std::enable_if<!std::is_convertible<_Sseq, result_type>::value>::type
+	seed(_Sseq& __seq);
+
+      static constexpr result_type
+      min()
+      { return std::numeric_limits<result_type>::min(); }
+
+      static constexpr result_type
+      max()
+      { return std::numeric_limits<result_type>::max(); }
+
+      result_type
+      operator()()
+      {
+	const result_type __r = _Scrambler::template _S_output<_Consts>(this->_M_s);
+	_S_step(this->_M_s);
+	return __r;
+      }
+
+      void
+      discard(unsigned long long __z)
+      {
+	for (; __z != 0ULL; --__z)
+	  _S_step(this->_M_s);
+      }
+
+      /**
+       * @brief Advances the state by 2^(w n / 2) steps, for up to
+       *        2^(w n / 2) nonoverlapping streams.
+       */
+      void
+      jump()
+      { this->_M_jump(_Consts::_S_jump()); }
+
+      /**
+       * @brief Advances the state by 2^(3 w n / 4) steps: each stream
+       *        so made can be split further with jump().
+       */
+      void
+      long_jump()
+      { this->_M_jump(_Consts::_S_long_jump()); }
+
+      /**
+       * @brief Writes the same @p __z numbers to @p __out as @p __z calls
+       *        of operator() would.
+       */
+      void
+      fill(result_type* __out, std::size_t __z);
+
+      friend bool
+      operator==(const xoshiro_engine& __lhs, const xoshiro_engine& __rhs)
+      {
+	for (std::size_t __i = 0; __i < __n; ++__i)
+	  if (__lhs._M_s[__i] != __rhs._M_s[__i])
+	    return false;
+	return true;
+      }
+
+      template<typename _UIntType1, std::size_t __n1, typename _Scrambler1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_ostream<_CharT, _Traits>&
+	operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+		   const xoshiro_engine<_UIntType1, __n1, _Scrambler1>& __x);
+
+      template<typename _UIntType1, std::size_t __n1, typename _Scrambler1,
+	       typename _CharT, typename _Traits>
+	friend std::basic_istream<_CharT, _Traits>&
+	operator>>(std::basic_istream<_CharT, _Traits>& __is,
+		   xoshiro_engine<_UIntType1, __n1, _Scrambler1>& __x);
+
+    private:
+      static void
+      _S_step(_UIntType (&__s)[4])
+      {
+	const _UIntType __t = _UIntType(__s[1] << _Consts::_S_shift);
+	__s[2] ^= __s[0];
+	__s[3] ^= __s[1];
+	__s[1] ^= __s[2];
+	__s[0] ^= __s[3];
+	__s[2] ^= __t;
+	__s[3] = __detail::__xoshiro_rotl<_Consts::_S_rot>(__s[3]);
+      }
+
+      static void
+      _S_step(_UIntType (&__s)[8])
+      {
+	const _UIntType __t = _UIntType(__s[1] << _Consts::_S_shift);
+	__s[2] ^= __s[0];
+	__s[5] ^= __s[1];
+	__s[1] ^= __s[2];
+	__s[7] ^= __s[3];
+	__s[3] ^= __s[4];
+	__s[4] ^= __s[5];
+	__s[0] ^= __s[6];
+	__s[6] ^= __s[7];
+	__s[6] ^= __t;
+	__s[7] = __detail::__xoshiro_rotl<_Consts::_S_rot>(__s[7]);
+      }
+
+      void
+      _M_jump(const _UIntType* __poly);
+
+      _UIntType _M_s[__n];
+    };
+
+  template<typename _UIntType, std::size_t __n, typename _Scrambler>
+    inline bool
+    operator!=(const xoshiro_engine<_UIntType, __n, _Scrambler>& __lhs,
+	       const xoshiro_engine<_UIntType, __n, _Scrambler>& __rhs)
+    { return !(__lhs == __rhs); }
+
+  /** 256 bits of state: ** and ++ for all purposes, + for floating point. */
+  using xoshiro256starstar
+    = xoshiro_engine<std::uint64_t, 4, __detail::__xoshiro_starstar>;
+  using xoshiro256plusplus
+    = xoshiro_engine<std::uint64_t, 4, __detail::__xoshiro_plusplus>;
+  using xoshiro256plus
+    = xoshiro_engine<std::uint64_t, 4, __detail::__xoshiro_plus>;
+
+  /** 512 bits of state, for very many streams. */
+  using xoshiro512starstar
+    = xoshiro_engine<std::uint64_t, 8, __detail::__xoshiro_starstar>;
+  using xoshiro512plusplus
+    = xoshiro_engine<std::uint64_t, 8, __detail::__xoshiro_plusplus>;
+  using xoshiro512plus
+    = xoshiro_engine<std::uint64_t, 8, __detail::__xoshiro_plus>;
+
+  /** 128 bits of state, 32-bit output. */
+  using xoshiro128starstar
+    = xoshiro_engine<std::uint32_t, 4, __detail::__xoshiro_starstar>;
+  using xoshiro128plusplus
+    = xoshiro_engine<std::uint32_t, 4, __detail::__xoshiro_plusplus>;
+  using xoshiro128plus
+    = xoshiro_engine<std::uint32_t, 4, __detail::__xoshiro_plus>;
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#include <ext/xoshiro_engine.tcc>
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // XOSHIRO_ENGINE_H
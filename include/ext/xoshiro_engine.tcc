@@ -0,0 +1,151 @@
+#ifndef XOSHIRO_ENGINE_TCC
+#define XOSHIRO_ENGINE_TCC 1
+
+#pragma GCC system_header
+
+#if __cplusplus < 201103L
+# include <bits/c++0x_warning.h>
+#else
+
+#include <iostream>
+
+#ifdef _GLIBCXX_USE_C99_STDINT_TR1
+
+namespace __gnu_cxx _GLIBCXX_VISIBILITY(default)
+{
+_GLIBCXX_BEGIN_NAMESPACE_VERSION
+
+  template<typename _UIntType, std::size_t __n, typename _Scrambler>
+    void
+    xoshiro_engine<_UIntType, __n, _Scrambler>::
+    seed(result_type __s)
+    {
+      //  splitmix64; a 64-bit number makes two 32-bit words, low first.
+      std::uint64_t __x = __s;
+      for (std::size_t __i = 0; __i < __n; )
+	{
+	  std::uint64_t __z = (__x += 0x9e3779b97f4a7c15ULL);
+	  __z = (__z ^ (__z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	  __z = (__z ^ (__z >> 27)) * 0x94d049bb133111ebULL;
+	  __z ^= __z >> 31;
+	  for (std::size_t __k = 0; __k < 64 / word_size && __i < __n; ++__k, ++__i)
+	    this->_M_s[__i] = _UIntType(__z >> (word_size * __k));
+	}
+    }
+
+  template<typename _UIntType, std::size_t __n, typename _Scrambler>
+    template<typename _Sseq>
+      typename std::enable_if<!std::is_convertible<_Sseq, _UIntType>::value>::type
+      xoshiro_engine<_UIntType, __n, _Scrambler>::
+      seed(_Sseq& __seq)
+      {
+	constexpr std::size_t __p = (word_size + 31) / 32;
+	std::uint_least32_t __arr[__n * __p];
+	__seq.generate(__arr + 0, __arr + __n * __p);
+	bool __zero = true;
+	for (std::size_t __i = 0; __i < __n; ++__i)
+	  {
+	    _UIntType __w = 0;
+	    for (std::size_t __k = 0; __k < __p; ++__k)
+	      __w |= _UIntType(__arr[__i * __p + __k] & 0xffffffffu) << (32 * __k);
+	    this->_M_s[__i] = __w;
+	    __zero = __zero && __w == 0;
+	  }
+	if (__zero)
+	  this->_M_s[0] = 1;
+      }
+
+  template<typename _UIntType, std::size_t __n, typename _Scrambler>
+    void
+    xoshiro_engine<_UIntType, __n, _Scrambler>::
+    _M_jump(const _UIntType* __poly)
+    {
+      _UIntType __t[__n] = { };
+      for (std::size_t __i = 0; __i < __n; ++__i)
+	for (std::size_t __b = 0; __b < word_size; ++__b)
+	  {
+	    if (__poly[__i] & (_UIntType(1) << __b))
+	      for (std::size_t __j = 0; __j < __n; ++__j)
+		__t[__j] ^= this->_M_s[__j];
+	    _S_step(this->_M_s);
+	  }
+      for (std::size_t __j = 0; __j < __n; ++__j)
+	this->_M_s[__j] = __t[__j];
+    }
+
+  template<typename _UIntType, std::size_t __n, typename _Scrambler>
+    void
+    xoshiro_engine<_UIntType, __n, _Scrambler>::
+    fill(result_type* __out, std::size_t __z)
+    {
+      //  The state in a local copy, in registers for the whole loop.
+      _UIntType __s[__n];
+      for (std::size_t __i = 0; __i < __n; ++__i)
+	__s[__i] = this->_M_s[__i];
+      for (; __z > 0; --__z)
+	{
+	  *__out++ = _Scrambler::template _S_output<_Consts>(__s);
+	  _S_step(__s);
+	}
+      for (std::size_t __i = 0; __i < __n; ++__i)
+	this->_M_s[__i] = __s[__i];
+    }
+
+  template<typename _UIntType, std::size_t __n, typename _Scrambler,
+	   typename _CharT, typename _Traits>
+    std::basic_ostream<_CharT, _Traits>&
+    operator<<(std::basic_ostream<_CharT, _Traits>& __os,
+	       const xoshiro_engine<_UIntType, __n, _Scrambler>& __x)
+    {
+      typedef std::basic_ostream<_CharT, _Traits>  __ostream_type;
+      typedef typename __ostream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __os.flags();
+      const _CharT __fill = __os.fill();
+      const _CharT __space = __os.widen(' ');
+      __os.flags(__ios_base::dec | __ios_base::fixed | __ios_base::left);
+      __os.fill(__space);
+
+      for (std::size_t __i = 0; __i < __n; ++__i)
+	{
+	  if (__i > 0)
+	    __os << __space;
+	  __os << __x._M_s[__i];
+	}
+
+      __os.flags(__flags);
+      __os.fill(__fill);
+      return __os;
+    }
+
+  template<typename _UIntType, std::size_t __n, typename _Scrambler,
+	   typename _CharT, typename _Traits>
+    std::basic_istream<_CharT, _Traits>&
+    operator>>(std::basic_istream<_CharT, _Traits>& __is,
+	       xoshiro_engine<_UIntType, __n, _Scrambler>& __x)
+    {
+      typedef std::basic_istream<_CharT, _Traits>  __istream_type;
+      typedef typename __istream_type::ios_base    __ios_base;
+
+      const typename __ios_base::fmtflags __flags = __is.flags();
+      __is.flags(__ios_base::dec | __ios_base::skipws);
+
+      _UIntType __s[__n];
+      for (std::size_t __i = 0; __i < __n; ++__i)
+	__is >> __s[__i];
+      if (!__is.fail())
+	for (std::size_t __i = 0; __i < __n; ++__i)
+	  __x._M_s[__i] = __s[__i];
+
+      __is.flags(__flags);
+      return __is;
+    }
+
+_GLIBCXX_END_NAMESPACE_VERSION
+} // namespace __gnu_cxx
+
+#endif // _GLIBCXX_USE_C99_STDINT_TR1
+
+#endif // C++11
+
+#endif // XOSHIRO_ENGINE_TCC
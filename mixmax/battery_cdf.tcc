@@ -0,0 +1,608 @@
+  // The distributions of ../cdf.tcc, for driver_battery.cpp: made to compile
+  // on their own, with long double as the default real type, and with
+  // what the battery needs added; ../cdf.tcc itself is left as it is.
+
+  // Section: Support
+  // =================
+  /*
+    Constants and special functions for the distributions below,
+    in long double.  The regularized incomplete gamma and beta
+    functions are from their series and continued fractions
+    (modified Lentz), to about 1e-15.
+  */
+
+typedef unsigned long long uhuge;
+
+constexpr long double pi = 3.141592653589793238462643383279502884L;
+constexpr long double sqrt2pi = 2.506628274631000502415765284811045253L;
+
+template<typename _Real>
+  inline _Real
+  sqr(_Real x)
+  { return (x * x); }
+
+inline long double
+root(long double x)
+{ return (std::sqrt(x)); }
+
+#define KUBUX_ENFORCE(cond) \
+  do { if (!(cond)) { std::cerr << __FILE__ << ":" << __LINE__ \
+				<< ": failed " #cond "\n"; std::exit(1); } } while (0)
+#define KUBUX_ASSERT(cond) assert(cond)
+
+template<typename Sequence>
+  bool
+  is_nondescending(Sequence const & seq)
+  { return (std::is_sorted(seq.begin(), seq.end())); }
+
+template<typename Sequence>
+  bool
+  is_ascending(Sequence const & seq)
+  {
+    return (std::adjacent_find(seq.begin(), seq.end(),
+			       std::greater_equal<typename Sequence::value_type>())
+	    == seq.end());
+  }
+
+template<typename Sequence>
+  bool
+  is_in_unit_interval(Sequence const & seq)
+  {
+    for (auto const & x : seq)
+      if (x < 0 || x > 1)
+	return (false);
+    return (true);
+  }
+
+template<typename _Real = long double>
+  _Real
+  regularized_gamma_series(_Real a, _Real x)
+  {
+    // P(a,x), converges quickly for x < a+1
+    _Real term = 1.0L / a;
+    _Real sum = term;
+    for (int n = 1; n < 10000; ++n)
+      {
+	term *= x / (a + n);
+	sum += term;
+	if (std::fabs(term) < std::fabs(sum) * 1e-18L)
+	  break;
+      }
+    return (sum * std::exp(-x + a * std::log(x) - std::lgamma(a)));
+  }
+
+template<typename _Real = long double>
+  _Real
+  regularized_gamma_fraction(_Real a, _Real x)
+  {
+    // Q(a,x) = 1 - P(a,x), converges quickly for x >= a+1
+    _Real const tiny = 1e-300L;
+    _Real b = x + 1.0L - a;
+    _Real c = 1.0L / tiny;
+    _Real d = 1.0L / b;
+    _Real h = d;
+    for (int n = 1; n < 10000; ++n)
+      {
+	_Real an = -n * (n - a);
+	b += 2.0L;
+	d = an * d + b;
+	if (std::fabs(d) < tiny) d = tiny;
+	c = b + an / c;
+	if (std::fabs(c) < tiny) c = tiny;
+	d = 1.0L / d;
+	_Real delta = d * c;
+	h *= delta;
+	if (std::fabs(delta - 1.0L) < 1e-18L)
+	  break;
+      }
+    return (h * std::exp(-x + a * std::log(x) - std::lgamma(a)));
+  }
+
+template<typename _Real>
+  _Real
+  regularized_lower_gamma(_Real a, _Real x)
+  {
+    if (x <= 0.0L)
+      return (0.0L);
+    if (x < a + 1.0L)
+      return (regularized_gamma_series(a, x));
+    return (1.0L - regularized_gamma_fraction(a, x));
+  }
+
+template<typename _Real>
+  _Real
+  regularized_upper_gamma(_Real a, _Real x)
+  {
+    if (x <= 0.0L)
+      return (1.0L);
+    if (x < a + 1.0L)
+      return (1.0L - regularized_gamma_series(a, x));
+    return (regularized_gamma_fraction(a, x));
+  }
+
+template<typename _Real = long double>
+  _Real
+  beta_fraction(_Real x, _Real p, _Real q)
+  {
+    _Real const tiny = 1e-300L;
+    _Real c = 1.0L;
+    _Real d = 1.0L - (p + q) * x / (p + 1.0L);
+    if (std::fabs(d) < tiny) d = tiny;
+    d = 1.0L / d;
+    _Real h = d;
+    for (int m = 1; m < 10000; ++m)
+      {
+	_Real aa = m * (q - m) * x / ((p + 2*m - 1) * (p + 2*m));
+	d = 1.0L + aa * d;
+	if (std::fabs(d) < tiny) d = tiny;
+	c = 1.0L + aa / c;
+	if (std::fabs(c) < tiny) c = tiny;
+	d = 1.0L / d;
+	h *= d * c;
+	aa = -(p + m) * (p + q + m) * x / ((p + 2*m) * (p + 2*m + 1));
+	d = 1.0L + aa * d;
+	if (std::fabs(d) < tiny) d = tiny;
+	c = 1.0L + aa / c;
+	if (std::fabs(c) < tiny) c = tiny;
+	d = 1.0L / d;
+	_Real delta = d * c;
+	h *= delta;
+	if (std::fabs(delta - 1.0L) < 1e-18L)
+	  break;
+      }
+    return (h);
+  }
+
+template<typename _Real>
+  _Real
+  regularized_beta(_Real x, _Real p, _Real q)
+  {
+    // I_x(p,q)
+    if (x <= 0.0L)
+      return (0.0L);
+    if (x >= 1.0L)
+      return (1.0L);
+    _Real front = std::exp(std::lgamma(p + q) - std::lgamma(p) - std::lgamma(q)
+			   + p * std::log(x) + q * std::log1p(-x));
+    if (x < (p + 1.0L) / (p + q + 2.0L))
+      return (front * beta_fraction(x, p, q) / p);
+    return (1.0L - front * beta_fraction(1.0L - x, q, p) / q);
+  }
+
+template<typename _Real = long double>
+  class cdist_piecewise_constant
+  {
+    std::vector< _Real > the_intervals;
+    std::vector< _Real > the_slopes;
+    std::vector< _Real > the_sums;
+
+    typedef typename std::vector< _Real >::size_type size_type;
+
+  public:
+
+    template < typename InputIteratorI, typename InputIteratorW >
+    cdist_piecewise_constant ( InputIteratorI fromI, InputIteratorI toI,
+			       InputIteratorW fromW )
+    : the_intervals ( fromI, toI ),
+      the_slopes ( the_intervals.size() - 1, 0 ),
+      the_sums ( the_slopes.size(), 0 )
+    {
+      _Real the_total = 0;
+      for ( size_type i = 0; i < the_slopes.size(); ++i ) {
+	the_slopes[i] = *fromW;
+	the_total += the_slopes[i];
+	++fromW;
+      }
+      for ( size_type i = 0; i < the_slopes.size(); ++i ) {
+	the_slopes[i] /= the_total;
+      }
+      for ( size_type i = 1; i < the_sums.size(); ++i ) {
+	the_sums[i] = the_sums[i-1] + the_slopes[i-1];
+      }
+      for ( size_type i = 0; i < the_slopes.size(); ++i ) {
+	the_slopes[i] /= the_intervals[i+1] - the_intervals[i];
+      }
+    }
+
+    _Real operator() ( _Real x ) const {
+      size_type index = std::lower_bound( the_intervals.begin(),
+				     the_intervals.end(),
+				     x )
+	- the_intervals.begin();
+      --index;
+      if ( index >= the_slopes.size() ) {
+	return ( 1 );
+      }
+      return ( the_sums[index] +
+	       the_slopes[index]
+	       *
+	       ( x - the_intervals[index] ) );
+    }
+  };
+
+template<typename _Real = long double>
+  class cdist_normalized_uniform
+  {
+  public:
+
+    _Real operator() ( _Real x ) const {
+      if ( x < 0.0L ) {
+	return ( 0.0L );
+      }
+      if ( x > 1.0L ) {
+	return ( 1.0L );
+      }
+      return ( x );
+    }
+
+  };
+
+// The normal distribution
+template<typename _Real = long double>
+  class cdist_normal {
+
+    _Real mean;
+    _Real stdev;
+
+  public:
+
+    cdist_normal ( _Real m = 0.0L, _Real d = 1.0L )
+      : mean ( m )
+      , stdev ( d )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      _Real const sqrt2 = 1.41421356237309504880L;
+      return
+	( 0.5L * ( 1.0L + erf( ( x - mean ) / ( stdev * sqrt2 ) ) ) );
+    }
+      
+  };
+
+template<typename _Real = long double>
+  class density_normal
+  {
+    
+    _Real mean;
+    _Real stdev;
+
+  public:
+
+    density_normal ( _Real m = 0.0L, _Real d = 1.0L )
+      : mean ( m )
+      , stdev ( d )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      x -= mean;
+      x /= stdev;
+      x *= x;
+      x /= 2.0L;
+      return ( exp( -x ) / ( stdev * sqrt2pi ) );
+    }
+      
+  };
+
+// The lognormal distribution
+template<typename _Real = long double>
+  class cdist_lognormal
+  {
+
+    cdist_normal<_Real> norm;
+
+  public:
+
+    cdist_lognormal ( _Real m = 0.0L, _Real d = 1.0L )
+      : norm( m, d )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      return ( norm( log(x) ) );
+    }
+      
+  };
+
+// The exponential distribution
+template<typename _Real = long double>
+  class cdist_exponential
+  {
+
+    _Real lambda;
+
+  public:
+
+    cdist_exponential ( _Real l = 1.0L )
+      : lambda ( l ) 
+    {}
+
+    _Real operator() ( _Real x ) const {
+      if ( x < 0.0L ) {
+	return ( 0 );
+      }
+      return ( 1.0L - exp( -x/lambda ) );
+    }
+    
+  };
+
+// The Weibull distribution
+template<typename _Real = long double>
+  class cdist_weibull
+  {
+
+    _Real k;
+    _Real l;
+
+  public:
+
+    cdist_weibull ( _Real k_par, _Real l_par )
+      : k ( k_par )
+      , l ( l_par )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      return ( 1.0 - std::exp( - pow( x / l, k  ) ) );
+    }
+
+  };
+
+// The extreme value distribution
+template<typename _Real = long double>
+  class cdist_extreme_value
+  {
+
+    _Real a;
+    _Real b;
+
+  public:
+
+    cdist_extreme_value ( _Real a_par, _Real b_par )
+      : a ( a_par )
+      , b ( b_par )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      return ( std::exp( - std::exp( - ( x - a ) / b ) ) );
+    }
+
+  };
+
+// The chi-square distribution
+template<typename _Real = long double>
+  class cdist_chi_squared
+  {
+    _Real k;
+
+  public:
+    
+    cdist_chi_squared ( unsigned int val )
+      : k ( val )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      return ( regularized_lower_gamma( k/2.0L, x/2.0L ) );
+    }
+
+  };
+
+template <typename ObservedSequence, typename ExpectedSequence, typename _Real = long double >
+  _Real
+  get_chi_squared( ObservedSequence const & obs,
+		  ExpectedSequence const & exp )
+  {
+    assert( obs.size() == exp.size() );
+    _Real chi_squared = 0.0L;
+    for ( typename ObservedSequence::size_type i = 0;
+	  i < obs.size(); ++i )
+      chi_squared += sqr( obs[i] - exp[i] ) / exp[i];
+    return ( chi_squared );
+  }
+
+// The Cauchy distribution
+template<typename _Real = long double>
+  class cdist_cauchy
+  {
+
+    _Real a;
+    _Real b;
+
+  public:
+
+    cdist_cauchy ( _Real a_par, _Real b_par )
+      : a ( a_par )
+      , b ( b_par )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      return  ( atanl( (x-a) / b ) / pi + 0.5L );
+    }
+
+  };
+
+
+// The Gamma distribution
+template<typename _Real = long double>
+  class cdist_gamma
+  {
+
+    _Real alpha;
+    _Real beta;
+
+  public:
+
+    cdist_gamma ( _Real a, _Real b )
+      : alpha ( a )
+      , beta ( b )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      return ( regularized_lower_gamma( alpha, x/beta ) );
+    }
+    
+  };
+
+
+// The beta distribtion
+template<typename _Real = long double>
+  class cdist_beta
+  {
+
+    _Real p;
+    _Real q;
+
+  public:
+
+    cdist_beta ( _Real p_par, _Real q_par )
+      : p ( p_par )
+      , q ( q_par )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      if ( x < 0.0L ) { return 0.0L; }
+      if ( x > 1.0L ) { return 1.0L; }
+      return ( regularized_beta( x, p, q ) );
+    }
+    
+  };
+
+  
+// The Fisher F distribtion
+template<typename _Real = long double>
+  class cdist_fisher_f
+  {
+
+    _Real m;
+    _Real n;
+
+  public:
+
+    cdist_fisher_f ( _Real m_par, _Real n_par )
+      : m ( m_par )
+      , n ( n_par )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      if ( x < 0.0L ) { return 0.0L; }
+      return ( regularized_beta( 1.0L - n/(m*x+n), m/2, n/2 ) );
+    }
+    
+  };
+
+
+// Student's t distribution
+template<typename _Real = long double>
+  class cdist_student_t
+  {
+
+    _Real n;
+
+  public:
+
+    cdist_student_t ( uhuge n_par )
+      : n ( n_par )
+    {}
+
+    _Real operator() ( _Real t ) const {
+      _Real a = sqrt( t*t + n );
+      _Real x = ( t + a ) / ( 2.0L * a );
+      _Real n_half = n/2.0L;
+      return ( regularized_beta( x, n_half, n_half ) );
+    }
+    
+  };
+
+  
+// The Kolmogorov distribution
+template<typename _Real = long double>
+  class cdist_kolmogorov
+  {
+  public:
+
+    _Real operator() ( _Real x ) const {
+      return ( 1.0L - exp( -2.0L * sqr(x) ) );
+    }
+
+  };
+
+  // The two-sided Kolmogorov distribution, of sqrt(n) times
+  // the largest distance of the empirical and true cdf
+template<typename _Real = long double>
+  class cdist_kolmogorov_smirnov
+  {
+  public:
+
+    _Real operator() ( _Real x ) const {
+      if ( x <= 0.0L )
+	return ( 0.0L );
+      _Real sum = 0.0L;
+      for ( int k = 1; k < 100; ++k ) {
+	_Real term = exp( -2.0L * sqr(k * x) );
+	sum += ( k % 2 ) ? term : -term;
+	if ( term < 1e-20L )
+	  break;
+      }
+      return ( 1.0L - 2.0L * sum );
+    }
+
+  };
+
+// 
+template < typename AscendingSequence, typename CumulativeDist, typename _Real = long double >
+  _Real upper_kolmogorov_measure ( AscendingSequence const & seq,
+				   CumulativeDist cd ) {
+    KUBUX_ASSERT( is_nondescending( seq ) );
+    _Real the_max = 0;
+    _Real index = 1;
+    for ( typename AscendingSequence::const_iterator iter
+	    = seq.begin(); iter != seq.end(); ++iter ) {
+      _Real term = index - cd( *iter ) * seq.size();
+      the_max = std::max( the_max, term );
+      ++ index;
+    }
+    return ( the_max / root( seq.size() ) );
+  }
+
+// 
+template < typename AscendingSequence, typename CumulativeDist, typename _Real = long double >
+  _Real lower_kolmogorov_measure ( AscendingSequence const & seq,
+				   CumulativeDist cd ) {
+    KUBUX_ASSERT( is_nondescending( seq ) );
+    _Real the_max = 0;
+    _Real index = 0;
+    for ( typename AscendingSequence::const_iterator iter
+	    = seq.begin(); iter != seq.end(); ++iter )
+      {
+	_Real term = cd( *iter ) * seq.size() - index;
+	the_max = std::max( the_max, term );
+	++ index;
+      }
+    return ( the_max / root( seq.size() ) );
+  }
+
+
+  // The minimum gap distribution
+  //
+  //  This introduces the order statistic of gaps of
+  //  n random points on a circle of unit perimeter.
+template<typename _Real = long double>
+  class cdist_minimum_gap
+  {
+
+    _Real num_points;
+
+  public:
+
+    cdist_minimum_gap ( uhuge n )
+      : num_points ( n )
+    {}
+
+    _Real operator() ( _Real x ) const {
+      if ( x <= 0.0L )
+	return ( 0 );
+      else if ( num_points*x >= 1.0L )
+	return ( 1.0L );
+      else
+        return ( 1.0L - std::pow( 1.0L - num_points*x,
+				num_points-1 ) );
+    }
+
+  };
@@ -0,0 +1,627 @@
+  // The tests of ../test.tcc, for driver_battery.cpp: made to compile on
+  // their own, with a p-value in every result, and with what the battery
+  // needs added; ../test.tcc itself is left as it is.
+
+  // Section: Support
+  // =================
+  /*
+    A test returns whether it passed, the p-value of its statistic
+    (the probability of a value at least as high, under the null
+    hypothesis) and a message.  A verdict is +1 or -1 when the
+    statistic lies in the upper or lower eps tail of its
+    distribution, 0 otherwise.
+  */
+
+struct test_result
+{
+  bool passed;
+  long double p_value;
+  std::string message;
+};
+
+constexpr long double epsilon = 1.0e-4L;
+
+template<typename UniformRNG>
+  constexpr bool
+  is_discrete(UniformRNG const &)
+  { return (std::is_integral<typename UniformRNG::result_type>::value); }
+
+  // the number of values of a discrete RNG, the length of the range of a real one
+template<typename UniformRNG>
+  long double
+  size(UniformRNG const & urng)
+  {
+    return ((long double)(urng.max()) - (long double)(urng.min())
+	    + is_discrete(urng));
+  }
+
+template<typename _Real, typename CumulativeDist>
+  int
+  outcome(_Real x, CumulativeDist const & cd, long double eps = epsilon)
+  {
+    _Real c = cd(x);
+    if (c > 1.0L - eps)
+      return (1);
+    if (c < eps)
+      return (-1);
+    return (0);
+  }
+
+  // the source of the random subdivisions of the bucket test,
+  // independent of the RNG under test
+class universal_rng
+{
+  std::mt19937_64 the_engine;
+
+public:
+
+  template<typename T>
+    T
+    operator()(T lo, T hi)
+    {
+      if constexpr (std::is_integral<T>::value)
+	return (std::uniform_int_distribution<T>(lo, hi)(the_engine));
+      else
+	return (std::uniform_real_distribution<T>(lo, hi)(the_engine));
+    }
+};
+
+  // Section: The Kolmogorov test
+  // ============================
+  /*
+    Compares a sorted sample with a cumulative distribution.
+    The verdict is from the two one-sided measures, the p-value
+    from the two-sided one, with the correction of Stephens for
+    small samples.
+  */
+
+template < typename AscendingSequence, typename CumulativeDist, typename _Real = long double >
+  test_result
+  kolmogorov_test(AscendingSequence const & seq,
+		  CumulativeDist const & cd,
+		  _Real eps = epsilon)
+  {
+    KUBUX_ENFORCE(is_nondescending(seq));
+
+    _Real k_upper = upper_kolmogorov_measure(seq, cd);
+    _Real k_lower = lower_kolmogorov_measure(seq, cd);
+    
+    int upper_verdict = outcome(k_upper, cdist_kolmogorov(), eps);
+    int lower_verdict = outcome(k_lower, cdist_kolmogorov(), eps);
+    _Real root_n = root(seq.size());
+    _Real k_both = std::max(k_upper, k_lower) * (1.0L + 0.12L / root_n + 0.11L / seq.size());
+    _Real p_value = 1.0L - cdist_kolmogorov_smirnov()(k_both);
+
+    std::ostringstream msg;
+
+    if (upper_verdict > 0)
+      msg << "upper Kolmogorov measure " << k_upper << " too high, ";
+    else if (upper_verdict < 0)
+      msg << "upper Kolmogorov measure " << k_upper << " too small, ";
+    else
+      msg << "upper Kolmogorov measure " << k_upper << " ok, ";
+
+    if (lower_verdict > 0)
+      msg << "lower Kolmogorov measure " << k_lower << " too high";
+    else if (lower_verdict < 0)
+      msg << "lower Kolmogorov measure " << k_lower << " too small";
+    else
+      msg << "lower Kolmogorov measure " << k_lower << " ok";
+
+    return (test_result{(upper_verdict == 0) && (lower_verdict == 0),
+			 p_value, msg.str()});
+  }
+
+  // Section: The bucket test
+  // ========================
+  /*
+    We divide the range into subranges and check whether each
+    quantile gets its expected share.
+
+    This is generic for real and integral RNGs.
+  */
+
+
+template<typename UniformRNG, typename AscendingSequence, typename _UInt, typename _Real = long double >
+  test_result
+  generic_bucket_test(UniformRNG & urng,
+		      AscendingSequence const & subdivision,
+		      _UInt num_draws,
+		      _Real eps = epsilon)
+  {
+    KUBUX_ENFORCE(is_ascending(subdivision));
+
+    typedef typename UniformRNG::result_type value_type;
+    typedef std::vector<_Real>             count_sequence;
+
+    // determine the expected number of hits
+    count_sequence expected;
+    expected.push_back(subdivision[0] - urng.min() + is_discrete(urng));
+    for (typename count_sequence::size_type i = 1; i < subdivision.size(); ++i)
+      {
+	expected.push_back(subdivision[i] - subdivision[i-1]);
+	assert(expected.back() > 0);
+      }
+    expected.push_back(urng.max() - subdivision.back());
+    assert(expected.back() > 0);
+    for (typename count_sequence::size_type i = 0; i <= subdivision.size(); ++i)
+      expected[i] *= _Real(num_draws) / size(urng);
+
+    // throw the dices
+    count_sequence observed (expected.size(), 0);
+    while (num_draws-- > 0)
+      {
+	value_type value = urng();
+	typename count_sequence::size_type index =
+	  std::lower_bound(subdivision.begin(), subdivision.end(), value)
+	  - subdivision.begin();
+	++observed[ index ];
+      }
+
+    // compare observed and expected
+    _Real chi_squared = get_chi_squared(observed, expected);
+    int verdict = outcome(chi_squared, cdist_chi_squared(expected.size()-1), eps);
+    _Real p_value = regularized_upper_gamma((expected.size()-1)/2.0L, chi_squared/2.0L);
+
+    std::ostringstream msg;
+    msg << "chi-square " << chi_squared;
+    if (verdict > 0)
+      msg << " too high";
+    else if (verdict < 0)
+      msg << " too small";
+    else
+      msg << " ok";
+
+    return (test_result{verdict == 0, p_value, msg.str()});
+  }
+  
+template<typename UniformRNG, typename _UInt, typename _Real = long double >
+  test_result
+  full_bucket_test(UniformRNG & urng,
+		   _UInt num_draws,
+		   _Real eps = epsilon)
+  {
+    /*
+      This version of the bucket test is for integral
+      RNGs with small range. We just have a bucket for
+      each possible value.
+    */
+    typedef typename UniformRNG::result_type value_type;
+    typedef std::vector<value_type >        value_sequence;
+    value_sequence subdivision;
+    for (value_type i = urng.min(); i < urng.max(); ++i)
+      subdivision.push_back(i);
+    return (generic_bucket_test(urng, subdivision, num_draws, eps));
+  }
+  
+  
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  random_bucket_test(UniformRNG & urng,
+		     _UInt num_buckets,
+		     _UInt num_draws,
+		     _Real eps = epsilon)
+  {
+    /*
+      This version of the bucket test chooses the
+      specified number of buckets randomly (using the
+      universal_rng).
+    */
+    KUBUX_ENFORCE(num_buckets > 1);
+    KUBUX_ENFORCE(num_buckets <= size(urng) || ! is_discrete(urng));
+    
+    typedef typename UniformRNG::result_type value_type;
+    typedef std::vector<value_type >        value_sequence;
+
+    // create the subdivision
+    value_sequence subdivision;
+    subdivision.reserve(num_buckets - 1);
+    universal_rng the_rng;
+    while (subdivision.size() != num_buckets -1)
+      {
+	for (_UInt i =  subdivision.size() + 1;
+	      i < num_buckets; ++i)
+	  {
+	    value_type candidate = the_rng(urng.min(), urng.max());
+	    if (urng.min() < candidate && candidate < urng.max())
+	      subdivision.push_back(candidate);
+	  }
+	std::sort(subdivision.begin(),
+		   subdivision.end());
+	typename value_sequence::iterator last =
+	  std::unique(subdivision.begin(), subdivision.end());
+	subdivision.erase(last, subdivision.end());
+      }
+    return (generic_bucket_test(urng, subdivision, num_draws, eps));
+  }
+
+
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  bucket_test(UniformRNG & urng,
+	      _UInt num_draws,
+	      _Real eps = epsilon)
+  {
+    if (is_discrete(urng) &&	size(urng) <= 30000)
+      return (full_bucket_test(urng, num_draws, eps));
+    else
+      return (random_bucket_test(urng, 10000, num_draws, eps));
+  }
+
+  
+  // Section: The congruence test
+  // ============================
+  /*
+    We divide the range into congruence classes modulo
+    a given modulus. Then we check whether each class gets
+    the expected share.
+
+    This test only applies to integral RNGs.
+
+    The battery uses it for the
+    low bits, with moduli 2^k.
+  */
+  
+template<typename _UInt, typename IntType >
+  _UInt
+  mod(_UInt modulus, IntType i)
+  {
+    return (((i % modulus) + modulus) % modulus);
+  }
+  
+template<typename UniformRNG, typename _UInt, typename _Real = long double >
+  test_result
+  congruence_test(UniformRNG & urng,
+		  _UInt num_draws,
+		  _UInt modulus,
+		  _Real eps = epsilon)
+  {
+    KUBUX_ENFORCE(modulus <= size(urng));
+    KUBUX_ENFORCE(is_discrete(urng));
+    
+    // compile expected hit counts
+    _Real range = size(urng);
+    _Real class_size = floorl(range / modulus);
+    _UInt num_excess_slots = range - class_size * modulus;
+    assert(num_excess_slots < modulus);
+    _Real hits_expected = (class_size / range) * num_draws;
+    std::vector<_Real> expected (modulus, hits_expected);
+    for (_UInt i = 0; i < num_excess_slots; ++i)
+      expected[i] += _Real(num_draws) / range;
+ 
+    // compile observed hit counts
+    std::vector<_Real> counted (modulus, 0.0L);
+    for (_UInt i = 0; i < num_draws; ++i)
+      ++counted[ (urng() - urng.min()) % modulus ];
+ 
+    // and evaluate
+    _Real chi_squared = get_chi_squared(counted, expected);
+    int verdict =
+      outcome(chi_squared,
+	       cdist_chi_squared(expected.size()-1), eps);
+    _Real p_value = regularized_upper_gamma((expected.size()-1)/2.0L, chi_squared/2.0L);
+
+    std::ostringstream msg;
+    msg << "chi-square " << chi_squared;
+    if (verdict > 0)
+      msg << " too high";
+    else if (verdict < 0)
+      msg << " too small";
+    else
+      msg << " ok";
+    
+    return (test_result{verdict == 0, p_value, msg.str()});
+  }
+				 
+
+  /*
+    Kolmogorov test for uniformity.
+    This test directly applies only to the uniform
+    distribution of a real random variable in [0,1).
+
+    We also use it for discrete distributions of large
+    range size simply by rescaling.
+  */
+
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  uniform_test(UniformRNG & urng,
+	       _UInt num_draws,
+	       _Real eps = epsilon)
+  {
+    _Real rng_size = size(urng);
+    std::vector<_Real> real (num_draws, 0.0L);
+    for (_UInt i = 0; i < num_draws; ++i)
+      {
+	real[i] = _Real(urng()) - _Real(urng.min());
+	real[i] /= rng_size;
+      }
+
+    std::sort(real.begin(), real.end());
+    return (kolmogorov_test(real, cdist_normalized_uniform(), eps));
+  }
+
+
+  /*
+    Minimum gap size test.
+    This test compares the empirical distribution of the
+    minimum circula gap to the theoretical one.
+
+    This test applies directly to uniform reals in [0,1).
+
+    We also use it for discrete RNGs with very large range
+    size (>=2^24) by simple rescaling.
+  */
+
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  minimum_gap_test(UniformRNG & urng,
+		   _UInt num_draws,
+		   _UInt num_runs = 500,
+		   _Real eps = epsilon)
+  {
+    _Real rng_size = size(urng);
+    
+    std::vector<_Real> real;
+    real.reserve(num_runs);
+    while (real.size() < num_runs)
+      {
+	std::vector<_Real> draws;
+	draws.reserve(num_draws);
+	while (draws.size() < num_draws)
+	  {
+	    _Real draw = _Real(urng()) - _Real(urng.min());
+	    draw /= rng_size;
+	    assert(0.0L <= draw && draw <= 1.0L);
+	    draws.push_back(draw);
+	  }
+	std::sort(draws.begin(), draws.end());
+	_Real last_distance = 1.0L + draws.front() - draws.back();
+	for (typename std::vector<_Real>::size_type i = 1; i < num_draws; ++i)
+	  draws[i-1] = draws[i] - draws[i-1];
+	draws.back() = last_distance;
+	std::sort(draws.begin(), draws.end());
+	real.push_back(draws.front());
+      }
+
+    std::sort(real.begin(), real.end());
+
+    assert(real.size() == num_runs);
+    assert(is_nondescending(real));
+    assert(is_in_unit_interval(real));
+    
+    return (kolmogorov_test(real, cdist_minimum_gap(num_draws), eps));
+  }
+
+
+  // Section: Chi-square tests of counts
+  // ===================================
+  /*
+    The tests below, after Knuth (TAOCP 3.3.2) and Marsaglia, count
+    their outcomes into categories of known probability.  Adjacent
+    categories are pooled, from either end, until every one expects
+    at least five hits, so that the chi-square distribution holds.
+  */
+
+template < typename CountSequence, typename _Real = long double >
+  test_result
+  pooled_chi_squared_test(CountSequence const & observed,
+			  CountSequence const & expected,
+			  _Real eps = epsilon)
+  {
+    assert(observed.size() == expected.size());
+
+    CountSequence obs, exp;
+    _Real obs_pending = 0.0L;
+    _Real exp_pending = 0.0L;
+    for (typename CountSequence::size_type i = 0; i < expected.size(); ++i)
+      {
+	obs_pending += observed[i];
+	exp_pending += expected[i];
+	if (exp_pending >= 5.0L)
+	  {
+	    obs.push_back(obs_pending);
+	    exp.push_back(exp_pending);
+	    obs_pending = exp_pending = 0.0L;
+	  }
+      }
+    KUBUX_ENFORCE(exp.size() > 1);
+    obs.back() += obs_pending;
+    exp.back() += exp_pending;
+
+    _Real chi_squared = get_chi_squared(obs, exp);
+    int verdict = outcome(chi_squared, cdist_chi_squared(exp.size()-1), eps);
+    _Real p_value = regularized_upper_gamma((exp.size()-1)/2.0L, chi_squared/2.0L);
+
+    std::ostringstream msg;
+    msg << "chi-square " << chi_squared << " on " << exp.size()-1 << " degrees of freedom";
+    if (verdict > 0)
+      msg << " too high";
+    else if (verdict < 0)
+      msg << " too small";
+    else
+      msg << " ok";
+
+    return (test_result{verdict == 0, p_value, msg.str()});
+  }
+
+  // the draw scaled to [0,1)
+template<typename UniformRNG, typename _Real = long double >
+  _Real
+  unit_draw(UniformRNG & urng)
+  { return ((_Real(urng()) - _Real(urng.min())) / size(urng)); }
+
+  /*
+    Gap test.
+    The lengths of the runs of draws outside [alpha, beta) are
+    geometric, with the probability p = beta - alpha of a hit; runs of
+    length max_gap or more are counted together.
+  */
+
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  gap_test(UniformRNG & urng,
+	   _UInt num_gaps,
+	   _Real alpha,
+	   _Real beta,
+	   _UInt max_gap,
+	   _Real eps = epsilon)
+  {
+    KUBUX_ENFORCE(0.0L <= alpha && alpha < beta && beta <= 1.0L);
+
+    _Real p = beta - alpha;
+    std::vector<_Real> expected (max_gap + 1);
+    for (_UInt r = 0; r < max_gap; ++r)
+      expected[r] = num_gaps * p * std::pow(1.0L - p, _Real(r));
+    expected[max_gap] = num_gaps * std::pow(1.0L - p, _Real(max_gap));
+
+    std::vector<_Real> observed (max_gap + 1, 0.0L);
+    for (_UInt g = 0; g < num_gaps; ++g)
+      {
+	_UInt r = 0;
+	for (_Real u = unit_draw(urng); u < alpha || u >= beta; u = unit_draw(urng))
+	  ++r;
+	++observed[std::min(r, max_gap)];
+      }
+
+    return (pooled_chi_squared_test(observed, expected, eps));
+  }
+
+  /*
+    Birthday spacings test.
+    num_birthdays days are drawn from a year of num_days days and
+    sorted; the number of equal values among the circular spacings
+    between them is close to Poisson with mean
+    num_birthdays^3 / (4 num_days).  Marsaglia takes 512 birthdays
+    in 2^24 days, for a mean of 2.
+  */
+
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  birthday_spacings_test(UniformRNG & urng,
+			 _UInt num_birthdays,
+			 _UInt num_days,
+			 _UInt num_runs,
+			 _Real eps = epsilon)
+  {
+    KUBUX_ENFORCE(num_birthdays > 1);
+    KUBUX_ENFORCE(num_days <= size(urng));
+
+    _Real lambda = _Real(num_birthdays) * num_birthdays * num_birthdays / (4.0L * num_days);
+    _UInt max_count = _UInt(lambda + 10.0L * root(lambda) + 10.0L);
+    std::vector<_Real> expected (max_count + 1);
+    _Real below = 0.0L;
+    for (_UInt k = 0; k < max_count; ++k)
+      {
+	expected[k] = std::exp(k * std::log(lambda) - lambda - std::lgamma(k + 1.0L));
+	below += expected[k];
+      }
+    expected[max_count] = std::max(0.0L, 1.0L - below);
+    for (auto & e : expected)
+      e *= num_runs;
+
+    std::vector<_Real> observed (max_count + 1, 0.0L);
+    std::vector<uhuge> days (num_birthdays);
+    for (_UInt run = 0; run < num_runs; ++run)
+      {
+	for (auto & d : days)
+	  d = uhuge(unit_draw(urng) * num_days);
+	std::sort(days.begin(), days.end());
+	uhuge first = days.front() + num_days - days.back();
+	for (_UInt i = num_birthdays - 1; i > 0; --i)
+	  days[i] -= days[i-1];
+	days.front() = first;
+	std::sort(days.begin(), days.end());
+	_UInt equal = 0;
+	for (_UInt i = 1; i < num_birthdays; ++i)
+	  equal += (days[i] == days[i-1]);
+	++observed[std::min(equal, max_count)];
+      }
+
+    return (pooled_chi_squared_test(observed, expected, eps));
+  }
+
+  /*
+    Collision test.
+    num_balls balls are thrown into num_urns urns, with many more
+    urns than balls, and a ball that lands in an occupied urn is a
+    collision.  The distribution of the number of collisions is exact,
+    from the recursion over the balls: the i-th ball, after c
+    collisions, collides with probability (i - c) / num_urns.
+  */
+
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  collision_test(UniformRNG & urng,
+		 _UInt num_urns,
+		 _UInt num_balls,
+		 _UInt num_runs,
+		 _Real eps = epsilon)
+  {
+    KUBUX_ENFORCE(num_balls <= num_urns);
+    KUBUX_ENFORCE(num_urns <= size(urng));
+
+    _Real mean = _Real(num_balls) * (num_balls - 1) / (2.0L * num_urns);
+    _UInt max_count = std::min(num_balls, _UInt(mean + 10.0L * root(mean) + 10.0L));
+    std::vector<_Real> expected (max_count + 1, 0.0L);
+    expected[0] = 1.0L;
+    for (_UInt i = 1; i < num_balls; ++i)
+      for (_UInt c = std::min(i, max_count); c > 0; --c)
+	{
+	  _Real hit = _Real(i - (c - 1)) / num_urns;
+	  if (c == max_count)
+	    expected[c] += expected[c-1] * hit;
+	  else
+	    expected[c] = expected[c] * (1.0L - _Real(i - c) / num_urns) + expected[c-1] * hit;
+	  if (c == 1)
+	    expected[0] *= 1.0L - _Real(i) / num_urns;
+	}
+    for (auto & e : expected)
+      e *= num_runs;
+
+    std::vector<_Real> observed (max_count + 1, 0.0L);
+    std::vector<unsigned char> occupied (num_urns, 0);
+    std::vector<uhuge> thrown (num_balls);
+    for (_UInt run = 0; run < num_runs; ++run)
+      {
+	_UInt collisions = 0;
+	for (auto & urn : thrown)
+	  {
+	    urn = uhuge(unit_draw(urng) * num_urns);
+	    collisions += occupied[urn];
+	    occupied[urn] = 1;
+	  }
+	for (auto urn : thrown)
+	  occupied[urn] = 0;
+	++observed[std::min(collisions, max_count)];
+      }
+
+    return (pooled_chi_squared_test(observed, expected, eps));
+  }
+
+  /*
+    Serial test.
+    Successive non-overlapping pairs of draws, each scaled to
+    num_cells values, must fill the num_cells^2 cells evenly.
+  */
+
+template<typename _UInt, typename UniformRNG, typename _Real = long double >
+  test_result
+  serial_pair_test(UniformRNG & urng,
+		   _UInt num_pairs,
+		   _UInt num_cells,
+		   _Real eps = epsilon)
+  {
+    KUBUX_ENFORCE(num_cells <= size(urng));
+
+    std::vector<_Real> expected (num_cells * num_cells, _Real(num_pairs) / (num_cells * num_cells));
+    std::vector<_Real> observed (num_cells * num_cells, 0.0L);
+    for (_UInt i = 0; i < num_pairs; ++i)
+      {
+	_UInt x = _UInt(unit_draw(urng) * num_cells);
+	_UInt y = _UInt(unit_draw(urng) * num_cells);
+	++observed[x * num_cells + y];
+      }
+
+    return (pooled_chi_squared_test(observed, expected, eps));
+  }
@@ -0,0 +1,164 @@
+/*
+ *  MIXMAX - a statistical battery without external libraries, in place of driver_testU01.c
+ *  and driver_gsl.c where TestU01 and GSL are not installed
+ *
+ *  Every test of battery_test.tcc, from ../test.tcc, is repeated on disjoint streams, seed_uniquestream(0, 0, 1, k),
+ *  spread over the threads.  The p-values of the repetitions of a test must be uniform
+ *  themselves, which the second-level Kolmogorov test checks; a test fails when its
+ *  second-level p-value is below 1e-4, and is suspect below 1e-3, which happens by chance
+ *  to one of the 11 tests in about 90 runs.  A truncated LCG, whose low bits have a short period,
+ *  is run as well and must fail.
+ *
+ *      ./battery [N] [repetitions] [threads]       N = 17, 240 or 256
+ */
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <type_traits>
+#include <cassert>
+#include <cstdlib>
+#include <cstdio>
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "battery_cdf.tcc"
+#include "battery_test.tcc"
+#include "mixmax.hpp"
+
+template <typename Engine>
+class halves   // the two 30-bit halves of each number, as get_next_uint32x2 gives them
+{
+    Engine& gen;
+    std::uint32_t pair[2];
+    int next = 2;
+public:
+    using result_type = std::uint32_t;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return (1u << 30) - 1; }
+    explicit halves(Engine& g) : gen(g) {}
+    result_type operator()(){
+        if (next == 2) { gen.get_next_uint32x2(pair); next = 0; }
+        return pair[next++];
+    }
+};
+
+class truncated_lcg   // the control: Knuth's MMIX LCG, low 61 bits, the lowest of which have period 2^k
+{
+    std::uint64_t x;
+public:
+    using result_type = std::uint64_t;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return M61; }
+    explicit truncated_lcg(std::uint64_t seed) : x(seed) {}
+    result_type operator()(){
+        x = x*6364136223846793005ULL + 1442695040888963407ULL;
+        return x & M61;
+    }
+    void get_next_uint32x2(std::uint32_t out[2]){
+        std::uint64_t v = (*this)();
+        out[0] = (std::uint32_t)(v & 0x3FFFFFFF);
+        out[1] = (std::uint32_t)((v >> 30) & 0x3FFFFFFF);
+    }
+};
+
+template <typename Engine>
+struct battery_test
+{
+    const char* name;
+    std::function<test_result(Engine&)> run;
+};
+
+template <typename Engine>
+std::vector<battery_test<Engine>> battery_tests(){
+    typedef unsigned long ulong;
+    return {
+        {"uniform",                  [](Engine& g){ return uniform_test(g, ulong(200000)); }},
+        {"bucket, 1000",             [](Engine& g){ return random_bucket_test(g, ulong(1000), ulong(200000)); }},
+        {"minimum gap, 1000 x 200",  [](Engine& g){ return minimum_gap_test(g, ulong(1000), ulong(200)); }},
+        {"congruence mod 1024",      [](Engine& g){ return congruence_test(g, ulong(200000), ulong(1024)); }},
+        {"congruence mod 1021",      [](Engine& g){ return congruence_test(g, ulong(200000), ulong(1021)); }},
+        {"uniform, 30-bit halves",   [](Engine& g){ halves<Engine> h(g); return uniform_test(h, ulong(200000)); }},
+        {"congruence mod 64, halves",[](Engine& g){ halves<Engine> h(g); return congruence_test(h, ulong(200000), ulong(64)); }},
+        {"gap, [0, 1/8)",            [](Engine& g){ return gap_test(g, ulong(20000), 0.0L, 0.125L, ulong(40)); }},
+        {"birthday spacings, 2^24",  [](Engine& g){ return birthday_spacings_test(g, ulong(512), ulong(1) << 24, ulong(500)); }},
+        {"collision, 2^12 in 2^20",  [](Engine& g){ return collision_test(g, ulong(1) << 20, ulong(1) << 12, ulong(200)); }},
+        {"serial pairs, 32 x 32",    [](Engine& g){ return serial_pair_test(g, ulong(200000), ulong(32)); }},
+    };
+}
+
+// runs every test on repetitions streams, made by make_engine(k), and returns the number of failed tests
+template <typename Engine, typename MakeEngine>
+int run_battery(const char* title, MakeEngine make_engine, int repetitions, unsigned nthreads){
+    std::vector<battery_test<Engine>> tests = battery_tests<Engine>();
+    const int jobs = (int)tests.size()*repetitions;
+    std::vector<test_result> results(jobs);
+    std::atomic<int> next(0);
+    auto worker = [&](){
+        for (int j; (j = next.fetch_add(1)) < jobs; ){
+            Engine gen = make_engine(j);
+            results[j] = tests[j / repetitions].run(gen);
+        }
+    };
+    auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for (unsigned t=1; t<nthreads; t++){ pool.emplace_back(worker); }
+    worker();
+    for (auto& t : pool){ t.join(); }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    int failed = 0;
+    printf("%s, %d repetitions on %u threads, %.1f s\n", title, repetitions, nthreads, seconds);
+    for (std::size_t t=0; t<tests.size(); t++){
+        std::vector<long double> p;
+        int first_failed = 0;
+        for (int r=0; r<repetitions; r++){
+            const test_result& res = results[t*repetitions + r];
+            p.push_back(res.p_value);
+            if (!res.passed) { first_failed++; }
+        }
+        std::sort(p.begin(), p.end());
+        test_result second = kolmogorov_test(p, cdist_normalized_uniform());
+        bool ok = second.p_value >= 1e-4L;
+        if (!ok) { failed++; }
+        printf("  %-28s %3d/%d out of the %.0Le tails, second level p = %.4Lf  %s\n", tests[t].name,
+               first_failed, repetitions, epsilon, second.p_value,
+               !ok ? "FAILED" : (second.p_value < 1e-3L) ? "suspect" : "ok");
+    }
+    return failed;
+}
+
+template <int N>
+int run_mixmax(int repetitions, unsigned nthreads){
+    char title[64];
+    snprintf(title, sizeof(title), "MIXMAX N=%d", N);
+    return run_battery<mixmax_engine<N>>(title, [](int k){ return mixmax_engine<N>(0, 0, 1, (myID_t)k); },
+                                         repetitions, nthreads);
+}
+
+int main(int argc, char* argv[]){
+    int n = (argc > 1) ? atoi(argv[1]) : 240;
+    int repetitions = (argc > 2) ? atoi(argv[2]) : 32;
+    unsigned nthreads = (argc > 3) ? (unsigned)atoi(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+    int failed;
+    switch (n){
+        case 17:  failed = run_mixmax<17>(repetitions, nthreads); break;
+        case 240: failed = run_mixmax<240>(repetitions, nthreads); break;
+        case 256: failed = run_mixmax<256>(repetitions, nthreads); break;
+        default:
+            fprintf(stderr, "usage: %s [N] [repetitions] [threads], with N = 17, 240 or 256\n", argv[0]);
+            return 1;
+    }
+    int control = run_battery<truncated_lcg>("control, truncated LCG",
+                                             [](int k){ return truncated_lcg(0x9E3779B97F4A7C15ULL*(k+1)); },
+                                             repetitions, nthreads);
+    printf("MIXMAX N=%d: %s (%d tests failed); control: %s (%d tests failed)\n", n, failed ? "FAILED" : "ok", failed,
+           control ? "detected" : "NOT DETECTED", control);
+    return (failed || !control) ? 1 : 0;
+}
@@ -0,0 +1,177 @@
+/*
+ *  MIXMAX - check the C functions that stand for many calls of get_next or seed_uniquestream
+ *
+ *  rng_discard(X, n) must leave X where n calls of get_next would, and seed_uniquestreams must give the states
+ *  of seed_uniquestream, stream ID after stream ID; the narrow outputs, one call or a whole array at a time,
+ *  must be the bits of the words of get_next
+ */
+
+#define _POSIX_C_SOURCE 199309L   // clock_gettime
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include "mixmax.h"
+
+static double seconds(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+// the mismatches of the next count numbers of X and Y
+static int compare_next(rng_state_t* X, rng_state_t* Y, int count){
+    int errors = 0, k;
+    for (k=0; k<count; k++){ if (get_next(X) != get_next(Y)) errors++; }
+    return errors;
+}
+
+static int check_discard(void){
+    static const unsigned long long skips[] = {0, 1, 2, N-2, N-1, N, N+1, 3*N+5, 1000, 12345};
+    int errors = 0, s, k;
+    rng_state_t *S = rng_alloc(), *T = rng_alloc(), *U = rng_alloc();
+    unsigned long long j;
+    seed_uniquestream(S, 0, 0, 1, 11);
+    seed_uniquestream(T, 0, 0, 1, 11);
+    // from every position in a block, against get_next
+    for (k=0; k<N; k++){
+        for (s=0; s<(int)(sizeof(skips)/sizeof(skips[0])); s++){
+            rng_discard(S, skips[s]);
+            for (j=0; j<skips[s]; j++){ get_next(T); }
+            errors += compare_next(S, T, 2);
+        }
+        get_next(S); get_next(T);
+    }
+    // the 128-bit count: nhi = 0 is rng_discard, and 2^64 is twice 2^63
+    for (s=0; s<(int)(sizeof(skips)/sizeof(skips[0])); s++){
+        *U = *S;
+        rng_discard128(S, 0, skips[s]);
+        rng_discard(U, skips[s]);
+        errors += compare_next(S, U, N+1);
+    }
+    *U = *S;
+    rng_discard128(S, 1, 5);
+    rng_discard(U, 1ULL << 63); rng_discard(U, 1ULL << 63); rng_discard(U, 5);
+    errors += compare_next(S, U, N+1);
+    printf("N=%d: rng_discard, rng_discard128 %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    rng_free(S); rng_free(T); rng_free(U);
+    return errors;
+}
+
+// the mismatches of two states, element by element
+static int compare_state(rng_state_t* X, rng_state_t* Y){
+    int errors = 0, i;
+    for (i=0; i<N; i++){ if (X->V[i] != Y->V[i]) errors++; }
+    if (X->sumtot != Y->sumtot || X->counter != Y->counter) errors++;
+    return errors;
+}
+
+static int check_uniquestreams(void){
+    enum { COUNT = 20 };
+    rng_state_t *X[COUNT], *T = rng_alloc();
+    int errors = 0, k;
+    for (k=0; k<COUNT; k++){ X[k] = rng_alloc(); }
+    seed_uniquestreams(X, COUNT, 3, 2, 1, 100);
+    for (k=0; k<COUNT; k++){
+        seed_uniquestream(T, 3, 2, 1, 100 + k);
+        errors += compare_state(X[k], T);
+        errors += compare_next(X[k], T, N+1);
+    }
+    // the stream ID carries into runID
+    seed_uniquestreams(X, 4, 0, 0, 7, 0xFFFFFFFE);
+    for (k=0; k<4; k++){
+        seed_uniquestream(T, 0, 0, k < 2 ? 7 : 8, 0xFFFFFFFE + k);
+        errors += compare_state(X[k], T);
+    }
+    seed_uniquestreams(X, 0, 0, 0, 0, 0);   // nothing to do
+    printf("N=%d: seed_uniquestreams %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    for (k=0; k<COUNT; k++){ rng_free(X[k]); }
+    rng_free(T);
+    return errors;
+}
+
+static void time_uniquestreams(int count){
+    rng_state_t **X = (rng_state_t**)malloc(count*sizeof(rng_state_t*));
+    double t1, t2;
+    int k;
+    for (k=0; k<count; k++){ X[k] = rng_alloc(); }
+    t1 = seconds();
+    for (k=0; k<count; k++){ seed_uniquestream(X[k], 0, 0, 1, k); }
+    t1 = seconds() - t1;
+    t2 = seconds();
+    seed_uniquestreams(X, count, 0, 0, 1, 0);
+    t2 = seconds() - t2;
+    printf("seeding %d streams: seed_uniquestream %.1f us/state, seed_uniquestreams %.1f us/state\n", count, 1e6*t1/count, 1e6*t2/count);
+    for (k=0; k<count; k++){ rng_free(X[k]); }
+    free(X);
+}
+
+static int check_narrow(void){
+    // array lengths odd and even, shorter and longer than the blocks and the internal buffer of 4N words
+    const unsigned int sizes[] = {0, 1, 2, 3, N-1, 2*N, 2*N+1, 8*N+5, 9*N+2};
+    const unsigned int nsizes = sizeof(sizes)/sizeof(sizes[0]);
+    rng_state_t *S = rng_alloc(), *T = rng_alloc(), *U = rng_alloc();
+    uint32_t *u = (uint32_t*)malloc((9*N+2)*sizeof(uint32_t)), u2[2];
+    float *f = (float*)malloc((9*N+2)*sizeof(float)), f2[2];
+    double *d = (double*)malloc((9*N+2)*sizeof(double));
+    int errors = 0;
+    unsigned int s, k, h;
+    myuint w = 0;
+    seed_uniquestream(S, 0, 0, 1, 5);
+    seed_uniquestream(T, 0, 0, 1, 5);
+    seed_uniquestream(U, 0, 0, 1, 5);
+    for (s=0; s<nsizes; s++){
+        // two 30-bit halves of a word, the low one first; for an odd length the last word gives only its low half
+        fill_array_uint32x2(S, sizes[s], u);
+        for (k=0; k<sizes[s]; k++){
+            if (k % 2 == 0) { w = get_next(T); }
+            if (u[k] != (uint32_t)((w >> (k % 2 ? 30 : 0)) & 0x3FFFFFFF)) errors++;
+        }
+        // the top 24 bits of each half
+        fill_array_floatx2(S, sizes[s], f);
+        for (k=0; k<sizes[s]; k++){
+            if (k % 2 == 0) { w = get_next(T); }
+            h = (unsigned int)((w >> (k % 2 ? 30 : 0)) & 0x3FFFFFFF);
+            if (f[k] != (float)(h >> 6) / 16777216.0f) errors++;
+        }
+        // the top 53 of 61 bits
+        fill_array_double53(S, sizes[s], d);
+        for (k=0; k<sizes[s]; k++){ if (d[k] != (double)(get_next(T) >> 8) / 9007199254740992.0) errors++; }
+    }
+    errors += compare_next(S, T, N+1);   // the arrays took as many words as they should
+    // one word a call
+    seed_uniquestream(T, 0, 0, 1, 5);
+    for (k=0; k<3*N; k++){
+        get_next_uint32x2(U, u2); w = get_next(T);
+        if (u2[0] != (uint32_t)(w & 0x3FFFFFFF) || u2[1] != (uint32_t)((w >> 30) & 0x3FFFFFFF)) errors++;
+        get_next_floatx2(U, f2); w = get_next(T);
+        if (f2[0] != (float)((w >> 6) & 0xFFFFFF) / 16777216.0f || f2[1] != (float)((w >> 36) & 0xFFFFFF) / 16777216.0f) errors++;
+        if (get_next_double53(U) != (double)(get_next(T) >> 8) / 9007199254740992.0) errors++;
+    }
+    printf("N=%d: fill_array_uint32x2, fill_array_floatx2, fill_array_double53 %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    rng_free(S); rng_free(T); rng_free(U);
+    free(u); free(f); free(d);
+    return errors;
+}
+
+static void time_discard(int count){
+    rng_state_t *S = rng_alloc();
+    double t;
+    int k;
+    seed_uniquestream(S, 0, 0, 1, 11);
+    t = seconds();
+    for (k=0; k<count; k++){ rng_discard(S, 1000000000000ULL + k); }
+    t = seconds() - t;
+    printf("rng_discard(10^12): %.1f us (%d)\n", 1e6*t/count, (int)(get_next(S) & 1));
+    rng_free(S);
+}
+
+int main(){
+    int errors = 0;
+    errors += check_discard();
+    errors += check_uniquestreams();
+    errors += check_narrow();
+    time_discard(100);
+    time_uniquestreams(1000);
+    return errors ? 1 : 0;
+}
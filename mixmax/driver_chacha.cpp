@@ -0,0 +1,85 @@
+/*
+ *  MIXMAX - the time of mixmax_engine next to ChaCha, the stream cipher as an engine,
+ *  from ../include/ext/chacha_engine.h, i.e. what it costs for the numbers to be secure
+ *
+ *  Both make the same numbers by fill() as by repeated calls, which is checked first.
+ *  MIXMAX gives 61 bits a number and ChaCha 32, so the times are compared per 32-bit
+ *  number, MIXMAX by fill_uint32x2 (two 30-bit halves), and per double in [0,1),
+ *  MIXMAX by fill_canonical and ChaCha by two words a double.
+ *
+ *      ./chacha [count]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <chrono>
+#include <vector>
+
+#include "mixmax.hpp"
+#include <ext/chacha_engine.h>
+
+template <typename F>
+double ns_per_number(F fill, std::size_t count, std::size_t chunk){
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k+=chunk){ fill(); }
+    return 1e9*std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count()/count;
+}
+
+template <typename Engine>
+int check_chacha(){
+    int errors = 0;
+    Engine bulk, ref;
+    std::vector<std::uint32_t> u(1003);
+    for (std::size_t n : {std::size_t(3), std::size_t(200), u.size()}){
+        bulk.fill(u.data(), n);
+        for (std::size_t k=0; k<n; k++){ if (u[k] != ref()) errors++; }
+    }
+    return errors;
+}
+
+template <typename Engine>
+void time_chacha(const char* name, std::size_t count, double mixmax_u32, double mixmax_dbl){
+    Engine gen;
+    std::vector<std::uint32_t> u(1 << 14);
+    std::vector<double> d(1 << 14);
+    std::uint32_t acc = 0;
+    double u32 = ns_per_number([&]{ gen.fill(u.data(), u.size()); acc ^= u[7]; }, count, u.size());
+    double dbl = ns_per_number([&]{
+        gen.fill(u.data(), u.size());
+        for (std::size_t k=0; k<u.size()/2; k++){
+            std::uint64_t w = (std::uint64_t(u[2*k+1]) << 32 | u[2*k]) >> 11;
+            d[k] = double(w)*0x1.0p-53;
+        }
+        acc ^= (std::uint32_t)(d[7]*1e9); }, count, u.size()/2);
+    printf("  %-18s %6.2f ns/uint32 (%4.1fx MIXMAX N=240), %6.2f ns/double (%4.1fx)  [%u]\n", name,
+           u32, u32/mixmax_u32, dbl, dbl/mixmax_dbl, acc & 1);
+}
+
+template <int N>
+void time_mixmax(std::size_t count, double& u32, double& dbl){
+    mixmax_engine<N> gen(0, 0, 1, 7);
+    std::vector<std::uint32_t> u(1 << 14);
+    std::vector<double> d(1 << 14);
+    std::uint32_t acc = 0;
+    u32 = ns_per_number([&]{ gen.fill_uint32x2(u.data(), u.size()); acc ^= u[7]; }, count, u.size());
+    dbl = ns_per_number([&]{ gen.fill_canonical(d.data(), d.size()); acc ^= (std::uint32_t)(d[7]*1e9); },
+                        count, d.size());
+    printf("  MIXMAX N=%-9d %6.2f ns/uint32,                      %6.2f ns/double         [%u]\n", N,
+           u32, dbl, acc & 1);
+}
+
+int main(int argc, char* argv[]){
+    std::size_t count = (argc > 1) ? std::strtoull(argv[1], 0, 10) : (std::size_t(1) << 26);
+    int errors = check_chacha<__gnu_cxx::chacha8>() + check_chacha<__gnu_cxx::chacha12>()
+               + check_chacha<__gnu_cxx::chacha20>();
+    printf("ChaCha fill against operator(): %s (%d mismatches)\n", errors ? "FAILED" : "ok", errors);
+
+    double u32, dbl, u32_17, dbl_17;
+    time_mixmax<240>(count, u32, dbl);
+    time_mixmax<17>(count, u32_17, dbl_17);
+    time_chacha<__gnu_cxx::chacha8>("ChaCha8", count, u32, dbl);
+    time_chacha<__gnu_cxx::chacha12>("ChaCha12", count, u32, dbl);
+    time_chacha<__gnu_cxx::chacha20>("ChaCha20", count, u32, dbl);
+    return errors ? 1 : 0;
+}
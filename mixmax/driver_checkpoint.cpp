@@ -0,0 +1,140 @@
+/*
+ *  MIXMAX - check the binary checkpoints and the text state of mixmax_engine
+ *
+ *  saved, loaded and mapped engines must continue exactly where the originals were,
+ *  and a mapped file must hold the advanced engines after sync_states and unmap_states; a header whose count
+ *  does not match the size of the file must be refused before anything is allocated.
+ *  With an argument, also loads a file of four states written by rng_save_states (testIO, N=240)
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <sstream>
+#include <vector>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "mixmax.hpp"
+
+// whether f(), run in a child process, exits with the given MIXMAX error code
+template <typename F>
+bool exits_with(int code, F f){
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0){
+        freopen("/dev/null", "w", stderr);
+        f();
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == (code & 0xFF);
+}
+
+int check_forged_count(){
+    // a valid file of two states whose header then claims 2^60 of them, and one claiming 3
+    int errors = 0;
+    std::vector<mixmax_engine<17>> two(2);
+    mixmax_engine<17>::save_states("forged.bin", two.data(), 2);
+    for (uint64_t count : {uint64_t(1) << 60, uint64_t(3)}){
+        FILE* f = fopen("forged.bin", "r+b");
+        fseek(f, offsetof(mixmax_state_header, count), SEEK_SET);
+        fwrite(&count, sizeof(count), 1, f);
+        fclose(f);
+        if (!exits_with(ERROR_READING_STATE_FILE, []{ mixmax_engine<17>::load_states("forged.bin"); })) errors++;
+        if (!exits_with(ERROR_READING_STATE_FILE, []{ std::size_t n; mixmax_engine<17>::map_states("forged.bin", n); })) errors++;
+    }
+    remove("forged.bin");
+    printf("forged counts: %s (%d mismatches)\n", errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+int check_checkpoint(std::size_t count){
+    typedef mixmax_engine<N> engine;
+    int errors = 0;
+    std::vector<engine> orig(count);
+    engine::seed_uniquestreams(orig.data(), count, 0, 0, 1, 0);
+    for (std::size_t s=0; s<count; s++){ orig[s].discard(s % (2*N)); }   // the counters differ
+
+    engine::save_states("checkpoint.bin", orig.data(), count);
+    std::vector<engine> loaded = engine::load_states("checkpoint.bin");
+    if (loaded.size() != count) errors++;
+    for (std::size_t s=0; s<count && s<loaded.size(); s++){ if (loaded[s] != orig[s]) errors++; }
+
+    std::size_t mapped_count = 0;
+    engine* mapped = engine::map_states("checkpoint.bin", mapped_count);
+    if (mapped_count != count) errors++;
+    for (std::size_t s=0; s<mapped_count; s++){
+        for (int k=0; k<N+3; k++){ if (mapped[s]() != orig[s]()) errors++; }   // advance in the file
+    }
+    engine::sync_states(mapped, mapped_count);   // a valid checkpoint while still mapped
+    loaded = engine::load_states("checkpoint.bin");
+    for (std::size_t s=0; s<count; s++){ if (loaded[s] != orig[s]) errors++; }
+    for (std::size_t s=0; s<mapped_count; s++){ if (mapped[s]() != orig[s]()) errors++; }
+    engine::unmap_states(mapped, mapped_count);
+    loaded = engine::load_states("checkpoint.bin");
+    for (std::size_t s=0; s<count; s++){
+        if (loaded[s] != orig[s]) errors++;
+        for (int k=0; k<3; k++){ if (loaded[s]() != orig[s]()) errors++; }
+    }
+
+    // text round trip, and a corrupted text must not change the engine
+    std::stringstream ss;
+    ss << orig[0];
+    engine text;
+    ss >> text;
+    if (!ss || text != orig[0] || text() != orig[0]()) errors++;
+    std::stringstream bad("1 2 3");
+    engine before = text;
+    bad >> text;
+    if (!bad.fail() || text != before) errors++;
+
+    remove("checkpoint.bin");
+    printf("N=%d, %zu engines: %s (%d mismatches)\n", N, count, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+int check_c_file(const char filename[]){
+    // the streams of driver_iotest.c, each advanced by 7*i+3 numbers
+    int errors = 0;
+    std::vector<mixmax_engine<240>> loaded = mixmax_engine<240>::load_states(filename);
+    if (loaded.size() != 4) errors++;
+    for (std::size_t i=0; i<loaded.size(); i++){
+        mixmax_engine<240> ref(0, 0, 1, i);
+        ref.discard(7*i + 3);
+        for (int k=0; k<480; k++){ if (loaded[i]() != ref()) errors++; }
+    }
+    printf("%s from the C library: %s (%d mismatches)\n", filename, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+void time_checkpoint(std::size_t count){
+    std::vector<mixmax_engine<240>> engines(count);
+    mixmax_engine<240>::seed_uniquestreams(engines.data(), count, 0, 0, 1, 0);
+    auto t0 = std::chrono::steady_clock::now();
+    mixmax_engine<240>::save_states("checkpoint.bin", engines.data(), count);
+    auto t1 = std::chrono::steady_clock::now();
+    std::vector<mixmax_engine<240>> loaded = mixmax_engine<240>::load_states("checkpoint.bin");
+    auto t2 = std::chrono::steady_clock::now();
+    std::size_t n = 0;
+    mixmax_engine<240>* mapped = mixmax_engine<240>::map_states("checkpoint.bin", n);
+    auto t3 = std::chrono::steady_clock::now();
+    mixmax_engine<240>::unmap_states(mapped, n);
+    remove("checkpoint.bin");
+    printf("N=240, %zu engines: save %.2f ms, load %.2f ms, map %.2f ms\n", count,
+           1e3*std::chrono::duration<double>(t1 - t0).count(), 1e3*std::chrono::duration<double>(t2 - t1).count(),
+           1e3*std::chrono::duration<double>(t3 - t2).count());
+}
+
+int main(int argc, char* argv[]){
+    int errors = 0;
+    errors += check_checkpoint<17>(100);
+    errors += check_checkpoint<240>(37);
+    errors += check_checkpoint<256>(5);
+    errors += check_forged_count();
+    if (argc > 1) { errors += check_c_file(argv[1]); }
+    time_checkpoint(10000);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,52 @@
+/*
+ *  MIXMAX - check and time discard() of mixmax_engine
+ *
+ *  discard(n) must leave the generator exactly where n calls of get_next() would,
+ *  from any position inside a block and for n on and off the block boundaries
+ */
+
+#include <cstdio>
+#include <chrono>
+
+#include "mixmax.hpp"
+
+template <int N>
+int check_discard(){
+    int errors = 0;
+    mixmax_engine<N> jump(0, 0, 1, 3), ref(0, 0, 1, 3);
+    for (unsigned long long n : {0ULL, 1ULL, 2ULL, 5ULL, (unsigned long long)(N-3), (unsigned long long)(N-2), (unsigned long long)(N-1),
+                                 (unsigned long long)N, (unsigned long long)(2*N-2), (unsigned long long)(2*N+7), 1000ULL, 12345ULL}){
+        jump.discard(n);
+        for (unsigned long long k=0; k<n; k++){ ref.get_next(); }
+        for (int k=0; k<3; k++){ if (jump.get_next() != ref.get_next()) errors++; }   // lands on a different offset each time
+    }
+    // 2^64 + 2^64 by halves, and 2^63 + 2^63 + 2^64 in one go, must agree
+    mixmax_engine<N> a(0, 0, 1, 3), b(0, 0, 1, 3);
+    a.get_next(); b.get_next();
+    a.discard(1ULL << 63); a.discard(1ULL << 63); a.discard128(1, 0);
+    b.discard128(2, 0);
+    for (int k=0; k<2*N; k++){ if (a.get_next() != b.get_next()) errors++; }
+    printf("N=%d: %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+void time_discard(){
+    mixmax_engine<N> gen(0, 0, 1, 3);
+    gen.discard(1);  // the characteristic polynomial is found on first use
+    auto t0 = std::chrono::steady_clock::now();
+    gen.discard(~0ULL);
+    auto t1 = std::chrono::steady_clock::now();
+    printf("N=%d: discard(2^64-1) %.3f ms\n", N, 1e3*std::chrono::duration<double>(t1 - t0).count());
+}
+
+int main(){
+    int errors = 0;
+    errors += check_discard<8>();
+    errors += check_discard<17>();
+    errors += check_discard<240>();
+    errors += check_discard<256>();
+    time_discard<17>();
+    time_discard<240>();
+    return errors ? 1 : 0;
+}
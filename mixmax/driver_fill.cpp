@@ -0,0 +1,93 @@
+/*
+ *  MIXMAX - check and time the bulk fill functions of mixmax_engine
+ *
+ *  fill() and fill_canonical() must give the same numbers as repeated get_next()
+ *  and get_next_float(), also when they start or stop in the middle of a block;
+ *  the narrow fills the same numbers as repeated get_next_uint32x2(), get_next_floatx2()
+ *  and get_next_double53(), which must be in range
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <chrono>
+#include <vector>
+
+#include "mixmax.hpp"
+
+template <int N>
+int check_fill(){
+    int errors = 0;
+    mixmax_engine<N> bulk(0, 0, 1, 7), ref(0, 0, 1, 7);
+    std::vector<myuint> u(5*N + 11);
+    std::vector<double> d(5*N + 11);
+    std::vector<float> f(5*N + 11);
+    for (std::size_t n : {std::size_t(3), std::size_t(N-1), std::size_t(N), u.size(), std::size_t(1), std::size_t(2*N-2)}){
+        bulk.fill(u.data(), n);
+        for (std::size_t k=0; k<n; k++){ if (u[k] != ref.get_next()) errors++; }
+        bulk.fill_canonical(d.data(), n);
+        for (std::size_t k=0; k<n; k++){ if (d[k] != ref.get_next_float()) errors++; }
+        bulk.fill_canonical(f.data(), n);
+        for (std::size_t k=0; k<n; k++){ if (f[k] != float(ref.get_next_float()) || f[k] <= 0.0f || f[k] > 1.0f) errors++; }
+    }
+    std::vector<std::uint32_t> i32(5*N + 11);
+    for (std::size_t n : {std::size_t(3), std::size_t(2*N-1), std::size_t(2*N-2), i32.size(), std::size_t(1), std::size_t(4)}){
+        std::uint32_t pi[2];
+        float pf[2];
+        bulk.fill_uint32x2(i32.data(), n);
+        for (std::size_t k=0; k<n; k+=2){
+            ref.get_next_uint32x2(pi);
+            for (std::size_t j=0; j<2 && k+j<n; j++){ if (i32[k+j] != pi[j] || pi[j] >= (1u << 30)) errors++; }
+        }
+        bulk.fill_floatx2(f.data(), n);
+        for (std::size_t k=0; k<n; k+=2){
+            ref.get_next_floatx2(pf);
+            for (std::size_t j=0; j<2 && k+j<n; j++){ if (f[k+j] != pf[j] || pf[j] < 0.0f || pf[j] >= 1.0f) errors++; }
+        }
+        bulk.fill_double53(d.data(), n);
+        for (std::size_t k=0; k<n; k++){
+            double x = ref.get_next_double53();
+            if (d[k] != x || x < 0.0 || x >= 1.0) errors++;
+        }
+    }
+#if __cplusplus > 201703L && __has_include(<span>)
+    bulk.fill(std::span<std::uint64_t>(u));
+    for (std::size_t k=0; k<u.size(); k++){ if (u[k] != ref.get_next()) errors++; }
+#endif
+    if (bulk.get_next() != ref.get_next()) errors++;
+    printf("N=%d: %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+void time_fill(std::size_t count, std::size_t batch){
+    mixmax_engine<N> gen(0, 0, 1, 7);
+    std::vector<double> d(batch);
+    double acc = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k++){ acc += gen.get_next_float(); }
+    auto t1 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k+=batch){ gen.fill_canonical(d.data(), batch); acc += d[0]; }
+    auto t2 = std::chrono::steady_clock::now();
+    printf("N=%d: get_next_float %.2f ns/number, fill_canonical(%zu) %.2f ns/number (%g)\n", N,
+           1e9*std::chrono::duration<double>(t1 - t0).count()/count, batch,
+           1e9*std::chrono::duration<double>(t2 - t1).count()/count, acc > 0 ? 1.0 : 0.0);
+    std::vector<float> f(batch);
+    auto t3 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k+=batch){ gen.fill_canonical(f.data(), batch); acc += f[0]; }
+    auto t4 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k+=batch){ gen.fill_floatx2(f.data(), batch); acc += f[0]; }
+    auto t5 = std::chrono::steady_clock::now();
+    printf("N=%d: fill_canonical(float) %.2f ns/number, fill_floatx2 %.2f ns/number (%g)\n", N,
+           1e9*std::chrono::duration<double>(t4 - t3).count()/count,
+           1e9*std::chrono::duration<double>(t5 - t4).count()/count, acc > 0 ? 1.0 : 0.0);
+}
+
+int main(){
+    int errors = 0;
+    errors += check_fill<17>();
+    errors += check_fill<240>();
+    errors += check_fill<256>();
+    time_fill<240>(1 << 26, 10000);
+    time_fill<240>(1 << 26, 1000000);
+    return errors ? 1 : 0;
+}
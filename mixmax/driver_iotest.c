@@ -25,6 +25,29 @@ int main( int argc,  char *argv[] ){
     }
     printf("State Reading Test ok\n");
 
+    // binary checkpoint of several streams, which must continue where they left off
+    rng_state_t* S[4];
+    rng_state_t* T[4];
+    for(i=0;i<4;i++){
+        S[i] = rng_alloc(); T[i] = rng_alloc();
+        seed_uniquestream(S[i], 0, 0, 1, i);
+        int k;
+        for(k=0;k<7*i+3;k++){ get_next(S[i]); }
+    }
+    rng_save_states("states1.bin", S, 4);
+    rng_load_states("states1.bin", T, 4);
+    for(i=0;i<4;i++){
+        int k;
+        for(k=0;k<2*N;k++){
+            if (get_next(S[i]) != get_next(T[i])) {
+                printf("Binary State Error: stream %d differs after %d numbers\n", i, k);
+                exit(-1);
+            }
+        }
+        rng_free(S[i]); rng_free(T[i]);
+    }
+    printf("Binary State Test ok\n");
+
     rng_free(X);
     rng_free(Y);
 	return 0;
@@ -0,0 +1,78 @@
+/*
+ *  MIXMAX - check and time the multi-lane engine against the scalar one
+ *
+ *  every lane of mixmax_engine_x<N,L> must give exactly the numbers of a scalar
+ *  mixmax_engine<N> seeded with the same IDs, whatever the order of consumption
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
+#include <vector>
+
+#include "mixmax.hpp"
+
+template <int N, int L>
+int check_lanes(){
+    typedef mixmax_engine_x<N, L> engine_x;
+    int errors = 0;
+    std::vector<mixmax_engine<N>> ref;
+    for (int l=0; l<L; l++){ ref.emplace_back(0, 0, 1, 100 + l); }
+    engine_x* X = new engine_x(0, 0, 1, 100);
+
+    // round robin, one number per lane at a time
+    for (int k=0; k<5*N; k++){
+        for (int l=0; l<L; l++){ if (X->lane(l)() != ref[l]()) errors++; }
+    }
+    // one lane runs ahead of the others
+    for (int k=0; k<3*N; k++){ if (X->get_next(0) != ref[0]()) errors++; }
+    // the lanes left behind read from their carry, which get_lane must hand over too
+    for (int l=1; l<L; l++){
+        mixmax_engine<N> e = X->get_lane(l), r = ref[l];
+        if (e != r) errors++;
+        for (int k=0; k<2*N; k++){ if (e() != r()) errors++; }
+    }
+    for (int l=1; l<L; l++){ if (X->get_next(l) != ref[l]()) errors++; }
+    // bulk, of sizes that do and do not line up with the blocks
+    std::vector<myuint> out(7*L*N + 3);
+    for (std::size_t n : {std::size_t(L*(N-1)), std::size_t(5), out.size(), std::size_t(3*L)}){
+        X->fill_interleaved(out.data(), n);
+        for (std::size_t k=0; k<n; k++){ if (out[k] != ref[k % L]()) errors++; }
+    }
+    for (int l=0; l<L; l++){ if (X->get_next(l) != ref[l]()) errors++; }
+
+    printf("N=%d, L=%d: %s (%d mismatches)\n", N, L, errors ? "FAILED" : "ok", errors);
+    delete X;
+    return errors;
+}
+
+template <int N, int L>
+void time_lanes(std::size_t count){
+    std::vector<myuint> out(1 << 16);
+    mixmax_engine<N> scalar(0, 0, 1, 100);
+    myuint acc = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k++){ acc += scalar.get_next(); }
+    auto t1 = std::chrono::steady_clock::now();
+    mixmax_engine_x<N, L>* X = new mixmax_engine_x<N, L>(0, 0, 1, 100);
+    for (std::size_t k=0; k<count; k+=out.size()){ X->fill_interleaved(out.data(), out.size()); acc += out[k % out.size()]; }
+    auto t2 = std::chrono::steady_clock::now();
+    double ts = std::chrono::duration<double>(t1 - t0).count(), tx = std::chrono::duration<double>(t2 - t1).count();
+    printf("N=%d: scalar get_next %.2f ns/number, %d lanes fill_interleaved %.2f ns/number (%llu)\n",
+           N, 1e9*ts/count, L, 1e9*tx/count, (unsigned long long)(acc & 1));
+    delete X;
+}
+
+int main(){
+    int errors = 0;
+    errors += check_lanes<17, 4>();
+    errors += check_lanes<240, 4>();
+    errors += check_lanes<256, 4>();
+    errors += check_lanes<17, 8>();
+    errors += check_lanes<240, 8>();
+    errors += check_lanes<256, 8>();
+    time_lanes<240, 4>(1 << 26);
+    time_lanes<240, 8>(1 << 26);
+    time_lanes<17, 8>(1 << 26);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,72 @@
+/*
+ *  MIXMAX - check and time the lazy mode against get_next
+ *
+ *  get_next_lazy must give exactly the numbers of get_next, also after rng_lazy_sync
+ *  in the middle of a block, and the first call of a block must cost about as much as the others
+ */
+
+#define _POSIX_C_SOURCE 199309L   // clock_gettime
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "mixmax.h"
+
+static double seconds(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+static int check_lazy(void){
+    int errors = 0, k, i;
+    rng_state_t *S = rng_alloc(), *T = rng_alloc();
+    rng_lazy_t L;
+    seed_uniquestream(S, 0, 0, 1, 7);
+    seed_uniquestream(T, 0, 0, 1, 7);
+    rng_lazy_init(&L, T);
+    for (k=0; k<5*N+3; k++){ if (get_next_lazy(&L) != get_next(S)) errors++; }
+    for (k=0; k<3*N; k++){ if (get_next_float_lazy(&L) != get_next_float(S)) errors++; }
+    // sync in the middle of a block, then the state must be usable by the ordinary functions
+    for (i=1; i<N+5; i+=N/3+1){
+        for (k=0; k<i; k++){ if (get_next_lazy(&L) != get_next(S)) errors++; }
+        rng_lazy_sync(&L);
+        if (T->sumtot != S->sumtot || T->counter != S->counter) errors++;
+        for (k=0; k<N; k++){ if (T->V[k] != S->V[k]) errors++; }
+        for (k=0; k<N+1; k++){ if (get_next(T) != get_next(S)) errors++; }
+        rng_lazy_init(&L, T);
+    }
+    for (k=0; k<2*N; k++){ if (get_next_lazy(&L) != get_next(S)) errors++; }
+    printf("N=%d: %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    rng_free(S); rng_free(T);
+    return errors;
+}
+
+static void time_lazy(int blocks){
+    // the mean time of the first call of a block, and of the other calls, timer included
+    rng_state_t *S = rng_alloc(), *T = rng_alloc();
+    rng_lazy_t L;
+    double first[2] = {0, 0}, rest[2] = {0, 0}, t;
+    myuint acc = 0;
+    int b, i;
+    seed_uniquestream(S, 0, 0, 1, 7);
+    seed_uniquestream(T, 0, 0, 1, 7);
+    rng_lazy_init(&L, T);
+    for (i=S->counter; i<N; i++){ acc += get_next(S) + get_next_lazy(&L); }
+    for (b=0; b<blocks; b++){
+        for (i=1; i<N; i++){
+            t = seconds(); acc += get_next(S); t = seconds() - t;
+            if (i == 1) first[0] += t; else rest[0] += t;
+            t = seconds(); acc += get_next_lazy(&L); t = seconds() - t;
+            if (i == 1) first[1] += t; else rest[1] += t;
+        }
+    }
+    printf("get_next:      first of block %6.1f ns, others %6.1f ns\n", 1e9*first[0]/blocks, 1e9*rest[0]/blocks/(N-2));
+    printf("get_next_lazy: first of block %6.1f ns, others %6.1f ns (%d)\n", 1e9*first[1]/blocks, 1e9*rest[1]/blocks/(N-2), (int)(acc & 1));
+    rng_free(S); rng_free(T);
+}
+
+int main(){
+    int errors = check_lazy();
+    time_lazy(20000);
+    return errors ? 1 : 0;
+}
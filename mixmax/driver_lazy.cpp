@@ -0,0 +1,68 @@
+/*
+ *  MIXMAX - check and time the lazy mode of mixmax_engine against get_next
+ *
+ *  the lazy view must give exactly the numbers of get_next, also after sync() in the middle of a
+ *  block and when the view goes out of scope, and the first call of a block must cost about as much as the others
+ */
+
+#include <cstdio>
+#include <chrono>
+
+#include "mixmax.hpp"
+
+template <int N>
+int check_lazy(){
+    typedef mixmax_engine<N> engine;
+    int errors = 0;
+    engine S(0, 0, 1, 7), T(0, 0, 1, 7);
+    {
+        typename engine::lazy_engine L = T.lazy();
+        for (int k=0; k<5*N+3; k++){ if (L() != S()) errors++; }
+        for (int k=0; k<3*N; k++){ if (L.get_next_float() != S.get_next_float()) errors++; }
+        // sync in the middle of a block, then the engine must be usable by its ordinary functions
+        for (int i=1; i<N+5; i+=N/3+1){
+            for (int k=0; k<i; k++){ if (L() != S()) errors++; }
+            L.sync();
+            if (T != S) errors++;
+            for (int k=0; k<N+1; k++){ if (T() != S()) errors++; }
+        }
+        for (int k=0; k<2*N; k++){ if (L() != S()) errors++; }
+    }
+    // the view has completed the block as it went out of scope
+    if (T != S) errors++;
+    for (int k=0; k<N+1; k++){ if (T() != S()) errors++; }
+    printf("N=%d: %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+void time_lazy(int blocks){
+    // the mean time of the first call of a block, and of the other calls, timer included
+    typedef std::chrono::steady_clock clock;
+    mixmax_engine<N> S(0, 0, 1, 7), T(0, 0, 1, 7);
+    typename mixmax_engine<N>::lazy_engine L = T.lazy();
+    double first[2] = {0, 0}, rest[2] = {0, 0};
+    myuint acc = 0;
+    for (int i=1; i<N; i++){ acc += S() + L(); }
+    for (int b=0; b<blocks; b++){
+        for (int i=1; i<N; i++){
+            auto t0 = clock::now(); acc += S(); auto t1 = clock::now();
+            acc += L(); auto t2 = clock::now();
+            double ts = std::chrono::duration<double>(t1 - t0).count(), tl = std::chrono::duration<double>(t2 - t1).count();
+            if (i == 1) { first[0] += ts; first[1] += tl; } else { rest[0] += ts; rest[1] += tl; }
+        }
+    }
+    printf("N=%d get_next:  first of block %6.1f ns, others %6.1f ns\n", N, 1e9*first[0]/blocks, 1e9*rest[0]/blocks/(N-2));
+    printf("N=%d lazy():    first of block %6.1f ns, others %6.1f ns (%d)\n", N, 1e9*first[1]/blocks, 1e9*rest[1]/blocks/(N-2), (int)(acc & 1));
+}
+
+int main(){
+    int errors = 0;
+    errors += check_lazy<8>();
+    errors += check_lazy<17>();
+    errors += check_lazy<240>();
+    errors += check_lazy<256>();
+    time_lazy<240>(20000);
+    time_lazy<17>(200000);
+    return errors ? 1 : 0;
+}
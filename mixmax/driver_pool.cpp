@@ -0,0 +1,113 @@
+/*
+ *  MIXMAX - check the pool of per-thread engines
+ *
+ *  every thread gets its own engine, the same one on every call, on cache lines of its own;
+ *  together they are the streams firstStreamID, firstStreamID+1, ... of seed_uniquestream,
+ *  carried into runID past 2^32-1.  A thread keeps its engines of pools evicted from its cache,
+ *  and a pool whose 128-bit stream IDs run out exits with STREAM_IDS_EXHAUSTED
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include <algorithm>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "mixmax.hpp"
+
+// whether f(), run in a child process, exits with the given MIXMAX error code
+template <typename F>
+bool exits_with(int code, F f){
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0){
+        freopen("/dev/null", "w", stderr);
+        f();
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == (code & 0xFF);
+}
+
+template <int N>
+int check_pool(int nthreads, myID_t first){
+    int errors = 0;
+    std::vector<mixmax_engine<N>*> got(nthreads);
+    std::atomic<int> again(0);
+    {
+        mixmax_pool<N> pool(0, 0, 1, first);
+        std::vector<std::thread> threads;
+        for (int t=0; t<nthreads; t++){
+            threads.emplace_back([&, t](){
+                mixmax_engine<N>& e = pool.local();
+                if (&pool.local() != &e) again++;
+                got[t] = &e;
+            });
+        }
+        for (auto& t : threads){ t.join(); }
+        errors += again;
+        if (pool.streams() != (std::uint64_t)nthreads) errors++;
+
+        // which stream each engine has is up to the scheduler, but together they are the first nthreads
+        std::vector<int> found(nthreads, 0);
+        for (int t=0; t<nthreads; t++){
+            if ((std::uintptr_t)got[t] % (2*mixmax_pool<N>::LINE) != 0) errors++;
+            for (int k=0; k<nthreads; k++){
+                myuint c = (myuint)first + k;
+                mixmax_engine<N> ref(0, 0, (myID_t)(1 + (c >> 32)), (myID_t)c);
+                if (*got[t] == ref) found[k]++;
+            }
+        }
+        for (int k=0; k<nthreads; k++){ if (found[k] != 1) errors++; }
+        mixmax_engine<N>& mine = pool.local();     // the main thread gets the next one
+        myuint c = (myuint)first + nthreads;
+        if (mine != mixmax_engine<N>(0, 0, (myID_t)(1 + (c >> 32)), (myID_t)c)) errors++;
+    }
+    printf("N=%d, %d threads from stream %u: %s (%d mismatches)\n", N, nthreads, first, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+int check_cache(){
+    // more pools than the cache holds, visited round robin, and engines acquired by hand in between
+    typedef mixmax_pool<17> pool_t;
+    int errors = 0, npools = 3*pool_t::CACHE;
+    std::vector<std::unique_ptr<pool_t>> pools;
+    std::vector<mixmax_engine<17>*> first;
+    for (int p=0; p<npools; p++){
+        pools.emplace_back(new pool_t(0, 0, 2, 0));
+        first.push_back(&pools[p]->local());
+    }
+    for (int round=0; round<3; round++){
+        for (int p=0; p<npools; p++){
+            if (&pools[p]->local() != first[p]) errors++;
+            for (int k=0; k<100; k++){ pools[p]->acquire(); }
+        }
+    }
+    for (int p=0; p<npools; p++){ if (pools[p]->streams() != 301) errors++; }
+    // a thread that returns to a destroyed pool's place in its cache gets a new engine
+    pools[0].reset(new pool_t(0, 0, 2, 0));
+    if (pools[0]->streams() != 0 || pools[0]->local() != mixmax_engine<17>(0, 0, 2, 0)) errors++;
+
+    // the last two stream IDs, then exhaustion
+    if (!exits_with(STREAM_IDS_EXHAUSTED, []{
+        mixmax_pool<17> last(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE);
+        last.acquire();
+        if (*last.acquire() != mixmax_engine<17>(0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF)) _exit(1);
+        last.acquire();
+    })) errors++;
+    printf("N=17, %d pools through a cache of %d: %s (%d mismatches)\n", npools, pool_t::CACHE, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+int main(){
+    int errors = 0;
+    errors += check_pool<17>(16, 0);
+    errors += check_pool<240>(8, 0xFFFFFFFC);
+    errors += check_pool<256>(4, 7);
+    errors += check_cache();
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,163 @@
+/*
+ *  MIXMAX - check and time the ring of pre-generated numbers
+ *
+ *  the batches taken by all the consumers together must be the numbers of the source
+ *  engine, each exactly once; fallback batches come from the consumers' own engines, of which there
+ *  are more than split() has levels.
+ *  The timing compares the worst case of a batch from the ring with BATCH calls of get_next
+ */
+
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "mixmax.hpp"
+
+// true if f(), run in a child process, exits with code
+template <typename F>
+bool exits_with(int code, F f){
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0){
+        freopen("/dev/null", "w", stderr);
+        f();
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == (code & 0xFF);
+}
+
+template <int N>
+int check_ring(int consumers, std::size_t batches){
+    typedef mixmax_ring<N> ring_t;
+    int errors = 0;
+    mixmax_engine<N> source(0, 0, 1, 9);
+    std::vector<std::vector<myuint>> taken(consumers);
+    {
+        ring_t ring(source, 64);
+        std::atomic<long> left((long)batches);
+        std::vector<std::thread> pool;
+        for (int c=0; c<consumers; c++){
+            pool.emplace_back([&, c](){
+                myuint out[ring_t::BATCH];
+                while (left.fetch_sub(1) > 0){
+                    while (!ring.try_take(out)){ std::this_thread::yield(); }
+                    taken[c].insert(taken[c].end(), out, out + ring_t::BATCH);
+                }
+            });
+        }
+        for (auto& t : pool){ t.join(); }
+        if (ring.stalls() != 0) errors++;
+
+        // an empty ring falls back, and counts it
+        mixmax_engine<N> own = ring.consumer_engine(), ref = own;
+        myuint out[ring_t::BATCH];
+        std::size_t fell = 0;
+        for (int k=0; k<1000; k++){
+            std::uint64_t before = ring.stalls();
+            ring.take(out, own);
+            if (ring.stalls() != before){
+                fell++;
+                for (std::size_t j=0; j<ring_t::BATCH; j++){ if (out[j] != ref()) errors++; }
+            }
+        }
+        if (ring.stalls() != fell) errors++;
+    }
+    std::vector<myuint> all, expect(batches*mixmax_ring<N>::BATCH);
+    for (auto& t : taken){ all.insert(all.end(), t.begin(), t.end()); }
+    source.fill(expect.data(), expect.size());
+    std::sort(all.begin(), all.end());
+    std::sort(expect.begin(), expect.end());
+    if (all != expect) errors++;
+    printf("N=%d, %d consumers: %s (%d mismatches)\n", N, consumers, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+// more consumer engines than split() has levels, from several threads: all different, none of them
+// the ring's, consumer 0 the base split off the source, and an error past the last of a deep source
+template <int N>
+int check_consumers(int nthreads, int per_thread){
+    int errors = 0;
+    mixmax_engine<N> source(0, 0, 1, 9), parent = source, base = parent.split();
+    std::vector<mixmax_engine<N>> got(nthreads*per_thread);
+    {
+        mixmax_ring<N> ring(source, 64);
+        std::vector<std::thread> pool;
+        for (int t=0; t<nthreads; t++){
+            pool.emplace_back([&, t](){
+                for (int k=0; k<per_thread; k++){ got[t*per_thread + k] = ring.consumer_engine(); }
+            });
+        }
+        for (auto& t : pool){ t.join(); }
+    }
+    std::vector<myuint> first;
+    for (auto& e : got){
+        if (e.split_depth() != mixmax_engine<N>::SPLIT_LEVELS) errors++;
+        if (e == base) { base = mixmax_engine<N>(); }   // consumer 0, whichever thread got it
+        first.push_back(e());
+    }
+    if (base != mixmax_engine<N>()) errors++;
+    first.push_back(source());
+    std::sort(first.begin(), first.end());
+    if (std::adjacent_find(first.begin(), first.end()) != first.end()) errors++;
+
+    mixmax_engine<17> deep(0, 0, 1, 9);
+    for (int d=0; d<126; d++){ deep.split(); }   // the base is then of depth 127, with 2 consumer engines
+    if (!exits_with(0, [&deep]{
+        mixmax_ring<17> ring(deep, 64);
+        ring.consumer_engine();
+        ring.consumer_engine();
+    })) errors++;
+    if (!exits_with(STREAM_IDS_EXHAUSTED, [&deep]{
+        mixmax_ring<17> ring(deep, 64);
+        ring.consumer_engine();
+        ring.consumer_engine();
+        ring.consumer_engine();
+    })) errors++;
+    printf("N=%d, %d consumer engines on %d threads: %s (%d mismatches)\n", N, nthreads*per_thread, nthreads,
+           errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+void time_ring(std::size_t count){
+    // the worst and the mean time of one batch, from the ring and from get_next
+    typedef mixmax_ring<N> ring_t;
+    mixmax_engine<N> gen(0, 0, 1, 9);
+    ring_t ring(gen);
+    mixmax_engine<N> own = ring.consumer_engine();
+    while (ring.produced() < 4096){ std::this_thread::yield(); }
+    myuint out[ring_t::BATCH], acc = 0;
+    double worst[2] = {0, 0}, total[2] = {0, 0};
+    for (std::size_t k=0; k<count; k++){
+        auto t0 = std::chrono::steady_clock::now();
+        for (std::size_t j=0; j<ring_t::BATCH; j++){ out[j] = gen.get_next(); }
+        auto t1 = std::chrono::steady_clock::now();
+        acc += out[0];
+        ring.take(out, own);
+        auto t2 = std::chrono::steady_clock::now();
+        acc += out[0];
+        double d[2] = {std::chrono::duration<double>(t1 - t0).count(), std::chrono::duration<double>(t2 - t1).count()};
+        for (int m=0; m<2; m++){ worst[m] = std::max(worst[m], d[m]); total[m] += d[m]; }
+    }
+    printf("N=%d, batches of %zu: get_next mean %.0f ns, worst %.0f ns; ring mean %.0f ns, worst %.0f ns, %llu stalls (%llu)\n",
+           N, ring_t::BATCH, 1e9*total[0]/count, 1e9*worst[0], 1e9*total[1]/count, 1e9*worst[1],
+           (unsigned long long)ring.stalls(), (unsigned long long)(acc & 1));
+}
+
+int main(){
+    int errors = 0;
+    errors += check_ring<17>(1, 5000);
+    errors += check_ring<240>(3, 20000);
+    errors += check_ring<256>(4, 20000);
+    errors += check_consumers<17>(4, 100);
+    errors += check_consumers<240>(2, 80);
+    time_ring<240>(100000);
+    return errors ? 1 : 0;
+}
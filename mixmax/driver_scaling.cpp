@@ -0,0 +1,197 @@
+/*
+ *  MIXMAX - multi-core scaling of independent streams
+ *
+ *  1, 2, 4, ... up to the maximum number of threads each seed their own engine with
+ *  seed_uniquestream, mixmax_engine<N>(0, 0, 1, thread), and fill a buffer of their own
+ *  with it, chunk numbers at a time; from the first start to the last end, the aggregate
+ *  throughput, and the scaling efficiency, throughput / (threads x throughput of one thread).
+ *  Seeding is timed in each thread, while all of them seed at once.
+ *
+ *  The engines are in one array, either padded to 128 bytes each, two cache lines, so that
+ *  no two threads write the same line, or packed, where neighbouring states share a line at
+ *  their ends; N=17 has the most lines shared.  Threads are unpinned, or pinned one to each
+ *  of the CPUs the process may run on, in order.  Chunks which fit in the L1 or L2 cache
+ *  measure the arithmetic; chunks of many MB per thread the memory bandwidth.
+ *
+ *      ./scaling [N] [numbers per thread] [max threads] [chunk] [pin] [packed]
+ *
+ *  N = 17, 240 or 256; pin and packed add the pinned threads and the packed states to the
+ *  comparison, next to unpinned threads and padded states.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include "mixmax.hpp"
+
+typedef std::chrono::steady_clock bench_clock;
+
+struct run_options {
+    std::size_t numbers = std::size_t(1) << 24;   // per thread
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::size_t chunk = 4096;
+    bool pin = false;
+    bool packed = false;
+};
+
+struct thread_times {
+    double seed;                              // seconds
+    bench_clock::time_point start, end;       // of the generation
+    myuint checksum;
+};
+
+// The CPUs the process may run on, in order; empty where threads cannot be pinned.
+std::vector<int> allowed_cpus(){
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0){
+        for (int c=0; c<CPU_SETSIZE; c++){ if (CPU_ISSET(c, &set)) cpus.push_back(c); }
+    }
+#endif
+    return cpus;
+}
+
+bool pin_this_thread(int cpu){
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+template <int N>
+struct alignas(128) padded_engine {
+    mixmax_engine<N> gen;
+};
+
+// All threads wait here until the last one arrives.
+class spin_barrier {
+    std::atomic<unsigned> arrived{0};
+    unsigned count;
+public:
+    explicit spin_barrier(unsigned n) : count(n) {}
+    void wait(){
+        arrived.fetch_add(1);
+        while (arrived.load() < count){ std::this_thread::yield(); }
+    }
+};
+
+// The seconds of generation, from the first start to the last end; times[t] per thread.
+template <int N, typename Slot>
+double run_threads(const run_options& opt, unsigned nthreads, bool pinned, const std::vector<int>& cpus,
+                   std::vector<thread_times>& times){
+    std::vector<Slot> engines(nthreads);
+    times.assign(nthreads, thread_times());
+    spin_barrier seeded(nthreads), go(nthreads);
+    auto worker = [&](unsigned t){
+        if (pinned){ pin_this_thread(cpus[t % cpus.size()]); }
+        std::vector<myuint> buf(opt.chunk);
+        mixmax_engine<N>* gen;
+        if constexpr (std::is_same<Slot, padded_engine<N>>::value) gen = &engines[t].gen; else gen = &engines[t];
+        seeded.wait();
+        auto s0 = bench_clock::now();
+        *gen = mixmax_engine<N>(0, 0, 1, (myID_t)t);
+        times[t].seed = std::chrono::duration<double>(bench_clock::now() - s0).count();
+        go.wait();
+        myuint sum = 0;
+        times[t].start = bench_clock::now();
+        for (std::size_t k=0; k<opt.numbers; k+=opt.chunk){
+            gen->fill(buf.data(), std::min(opt.chunk, opt.numbers - k));
+            sum += buf[0];
+        }
+        times[t].end = bench_clock::now();
+        times[t].checksum = sum;
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t=0; t<nthreads; t++){ pool.emplace_back(worker, t); }
+    for (auto& th : pool){ th.join(); }
+    auto first = std::min_element(times.begin(), times.end(),
+                                  [](const thread_times& a, const thread_times& b){ return a.start < b.start; })->start;
+    auto last = std::max_element(times.begin(), times.end(),
+                                 [](const thread_times& a, const thread_times& b){ return a.end < b.end; })->end;
+    return std::chrono::duration<double>(last - first).count();
+}
+
+template <int N, typename Slot>
+void scaling(const run_options& opt, bool pinned, const std::vector<int>& cpus){
+    printf("N=%d, %zu numbers per thread in chunks of %zu, %s threads, %s states (%zu bytes each)\n",
+           N, opt.numbers, opt.chunk, pinned ? "pinned" : "unpinned",
+           std::is_same<Slot, padded_engine<N>>::value ? "padded" : "packed", sizeof(Slot));
+    printf("  threads   Gnumbers/s     GB/s   efficiency   seed us/thread (max)\n");
+    std::vector<unsigned> counts;
+    for (unsigned t=1; t<opt.max_threads; t*=2){ counts.push_back(t); }
+    counts.push_back(opt.max_threads);
+
+    double single = 0;
+    std::vector<thread_times> times;
+    for (unsigned nthreads : counts){
+        double seconds = run_threads<N, Slot>(opt, nthreads, pinned, cpus, times);
+        double rate = double(nthreads)*opt.numbers/seconds;
+        if (nthreads == 1){ single = rate; }
+        double seed_sum = 0, seed_max = 0;
+        for (const auto& t : times){ seed_sum += t.seed; seed_max = std::max(seed_max, t.seed); }
+        printf("  %7u   %10.3f   %6.2f   %10.2f   %8.1f (%.1f)\n", nthreads, rate*1e-9, rate*8e-9,
+               rate/(nthreads*single), 1e6*seed_sum/nthreads, 1e6*seed_max);
+    }
+}
+
+template <int N>
+void run_all(const run_options& opt){
+    mixmax_engine<N> warm(0, 0, 0, 1);   // tables built on first use are not timed
+    const std::vector<int> cpus = allowed_cpus();
+    std::vector<bool> pinnings{false};
+    if (opt.pin){
+        if (cpus.empty()) { printf("threads cannot be pinned here\n"); }
+        else { pinnings.push_back(true); }
+    }
+    for (bool pinned : pinnings){
+        scaling<N, padded_engine<N>>(opt, pinned, cpus);
+        if (opt.packed){ scaling<N, mixmax_engine<N>>(opt, pinned, cpus); }
+    }
+}
+
+int main(int argc, char* argv[]){
+    run_options opt;
+    int n = 240;
+    int positional = 0;
+    for (int i=1; i<argc; i++){
+        if (strcmp(argv[i], "pin") == 0) { opt.pin = true; }
+        else if (strcmp(argv[i], "packed") == 0) { opt.packed = true; }
+        else {
+            switch (positional++){
+                case 0: n = atoi(argv[i]); break;
+                case 1: opt.numbers = std::strtoull(argv[i], 0, 10); break;
+                case 2: opt.max_threads = (unsigned)atoi(argv[i]); break;
+                case 3: opt.chunk = std::strtoull(argv[i], 0, 10); break;
+            }
+        }
+    }
+    if (opt.max_threads == 0 || opt.chunk == 0){ n = 0; }
+    switch (n){
+        case 17:  run_all<17>(opt); break;
+        case 240: run_all<240>(opt); break;
+        case 256: run_all<256>(opt); break;
+        default:
+            fprintf(stderr, "usage: %s [N] [numbers per thread] [max threads] [chunk] [pin] [packed], with N = 17, 240 or 256\n",
+                    argv[0]);
+            return 1;
+    }
+    return 0;
+}
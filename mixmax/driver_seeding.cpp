@@ -0,0 +1,70 @@
+/*
+ *  MIXMAX - check and time seeding of many streams
+ *
+ *  seed_uniquestreams() must give every engine exactly the state of the four-ID
+ *  constructor, whatever the number of threads, also when the stream ID carries into runID
+ */
+
+#include <cstdio>
+#include <chrono>
+#include <vector>
+
+#include "mixmax.hpp"
+
+template <int N>
+int check_seeding(){
+    int errors = 0;
+    const std::size_t count = 37;
+    const myID_t first = 0xFFFFFFF0u;
+    for (unsigned nthreads : {1u, 3u, 8u}){
+        std::vector<mixmax_engine<N>> batch(count);
+        mixmax_engine<N>::seed_uniquestreams(batch.data(), count, 5, 1, 2, first, nthreads);
+        for (std::size_t k=0; k<count; k++){
+            unsigned long long s = first + (unsigned long long)k;
+            mixmax_engine<N> ref(5, 1, 2 + (myID_t)(s >> 32), (myID_t)s);
+            for (int i=0; i<N+3; i++){ if (batch[k]() != ref()) errors++; }
+        }
+    }
+    printf("N=%d: %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+void time_seeding(std::size_t count, unsigned nthreads){
+    std::vector<mixmax_engine<N>> engines(count);
+    mixmax_engine<N> warm(0, 0, 0, 1);   // tables built on first use are not timed
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k++){ engines[k] = mixmax_engine<N>(0, 0, 1, 0x9E3779B9u * (myID_t)(k+1)); }
+    auto t1 = std::chrono::steady_clock::now();
+    mixmax_engine<N>::seed_uniquestreams(engines.data(), count, 0, 0, 1, 0, nthreads);
+    auto t2 = std::chrono::steady_clock::now();
+    printf("N=%d: constructor %.1f us/stream, seed_uniquestreams with %u threads %.1f us/stream\n", N,
+           1e6*std::chrono::duration<double>(t1 - t0).count()/count, nthreads,
+           1e6*std::chrono::duration<double>(t2 - t1).count()/count);
+}
+
+template <int N>
+void time_latency(std::size_t count){
+    // one stream at a time with few set ID bits, where fetching the skip table is most of the cost
+    mixmax_engine<N> gen(0, 0, 0, 1);
+    myuint acc = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t k=0; k<count; k++){ gen.seed((myuint)1 << (k % 64)); acc += gen(); }
+    auto t1 = std::chrono::steady_clock::now();
+    printf("N=%d: seed with one set bit %.1f us (%llu)\n", N, 1e6*std::chrono::duration<double>(t1 - t0).count()/count, (unsigned long long)(acc & 1));
+}
+
+int main(){
+    int errors = 0;
+    errors += check_seeding<17>();
+    errors += check_seeding<60>();
+    errors += check_seeding<240>();
+    errors += check_seeding<256>();
+    time_seeding<240>(500, 1);
+    time_seeding<240>(500, 4);
+    time_seeding<17>(10000, 1);
+    time_latency<17>(100000);
+    time_latency<240>(2000);
+    time_latency<256>(2000);
+    return errors ? 1 : 0;
+}
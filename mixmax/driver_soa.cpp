@@ -0,0 +1,70 @@
+/*
+ *  MIXMAX - check and time the structure-of-arrays pool of small-N streams
+ *
+ *  every stream must give exactly the numbers of its own mixmax_engine, drawn one at a time,
+ *  all together with get_next_all, or mixed, and a partial iterate must not lose them their lockstep for good
+ */
+
+#include <cstdio>
+#include <chrono>
+#include <vector>
+
+#include "mixmax.hpp"
+
+template <int N>
+int check_soa(std::size_t count){
+    int errors = 0;
+    mixmax_soa<N> pool(count, 0, 0, 1, 0xFFFFFFF0);    // across the carry into runID
+    std::vector<mixmax_engine<N>> ref;
+    for (std::size_t s=0; s<count; s++){
+        myuint c = 0xFFFFFFF0ULL + s;
+        ref.emplace_back(0, 0, (myID_t)(1 + (c >> 32)), (myID_t)c);
+    }
+    std::vector<myuint> out(count);
+    auto all = [&](int rounds){
+        for (int k=0; k<rounds; k++){
+            pool.get_next_all(out.data());
+            for (std::size_t s=0; s<count; s++){ if (out[s] != ref[s]()) errors++; }
+        }
+    };
+    all(3*(N-1));                          // in lockstep, to the end of a block
+    pool.iterate(0, count/2);              // half of them a block early, which loses nothing here,
+    all(2*(N-1));                          // then back in step
+    pool.iterate();
+    all(N+5);
+    for (std::size_t s=0; s<count; s+=3){  // out of step
+        for (std::size_t k=0; k<s%(2*N); k++){ if (pool.get_next(s) != ref[s]()) errors++; }
+    }
+    all(3*N);
+    for (std::size_t s=0; s<count; s++){ if (pool.get_stream(s) != ref[s]) errors++; }
+    printf("N=%d, %zu streams: %s (%d mismatches)\n", N, count, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+void time_soa(std::size_t count, int rounds){
+    mixmax_soa<N> pool(count, 0, 0, 1, 0);
+    std::vector<mixmax_engine<N>> engines(count);
+    mixmax_engine<N>::seed_uniquestreams(engines.data(), count, 0, 0, 1, 0);
+    std::vector<myuint> out(count);
+    myuint acc = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int r=0; r<rounds; r++){ for (std::size_t s=0; s<count; s++){ acc += engines[s](); } }
+    auto t1 = std::chrono::steady_clock::now();
+    for (int r=0; r<rounds; r++){ pool.get_next_all(out.data()); acc += out[r % count]; }
+    auto t2 = std::chrono::steady_clock::now();
+    double n = double(count)*rounds;
+    printf("N=%d, %zu streams: engines %zu bytes each, %.2f ns/number; soa %zu bytes each, %.2f ns/number (%llu)\n", N, count,
+           sizeof(mixmax_engine<N>), 1e9*std::chrono::duration<double>(t1 - t0).count()/n,
+           (N+1)*sizeof(myuint) + 1, 1e9*std::chrono::duration<double>(t2 - t1).count()/n, (unsigned long long)(acc & 1));
+}
+
+int main(){
+    int errors = 0;
+    errors += check_soa<8>(1000);
+    errors += check_soa<17>(1001);
+    errors += check_soa<60>(70);
+    time_soa<17>(1 << 20, 64);
+    time_soa<8>(1 << 20, 64);
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,96 @@
+/*
+ *  MIXMAX - check and time seed_spbox_many against seed_spbox
+ *
+ *  every state must be exactly the one seed_spbox makes from the same seed.  Timed twice: many states,
+ *  which are written to memory, and a few states seeded over and over in the cache, where the interleaved
+ *  LCGs of seed_spbox_many are not held back by the memory, and over batches which outgrow the cache, where
+ *  seed_spbox_many of N=240 or 256 falls back to seed_spbox
+ */
+
+#define _POSIX_C_SOURCE 199309L   // clock_gettime
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "mixmax.h"
+
+static double seconds(void){
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+static void time_cached(unsigned int count, int rounds){
+    rng_state_t* S = calloc(count, sizeof(rng_state_t));
+    rng_state_t** X = malloc(count*sizeof(rng_state_t*));
+    myuint* seeds = malloc(count*sizeof(myuint));
+    unsigned int k;
+    int r;
+    for (k=0; k<count; k++){ X[k] = S + k; seeds[k] = k + 1; }
+    double t0 = seconds();
+    for (r=0; r<rounds; r++){ for (k=0; k<count; k++){ seed_spbox(S + k, seeds[k] + r); } }
+    double t1 = seconds();
+    for (r=0; r<rounds; r++){ seeds[0] += 1; seed_spbox_many(X, count, seeds); }
+    double t2 = seconds();
+    printf("%u states in cache: seed_spbox %.1f ns/state, seed_spbox_many %.1f ns/state\n", count,
+           1e9*(t1-t0)/count/rounds, 1e9*(t2-t1)/count/rounds);
+    free(S); free(X); free(seeds);
+}
+
+static void time_crossover(void){
+    // the states written to memory as the batch outgrows the cache: seed_spbox, seed_spbox_many, and the batch
+    // 4 states at a time throughout, by seed_spbox_many on chunks small enough never to fall back
+    unsigned int counts[] = {1024, 4096, 16384, 65536}, chunk = 1024, c, k;
+    printf("states      kB  seed_spbox  seed_spbox_many  4 at a time  (ns/state)\n");
+    for (c=0; c<sizeof(counts)/sizeof(counts[0]); c++){
+        unsigned int count = counts[c];
+        int r, rounds = (int)(20000000.0/((double)count*N)) + 1;
+        rng_state_t* S = calloc(count, sizeof(rng_state_t));
+        rng_state_t** X = malloc(count*sizeof(rng_state_t*));
+        myuint* seeds = malloc(count*sizeof(myuint));
+        for (k=0; k<count; k++){ X[k] = S + k; seeds[k] = k + 1; seed_spbox(S + k, 1); }   // fault the pages in first
+        double t0 = seconds();
+        for (r=0; r<rounds; r++){ for (k=0; k<count; k++){ seed_spbox(S + k, seeds[k] + r); } }
+        double t1 = seconds();
+        for (r=0; r<rounds; r++){ seeds[0] += 1; seed_spbox_many(X, count, seeds); }
+        double t2 = seconds();
+        for (r=0; r<rounds; r++){ seeds[0] += 1; for (k=0; k<count; k+=chunk){ seed_spbox_many(X + k, chunk, seeds + k); } }
+        double t3 = seconds();
+        printf("%6u %7.0f  %10.1f  %15.1f  %11.1f\n", count, count*sizeof(rng_state_t)/1024.0,
+               1e9*(t1-t0)/count/rounds, 1e9*(t2-t1)/count/rounds, 1e9*(t3-t2)/count/rounds);
+        free(S); free(X); free(seeds);
+    }
+}
+
+int main(int argc, char *argv[]){
+    unsigned int count = (argc > 1) ? (unsigned int)atoi(argv[1]) : 100003, k;
+    int i, errors = 0;
+    rng_state_t* S = calloc(count, sizeof(rng_state_t));
+    rng_state_t* T = calloc(count, sizeof(rng_state_t));
+    rng_state_t** X = malloc(count*sizeof(rng_state_t*));
+    myuint* seeds = malloc(count*sizeof(myuint));
+    for (k=0; k<count; k++){ X[k] = T + k; seeds[k] = 0x9E3779B97F4A7C15ULL*(k+1) ^ (k >> 3); }
+
+    memset(S, 0, count*sizeof(rng_state_t));   // the pages are touched before the timing
+    memset(T, 0, count*sizeof(rng_state_t));
+
+    double t0 = seconds();
+    for (k=0; k<count; k++){ seed_spbox(S + k, seeds[k]); }
+    double t1 = seconds();
+    seed_spbox_many(X, count, seeds);
+    double t2 = seconds();
+
+    for (k=0; k<count; k++){
+        if (S[k].sumtot != T[k].sumtot || S[k].counter != T[k].counter) errors++;
+        for (i=0; i<N; i++){ if (S[k].V[i] != T[k].V[i]) errors++; }
+    }
+    for (k=0; k<count; k+=count/7+1){
+        for (i=0; i<3*N; i++){ if (get_next(S + k) != get_next(T + k)) errors++; }
+    }
+    printf("N=%d, %u states: %s (%d mismatches)\n", N, count, errors ? "FAILED" : "ok", errors);
+    printf("seed_spbox %.1f ns/state, seed_spbox_many %.1f ns/state\n", 1e9*(t1-t0)/count, 1e9*(t2-t1)/count);
+    free(S); free(T); free(X); free(seeds);
+    time_cached(64, 20000000/(64*N) + 1);
+    time_crossover();
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+/*
+ *  MIXMAX - check and time split() of mixmax_engine
+ *
+ *  the child of a split at depth 0 is the stream advanced by 2^511 iterations, so splitting
+ *  that child again, at depth 0, must give the next stream of seed_uniquestream;
+ *  the depth is carried by the child and by the text state, and the parent is left where it was;
+ *  a split past SPLIT_LEVELS must exit with SPLIT_TOO_DEEP.
+ *  The timing of a fork-join tree reports whether a split fits a per-task budget, but does not fail on it
+ */
+
+#include <cstdio>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "mixmax.hpp"
+
+// whether f(), run in a child process, exits with the given MIXMAX error code
+template <typename F>
+bool exits_with(int code, F f){
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0){
+        freopen("/dev/null", "w", stderr);
+        f();
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == (code & 0xFF);
+}
+
+template <int N>
+int check_split(){
+    typedef mixmax_engine<N> engine;
+    int errors = 0;
+    engine parent(0, 0, 1, 5), copy(0, 0, 1, 5), next(0, 0, 1, 6);
+    engine child = parent.split();
+    if (parent != copy || parent.split_depth() != 1 || child.split_depth() != 1) errors++;
+    if (child == parent) errors++;
+
+    // the text state carries the depth, so a restored parent splits off the same next child as the original
+    std::stringstream ss;
+    ss << parent;
+    engine restored;
+    ss >> restored;
+    if (!ss || restored.split_depth() != 1 || restored != parent) errors++;
+    engine second = parent.split(), second_restored = restored.split();
+    if (second_restored != second || second_restored == child || second_restored.split_depth() != 2) errors++;
+
+    // the child's state at depth 0 is half of the way to the next stream
+    std::string text = (std::ostringstream() << child).str();
+    if (text.substr(text.size() - 2) != " 1") errors++;
+    std::istringstream top_text(text.substr(0, text.size() - 2) + " 0");
+    engine half;
+    top_text >> half;
+    if (half.split_depth() != 0 || half != child) errors++;
+    engine jumped = half.split();
+    if (jumped != next) errors++;
+    for (int k=0; k<2*N; k++){ if (jumped() != next()) errors++; }
+
+    // a chain of splits goes one level deeper each time
+    engine e(0, 0, 1, 5);
+    for (int d=0; d<40; d++){ e = e.split(); }
+    if (e.split_depth() != 40) errors++;
+    for (int d=40; d<engine::SPLIT_LEVELS; d++){ e = e.split(); }
+    if (!exits_with(SPLIT_TOO_DEEP, [&e]{ e.split(); })) errors++;
+
+    printf("N=%d: %s (%d mismatches)\n", N, errors ? "FAILED" : "ok", errors);
+    return errors;
+}
+
+template <int N>
+void time_split(int depth, int count){
+    // a fork-join tree, flattened: a root split depth levels deep, many times over
+    mixmax_engine<N> root(0, 0, 1, 5);
+    root.split();     // builds the table of jumps
+    myuint acc = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n=0; n<count; n++){
+        mixmax_engine<N> e(root);
+        for (int d=0; d<depth; d++){ e = e.split(); }
+        acc += e();
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    printf("N=%d: split %.2f us each, to depth %d (%llu)\n", N,
+           1e6*std::chrono::duration<double>(t1 - t0).count()/(double(count)*depth), depth, (unsigned long long)(acc & 1));
+}
+
+template <int N>
+myuint run_task(mixmax_engine<N>& e, int levels){
+    // a task that forks until levels is 0, then draws a few numbers of its own
+    if (levels == 0){
+        myuint acc = 0;
+        for (int k=0; k<16; k++){ acc += e(); }
+        return acc;
+    }
+    mixmax_engine<N> child = e.split();
+    return run_task(child, levels - 1) + run_task(e, levels - 1);
+}
+
+template <int N>
+bool time_tree(int start_depth, int levels, double budget_us){
+    // a whole fork-join tree of 2^levels tasks whose root is already start_depth levels deep;
+    // each task costs one split, which should fit in budget_us
+    mixmax_engine<N> root(0, 0, 1, 5);
+    for (int d=0; d<start_depth; d++){ root = root.split(); }
+    auto t0 = std::chrono::steady_clock::now();
+    myuint acc = run_task(root, levels);
+    auto t1 = std::chrono::steady_clock::now();
+    double tasks = double(1 << levels) - 1, us = 1e6*std::chrono::duration<double>(t1 - t0).count()/tasks;
+    bool met = us <= budget_us;
+    printf("N=%d: fork-join tree of %.0f splits, depth %d to %d: %.2f us per split, %.2e splits/s, budget %.1f us %s (%llu)\n",
+           N, tasks, start_depth, start_depth + levels, us, 1e6/us, budget_us, met ? "met" : "NOT met", (unsigned long long)(acc & 1));
+    return met;
+}
+
+int main(){
+    int errors = 0;
+    errors += check_split<17>();
+    errors += check_split<240>();
+    errors += check_split<256>();
+    time_split<17>(32, 10000);
+    time_split<240>(32, 100);
+    // the engine for splitting is N=17; N=240 is shown against the same budget, for scale
+    time_tree<17>(14, 18, 2.0);
+    time_tree<240>(14, 8, 2.0);
+    return errors ? 1 : 0;
+}
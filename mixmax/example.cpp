@@ -34,7 +34,8 @@
 #include "mixmax.hpp"										
 
 int main() {
-	mixmax_engine gen{0,0,0,1};		// Create a Mixmax object and initialize the RNG with four 32-bit seeds 0,0,0,1
+	mixmax_engine<240> gen{0,0,0,1};		// Create a Mixmax object and initialize the RNG with four 32-bit seeds 0,0,0,1
+	mixmax_engine<17> small{0,0,0,1};	// generators with different N can live side by side
 
     //gen.seed(1234567890);  // another way to seed, required by std::random
 
@@ -45,6 +46,7 @@ int main() {
             "Working in the Galois field with modulus 2^%u-1\n"
             "Generator class size is %lu bytes\n\n",
             gen.rng_get_N(), gen.rng_get_SPECIAL(), gen.rng_get_SPECIALMUL(), 61, sizeof(gen));
+    fprintf(stderr,"A generator with N=%u has class size %lu bytes\n\n", small.rng_get_N(), sizeof(small));
 
         gen.print_state();
     
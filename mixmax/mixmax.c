@@ -26,6 +26,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 
 #define __MIXMAX_C  // do NOT define it in your own program, just include mixmax.h
 
@@ -134,6 +135,124 @@ void iterate_and_fill_array(rng_state_t* X, double *array){
     X->sumtot = MOD_MERSENNE(MOD_MERSENNE(sumtot) + (ovflow <<3 ));
 }
 
+static void fill_words(rng_state_t* X, unsigned int n, myuint *out){
+    // the words of n calls of get_next, copied a block at a time
+    unsigned int k = 0;
+    while (k < n){
+        if (X->counter > N-1){
+            X->sumtot = iterate_raw_vec(X->V, X->sumtot);
+            X->counter = 1;
+        }
+        while (X->counter <= N-1 && k < n){ out[k++] = X->V[X->counter++]; }
+    }
+}
+
+#define SPLIT_UINT32X2(x, out) { (out)[0] = (uint32_t)((x) & 0x3FFFFFFF); (out)[1] = (uint32_t)(((x) >> 30) & 0x3FFFFFFF); }
+#define SPLIT_FLOATX2(x, out) { (out)[0] = (float)(int32_t)(((x) >> 6) & 0xFFFFFF) * 0x1p-24f; (out)[1] = (float)(int32_t)(((x) >> 36) & 0xFFFFFF) * 0x1p-24f; }
+#define SPLIT_DOUBLE53(x, out) { (out)[0] = (double)(int64_t)((x) >> 8) * 0x1p-53; }
+
+void get_next_uint32x2(rng_state_t* X, uint32_t out[2]){
+    myuint x = GET_BY_MACRO(X);
+    SPLIT_UINT32X2(x, out);
+}
+
+void get_next_floatx2(rng_state_t* X, float out[2]){
+    myuint x = GET_BY_MACRO(X);
+    SPLIT_FLOATX2(x, out);
+}
+
+double get_next_double53(rng_state_t* X){
+    double d;
+    myuint x = GET_BY_MACRO(X);
+    SPLIT_DOUBLE53(x, &d);
+    return d;
+}
+
+#define FILL_SPLIT(type, perword, SPLIT) \
+{ myuint buf[4*N];                \
+  unsigned int w, words;          \
+  while (n >= perword){           \
+      words = n/perword;          \
+      if (words > 4*N) { words = 4*N; } \
+      fill_words(X, words, buf);  \
+      for (w=0; w<words; w++){ SPLIT(buf[w], array + w*perword); } \
+      array += words*perword;     \
+      n -= words*perword;         \
+  }                               \
+  if (n > 0){                     \
+      type tail[perword];         \
+      myuint x = GET_BY_MACRO(X); \
+      SPLIT(x, tail);             \
+      for (w=0; w<n; w++){ array[w] = tail[w]; } \
+  } }
+
+void fill_array_uint32x2(rng_state_t* X, unsigned int n, uint32_t *array){
+    FILL_SPLIT(uint32_t, 2, SPLIT_UINT32X2)
+}
+
+void fill_array_floatx2(rng_state_t* X, unsigned int n, float *array){
+    FILL_SPLIT(float, 2, SPLIT_FLOATX2)
+}
+
+void fill_array_double53(rng_state_t* X, unsigned int n, double *array){
+    FILL_SPLIT(double, 1, SPLIT_DOUBLE53)
+}
+
+void rng_lazy_init(rng_lazy_t* L, rng_state_t* X){
+    L->X = X;
+    L->next = N;     // the block in X is complete
+}
+
+static void lazy_step(rng_lazy_t* L){
+    // one turn of the loop of iterate_raw_vec, for i = L->next
+    myuint* Y = L->X->V;
+    int i = L->next++;
+#if (SPECIALMUL!=0)
+    myuint tempPO = MULWU(L->tempP);
+    L->tempP = modadd(L->tempP, Y[i]);
+    L->tempV = MOD_MERSENNE(L->tempV + L->tempP + tempPO);
+#else
+    L->tempP = modadd(L->tempP, Y[i]);
+    L->tempV = modadd(L->tempV, L->tempP);
+#endif
+    Y[i] = L->tempV;
+    L->sumtot += L->tempV; if (L->sumtot < L->tempV) {L->ovflow++;}
+#if (SPECIAL!=0)
+    if (i == 2){     // the correction iterate_raw_vec makes after the loop, known since the start of the block
+        myuint temp2 = MOD_MULSPEC(L->temp2);
+        Y[2] = modadd(Y[2], temp2);
+        L->sumtot += temp2; if (L->sumtot < temp2) {L->ovflow++;}
+    }
+#endif
+    if (L->next == N){ L->X->sumtot = MOD_MERSENNE(MOD_MERSENNE(L->sumtot) + (L->ovflow <<3 )); }
+}
+
+myuint get_next_lazy(rng_lazy_t* L){
+    rng_state_t* X = L->X;
+    int i = X->counter;
+    if (i > N-1){    // start the next block, without computing any of it
+        L->temp2 = X->V[1];
+        X->V[0] = L->tempV = L->sumtot = X->sumtot;
+        L->tempP = 0;
+        L->ovflow = 0;
+        L->next = 1;
+        i = 1;
+    }
+    if (i == L->next){ lazy_step(L); }
+    X->counter = i+1;
+    return X->V[i];
+}
+
+double get_next_float_lazy(rng_lazy_t* L){
+    int64_t Z = (int64_t)get_next_lazy(L);
+    double F = Z;
+    return F*INV_MERSBASE;
+}
+
+void rng_lazy_sync(rng_lazy_t* L){
+    while (L->next < N){ lazy_step(L); }
+}
+
 myuint modadd(myuint foo, myuint bar){
 #if (defined(__x86_64__) || defined(__i386__)) &&  defined(__GNUC__) && defined(USE_INLINE_ASM)
 //#warning Using assembler routine in modadd
@@ -225,6 +344,72 @@ void seed_spbox(rng_state_t* X, myuint seed)
     X->sumtot = MOD_MERSENNE(MOD_MERSENNE(sumtot) + (ovflow <<3 ));
 }
 
+#define SPBOX_LANES 4
+#ifndef SPBOX_MANY_CACHE_BYTES
+#define SPBOX_MANY_CACHE_BYTES (4 << 20)   // above this, a batch of large states is seeded one state at a time
+#endif
+
+static void seed_spbox_lanes(rng_state_t* X[], int m, const myuint seeds[])
+{
+	// the LCGs of SPBOX_LANES seeds are stepped together, independent chains the compiler interleaves,
+	// each writing straight into its state; four chains, their pointers and constants fit in the registers
+	const myuint MULT64=6364136223846793005ULL;
+	myuint l[SPBOX_LANES];
+	myuint* V[SPBOX_LANES];
+	myuint dummy[N];
+	int i, j;
+	for (j=0; j<SPBOX_LANES; j++){
+		l[j] = (j < m) ? seeds[j] : 1;
+		V[j] = (j < m) ? X[j]->V : dummy;
+	}
+	for (i=0; i < N; i++){
+		for (j=0; j<SPBOX_LANES; j++){
+			l[j]*=MULT64; l[j] = (l[j] << 32) ^ (l[j]>>32);
+			V[j][i] = l[j] & MERSBASE;
+		}
+	}
+	for (j=0; j<m; j++){
+		// the sum of seed_spbox, wrapped to 64 bits with its count of overflows, from sums of the 32-bit halves,
+		// which cannot overflow and which the compiler vectorizes
+		myuint lo=0, hi=0, sumtot, ovflow;
+		for (i=0; i < N; i++){ lo += X[j]->V[i] & 0xFFFFFFFF; hi += X[j]->V[i] >> 32; }
+		sumtot = lo + (hi << 32);
+		ovflow = (hi >> 32) + (sumtot < lo);
+		if (X[j]->fh==NULL){X[j]->fh=stdout;}
+		X[j]->counter = N;
+		X[j]->sumtot = MOD_MERSENNE(MOD_MERSENNE(sumtot) + (ovflow <<3 ));
+	}
+}
+
+void seed_spbox_many(rng_state_t* X[], unsigned int count, const myuint seeds[])
+{
+	long b;
+	unsigned int k;
+	for (k=0; k<count; k++){
+		if (seeds[k] == 0){
+			fprintf(stderr, " try seeding with nonzero seed next time! (seeds[%u] is zero)\n", k);
+			exit(SEED_WAS_ZERO);
+		}
+	}
+	// Four states of N=240 or 256 are four write streams 2 kB apart, and once the batch no longer fits in the
+	// cache they are slower than the one stream of seed_spbox, 700 against 530 ns a state at 10^5 states;
+	// the four states of N=17 make one short stream, and keep their gain
+	if (N > 64 && (double)count*sizeof(rng_state_t) > SPBOX_MANY_CACHE_BYTES){
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+		for (b=0; b<(long)count; b++){ seed_spbox(X[b], seeds[b]); }
+		return;
+	}
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+	for (b=0; b<(long)count; b+=SPBOX_LANES){
+		int m = ((long)count - b < SPBOX_LANES) ? (int)(count - b) : SPBOX_LANES;
+		seed_spbox_lanes(X + b, m, seeds + b);
+	}
+}
+
 myuint precalc(rng_state_t* X){
 	int i;
 	myuint temp;
@@ -345,10 +530,287 @@ cum[i] =  fmodmulM61( cum[i], coeff ,  Y[i] ) ; \
 } }
 
 
+static myuint canonical61(myuint x){
+    x = MOD_MERSENNE(MOD_MERSENNE(x));
+    return (x >= M61) ? x - M61 : x;
+}
+
+static myuint states_checksum(rng_state_t* X[], unsigned int count){
+    myuint sum = 0;
+    unsigned int k;
+    for (k=0; k<count; k++){
+        sum = canonical61(sum + canonical61(X[k]->sumtot));
+        sum = canonical61(sum + (myuint)X[k]->counter);
+    }
+    return sum;
+}
+
+void rng_save_states(const char filename[], rng_state_t* X[], unsigned int count){
+    struct mixmax_state_header hdr;
+    int32_t depth = 0;   // the split depth of mixmax_engine, which the C library does not have
+    unsigned int k;
+    int ok;
+    FILE* fout;
+    memcpy(hdr.magic, "MIXMAXST", 8);
+    hdr.version = 1;
+    hdr.dim = N;
+    hdr.special = (int64_t)(SPECIAL);
+    hdr.count = count;
+    hdr.checksum = states_checksum(X, count);
+    if( !( fout = fopen(filename, "wb") ) ){
+        fprintf(stderr, "mixmax -> rng_save_states: cannot open file %s for writing\n", filename);
+        exit(ERROR_READING_STATE_FILE);
+    }
+    ok = fwrite(&hdr, sizeof(hdr), 1, fout) == 1;
+    for (k=0; ok && k<count; k++){
+        int32_t counter = X[k]->counter;
+        ok = fwrite(X[k]->V, sizeof(myuint), N, fout) == N
+          && fwrite(&X[k]->sumtot, sizeof(myuint), 1, fout) == 1
+          && fwrite(&counter, sizeof(counter), 1, fout) == 1
+          && fwrite(&depth, sizeof(depth), 1, fout) == 1;
+    }
+    if (fclose(fout) != 0 || !ok){
+        fprintf(stderr, "mixmax -> rng_save_states: error writing file %s\n", filename);
+        exit(ERROR_READING_STATE_FILE);
+    }
+}
+
+void rng_load_states(const char filename[], rng_state_t* X[], unsigned int count){
+    struct mixmax_state_header hdr;
+    int32_t depth;
+    unsigned int k;
+    int i;
+    FILE* fin;
+    if( !( fin = fopen(filename, "rb") ) || fread(&hdr, sizeof(hdr), 1, fin) != 1 ){
+        fprintf(stderr, "mixmax -> rng_load_states: error reading file %s\n", filename);
+        exit(ERROR_READING_STATE_FILE);
+    }
+    if (memcmp(hdr.magic, "MIXMAXST", 8) != 0 || hdr.version != 1 || hdr.dim != N || hdr.special != (int64_t)(SPECIAL)){
+        fprintf(stderr, "mixmax -> rng_load_states: %s is not a version 1 state file for N=%u and SPECIAL=%lld\n",
+                filename, N, (long long)(SPECIAL));
+        exit(ERROR_READING_STATE_FORMAT);
+    }
+    if (hdr.count < count){
+        fprintf(stderr, "mixmax -> rng_load_states: file %s holds %llu states, not %u\n", filename, (unsigned long long)hdr.count, count);
+        exit(ERROR_READING_STATE_FILE);
+    }
+    for (k=0; k<count; k++){
+        int32_t counter;
+        myuint sumtot;
+        if (fread(X[k]->V, sizeof(myuint), N, fin) != N || fread(&sumtot, sizeof(myuint), 1, fin) != 1
+            || fread(&counter, sizeof(counter), 1, fin) != 1 || fread(&depth, sizeof(depth), 1, fin) != 1){
+            fprintf(stderr, "mixmax -> rng_load_states: error reading state %u from file %s\n", k, filename);
+            exit(ERROR_READING_STATE_FILE);
+        }
+        if (counter < 1 || counter > N){
+            fprintf(stderr, "mixmax -> rng_load_states: invalid counter = %d in state %u, must be 1 <= counter <= %u\n", counter, k, N);
+            exit(ERROR_READING_STATE_COUNTER);
+        }
+        for (i=0; i<N; i++){
+            if (X[k]->V[i] > MERSBASE){
+                fprintf(stderr, "mixmax -> rng_load_states: invalid state vector value in state %u from file %s\n", k, filename);
+                exit(ERROR_READING_STATE_FILE);
+            }
+        }
+        X[k]->counter = counter;
+        precalc(X[k]);
+        if (canonical61(X[k]->sumtot) != canonical61(sumtot)){
+            fprintf(stderr, "mixmax -> rng_load_states: checksum error in state %u from file %s - corrupted?\n", k, filename);
+            exit(ERROR_READING_STATE_CHECKSUM);
+        }
+        X[k]->sumtot = sumtot;
+    }
+    fclose(fin);
+    if (hdr.count == count && states_checksum(X, count) != hdr.checksum){
+        fprintf(stderr, "mixmax -> rng_load_states: checksum error while reading states from file %s - corrupted?\n", filename);
+        exit(ERROR_READING_STATE_CHECKSUM);
+    }
+}
+
+#if defined(__x86_64__)
+typedef __uint128_t accum_t;   // sum of products of 61-bit numbers, reduced only every LAZY terms
+#define LAZY 32                // 32 products < 2^122 and one reduced value fit in 128 bits
+#define MULACC(acc, a, b) ((acc) += (__uint128_t)(a)*(__uint128_t)(b))
+static inline myuint fold128(__uint128_t acc){
+    // unlike mod128, good for the whole 128-bit range: 2^64 = 2^3 and 2^61 = 1 mod M61
+    myuint lo = (myuint)acc, hi = (myuint)(acc >> 64);
+    return MOD_MERSENNE( (lo & M61) + (lo >> BITS) + ((hi << 3) & M61) + (hi >> (BITS-3)) );
+}
+#define FOLD(acc) fold128(acc)
+#else
+typedef myuint accum_t;
+#define LAZY 1
+#define MULACC(acc, a, b) ((acc) = fmodmulM61((acc), (a), (b)))
+#define FOLD(acc) (acc)
+#endif
+
+static myuint dot(const myuint* a, const myuint* b, int n){
+    // sum of a[k]*b[k] mod M61, in [0, M61); the products are summed unreduced, LAZY at a time
+    accum_t acc = 0;
+    int k = 0, stop;
+    for (stop = LAZY; stop < n; stop += LAZY){
+        for (; k<stop; k++){ MULACC(acc, a[k], b[k]); }
+        acc = FOLD(acc);
+    }
+    for (; k<n; k++){ MULACC(acc, a[k], b[k]); }
+    return canonical61(FOLD(acc));
+}
+
+static myuint apply_poly(myuint* Y, myuint sumtot, const myuint* coeff){
+    // replaces Y by P(A) Y, where P has the N coefficients coeff, low to high; returns the new sumtot
+    accum_t cum[N];
+    int i,j;
+    for (i=0; i<N; i++){ cum[i] = 0; }
+    for (j=0; j<N; j++){              // j is lag, enumerates terms of the poly
+        // for zero lag Y is already given
+        for (i =0; i<N; i++){
+            MULACC( cum[i], coeff[j] ,  Y[i] ) ; // same coeff for all i
+        }
+        if (j % LAZY == LAZY-1) { for (i=0; i<N; i++){ cum[i] = FOLD(cum[i]); } }
+        sumtot = iterate_raw_vec(Y, sumtot);
+    }
+    sumtot=0;
+    for (i=0; i<N; i++){ Y[i] = canonical61(FOLD(cum[i])); sumtot = modadd( sumtot, Y[i]); } ;
+    return sumtot;
+}
+
+/*
+ Jumping ahead by an arbitrary number of steps.
+ 
+ n iterations of the MIXMAX matrix A are the matrix x^n(A) = R(A), where R = x^n mod p and p is the
+ characteristic polynomial of A (Cayley-Hamilton).  R is found by square-and-multiply in O(N^2 log n)
+ and applied to the state with apply_poly in O(N^2).  This needs no skip tables, so it works for any N.
+ */
+
+static myuint inverse61(myuint a){
+    // a^(M61-2), by Fermat
+    myuint r = 1, e = M61 - 2;
+    while (e){
+        if (e & 1) { r = canonical61(fmodmulM61(0, r, a)); }
+        a = canonical61(fmodmulM61(0, a, a));
+        e >>= 1;
+    }
+    return r;
+}
+
+static const myuint* charpoly(void){
+    /* p is irreducible, so it is also the minimal polynomial of the sequence of any one component
+       of A^k v, v != 0; it is recovered from 2N terms with the Berlekamp-Massey algorithm, once per thread */
+    static __thread myuint P[N+1];
+    static __thread int found = 0;
+    if (found) { return P; }
+    
+    myuint s[2*N], C[2*N+1], B[2*N+1], T[2*N+1], Y[N];
+    myuint sumtot = 1, b = 1, d, neg;
+    int i, k, n, L = 0, m = 1, grow;
+    for (i=0; i<N; i++){ Y[i] = 0; }
+    Y[0] = 1;
+    for (k=0; k<2*N; k++){
+        s[k] = canonical61(Y[1]);
+        sumtot = iterate_raw_vec(Y, sumtot);
+    }
+    for (i=0; i<=2*N; i++){ C[i] = B[i] = 0; }
+    C[0] = B[0] = 1;
+    for (n=0; n<2*N; n++){
+        d = s[n];
+        for (i=1; i<=L; i++){ d = fmodmulM61(d, C[i], s[n-i]); }
+        d = canonical61(d);
+        if (d == 0) { m++; continue; }
+        neg = M61 - canonical61(fmodmulM61(0, d, inverse61(b)));
+        grow = (2*L <= n);
+        if (grow) { for (i=0; i<=2*N; i++){ T[i] = C[i]; } }
+        for (i=0; i+m<=2*N; i++){ C[i+m] = canonical61(fmodmulM61(C[i+m], neg, B[i])); }
+        if (grow) { L = n+1-L; for (i=0; i<=2*N; i++){ B[i] = T[i]; } b = d; m = 1; } else { m++; }
+    }
+    if (L != N){
+        fprintf(stderr, "mixmax -> charpoly: characteristic polynomial of degree %d instead of %d\n", L, N);
+        exit(ERROR_CHARPOLY_DEGREE);
+    }
+    for (k=0; k<=N; k++){ P[k] = C[N-k]; }  // monic, low to high
+    found = 1;
+    return P;
+}
+
+static void polymulmod(myuint* r, const myuint* a, const myuint* b){
+    // r = a*b mod p, r may alias a or b; each coefficient of the product is one dot product
+    const myuint* P = charpoly();
+    myuint brev[N], neg;
+    accum_t prod[2*N-1];
+    int i,j,k,lo,hi;
+    for (i=0; i<N; i++){ brev[i] = b[N-1-i]; }
+    for (k=0; k<2*N-1; k++){
+        lo = (k < N) ? 0 : k-N+1; hi = (k < N) ? k : N-1;
+        prod[k] = dot(a + lo, brev + N-1-k+lo, hi-lo+1);
+    }
+    for (k=2*N-2; k>=N; k--){     // x^N = -(P[0] + P[1] x + ... + P[N-1] x^(N-1))
+        neg = M61 - canonical61(FOLD(prod[k]));
+        for (j=0; j<N; j++){ MULACC(prod[k-N+j], neg, P[j]); }
+        if (k % LAZY == 0) { for (j=0; j<k; j++){ prod[j] = FOLD(prod[j]); } }
+    }
+    for (i=0; i<N; i++){ r[i] = canonical61(FOLD(prod[i])); }
+}
+
+static void polymulx(myuint* r){
+    // r = x*r mod p
+    const myuint* P = charpoly();
+    myuint neg = M61 - r[N-1];
+    int j;
+    for (j=N-1; j>0; j--){ r[j] = canonical61(fmodmulM61(r[j-1], neg, P[j])); }
+    r[0] = canonical61(fmodmulM61(0, neg, P[0]));
+}
+
+static void polypow_x(myuint* r, const uint32_t* e, int nlimbs){
+    // r = x^e mod p, for the exponent e given as 32-bit limbs, most significant first
+    int i, w, bit, started = 0;
+    for (i=0; i<N; i++){ r[i] = 0; }
+    r[0] = 1;
+    for (w=0; w<nlimbs; w++){
+        for (bit=31; bit>=0; bit--){
+            if (started) { polymulmod(r, r, r); }
+            if ((e[w] >> bit) & 1) { polymulx(r); started = 1; }
+        }
+    }
+}
+
+void rng_discard128(rng_state_t* X, myuint nhi, myuint nlo){
+    myuint left = N - X->counter;   // numbers left in the current block
+    myuint rem = 0, cur, carry;
+    uint32_t q[4];
+    int w, any = 0;
+    if (nhi == 0 && nlo < left) { X->counter += (int)nlo; return; }
+    if (nlo < left) { nhi--; }
+    nlo -= left;
+    // whole iterations and the remainder, by long division in 32-bit limbs
+    q[0] = (uint32_t)(nhi >> 32); q[1] = (uint32_t)nhi; q[2] = (uint32_t)(nlo >> 32); q[3] = (uint32_t)nlo;
+    for (w=0; w<4; w++){
+        cur = (rem << 32) | q[w];
+        q[w] = (uint32_t)(cur / (N-1));
+        rem = cur % (N-1);
+    }
+    carry = (rem != 0);   // a partial block still needs its iteration, q cannot overflow since N-1 > 1
+    for (w=3; w>=0; w--){
+        carry += (myuint)q[w];
+        q[w] = (uint32_t)carry;
+        carry >>= 32;
+        any = any || q[w];
+    }
+    if (any){
+        myuint R[N];
+        polypow_x(R, q, 4);
+        X->sumtot = apply_poly(X->V, X->sumtot, R);
+    }
+    X->counter = (rem == 0) ? N : 1 + (int)rem;
+}
+
+void rng_discard(rng_state_t* X, unsigned long long n){
+    rng_discard128(X, 0, n);
+}
+
+
 #define SKIPISON 1
 #define OLDSKIP 0
 
-#if ( ( (N==8) || (N==17) || (N==240) ||(N==120) || (N==256) ) && BITS==61 && SKIPISON!=0)
+#if ( ( (N==8) || (N==17) || (N==40) || (N==60) || (N==96) || (N==240) ||(N==120) || (N==256) ) && BITS==61 && SKIPISON!=0)
 #if (OLDSKIP==1)
 #warning Compiling with normal skip
 void seed_uniquestream( rng_state_t* Xin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
@@ -391,6 +853,8 @@ void seed_uniquestream( rng_state_t* Xin, myID_t clusterID, myID_t machineID, my
 
 #endif
 
+static int skip_poly(myuint* R, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID );
+
 void branch_inplace( rng_state_t* Xin, myID_t* IDvec ){
 	Xin->sumtot = apply_bigskip(Xin->V, Xin->V,  IDvec[3],  IDvec[2],  IDvec[1],   IDvec[0] );
 }
@@ -417,7 +881,26 @@ myuint apply_bigskip(myuint* Vout, myuint* Vin, myID_t clusterID, myID_t machine
 	 */
 	
 	
-	const	myuint skipMat[128][N] = // to make this file, delete all except some chosen 128 rows of the coefficients table
+    int i;
+    myuint Y[N], R[N];
+    myuint sumtot=0;
+    for (i=0; i<N; i++) { Y[i] = Vin[i]; sumtot = modadd( sumtot, Vin[i]); } ;
+    if (skip_poly(R, clusterID, machineID, runID, streamID)){
+        sumtot = apply_poly(Y, sumtot, R);
+    }
+    sumtot=0;
+	for (i=0; i<N; i++){ Vout[i] = Y[i]; sumtot = modadd( sumtot, Y[i]); } ;  // returns sumtot, and copy the vector over to Vout
+	return (sumtot) ;
+}
+
+static int skip_poly(myuint* R, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
+    /*
+     the skip for the four IDs, read as one 128-bit number, is the product mod p of the rows for all the
+     set bits; multiplying the rows first and applying the product once costs O(N^2) per set bit,
+     instead of N iterations of the whole vector per set bit.  Returns 0, and R = 1, if all IDs are zero
+     */
+    // read-only static data, paged in on first touch and shared by all threads; only the rows for set bits are read
+	static const myuint skipMat[128][N] = // to make this file, delete all except some chosen 128 rows of the coefficients table
 #if (N==240)
 #include "mixmax_skip_N240.c"
 #elif (N==120)
@@ -429,48 +912,71 @@ myuint apply_bigskip(myuint* Vout, myuint* Vin, myID_t clusterID, myID_t machine
 #include "mixmax_skip_N8.c"
 #elif (N==17)
 #include "mixmax_skip_N17.c"
+#elif (N==40)
+#include "mixmax_skip_N40.c"
+#elif (N==60)
+#include "mixmax_skip_N60.c"
+#elif (N==96)
+#include "mixmax_skip_N96.c"
 #endif
 	;
 	
 	myID_t IDvec[4] = {streamID, runID, machineID, clusterID};
-	int r,i,j,  IDindex;
+	int r,i,  IDindex, any = 0;
 	myID_t id;
-	myuint Y[N], cum[N];
-	myuint coeff;
-	myuint* rowPtr;
-    myuint sumtot=0;
-	
-
-    for (i=0; i<N; i++) { Y[i] = Vin[i]; sumtot = modadd( sumtot, Vin[i]); } ;
+	const myuint* rowPtr;
 	for (IDindex=0; IDindex<4; IDindex++) { // go from lower order to higher order ID
 		id=IDvec[IDindex];
-		//printf("now doing ID at level %d, with ID = %d\n", IDindex, id);     
 		r = 0;
 		while (id){
 			if (id & 1) { 
-				rowPtr = (myuint*)skipMat[r + IDindex*8*sizeof(myID_t)];
-				//printf("free coeff for row %d is %llu\n", r, rowPtr[0]);
-				for (i=0; i<N; i++){ cum[i] = 0; }    
-				for (j=0; j<N; j++){              // j is lag, enumerates terms of the poly
-					// for zero lag Y is already given
-					coeff = rowPtr[j]; // same coeff for all i
-                    for (i =0; i<N; i++){
-                        cum[i] =  fmodmulM61( cum[i], coeff ,  Y[i] ) ;
-                    }
-					sumtot = iterate_raw_vec(Y, sumtot); 
-				}
-                sumtot=0;
-                for (i=0; i<N; i++){ Y[i] = cum[i]; sumtot = modadd( sumtot, cum[i]); } ;
+				rowPtr = skipMat[r + IDindex*8*sizeof(myID_t)];
+				if (any) { polymulmod(R, R, rowPtr); }
+				else { for (i=0; i<N; i++){ R[i] = rowPtr[i]; } any = 1; }
 			}
 		id = (id >> 1); r++; // bring up the r-th bit in the ID		
 		}		
 	}
-    sumtot=0;
-	for (i=0; i<N; i++){ Vout[i] = Y[i]; sumtot = modadd( sumtot, Y[i]); } ;  // returns sumtot, and copy the vector over to Vout
-	return (sumtot) ;
+	if (!any) { for (i=0; i<N; i++){ R[i] = 0; } R[0] = 1; }
+	return any;
+}
+
+void seed_uniquestreams(rng_state_t* X[], unsigned int count, myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID ){
+    /*
+     X[k] gets the state of seed_uniquestream(X[k], clusterID, machineID, runID, firstStreamID + k), where the
+     stream ID carries over into runID and so on.  Stream s+1 is x^(2^512) past stream s, so after the first
+     one each state costs a single polynomial product, and is combined from the orbit of the unit vector
+     instead of N iterations
+     */
+    myuint step[N], R[N], Y[N], sumtot = 1;
+    myuint* B;
+    unsigned int k;
+    int i,j;
+    if (count == 0) { return; }
+    B = (myuint*)malloc(N*N*sizeof(myuint));   // B[i*N + j] is component i of A^j e_0
+    if (B == NULL) {
+        for (k=0; k<count; k++){ seed_uniquestream(X[k], clusterID, machineID, runID, firstStreamID + k); }
+        return;
+    }
+    for (i=0; i<N; i++){ Y[i] = 0; }
+    Y[0] = 1;
+    for (j=0; j<N; j++){
+        for (i=0; i<N; i++){ B[i*N + j] = canonical61(Y[i]); }
+        sumtot = iterate_raw_vec(Y, sumtot);
+    }
+    skip_poly(step, 0, 0, 0, 1);
+    skip_poly(R, clusterID, machineID, runID, firstStreamID);
+    for (k=0; k<count; k++){
+        if (k > 0) { polymulmod(R, R, step); }
+        X[k]->sumtot = 0;
+        for (i=0; i<N; i++){ X[k]->V[i] = dot(R, B + i*N, N); X[k]->sumtot = modadd(X[k]->sumtot, X[k]->V[i]); }
+        X[k]->counter = 1;
+        if (X[k]->fh==NULL){X[k]->fh=stdout;}
+    }
+    free(B);
 }
 #else
-#warning For this N, we dont have the skipping coefficients yet, using alternative method to seed
+#warning For this N, we dont have the skipping coefficients yet, using alternative method to seed; make them with skipgen.cpp
 
 void seed_uniquestream( rng_state_t* Xin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
     Xin->V[0] = (myuint)clusterID;
@@ -485,6 +991,11 @@ void seed_uniquestream( rng_state_t* Xin, myID_t clusterID, myID_t machineID, my
     Xin->sumtot = iterate_raw_vec(Xin->V, Xin->sumtot);
     Xin->sumtot = iterate_raw_vec(Xin->V, Xin->sumtot);
 }
+
+void seed_uniquestreams(rng_state_t* X[], unsigned int count, myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID ){
+    unsigned int k;
+    for (k=0; k<count; k++){ seed_uniquestream(X[k], clusterID, machineID, runID, firstStreamID + k); }
+}
 #endif // SKIPISON
 
 
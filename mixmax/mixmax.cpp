@@ -6,40 +6,47 @@
 
 #include <iostream>
 #include <exception>
+#include <cstring>
+#include <type_traits>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <new>
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 #include "mixmax.hpp"
 
 #define MOD_PAYNE(k) ((((k)) & MERSBASE) + (((k)) >> BITS) )
 #define MOD_MERSENNE(k) MOD_PAYNE(k)
 
-myuint mixmax_engine::MOD_MULSPEC(myuint k){
-    switch (N) {
-        case 17:
-            return 0;
-            break;
-        case 256:
-            if(SPECIAL==-1){
-                return  (MERSBASE - (k));
-            }else{
-               return fmodmulM61( 0, SPECIAL , (k) ) ;
-            }
-            break;
-        case 240:
-            return fmodmulM61( 0, SPECIAL , (k) );
-            break;
-        default:
-            std::cerr << "MIXMAX ERROR: " << "Disallowed value of parameter N\n";
-            break;
+template <int N>
+myuint mixmax_engine<N>::MOD_MULSPEC(myuint k){
+    if constexpr (SPECIAL==0){
+        return 0;
+    }else if constexpr (N==256 && SPECIAL==-1){
+        return  (MERSBASE - (k));
+    }else{
+        return fmodmulM61( 0, SPECIAL , (k) );
     }
 }
 
-mixmax_engine::mixmax_engine()
+template <int N>
+mixmax_engine<N>::mixmax_engine()
 // constructor, with no params, fast and seeds with a unit vector
 {
     seed_vielbein(&S,0);
 }
 
-mixmax_engine::mixmax_engine(myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID)
+template <int N>
+mixmax_engine<N>::mixmax_engine(myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID)
 // constructor, no need to allocate, just seed
 {
     seed_uniquestream( &S, clusterID,  machineID,  runID,  streamID );
@@ -47,7 +54,8 @@ mixmax_engine::mixmax_engine(myID_t clusterID, myID_t machineID, myID_t runID, m
 
 #define MULWU(k) (( (k)<<(SPECIALMUL) & M61) | ( (k) >> (BITS-SPECIALMUL))  )
 
-myuint mixmax_engine::iterate_raw_vec(myuint* Y, myuint sumtotOld){
+template <int N>
+myuint mixmax_engine<N>::iterate_raw_vec(myuint* Y, myuint sumtotOld){
     // operates with a raw vector, uses known sum of elements of Y
     int i;
 
@@ -59,7 +67,7 @@ myuint mixmax_engine::iterate_raw_vec(myuint* Y, myuint sumtotOld){
     myuint sumtot = Y[0], ovflow = 0; // will keep a running sum of all new elements
     tempP = 0;              // will keep a partial sum of all old elements
     for (i=1; i<N; i++){
-        if (SPECIALMUL!=0){
+        if constexpr (SPECIALMUL!=0){
         myuint tempPO = MULWU(tempP);
         tempP = modadd(tempP,Y[i]);
         tempV = MOD_MERSENNE(tempV + tempP + tempPO); // edge cases ?
@@ -70,14 +78,174 @@ myuint mixmax_engine::iterate_raw_vec(myuint* Y, myuint sumtotOld){
         Y[i] = tempV;
         sumtot += tempV; if (sumtot < tempV) {ovflow++;}
     }
-    if (SPECIAL!=0){
+    if constexpr (SPECIAL!=0){
+    temp2 = MOD_MULSPEC(temp2);
+    Y[2] = modadd( Y[2] , temp2 );
+    sumtot += temp2; if (sumtot < temp2) {ovflow++;}
+    }
+    return MOD_MERSENNE(MOD_MERSENNE(sumtot) + (ovflow <<3 ));
+}
+
+
+template <int N>
+template <typename OutT>
+inline OutT mixmax_engine<N>::convert(myuint v){
+    if constexpr (std::is_integral<OutT>::value){
+        return v;
+    }else{
+        return OutT((int64_t)v*INV_MERSBASE);   // as in get_next_float
+    }
+}
+
+template <int N>
+template <typename OutT>
+myuint mixmax_engine<N>::iterate_and_fill(myuint* Y, myuint sumtotOld, OutT* out){
+    // iterate_raw_vec, also writing the new elements 1..N-1 to out[0..N-2], converted to OutT
+    int i;
+    myuint temp2 = Y[1];
+    myuint  tempP, tempV;
+    Y[0] = ( tempV = sumtotOld);
+    myuint sumtot = Y[0], ovflow = 0;
+    tempP = 0;
+    for (i=1; i<N; i++){
+        if constexpr (SPECIALMUL!=0){
+        myuint tempPO = MULWU(tempP);
+        tempP = modadd(tempP,Y[i]);
+        tempV = MOD_MERSENNE(tempV + tempP + tempPO);
+        }else{
+        tempP = modadd(tempP , Y[i]);
+        tempV = modadd(tempV , tempP);
+        }
+        Y[i] = tempV;
+        out[i-1] = convert<OutT>(tempV);
+        sumtot += tempV; if (sumtot < tempV) {ovflow++;}
+    }
+    if constexpr (SPECIAL!=0){
     temp2 = MOD_MULSPEC(temp2);
     Y[2] = modadd( Y[2] , temp2 );
+    out[1] = convert<OutT>(Y[2]);
     sumtot += temp2; if (sumtot < temp2) {ovflow++;}
     }
     return MOD_MERSENNE(MOD_MERSENNE(sumtot) + (ovflow <<3 ));
 }
 
+template <int N>
+void mixmax_engine<N>::next_block(){
+    if constexpr (N==256 && SPECIAL==-1){
+        S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
+        S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
+    }
+    S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
+    S.counter = 1;
+}
+
+template <int N>
+template <typename OutT>
+void mixmax_engine<N>::fill_from_blocks(OutT* out, std::size_t n){
+    std::size_t k = 0;
+    while (S.counter<=(N-1) && k < n){     // the rest of the current block
+        out[k++] = convert<OutT>(S.V[S.counter++]);
+    }
+    while (n - k >= std::size_t(N-1)){    // whole blocks
+        if constexpr (N==256 && SPECIAL==-1){
+            S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
+            S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
+        }
+        S.sumtot = iterate_and_fill(S.V.data(), S.sumtot, out + k);
+        S.counter = N;
+        k += N-1;
+    }
+    if (k < n){                           // and the head of the next one
+        next_block();
+        while (k < n){
+            out[k++] = convert<OutT>(S.V[S.counter++]);
+        }
+    }
+}
+
+template <int N>
+void mixmax_engine<N>::fill(myuint* out, std::size_t n){
+    fill_from_blocks(out, n);
+}
+
+template <int N>
+void mixmax_engine<N>::fill_canonical(double* out, std::size_t n){
+    fill_from_blocks(out, n);
+}
+
+template <int N>
+void mixmax_engine<N>::fill_canonical(float* out, std::size_t n){
+    fill_from_blocks(out, n);
+}
+
+// Narrow output
+
+static inline void split_uint32x2(myuint x, std::uint32_t* out){
+    out[0] = std::uint32_t(x & 0x3FFFFFFF);
+    out[1] = std::uint32_t((x >> 30) & 0x3FFFFFFF);
+}
+
+static inline void split_floatx2(myuint x, float* out){
+    // through int32, which converts to float in one instruction; exact, so never rounds up to 1
+    out[0] = float(std::int32_t((x >> 6) & 0xFFFFFF)) * 0x1p-24f;
+    out[1] = float(std::int32_t((x >> 36) & 0xFFFFFF)) * 0x1p-24f;
+}
+
+static inline void split_double53(myuint x, double* out){
+    out[0] = double(std::int64_t(x >> 8)) * 0x1p-53;
+}
+
+template <int N>
+template <int PerWord, typename OutT, typename Split>
+void mixmax_engine<N>::fill_split(OutT* out, std::size_t n, Split split){
+    // words from fill(), a few blocks at a time, each split into PerWord numbers
+    constexpr std::size_t chunk = 4*N;
+    myuint buf[chunk];
+    while (n >= PerWord){
+        std::size_t words = std::min(n/PerWord, chunk);
+        fill(buf, words);
+        for (std::size_t w=0; w<words; w++){ split(buf[w], out + w*PerWord); }
+        out += words*PerWord;
+        n -= words*PerWord;
+    }
+    if (n > 0){
+        OutT tail[PerWord];
+        split(get_next(), tail);
+        for (std::size_t k=0; k<n; k++){ out[k] = tail[k]; }
+    }
+}
+
+template <int N>
+void mixmax_engine<N>::get_next_uint32x2(std::uint32_t out[2]){
+    split_uint32x2(get_next(), out);
+}
+
+template <int N>
+void mixmax_engine<N>::get_next_floatx2(float out[2]){
+    split_floatx2(get_next(), out);
+}
+
+template <int N>
+double mixmax_engine<N>::get_next_double53(){
+    double d;
+    split_double53(get_next(), &d);
+    return d;
+}
+
+template <int N>
+void mixmax_engine<N>::fill_uint32x2(std::uint32_t* out, std::size_t n){
+    fill_split<2>(out, n, [](myuint x, std::uint32_t* o){ split_uint32x2(x, o); });
+}
+
+template <int N>
+void mixmax_engine<N>::fill_floatx2(float* out, std::size_t n){
+    fill_split<2>(out, n, [](myuint x, float* o){ split_floatx2(x, o); });
+}
+
+template <int N>
+void mixmax_engine<N>::fill_double53(double* out, std::size_t n){
+    fill_split<1>(out, n, [](myuint x, double* o){ split_double53(x, o); });
+}
 
 //rng_state_t* mixmax_engine::rng_alloc()
 //{
@@ -89,7 +257,8 @@ myuint mixmax_engine::iterate_raw_vec(myuint* Y, myuint sumtotOld){
 
 
 
-myuint mixmax_engine::get_next() {
+template <int N>
+myuint mixmax_engine<N>::get_next() {
     int i;
     i=S.counter;
     
@@ -98,7 +267,7 @@ myuint mixmax_engine::get_next() {
         return S.V[i];
     }else{
         
-        if(N==256 && SPECIAL==-1){
+        if constexpr (N==256 && SPECIAL==-1){
             S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
             S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
             S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
@@ -111,7 +280,8 @@ myuint mixmax_engine::get_next() {
     }
 }
 
-double mixmax_engine::get_next_float()				// Returns a random double with all 53 bits random, in the range (0,1]
+template <int N>
+double mixmax_engine<N>::get_next_float()				// Returns a random double with all 53 bits random, in the range (0,1]
 {    /* cast to signed int trick suggested by Andrzej Görlich     */
     int64_t Z=(int64_t)get_next();
     double F;
@@ -129,7 +299,65 @@ double mixmax_engine::get_next_float()				// Returns a random double with all 53
     
 }
 
-void mixmax_engine::seed_vielbein(rng_state_t* X, unsigned int index)
+template <int N>
+void mixmax_engine<N>::lazy_engine::step(){
+    // one turn of the loop of iterate_raw_vec, for i = next
+    myuint* Y = eng->S.V.data();
+    int i = next++;
+    if constexpr (SPECIALMUL!=0){
+        myuint tempPO = MULWU(tempP);
+        tempP = modadd(tempP, Y[i]);
+        tempV = MOD_MERSENNE(tempV + tempP + tempPO);
+    }else{
+        tempP = modadd(tempP, Y[i]);
+        tempV = modadd(tempV, tempP);
+    }
+    Y[i] = tempV;
+    sumtot += tempV; if (sumtot < tempV) {ovflow++;}
+    if constexpr (SPECIAL!=0){
+        if (i == 2){     // the correction iterate_raw_vec makes after the loop, known since the start of the block
+            myuint t = MOD_MULSPEC(temp2);
+            Y[2] = modadd(Y[2], t);
+            sumtot += t; if (sumtot < t) {ovflow++;}
+        }
+    }
+    if (next == N){ eng->S.sumtot = MOD_MERSENNE(MOD_MERSENNE(sumtot) + (ovflow <<3 )); }
+}
+
+template <int N>
+typename mixmax_engine<N>::lazy_engine::result_type mixmax_engine<N>::lazy_engine::operator()(){
+    rng_state_t& X = eng->S;
+    int i = X.counter;
+    if (i > N-1){    // start the next block, without computing any of its last iteration
+        if constexpr (N==256 && SPECIAL==-1){
+            X.sumtot = iterate_raw_vec(X.V.data(), X.sumtot);
+            X.sumtot = iterate_raw_vec(X.V.data(), X.sumtot);
+        }
+        temp2 = X.V[1];
+        X.V[0] = tempV = sumtot = X.sumtot;
+        tempP = 0;
+        ovflow = 0;
+        next = 1;
+        i = 1;
+    }
+    if (i == next){ step(); }
+    X.counter = i+1;
+    return X.V[i];
+}
+
+template <int N>
+double mixmax_engine<N>::lazy_engine::get_next_float(){
+    int64_t Z = (int64_t)(*this)();
+    return Z*INV_MERSBASE;
+}
+
+template <int N>
+void mixmax_engine<N>::lazy_engine::sync(){
+    while (next < N){ step(); }
+}
+
+template <int N>
+void mixmax_engine<N>::seed_vielbein(rng_state_t* X, unsigned int index)
 {
     int i;
     if (index<N){
@@ -144,18 +372,26 @@ void mixmax_engine::seed_vielbein(rng_state_t* X, unsigned int index)
     }
     S.counter = N;  // set the counter to N if iteration should happen right away
     S.sumtot = 1;   //(index ? 1:0);
+    S.depth = 0;
 }
 
 
-void mixmax_engine::seed_uniquestream( rng_state_t* Xin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
+template <int N>
+void mixmax_engine<N>::seed_uniquestream( rng_state_t* Xin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
+    // the same state as apply_bigskip from the unit vector, but with all the skips multiplied
+    // together first and the result taken from the orbit of the unit vector
+    myuint R[N];
     seed_vielbein(Xin,0);
-    Xin->sumtot = apply_bigskip(Xin->V.data(), Xin->V.data(),  clusterID,  machineID,  runID,   streamID );
+    if (skip_poly(R, clusterID, machineID, runID, streamID)){
+        Xin->sumtot = poly_on_vielbein(Xin->V.data(), R);
+    }
 //   if (Xin->fh==NULL){Xin->fh=stdout;} // if the filehandle is not yet set, make it stdout
     Xin->counter = 1;
 }
 
 
-myuint mixmax_engine::apply_bigskip( myuint* Vout, myuint* Vin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
+template <int N>
+myuint mixmax_engine<N>::apply_bigskip( myuint* Vout, myuint* Vin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
     /*
      makes a derived state vector, Vout, from the mother state vector Vin
      by skipping a large number of steps, determined by the given seeding ID's
@@ -175,96 +411,424 @@ myuint mixmax_engine::apply_bigskip( myuint* Vout, myuint* Vin, myID_t clusterID
      did i repeat it enough times? the non-collision guarantee is absolute, not probabilistic
      
      */
-    
-    
-const	myuint skipMat256old[128][256] =
+    int i;
+    myuint Y[N], R[N];
+    myuint sumtot=0;
+    for (i=0; i<N; i++) { Y[i] = Vin[i]; sumtot = modadd( sumtot, Vin[i]); } ;
+    if (skip_poly(R, clusterID, machineID, runID, streamID)){
+        sumtot = apply_poly(Y, sumtot, R);
+    }
+    sumtot=0;
+    for (i=0; i<N; i++){ Vout[i] = Y[i]; sumtot = modadd( sumtot, Y[i]); } ;  // returns sumtot, and copy the vector over to Vout
+    return (sumtot) ;
+}
+
+template <int N>
+bool mixmax_engine<N>::skip_poly(myuint* R, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
+    // the tables are read-only static data: paged in on first touch, shared by all threads (and by all
+    // processes using the same binary), and a call reads only the rows for the set bits of the IDs
+    if constexpr (N==8){
+        static const myuint skipMat8[128][8] =
+#include "mixmax_skip_N8.c"
+        ;
+        return skip_rows_poly(skipMat8, R, clusterID, machineID, runID, streamID);
+    }else if constexpr (N==17){
+        static const myuint skipMat17[128][17] =
+#include "mixmax_skip_N17.c"
+        ;
+        return skip_rows_poly(skipMat17, R, clusterID, machineID, runID, streamID);
+    }else if constexpr (N==40){
+        static const myuint skipMat40[128][40] =
+#include "mixmax_skip_N40.c"
+        ;
+        return skip_rows_poly(skipMat40, R, clusterID, machineID, runID, streamID);
+    }else if constexpr (N==60){
+        static const myuint skipMat60[128][60] =
+#include "mixmax_skip_N60.c"
+        ;
+        return skip_rows_poly(skipMat60, R, clusterID, machineID, runID, streamID);
+    }else if constexpr (N==96){
+        static const myuint skipMat96[128][96] =
+#include "mixmax_skip_N96.c"
+        ;
+        return skip_rows_poly(skipMat96, R, clusterID, machineID, runID, streamID);
+    }else if constexpr (N==240){
+        static const myuint skipMat240[128][240] =
+#include "mixmax_skip_N240.c"
+        ;
+        return skip_rows_poly(skipMat240, R, clusterID, machineID, runID, streamID);
+    }else if constexpr (N==256 && SPECIAL==-1){
+        static const myuint skipMat256old[128][256] =
 #include "mixmax_skip_N256.oldS.c"
-;
-const	myuint skipMat256[128][256] =
+        ;
+        return skip_rows_poly(skipMat256old, R, clusterID, machineID, runID, streamID);
+    }else{
+        static const myuint skipMat256[128][256] =
 #include "mixmax_skip_N256.c"
-;
-const	myuint skipMat240[128][240] =
-#include "mixmax_skip_N240.c"
-;
-const	myuint skipMat17[128][17] =
-#include "mixmax_skip_N17.c"
-;
-
-const myuint* skipMat[128];
-    switch (N) {
-        case 17:
-            for (int i=0; i<128; i++) { skipMat[i] = skipMat17[i];}
-            break;
-        case 240:
-            for (int i=0; i<128; i++) { skipMat[i] = skipMat240[i];}
-            break;
-        case 256:
-            if(SPECIAL==-1){
-                for (int i=0; i<128; i++) { skipMat[i] = skipMat256old[i];}
-            }else{
-                for (int i=0; i<128; i++) { skipMat[i] = skipMat256[i];}
-            }
-            break;
-        default:
-            exit(-1);
-            break;
+        ;
+        return skip_rows_poly(skipMat256, R, clusterID, machineID, runID, streamID);
     }
-    
+}
+
+template <int N>
+bool mixmax_engine<N>::skip_rows_poly(const myuint (*skipMat)[N], myuint* R, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID ){
+    /*
+     the skip for the four IDs, read as one 128-bit number, is the product mod p of the rows for all the
+     set bits; multiplying the rows first and applying the product once costs O(N^2) per set bit,
+     instead of N iterations of the whole vector per set bit.  Returns false, and R = 1, if all IDs are zero
+     */
     myID_t IDvec[4] = {streamID, runID, machineID, clusterID};
-    int r,i,j,  IDindex;
+    int r,i,  IDindex;
     myID_t id;
-    myuint Y[N], cum[N];
-    myuint coeff;
-    myuint* rowPtr;
-    myuint sumtot=0;
-    
-    
-    for (i=0; i<N; i++) { Y[i] = Vin[i]; sumtot = modadd( sumtot, Vin[i]); } ;
+    bool any = false;
     for (IDindex=0; IDindex<4; IDindex++) { // go from lower order to higher order ID
         id=IDvec[IDindex];
-        //printf("now doing ID at level %d, with ID = %d\n", IDindex, id);
         r = 0;
         while (id){
             if (id & 1) {
-                rowPtr = (myuint*)skipMat[r + IDindex*8*sizeof(myID_t)];
-                //printf("free coeff for row %d is %llu\n", r, rowPtr[0]);
-                for (i=0; i<N; i++){ cum[i] = 0; }
-                for (j=0; j<N; j++){              // j is lag, enumerates terms of the poly
-                    // for zero lag Y is already given
-                    coeff = rowPtr[j]; // same coeff for all i
-                    for (i =0; i<N; i++){
-                        cum[i] =  fmodmulM61( cum[i], coeff ,  Y[i] ) ;
-                    }
-                    sumtot = iterate_raw_vec(Y, sumtot);
-                }
-                sumtot=0;
-                for (i=0; i<N; i++){ Y[i] = cum[i]; sumtot = modadd( sumtot, cum[i]); } ;
+                const myuint* rowPtr = skipMat[r + IDindex*8*sizeof(myID_t)];
+                if (any) { polymulmod(R, R, rowPtr); }
+                else { for (i=0; i<N; i++){ R[i] = rowPtr[i]; } any = true; }
             }
-            id = (id >> 1); r++; // bring up the r-th bit in the ID		
-        }		
+            id = (id >> 1); r++; // bring up the r-th bit in the ID
+        }
+    }
+    if (!any) { for (i=0; i<N; i++){ R[i] = 0; } R[0] = 1; }
+    return any;
+}
+
+template <int N>
+myuint mixmax_engine<N>::apply_poly(myuint* Y, myuint sumtot, const myuint* coeff){
+    // replaces Y by P(A) Y, where P has the N coefficients coeff, low to high; returns the new sumtot
+    accum_t cum[N];
+    int i,j;
+    for (i=0; i<N; i++){ cum[i] = 0; }
+    for (j=0; j<N; j++){              // j is lag, enumerates terms of the poly
+        // for zero lag Y is already given
+        for (i =0; i<N; i++){
+            mulacc( cum[i], coeff[j] ,  Y[i] ) ; // same coeff for all i
+        }
+        if (j % LAZY == LAZY-1) { for (i=0; i<N; i++){ cum[i] = fold(cum[i]); } }
+        sumtot = iterate_raw_vec(Y, sumtot);
     }
     sumtot=0;
-    for (i=0; i<N; i++){ Vout[i] = Y[i]; sumtot = modadd( sumtot, Y[i]); } ;  // returns sumtot, and copy the vector over to Vout
-    return (sumtot) ;
+    for (i=0; i<N; i++){ Y[i] = canonical(fold(cum[i])); sumtot = modadd( sumtot, Y[i]); } ;
+    return sumtot;
+}
+
+template <int N>
+std::vector<myuint> mixmax_engine<N>::find_vielbein_orbit(){
+    std::vector<myuint> B(N*N);
+    myuint Y[N];
+    for (int i=0; i<N; i++){ Y[i] = 0; }
+    Y[0] = 1;
+    myuint sumtot = 1;
+    for (int j=0; j<N; j++){
+        for (int i=0; i<N; i++){ B[i*N + j] = canonical(Y[i]); }
+        sumtot = iterate_raw_vec(Y, sumtot);
+    }
+    return B;
+}
+
+template <int N>
+const myuint* mixmax_engine<N>::vielbein_orbit(){
+    // B[i*N + j] is component i of A^j e_0, j = 0..N-1
+    static const std::vector<myuint> B = find_vielbein_orbit();
+    return B.data();
+}
+
+template <int N>
+myuint mixmax_engine<N>::poly_on_vielbein(myuint* Y, const myuint* coeff){
+    // Y = P(A) e_0, the same as apply_poly on the unit vector, as a combination of the rows of
+    // vielbein_orbit instead of N iterations; returns the new sumtot
+    const myuint* B = vielbein_orbit();
+    myuint sumtot=0;
+    for (int i=0; i<N; i++){ Y[i] = dot(coeff, B + i*N, N); sumtot = modadd( sumtot, Y[i]); } ;
+    return sumtot;
+}
+
+template <int N>
+void mixmax_engine<N>::seed_uniquestreams(mixmax_engine* engines, std::size_t count, myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID, unsigned nthreads){
+    /*
+     engines[k] gets the state of mixmax_engine(clusterID, machineID, runID, firstStreamID + k), where the
+     stream ID carries over into runID and so on.  Stream s+1 is x^(2^512) past stream s, so after the first
+     stream of each thread's share the next one costs a single polynomial product.
+     */
+    if (count == 0) { return; }
+    if (nthreads < 1) { nthreads = 1; }
+    if (nthreads > count) { nthreads = (unsigned)count; }
+    myuint step[N];
+    skip_poly(step, 0, 0, 0, 1);
+    auto work = [&](std::size_t begin, std::size_t end){
+        myID_t ID[4] = {firstStreamID, runID, machineID, clusterID};
+        myuint c = begin, R[N];
+        for (int i=0; i<4; i++){ c += ID[i]; ID[i] = (myID_t)c; c >>= 32; }
+        skip_poly(R, ID[3], ID[2], ID[1], ID[0]);
+        for (std::size_t k=begin; k<end; k++){
+            if (k > begin) { polymulmod(R, R, step); }
+            engines[k].S.sumtot = poly_on_vielbein(engines[k].S.V.data(), R);
+            engines[k].S.counter = 1;
+            engines[k].S.depth = 0;
+        }
+    };
+    vielbein_orbit();   // initialized before the threads start, for clarity of timing
+    std::vector<std::thread> pool;
+    std::size_t chunk = (count + nthreads - 1) / nthreads;
+    for (unsigned t=1; t<nthreads; t++){
+        std::size_t begin = t*chunk, end = std::min(count, begin + chunk);
+        if (begin < end) { pool.emplace_back(work, begin, end); }
+    }
+    work(0, std::min(count, chunk));
+    for (auto& th : pool) { th.join(); }
+}
+
+/*
+ Jumping ahead by an arbitrary number of steps.
+
+ n iterations of the MIXMAX matrix A are the matrix x^n(A) = R(A), where R = x^n mod p and p is the
+ characteristic polynomial of A (Cayley-Hamilton).  R is found by square-and-multiply in O(N^2 log n)
+ and applied to the state with apply_poly in O(N^2).  The skip tables hold R for n = 2^512 ... 2^639.
+ */
+
+template <int N>
+myuint mixmax_engine<N>::canonical(myuint x){
+    x = MOD_MERSENNE(MOD_MERSENNE(x));
+    return (x >= M61) ? x - M61 : x;
+}
+
+template <int N>
+myuint mixmax_engine<N>::inverse(myuint a){
+    // a^(M61-2), by Fermat
+    myuint r = 1, e = M61 - 2;
+    while (e){
+        if (e & 1) { r = canonical(fmodmulM61(0, r, a)); }
+        a = canonical(fmodmulM61(0, a, a));
+        e >>= 1;
+    }
+    return r;
+}
+
+template <int N>
+std::array<myuint, N+1> mixmax_engine<N>::find_charpoly(){
+    // p is irreducible, so it is also the minimal polynomial of the sequence of any one component
+    // of A^k v, v != 0; it is recovered from 2N terms with the Berlekamp-Massey algorithm
+    std::vector<myuint> s(2*N), C(2*N+1, 0), B(2*N+1, 0), T;
+    myuint Y[N];
+    for (int i=0; i<N; i++){ Y[i] = 0; }
+    Y[0] = 1;
+    myuint sumtot = 1;
+    for (int k=0; k<2*N; k++){
+        s[k] = canonical(Y[1]);
+        sumtot = iterate_raw_vec(Y, sumtot);
+    }
+    C[0] = B[0] = 1;
+    int L = 0, m = 1;
+    myuint b = 1;
+    for (int n=0; n<2*N; n++){
+        myuint d = s[n];
+        for (int i=1; i<=L; i++){ d = fmodmulM61(d, C[i], s[n-i]); }
+        d = canonical(d);
+        if (d == 0) { m++; continue; }
+        myuint neg = M61 - canonical(fmodmulM61(0, d, inverse(b)));
+        bool grow = (2*L <= n);
+        if (grow) { T = C; }
+        for (int i=0; i+m<=2*N; i++){ C[i+m] = canonical(fmodmulM61(C[i+m], neg, B[i])); }
+        if (grow) { L = n+1-L; B = T; b = d; m = 1; } else { m++; }
+    }
+    if (L != N){
+        std::cerr << "MIXMAX ERROR: " << "characteristic polynomial of degree " << L << " instead of N\n";
+        std::terminate();
+    }
+    std::array<myuint, N+1> P;
+    for (int k=0; k<=N; k++){ P[k] = C[N-k]; }  // monic, low to high
+    return P;
+}
+
+template <int N>
+const myuint* mixmax_engine<N>::charpoly(){
+    static const std::array<myuint, N+1> P = find_charpoly();
+    return P.data();
+}
+
+template <int N>
+void mixmax_engine<N>::polymulmod(myuint* r, const myuint* a, const myuint* b){
+    // r = a*b mod p, r may alias a or b; every coefficient, of the product and of its reduction
+    // with the precomputed powers x^N ... x^(2N-2), is one dot product
+    const myuint* XT = reduction_table();
+    myuint brev[N], prod[2*N-1];
+    int i,s;
+    for (i=0; i<N; i++){ brev[i] = b[N-1-i]; }
+    for (s=0; s<2*N-1; s++){
+        int lo = (s < N) ? 0 : s-N+1, hi = (s < N) ? s : N-1;
+        prod[s] = dot(a + lo, brev + N-1-s+lo, hi-lo+1);
+    }
+    for (i=0; i<N; i++){ r[i] = canonical(prod[i] + dot(prod + N, XT + i*(N-1), N-1)); }
+}
+
+template <int N>
+std::vector<myuint> mixmax_engine<N>::find_reduction_table(){
+    const myuint* P = charpoly();
+    std::vector<myuint> XT(N*(N-1));
+    myuint X[N];
+    for (int i=0; i<N; i++){ X[i] = canonical(M61 - P[i]); }   // x^N = -(P[0] + P[1] x + ... + P[N-1] x^(N-1))
+    for (int k=0; k<N-1; k++){
+        for (int i=0; i<N; i++){ XT[i*(N-1) + k] = X[i]; }
+        polymulx(X);
+    }
+    return XT;
+}
+
+template <int N>
+const myuint* mixmax_engine<N>::reduction_table(){
+    // XT[i*(N-1) + k] is the coefficient of x^i in x^(N+k) mod p, k = 0..N-2
+    static const std::vector<myuint> XT = find_reduction_table();
+    return XT.data();
+}
+
+template <int N>
+inline myuint mixmax_engine<N>::dot(const myuint* a, const myuint* b, int n){
+    // sum of a[k]*b[k] mod M61, in [0, M61); the products are summed unreduced, LAZY at a time
+    accum_t acc = 0;
+    int k = 0;
+    for (int stop = LAZY; stop < n; stop += LAZY){
+        for (; k<stop; k++){ mulacc(acc, a[k], b[k]); }
+        acc = fold(acc);
+    }
+    for (; k<n; k++){ mulacc(acc, a[k], b[k]); }
+    return canonical(fold(acc));
+}
+
+template <int N>
+void mixmax_engine<N>::polymulx(myuint* r){
+    // r = x*r mod p
+    const myuint* P = charpoly();
+    myuint neg = M61 - r[N-1];
+    for (int j=N-1; j>0; j--){ r[j] = canonical(fmodmulM61(r[j-1], neg, P[j])); }
+    r[0] = canonical(fmodmulM61(0, neg, P[0]));
+}
+
+template <int N>
+void mixmax_engine<N>::polypow_x(myuint* r, const uint32_t* e, int nlimbs){
+    // r = x^e mod p, for the exponent e given as 32-bit limbs, most significant first
+    for (int i=0; i<N; i++){ r[i] = 0; }
+    r[0] = 1;
+    bool started = false;
+    for (int w=0; w<nlimbs; w++){
+        for (int bit=31; bit>=0; bit--){
+            if (started) { polymulmod(r, r, r); }
+            if ((e[w] >> bit) & 1) { polymulx(r); started = true; }
+        }
+    }
+}
+
+template <int N>
+std::vector<myuint> mixmax_engine<N>::find_split_jumps(){
+    // x^(2^(511-d)) mod p for d = 0..SPLIT_LEVELS-1, the top of one chain of squarings of x
+    std::vector<myuint> J(SPLIT_LEVELS*N);
+    myuint R[N];
+    for (int i=0; i<N; i++){ R[i] = 0; }
+    R[0] = 1;
+    polymulx(R);
+    for (int e=0; e<512; e++){
+        if (e >= 512 - SPLIT_LEVELS){ std::copy(R, R + N, J.begin() + (511 - e)*N); }
+        polymulmod(R, R, R);
+    }
+    return J;
+}
+
+template <int N>
+const myuint* mixmax_engine<N>::split_jumps(){
+    static const std::vector<myuint> J = find_split_jumps();
+    return J.data();
+}
+
+template <int N>
+mixmax_engine<N> mixmax_engine<N>::split(){
+    if (S.depth >= SPLIT_LEVELS){
+        std::cerr << "MIXMAX ERROR: " << SPLIT_TOO_DEEP << " split() deeper than " << SPLIT_LEVELS << " levels\n";
+        exit(SPLIT_TOO_DEEP);
+    }
+    mixmax_engine child(*this);
+    child.S.sumtot = apply_poly(child.S.V.data(), child.S.sumtot, split_jumps() + S.depth*N);
+    child.S.depth = ++S.depth;
+    return child;
+}
+
+template <int N>
+void mixmax_engine<N>::discard128(myuint nhi, myuint nlo){
+    myuint left = N - S.counter;   // numbers left in the current block
+    if (nhi == 0 && nlo < left) { S.counter += (int)nlo; return; }
+    if (nlo < left) { nhi--; }
+    nlo -= left;
+    // whole blocks and the remainder, by long division in 32-bit limbs
+    uint32_t q[5] = {0, (uint32_t)(nhi >> 32), (uint32_t)nhi, (uint32_t)(nlo >> 32), (uint32_t)nlo};
+    myuint rem = 0;
+    for (int w=1; w<5; w++){
+        myuint cur = (rem << 32) | q[w];
+        q[w] = (uint32_t)(cur / (N-1));
+        rem = cur % (N-1);
+    }
+    // blocks = q + (rem != 0), times the iterations per block
+    myuint carry = (rem != 0), ipb = (N==256 && SPECIAL==-1) ? 3 : 1;
+    for (int w=4; w>=1; w--){
+        carry += (myuint)q[w];
+        q[w] = (uint32_t)carry;
+        carry >>= 32;
+    }
+    q[0] = (uint32_t)carry;
+    carry = 0;
+    bool any = false;
+    for (int w=4; w>=0; w--){
+        carry += (myuint)q[w] * ipb;
+        q[w] = (uint32_t)carry;
+        carry >>= 32;
+        any = any || q[w];
+    }
+    if (any){
+        myuint R[N];
+        polypow_x(R, q, 5);
+        S.sumtot = apply_poly(S.V.data(), S.sumtot, R);
+    }
+    S.counter = (rem == 0) ? N : 1 + (int)rem;
+}
+
+template <int N>
+void mixmax_engine<N>::discard(unsigned long long n){
+    discard128(0, n);
 }
 
 #if defined(__x86_64__)
-inline myuint mixmax_engine::mod128(__uint128_t s){
+template <int N>
+inline myuint mixmax_engine<N>::mod128(__uint128_t s){
     myuint s1;
     s1 = ( (  ((myuint)s)&MERSBASE )    + (  ((myuint)(s>>64)) * 8 )  + ( ((myuint)s) >>BITS) );
     return	MOD_MERSENNE(s1);
 }
 
-inline myuint mixmax_engine::fmodmulM61(myuint cum, myuint a, myuint b){
+template <int N>
+inline myuint mixmax_engine<N>::fmodmulM61(myuint cum, myuint a, myuint b){
     __uint128_t temp;
     temp = (__uint128_t)a*(__uint128_t)b + cum;
     return mod128(temp);
 }
 
+template <int N>
+inline void mixmax_engine<N>::mulacc(accum_t& acc, myuint a, myuint b){
+    acc += (__uint128_t)a*(__uint128_t)b;
+}
+
+template <int N>
+inline typename mixmax_engine<N>::accum_t mixmax_engine<N>::fold(accum_t acc){
+    // unlike mod128, good for the whole 128-bit range: 2^64 = 2^3 and 2^61 = 1 mod M61
+    myuint lo = (myuint)acc, hi = (myuint)(acc >> 64);
+    return MOD_MERSENNE( (lo & M61) + (lo >> BITS) + ((hi << 3) & M61) + (hi >> (BITS-3)) );
+}
+
 #else // on all other platforms, including 32-bit linux, PPC and PPC64, ARM and all Windows
 #define MASK32 0xFFFFFFFFULL
 
-inline myuint mixmax_engine::fmodmulM61(myuint cum, myuint s, myuint a)
+template <int N>
+inline myuint mixmax_engine<N>::fmodmulM61(myuint cum, myuint s, myuint a)
 {
     register myuint o,ph,pl,ah,al;
     o=(s)*a;
@@ -277,9 +841,20 @@ inline myuint mixmax_engine::fmodmulM61(myuint cum, myuint s, myuint a)
     o = (o & M61) + ((o>>61));
     return o;
 }
+
+template <int N>
+inline void mixmax_engine<N>::mulacc(accum_t& acc, myuint a, myuint b){
+    acc = fmodmulM61(acc, a, b);
+}
+
+template <int N>
+inline typename mixmax_engine<N>::accum_t mixmax_engine<N>::fold(accum_t acc){
+    return acc;
+}
 #endif
 
-myuint mixmax_engine::modadd(myuint foo, myuint bar){
+template <int N>
+myuint mixmax_engine<N>::modadd(myuint foo, myuint bar){
 #if (defined(__x86_64__) || defined(__i386__)) &&  defined(__GNUC__) && defined(USE_INLINE_ASM)
     //#warning Using assembler routine in modadd
     myuint out;
@@ -296,7 +871,8 @@ myuint mixmax_engine::modadd(myuint foo, myuint bar){
 #endif
 }
 
-void mixmax_engine::print_state(){ // (std::ostream& ost){
+template <int N>
+void mixmax_engine<N>::print_state(){ // (std::ostream& ost){
     int j;
     fprintf(stdout, "mixmax state, file version 1.0\n" );
     fprintf(stdout, "N=%u; V[N]={", rng_get_N() );
@@ -309,29 +885,764 @@ void mixmax_engine::print_state(){ // (std::ostream& ost){
     fprintf(stdout, "sumtot=%llu;\n", S.sumtot );
 }
 
-mixmax_engine mixmax_engine::Branch(){
+template <int N>
+mixmax_engine<N> mixmax_engine<N>::Branch(){
     // suggested by Lorenzo
     mixmax_engine tmp=*this;
     this->BranchMother();
     tmp.BranchDaughter(5);
-    tmp.print_state();
-    this->print_state();
     return tmp;
 }
 
-mixmax_engine& mixmax_engine::operator=(const mixmax_engine& other ){
+template <int N>
+mixmax_engine<N>& mixmax_engine<N>::operator=(const mixmax_engine& other ){
     S = other.S;
    // S.V = S.A.data();
     return *this;
 }
 
-void mixmax_engine::BranchDaughter(int b){ // valid values are between b=5 and b=60
+template <int N>
+void mixmax_engine<N>::BranchDaughter(int b){ // valid values are between b=5 and b=60
     if(b>60) {std::cerr << "MIXMAX ERROR: " << "Disallowed value of parameter b in BranchDaughter\n"; exit(-1);}
     // Dont forget to branch mother, when you branch the daughter, or else you will have collisions!
-    printf("V[N] = %llu, %d\n", S.V[N], b); S.V[N] ^= (1<<(BITS-b)); S.V[N] |= 1; printf("V[N] = %llu\n", S.V[N]);
-    S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot); printf("iterating!\n");
+    // flips a bit of the last component, V[N-1], and brings sumtot up to date before iterating
+    myuint old = S.V[N-1];
+    S.V[N-1] ^= ((myuint)1 << (BITS-b)); S.V[N-1] |= 1;
+    S.sumtot = canonical(S.sumtot + S.V[N-1] + (M61 - canonical(old)));
+    S.sumtot = iterate_raw_vec(S.V.data(), S.sumtot);
 }
 
-void mixmax_engine::BranchMother(){
+template <int N>
+void mixmax_engine<N>::BranchMother(){
     BranchDaughter(4); // same thing, but b must be different
-}
\ No newline at end of file
+}
+
+// Checkpoints
+
+template <int N>
+bool mixmax_engine<N>::state_ok(const rng_state_t& X){
+    // every component is a residue, sumtot is their sum and the counter is in range
+    myuint sum = 0;
+    for (int i=0; i<N; i++){
+        if (X.V[i] > M61) return false;
+        sum = canonical(sum + X.V[i]);
+    }
+    return X.sumtot <= M61 && canonical(X.sumtot) == sum && X.counter >= 1 && X.counter <= N
+        && X.depth >= 0 && X.depth <= SPLIT_LEVELS;
+}
+
+template <int N>
+myuint mixmax_engine<N>::states_checksum(const mixmax_engine* engines, std::size_t count){
+    myuint sum = 0;
+    for (std::size_t k=0; k<count; k++){
+        sum = canonical(sum + canonical(engines[k].S.sumtot));
+        sum = canonical(sum + (myuint)engines[k].S.counter);
+    }
+    return sum;
+}
+
+template <int N>
+void mixmax_engine<N>::check_states(const mixmax_state_header& hdr, const mixmax_engine* engines, std::size_t count, const char filename[]){
+    for (std::size_t k=0; k<count; k++){
+        if (!state_ok(engines[k].S)){
+            std::cerr << "MIXMAX ERROR: state " << k << " in file " << filename << " is invalid - corrupted?\n";
+            exit(ERROR_READING_STATE_CHECKSUM);
+        }
+    }
+    if (states_checksum(engines, count) != hdr.checksum){
+        std::cerr << "MIXMAX ERROR: checksum error while reading states from file " << filename << " - corrupted?\n";
+        exit(ERROR_READING_STATE_CHECKSUM);
+    }
+}
+
+template <int N>
+static void check_state_header(const mixmax_state_header& hdr, long long special, const char filename[]){
+    if (memcmp(hdr.magic, "MIXMAXST", 8) != 0 || hdr.version != 1){
+        std::cerr << "MIXMAX ERROR: " << filename << " is not a MIXMAX state file of version 1\n";
+        exit(ERROR_READING_STATE_FORMAT);
+    }
+    if (hdr.dim != (uint32_t)N || hdr.special != (int64_t)special){
+        std::cerr << "MIXMAX ERROR: file " << filename << " holds states for N=" << hdr.dim << " and SPECIAL=" << hdr.special
+                  << ", not for N=" << N << " and SPECIAL=" << special << "\n";
+        exit(ERROR_READING_STATE_FORMAT);
+    }
+}
+
+// whether a file of size bytes holds exactly the header and count records; by division, so a forged count cannot overflow
+static bool state_file_size_ok(unsigned long long size, uint64_t count, std::size_t record){
+    if (size < sizeof(mixmax_state_header)) return false;
+    size -= sizeof(mixmax_state_header);
+    return size % record == 0 && size / record == count;
+}
+
+template <int N>
+void mixmax_engine<N>::save_states(const char filename[], const mixmax_engine* engines, std::size_t count){
+    static_assert(sizeof(mixmax_engine) == (N+2)*sizeof(myuint), "MIXMAX: the engine must have the layout of a state record");
+    mixmax_state_header hdr;
+    memcpy(hdr.magic, "MIXMAXST", 8);
+    hdr.version = 1;
+    hdr.dim = N;
+    hdr.special = SPECIAL;
+    hdr.count = count;
+    hdr.checksum = states_checksum(engines, count);
+    FILE* fout = fopen(filename, "wb");
+    if (!fout){
+        std::cerr << "MIXMAX ERROR: cannot open file " << filename << " for writing\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+    // the engines have no padding, so they are written as they are
+    bool ok = fwrite(&hdr, sizeof(hdr), 1, fout) == 1 && fwrite((const void*)engines, sizeof(mixmax_engine), count, fout) == count;
+    if (fclose(fout) != 0 || !ok){
+        std::cerr << "MIXMAX ERROR: error writing file " << filename << "\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+}
+
+template <int N>
+std::vector<mixmax_engine<N>> mixmax_engine<N>::load_states(const char filename[]){
+    mixmax_state_header hdr;
+    FILE* fin = fopen(filename, "rb");
+    if (!fin || fread(&hdr, sizeof(hdr), 1, fin) != 1){
+        std::cerr << "MIXMAX ERROR: error reading file " << filename << "\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+    check_state_header<N>(hdr, SPECIAL, filename);
+    // the size of the file bounds the count before anything is allocated for it
+#if defined(__unix__) || defined(__APPLE__)
+    struct stat st;
+    unsigned long long size = fstat(fileno(fin), &st) == 0 ? (unsigned long long)st.st_size : 0;
+#else
+    long pos = ftell(fin);
+    unsigned long long size = fseek(fin, 0, SEEK_END) == 0 ? (unsigned long long)ftell(fin) : 0;
+    fseek(fin, pos, SEEK_SET);
+#endif
+    if (!state_file_size_ok(size, hdr.count, sizeof(mixmax_engine))){
+        std::cerr << "MIXMAX ERROR: the size of file " << filename << " does not match its " << hdr.count << " states\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+    std::vector<mixmax_engine> engines(hdr.count);
+    if (fread(engines.data(), sizeof(mixmax_engine), hdr.count, fin) != hdr.count){
+        std::cerr << "MIXMAX ERROR: file " << filename << " is shorter than its " << hdr.count << " states\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+    fclose(fin);
+    check_states(hdr, engines.data(), engines.size(), filename);
+    return engines;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+template <int N>
+mixmax_engine<N>* mixmax_engine<N>::map_states(const char filename[], std::size_t& count){
+    int fd = open(filename, O_RDWR);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || (std::size_t)st.st_size < sizeof(mixmax_state_header)){
+        std::cerr << "MIXMAX ERROR: error reading file " << filename << "\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+    void* base = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);      // the mapping stays valid
+    if (base == MAP_FAILED){
+        std::cerr << "MIXMAX ERROR: cannot map file " << filename << "\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+    const mixmax_state_header& hdr = *(const mixmax_state_header*)base;
+    check_state_header<N>(hdr, SPECIAL, filename);
+    if (!state_file_size_ok(st.st_size, hdr.count, sizeof(mixmax_engine))){
+        std::cerr << "MIXMAX ERROR: the size of file " << filename << " does not match its " << hdr.count << " states\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+    // the header is 40 bytes, so the records are 8-byte aligned in the page-aligned mapping
+    mixmax_engine* engines = (mixmax_engine*)((char*)base + sizeof(hdr));
+    count = hdr.count;
+    check_states(hdr, engines, count, filename);
+    return engines;
+}
+
+template <int N>
+void mixmax_engine<N>::sync_states(mixmax_engine* engines, std::size_t count){
+    mixmax_state_header* hdr = (mixmax_state_header*)((char*)engines - sizeof(mixmax_state_header));
+    std::size_t size = sizeof(*hdr) + count*sizeof(mixmax_engine);
+    hdr->checksum = states_checksum(engines, count);
+    if (msync(hdr, size, MS_SYNC) != 0){
+        std::cerr << "MIXMAX ERROR: error writing back mapped states\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+}
+
+template <int N>
+void mixmax_engine<N>::unmap_states(mixmax_engine* engines, std::size_t count){
+    sync_states(engines, count);
+    mixmax_state_header* hdr = (mixmax_state_header*)((char*)engines - sizeof(mixmax_state_header));
+    if (munmap(hdr, sizeof(*hdr) + count*sizeof(mixmax_engine)) != 0){
+        std::cerr << "MIXMAX ERROR: error writing back mapped states\n";
+        exit(ERROR_READING_STATE_FILE);
+    }
+}
+#else
+template <int N>
+mixmax_engine<N>* mixmax_engine<N>::map_states(const char filename[], std::size_t& count){
+    std::cerr << "MIXMAX ERROR: map_states needs mmap, use load_states to read " << filename << "\n";
+    exit(ERROR_READING_STATE_FILE);
+}
+
+template <int N>
+void mixmax_engine<N>::sync_states(mixmax_engine* engines, std::size_t count){
+    std::cerr << "MIXMAX ERROR: map_states needs mmap\n";
+    exit(ERROR_READING_STATE_FILE);
+}
+
+template <int N>
+void mixmax_engine<N>::unmap_states(mixmax_engine* engines, std::size_t count){
+    std::cerr << "MIXMAX ERROR: map_states needs mmap\n";
+    exit(ERROR_READING_STATE_FILE);
+}
+#endif
+
+template <int N>
+void mixmax_engine<N>::write_state(std::ostream& os) const{
+    std::ios_base::fmtflags flags = os.flags();
+    char fill = os.fill();
+    os.flags(std::ios_base::dec | std::ios_base::left);
+    os.fill(' ');
+    for (int i=0; i<N; i++){ os << S.V[i] << ' '; }
+    os << S.sumtot << ' ' << S.counter << ' ' << S.depth;
+    os.flags(flags);
+    os.fill(fill);
+}
+
+template <int N>
+void mixmax_engine<N>::read_state(std::istream& is){
+    std::ios_base::fmtflags flags = is.flags();
+    is.flags(std::ios_base::dec | std::ios_base::skipws);
+    rng_state_t X;
+    for (int i=0; i<N; i++){ is >> X.V[i]; }
+    is >> X.sumtot >> X.counter >> X.depth;
+    if (is && state_ok(X)){ S = X; } else { is.setstate(std::ios_base::failbit); }
+    is.flags(flags);
+}
+
+template <int N>
+bool mixmax_engine<N>::operator==(const mixmax_engine& other) const{
+    // equal engines give equal output from now on
+    for (int i=0; i<N; i++){ if (canonical(S.V[i]) != canonical(other.S.V[i])) return false; }
+    return S.counter == other.S.counter;
+}
+
+template class mixmax_engine<8>;
+template class mixmax_engine<17>;
+template class mixmax_engine<40>;
+template class mixmax_engine<60>;
+template class mixmax_engine<96>;
+template class mixmax_engine<240>;
+template class mixmax_engine<256>;
+
+// Multi-lane engine
+
+template <int N, int L>
+mixmax_engine_x<N, L>::mixmax_engine_x()
+{
+    seed_uniquestream(0, 0, 0, 0);
+}
+
+template <int N, int L>
+mixmax_engine_x<N, L>::mixmax_engine_x(myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID)
+{
+    seed_uniquestream(clusterID, machineID, runID, firstStreamID);
+}
+
+template <int N, int L>
+void mixmax_engine_x<N, L>::seed_uniquestream(myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID){
+    for (int l=0; l<L; l++){
+        set_lane(l, scalar_engine(clusterID, machineID, runID, firstStreamID + l));
+    }
+}
+
+template <int N, int L>
+void mixmax_engine_x<N, L>::set_lane(int l, const scalar_engine& e){
+    for (int i=0; i<N; i++){ V[i][l] = e.S.V[i]; }
+    sumtot[l] = e.S.sumtot;
+    counter[l] = e.S.counter;
+    carry_begin[l] = carry_end[l] = 0;
+}
+
+template <int N, int L>
+mixmax_engine<N> mixmax_engine_x<N, L>::get_lane(int l) const {
+    // while lane l reads from its carry its own V has not moved on, so the engine resumes from the carried state
+    scalar_engine e;
+    if (carry_begin[l] < carry_end[l]){
+        for (int i=0; i<N; i++){ e.S.V[i] = carry[l][i]; }
+        e.S.sumtot = carry_sumtot[l];
+        e.S.counter = carry_begin[l];
+        return e;
+    }
+    for (int i=0; i<N; i++){ e.S.V[i] = V[i][l]; }
+    e.S.sumtot = sumtot[l];
+    e.S.counter = counter[l];
+    return e;
+}
+
+template <int N, int L>
+void mixmax_engine_x<N, L>::iterate_lanes(myuint* out){
+    // iterate_raw_vec on all lanes at once; if out is given, the new elements 1..N-1 are also written there, lane-interleaved
+    constexpr long long int SPECIAL = scalar_engine::SPECIAL;
+    constexpr int SPECIALMUL = scalar_engine::SPECIALMUL;
+    // the lane vectors are moved with memcpy, which compiles to plain vector loads and stores
+    lanes_t temp2, tempV, tempP = lanes_t{}, ovflow = lanes_t{}, Y;
+    std::memcpy(&temp2, V[1], sizeof(temp2));
+    std::memcpy(&tempV, sumtot, sizeof(tempV));
+    std::memcpy(V[0], &tempV, sizeof(tempV));
+    lanes_t sum = tempV;
+    for (int i=1; i<N; i++){
+        std::memcpy(&Y, V[i], sizeof(Y));
+        if constexpr (SPECIALMUL!=0){
+            lanes_t tempPO = ((tempP << SPECIALMUL) & M61) | (tempP >> (BITS-SPECIALMUL));
+            tempP = MOD_MERSENNE(tempP + Y);
+            tempV = MOD_MERSENNE(tempV + tempP + tempPO);
+        }else{
+            tempP = MOD_MERSENNE(tempP + Y);
+            tempV = MOD_MERSENNE(tempV + tempP);
+        }
+        std::memcpy(V[i], &tempV, sizeof(tempV));
+        if (out) { std::memcpy(out + (i-1)*L, &tempV, sizeof(tempV)); }
+        sum += tempV; ovflow -= (lanes_t)(sum < tempV);
+    }
+    if constexpr (SPECIAL!=0){
+        for (int l=0; l<L; l++){ temp2[l] = scalar_engine::MOD_MULSPEC(temp2[l]); }
+        std::memcpy(&Y, V[2], sizeof(Y));
+        Y = MOD_MERSENNE(Y + temp2);
+        std::memcpy(V[2], &Y, sizeof(Y));
+        if (out) { std::memcpy(out + L, &Y, sizeof(Y)); }
+        sum += temp2; ovflow -= (lanes_t)(sum < temp2);
+    }
+    sum = MOD_MERSENNE(MOD_MERSENNE(sum) + (ovflow << 3));
+    std::memcpy(sumtot, &sum, sizeof(sum));
+}
+
+template <int N, int L>
+void mixmax_engine_x<N, L>::iterate(){
+    if constexpr (N==256 && scalar_engine::SPECIAL==-1){
+        iterate_lanes(nullptr);
+        iterate_lanes(nullptr);  // skipping by 2, as in mixmax_engine::get_next
+    }
+    iterate_lanes(nullptr);
+    for (int l=0; l<L; l++){ counter[l] = 1; carry_begin[l] = carry_end[l] = 0; }
+}
+
+template <int N, int L>
+void mixmax_engine_x<N, L>::iterate_one_lane(int l){
+    myuint Y[N];
+    for (int i=0; i<N; i++){ Y[i] = V[i][l]; }
+    if constexpr (N==256 && scalar_engine::SPECIAL==-1){
+        sumtot[l] = scalar_engine::iterate_raw_vec(Y, sumtot[l]);
+        sumtot[l] = scalar_engine::iterate_raw_vec(Y, sumtot[l]);
+    }
+    sumtot[l] = scalar_engine::iterate_raw_vec(Y, sumtot[l]);
+    for (int i=0; i<N; i++){ V[i][l] = Y[i]; }
+    counter[l] = 1;
+}
+
+template <int N, int L>
+myuint mixmax_engine_x<N, L>::get_next(int l){
+    if (carry_begin[l] < carry_end[l]){
+        return carry[l][carry_begin[l]++];
+    }
+    if (counter[l] > N-1){
+        bool lockstep = true;
+        for (int j=0; j<L; j++){ if (carry_begin[j] < carry_end[j]) lockstep = false; }
+        if (lockstep){
+            // keep the state of the other lanes, to read what they have not yet, then advance all lanes together
+            for (int j=0; j<L; j++){
+                for (int i=0; i<N; i++){ carry[j][i] = V[i][j]; }
+                carry_sumtot[j] = sumtot[j];
+                carry_begin[j] = counter[j]; carry_end[j] = N;
+            }
+            if constexpr (N==256 && scalar_engine::SPECIAL==-1){
+                iterate_lanes(nullptr);
+                iterate_lanes(nullptr);
+            }
+            iterate_lanes(nullptr);
+            for (int j=0; j<L; j++){ counter[j] = 1; }
+        }else{
+            iterate_one_lane(l);
+        }
+    }
+    return V[counter[l]++][l];
+}
+
+template <int N, int L>
+double mixmax_engine_x<N, L>::get_next_float(int l){
+    int64_t Z=(int64_t)get_next(l);
+    return Z*INV_MERSBASE;
+}
+
+template <int N, int L>
+bool mixmax_engine_x<N, L>::lanes_aligned() const {
+    for (int l=0; l<L; l++){
+        if (carry_begin[l] < carry_end[l] || counter[l] != counter[0]) return false;
+    }
+    return true;
+}
+
+template <int N, int L>
+void mixmax_engine_x<N, L>::fill_interleaved(myuint* out, std::size_t n){
+    std::size_t k = 0;
+    while (k < n){
+        if (k % L != 0 || n - k < L || !lanes_aligned()){
+            out[k] = get_next(int(k % L)); k++;
+            continue;
+        }
+        int c = counter[0];
+        if (c > N-1){
+            if (n - k >= std::size_t(L)*(N-1)){   // a whole block goes straight from the iteration to out
+                if constexpr (N==256 && scalar_engine::SPECIAL==-1){
+                    iterate_lanes(nullptr);
+                    iterate_lanes(nullptr);
+                }
+                iterate_lanes(out + k);
+                k += std::size_t(L)*(N-1);
+                continue;
+            }
+            iterate();
+            c = 1;
+        }
+        for (; c<N && n - k >= L; c++){
+            std::memcpy(out + k, V[c], sizeof(V[c]));
+            k += L;
+        }
+        for (int l=0; l<L; l++){ counter[l] = c; }
+    }
+}
+
+template class mixmax_engine_x<17, 4>;
+template class mixmax_engine_x<240, 4>;
+template class mixmax_engine_x<256, 4>;
+template class mixmax_engine_x<17, 8>;
+template class mixmax_engine_x<240, 8>;
+template class mixmax_engine_x<256, 8>;
+
+// Structure of arrays of many streams
+
+template <int N>
+mixmax_soa<N>::mixmax_soa(std::size_t count, myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID)
+: count(count), V(N*count), sumtot(count), counter(count), lockstep(false), common(0)
+{
+    // seeded a chunk of engines at a time, stream IDs carried into the higher IDs as by seed_uniquestreams
+    constexpr std::size_t chunk = 4096;
+    std::vector<scalar_engine> engines(std::min(count, chunk));
+    for (std::size_t b=0; b<count; b+=chunk){
+        std::size_t m = std::min(chunk, count - b);
+        myuint c = b;
+        myID_t ID[4] = {firstStreamID, runID, machineID, clusterID};
+        for (int i=0; i<4; i++){ c += ID[i]; ID[i] = (myID_t)c; c >>= 32; }
+        scalar_engine::seed_uniquestreams(engines.data(), m, ID[3], ID[2], ID[1], ID[0]);
+        for (std::size_t k=0; k<m; k++){ set_stream(b + k, engines[k]); }
+    }
+    lockstep = true;    // seeded streams all start a block
+    common = 1;
+}
+
+template <int N>
+void mixmax_soa<N>::unlock(){
+    if (lockstep){
+        std::fill(counter.begin(), counter.end(), (std::uint8_t)common);
+        lockstep = false;
+    }
+}
+
+template <int N>
+typename mixmax_soa<N>::scalar_engine mixmax_soa<N>::get_stream(std::size_t s) const{
+    scalar_engine e;
+    for (int i=0; i<N; i++){ e.S.V[i] = V[i*count + s]; }
+    e.S.sumtot = sumtot[s];
+    e.S.counter = lockstep ? common : counter[s];
+    return e;
+}
+
+template <int N>
+void mixmax_soa<N>::set_stream(std::size_t s, const scalar_engine& e){
+    unlock();
+    for (int i=0; i<N; i++){ V[i*count + s] = e.S.V[i]; }
+    sumtot[s] = e.S.sumtot;
+    counter[s] = (std::uint8_t)e.S.counter;
+}
+
+template <int N>
+myuint mixmax_soa<N>::get_next(std::size_t s){
+    unlock();
+    if (counter[s] > N-1){
+        myuint Y[N];
+        for (int i=0; i<N; i++){ Y[i] = V[i*count + s]; }
+        sumtot[s] = scalar_engine::iterate_raw_vec(Y, sumtot[s]);
+        for (int i=0; i<N; i++){ V[i*count + s] = Y[i]; }
+        counter[s] = 1;
+    }
+    return V[counter[s]++*count + s];
+}
+
+template <int N>
+void mixmax_soa<N>::get_next_all(myuint* out){
+    if (lockstep){
+        if (common > N-1) { iterate(); }
+        const myuint* row = V.data() + std::size_t(common++)*count;
+        for (std::size_t s=0; s<count; s++){ out[s] = row[s]; }
+        return;
+    }
+    // each stream on its own, watching for the counters to come back in step
+    bool same = true;
+    for (std::size_t s=0; s<count; s++){
+        out[s] = get_next(s);
+        same = same && counter[s] == counter[0];
+    }
+    if (same){
+        lockstep = true;
+        common = count > 0 ? counter[0] : 1;
+    }
+}
+
+template <int N>
+void mixmax_soa<N>::iterate(std::size_t begin, std::size_t end){
+    // iterate_raw_vec on a chunk of streams at a time, element by element, with the loops over the streams innermost
+    bool all = begin == 0 && end == count;
+    if (!all) { unlock(); }
+    constexpr int SPECIALMUL = scalar_engine::SPECIALMUL;
+    constexpr std::size_t chunk = 64;
+    myuint tempV[chunk], tempP[chunk], sum[chunk], ovflow[chunk];
+    for (std::size_t b=begin; b<end; b+=chunk){
+        std::size_t m = std::min(chunk, end - b);
+        myuint* Y = V.data() + b;
+        for (std::size_t s=0; s<m; s++){
+            tempV[s] = sum[s] = Y[s] = sumtot[b + s];
+            tempP[s] = ovflow[s] = 0;
+        }
+        for (int i=1; i<N; i++){
+            Y += count;
+            for (std::size_t s=0; s<m; s++){
+                if constexpr (SPECIALMUL!=0){
+                    myuint tempPO = ((tempP[s] << SPECIALMUL) & M61) | (tempP[s] >> (BITS-SPECIALMUL));
+                    tempP[s] = MOD_MERSENNE(tempP[s] + Y[s]);
+                    tempV[s] = MOD_MERSENNE(tempV[s] + tempP[s] + tempPO);
+                }else{
+                    tempP[s] = MOD_MERSENNE(tempP[s] + Y[s]);
+                    tempV[s] = MOD_MERSENNE(tempV[s] + tempP[s]);
+                }
+                Y[s] = tempV[s];
+                sum[s] += tempV[s]; ovflow[s] += (sum[s] < tempV[s]);
+            }
+        }
+        for (std::size_t s=0; s<m; s++){
+            sumtot[b + s] = MOD_MERSENNE(MOD_MERSENNE(sum[s]) + (ovflow[s] << 3));
+            if (!all) { counter[b + s] = 1; }
+        }
+    }
+    if (all){
+        lockstep = true;
+        common = 1;
+    }
+}
+
+// Pool of per-thread engines
+
+static std::atomic<std::uint64_t> mixmax_pool_serial(0);
+
+static void* mixmax_pool_pages(std::size_t bytes){
+    // fresh pages from the kernel, untouched, where mmap is available
+#if defined(__unix__) || defined(__APPLE__)
+    void* mem = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) throw std::bad_alloc();
+    return mem;
+#else
+    return ::operator new(bytes, std::align_val_t(4096));
+#endif
+}
+
+static void mixmax_pool_free(void* mem, std::size_t bytes){
+#if defined(__unix__) || defined(__APPLE__)
+    munmap(mem, bytes);
+#else
+    (void)bytes;
+    ::operator delete(mem, std::align_val_t(4096));
+#endif
+}
+
+template <int N>
+mixmax_pool<N>::mixmax_pool(myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID)
+: ID{firstStreamID, runID, machineID, clusterID}, serial(mixmax_pool_serial.fetch_add(1) + 1), next(0)
+{
+}
+
+template <int N>
+mixmax_pool<N>::~mixmax_pool(){
+    for (mixmax_engine<N>* e : owned){ e->~mixmax_engine<N>(); }
+    for (char* slab : slabs){ mixmax_pool_free(slab, SLAB); }
+}
+
+template <int N>
+std::uint64_t mixmax_pool<N>::next_stream(myID_t id[4]){
+    // the IDs of the next stream, unless the count or the 128-bit stream ID would wrap
+    std::uint64_t k = next.load(std::memory_order_relaxed);
+    do {
+        myuint c = 0;
+        if (k != ~std::uint64_t(0)){
+            c = k;
+            for (int i=0; i<4; i++){ c += ID[i]; id[i] = (myID_t)c; c >>= 32; }
+        }
+        if (k == ~std::uint64_t(0) || c != 0){
+            std::cerr << "MIXMAX ERROR: " << STREAM_IDS_EXHAUSTED << " mixmax_pool has handed out its last stream ID\n";
+            exit(STREAM_IDS_EXHAUSTED);
+        }
+    } while (!next.compare_exchange_weak(k, k + 1, std::memory_order_relaxed));
+    return k;
+}
+
+template <int N>
+char* mixmax_pool<N>::reserve_locked(myID_t id[4]){
+    next_stream(id);
+    slab_t& slab = current[std::this_thread::get_id()];
+    if (slab.base == nullptr || slab.used + STRIDE > SLAB){
+        slab.base = (char*)mixmax_pool_pages(SLAB);
+        slab.used = 0;
+        slabs.push_back(slab.base);
+    }
+    char* slot = slab.base + slab.used;
+    slab.used += STRIDE;
+    return slot;
+}
+
+template <int N>
+mixmax_engine<N>* mixmax_pool<N>::acquire(){
+    myID_t id[4];
+    char* slot;
+    {
+        std::lock_guard<std::mutex> guard(owned_lock);
+        slot = reserve_locked(id);
+    }
+    // seeded outside the lock, but still by the thread which asked for the engine, so that it first touches the pages
+    mixmax_engine<N>* e = new (slot) mixmax_engine<N>(id[3], id[2], id[1], id[0]);
+    std::lock_guard<std::mutex> guard(owned_lock);
+    owned.push_back(e);
+    return e;
+}
+
+template <int N>
+mixmax_engine<N>& mixmax_pool<N>::local(){
+    // the last CACHE pools of this thread, the most recent first; on a miss the pool's own table is authoritative
+    thread_local std::pair<std::uint64_t, mixmax_engine<N>*> cache[CACHE] = {};
+    for (int k=0; k<CACHE; k++){
+        if (cache[k].first == serial) return *cache[k].second;
+    }
+    mixmax_engine<N>* e = nullptr;
+    {
+        std::lock_guard<std::mutex> guard(owned_lock);
+        auto it = locals.find(std::this_thread::get_id());
+        if (it != locals.end()) e = it->second;
+    }
+    if (e == nullptr){   // only this thread adds its own entry, so no other can have added it meanwhile
+        e = acquire();
+        std::lock_guard<std::mutex> guard(owned_lock);
+        locals[std::this_thread::get_id()] = e;
+    }
+    for (int k=CACHE-1; k>0; k--){ cache[k] = cache[k-1]; }
+    cache[0] = std::make_pair(serial, e);
+    return *e;
+}
+
+// Ring of pre-generated numbers
+
+template <int N>
+mixmax_ring<N>::mixmax_ring(const mixmax_engine<N>& source, std::size_t batches)
+: producer(source), nconsumers(0), head(0), tail(0), nstalls(0), nwaits(0), stop(false)
+{
+    std::size_t size = 1;
+    while (size < batches){ size *= 2; }
+    ring = std::vector<slot>(size);
+    mask = size - 1;
+    for (std::size_t k=0; k<size; k++){ ring[k].seq.store(k, std::memory_order_relaxed); }
+    base = producer.split();
+    helper = std::thread(&mixmax_ring::produce, this);
+}
+
+template <int N>
+mixmax_ring<N>::~mixmax_ring(){
+    stop.store(true, std::memory_order_relaxed);
+    helper.join();
+}
+
+template <int N>
+void mixmax_ring<N>::produce(){
+    // a slot at position pos is free when its seq is pos; it is then filled and published with seq = pos + 1.
+    // On a full ring the producer yields for a while, then sleeps, so as not to hold a core
+    std::uint64_t pos = 0;
+    int idle = 0;
+    while (!stop.load(std::memory_order_relaxed)){
+        slot& s = ring[pos & mask];
+        if (s.seq.load(std::memory_order_acquire) != pos){
+            nwaits.fetch_add(1, std::memory_order_relaxed);
+            if (++idle < 64) { std::this_thread::yield(); } else { std::this_thread::sleep_for(std::chrono::microseconds(20)); }
+            continue;
+        }
+        idle = 0;
+        producer.fill(s.data, BATCH);
+        s.seq.store(pos + 1, std::memory_order_release);
+        head.store(++pos, std::memory_order_relaxed);
+    }
+}
+
+template <int N>
+bool mixmax_ring<N>::try_take(myuint* out){
+    std::uint64_t pos = tail.load(std::memory_order_relaxed);
+    for (;;){
+        slot& s = ring[pos & mask];
+        std::uint64_t seq = s.seq.load(std::memory_order_acquire);
+        if (seq == pos + 1){
+            if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+                std::memcpy(out, s.data, sizeof(s.data));
+                s.seq.store(pos + mask + 1, std::memory_order_release);   // free for the next round
+                return true;
+            }
+        }else if (seq < pos + 1){
+            return false;      // not yet filled
+        }else{
+            pos = tail.load(std::memory_order_relaxed);   // taken by another consumer
+        }
+    }
+}
+
+template <int N>
+void mixmax_ring<N>::take(myuint* out, mixmax_engine<N>& fallback){
+    if (!try_take(out)){
+        nstalls.fetch_add(1, std::memory_order_relaxed);
+        fallback.fill(out, BATCH);
+    }
+}
+
+template <int N>
+mixmax_engine<N> mixmax_ring<N>::consumer_engine(){
+    // the jump by k*2^384 iterations is a product of split jumps, x^(2^(384+b)) for each set bit b of k
+    const int levels = mixmax_engine<N>::SPLIT_LEVELS;
+    const int bits = levels - base.S.depth;   // k < 2^bits stays inside the share of base
+    std::uint64_t k = nconsumers.fetch_add(1, std::memory_order_relaxed);
+    if (bits < 64 && (k >> bits) != 0){
+        std::cerr << "MIXMAX ERROR: " << STREAM_IDS_EXHAUSTED << " mixmax_ring has handed out its last consumer engine\n";
+        exit(STREAM_IDS_EXHAUSTED);
+    }
+    mixmax_engine<N> e(base);
+    for (int b=0; k != 0; b++, k >>= 1){
+        if (k & 1){
+            e.S.sumtot = mixmax_engine<N>::apply_poly(e.S.V.data(), e.S.sumtot,
+                                                      mixmax_engine<N>::split_jumps() + (levels - 1 - b)*N);
+        }
+    }
+    e.S.depth = levels;
+    return e;
+}
+
+template class mixmax_soa<8>;
+template class mixmax_soa<17>;
+template class mixmax_soa<40>;
+template class mixmax_soa<60>;
+template class mixmax_pool<17>;
+template class mixmax_pool<240>;
+template class mixmax_pool<256>;
+template class mixmax_ring<17>;
+template class mixmax_ring<240>;
+template class mixmax_ring<256>;
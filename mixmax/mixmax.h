@@ -70,6 +70,22 @@ rng_state_t  *rng_copy(myuint *Y);         /* init from vector, takes the vector
                                                returns pointer to the newly allocated and initialized state */
 void read_state(rng_state_t* X, const char filename[] );
 void print_state(rng_state_t* X);
+
+/* Binary state files, version 1, native byte order, shared with mixmax_engine<N>::save_states of mixmax.hpp:
+   the header below, then count records { uint64 V[N]; uint64 sumtot; int32 counter; int32 depth; },
+   where depth, of mixmax_engine<N>::split, is written as 0 and ignored.
+   Each record is checked by its sumtot, the counters by the checksum of the header. */
+struct mixmax_state_header
+{
+    char magic[8];           // "MIXMAXST", not null-terminated
+    uint32_t version;        // 1
+    uint32_t dim;            // N
+    int64_t special;         // SPECIAL
+    uint64_t count;          // number of records
+    uint64_t checksum;       // sum of sumtot + counter over all records, mod 2^61-1
+};
+void rng_save_states(const char filename[], rng_state_t* X[], unsigned int count); // writes the states X[0] ... X[count-1]
+void rng_load_states(const char filename[], rng_state_t* X[], unsigned int count); // reads the first count states of the file into X[]
     int iterate(rng_state_t* X);
     myuint iterate_raw_vec(myuint* Y, myuint sumtotOld);
 
@@ -86,7 +102,20 @@ void seed_uniquestream(rng_state_t* X, myID_t clusterID, myID_t machineID, myID_
 			-- useful if you are running a parallel simulation with many clusters, many CPUs each
  */
 
+void seed_uniquestreams(rng_state_t* X[], unsigned int count, myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID );
+/*
+ the same as seed_uniquestream(X[k], clusterID, machineID, runID, firstStreamID + k) for k = 0..count-1,
+ but each next stream costs one polynomial product mod the characteristic polynomial: use it to seed many streams at startup
+ */
+
 void seed_spbox(rng_state_t* X, myuint seed);    // non-linear method, makes certified unique vectors,  probability for streams to collide is < 1/10^4600
+void seed_spbox_many(rng_state_t* X[], unsigned int count, const myuint seeds[]); // seed_spbox(X[k], seeds[k]) for k < count,
+/*
+ in parallel when compiled with OpenMP.  On one thread it gains only while the states fit in the cache, where it seeds
+ 4 at a time: about 300 against 420 ns a state at N=240.  Out of the cache 4 interleaved states of N=240 or 256 are
+ slower than seed_spbox, so past SPBOX_MANY_CACHE_BYTES of states (4 MB) those fall back to seed_spbox for each state
+ and are only as fast; N=17 keeps its gain.  make spbox prints the crossover.
+ */
 
 void seed_vielbein(rng_state_t* X, unsigned int i); // seeds with the i-th unit vector, i = 0..N-1,  for testing only
 
@@ -99,10 +128,43 @@ void seed_vielbein(rng_state_t* X, unsigned int i); // seeds with the i-th unit
 	double get_next_float(rng_state_t* X);   // returns double precision floating point number in (0,1]
 #endif  //__MIXMAX_C
 
+void rng_discard(rng_state_t* X, unsigned long long n); // skips ahead by n numbers, as n calls of get_next() would, in O(N^2 log n)
+void rng_discard128(rng_state_t* X, myuint nhi, myuint nlo); // the same for n = nhi*2^64 + nlo
+
 void fill_array(rng_state_t* X, unsigned int n, double *array); // fastest method: set n to a multiple of N (e.g. n=256)
 
 void iterate_and_fill_array(rng_state_t* X, double *array); // fills the array with N numbers
 
+/* Narrow output, more than one number per 61-bit word; bit 60 is dropped, and the half from bits 0..29 comes first.
+   x2: two 30-bit integers in [0, 2^30), or two floats k*2^-24 in [0,1) from the top 24 bits of each half.
+   double53: the top 53 bits, k*2^-53 in [0,1).  The fill_array versions give the same numbers as repeated calls,
+   using (n+1)/2 words for the x2 modes and dropping the last half when n is odd. */
+void get_next_uint32x2(rng_state_t* X, uint32_t out[2]);
+void get_next_floatx2(rng_state_t* X, float out[2]);
+double get_next_double53(rng_state_t* X);
+void fill_array_uint32x2(rng_state_t* X, unsigned int n, uint32_t *array);
+void fill_array_floatx2(rng_state_t* X, unsigned int n, float *array);
+void fill_array_double53(rng_state_t* X, unsigned int n, double *array);
+
+/* Lazy mode, for a flat cost per call: the same numbers as get_next(X), but each element of the next block is
+   computed only when it is requested, and the sum of the block is finished when its last element is taken,
+   so that no call runs the whole O(N) iterate_raw_vec.  While the lazy state is in use, X->V holds a block
+   that is only partly updated: call rng_lazy_sync before X is passed to any other function. */
+struct rng_lazy_st
+{
+    rng_state_t* X;
+    int next;                // X->V[next..N-1] are still those of the previous block
+    myuint tempP, tempV;     // the running sums of iterate_raw_vec
+    myuint temp2;            // X->V[1] of the previous block, for the SPECIAL term
+    myuint sumtot, ovflow;   // the running sum of the new block
+};
+typedef struct rng_lazy_st rng_lazy_t;
+
+void rng_lazy_init(rng_lazy_t* L, rng_state_t* X); // attaches X, which may be in any valid state
+myuint get_next_lazy(rng_lazy_t* L);                // as get_next(X)
+double get_next_float_lazy(rng_lazy_t* L);          // as get_next_float(X)
+void rng_lazy_sync(rng_lazy_t* L);                  // completes the block in progress, X is an ordinary state again
+
 myuint precalc(rng_state_t* X);
 /* needed if the state has been changed by something other than  iterate, but no worries, seeding functions call this for you when necessary */
 myuint apply_bigskip(myuint* Vout, myuint* Vin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID );
@@ -226,6 +288,8 @@ inline double get_next_float_BY_MACRO(rng_state_t* X){
 #define ERROR_READING_STATE_FILE    0xFF03
 #define ERROR_READING_STATE_COUNTER       0xFF04
 #define ERROR_READING_STATE_CHECKSUM      0xFF05
+#define ERROR_CHARPOLY_DEGREE       0xFF06
+#define ERROR_READING_STATE_FORMAT  0xFF07
 
 #ifdef __cplusplus
 }
@@ -30,6 +30,15 @@
 #include <array>
 #include <vector>
 #include <cstdint>
+#include <cstddef>
+#include <iosfwd>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#if __cplusplus > 201703L && __has_include(<span>)
+#include <span>
+#endif
 
 template <typename T, T __min, T __max> class _Generator
 // Boilerplate code, from Andrzej, it is required to be compatible with libstdc++ interfaces, see example.cpp for how to use.
@@ -65,17 +74,49 @@ constexpr double INV_MERSBASE=(0.43368086899420177360298E-18);
  256         |         -1                |     0          |     (MERSBASE - (k))                |   4682    |    164.5   |  2
  256         | 487013230256099064        |     0          |   fmodmulM61( 0, SPECIAL , (k) )    |   4682    |    193.6   | none
 
+ also N = 8, 40, 60 and 96, with SPECIAL=0 and SPECIALMUL = 53, 42, 52 and 55, as in mixmax.h;
+ their skip tables are made by skipgen.cpp.  For N=8 the period is shorter than the skips of seed_uniquestream,
+ and streams are not guaranteed to be disjoint
+
  Figure of merit is entropy: best generator overall is N=240
  
 */
+/*
+ Binary state files, version 1, in native byte order; the same format is read and written by
+ rng_save_states and rng_load_states of the C library (mixmax.h).  A header, then count records:
+
+   struct mixmax_state_header, 40 bytes
+   count times { uint64 V[N]; uint64 sumtot; int32 counter; int32 depth; }   // (N+2)*8 bytes each
+
+ A record is laid out exactly like mixmax_engine<N>, so that a file can be mapped and its engines used
+ in place.  depth is that of split(), 0 from the C library.  sumtot, the sum of V mod 2^61-1, checks every record;
+ the header checksum covers the counters.
+*/
+
+struct mixmax_state_header
+{
+    char magic[8];           // "MIXMAXST", not null-terminated
+    uint32_t version;        // 1
+    uint32_t dim;            // N
+    int64_t special;         // SPECIAL: the C library and mixmax_engine differ for N=256
+    uint64_t count;          // number of records
+    uint64_t checksum;       // sum of sumtot + counter over all records, mod 2^61-1
+};
+
 // Interface C++11 std::random
 
-//template <int N>
+// The engine is a class template over the vector size N, so that generators with different N
+// can coexist in one program; SPECIAL and SPECIALMUL are fixed at compile time for each N,
+// and the branches on them in the hot loop are resolved by if constexpr.
+// The member functions are explicitly instantiated in mixmax.cpp for N = 8, 17, 40, 60, 96, 240 and 256.
+
+template <int N = Ndim>
 class mixmax_engine: public _Generator<std::uint64_t, 0, 0x1FFFFFFFFFFFFFFF> // does not work with any other values
 {
-static const int N = Ndim;
-    static constexpr long long int SPECIAL   = ((N==17)? 0 : ((N==240)? 487013230256099140ULL:-1) ); // etc...
-    static constexpr long long int SPECIALMUL= ((N==17)? 36: ((N==240)? 51                   : 0) ); // etc...
+    static_assert(N==8 || N==17 || N==40 || N==60 || N==96 || N==240 || N==256, "MIXMAX: N must be one of 8, 17, 40, 60, 96, 240 or 256");
+
+    static constexpr long long int SPECIAL   = ((N==240)? 487013230256099140ULL : ((N==256)? -1 : 0) ); // etc...
+    static constexpr int           SPECIALMUL= ((N==8)? 53 : (N==17)? 36 : (N==40)? 42 : (N==60)? 52 : (N==96)? 55 : (N==240)? 51 : 0 ); // etc...
     // Note the potential for confusion...
 
 struct rng_state_st
@@ -85,6 +126,7 @@ struct rng_state_st
     //myuint *V=A.data();
     myuint sumtot;
     int counter;
+    int depth = 0;    // of split(), in what would otherwise be padding
 };
     
 typedef struct rng_state_st rng_state_t; // C struct alias
@@ -102,15 +144,111 @@ public:
     myuint get_next() ;
     double get_next_float();
 
+    // Bulk output: the same numbers as n calls of get_next() or get_next_float(), in the same
+    // order, but whole blocks are written straight from the iteration with no per-number branch.
+    // The floating point fills are in (0,1], like get_next_float(); the float values are
+    // the double values rounded to float.
+    void fill(myuint* out, std::size_t n);
+    void fill_canonical(double* out, std::size_t n);
+    void fill_canonical(float* out, std::size_t n);
+#if __cplusplus > 201703L && __has_include(<span>)
+    void fill(std::span<std::uint64_t> out) {fill(out.data(), out.size());}
+    void fill_canonical(std::span<double> out) {fill_canonical(out.data(), out.size());}
+    void fill_canonical(std::span<float> out) {fill_canonical(out.data(), out.size());}
+#endif
+
+    // Narrow output, more than one number per 61-bit word.  Bit 60 is dropped, and of the two halves the one
+    // from bits 0..29 comes first.  x2: two 30-bit integers in [0, 2^30), or two floats k*2^-24 in [0,1)
+    // from the top 24 bits of each half.  double53: the top 53 bits, k*2^-53 in [0,1).
+    // The bulk versions use (n+1)/2 words for the x2 modes, dropping the last half when n is odd.
+    void get_next_uint32x2(std::uint32_t out[2]);
+    void get_next_floatx2(float out[2]);
+    double get_next_double53();
+    void fill_uint32x2(std::uint32_t* out, std::size_t n);
+    void fill_floatx2(float* out, std::size_t n);
+    void fill_double53(double* out, std::size_t n);
+#if __cplusplus > 201703L && __has_include(<span>)
+    void fill_uint32x2(std::span<std::uint32_t> out) {fill_uint32x2(out.data(), out.size());}
+    void fill_floatx2(std::span<float> out) {fill_floatx2(out.data(), out.size());}
+    void fill_double53(std::span<double> out) {fill_double53(out.data(), out.size());}
+#endif
+
+    // Lazy mode, for a flat cost per call, as rng_lazy_t of the C library: lazy() gives a std-compatible view
+    // with the same numbers as get_next(), but each element of the next block is computed only when it is
+    // requested, and the sum of the block is finished when its last element is taken.  While the view draws,
+    // the engine holds a block only partly updated: sync(), or the destructor of the view, completes it, and
+    // the engine must not be used otherwise before.  For N=256, whose blocks are three iterations, the first
+    // two are done when a block starts and only the last one is spread over the calls.
+    class lazy_engine
+    {
+        mixmax_engine* eng;
+        int next;                // V[next..N-1] are still those of the previous block
+        myuint tempP, tempV;     // the running sums of iterate_raw_vec
+        myuint temp2;            // V[1] of the previous block, for the SPECIAL term
+        myuint sumtot, ovflow;   // the running sum of the new block
+        void step();
+    public:
+        typedef std::uint64_t result_type;
+        static constexpr result_type min() {return 0;}
+        static constexpr result_type max() {return 0x1FFFFFFFFFFFFFFF;}
+        explicit lazy_engine(mixmax_engine& e) : eng(&e), next(N) {}
+        ~lazy_engine() {sync();}
+        lazy_engine(const lazy_engine&) = delete;
+        lazy_engine& operator=(const lazy_engine&) = delete;
+        result_type operator()();
+        double get_next_float();
+        void sync();             // completes the block in progress, the engine is an ordinary one again
+    };
+    lazy_engine lazy() {return lazy_engine(*this);}
+
+    // Skip ahead by n numbers, exactly as n calls of get_next() would, in O(N^2 log n)
+    void discard(unsigned long long n);
+    void discard128(myuint nhi, myuint nlo);   // n = nhi*2^64 + nlo
+
     int iterate();
+
+    // A child engine with its own stream, disjoint from this one: an engine of depth d owns 2^(512-d) iterations
+    // from where it was seeded or split, and split() gives the upper half to the child, both then of depth d+1,
+    // so a whole fork-join tree draws from disjoint parts of the parent stream.  Up to SPLIT_LEVELS levels;
+    // a split beyond them is a fatal error, SPLIT_TOO_DEEP.
+    // No I/O and no allocation: the jump is a polynomial in A, from a table built on the first call, applied in O(N^2).
+    // That cost is in applying it to the state, N iterations and N^2 products, so no table can make it O(N):
+    // mixmax_engine<17> is the engine to split, at about 1.5 us a split against about 300 us at N=240
+    // (make split times a fork-join tree); seed the engines of a large N with seed_uniquestreams instead.
+    static constexpr int SPLIT_LEVELS = 128;
+    mixmax_engine split();
+    int split_depth() const {return S.depth;}
+
     mixmax_engine Branch();
     void BranchDaughter(int b=5); // valid values are between b=5 and b=60
     void BranchMother();
     
     mixmax_engine(myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID );	   // Constructor with four 32-bit seeds
+    // Seed engines[0..count) as mixmax_engine(clusterID, machineID, runID, firstStreamID + k), using nthreads threads;
+    // consecutive streams cost one polynomial product each, instead of one per set bit of the IDs
+    static void seed_uniquestreams(mixmax_engine* engines, std::size_t count, myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID, unsigned nthreads = 1);
     void seed(uint64_t seedval){seed_uniquestream( &S, 0, 0, (myID_t)(seedval>>32), (myID_t)seedval );} // seed with one 64-bit seed
+
+    // Binary checkpoints of many engines, in the format above.  Errors in reading a file are fatal, as in read_state.
+    // map_states maps the file shared and writable: the engines advance in the file itself, but the header
+    // checksum does not follow them, so until the next sync_states or unmap_states the file fails its checksum.
+    // sync_states is the commit step: it brings the checksum up to date and writes the mapping back, and the
+    // file is then a valid checkpoint of the engines as they are; unmap_states syncs once more and unmaps.
+    static void save_states(const char filename[], const mixmax_engine* engines, std::size_t count);
+    static std::vector<mixmax_engine> load_states(const char filename[]);
+    static mixmax_engine* map_states(const char filename[], std::size_t& count);
+    static void sync_states(mixmax_engine* engines, std::size_t count);
+    static void unmap_states(mixmax_engine* engines, std::size_t count);
+
+    // The whole state as text, V[0] ... V[N-1] sumtot counter depth, for std engine compatibility;
+    // operator>> sets failbit, and leaves the engine alone, if the text is not a valid state
+    void write_state(std::ostream& os) const;
+    void read_state(std::istream& is);
+    bool operator==(const mixmax_engine& other) const;
+    bool operator!=(const mixmax_engine& other) const {return !(*this == other);}
     mixmax_engine(); // Constructor, no seeds
     
+    mixmax_engine(const mixmax_engine& other) = default;
     mixmax_engine& operator=(const mixmax_engine& other );
     
 inline T operator()()
@@ -119,24 +257,300 @@ inline T operator()()
     }
     
 private:
-    myuint MOD_MULSPEC(myuint k);
+    template <int, int> friend class mixmax_engine_x;
+    template <int> friend class mixmax_soa;
+    template <int> friend class mixmax_ring;
+
+    static myuint MOD_MULSPEC(myuint k);
+    static bool state_ok(const rng_state_t& X);
+    static myuint states_checksum(const mixmax_engine* engines, std::size_t count);
+    static void check_states(const mixmax_state_header& hdr, const mixmax_engine* engines, std::size_t count, const char filename[]);
     void seed_vielbein(rng_state_t* X, unsigned int i); // seeds with the i-th unit vector, i = 0..N-1,  for testing only
-    myuint iterate_raw_vec(myuint* Y, myuint sumtotOld);
+    static myuint iterate_raw_vec(myuint* Y, myuint sumtotOld);
+    template <typename OutT> static OutT convert(myuint v);
+    template <typename OutT> static myuint iterate_and_fill(myuint* Y, myuint sumtotOld, OutT* out);
+    template <typename OutT> void fill_from_blocks(OutT* out, std::size_t n);
+    template <int PerWord, typename OutT, typename Split> void fill_split(OutT* out, std::size_t n, Split split);
+    void next_block();
     myuint apply_bigskip(myuint* Vout, myuint* Vin, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID );
-    myuint modadd(myuint foo, myuint bar);
-    myuint fmodmulM61(myuint cum, myuint s, myuint a);
 #if defined(__x86_64__)
-    inline myuint mod128(__uint128_t s);
+    typedef __uint128_t accum_t;      // sum of products of 61-bit numbers, reduced only every LAZY terms
+    static constexpr int LAZY = 32;   // 32 products < 2^122 and one reduced value fit in 128 bits
+#else
+    typedef myuint accum_t;
+    static constexpr int LAZY = 1;
+#endif
+    static void mulacc(accum_t& acc, myuint a, myuint b);
+    static accum_t fold(accum_t acc);
+    static myuint dot(const myuint* a, const myuint* b, int n);
+    static myuint apply_poly(myuint* Y, myuint sumtot, const myuint* coeff);
+    static std::vector<myuint> find_vielbein_orbit();
+    static const myuint* vielbein_orbit();
+    static myuint poly_on_vielbein(myuint* Y, const myuint* coeff);
+    static bool skip_poly(myuint* R, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID );
+    static bool skip_rows_poly(const myuint (*skipMat)[N], myuint* R, myID_t clusterID, myID_t machineID, myID_t runID, myID_t  streamID );
+    static myuint canonical(myuint x);
+    static myuint inverse(myuint a);
+    static std::array<myuint, N+1> find_charpoly();
+    static const myuint* charpoly();
+    static std::vector<myuint> find_split_jumps();
+    static const myuint* split_jumps();
+    static std::vector<myuint> find_reduction_table();
+    static const myuint* reduction_table();
+    static void polymulmod(myuint* r, const myuint* a, const myuint* b);
+    static void polymulx(myuint* r);
+    static void polypow_x(myuint* r, const uint32_t* e, int nlimbs);
+    static myuint modadd(myuint foo, myuint bar);
+    static myuint fmodmulM61(myuint cum, myuint s, myuint a);
+#if defined(__x86_64__)
+    static inline myuint mod128(__uint128_t s);
 #endif
 };
 
+template <int N>
+std::ostream& operator<<(std::ostream& os, const mixmax_engine<N>& gen){ gen.write_state(os); return os; }
+
+template <int N>
+std::istream& operator>>(std::istream& is, mixmax_engine<N>& gen){ gen.read_state(is); return is; }
+
+template <int L> struct mixmax_lanes;   // vector of L myuint's
+template <> struct mixmax_lanes<4>  { typedef myuint type __attribute__ ((vector_size (32))); };
+template <> struct mixmax_lanes<8>  { typedef myuint type __attribute__ ((vector_size (64))); };
+
+// Multi-lane engine: L independent MIXMAX states of size N are kept interleaved,
+// V[i][lane], and iterated in lockstep, so each step of the recurrence is one vector
+// operation over all the lanes.  The lane arithmetic is written with GCC vector
+// extensions, which compile to AVX2 (4 lanes per register) or AVX-512 (8 lanes)
+// when built with -mavx2, -mavx512f or -march=native, and to scalar code otherwise.
+//
+// Every lane produces exactly the stream of the scalar mixmax_engine<N> it was seeded like.
+// lane(l) is a std-compatible engine drawing from lane l only; fill_interleaved() writes
+// out[k*L + l] = k-th next number of lane l.  Lanes consumed at the same rate stay in
+// lockstep; a lane that runs ahead of the others by more than a block is advanced alone.
+template <int N = Ndim, int L = 4>
+class mixmax_engine_x
+{
+    static_assert(L==4 || L==8, "MIXMAX: the number of lanes L must be 4 or 8");
+    static_assert(N==17 || N==240 || N==256, "MIXMAX: mixmax_engine_x is for N = 17, 240 or 256");
+
+    typedef mixmax_engine<N> scalar_engine;
+    typedef typename mixmax_lanes<L>::type lanes_t;
+
+    alignas(64) myuint V[N][L];          // V[i][l] is element i of the state of lane l
+    alignas(64) myuint sumtot[L];
+    int counter[L];
+    myuint carry[L][N];                  // state of a lane before the others forced an iteration, of which
+    myuint carry_sumtot[L];              // carry[l][carry_begin[l]..carry_end[l]-1] are still unread
+    int carry_begin[L], carry_end[L];
+
+public:
+    typedef std::uint64_t result_type;
+    static constexpr result_type min() {return 0;}
+    static constexpr result_type max() {return 0x1FFFFFFFFFFFFFFF;}
+    static constexpr int rng_get_N() {return N;}
+    static constexpr int rng_get_lanes() {return L;}
+
+    class lane_engine // std-compatible view of a single lane
+    {
+        mixmax_engine_x* eng;
+        int l;
+    public:
+        typedef std::uint64_t result_type;
+        static constexpr result_type min() {return 0;}
+        static constexpr result_type max() {return 0x1FFFFFFFFFFFFFFF;}
+        lane_engine(mixmax_engine_x* e, int lane) : eng(e), l(lane) {}
+        result_type operator()() {return eng->get_next(l);}
+    };
+
+    mixmax_engine_x(); // lanes are seeded with stream IDs 0..L-1
+    mixmax_engine_x(myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID); // lane l gets streamID firstStreamID+l
+    void seed_uniquestream(myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID);
+
+    void set_lane(int l, const scalar_engine& e);  // load lane l from a scalar engine
+    scalar_engine get_lane(int l) const;           // a scalar engine continuing lane l, unread carry included
+
+    lane_engine lane(int l) {return lane_engine(this, l);}
+    myuint get_next(int l);
+    double get_next_float(int l);
+
+    void fill_interleaved(myuint* out, std::size_t n); // n numbers, lane-interleaved
+    void iterate(); // advances every lane by one block, discarding unread numbers
+
+private:
+    void iterate_lanes(myuint* out);
+    void iterate_one_lane(int l);
+    bool lanes_aligned() const;
+};
+
+template <int N = Ndim> using mixmax_engine_x4 = mixmax_engine_x<N, 4>;
+template <int N = Ndim> using mixmax_engine_x8 = mixmax_engine_x<N, 8>;
+
+// Ring of pre-generated numbers, kept full by a helper thread, for consumers which must not see the
+// cost of an iteration every N-1 calls.  One producer, any number of consumers, and no locks on the way:
+// a consumer takes a whole batch, one cache line of BATCH numbers, with one compare-and-swap.
+// The batches are the numbers of the engine given to the constructor, in order, but a batch goes to
+// whichever consumer takes it first.  When the ring is empty, take() fills the batch from the consumer's
+// own fallback engine instead, and counts a stall; consumer_engine() gives each consumer one, disjoint
+// from the ring's numbers and from each other.  The ring splits one base engine off the source, of depth
+// d + 1 for a source of depth d, and consumer k gets the k-th part of it of 2^(512-SPLIT_LEVELS) iterations,
+// an engine of depth SPLIT_LEVELS which cannot be split further.  That makes 2^(127-d) consumer engines,
+// beyond any count of threads for d < 64; past them consumer_engine() exits with STREAM_IDS_EXHAUSTED.
+// No lock: each call costs one O(N^2) jump per set bit of k, on the calling thread.
+
+template <int N = Ndim>
+class mixmax_ring
+{
+public:
+    static constexpr std::size_t BATCH = 64 / sizeof(myuint);
+
+    explicit mixmax_ring(const mixmax_engine<N>& source, std::size_t batches = 4096);   // rounded up to a power of 2
+    ~mixmax_ring();   // stops and joins the helper thread
+    mixmax_ring(const mixmax_ring&) = delete;
+    mixmax_ring& operator=(const mixmax_ring&) = delete;
+
+    bool try_take(myuint* out);                               // false, and out untouched, if the ring is empty
+    void take(myuint* out, mixmax_engine<N>& fallback);       // never waits
+    mixmax_engine<N> consumer_engine();                       // a fallback engine for one consumer thread
+
+    std::uint64_t stalls() const {return nstalls.load(std::memory_order_relaxed);}   // takes served by a fallback
+    std::uint64_t produced() const {return head.load(std::memory_order_relaxed);}    // batches put into the ring
+    std::uint64_t waits() const {return nwaits.load(std::memory_order_relaxed);}     // times the producer found the ring full
+
+private:
+    struct alignas(64) slot
+    {
+        myuint data[BATCH];
+        std::atomic<std::uint64_t> seq;   // position + 1 when full, position + size when free again
+    };
+
+    void produce();
+
+    std::vector<slot> ring;
+    std::uint64_t mask;
+    mixmax_engine<N> producer, base;   // base is only read after the constructor
+    alignas(64) std::atomic<std::uint64_t> nconsumers;
+    alignas(64) std::atomic<std::uint64_t> head;   // next position to fill, written by the producer only
+    alignas(64) std::atomic<std::uint64_t> tail;   // next position to take
+    alignas(64) std::atomic<std::uint64_t> nstalls, nwaits;
+    std::atomic<bool> stop;
+    std::thread helper;
+};
+
+// Many streams of a small N, kept as a structure of arrays: V[i*size() + s] is element i of stream s, and
+// each stream costs (N+1)*8 bytes and one byte of counter, with no allocation per stream.  Stream s gives
+// exactly the numbers of mixmax_engine<N>(clusterID, machineID, runID, firstStreamID + s).
+// get_next(s) draws from one stream; get_next_all(out) draws one number from every stream, and when all
+// the streams need a new block at once, as they do if only get_next_all is used, iterates them together,
+// in a loop over the streams which the compiler vectorizes.  Streams in block lockstep share one counter,
+// so get_next_all checks a single number; get_next(s), set_stream or a partial iterate give every stream
+// a counter of its own again, until get_next_all finds them in step.  Only the N with SPECIAL=0 are allowed.
+
+template <int N>
+class mixmax_soa
+{
+    static_assert(N==8 || N==17 || N==40 || N==60, "MIXMAX: mixmax_soa is for N = 8, 17, 40 or 60");
+    typedef mixmax_engine<N> scalar_engine;
+
+    std::size_t count;
+    std::vector<myuint> V;               // N*count
+    std::vector<myuint> sumtot;          // count
+    std::vector<std::uint8_t> counter;   // count, unused while in lockstep
+    bool lockstep;                       // all the streams are at counter common
+    int common;
+
+    void unlock();                       // from lockstep to a counter per stream
+
+public:
+    mixmax_soa(std::size_t count, myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID = 0);
+    std::size_t size() const {return count;}
+
+    myuint get_next(std::size_t s);
+    double get_next_float(std::size_t s) {return (int64_t)get_next(s)*INV_MERSBASE;}
+    void get_next_all(myuint* out);      // out[s] = get_next(s) for every s
+    void iterate(std::size_t begin, std::size_t end);   // a new block for the streams begin..end-1, discarding unread numbers
+    void iterate() {iterate(0, count);}
+
+    scalar_engine get_stream(std::size_t s) const;       // an engine continuing stream s
+    void set_stream(std::size_t s, const scalar_engine& e);
+};
+
+// Pool of per-thread engines.  local() gives the calling thread its own engine, seeded on its first call with
+// the next stream from an atomic counter: mixmax_engine(clusterID, machineID, runID, firstStreamID + k) for the
+// k-th engine handed out, the count carrying into the higher IDs, so the streams never overlap and no thread
+// waits for another to seed its engine: the lock is held only to take a stream ID and a slot, and the seeding,
+// milliseconds at N=240, runs after it; past the last 128-bit stream ID the pool exits with STREAM_IDS_EXHAUSTED.
+// Engines are carved from slabs of SLAB bytes, one slab at a time per thread, written first by the thread that
+// asked for the engine, so that with the first-touch policy of Linux they live on that thread's NUMA node; each
+// takes STRIDE bytes, whole pairs of cache lines, so no two engines share a line or an adjacent-line prefetch.
+// A thread keeps its last CACHE pools in a thread_local cache; the pool itself remembers every thread's engine,
+// so a thread which comes back to a pool evicted from its cache gets the same engine again.
+// The engines belong to the pool and must not be used after it is destroyed.
+
+template <int N = Ndim>
+class mixmax_pool
+{
+public:
+    mixmax_pool(myID_t clusterID, myID_t machineID, myID_t runID, myID_t firstStreamID = 0);
+    ~mixmax_pool();
+    mixmax_pool(const mixmax_pool&) = delete;
+    mixmax_pool& operator=(const mixmax_pool&) = delete;
+
+    mixmax_engine<N>& local();        // the calling thread's engine
+    mixmax_engine<N>* acquire();      // a new engine of the pool, for threads managed by hand, in the caller's slab
+    std::uint64_t streams() const {return next.load(std::memory_order_relaxed);}   // engines handed out so far
+
+    static constexpr std::size_t LINE = 64;
+    static constexpr std::size_t STRIDE = (sizeof(mixmax_engine<N>) + 2*LINE - 1) / (2*LINE) * (2*LINE);   // bytes per engine
+    static constexpr std::size_t SLAB = 65536 / STRIDE * STRIDE;   // bytes per slab
+    static constexpr int CACHE = 4;   // pools per thread in the thread_local cache
+
+private:
+    struct slab_t { char* base; std::size_t used; };
+
+    char* reserve_locked(myID_t id[4]);   // the IDs and the slab slot of a new engine, under owned_lock
+    std::uint64_t next_stream(myID_t id[4]);
+
+    myID_t ID[4];                     // streamID, runID, machineID, clusterID
+    std::uint64_t serial;             // tells the pools apart in the threads' caches, never reused
+    alignas(64) std::atomic<std::uint64_t> next;
+    std::mutex owned_lock;            // guards all below
+    std::vector<mixmax_engine<N>*> owned;
+    std::vector<char*> slabs;
+    std::unordered_map<std::thread::id, slab_t> current;                // the slab each thread is filling
+    std::unordered_map<std::thread::id, mixmax_engine<N>*> locals;      // the engine of local() of each thread
+};
 
 #define ARRAY_INDEX_OUT_OF_BOUNDS   0xFF01
 #define SEED_WAS_ZERO               0xFF02
 #define ERROR_READING_STATE_FILE    0xFF03
 #define ERROR_READING_STATE_COUNTER       0xFF04
 #define ERROR_READING_STATE_CHECKSUM      0xFF05
+#define ERROR_READING_STATE_FORMAT        0xFF07
+#define SPLIT_TOO_DEEP                    0xFF08
+#define STREAM_IDS_EXHAUSTED              0xFF09
 
-#endif		// __MIXMAX_H
+extern template class mixmax_engine<8>;
+extern template class mixmax_engine<17>;
+extern template class mixmax_engine<40>;
+extern template class mixmax_engine<60>;
+extern template class mixmax_engine<96>;
+extern template class mixmax_engine<240>;
+extern template class mixmax_engine<256>;
+extern template class mixmax_engine_x<17, 4>;
+extern template class mixmax_engine_x<240, 4>;
+extern template class mixmax_engine_x<256, 4>;
+extern template class mixmax_engine_x<17, 8>;
+extern template class mixmax_engine_x<240, 8>;
+extern template class mixmax_engine_x<256, 8>;
+extern template class mixmax_soa<8>;
+extern template class mixmax_soa<17>;
+extern template class mixmax_soa<40>;
+extern template class mixmax_soa<60>;
+extern template class mixmax_pool<17>;
+extern template class mixmax_pool<240>;
+extern template class mixmax_pool<256>;
+extern template class mixmax_ring<17>;
+extern template class mixmax_ring<240>;
+extern template class mixmax_ring<256>;
 
-//class template mixmax_engine<256>;
+#endif		// __MIXMAX_H
@@ -0,0 +1,275 @@
+/*
+ *  MIXMAX
+ *  A Pseudo-Random Number Generator
+ *
+ *  The code is released under GNU Lesser General Public License (LGPL) v3
+ *
+ */
+
+
+/*
+ skipping coefficients for N=120, m=2^51+1 and s=1, low to high order, a0 + a1*x + ... + a119*x^119
+ made by skipgen.cpp
+ */
+
+
+{
+
+{ 895897082019222427 ,  580636580715745748 ,  2288254068336235187 ,  965401936318469491 ,  1973316999723375076 ,  164152839571145245 ,  6519031178471806 ,  629384954749680470 ,  234246045655110094 ,  1157772014347709385 ,  928848987667495755 ,  1288584350585021212 ,  1070131408494876406 ,  2039023492464366691 ,  324626559044489215 ,  1952750500135524815 ,  437384490822162679 ,  747590733633380028 ,  267474452726930359 ,  339747955970238074 ,  1425841212333011729 ,  1366419431556758111 ,  121079091317627818 ,  374730818629509240 ,  1090983448058084124 ,  140359408148537988 ,  1755525428005979732 ,  1087346453891040877 ,  1264550733342361096 ,  1192431149704302329 ,  2046828625935984874 ,  1179909888141147933 ,  2201508200382715471 ,  1756242839763484686 ,  1046817113536476180 ,  1067384137060160114 ,  1251678004743235778 ,  984888032248366397 ,  1183218191732492997 ,  1456998720054625137 ,  945934910327246797 ,  1923324136051679382 ,  1258397328750084177 ,  731723736587382610 ,  39992913143728100 ,  1604504470189620977 ,  2283681275539214487 ,  287662220247623982 ,  2283063064011239439 ,  90110230075152655 ,  1050642969499338838 ,  812525851104631062 ,  832018939593016312 ,  2171191555753490259 ,  1075319417343498480 ,  1215621293511114866 ,  670153865126389490 ,  458115496960167128 ,  1535469352351503233 ,  1370104248303041029 ,  2265412824271294522 ,  1912967180263095085 ,  1993081734739448655 ,  1532254411216182496 ,  671697726835096816 ,  2259921561530223137 ,  823620434614027892 ,  1354426897741139032 ,  1912102073580318866 ,  1629897236661744182 ,  1023028529817600765 ,  169603505490904603 ,  1676179141464960740 ,  729627210425439034 ,  1865328923031945006 ,  2236448432972748037 ,  419967488146211718 ,  833615615977677917 ,  1541049629788524205 ,  877161499892764160 ,  1971087933120871394 ,  477633248550844555 ,  1626323974500755720 ,  2225633794658001588 ,  1943425317927775578 ,  500910850355779656 ,  544314321246263578 ,  886614808089053967 ,  1017555463639383466 ,  1903426338539065774 ,  1691305057874261898 ,  237228495344930749 ,  544879652126363887 ,  1950572844487642939 ,  1579736376624091759 ,  564830595912040782 ,  1494652088258386580 ,  952817788176536674 ,  935739220115777752 ,  719044470934368642 ,  1946190122855839900 ,  1144361801951907329 ,  1146889553313991833 ,  2114440288270521481 ,  2159935678484996012 ,  707045248147971062 ,  1468228649447317100 ,  2215412084963166529 ,  935831222408619755 ,  1311163380102959289 ,  52140361995859198 ,  127358166903450662 ,  1604270895047097680 ,  1153732886677013632 ,  1315591933032232721 ,  66919867361383403 ,  622726476185482804 ,  1201962576317920097 ,  1900263607494437459 ,  1284605399704580155 }, // x^2^512
+
+{ 1620212012116333262 ,  630932424959165431 ,  1947386387303284157 ,  2298827532386152536 ,  1131644803661633806 ,  1062209135256923996 ,  2103276771966972642 ,  1251955605929606117 ,  1967980416840740154 ,  281479066669594434 ,  1553372666887980889 ,  1270284232958430145 ,  265855992334719738 ,  1305002622553461073 ,  494325542878745991 ,  764170134516675261 ,  1673170110449632800 ,  67172776572022625 ,  1832188495506623919 ,  679671694661299603 ,  239791379165892095 ,  1693752928732304202 ,  409698131830810549 ,  1348806499710705744 ,  2027598763300410111 ,  2061539552210312482 ,  2008535046880746029 ,  19043831198679665 ,  1750673640704544543 ,  2161026956988570378 ,  254869619254918870 ,  2011303452389595203 ,  637566770225061943 ,  1256454775365208762 ,  1944367106552000947 ,  1778652335459579612 ,  36667829977780757 ,  1528063948003873734 ,  1319875925848305991 ,  628773744166052022 ,  1192884593264163083 ,  304918571484125238 ,  2102620325409009978 ,  411352564666122687 ,  1621848850001440669 ,  2148156222965373671 ,  1024271557321011566 ,  1748336272351713361 ,  1163871345098619718 ,  481955205715833618 ,  1819992150148541607 ,  131989751552571222 ,  1092413688433487342 ,  722668169780767152 ,  1737184506644902112 ,  1517502459959955105 ,  1384175204185844541 ,  655932787965383304 ,  1509444480829857085 ,  2068208860355324646 ,  199944408621151382 ,  578099764109358124 ,  456148718283244473 ,  527018341805505881 ,  2292875954591361713 ,  1496750960554294159 ,  1729882016773790119 ,  361139556086706363 ,  1181244717374641060 ,  1345225580149934277 ,  1679293213088637137 ,  1069650237824510425 ,  858896480434955348 ,  238115325459884542 ,  535323358891273776 ,  447935130429688227 ,  2240186734564156547 ,  602877213539482128 ,  1139808629214978746 ,  1516659285088002994 ,  249620332339549079 ,  149473665648545731 ,  1660863631804542398 ,  1381408982363242155 ,  1323714359156272592 ,  2224772272499264996 ,  1741797725444745498 ,  509359849806450515 ,  530063653120252288 ,  1476201382410668320 ,  104533976687682154 ,  90760751540393517 ,  2090895675843593429 ,  1154124417896875962 ,  397883573851321866 ,  2138135087337010919 ,  1893590978249525486 ,  240300875713027505 ,  1657716867309127914 ,  801594695848915456 ,  678052671687186477 ,  918093586216656086 ,  1482369902990861571 ,  1408254219126744393 ,  937889139304251969 ,  1694339232007598676 ,  90920742762362476 ,  1229555814276257660 ,  1479936545514443648 ,  1730707018277321431 ,  450005278242295003 ,  1917353479382463190 ,  2193502419337389226 ,  873977135742238441 ,  1395026236330190050 ,  1959480073694386841 ,  1489486403469011011 ,  1859362064548173798 ,  235836318074082570 ,  1459566636863526598 }, // x^2^513
+
+{ 1203478404775160164 ,  784010501172128775 ,  2194127112423956697 ,  834547157550004310 ,  1945590506496673707 ,  405133005459182599 ,  614070769093779420 ,  1829995397291106384 ,  226042177011480759 ,  422131276330421587 ,  1189810845049899740 ,  1483373304793047107 ,  1929109421442641985 ,  115459072289368820 ,  1123689799304664165 ,  869790755908543165 ,  912697081626767967 ,  1197287112568516526 ,  1578028348103647089 ,  1389263615354220056 ,  1295506015629466982 ,  1171994452866030312 ,  70804950749774405 ,  725599409796769021 ,  1886813229759971184 ,  835868374758336103 ,  338546242169529653 ,  998340754074525599 ,  1229481811198668859 ,  244654269487948517 ,  1703060925513682934 ,  2039688005394549999 ,  1899384981190609519 ,  1890759232665905096 ,  1572728509898562032 ,  1152902116480173988 ,  460015518557647280 ,  1119240196007839416 ,  2293248331958281083 ,  289535911803197892 ,  1665692900884061975 ,  719371452907478222 ,  2234545993599293781 ,  949255221190966523 ,  1564007814179238787 ,  2090546739470887270 ,  358909326528879419 ,  808952420592233837 ,  2080966193193351234 ,  1592586252525555890 ,  773874743221616822 ,  378062523582767844 ,  764169042312555304 ,  505129268232635560 ,  19780444079613743 ,  2219045238515408879 ,  989155051944148831 ,  1329554973804040257 ,  184456866689588608 ,  2304142970130761665 ,  1919616397046593418 ,  1019389897722103746 ,  419727991669922459 ,  1530727315402708221 ,  1733033376635284909 ,  1311677875933981772 ,  1587926419484549517 ,  1734219697849922968 ,  1393145956901544741 ,  736524074481529199 ,  1110399357859172716 ,  132258036702969982 ,  1140491726558598507 ,  886341826556201626 ,  16736654325430023 ,  1332934194520452666 ,  833092434587895556 ,  1146197573260923859 ,  816522495466211010 ,  1302582203335800610 ,  67004188285513479 ,  1868816427024290241 ,  839183805925188666 ,  1539709066536173820 ,  679299118432670208 ,  1632260640683029940 ,  2212542677717978228 ,  275533885177794044 ,  1025041901898746911 ,  634921210978923771 ,  1313073587356537354 ,  394049427588087152 ,  1878773519324429450 ,  589608743344279950 ,  1396737815864868387 ,  531725581685428849 ,  935487807935745275 ,  336200554607586660 ,  1061383705226780637 ,  1860671355454766843 ,  1052914623347761948 ,  804822977780348622 ,  153638176387808055 ,  1901040112520926106 ,  904945029668063903 ,  659346110019201258 ,  2008377214323271625 ,  935933413449266915 ,  2274054416132590218 ,  1105500475307538610 ,  113772467639147059 ,  1947726237421868205 ,  377176338617012566 ,  1004886934508695873 ,  1791260206434929923 ,  2068067352219403816 ,  2089574590289409070 ,  110183525528457251 ,  1308138454558928754 ,  2125619850920101441 }, // x^2^514
+
+{ 1559982953427561825 ,  1119136821376310318 ,  1017366504922603125 ,  1778712691795061229 ,  461940044175948992 ,  493823185666061498 ,  2055262709452123694 ,  1860231754233259565 ,  194511002097770796 ,  1053868462084637764 ,  857740213360443978 ,  2246283847622090455 ,  1555088552762011846 ,  1627578766744152273 ,  1529158679128265020 ,  437399299618678821 ,  1818710936368857434 ,  1780025799131409423 ,  1760673725228275323 ,  1285631797190431038 ,  1256598412408086159 ,  167462815694776961 ,  1768423152901376020 ,  2249223521999587382 ,  459348778420821562 ,  1011069166212378048 ,  1702255488278002276 ,  728696241133767115 ,  1197713450015347049 ,  543666596500817273 ,  2283506877649031844 ,  216423862455450107 ,  1972638938176270344 ,  1499653332123562318 ,  735443210664163553 ,  2140827412492491017 ,  240543649352148093 ,  495038387104267733 ,  1184652186142904816 ,  1738972126267599139 ,  1084262981253476187 ,  2015357687018928979 ,  706094096036075963 ,  1677710606409738804 ,  737526201303944941 ,  1300443218191542389 ,  1273624602619578104 ,  35925543097469383 ,  2046781273031185204 ,  2110998760051234700 ,  580523529815837197 ,  215185570428744524 ,  1254148897835700461 ,  87589589408496483 ,  898998970148973288 ,  2030543469466396579 ,  1310667285592826460 ,  1415470922913371956 ,  911734037023869333 ,  1074643230356610870 ,  1703206519489490083 ,  317563282813387771 ,  1588653504886434801 ,  1377081506100247203 ,  1074766604013889090 ,  827028124300375229 ,  1144620500306900264 ,  1839839038097775653 ,  708945796587694629 ,  1348187501088168106 ,  722450301577113040 ,  1726042108870944043 ,  2273208330358301019 ,  1108607664084298758 ,  2062418062657955731 ,  741882371244268906 ,  1231885333590670521 ,  873299694094020639 ,  2299911707761408340 ,  1371595844477623790 ,  1598305086282882905 ,  409384606736734574 ,  365977561026525442 ,  506266846604644663 ,  357826404388234495 ,  861622765361329082 ,  770376110259829885 ,  94791336802945818 ,  1618321080957268838 ,  1158664502010632752 ,  2139338194739005503 ,  195030773983637743 ,  1326464355350882756 ,  1905355553038269545 ,  1169004885671396792 ,  12805480058381376 ,  1097592807015432313 ,  674055543241405609 ,  1696507142871053592 ,  1754438953235825551 ,  13036437955662925 ,  1754865525814802741 ,  463700560645817342 ,  1112105898584521993 ,  941290993655994998 ,  1314439340199641056 ,  1619779853765133324 ,  1479788743154265214 ,  2025209051166797848 ,  1381062839891428494 ,  2156027431643918197 ,  1061178067960834492 ,  434510112844709069 ,  1994295732377770006 ,  2204537780107285707 ,  2066710954090313971 ,  260150552189972504 ,  1208538684961531702 ,  1947611434269959975 ,  1892054203583731125 }, // x^2^515
+
+{ 1026994564680471469 ,  1724381806166110869 ,  1266756022599530971 ,  1455128381733329602 ,  812932640096433667 ,  32447225892719688 ,  1737425639709963472 ,  980975325267402727 ,  1189631104079544385 ,  539467919478794211 ,  641285704643928012 ,  1895533037257327729 ,  361280386714875509 ,  171026719808560123 ,  2131254225328902482 ,  2281055409820800574 ,  2227234756786981864 ,  2289641972597996466 ,  1109116798111403852 ,  2165954156896079985 ,  631982341747260719 ,  1926547345629874663 ,  1263284919055691671 ,  1480645155949199524 ,  1612030106451996437 ,  680952618259906877 ,  1131481523280369381 ,  1763331551512395987 ,  58189836741082245 ,  1609871779153348796 ,  1340542984904125576 ,  1661227570624085611 ,  1419415081995180800 ,  319735541713428408 ,  1546563566922837937 ,  2107814360248023717 ,  786192936100472562 ,  1553754459992557403 ,  2174853786228034849 ,  1977550439314738776 ,  1126726601880682073 ,  236943104085707304 ,  1206444212701585893 ,  1183616945511986531 ,  1579400269952444734 ,  2301391607939943345 ,  1667585572699816833 ,  1983965644536907394 ,  1106974940664427573 ,  1629513271232584423 ,  584220263380888516 ,  1060942703251429874 ,  1795214116026870676 ,  1043587660260168262 ,  1340001204584187872 ,  903233382442576750 ,  71089036331648005 ,  1423215780363633839 ,  361361817259404708 ,  1605080812274829701 ,  905650501895304981 ,  597420906409305528 ,  1145489594804073597 ,  500645960812896243 ,  1607348333891686519 ,  1920194205869433975 ,  1130326625199899593 ,  331794611502580723 ,  2139519261936776651 ,  555117862226609447 ,  1363209323739581255 ,  1386500393173562348 ,  635135633303540084 ,  1210521122798719301 ,  1879947847790425854 ,  873446092016727821 ,  639121857118686452 ,  1300602329955111997 ,  2305024598057662663 ,  1900921601584623087 ,  854388256589088663 ,  652550122777693013 ,  224157817905980023 ,  889339766585506020 ,  474328100866317282 ,  619554270807719822 ,  152089518971224515 ,  2248641558586361804 ,  762747842264968122 ,  1315869364735576905 ,  1255385747333436716 ,  2266242195374647401 ,  729443725364415239 ,  757607779516904785 ,  252109743284187133 ,  588063560262729321 ,  1845240701153450204 ,  1062538930659313770 ,  2181839280089288373 ,  764176680810824812 ,  1140160499008111101 ,  2224240255094669881 ,  392415683702449398 ,  208646339998075827 ,  589449472086741989 ,  2147507467840416031 ,  545876899323581815 ,  654480126945725946 ,  816035787489383538 ,  277147234302518486 ,  130000269179921014 ,  1597400695041447523 ,  1191726142114452582 ,  1999491677809833406 ,  2220643280943882209 ,  2226198593909710842 ,  1475928474972787122 ,  1755117689434839804 ,  822754731020163250 ,  1181635514471703588 }, // x^2^516
+
+{ 1896029166277166245 ,  2160403782675643495 ,  31286408276833655 ,  2240057581246073459 ,  2269918752462389363 ,  547782974138582794 ,  173647870716249620 ,  842401169463947137 ,  190931973222059553 ,  2072974729387935383 ,  11310385502673949 ,  1226992688179050547 ,  1101225471285855069 ,  1711656219567346038 ,  1415676721605204797 ,  165536018542190960 ,  357328930037838124 ,  695089560011764970 ,  1588235910512074717 ,  773156785363417488 ,  700806417094446074 ,  1362358508884458668 ,  46638136254884778 ,  304187877187421507 ,  842849884007402487 ,  324654492026680012 ,  899722819102133840 ,  2157133935268497601 ,  1770489971254758423 ,  1419104301931269306 ,  199057001427345041 ,  271435216338968044 ,  782590133810982123 ,  91605795332259826 ,  1525881438552896903 ,  594430833654103271 ,  376685562737952242 ,  116586830694800857 ,  347722169226583256 ,  234452307560419733 ,  1600760124779808106 ,  1390630617611163239 ,  1146705546570206680 ,  1357054495227938764 ,  1151108459574231178 ,  375093663978195141 ,  1167881426142937391 ,  336307713275970368 ,  2094599019615406618 ,  2027199470188627610 ,  1219320572416419396 ,  1674366492255451568 ,  2121782818364783812 ,  1077444663275113657 ,  1242725066142755875 ,  782860623325633899 ,  216066756888898015 ,  2231654444192792778 ,  290269996670010451 ,  1838885571612498922 ,  2128961794359498020 ,  698161059711698341 ,  466070199570074475 ,  1192884740463914873 ,  150595877947085913 ,  897326535080214969 ,  583008309336120707 ,  91789381301867684 ,  82243300962079084 ,  1644514520695397804 ,  1645628969043263970 ,  516373536360571263 ,  1205821577439417900 ,  917349934990908612 ,  931054831836247850 ,  753824126969496891 ,  714127773841377933 ,  346117521558719246 ,  216594984252451581 ,  823876572217923184 ,  727274891004727297 ,  1599165561512880731 ,  1241587740860523595 ,  579078759181793771 ,  1992342363876733940 ,  2258853577341235007 ,  1743030617885580416 ,  1645380151428854335 ,  2234033497451860954 ,  464959081213504336 ,  2230448680212755305 ,  258349091662287250 ,  742774597243966471 ,  487662868004863099 ,  1147607812266454706 ,  83988934668211620 ,  594099268691859798 ,  1159102988976356749 ,  493077976941722368 ,  2245719296205606953 ,  780278364019004153 ,  2074878069408770187 ,  1452768886046792359 ,  987462904442120188 ,  853556544380733335 ,  950005456426726027 ,  840326144193529580 ,  2236477536971596942 ,  720846087458323575 ,  2209105730495608180 ,  912194440793078424 ,  1104290948940466133 ,  1545748365580519502 ,  807062522674029909 ,  975050132173539978 ,  1916330789121586686 ,  673833530451008581 ,  1251004537072205903 ,  1012486608309738677 ,  2085161995731709516 }, // x^2^517
+
+{ 1839338975168295964 ,  1138496459328814940 ,  1077947595746404708 ,  1642935275737733950 ,  340053681583466598 ,  1551298677468096761 ,  3032101924017106 ,  123807282496194056 ,  983897891984382108 ,  2076840357678739998 ,  1903412192565957475 ,  1746803107878607652 ,  42114130959890616 ,  517715752670164787 ,  428340066122556287 ,  1385394781027109954 ,  1802471160498249555 ,  327315301612296535 ,  1283180619675188519 ,  299216422572770525 ,  895644908344145566 ,  586765558651459467 ,  449945120899041986 ,  1975556706815012115 ,  1009319635523627819 ,  1183157384975638731 ,  2268629769761112193 ,  498731621826164742 ,  1349891529442454319 ,  98554911007863835 ,  765810519824875297 ,  1845177772331282802 ,  619850428483490285 ,  376143741710236709 ,  2233889698273209664 ,  364158402339287291 ,  1165237384861895170 ,  2011017340636297372 ,  1929260523283576784 ,  119431034580123666 ,  543281617463602627 ,  168153418443349590 ,  1154285108694009757 ,  1678804305832484343 ,  338092697631660265 ,  467401691360893644 ,  352718879078185837 ,  765383908597380133 ,  805773304918561646 ,  1895013166079890027 ,  670869298197579129 ,  1034377755351608764 ,  351966774443634543 ,  1613873398084210035 ,  1951408989070202917 ,  526151550811703257 ,  831333440877076980 ,  934729455282983063 ,  2116440163253695021 ,  1222018914987702236 ,  625218210042025857 ,  551445993517664580 ,  1418410873133375287 ,  1965637459889855332 ,  1582391310242693951 ,  1408603777962653422 ,  227063693221739895 ,  478336687548776760 ,  1294064530868401763 ,  689017017264012128 ,  2044530898222016454 ,  64856316516373138 ,  821432461242936800 ,  619442111589409838 ,  887021874946913751 ,  582305952464177877 ,  316494166832082001 ,  92508750901135930 ,  1427975228775717872 ,  1633310614578639825 ,  783895521621100088 ,  2079095295928244397 ,  2053651689769468720 ,  1460834182310149978 ,  1302413354889419262 ,  1256835628023983026 ,  714556380774978410 ,  310648657990829762 ,  59742934058215006 ,  1576604905199693847 ,  536357662500271168 ,  1132116969747503152 ,  1303700616106532123 ,  2164981723531983346 ,  1344753532766527593 ,  1473566532306981589 ,  1062816570422768959 ,  714823085328229089 ,  49279191376025115 ,  2116857084107829437 ,  2081646334387001980 ,  1949597502217153365 ,  1649100131880114763 ,  354716387273160769 ,  235861240523644978 ,  1446868136398478327 ,  139356420121787607 ,  1216055323729187978 ,  1174898585164950429 ,  406339726012643437 ,  711555449259890909 ,  1434020556180263129 ,  467551161601290177 ,  1869952572936496015 ,  1266452008417567652 ,  2253468120368584820 ,  695543352166735056 ,  891088096340291175 ,  717946616703289031 ,  122013066050003007 }, // x^2^518
+
+{ 780631323869331342 ,  1452110613661994246 ,  432118856086324797 ,  873951722543362590 ,  173980997574547158 ,  587270079916248080 ,  1200646338720332142 ,  998178817338510275 ,  783556569968712689 ,  1600174645546798753 ,  1411555337600492423 ,  727483320948364896 ,  189507642981427755 ,  1421066984077934996 ,  1265633595614423035 ,  1635126784605484384 ,  1969990553087086480 ,  603802679963259013 ,  539639664296205122 ,  1676483998235005621 ,  660930607571487914 ,  1334044588014080189 ,  1594861334292737155 ,  2044660264537530503 ,  272309591929098578 ,  1134747813067083861 ,  394292983113839269 ,  2043512669610553381 ,  269229765735158299 ,  1145301873220660435 ,  2009751244014122858 ,  1513502012991878289 ,  643054102377501109 ,  2012873769852193267 ,  1693382472730971746 ,  1459949505556237472 ,  2271085255972043178 ,  1084004257090372073 ,  577248714899581836 ,  1419174096490967840 ,  1288019133837089760 ,  219829405447313464 ,  12081088891993020 ,  1932039044001174105 ,  104246240713986056 ,  963477323501038631 ,  594317229233545645 ,  1664336743498147140 ,  1447046516906515341 ,  1507494149091503800 ,  2194718420973310969 ,  274061363568304330 ,  358004821182291113 ,  1589100660834620382 ,  2025484091946020120 ,  2069348230320970624 ,  1879580170708860918 ,  1895058297681565332 ,  1180714391956644986 ,  271287959421261283 ,  926781709760786084 ,  590375355089797673 ,  138649781859776306 ,  1797194170424834365 ,  577337117918715556 ,  316464347778483442 ,  1197419981923106415 ,  1161012969760973500 ,  1551405975915062776 ,  1928594223127829694 ,  625590680673294038 ,  2106246563917303349 ,  1373359258102095680 ,  1009096947255453321 ,  565819189556687842 ,  1371921074196703215 ,  1791927234359443028 ,  1718194698781473460 ,  423308614147710688 ,  1816847272347730560 ,  1258733220666330703 ,  55214463650105166 ,  478508178463136437 ,  1154094194093263817 ,  1316388520856850520 ,  205104408918813395 ,  843408862555535136 ,  1525468826066892525 ,  2281040382827354601 ,  421352940067589235 ,  18132869621286134 ,  717696233883049818 ,  252609711272903535 ,  507877715454339857 ,  1064592330091038116 ,  2153010912686935243 ,  2207834490152257413 ,  825771318960943243 ,  44584497631224791 ,  1764778033243138131 ,  660791436372390908 ,  1070249173254818289 ,  1814917938361945033 ,  2007951142243553803 ,  1546560140050721354 ,  379639825408043192 ,  1470713614082035043 ,  212193471562018587 ,  1322687652386156399 ,  1350728681199067466 ,  878445984799600637 ,  1194220339160945753 ,  661989428488127127 ,  695577984700076273 ,  528993776935632999 ,  2263776367518332444 ,  1467543469670002122 ,  2222363005542483068 ,  907091485224890358 ,  1106940252327266583 }, // x^2^519
+
+{ 1127777590160062370 ,  1097418065243546625 ,  1473673776726154533 ,  71127462088766141 ,  2009734608854063512 ,  1715864819877273241 ,  1770246474444070295 ,  1539849555296112978 ,  668773837849944110 ,  83774317581307965 ,  1477128400654806069 ,  1711522829435431224 ,  1185709334904204382 ,  1224588179687384759 ,  1336665408352628960 ,  915578971027171777 ,  298476356300211670 ,  501579263128243324 ,  1090383149974372312 ,  1640561030924802583 ,  1448407690808267738 ,  1656877581370925773 ,  1018953994042898096 ,  176096184142801877 ,  614476866027342819 ,  1902261304773048095 ,  1820181547795593180 ,  1566881526710080253 ,  2107710609704127117 ,  41400571614241577 ,  380297324833564889 ,  67655874989693241 ,  579903347776471721 ,  1188145861434290054 ,  1217803843702232747 ,  1518314856273367856 ,  1989109935471232078 ,  1534475755508332616 ,  1492845440392489989 ,  2301997165386430251 ,  312167996680511918 ,  2173460131254874541 ,  1555443386407340073 ,  2013689735875409294 ,  775763927025166001 ,  109852542105441600 ,  538870114689891108 ,  1310084802178508842 ,  708804855646986674 ,  556038586299654122 ,  835860769927000944 ,  2170323219589254614 ,  2300678004466224004 ,  1345296060365584971 ,  1313620495114704010 ,  1488109004992749378 ,  982399812570079500 ,  715102397253264141 ,  373408403300949320 ,  822911840687945572 ,  2272863090519799682 ,  2224604078957459857 ,  1868849710970939004 ,  393649811289968318 ,  775198459001872125 ,  469405287507080957 ,  635940198985910671 ,  616018623381752772 ,  831081741105637476 ,  989903419777183315 ,  102242426891293417 ,  1792865435339126238 ,  1234835781298096424 ,  440688202623361867 ,  112331584011930526 ,  1698173085934881489 ,  1943720546781081753 ,  1281257964465318842 ,  1676527284260312688 ,  675528291739508577 ,  1579186364526737468 ,  57522099506174893 ,  1910552190648936139 ,  1804105102979526441 ,  2117786887302734223 ,  1204113442625055868 ,  1301785528622552561 ,  2178228411502887184 ,  1926472939503391176 ,  710706068689712687 ,  1534994159921245691 ,  429457255168449716 ,  619322904727250606 ,  474973420479929764 ,  2205989774013319282 ,  2152107247399552187 ,  599255681328753902 ,  2242640656429840022 ,  23279979931738543 ,  122842265660141168 ,  2276852648905141211 ,  1658304655079739368 ,  621389212381621101 ,  1169677846729124960 ,  1796891783911764512 ,  1602747623297172093 ,  1399039172033218025 ,  1899578061330322281 ,  1513149512547460154 ,  1565811113412847073 ,  1317134962132355221 ,  1158936851000124599 ,  1711965057058558548 ,  1189466240678403871 ,  1926517520361300919 ,  1898724843573491611 ,  1820606862987050385 ,  1882184492523436664 ,  1872322958768495058 ,  1610514190984436419 }, // x^2^520
+
+{ 724026518328892962 ,  379957676950797274 ,  724919478887730158 ,  472975992783592658 ,  593612020960800616 ,  1456834514552346754 ,  1946377004912439859 ,  673898745540205651 ,  279429043397046552 ,  768647813552346549 ,  592097573548863528 ,  173513865214341705 ,  475562488979854846 ,  934009730317861685 ,  456146148258843221 ,  633132426558248615 ,  1326377829137591663 ,  1117331615965010525 ,  1656352867795424146 ,  1992896870587077782 ,  1344363538616333588 ,  2287564297516653746 ,  2046308682132745601 ,  92038432477493823 ,  1457454642656730837 ,  1050876328848797599 ,  2231197795821053201 ,  581016205615057213 ,  1371891979736180666 ,  573939674887977694 ,  186467058095101731 ,  1654428849323728589 ,  710626718076315386 ,  1174045045014317673 ,  2295374212450559608 ,  198973381753634496 ,  10280067463894726 ,  2275371366327114631 ,  1836550121329678812 ,  1770511973810326685 ,  140371738598480601 ,  346623656359519048 ,  47426399212790170 ,  572419339970249290 ,  567903026285596762 ,  94123437446241233 ,  1561143157708895809 ,  1804519574684310501 ,  924612570375193693 ,  1716068672922431926 ,  167721230387853810 ,  1645078138276569707 ,  344586704239511213 ,  826045492336262419 ,  1852049996405316100 ,  509183723076136835 ,  1000013263323123220 ,  1791695780920767476 ,  545244411873418657 ,  2081096946068065819 ,  1544565618425038985 ,  434441112548682359 ,  1985616758461195003 ,  2177785564725295434 ,  920213635697386468 ,  2089102595976519181 ,  1880459157919665864 ,  223323466157172692 ,  1794606101579457623 ,  377321836203443633 ,  899394424506348404 ,  1236129201882686716 ,  963942833023837890 ,  2200869154767052674 ,  2199246219113310860 ,  2240638320301032351 ,  1566537577638278675 ,  243200065497074869 ,  1966860069095473834 ,  1700591289620947789 ,  202578719358744626 ,  1179906541701901754 ,  832702963030320453 ,  690222370717742612 ,  1681640830021875797 ,  1784227314314090368 ,  1432690403933005808 ,  1118989623063186945 ,  1660326195507920976 ,  466340762491722051 ,  1446826403967981254 ,  1215369919513647101 ,  49373087626061852 ,  861956306669007249 ,  1545086987482637611 ,  1243898038992288608 ,  1745494146618753613 ,  980952403305754249 ,  1220752774694895652 ,  1603509714907834693 ,  1129806929704133758 ,  1316055545883836738 ,  125471680696819804 ,  1854806924161230203 ,  289773322694080838 ,  1131925041928174169 ,  375937144071068877 ,  1374675303725489358 ,  455457200636614247 ,  229554195716522439 ,  1121087307308485929 ,  973483698343227223 ,  2124768735164080378 ,  1843222603101473593 ,  1148923090557430843 ,  2118270929825268353 ,  704548568689829817 ,  617484970102579441 ,  550586857043996571 ,  623010555971711979 }, // x^2^521
+
+{ 495276967897597408 ,  413834061166714712 ,  1503123954999397323 ,  1262151182634593668 ,  922049622294970354 ,  109970608687739522 ,  153147930112263174 ,  470503054763442094 ,  749810162809810696 ,  636734089911904584 ,  1177715452689890348 ,  820997547815314309 ,  1245635664603149195 ,  1927812725274758346 ,  1827293545822608226 ,  438510366423506030 ,  36277537708982409 ,  1673661024905975883 ,  1045311588001918380 ,  1679075932341174073 ,  204567285423675311 ,  1985105519916375802 ,  1873774512091385218 ,  1560122790800585763 ,  285486881572543149 ,  191444450139570314 ,  2273651208160777339 ,  959758333506196825 ,  1865875969328809364 ,  1200608302785260768 ,  643405798417251781 ,  1571531811066648988 ,  820621674777912173 ,  546578002979324796 ,  2292938326272166913 ,  1108894273090651323 ,  1311657384318295950 ,  895087052583383273 ,  632991975566295884 ,  881342164781758357 ,  2032571895699704411 ,  635793650161475992 ,  1916228053877830284 ,  254136829910779662 ,  1315110273427664868 ,  913293276033273553 ,  306575611495299243 ,  2011250219682876153 ,  1227167435740038790 ,  1091334571921192643 ,  1247827782978439697 ,  567810825075576567 ,  1907605503266954708 ,  2063604591955083340 ,  616417014461422192 ,  2023676263110537620 ,  676585167833052959 ,  914260785800282824 ,  2300167185139152096 ,  1087523965025037234 ,  893887218883549537 ,  2106051747858004374 ,  302173484907805275 ,  2112666042804720149 ,  1170722391947811477 ,  1055088438179717754 ,  1481039181992460516 ,  1478222880085457621 ,  1137712441773335281 ,  1139197323917391353 ,  1116304377736859398 ,  687564401573127791 ,  1549662549138099073 ,  1453759092924965157 ,  1135581682784485147 ,  1285514164267763864 ,  1645993215193408829 ,  167617992512006157 ,  1394321213321051607 ,  168460241915805906 ,  1879168172342164363 ,  1935142201162427887 ,  229355966363633882 ,  1738127349816156714 ,  1922099655472737946 ,  998235813395189399 ,  134884872298143749 ,  474899733381553551 ,  179955919409702270 ,  2032181234387584977 ,  1804874701135231712 ,  1872344716320113993 ,  1487685907542486046 ,  1613337156120806575 ,  880758703221435685 ,  1020634709069310573 ,  1811511602203405255 ,  682860497462050289 ,  1243832245435035454 ,  1289894252938971072 ,  2060856876790272553 ,  1889680992319930189 ,  725233809779949030 ,  1988859618269071397 ,  415330011678449064 ,  49284093253058545 ,  200810100857673990 ,  414722331418762184 ,  409507140254773051 ,  933638393320103921 ,  1967237211342137049 ,  2164659361736350547 ,  1407207543112701856 ,  97580054243075835 ,  1401406802447937146 ,  65705274490949436 ,  742806628693690729 ,  349660514699658485 ,  1749379224722081098 ,  881701419339219562 }, // x^2^522
+
+{ 1604726645370932305 ,  2240704622776292728 ,  1117617851883261120 ,  1845738865935941172 ,  793484875477090924 ,  872530936761933175 ,  1978035295568469268 ,  101190749026589375 ,  1205672765117950690 ,  733794862308923537 ,  950212356760321124 ,  1750750983091555397 ,  910385791858648372 ,  773144092077917722 ,  634423196143340568 ,  1935959909229989641 ,  1274295545766748250 ,  1149966875189256278 ,  375504339204519498 ,  312341561471945681 ,  1819718105074293925 ,  906825750764051996 ,  1250520419364093270 ,  2057095455083395644 ,  146815916941481724 ,  75996446161809064 ,  1707687748257086616 ,  332821385862409851 ,  263771143255684364 ,  2273008601115963622 ,  2209540565182051444 ,  2070814628543460725 ,  1827578059770720951 ,  568322007700465317 ,  2062997659560929342 ,  1429114683331527154 ,  724273959190305961 ,  31032677967729899 ,  2224635969562216934 ,  844448486855068126 ,  145140081945792124 ,  2076704735389637102 ,  1975902260424057593 ,  2165813880126591827 ,  2112014299489595487 ,  530189705395368158 ,  841198683161553414 ,  1997447214262044499 ,  1612559802795145165 ,  126639713703318662 ,  415670498597400479 ,  1974178628001180866 ,  1335822861328171720 ,  1719225065140806860 ,  396848803616731715 ,  1852654908697565199 ,  611809769479444216 ,  232082120053473989 ,  454594679934981602 ,  97479376468701121 ,  212061626250931283 ,  264857566968064146 ,  239587280104758612 ,  948747652564289977 ,  955119870590076141 ,  995392973823952632 ,  47556816041716034 ,  1444258856210929803 ,  2131374095328234183 ,  13791265759096508 ,  1433046482651234396 ,  1832693207447758509 ,  356208897306367038 ,  730536502785653883 ,  1135386416308703823 ,  1652521032348944919 ,  330829522346858110 ,  2052653954842948610 ,  2139427424325452546 ,  1359193239192420384 ,  474217519841052330 ,  1581702961377099015 ,  277728923574399668 ,  845359491375124929 ,  1027160822852582152 ,  577886752792528766 ,  697888101842253054 ,  656232863544893299 ,  1004494719310899742 ,  1219635157205151375 ,  1167803991213174241 ,  1980950635810249009 ,  1364811642382995708 ,  941172854037041511 ,  719359191191778256 ,  2126472428951295141 ,  1894925775001259255 ,  1718470283281545331 ,  1687123988318613330 ,  1731565485235049860 ,  1436053411189530846 ,  2137406832391411898 ,  1697769353926191766 ,  2053487967516013806 ,  570099566129186195 ,  2061098224443928737 ,  1708150957643589551 ,  1986388255313726920 ,  455822237474222229 ,  1221897294769161703 ,  1689798500868704337 ,  2089752157850004358 ,  297772331845630633 ,  1441279873278298491 ,  1387963273494062037 ,  598348288151978473 ,  2176128206665206626 ,  787216099772764761 ,  1047471215735083262 ,  990450953591797120 }, // x^2^523
+
+{ 2122065684555863418 ,  555125599252432780 ,  1974414814598363962 ,  1605699259919963963 ,  1698609386791968031 ,  2006310734609799182 ,  42202789386014800 ,  1164013327163128705 ,  1720034172137049498 ,  1084904212294453140 ,  455811210825469300 ,  1152218564242733576 ,  2252386290273344274 ,  2090036321733376450 ,  1223501116839924471 ,  635335726776354743 ,  592825871486022504 ,  955022857470346596 ,  962657461706140409 ,  89149013092382459 ,  66206089598860675 ,  703735442006469330 ,  1394673008892791102 ,  665785088192601852 ,  1589692669235208978 ,  1064059360404782994 ,  786174636982889465 ,  1507406392282800726 ,  42911483757645711 ,  207657991124013439 ,  1515926016488055333 ,  265386424679473665 ,  1097419628531732139 ,  1302113960657843206 ,  1973770538679559013 ,  839594359467543722 ,  2016107009038009381 ,  1371069516795855390 ,  1440238133796073545 ,  521180952352599512 ,  551961504238621624 ,  932243934616699913 ,  2200557583116614187 ,  710802888573888848 ,  2267372118211466134 ,  166143193274423668 ,  1095122056675714931 ,  1454958739090076986 ,  99354695118748206 ,  815119567486252824 ,  2265179502100573125 ,  1280319307112010724 ,  569285089493831725 ,  1232915538763116057 ,  1428806590765914410 ,  66906275298686742 ,  882054008277014750 ,  172095074442817682 ,  1046097043358571017 ,  1542390275845946526 ,  1730477461385717518 ,  2177773103648601197 ,  1051649152286927148 ,  520932810197625310 ,  2095669313601314247 ,  220238797734944245 ,  1478834482782732777 ,  808212363984494332 ,  2305571732039697970 ,  1735038305097054365 ,  563217814188388352 ,  1966383470553750985 ,  1606166847319842051 ,  488303033884082476 ,  2024891174333318316 ,  2081802814820588345 ,  2289455664096142602 ,  1623500858255617464 ,  1215782687975086501 ,  1061622855474513465 ,  1676334356208752164 ,  1000477388878864862 ,  2194981022969818972 ,  624828668756920479 ,  1355375497206651565 ,  30138198500483813 ,  445741115558018252 ,  1696678740129404597 ,  1806194311970884034 ,  296904167628282036 ,  1614644370856495849 ,  1514652886752553979 ,  1127246022028223229 ,  2073616387507758079 ,  160535678484262420 ,  1463298692103593905 ,  955836969646247766 ,  188534361737395412 ,  665701490337530550 ,  463751761807516328 ,  1952961099141311928 ,  1589060185521482956 ,  909075287582705556 ,  1116278803123922984 ,  1256158301019788703 ,  1074585465243037176 ,  1041468099330488325 ,  499153683756267723 ,  550187444321592366 ,  1918730082614330281 ,  1088930966638567933 ,  901534944318744790 ,  1910064602944545810 ,  1308060769773116456 ,  1078432336001455797 ,  125172375178483659 ,  2038379427261545650 ,  1314542853332090528 ,  1026778399915305385 ,  1003878690915581715 }, // x^2^524
+
+{ 988072801542266913 ,  1680519369566417087 ,  959091028676314055 ,  1116732783406963595 ,  98908787180116022 ,  1444433655634138606 ,  1080027748235017455 ,  641321859070160308 ,  533452848442359878 ,  2282702091176478800 ,  352216390225995672 ,  1528953085959850206 ,  1845688468377907133 ,  2205359139043075067 ,  905778912387904065 ,  356475624430921889 ,  628149389114775837 ,  2220744761377958181 ,  2017325608047119271 ,  2024510163836385808 ,  2191970794212461486 ,  691110939153149695 ,  999910014562045924 ,  1858575747082062877 ,  446785921961821232 ,  458773626978536991 ,  665748478645351851 ,  552325232298952551 ,  836724744101662943 ,  12663819230087860 ,  1390398257719585031 ,  1215577597558751870 ,  100560384730462082 ,  887088982946438783 ,  208728821298235480 ,  1222364363519081136 ,  1756072546850253000 ,  1824992135100217875 ,  162808118794818851 ,  470188214035583595 ,  1872938766145522609 ,  888267920539388480 ,  116145001253385960 ,  1662159266153567993 ,  126463371195750142 ,  972801899374001234 ,  1817477006652759294 ,  1113992417580410874 ,  514625814630554809 ,  1880563392808775956 ,  264012598650573975 ,  399724879187660688 ,  1487943203481329895 ,  2113205233672793673 ,  1130453977906120343 ,  1723272833088918195 ,  1277040038470525525 ,  350781182185155557 ,  769230336591868419 ,  2208497068475135852 ,  1465916486083797936 ,  120812169356030774 ,  1956045513282531724 ,  404906872635196610 ,  256686630568507831 ,  1177648956429910711 ,  792828044294393914 ,  97996865436620018 ,  1171321085794639172 ,  1073268555554929381 ,  135315307109745118 ,  1302490493657723990 ,  535710288829107307 ,  989709592179821589 ,  1479070425968078780 ,  2271954702920160020 ,  1537442605374811314 ,  295259823554661041 ,  1830080047781379851 ,  434435694127577598 ,  476204830195007193 ,  1645583421228935337 ,  810533002871563953 ,  2204603619708697952 ,  2249289607405254702 ,  1402778217474170883 ,  1227418600352954221 ,  223619767581792673 ,  135644921572350643 ,  1545231315093766477 ,  137278870021219863 ,  69863049826101979 ,  1038251962801855489 ,  1938289668158898208 ,  787788686780358174 ,  1064276268287815507 ,  2186156268728028170 ,  971551592609450033 ,  1268852811562989000 ,  1821264847213577579 ,  1490059038641260162 ,  1383094055322306844 ,  2142589792408826408 ,  773510865353182561 ,  691850158687014288 ,  1945066144354305562 ,  235526290156696370 ,  1033063808601481828 ,  532621819232633331 ,  1293615431915358951 ,  1948606082873235546 ,  1088737719367629282 ,  1998576480209637096 ,  1572214501662989897 ,  1283660203579818874 ,  1757425906216544584 ,  1439584856088904779 ,  1711373389062702683 ,  1823813638487303961 ,  1631024193374379595 }, // x^2^525
+
+{ 1341584835191867677 ,  1554796055913309281 ,  448909809272166023 ,  119310573690080389 ,  2262969898376954280 ,  726567651528232470 ,  1045375594910600828 ,  816425760431671171 ,  18479367083045555 ,  887697819889830483 ,  1578680560626281907 ,  97270577925060792 ,  860932637230402868 ,  1113937558266240373 ,  1248910014255067222 ,  2060011865695501541 ,  2237047369322421852 ,  1370438567624461611 ,  1099589546134249616 ,  150773957876007534 ,  887086828969932954 ,  1714319069061620925 ,  1459337495127483058 ,  1591737072822000176 ,  1212145371728540699 ,  1842227502247332672 ,  1925205420965338105 ,  1359405456113573714 ,  253590725862414888 ,  1030775157415196525 ,  1973727505959723227 ,  1939645366066937107 ,  981828587979419741 ,  233000363009673416 ,  1246463176145507200 ,  1769333968372759163 ,  1171794147829257775 ,  2126953893505796973 ,  1199815620877221300 ,  1963985183678077558 ,  2105006597154217097 ,  1554110514916201219 ,  1597839162810054056 ,  1305586381801150581 ,  1742912950330530073 ,  2018889732457692009 ,  1467532047031529887 ,  512025248049978930 ,  433039265550566731 ,  1303992186118186199 ,  519929536028553229 ,  1271920446317311791 ,  2296015409445693410 ,  1971785327668153979 ,  1979545293308365486 ,  1380813772334672067 ,  1055843074895666611 ,  25138514739359995 ,  1413941540441709924 ,  1751005299852955335 ,  298257931536619614 ,  1059618869134536450 ,  1522490166180426731 ,  2301937779756036680 ,  2120861371215470352 ,  1732457020171379314 ,  802527701153162575 ,  1115205401429087715 ,  442618099374147096 ,  1913217361357539807 ,  2054698185850207547 ,  803190567841403549 ,  1833679303530169863 ,  262463538592364625 ,  920388691087492866 ,  1787226694654115187 ,  1490366187907226403 ,  2144506505995970521 ,  909993247482539169 ,  597609510898241111 ,  616366461053004978 ,  193162012710267506 ,  1551200720381908513 ,  1007521254423147310 ,  1665973637407010692 ,  1222011964527035284 ,  408048673806781947 ,  876866766280106602 ,  236383283817221952 ,  404137325363044646 ,  1030087300299135680 ,  2092884771890619395 ,  276507239515635592 ,  533174334730699774 ,  745544514188588542 ,  458976085883880167 ,  1575304523956632851 ,  774219096481451514 ,  1356264448504131773 ,  1436013305035613129 ,  136669685682060560 ,  283542110931910337 ,  781926891285048581 ,  479031161968716798 ,  386749911326119552 ,  1445248497027942511 ,  599090413099392675 ,  1855849132000058969 ,  2112080872684045910 ,  1866225414350484394 ,  488042306222837172 ,  192798380922230472 ,  603975650597068252 ,  1958602368073030974 ,  1591945453902818025 ,  1127514010640997722 ,  1679869425269612383 ,  389849789321297433 ,  1934542037969838854 ,  145020121636457865 }, // x^2^526
+
+{ 2042151139995533838 ,  181542646291694845 ,  1294812854695476729 ,  1221296790367320339 ,  1039924176930979879 ,  1332021224016380355 ,  140694815694745762 ,  2100281088109488242 ,  793927893969866528 ,  819384897776526184 ,  1511851302734516352 ,  665790337422456088 ,  1001783494485146076 ,  384710854635340219 ,  1458735724730460570 ,  1574853406700669000 ,  1904073003622489453 ,  1520159697994620245 ,  669760679440321967 ,  1226284642666707564 ,  170919911694199312 ,  1630526697469189595 ,  1332153587479728234 ,  683690297070382929 ,  2129438374281228161 ,  788272377582037184 ,  782634960549054857 ,  1362872419994572216 ,  1950256503955747753 ,  1059465468715894649 ,  786836310532812647 ,  1460997524277735121 ,  897964619740238478 ,  927282945267547943 ,  1061639242752619968 ,  12458287035850597 ,  91562324326674105 ,  235427774098335509 ,  1665011297616912550 ,  1693026449917151297 ,  1521358510824508960 ,  470158525063429411 ,  1196415055372517952 ,  1575129049008142778 ,  1047277072462304021 ,  1605772716666799584 ,  298024196341608350 ,  953455224048041687 ,  2269939125838783917 ,  963772629013751910 ,  2019997962633802604 ,  520657768083321657 ,  64745916011091532 ,  2067379592690162162 ,  1514143232518568105 ,  237928932346065729 ,  1218435315759405112 ,  2151220513592474095 ,  27857187954628033 ,  556536275434308090 ,  2284356156643017677 ,  754229239550069441 ,  1589970442585560105 ,  953262472558135829 ,  1357213092682513097 ,  803566360607982295 ,  1428616380253686696 ,  1206869410704305655 ,  903645030677068750 ,  629234470685136521 ,  1520063461430688283 ,  1066123478962929277 ,  1814425852246786833 ,  102823714576572015 ,  1315600156508015336 ,  249669867849697789 ,  751675250977584602 ,  1233898415293588334 ,  2122453701762083645 ,  366018579059563897 ,  244808766016077659 ,  363299452616405306 ,  1065558264043004457 ,  2030821559132362202 ,  1010059892707942858 ,  1772380546282456786 ,  220032711202498918 ,  1128007553602531428 ,  1573879860620271272 ,  1603981655580189442 ,  359893781173463972 ,  1804568369904597603 ,  2008469393011206063 ,  178647908986560157 ,  793935584733510036 ,  1982811601295727244 ,  641361788217218400 ,  503362074474259212 ,  978822335030099183 ,  1542873651039890971 ,  957245616239246501 ,  1289068910307730393 ,  728342592699922659 ,  850111538110418091 ,  911324307865500102 ,  1965472517896587133 ,  1256199187665400109 ,  514277834919757116 ,  1232281192323026428 ,  1136059219128185765 ,  731245388593098195 ,  2258905515949287509 ,  1185442182957344802 ,  1317868717744027579 ,  749717031517829479 ,  1466468709174726020 ,  809688512143678064 ,  1994396649119339570 ,  2081301476640140887 ,  2154906809969095552 }, // x^2^527
+
+{ 1813701267072122085 ,  675217284108828654 ,  1726879774763042263 ,  940188176379131897 ,  1093769250213375525 ,  1866025089218180580 ,  1353079909914692504 ,  1712278524281371485 ,  1042745191665453039 ,  1324246445976840957 ,  1383961645713794023 ,  230697958008620498 ,  1164380728743349414 ,  1999838873499361379 ,  685289660923258325 ,  493942747698823406 ,  1324439928426426106 ,  320349974972930094 ,  318610545347225361 ,  469074332669539099 ,  2241186172038214849 ,  1917817625474683490 ,  111744111934243558 ,  1747845261471659647 ,  547632526230897445 ,  1101195657734216009 ,  1348487975014279895 ,  1852285422600840323 ,  811932190898145738 ,  168423184441186000 ,  1155388781730210645 ,  1154536158705071657 ,  1792065333446513481 ,  1687661019432724920 ,  32927631899392308 ,  1126862569538161103 ,  178406538892697036 ,  1528663518651871101 ,  1499446882874012563 ,  625947072346743891 ,  670373896802806046 ,  34878947861595168 ,  1183431879509684591 ,  1489277561778834043 ,  1584519588298849762 ,  61129778996370147 ,  2276983186995777044 ,  725063535627672994 ,  439208650987879381 ,  1241467219020802340 ,  2273826852157217199 ,  198211956194627997 ,  2131661925237221016 ,  1133563527425550197 ,  960054989080927834 ,  1648095206884504313 ,  491954963454453325 ,  1785584165437000949 ,  1965850973173268640 ,  1538629120362018184 ,  2084694567506843372 ,  1797661466486493743 ,  313890199618160825 ,  1549066346640872795 ,  2223811305983374696 ,  1240194596215382547 ,  1383950573238479463 ,  416857963908855339 ,  1202193338466789193 ,  1649521493745245743 ,  1455522241165402830 ,  547472709535766640 ,  941744375537243660 ,  2300566029114218943 ,  272791268698806688 ,  499783614377323503 ,  322976245285028600 ,  1379777096106507711 ,  811252937706915995 ,  1852698800397164384 ,  1397719363070873879 ,  1498947335554445454 ,  2120012863664444703 ,  1275688737074788712 ,  38236848639430338 ,  996838346604309113 ,  1341398897228675077 ,  587644705583220318 ,  504603222126610194 ,  2032366154488289821 ,  456974908292502836 ,  663821143128468024 ,  125112179483645027 ,  583999404209726428 ,  2258199920122869474 ,  59846558716024970 ,  749202798813219620 ,  615282345489717784 ,  1859073421471382427 ,  1428107820082349030 ,  2267267970473035720 ,  2122507814749957502 ,  945843026587875352 ,  2057148139620806938 ,  214589313153137778 ,  317880572431221218 ,  1387394085156731828 ,  1651424890669977579 ,  1579034129877411182 ,  1891642207897137141 ,  1408308507287717100 ,  345290877793173945 ,  782635741543611357 ,  1053321577180878808 ,  880571622711251453 ,  2238617290389263625 ,  1041855559903275383 ,  686448710969155821 ,  2097121146830119715 ,  1803285410085852307 }, // x^2^528
+
+{ 14558928415963584 ,  497085381047185714 ,  1890061966485334716 ,  1517705558351993938 ,  962696267731794044 ,  837879176671369651 ,  2005857433321764946 ,  223147484194232567 ,  734236301755353764 ,  1715814669877423722 ,  871724260659186737 ,  612792852864957374 ,  378207223676650214 ,  898697271774658819 ,  787185962659730522 ,  1229745534324003806 ,  1223033681632841170 ,  69972059644573414 ,  1688281721532255262 ,  434607830441952508 ,  747902020099436237 ,  180018688315755097 ,  1451305813219867524 ,  2264416115645860767 ,  625520151802663237 ,  262381517773400966 ,  1351717229195834024 ,  1022066715801003211 ,  816369943442199529 ,  6496928591371325 ,  191051800647972790 ,  1599034542384986084 ,  497505430146083099 ,  937808102653911376 ,  1938713543814577607 ,  13844165446068071 ,  263572261898948527 ,  1575214405173245236 ,  11936645649168796 ,  2141631928946363611 ,  1635806636251545879 ,  1265989283017746011 ,  30722411795513244 ,  1333514379394990823 ,  1738263503903350934 ,  211680682988017810 ,  1755284287301612148 ,  772947707256557865 ,  733620977432084152 ,  768697418928729825 ,  2209719160690711011 ,  403855292706048233 ,  740859379497486228 ,  1969409497580579999 ,  1390064894542828773 ,  226223335018250664 ,  1314348409117517490 ,  1976887502567082520 ,  2059643713445520147 ,  679871685788532544 ,  1917592937066948034 ,  428538599232878731 ,  596036646080920658 ,  2002924852939545886 ,  338306219590167880 ,  1503308481994229196 ,  1090226319025241405 ,  209604956976918016 ,  236274470065064262 ,  1739454667877469678 ,  1147977089668086932 ,  16130181875331897 ,  2023163831868802275 ,  205628531424910897 ,  90463380191760726 ,  313913477147555801 ,  96890885678145149 ,  801207653973975521 ,  2127936760420649073 ,  2260193023352295293 ,  1085077632606858174 ,  2057843565376269972 ,  1609603559740975410 ,  115895200115041152 ,  590906120126377187 ,  1951526287281261702 ,  1476044349236254883 ,  89713973398874912 ,  155562269635878286 ,  2202805807870533015 ,  522920270520256288 ,  983376353144558125 ,  2132040408715793677 ,  1419331166962359120 ,  300792109035985737 ,  1970365877908696420 ,  350751176920293178 ,  1544780555454381098 ,  2121319045770006275 ,  1055056120444832312 ,  702255159786185123 ,  1711936275404716436 ,  254250405799269621 ,  2016123815461310229 ,  321154281854559015 ,  33321394597780334 ,  450746635566154352 ,  967098324045539900 ,  446683641488729879 ,  989824632961934763 ,  1497761613707713804 ,  1166438548575811711 ,  429187954854038968 ,  246277297264179199 ,  605259287254871826 ,  1425544452317541105 ,  828128041740572127 ,  946245251738313482 ,  1137675667252042927 ,  1006909058106340073 }, // x^2^529
+
+{ 327034562918285096 ,  2217713262562767662 ,  308216371727640958 ,  457659285555662528 ,  691195387878105001 ,  1992536049713291617 ,  1214584920875822044 ,  1504441185496555957 ,  2206757436792716148 ,  164300384815509255 ,  1502310829374631142 ,  1400625134966942383 ,  2103249632895827902 ,  1366352893754570324 ,  966408283567783129 ,  2028711560951663261 ,  1837738834647510777 ,  1022971425830276121 ,  344682077898273814 ,  2087928266643030243 ,  2074264234473413209 ,  699022852977617743 ,  2009203215784031120 ,  2038719563170083740 ,  2044230104177340360 ,  168281466944832797 ,  278435551613778044 ,  1243191646984245244 ,  974290438157827069 ,  367475878904364993 ,  306989353367000097 ,  1094306715838175703 ,  1147683802462263916 ,  548000149280497440 ,  2073188112817599062 ,  1359414509133855740 ,  924883430075993944 ,  1080022464021220860 ,  1802672809261635487 ,  1989662001271755726 ,  1142154743641676463 ,  746299026209308558 ,  869372312776611423 ,  473103614479332908 ,  1722230235635324475 ,  841261132480534866 ,  1587746089786285236 ,  1499582561582043707 ,  962167131205842076 ,  1995291768540500678 ,  720587310902625698 ,  2237412781799284347 ,  2199925336193425188 ,  2267273905496712731 ,  1384435940572400629 ,  2304202658905659264 ,  437613673912826848 ,  1781348126071205020 ,  1259866568402272709 ,  38484745005353919 ,  1646490033802548139 ,  971878189188661085 ,  337237464235159270 ,  2115079512105324320 ,  1579844653708426017 ,  2057477914819044312 ,  395282770443823741 ,  634509791669513546 ,  101309022156685163 ,  952513839874481238 ,  1853347374906857015 ,  138385358772733185 ,  1867813563846356513 ,  146275708686282116 ,  674239889787662175 ,  2252336312912088460 ,  1462020979825749338 ,  458027662931385694 ,  195975000851913389 ,  835320998658754304 ,  708195368613428818 ,  1988126689550149852 ,  1329399795856282013 ,  1402322520099320373 ,  1737786045625086949 ,  737605218137322239 ,  1781386863001277817 ,  698403683640503752 ,  1623076533285420906 ,  1633222307008371059 ,  1844689538486751805 ,  553989449805278572 ,  1495145753177466561 ,  357118310844997068 ,  690163615776013453 ,  2232925363286813555 ,  1492781807774030013 ,  1292004419302583990 ,  289321406455148792 ,  793908270081383429 ,  1917592535552663721 ,  1556846359619483536 ,  261495019583449771 ,  2135699561137299649 ,  497810270704239060 ,  875130483489928831 ,  591259047620738092 ,  925195429043020583 ,  1239088496786242300 ,  2213519617817799336 ,  175873342185450420 ,  2185261552387915855 ,  1216300888675004239 ,  2084626254902277843 ,  501215958254336665 ,  2105676647955656336 ,  2096846102502551697 ,  697699673686476876 ,  982758191817023019 ,  716150862543611298 }, // x^2^530
+
+{ 869157208239403818 ,  1517265586947615367 ,  1401076200567134166 ,  946687227006101992 ,  241370827693737869 ,  1521055301201306781 ,  1436504686510212489 ,  1016835090968617481 ,  889275767179753806 ,  458727659284493530 ,  481432531261003590 ,  1107638533904463197 ,  1590428771057740762 ,  947997473749110186 ,  1423773665748983641 ,  924684460818128339 ,  1299583670965470339 ,  1686053318582998092 ,  1498447508927774543 ,  197799264215955916 ,  1764527933997169406 ,  1087917553248181894 ,  110866014649742043 ,  880468029833445965 ,  2078480619236620741 ,  860513943058993529 ,  2218282598443543852 ,  1940711047752715170 ,  1222738504769048984 ,  1383328418324389239 ,  850544275838204085 ,  1858860982505919146 ,  568464578565562239 ,  1022363616121378211 ,  268418074804884068 ,  2030764819996357371 ,  867316943655250412 ,  1453009254537349647 ,  1845624833383574341 ,  1934108483844388395 ,  470478181783319374 ,  2023612662326547031 ,  1215083332106258607 ,  2154267924958149171 ,  1563119121329983432 ,  1672587674838881017 ,  1693974193139975896 ,  745734489548832876 ,  28467145588460789 ,  977714417494698067 ,  708169364686039063 ,  1714721936054625120 ,  373208515136943382 ,  578167949076575151 ,  2151099976728723549 ,  1181546794483773699 ,  1638376363436254184 ,  1350059832045104065 ,  611784252918902661 ,  1016806084695195012 ,  1219329209475818475 ,  1980359955693610779 ,  1807221781663277664 ,  2144750247641198173 ,  1141384463034306947 ,  2179381311619014800 ,  1813044549795882341 ,  82792740925074039 ,  230562154189438811 ,  1208126404111326840 ,  588180515591334835 ,  1190704503346838137 ,  446238836507865464 ,  2136580059789497587 ,  2147370102785269883 ,  2156800003540491045 ,  1671503117342387028 ,  251864670934686242 ,  977292623017754075 ,  259544040523206383 ,  1759820593920253355 ,  2237965402259037065 ,  528389732840009470 ,  1697144486460550536 ,  1537485601896638497 ,  441443651286998186 ,  201621003714429815 ,  725151884135084645 ,  2295636149310556485 ,  1785598449550017454 ,  1015016599680912902 ,  1341844838342153451 ,  1206232897622320958 ,  185350611955779001 ,  1623043840992167469 ,  750446388580639605 ,  2003177748833991090 ,  379548366822218917 ,  2056633793910491286 ,  1093896064887536516 ,  1430802589785930769 ,  143024171841789664 ,  575964836902275535 ,  2189583124345078460 ,  44857570867926210 ,  2221013224071599638 ,  1650957537061622631 ,  1739008693100130919 ,  1032973116749224488 ,  2274034197434915022 ,  586385727241080820 ,  832945853526501942 ,  2095835949707443026 ,  1619507267862894842 ,  2073971253499023578 ,  1662168615189021568 ,  284392704203552885 ,  1485938919885257734 ,  265083885604783865 ,  291377387593389508 }, // x^2^531
+
+{ 1652165082553627326 ,  921953378493271143 ,  1709983562253462873 ,  827246130854390303 ,  448803968045886990 ,  401668865155795227 ,  1190110515311850849 ,  1997933535870726667 ,  62075787893052724 ,  834304453488394605 ,  2093923754126335753 ,  737967437411994802 ,  116755414716884936 ,  2180989514224290240 ,  1961058561838550300 ,  826069049980811543 ,  368141783937399380 ,  2088793499336150892 ,  875544986890141844 ,  1774880514822564629 ,  36689832408105818 ,  241560351283492163 ,  1566924310199111040 ,  420857697591546446 ,  720349631417041208 ,  299921093114304454 ,  1675414839504946684 ,  1286654887312917180 ,  325055297015878785 ,  781827167874839083 ,  816904108773568193 ,  54945530452459536 ,  702837300586119352 ,  1558429990919071440 ,  2275347444214374957 ,  2031953451354824605 ,  2240453334784856708 ,  29932765146029411 ,  754261559061892217 ,  1205090025139449927 ,  709435192704556261 ,  187052923317701890 ,  705201978491779350 ,  741278418734037620 ,  1162109918702341637 ,  1808830749051077097 ,  62302648475793339 ,  1833580868257753247 ,  1121497501653440932 ,  2057637020106970529 ,  592900772094383636 ,  2100269345459080986 ,  711634076788742924 ,  2269527570473400570 ,  1827765529833044196 ,  354361250183092165 ,  1994149647541809898 ,  1752494304664100052 ,  1504912676192474339 ,  1984203287405254905 ,  2254784887720114992 ,  1606499603845451591 ,  1114975897793822959 ,  1892502249547549844 ,  1437816433777487035 ,  2285660061740832413 ,  2123621111739760664 ,  929426481056319141 ,  952195895296850563 ,  1818072450484034909 ,  2029028369918500575 ,  659302195973329887 ,  1383749091204072774 ,  143754854769820095 ,  2200661840652318963 ,  1184461764351564483 ,  454362025446718603 ,  1714168633485762556 ,  212502576651267881 ,  1400881324716535168 ,  2225602956269082404 ,  2250560675638919382 ,  230669264147388396 ,  1936026336724594770 ,  1709182566033801571 ,  1774217684875938958 ,  1221755241268038156 ,  256581185498723134 ,  989405019017006933 ,  148700690875055732 ,  1655399407847858273 ,  2016354436174202649 ,  599479159038939964 ,  1654867386960517084 ,  1231773101245762088 ,  1165392141937672339 ,  682482597037818481 ,  925053275168431785 ,  2209425060628708781 ,  1101016306634984419 ,  848838945620081200 ,  1279283824180750728 ,  50484625355914735 ,  1096020472583459655 ,  864020086426384469 ,  712468002966828608 ,  884155204597708565 ,  1224585132518996398 ,  894589472645384539 ,  1273433994302287380 ,  1296234951186950229 ,  2085946342617228176 ,  1716980370543077953 ,  18238400693723342 ,  2131064526413577798 ,  1011430469242422371 ,  416280270433323857 ,  457208610093405483 ,  585079521968866209 ,  1970216684332549429 }, // x^2^532
+
+{ 1543713872410492340 ,  1763374543456598183 ,  1534993733655028968 ,  723972281126521114 ,  1950859096783492522 ,  1277505614780280384 ,  2191820002879013834 ,  958145699495804521 ,  1009302407989595088 ,  1583048126222856215 ,  516854358411478860 ,  266009736851256937 ,  1534974087416435893 ,  473044574522144913 ,  2006959099030946972 ,  1801198504452462757 ,  380097288759522660 ,  542528021963421639 ,  1594913687721832624 ,  304536197811457316 ,  1987375239682308990 ,  1766541727845626716 ,  453433830140555129 ,  1485666718361147143 ,  1121795744821977517 ,  583808786069083675 ,  1476391258223131433 ,  220931749596042146 ,  2235013979260318056 ,  1412212421718009782 ,  766600066045201798 ,  904709519882848511 ,  1607896072163966912 ,  1026526489520671673 ,  852298465424673546 ,  47184126186476883 ,  1247609905634164364 ,  299779148688591664 ,  1785752965504431079 ,  1160622417157550832 ,  1089450592464309743 ,  975714635628739566 ,  817488700718198812 ,  1476037577948750168 ,  397951439413846838 ,  2083491215606327358 ,  1455536019427187403 ,  967577266508109078 ,  895646035037211812 ,  1481332028578949458 ,  1369970166843054296 ,  483473900602840933 ,  862728944164592857 ,  1031938131620477442 ,  1746008223715957973 ,  766593072852396857 ,  1265367956522014273 ,  806291242342305749 ,  323737054368016052 ,  9025837355445304 ,  208215803907824117 ,  396949365984521378 ,  1216747313611815054 ,  1929993598824792287 ,  2034524949078879706 ,  943259141664665733 ,  1574217357774967633 ,  183319677841578043 ,  1065841346922599127 ,  1378971916184430047 ,  697990457180621554 ,  2104725725709105352 ,  498208972689519446 ,  1178547549897941312 ,  1804482251733125799 ,  344458374997615367 ,  1655822775006594639 ,  1467812597543738660 ,  1275504927846290255 ,  1343745723622561660 ,  1917474979168457442 ,  1908365385539248716 ,  884627065860290311 ,  638761649956285558 ,  2181995301587118434 ,  1307869112659582087 ,  32254608024778304 ,  953007451077362286 ,  164771019503654447 ,  1744699136003211296 ,  43512597212114675 ,  2167786693893636625 ,  601718670241444818 ,  1930457662339190781 ,  50697313119177058 ,  1458317726393178002 ,  1688682494426137841 ,  1651020833424437452 ,  1224629481019069053 ,  1655824355673649473 ,  597836591835653465 ,  789919329998351040 ,  1951527762328240960 ,  1962718015201207000 ,  409186847357905965 ,  1991711756418756549 ,  2225468681276395003 ,  1577007236825743522 ,  2237804797466039364 ,  1441721233602345976 ,  548475396276080387 ,  815501008760597731 ,  27872624744143907 ,  1744378864519153512 ,  855330374289056662 ,  53080131453129534 ,  649693795701757040 ,  2252106637585052459 ,  673255770563779020 ,  1720989956995285689 }, // x^2^533
+
+{ 1949928564579791888 ,  518059213908031388 ,  885663478263150469 ,  1402352334973830343 ,  1563736507364391656 ,  60771245072676011 ,  1143834876150379984 ,  404854070557367816 ,  1789276952701051026 ,  324091817455733751 ,  1294532997151008346 ,  1754457429887608427 ,  1339706239467440409 ,  2209223845961551523 ,  739543252586328600 ,  1037631105542168422 ,  1269268085011271394 ,  1287073531698922596 ,  1803695153249995965 ,  2066795206303536141 ,  358321233732298378 ,  1989526130097498535 ,  705526566567905476 ,  1154573276621885770 ,  2226013076726192158 ,  1667767022557551993 ,  574475166041803872 ,  745387008254304375 ,  1341603572714363888 ,  1511065311473824221 ,  2278548026014525214 ,  97508724883725209 ,  429942146852605841 ,  1789291625282277551 ,  1216921526980611476 ,  827314475084218871 ,  1674820721003215208 ,  742661144699297438 ,  2101623437788693608 ,  1192500354314379746 ,  1733084765265985840 ,  411508151710525593 ,  685748387303558784 ,  2129636787947735760 ,  2112350697715027276 ,  870349064021784323 ,  661944680463539851 ,  88800973702296884 ,  1602686037933181532 ,  511674731947091067 ,  942202906820904350 ,  884199600868333344 ,  440824969587942707 ,  434250181061081266 ,  1787515001917469715 ,  920500778380634116 ,  2253275277798360814 ,  1252596132919931698 ,  738051147787092129 ,  697591712949073641 ,  1550613811513206836 ,  513263288734955004 ,  841406330853301102 ,  745261149345532022 ,  138020870676313958 ,  563044603830245036 ,  1521564300116111154 ,  1610765321347619418 ,  1627893874904710906 ,  1394423245915689843 ,  955853140303341077 ,  1084785449052919116 ,  1058815283513085607 ,  2232467377209586471 ,  530921883659320568 ,  1325763501175773774 ,  1338774996621354027 ,  1943686524159333262 ,  573731674895847464 ,  236608163386556886 ,  795890924728510158 ,  1516876976463530046 ,  1846265577696603915 ,  952703708685403902 ,  1341973018908333056 ,  654815328146151389 ,  66638820379508773 ,  2145464659627626378 ,  1830256954223632269 ,  524131594728674386 ,  746050858691203202 ,  800733500862272355 ,  1395883498905697962 ,  900501013560851849 ,  1314095013786831534 ,  1852973040929127338 ,  358920245204021522 ,  2039791329892371098 ,  944448108101829819 ,  2034349701701875122 ,  2124216806702723892 ,  730137474577903236 ,  649823728088180468 ,  464683387431797012 ,  519848495739576937 ,  673132159733781283 ,  1499111737664160850 ,  1860695080240719846 ,  1456647780128231721 ,  355314339102948749 ,  362956398640546637 ,  442454594350188577 ,  164508015984291874 ,  896935502419498201 ,  477817566108231730 ,  41088650877392867 ,  1524769018304066669 ,  825893365100001390 ,  2044617699391323568 ,  1300393629842370357 }, // x^2^534
+
+{ 1017102850821529630 ,  99485078383729974 ,  1604349335137073057 ,  2143458387205995497 ,  644163900986581200 ,  1409396895892166396 ,  126082046555175348 ,  32484037045327184 ,  1111937845671988564 ,  1996551513624906130 ,  28618783688254590 ,  1745954485265406949 ,  764213709057385305 ,  1486148321596887101 ,  647919613618616291 ,  1338952898618142493 ,  1309097162020841563 ,  560658361097830496 ,  815091073734297541 ,  1838349535803316975 ,  2251957131658903368 ,  955555281880620552 ,  1101554669794657082 ,  1430138483930486340 ,  373958659719882439 ,  393860403436697965 ,  1103246744331576914 ,  135059569747923622 ,  156313577828955483 ,  1004429567933523429 ,  1383953942615879833 ,  156783144403226098 ,  1449763261919702743 ,  1022226239435264053 ,  1730332542745239869 ,  1863072765866832407 ,  359040872859496689 ,  553228803783598374 ,  399058273342022064 ,  195238498742852603 ,  385876274637907104 ,  1670367328998075386 ,  1140219183841520715 ,  447425599461068459 ,  1256519532332406072 ,  601526171649070702 ,  1058603422093756929 ,  1426810686342175204 ,  1060165126990595831 ,  1399592372924009072 ,  1176265593045130290 ,  2245898903120170556 ,  1768256716697270114 ,  1607434518443252446 ,  823051606084206222 ,  686004435413701316 ,  88317724560217257 ,  1837310366306839300 ,  820966884908302063 ,  1212104720743404433 ,  385649487576558605 ,  1168231489551451310 ,  1354565485932030958 ,  2096911238261441283 ,  1890450699554155634 ,  821383850325681022 ,  1790152307171660933 ,  36402329295499226 ,  1887522834434864465 ,  183015934468299765 ,  1066240297467053545 ,  1958313168376267400 ,  1971300215404121701 ,  359851712609561622 ,  74535727396614234 ,  1748544942436932310 ,  969460378828278595 ,  969420316085660416 ,  479174139960211175 ,  841122605760192804 ,  1397140005129075069 ,  879199363741260207 ,  2110994388862150174 ,  1594527010282216422 ,  1792165691480840424 ,  974369878663081449 ,  327466575412681921 ,  1250883642005552330 ,  1047668580269758576 ,  1343135460406057632 ,  158716048304829615 ,  235845718452454999 ,  1687022361312559805 ,  473895468763596271 ,  61409629057196550 ,  1408282536534582822 ,  548450151706924209 ,  710374436453702585 ,  1969650436068831446 ,  750905827338804552 ,  809391755751786100 ,  368960019705103598 ,  2005383352777682163 ,  758721822447081108 ,  790225780581190036 ,  80289829499941414 ,  1305529389719098659 ,  635826204565800946 ,  1406771113115955966 ,  749199654916128184 ,  1075840700403422492 ,  900660660801923928 ,  2242595336677648619 ,  615640068729728277 ,  85108756138058735 ,  1791784737195733789 ,  2300270873085708711 ,  164383198942625392 ,  2225553532883932453 ,  266592082403847365 }, // x^2^535
+
+{ 149371363290762392 ,  1479987360987520031 ,  1907782640354987536 ,  1041650953197219893 ,  166055462358007906 ,  1419072914600044563 ,  2298350562440994904 ,  2248215964958222453 ,  716410047124422407 ,  1979004584265986862 ,  731944395305572333 ,  413210439712463215 ,  272426247760154608 ,  454445059578608805 ,  380438113637244954 ,  1136786502826978041 ,  2060402346363370033 ,  805121248553044657 ,  958405790052924243 ,  916713554897427754 ,  308722439001480064 ,  58218391663710535 ,  262864265838298328 ,  134090319378259009 ,  1189486333094924593 ,  1823657295697564376 ,  1149988407851569062 ,  91202003477875126 ,  794265300224559404 ,  939253999333242648 ,  458774272974006490 ,  1789137357049855385 ,  2183696144267751348 ,  1211080974757089525 ,  903596727710864462 ,  480381232361690313 ,  1286679165740284264 ,  1221046117602218248 ,  1169116173563071030 ,  870861885566728264 ,  316014298243819095 ,  38588239998383583 ,  793061533901785968 ,  571440041529229692 ,  487287462647570849 ,  319698083695455324 ,  1364327090538560205 ,  298220471239936717 ,  795115619744748769 ,  1236220386358184938 ,  1765313032970202406 ,  1580267740991239395 ,  1810388192881441806 ,  1818300131344320466 ,  2229614809761075604 ,  447310498417388869 ,  888445786672570791 ,  635126053047473806 ,  159001635899341789 ,  414490885514283345 ,  1345690276061655623 ,  356002440935294807 ,  568584377680377955 ,  486095252435621527 ,  1285284091791777565 ,  1085110157583026497 ,  1505311267184337148 ,  2135232547358570554 ,  2209816749527517208 ,  1263403570656384155 ,  665734684476398617 ,  1608848294886027175 ,  2193593340745674215 ,  697256403807108902 ,  1369546122231477735 ,  731285984664729864 ,  906573875375595748 ,  188891424188350244 ,  1898277147364390830 ,  1881377391563971998 ,  256520906546335220 ,  2079602443738871594 ,  844661996848524960 ,  1004208910379171793 ,  859583358202938431 ,  1165585004955978545 ,  987765539368410530 ,  1434015414449516277 ,  1723319232797089729 ,  1681879097708622648 ,  495669748760207900 ,  1814674617135686053 ,  1756179420573918765 ,  702916092380256189 ,  597885813922203443 ,  2190232486581188903 ,  235158990781379975 ,  1242050252444191665 ,  277776217517835828 ,  1680823007728117741 ,  1565412288758053333 ,  949060705807189614 ,  971560830473231649 ,  1694085970297926795 ,  309702589296081114 ,  1633821310629829332 ,  2254224089281590088 ,  2031898316782237101 ,  176096975502746472 ,  812065247006023257 ,  1266197464320771491 ,  2132230990042642695 ,  2015203832597531475 ,  345464202479431065 ,  661479296131236835 ,  958843870562583892 ,  1904164945147985341 ,  1935385734188896115 ,  2212344670405767971 ,  1990885847394647090 }, // x^2^536
+
+{ 1891256589730107658 ,  387940141859029809 ,  1899471280603608811 ,  905145426594052072 ,  2152490322838436027 ,  724351778360305541 ,  1874497194205140244 ,  1461515990016302601 ,  357945611058866890 ,  807475786489203741 ,  457365896103669700 ,  2156755561610715364 ,  481850807995734095 ,  910678493305053734 ,  1360053699408488904 ,  584024496373574835 ,  944513645071013788 ,  1022879553194854975 ,  292427534403200786 ,  1264164605409693241 ,  1035755405076535352 ,  1461412268661312173 ,  1748080261121001408 ,  38269541120226502 ,  1803992025818989498 ,  640089254887628559 ,  1902022892786279423 ,  1775662972169461055 ,  1377525624881574863 ,  426045317727888044 ,  1893195346813131639 ,  1201714566768167542 ,  2293886626804578031 ,  750341873030611395 ,  2266679437653567201 ,  1982267657240234735 ,  2099590230137473898 ,  585145288981599406 ,  1819295870756827193 ,  1951924296270939859 ,  1691816730832477275 ,  2007967334715789434 ,  1578701235471564858 ,  1061566607347670383 ,  1872515144252845612 ,  1637253704485015527 ,  1997900539866433284 ,  36060388243944050 ,  1694800028508869356 ,  1425512524962303363 ,  1095797840288065336 ,  963008627305500955 ,  2230334174458174594 ,  1138455289412405674 ,  69545376168668121 ,  456799446167873546 ,  711065389022794079 ,  1751250200174399417 ,  2099824478163925356 ,  1785204025165090698 ,  1838913485918550289 ,  1594604051831066239 ,  246184643826109931 ,  750199733023490948 ,  749165753659863067 ,  2137065473981679772 ,  1100777076071660597 ,  2057748015635488359 ,  1902933549882084702 ,  897993891814688718 ,  1575005875597368260 ,  2115480881090214248 ,  1962584776781364506 ,  1169100528209597176 ,  526087533813477504 ,  479882726314509587 ,  1174528542200731421 ,  751768247577084722 ,  1012803092150617927 ,  1345736001699085985 ,  1284824910152912287 ,  2124357172845414910 ,  1362246074570017983 ,  663683414260776294 ,  1818374671727137794 ,  1199980546184248122 ,  322783984096382739 ,  2130783412499223001 ,  1892208931059562194 ,  1113150205090864903 ,  483881661151339155 ,  1084338539909584927 ,  822459779783296077 ,  897520922218273972 ,  2111925039690137467 ,  1779509411749155155 ,  1588827274217781119 ,  736555072935070259 ,  417318901895458913 ,  1042174120961048790 ,  885408477777893375 ,  2240424026253180247 ,  1337092924933932247 ,  1061795904022970785 ,  1309835021401137556 ,  1911520949958112644 ,  1178191478462563687 ,  2171626990131517024 ,  942637744195815304 ,  1644481139644346069 ,  2282910670033998381 ,  1874265768492418644 ,  1020374069358216035 ,  1838076930704903344 ,  34023669136559124 ,  346436272495420771 ,  266329477641111397 ,  1406481895179054268 ,  2117677400306479354 ,  267814993880380862 }, // x^2^537
+
+{ 1373316121399478936 ,  2068832657118487070 ,  943342179680916189 ,  2047310902278902416 ,  1003691129601071406 ,  1379002122157083219 ,  1278224768011914857 ,  1392798501657658878 ,  2243013465810480005 ,  1159552451201491278 ,  1464565038109839264 ,  27062736803658667 ,  1491016346637379543 ,  404204413920707556 ,  840152409360644753 ,  133604238140743951 ,  678743075220677164 ,  688278210844230959 ,  360777252014080614 ,  559039964095012180 ,  1811511094556644327 ,  1808348733984987268 ,  705982296992257681 ,  2105491370940868721 ,  1738569680297204756 ,  1716154195258536247 ,  594266173948738413 ,  1651487148363017675 ,  1528283847536128071 ,  2002545602306757802 ,  1966517505084247378 ,  1602982328970367454 ,  1812911394365359727 ,  398255700087967710 ,  1828109745233482899 ,  1205946679010638827 ,  1809911466229055473 ,  662068250377542560 ,  511841561000278164 ,  948189415043146438 ,  1865770262198372472 ,  1297383827589650950 ,  1706492075147130369 ,  831400526194472439 ,  1312285886232408009 ,  1609289567944933244 ,  1099286662102060761 ,  1364681415158748498 ,  1637812201059176325 ,  148209682983123767 ,  1203449653780669914 ,  1885248635503522397 ,  1955911714302697867 ,  1605556313389900320 ,  310259734805514399 ,  788397129684948701 ,  642639522287286707 ,  1628472344723253999 ,  2276601292763088018 ,  1496317972712851714 ,  1124671553391516336 ,  1500211007382769793 ,  107620985342909330 ,  65276620934090279 ,  739452478401811135 ,  1554284753918141613 ,  558090448608019316 ,  715034083236687221 ,  536519994042748404 ,  262404544081682716 ,  215288703329305752 ,  473282162934271120 ,  1581625218975278124 ,  432982501181479655 ,  1689842107108838915 ,  654725276080666152 ,  2097570220451106864 ,  2089287174087859814 ,  33346614173662283 ,  361990863703074246 ,  1864914936158770880 ,  931819596746305658 ,  691678168298742448 ,  1977949442387467281 ,  1818709441190792625 ,  1815191866893339176 ,  966159973629601956 ,  1277317071447939949 ,  111823117678097845 ,  1825551730465382458 ,  1222300338308023542 ,  937386390603925388 ,  91709405203885677 ,  1100046663408335629 ,  655103225641516650 ,  1007742621985193663 ,  2154664262325769977 ,  1078765758766543175 ,  1222908617710850781 ,  1939372103045607808 ,  109537512525761857 ,  275436399390141887 ,  1117952942995592325 ,  1165061072340464249 ,  1918326899695030765 ,  62616663641253744 ,  556892555025965708 ,  1981727156709348073 ,  658441612492779252 ,  202248774443308962 ,  533683235111619699 ,  15059567684424877 ,  2132002480751888162 ,  1695316883211379950 ,  2015317489324642160 ,  440196950986426688 ,  2098847551300970627 ,  1318191484837562963 ,  155727656505667494 ,  2046765499183532697 }, // x^2^538
+
+{ 804184418752017032 ,  201486130795048588 ,  191127475019487560 ,  946813336121784900 ,  1641022896980523867 ,  1076338747096171712 ,  1534967095022816081 ,  1858370340091888322 ,  2258605439063244594 ,  587562333484247858 ,  166850882335940744 ,  930605123616348199 ,  1095492031881682362 ,  2124118276023299883 ,  2046988570633998722 ,  1008858312629335690 ,  624431828125893989 ,  1775551379803448050 ,  1039717159062755410 ,  2140799606531050311 ,  1076821339255102558 ,  1260703811205147168 ,  2195131138402758148 ,  395367671451582855 ,  339081242141022290 ,  917983926851057446 ,  1581600434130714255 ,  1996262790109899576 ,  2163776763883852466 ,  1457821120472339549 ,  2192205257714067013 ,  2027603266228076712 ,  1083246682694208175 ,  71897842685810202 ,  256351461878763104 ,  65382433153216878 ,  970258773932026846 ,  2198047861388237102 ,  813070440114929764 ,  622526347088636966 ,  409841406309580429 ,  2039597082796764045 ,  47984164230217955 ,  411128632864099938 ,  84495734960062157 ,  1983368668148831538 ,  375647973786806995 ,  50895098224919818 ,  1747549323139883531 ,  815961855398740467 ,  944315166650192551 ,  1455368154157401675 ,  1563580911718015737 ,  1950286436551974521 ,  14484451756793661 ,  229687273228081470 ,  1629818884921261869 ,  1980805122713920597 ,  974897247584935145 ,  1869259958516793310 ,  214528792313072456 ,  2009216203709282877 ,  604012119502989251 ,  1213208349086842703 ,  635496924160924885 ,  1301394088470860620 ,  1843721010060474619 ,  997262350196685635 ,  811454981214223195 ,  447790727074543301 ,  684889214141871060 ,  2119810250267897765 ,  210966381812056038 ,  1537562546233825874 ,  425426343315354774 ,  777367927409273806 ,  383773126403830980 ,  1380654244359395513 ,  1464632884623309800 ,  2044014871535795950 ,  161726676942305036 ,  339253411827001902 ,  84636104303408094 ,  1363728362314855397 ,  1870796015908718378 ,  6917912790294260 ,  1729103118155351908 ,  1766024621721951923 ,  166578757945251867 ,  2074401192275534932 ,  1219901849453180100 ,  1609536097342417950 ,  217341585905229319 ,  49050632608269999 ,  1982042194110396547 ,  1716555033449833835 ,  1844244366474418338 ,  191784310853484302 ,  937304298055253782 ,  744762519503984429 ,  618482980513902619 ,  820352327998074416 ,  2010033460077319413 ,  2020099695952597300 ,  474437432968472272 ,  62338528434574199 ,  548450784863376159 ,  705837527467508137 ,  1728470385133045441 ,  323862294378877448 ,  1604385531841001662 ,  2283645450263113557 ,  910835399950505423 ,  1204278967237280133 ,  115864469767026206 ,  1963155767716941313 ,  65655633609218004 ,  1588638501937649070 ,  1848289473910453536 ,  1604127340414384121 }, // x^2^539
+
+{ 1872285111358829339 ,  410450226623295579 ,  39262461176548260 ,  698859252330797529 ,  1074092990717052043 ,  1989964157147207520 ,  48868664492316072 ,  1813426298535936373 ,  529919980674471034 ,  1993793504924382375 ,  1883127908894299664 ,  1618172012255157722 ,  104272621951018725 ,  1144418142552489412 ,  1583473009547492711 ,  395399382315175595 ,  260133736282617472 ,  1323906551097510751 ,  1596968109832284140 ,  1650065998118454372 ,  1370216934194950730 ,  75291791240417033 ,  832564955138580158 ,  928267852148913807 ,  537100101891089935 ,  315783966665267655 ,  1004027340615519253 ,  121668882897140602 ,  375281440365351231 ,  1635393933048242633 ,  1246437290799877293 ,  548792741096369447 ,  135950528308667430 ,  211229532322788021 ,  597877316497910029 ,  1868464579128761984 ,  1675854707404226309 ,  2199921806009088415 ,  718412995137803856 ,  1316892384757523516 ,  1981230346247160885 ,  1352202880694403565 ,  625040078904953776 ,  1431999685482621415 ,  365556200134721361 ,  1283454177832411220 ,  2182684743210941525 ,  1523287670910823492 ,  304815809093601063 ,  1888589707094500132 ,  295514298873377503 ,  496927504745473961 ,  2101963053011681067 ,  1560835956368393888 ,  1264659036844079361 ,  868782988125392234 ,  1447866398957555075 ,  684783856143297118 ,  1330715146266111761 ,  2230486990749718653 ,  2241121354806796352 ,  1437494395551888152 ,  439511497438634279 ,  303527378405661924 ,  1522380893937300881 ,  1531446432951188718 ,  610481211707700628 ,  2022224880723358435 ,  787032892792051714 ,  1947974732263815282 ,  618950909815752306 ,  1102368318959608193 ,  1484191103715686520 ,  1124709273226072307 ,  967661667821394942 ,  683727868692240735 ,  1075572139727995478 ,  597299619844176125 ,  1778654872620758872 ,  1276203139923242279 ,  802641608049245446 ,  1687866105110154784 ,  1395496095365133036 ,  863621458239174778 ,  1301341632246987721 ,  1348019949835653045 ,  1104052179745914545 ,  1858460172734418226 ,  129588190006462785 ,  44039516028821058 ,  2048580640064059045 ,  1850430948107465902 ,  989310651172767267 ,  949632951140132767 ,  1530858416724616867 ,  767776575804054697 ,  527588774361885781 ,  1706706846720030491 ,  1871857308018520972 ,  579330131768892023 ,  2231677549404679104 ,  844274316438434466 ,  240984836792712928 ,  2085086788397680489 ,  364145203537042195 ,  1255952301049119284 ,  1288074164149571781 ,  1700950089946841713 ,  2171712871326991293 ,  413261554540208176 ,  1342251525346692435 ,  22799249541591951 ,  719200715552533729 ,  871619698594370088 ,  884688325624807556 ,  1118959793896338149 ,  1720179955498338127 ,  2121756721147284977 ,  1912077173653094051 ,  2202569429548756789 }, // x^2^540
+
+{ 314066315815894129 ,  230038457643164543 ,  1092153577348170554 ,  2204129868587722563 ,  854155451158415955 ,  1477728362203929322 ,  1477238287612005045 ,  565078632643441960 ,  1666025898820699557 ,  1242703204004775873 ,  2112410544773596607 ,  1120554776351874842 ,  1649502434022482549 ,  1469263895668533541 ,  1108334755693440995 ,  1355091789537635706 ,  607702278266334430 ,  780137903860820962 ,  1448707842104566736 ,  2100530729470844177 ,  233748501777663 ,  170218454242419414 ,  1746313619978343511 ,  1191250282050386011 ,  1839186515711276009 ,  1297680240918067645 ,  1149648486094953033 ,  1925539610031205891 ,  1678864671468681069 ,  1006775348621431139 ,  1264817190890865667 ,  1851275542378518204 ,  1960146404788485162 ,  1609372693087401183 ,  712780206190027077 ,  29096306509484559 ,  1559002225374678823 ,  772582151557522783 ,  301013967187241294 ,  766070321248733809 ,  571977626965723757 ,  2168715679454583872 ,  1798120216337552291 ,  574490398283921924 ,  522533791998752988 ,  532600767837565679 ,  457326592269341167 ,  243051578694914276 ,  1533524820972591599 ,  1373995002017190548 ,  342843310746187862 ,  196796108355346921 ,  2039569461332632624 ,  2133941246251237737 ,  2017050376149566101 ,  1461380032140720883 ,  1857702368666857635 ,  1395415883626203391 ,  1406264050007640001 ,  1351722922195464313 ,  788353237837729386 ,  1793266662909484851 ,  1355484895826552996 ,  1878085258673657598 ,  422857322879968179 ,  1499880818487298865 ,  1960256959756684693 ,  1319364052319402831 ,  2127779121460264953 ,  1924326688708248840 ,  741439083491441276 ,  2023298395868783430 ,  453460567080685568 ,  1800352984400809017 ,  70208708078907112 ,  1285933324508524643 ,  1209205967951003954 ,  31141821912903187 ,  930846045804773212 ,  1139463174105211027 ,  2063308198941247249 ,  379712201236809611 ,  1966822970667182278 ,  891402744247071175 ,  1876926360555981072 ,  1667048969562096160 ,  264833151101427470 ,  1058148661331708530 ,  454130451187866717 ,  7273428626999313 ,  1819873582601164776 ,  2296654782086671852 ,  526546321151521165 ,  2260945987859909389 ,  1166407668166355794 ,  1119186997799669725 ,  485777985485133564 ,  1231517761538980601 ,  1414074981219157414 ,  875936170573614275 ,  1544703998485345871 ,  1800577697578636985 ,  1752627242471780638 ,  1269370861273246033 ,  989373199227496382 ,  969216258561991936 ,  2210827244202754824 ,  904358603672581683 ,  756029922218926177 ,  161394694189308963 ,  530223660392575518 ,  1901839117077557929 ,  124307259176508033 ,  1660098754847254978 ,  1276349461964054400 ,  1956027320438016502 ,  1015970314165945575 ,  2152579795141666555 ,  1204518518010629191 ,  1578898556297393796 }, // x^2^541
+
+{ 1134126079232969133 ,  487367673210116066 ,  1564423052397771311 ,  2058246731168284629 ,  92863159154400471 ,  307921976701297388 ,  44906503639569223 ,  346926273456895243 ,  1777383102666705678 ,  1098765923322469833 ,  1427158030019392139 ,  446610143242999821 ,  1458997892545654042 ,  715768373687787224 ,  1792018709716989930 ,  1334821404923985 ,  2211962883350711312 ,  567203906733960606 ,  992171661558050722 ,  181818481361101965 ,  1371895542271973695 ,  497786783061999137 ,  466381441639598036 ,  649742489338407445 ,  1340102648263788464 ,  1063561413046257669 ,  882943844031091484 ,  2102649946086057387 ,  755225958308967034 ,  1740329234576257957 ,  1479500458132270378 ,  2272333843422583947 ,  657531924766824578 ,  461263442468214499 ,  425965086175573603 ,  1850610274601230464 ,  893637876302614648 ,  1142751276491657163 ,  1965751828462294205 ,  973614502701394037 ,  1299982782940540059 ,  1312666094443707097 ,  992477326163877112 ,  1953932457088853368 ,  2058192095739921569 ,  778740851167455606 ,  1675389633370842369 ,  413092005660152444 ,  455763713605121556 ,  66953991169925093 ,  863804017612323943 ,  1170567482588406962 ,  2048247970084538608 ,  1763914258899806861 ,  629683214420497191 ,  2166514950016501553 ,  1535262669158551914 ,  1266898857418992819 ,  1456384912961035450 ,  276723055609380165 ,  1174015480478817050 ,  782675740121465183 ,  1898056225333834759 ,  622703883757899734 ,  1982374937004059298 ,  533599694290179831 ,  755044764476140333 ,  92017148206537192 ,  1446638843089734641 ,  1377860803080909666 ,  1873269924035289685 ,  1810044751220611139 ,  421050706142015852 ,  986351820476061390 ,  2004846193604967943 ,  603170197474402544 ,  451585624012645397 ,  689389786174345058 ,  197261603975381608 ,  698218510708023285 ,  1711686883328043818 ,  2006288172601036340 ,  835082299608222350 ,  2001861308995060618 ,  1967637340405924514 ,  2941093291609041 ,  2130003459333573844 ,  367261191786085682 ,  1438901206707033525 ,  1882656291698440747 ,  2283797634462576305 ,  283782058142624955 ,  1001972134048751228 ,  1319490882764342226 ,  1668410160557565794 ,  127749961746506621 ,  1168959776527826527 ,  2000788725273201635 ,  863638727036607458 ,  20241946603469925 ,  1458366020744068757 ,  545022611836350235 ,  1572082751887019763 ,  523053044505165047 ,  1650237820439599223 ,  1302895470829998158 ,  735865400645986795 ,  1983928216561091683 ,  2286919237837980208 ,  1619058902378038073 ,  953597286232397571 ,  2111082561173171572 ,  1895157360781221202 ,  1196258436385702596 ,  1838788538083354567 ,  1211777935815335095 ,  1643982840641503316 ,  1571318416000122449 ,  921487835520886302 ,  359493593240764169 }, // x^2^542
+
+{ 1625148290680801866 ,  1033552492199538551 ,  454399232830572121 ,  710333477836837991 ,  112596178961674070 ,  1593044222010730163 ,  2243166569556563326 ,  1765016554456357831 ,  896550097030590673 ,  19536850573022495 ,  2290050416485786413 ,  337258480099352288 ,  42142470268587357 ,  74303441233309603 ,  1625593273340241650 ,  2103385153464741048 ,  2112287671118555474 ,  1373342718561063355 ,  1006444560518682268 ,  1958368897295769011 ,  1840678844197423080 ,  1495180365328638699 ,  295210226507821099 ,  1732160131337770236 ,  1189229574274225932 ,  970971121143311512 ,  421475964462597036 ,  1392553984252032471 ,  893805580944834304 ,  617288839688064461 ,  585711599850572376 ,  1839635014011151569 ,  1835918157714998940 ,  706649782897960465 ,  212982424119434536 ,  388028674580878104 ,  99678602607500984 ,  1174907040006581430 ,  185171183834898928 ,  340440556831853505 ,  212134432914516861 ,  2121955488563500582 ,  356105074867003264 ,  1036869360306557238 ,  1864176731940301436 ,  1816522173162797005 ,  784683538339217839 ,  848786670704422942 ,  1633802249420214671 ,  2015326057446564713 ,  565790090194141243 ,  319623669913681572 ,  1007063255226318964 ,  254168667054585986 ,  2215228850188406554 ,  1649450327687264493 ,  1158714163712824320 ,  671181265989585711 ,  1411810661554485667 ,  1667376921499650261 ,  1413741096604421647 ,  489198221800497781 ,  1898987447350979458 ,  561698512076965681 ,  1537805805080988641 ,  375744499522680246 ,  489576936489156692 ,  793398055752657144 ,  946385248506051719 ,  836659376218668657 ,  949286661798210037 ,  1646694833633800652 ,  822202263970211603 ,  1181375295970982742 ,  709891296933103991 ,  1729319310474740442 ,  468671609664366042 ,  1554654524773941760 ,  1303359046100859576 ,  1370366991882517587 ,  1919389882351531988 ,  1687565057448017347 ,  1888315725494838684 ,  472418134603108256 ,  1661319049460064818 ,  1218916285147981583 ,  718663600446855093 ,  315285001717805929 ,  2305025418041043778 ,  1921062841735989195 ,  2009009913212539554 ,  701413563459169876 ,  1012124474313825473 ,  282104343077407382 ,  318314287132338091 ,  1388744693653284298 ,  1817830595138839487 ,  1364369320855560139 ,  967363806394011288 ,  1182352117096748068 ,  2261047736317694001 ,  1369189308434537020 ,  1775716375535016024 ,  1077120009058698758 ,  773756953856747222 ,  1635136321730286933 ,  2107716212358141760 ,  56879213080582473 ,  1290680595140870815 ,  2234870660736291915 ,  2169741198034779687 ,  293643791103436139 ,  659966209671653875 ,  208661598213715875 ,  1437998532425185048 ,  1004419048527189067 ,  1781492871633070997 ,  1830551454375973669 ,  295723703293834500 ,  1101043865896351150 }, // x^2^543
+
+{ 1986363645333062146 ,  2082950026409540229 ,  1632438698796273902 ,  2194087008965546972 ,  1416832099941101288 ,  50644329021444114 ,  397954611876238429 ,  1379017542253068455 ,  292806490158309576 ,  603488878266937066 ,  2270295689211813088 ,  1246003756621529889 ,  1450285701837078961 ,  2055054123668599469 ,  1937910060867957435 ,  2293360756929226928 ,  528455302100973370 ,  1157864564075167248 ,  2197061170154759511 ,  1346618761396082143 ,  1443042038805792086 ,  1199831478127414958 ,  1236078829110989639 ,  1740242746085426259 ,  1172269247138406151 ,  1664374956219636500 ,  634887827670740551 ,  867037847228267255 ,  913918970306824319 ,  746630648691185215 ,  2235570933931257160 ,  414114191896119065 ,  552567141688489452 ,  100368845291630486 ,  1709074108292276099 ,  1604829997002601995 ,  1718922625624076745 ,  820199323657129611 ,  250797535558985125 ,  2033727523715857716 ,  982384429619723732 ,  1187166823190090367 ,  1845064175291566133 ,  1105034335777250821 ,  1051544865233506604 ,  1813491616647418753 ,  337234708801886971 ,  707483020766093109 ,  2143892920833563269 ,  1896133144344602237 ,  2205212064481942354 ,  78501236569020276 ,  1430871723784307949 ,  1727459935692795317 ,  2165579594629815925 ,  774142781505879980 ,  1419012682808729940 ,  1332620286255389255 ,  370415383928195947 ,  439604741663092278 ,  1354931146123103819 ,  1020013727780085031 ,  1708992520610232745 ,  2126494776582731794 ,  544604088786795640 ,  1591691925685950499 ,  340330500885376990 ,  112904183992047460 ,  678219983279399965 ,  465437192639286296 ,  1626184505111468767 ,  2010780702507391600 ,  250954437650831662 ,  1869059198591007154 ,  1971303414897266519 ,  1447674936292916611 ,  416115012751045797 ,  674956587402746103 ,  2114978043522858515 ,  893252312097751265 ,  630461453291283035 ,  1966550618201764677 ,  1127325209015109419 ,  1770087279667972375 ,  2144267789415821932 ,  478799376278527521 ,  575968064627980979 ,  2112476104935969817 ,  707021868435329205 ,  595252063580236450 ,  1119070390799503114 ,  1025208221047449957 ,  51015651010986940 ,  115343141551108714 ,  620611220493854761 ,  318623103030753914 ,  768220263275866117 ,  932155905414186411 ,  261466537443580312 ,  2015105250728772998 ,  23724219084426021 ,  1831731654537070586 ,  1326253733924348661 ,  21594603034188253 ,  1349436441045780809 ,  244043103069536707 ,  2222182407660499763 ,  453830779271148262 ,  1957166408496573157 ,  1280622823735210082 ,  227812456111404880 ,  1321095435196338288 ,  2260051983105805859 ,  187335136025186722 ,  1815940909953177413 ,  1791641244510368932 ,  890299947594613005 ,  337100559010806914 ,  1894547096021798326 ,  706830664327480582 }, // x^2^544
+
+{ 453856186352649187 ,  2264452994587064946 ,  282355425465994419 ,  1389530905915053718 ,  1330646497741287002 ,  474145817319849030 ,  1779415165897747229 ,  373616675189252574 ,  469409624864200556 ,  2065612075360507415 ,  2263079020986792697 ,  1902737619985830767 ,  994770508751881097 ,  1448553285130637320 ,  1621046177128753361 ,  1227109218233853640 ,  1406352945301251515 ,  2213455543030551529 ,  1500640671703751286 ,  616553236988980231 ,  1151044068449344535 ,  908480254763918220 ,  394950884358678860 ,  560475319687889369 ,  1329900745455784882 ,  1501265054352849235 ,  321530756895148097 ,  835285982591464827 ,  886882362076529301 ,  88364825918415826 ,  1369985620100599657 ,  128600215123062388 ,  1665132686422469864 ,  2194553847454083001 ,  42530891798905321 ,  1239883714010001203 ,  1438476124524817777 ,  749811068247620199 ,  1359510765629707387 ,  237386755201119539 ,  261310965048491932 ,  1129773726338653186 ,  1671056598983990857 ,  2236182853616386184 ,  1674307490237427169 ,  26970521178288775 ,  1833109345593337002 ,  1135740008376446512 ,  1681792242523087250 ,  362901308596225295 ,  2134384627697208785 ,  322320516702522935 ,  1358919585695230025 ,  1184291678665912354 ,  2211711862926622407 ,  563089580210371239 ,  2089794721779591821 ,  2251431898681167516 ,  1238381476554723728 ,  2084691572701112556 ,  1768553824880983153 ,  1297738010034430191 ,  464914673432892231 ,  761251324578525755 ,  811782417590030627 ,  242856025354700009 ,  1017658011706607078 ,  1997811848996781170 ,  1404898254140614600 ,  674590132654115804 ,  522862115918196497 ,  1242789935112613381 ,  954716969466141114 ,  275039824792686034 ,  1885763529589218664 ,  974027743254413002 ,  1394677935502157442 ,  1410050839593985803 ,  1409778303928442365 ,  1315557848875644221 ,  151631452727450800 ,  339568013974142978 ,  1012499769998467431 ,  462699322962302853 ,  1672295799406994870 ,  2097901945846327956 ,  1526131631817432026 ,  1988148993851345194 ,  785847921675948598 ,  1119028230975736083 ,  526217210230306390 ,  276308158476716709 ,  108762441011035179 ,  288584526149848931 ,  1623058031358772154 ,  1639507396964260138 ,  1210089366428842826 ,  1014826029714191955 ,  670857732580396985 ,  698722704472312891 ,  1237686623090025932 ,  1545270438279352402 ,  965228077196347259 ,  2050124729251272979 ,  1051140427928370271 ,  1055726931540862442 ,  1140028631556639568 ,  1912336453086400921 ,  1038007204060833260 ,  437306428438983443 ,  1185225448617167572 ,  1189959755045219446 ,  1223028973940968270 ,  1266320873798210506 ,  1144699841640364324 ,  1611883390573688361 ,  535209066583233137 ,  19966315864193046 ,  729079769795721563 ,  610425560755135478 }, // x^2^545
+
+{ 1722883168063611407 ,  2026581980332866965 ,  469194090443768314 ,  578039576974966341 ,  2158753784037238158 ,  2126711820241949255 ,  1190044357118747996 ,  1967662533125106279 ,  2205625958846648637 ,  1722528914903719306 ,  746064143380473791 ,  1409098188960376561 ,  807630733996002587 ,  1272623537852015959 ,  2087990118639508924 ,  380923106789567468 ,  532942757057668196 ,  1452570317995800493 ,  337131603753650844 ,  814716622069845112 ,  1286414191931270936 ,  1436036366695504473 ,  2038328091009060239 ,  2043749426488013851 ,  1898751960326825805 ,  2251740640077815963 ,  1135882368966439805 ,  1068004792962215901 ,  1141213712508137755 ,  278411356171483341 ,  1233704952981921126 ,  1840636053049157677 ,  1912174255410641052 ,  2140339098036761474 ,  243488241767385256 ,  550457476720719580 ,  2224115155139691869 ,  987490488916449395 ,  1404401970737468802 ,  2089085483071830441 ,  598279235442683249 ,  784651263366992663 ,  2273764995740251879 ,  1803585515331216093 ,  1449220577540366120 ,  779714666912458436 ,  901106192018103531 ,  275940554816087409 ,  225250025121195201 ,  510447103053264503 ,  1793719231329132445 ,  60751352658121942 ,  2057397037772496898 ,  2297008450223304951 ,  131669916599660350 ,  437399123920248841 ,  93186112438516471 ,  751070322363132400 ,  2105304696521475426 ,  597758954206977064 ,  763495046490072874 ,  647360091101062991 ,  1371514861927141880 ,  2060233040810029500 ,  1487450816325928452 ,  1416737638779453950 ,  1620615590811991262 ,  1470310485576736752 ,  1867834871868061504 ,  1346277988201398262 ,  1415418347896862660 ,  777965633880919662 ,  1870557494759802475 ,  1921635030795903724 ,  150750181056558484 ,  2214971227702713432 ,  1759378947836228398 ,  593332324098258808 ,  91866603759384066 ,  864872206235412350 ,  505560736419454554 ,  856508744441508080 ,  137391351694924666 ,  2049232727020494837 ,  649652328731555862 ,  482386518574597344 ,  1852310267928297680 ,  1122991647600648101 ,  1471728102204085954 ,  1268332953023210199 ,  1068823367466701027 ,  851379883662530212 ,  1756321829981075438 ,  960530157046186588 ,  2054242211938106099 ,  542723434516746762 ,  299391776579106763 ,  2204640958807660972 ,  252719223141530202 ,  874371758894899225 ,  1685703375891007383 ,  1452377932611514902 ,  1524335184064148200 ,  1895849520052347203 ,  2010061864182334044 ,  993708842902878185 ,  771090128550761654 ,  75342531374790463 ,  1615945879861832684 ,  300564875825825536 ,  626896601134252796 ,  1879899925853020856 ,  2035715707829494307 ,  659555615613559625 ,  948646793862348221 ,  650283906914948646 ,  1928382394570825797 ,  603647422917194269 ,  803643512464824673 ,  697935024051863980 }, // x^2^546
+
+{ 2057479848012175643 ,  765092847338520527 ,  922568571937591047 ,  106110778115765381 ,  876613082414411215 ,  425027265996400506 ,  55144639769137566 ,  1050405182846235436 ,  1019592264844825980 ,  147761237385081960 ,  228266229427344410 ,  1305425094439718686 ,  640668036322559621 ,  1895587414029354532 ,  1879832535610056238 ,  2102550231891765808 ,  553032621093371785 ,  1905600580303002599 ,  309768253700004748 ,  358234123556933746 ,  161868586987073177 ,  137117905854995042 ,  2197653832255766208 ,  941716708744304440 ,  1097108428471150774 ,  517255677761826982 ,  1495262929781802427 ,  1346053846084126312 ,  249193682603246472 ,  326174998949704233 ,  2290572626173074457 ,  1510738771652721754 ,  1583697511927166970 ,  1742780610281894697 ,  2236094820875168605 ,  342642703362871682 ,  1417462894933485154 ,  593254145337578579 ,  1796187288038945515 ,  741076313064580520 ,  2221018985129497802 ,  331533765883593980 ,  1042145950747756631 ,  1223579283943104940 ,  2207363371961246851 ,  966985922043682993 ,  343031659221492607 ,  1435405259634548101 ,  761335175967816742 ,  2112432257816494238 ,  902508715175505567 ,  730936011568343583 ,  860055510842083993 ,  1199436975568228822 ,  1399720256737914556 ,  1037827210492986889 ,  1068770766519105762 ,  831892484358952558 ,  391536532438505772 ,  1782900191588131553 ,  1016187457170062846 ,  1603885943128876057 ,  1221927317878346744 ,  2178201463185525004 ,  1235365841874630635 ,  238502812855114042 ,  1991078918927719177 ,  923368743978881824 ,  1350076476337806557 ,  1988415780327647978 ,  1977169311509671075 ,  2267616364537378599 ,  255911951416972155 ,  1244661152339053842 ,  997766028590288772 ,  308468355118458624 ,  1031018871483717007 ,  946271855592547962 ,  526624680162793759 ,  573120889020499547 ,  2084486442154656522 ,  492316505510031109 ,  446015802542858368 ,  655776855840252709 ,  299081498672183175 ,  198429731725549851 ,  466956625200217626 ,  405977341784365716 ,  1379463413172378397 ,  1807518536246377776 ,  1751212698371855360 ,  696409047743970054 ,  2124185014232406053 ,  1426404534472578653 ,  1664388245585642703 ,  210711685127883378 ,  1853299721107232444 ,  1003691337052659120 ,  1910478133425964874 ,  1672892793741636089 ,  2205046334093154882 ,  442683071677216005 ,  211792010029695520 ,  1557333409367681386 ,  213745240505234425 ,  112755232888677671 ,  1811456886077224691 ,  940778836692720494 ,  2013781624312814319 ,  171118229421035222 ,  63940923266229763 ,  1204310834945668266 ,  1866136104291005441 ,  1796756867644402367 ,  1294078375086650066 ,  1700942329782155853 ,  1420918311269286060 ,  934241811692668739 ,  1807205371943798768 ,  1456123182183785325 }, // x^2^547
+
+{ 706812684610353344 ,  1506428916351757871 ,  763373766855536454 ,  817541294264731049 ,  490159822941861045 ,  1295962481893758703 ,  1736826784343092989 ,  614005127564754627 ,  2276038671676053548 ,  682287975112479811 ,  2263237230905283760 ,  1651211157857705542 ,  1057705833473220303 ,  1573040093309137258 ,  1086239214524415197 ,  503626998915694440 ,  852401084184648375 ,  52979184252043550 ,  689048634143887744 ,  518897512837027369 ,  654393918256454447 ,  2036558022637180345 ,  1291600688980538103 ,  1696661210974792807 ,  2092688031522334513 ,  1301934696137729459 ,  2092241823160508501 ,  1513103556854915913 ,  2003815285955017835 ,  607937127931152163 ,  376361732826958739 ,  990361115724048496 ,  157462637622837020 ,  2119149449156010826 ,  596789439623454679 ,  2301657584895243203 ,  1307122610143731514 ,  412392491718168891 ,  1352358377548718473 ,  2009866080322278804 ,  2032655069355913990 ,  360281735517185242 ,  868983900429124932 ,  494497956133364869 ,  32046410647322829 ,  1510233666004010791 ,  1209843604207942070 ,  834182875618232808 ,  364496990546537925 ,  350381505014872419 ,  2207839412433424035 ,  1693914729004762621 ,  307468749739924919 ,  1581295507601108571 ,  1299236231624120439 ,  1808968918552900123 ,  747538512393769362 ,  700711502175881110 ,  964446784956041425 ,  1844771520156802844 ,  922595808407533859 ,  678660695164175567 ,  1560830024185227199 ,  1459539582627931730 ,  39997623876703589 ,  471467747797735014 ,  1381390891265905976 ,  1896883557146904654 ,  326358973606904308 ,  1772658886542975115 ,  387544821825630315 ,  564247470683297793 ,  1572269043037944239 ,  465629126121423712 ,  877790011491662839 ,  672768705085202124 ,  186832695367230932 ,  334930945872353073 ,  2155742557436924361 ,  989244175086239203 ,  1699805478548739254 ,  1947332643921088228 ,  617179602981732636 ,  1392405366150592687 ,  243138561028065479 ,  1893343306080995012 ,  1505527402301255348 ,  510003166382008522 ,  492499979850839673 ,  408203563956824952 ,  675570906980189765 ,  2044565714453881498 ,  1112995015878669320 ,  1202945958094558790 ,  1049577791740303258 ,  623978215759544073 ,  822876212657731926 ,  599841220736889953 ,  845766095929014198 ,  553814402778787305 ,  1313596447644235741 ,  585302108566451040 ,  716299836665067155 ,  1290873743442855663 ,  2111678352592693021 ,  838175722706878690 ,  2151333811797724442 ,  2258769950973020876 ,  560563675971184494 ,  2113717938422309180 ,  1667208972004237105 ,  2259100164982034616 ,  985215238789719704 ,  1343666842775209827 ,  2252764236712114736 ,  2265112759142416579 ,  1974590608411979562 ,  787060753619594375 ,  2211878014301911637 ,  582513866273076048 }, // x^2^548
+
+{ 2090437867244407186 ,  2275878498827588765 ,  179470798951995997 ,  1532467231583661531 ,  1732814323743101982 ,  440097596553698635 ,  2171021016906372145 ,  297373204925366791 ,  905382766772735332 ,  804183273231197962 ,  2265043949031944761 ,  1389048742846924695 ,  141721674534096361 ,  1995598442507889722 ,  580889609937802916 ,  1002460804938332470 ,  808710076807737525 ,  524584665450070047 ,  1147878579331329889 ,  1544257810451457827 ,  1228162650221471215 ,  1344874622507877844 ,  1531373622944976385 ,  1059062053080515434 ,  1790612699147851852 ,  77404315496559422 ,  1770208011787444272 ,  582918886373449626 ,  2256256512457472342 ,  717354087279916559 ,  1743799267101543947 ,  101006125240929121 ,  1031132699812981913 ,  1771035078437449766 ,  819515846862659765 ,  693134387108496161 ,  1695382918769096407 ,  668385214227531989 ,  597183587575297802 ,  1338951045704409349 ,  318108899324774659 ,  235144789982474640 ,  1005535224249469419 ,  1163155195404576804 ,  636436356816150102 ,  450522516709867780 ,  1438613735763836635 ,  199415239000728647 ,  591471478460739980 ,  1083694247046228854 ,  1760514237514654359 ,  756127643303939932 ,  1277443372338732134 ,  284806939150100334 ,  2243714703424458297 ,  1072059422072408602 ,  250345550063216110 ,  1738976991907113524 ,  2194325302186576044 ,  374280602921177 ,  167079049532848859 ,  1148866115140257865 ,  1329139854526141755 ,  1057275234878690918 ,  433803076283656018 ,  1786738651973448115 ,  2038693784340779718 ,  1342953011169205236 ,  22972330940543239 ,  653091786491068005 ,  54294528540656478 ,  877756302191787539 ,  16882245061160933 ,  76138721863626909 ,  1498333391939919396 ,  34646543567743447 ,  835999592266819848 ,  712442496941407985 ,  1490874565195127131 ,  254141240046849786 ,  2272661350760659159 ,  976752864852980439 ,  2234437638574526401 ,  1170803020089440956 ,  1267527086472002879 ,  2220188706624096762 ,  105876469375333996 ,  944002518958030450 ,  1521714645078682519 ,  1212967895430576703 ,  655461795055247322 ,  380830689241705871 ,  247426750808570932 ,  2022215155756959707 ,  784418928604459102 ,  1279267679484217539 ,  1672335244820224180 ,  148609470892074707 ,  241932841784653383 ,  1964399004181941467 ,  2132204265903456559 ,  289564706625145838 ,  1985961841330496369 ,  1559779615140622285 ,  461807660995449787 ,  1257297206602902526 ,  552967234896388554 ,  782441792105746559 ,  1354013647735847277 ,  1396813278821596718 ,  2255657960800457490 ,  1844570568798555915 ,  641000382600272293 ,  1127264328830045809 ,  633295803548043249 ,  440629376025320474 ,  1172933395921159253 ,  1107791032939116057 ,  711550257580441094 ,  2161636081556699925 }, // x^2^549
+
+{ 237798257205144056 ,  679654674408073006 ,  169701888778282487 ,  1325555483725009094 ,  1049369809973633356 ,  1002502222811755087 ,  2054472650013652819 ,  2184828761823019657 ,  45967045367461553 ,  1053285997694199213 ,  1936542003622316558 ,  969721889922227898 ,  1566739495588932852 ,  1866161425401449653 ,  814140207722112188 ,  2202054739578272286 ,  1987259363307486940 ,  1675100255142534718 ,  290606862389894384 ,  231454400566199478 ,  860490156044417201 ,  496403654524301271 ,  1846197242549169826 ,  1021159744706224182 ,  1635884434717354326 ,  359858860310440455 ,  871632267381271971 ,  1413879871930751261 ,  111165368254544836 ,  483527436838848764 ,  568713179639538732 ,  921156048462159542 ,  2227952567036269794 ,  1719212550450864891 ,  1481517161988508607 ,  1154277872272263309 ,  1966778185821195950 ,  1785504150662346230 ,  1358205407016647107 ,  1827681089544501192 ,  1377858462410529907 ,  114091449984847447 ,  958808482369562866 ,  1900163470928979885 ,  1425554475598157249 ,  1283693267832180325 ,  612233001423018326 ,  1150438253681022731 ,  1107704754941838171 ,  664070478596678054 ,  1399145871879455334 ,  618349515120221003 ,  46795921846824999 ,  1214044215437542902 ,  2261868088895821313 ,  231565065401987584 ,  968675534045335175 ,  579511686312875486 ,  833755753829873225 ,  1916981550981290795 ,  347749641243529473 ,  901795586635911509 ,  17030056795574921 ,  1467754034076032183 ,  553993064634720418 ,  884857373743055941 ,  2149100537987747041 ,  1395218847232509451 ,  1361607745913487949 ,  1127649287384823860 ,  1685833148754165948 ,  690797746444205481 ,  405206075460095885 ,  613610675428429345 ,  761190286651616088 ,  477638599322852101 ,  2112145301661000860 ,  1234594965284199795 ,  1578272267538948594 ,  1773003381492465487 ,  386299753935954077 ,  275028062542816103 ,  1296117831195533900 ,  1086634045144231294 ,  832699570317729565 ,  711515207653227734 ,  69790465312226177 ,  95476813670785975 ,  2093650897003149727 ,  317946521489480594 ,  1289959671684777276 ,  1901468682503935611 ,  2178228557212935810 ,  1545708375166640570 ,  619084794551810276 ,  839810583069957729 ,  139365557753907077 ,  1299855744264487331 ,  1919607506205196097 ,  324182520292747575 ,  726819530131602536 ,  1568759813688315651 ,  1750934301826934382 ,  1492812801403456129 ,  1268379568267409549 ,  2228466471561757532 ,  1561633594485525377 ,  734033372018677760 ,  538805220698189418 ,  820794903575240901 ,  1632115964982512473 ,  21749577390553269 ,  143066544608577196 ,  2261062870014236064 ,  1260639676197762066 ,  1192822946129247608 ,  1215384610881929793 ,  1515473129880255415 ,  685636776892883430 ,  18656310424055753 }, // x^2^550
+
+{ 1999875211499162587 ,  2250503272844862519 ,  1076460343362597420 ,  1635275762572725792 ,  2069931239713263545 ,  1974243010524375682 ,  1665051675451834782 ,  260369514520541882 ,  2266690081062699155 ,  1623847566611423375 ,  619586276136320267 ,  1097228447108176202 ,  14926978122975992 ,  2163220640238078718 ,  729775562885148605 ,  1530544916265186032 ,  1447059124092357921 ,  242989466975166353 ,  293235131131912970 ,  904605569992172758 ,  1405838110916557342 ,  550082042006247991 ,  2303226861704855078 ,  1468208088119777415 ,  1876539521055218661 ,  801943979618204688 ,  2039060659449700504 ,  1718772452521737022 ,  322249550203057696 ,  2172985989913463591 ,  1668255312006145164 ,  1669165552350907692 ,  2234375560189424233 ,  2302489291490510482 ,  2084361958963217110 ,  1027890792211228371 ,  246846720097213382 ,  330090195876924931 ,  820996387189922753 ,  396540282221296237 ,  1739640506695624041 ,  1986498148888258894 ,  1742051796465033789 ,  2298468217412736764 ,  431095204583871104 ,  683348516971055790 ,  1607607296586972764 ,  1533688221629102244 ,  394024755328357606 ,  95475528532975306 ,  262249855946173881 ,  864508887690925684 ,  2237358576857314666 ,  1671530094818633566 ,  562184774602866853 ,  361208498327232509 ,  1169223965975605432 ,  1105770375316038432 ,  138159961444633702 ,  89301240755763730 ,  113609992573256685 ,  1691042912003678474 ,  33849612236539459 ,  940621963118899234 ,  2000068012891634047 ,  346466841574621975 ,  2220232059754709438 ,  823596903075434065 ,  2292320553622916262 ,  1379814690798312269 ,  1141934162633877468 ,  525120917525914901 ,  1195076328276061967 ,  173568773617840452 ,  912762271011777641 ,  1553716245414264983 ,  1108314461557783137 ,  419621454243414054 ,  1503759042992450334 ,  1231174766938749910 ,  317007895247492618 ,  2014137187508725278 ,  2130141891848916514 ,  1691515782918460626 ,  2256100086398496143 ,  2074316164813663135 ,  1647829991114002364 ,  1772158717063268613 ,  1347975082188636396 ,  1563081183236884263 ,  258353652012367863 ,  1913468921501543168 ,  1937298248233551704 ,  820538376937576028 ,  536716037789414127 ,  2223569468354403886 ,  2078682699550635919 ,  814862929322596632 ,  256317543747612840 ,  402753725232059530 ,  1560772959533646923 ,  1772586954202948149 ,  251014455590951172 ,  1074381075304731747 ,  721432283214480587 ,  1132936015554275594 ,  965263362501732073 ,  971604922169964429 ,  1590396320750189277 ,  2006266903798331734 ,  228124416510443052 ,  1463458499033005233 ,  1561191478643220923 ,  2163830870148766903 ,  1377310992282753894 ,  111211859764721090 ,  993240697791391621 ,  2044399783574774858 ,  1435674285449308987 ,  1516362473096623658 }, // x^2^551
+
+{ 249176233375830970 ,  1651617408893706810 ,  1310959973958686174 ,  2143108605535878440 ,  442196338671409324 ,  1983954000386990601 ,  520878365127308557 ,  1501369950546610710 ,  86999159839125603 ,  1487032259795342704 ,  1455645442592822252 ,  294191415702860990 ,  2186001350281180876 ,  1771647681998869679 ,  1262074919636569201 ,  1140063510317294605 ,  346717944490033950 ,  904699443327264568 ,  1823221207081873960 ,  1365509469147695068 ,  757976092193729414 ,  296888492468147301 ,  1989215604494851091 ,  1245458645239661530 ,  1589990723312000350 ,  1078582199419009413 ,  1964723733162600468 ,  848559631725154539 ,  1264032953876885177 ,  1455625870143319569 ,  609918386914681086 ,  1681273273223581369 ,  1827697696703599407 ,  883940229783286086 ,  1420130946359706072 ,  579049022622973331 ,  14122388572445696 ,  388512587565483892 ,  1441322369909205638 ,  1970111221160124509 ,  763811915037153123 ,  1926255983810377711 ,  993609090378422124 ,  1130888419385053032 ,  851932122534006242 ,  701366809822642621 ,  1059844333293870731 ,  1751865617339447145 ,  883296054199689087 ,  1798760632135274686 ,  434955030729510104 ,  449345209638609638 ,  423354551720515969 ,  1083720676949059086 ,  1735659927964727966 ,  1770041053386083678 ,  1554818591668879788 ,  1680601035637799987 ,  2203272591174972488 ,  1853897310140871136 ,  684744353300708664 ,  585931579843514611 ,  1704869930211372108 ,  864068006166567444 ,  1921568400623454873 ,  1737366011922839052 ,  1622742621944124431 ,  1961033498202571484 ,  743581673203178148 ,  1591332649450876596 ,  33196156037649191 ,  131724953230936210 ,  1960568773194848681 ,  1281581537590357456 ,  1020774781973911069 ,  1574411198134722089 ,  186971623430371259 ,  1580740164895070370 ,  1813183038921761703 ,  2265600660960473276 ,  112807732247719814 ,  843092704801277494 ,  1783472229955123435 ,  979877735786466728 ,  36217858304449990 ,  477624067145533365 ,  2016471783557671806 ,  1225040245884348807 ,  1108000386610251493 ,  1721377826691237334 ,  1808264839472802063 ,  568397990891166454 ,  1163506309215272155 ,  1057451258282441779 ,  259220276930009755 ,  1760748940304255691 ,  462344928544069561 ,  1263674578489466975 ,  1092367787434399779 ,  517760713094886227 ,  639444962245393749 ,  1242194186335607710 ,  1656550198510167712 ,  298430349086880492 ,  554245885835603325 ,  423575801971200781 ,  789583029992888663 ,  982887715976208614 ,  2203798430865471024 ,  233295199630829403 ,  2028542709737915238 ,  1126963447654226709 ,  1082215027314059918 ,  544462986028492116 ,  1385120266863539037 ,  928497597507252865 ,  190967425594770161 ,  660912476646959870 ,  2243393775785916702 ,  1883137943952123771 }, // x^2^552
+
+{ 1742887918163399522 ,  1775635225883136447 ,  1915357313339114235 ,  544781851995162607 ,  1817225258067161658 ,  1292537364471491395 ,  297055260973466145 ,  154455827316535045 ,  2290942671204554833 ,  1274682682142117072 ,  1739556102194703699 ,  138733482223619739 ,  380364147520296233 ,  406689494446118506 ,  1861384229934839137 ,  317111486221309084 ,  546990538634662123 ,  1004726732422964658 ,  960629007774473230 ,  725380176964123048 ,  332725523264732401 ,  1581497972744152132 ,  878366543192811315 ,  2013565265211520191 ,  783239387372158747 ,  1758937313650540069 ,  255369203825875940 ,  254390583197798481 ,  603135324034975165 ,  370670702577582421 ,  2234921189032414827 ,  193376872182721287 ,  2155431558550684480 ,  1284058332148298914 ,  1052720078322041416 ,  653918768524780614 ,  1515635330891620324 ,  1508811772390083 ,  2085127702490641900 ,  564484538287747543 ,  1223587509747565305 ,  1695902508305988267 ,  740580684450987701 ,  1202356459701196456 ,  1628094855292161807 ,  2267924275240835390 ,  1935429584407362975 ,  262204217241457425 ,  974836717840877907 ,  1878350681654652624 ,  1490253316120616183 ,  128198357556358550 ,  1029957617667083149 ,  1767622888895844826 ,  1220447536986638610 ,  1998387294479842519 ,  146029616026602704 ,  631236275379819973 ,  704572120431882083 ,  2243849406253187538 ,  123493993965170392 ,  167491869463267272 ,  1601543244287865440 ,  280868415005814484 ,  385797026228517090 ,  966438975051536515 ,  2282073817389612739 ,  170663521076452961 ,  1052533557189423677 ,  1002934684058420989 ,  1984860032420150837 ,  1276776749699272597 ,  2145166122634012798 ,  1347419142096856711 ,  1498392381794243694 ,  47908570710274884 ,  444808941746100755 ,  1663356334668054392 ,  1150782200005190918 ,  1844130618458005496 ,  408450994282189275 ,  1669397038683290143 ,  1887162219234518847 ,  1828238662516598310 ,  1405048920479148630 ,  2108070970082730959 ,  413864416215917760 ,  798472417420656433 ,  1171570103355556898 ,  2018404831402342223 ,  1165020556195266349 ,  919123417752958454 ,  223947938420464161 ,  1935927947837879356 ,  1648096696029552654 ,  1097760151261921214 ,  861151432048529653 ,  739076781503756699 ,  1226537344148293484 ,  2211591652646564828 ,  585066803799741102 ,  1154696347193037079 ,  864343127907900890 ,  1638834838803555133 ,  2222791924584557090 ,  1635619502410547049 ,  1037494230281881647 ,  827095240663506781 ,  416293825034906441 ,  749783659654072416 ,  669461682681849598 ,  1059556757157320683 ,  1832701206103791421 ,  1496398570723981140 ,  1825892969980237605 ,  896076827013493083 ,  160118034301413573 ,  1370949950364220037 ,  414419589617923493 ,  651584957921088591 }, // x^2^553
+
+{ 583598543743763520 ,  2049921441105283292 ,  2198575438643675628 ,  2232634979089839068 ,  266723482723487849 ,  1871200992936617746 ,  950401791965886878 ,  952099438886246365 ,  562607783942832548 ,  511008531179239592 ,  1336428090346277696 ,  568439163030459861 ,  684620904781889891 ,  1770530974665324222 ,  917632532930895720 ,  2032544798471688270 ,  768357156189969742 ,  61309588551045118 ,  579587404202668671 ,  1185991664118154551 ,  1360691272728234248 ,  1683617316001851468 ,  1068397801267040944 ,  1400851311965461207 ,  2082642333344506067 ,  2132122142904598624 ,  467245988705288358 ,  152184176299637861 ,  1462346597909791604 ,  1842559930399551799 ,  1099470399845947531 ,  1311944414353296361 ,  1214622538376760786 ,  1769299079102480957 ,  823825780030960622 ,  206614570963403533 ,  261522560828635090 ,  1049899859276062408 ,  663216377928145469 ,  1328914016083833665 ,  1109323845773476160 ,  2028020395842193438 ,  1631628908230858473 ,  1545988497342552832 ,  1285691467809834585 ,  455837013622741476 ,  1428616828436683267 ,  2036591818602778117 ,  1380359474610804874 ,  929331691003991631 ,  2025302589742500493 ,  1269970493920707722 ,  1936292851238878325 ,  708752549037352959 ,  613189680112634553 ,  1306100603726706610 ,  1154869790629932273 ,  325749618822117883 ,  513600985945164493 ,  1871454309314404742 ,  1846696810028397944 ,  655730179153179737 ,  2024388911982757744 ,  1113047474437910057 ,  952746975195709298 ,  1916896724218098329 ,  2258506599372151810 ,  1065179775368454508 ,  1443478505945909427 ,  631223538188923926 ,  898795225514150180 ,  811921085546181217 ,  1993838709350627577 ,  1723690661521257942 ,  2148221149999971672 ,  1252830857285006534 ,  1556742053227399616 ,  1084348019627530644 ,  1113840993615213584 ,  1280782047059846829 ,  619877471286435147 ,  408037642411931000 ,  1201683537111117539 ,  2012650328812589553 ,  294706060859170747 ,  2234789354317218353 ,  721548952269810796 ,  2093389285845885894 ,  807522989496381729 ,  829499865945993037 ,  211784266475235819 ,  902365653154505062 ,  1131130855909468296 ,  1566025634936931015 ,  1156141322410485390 ,  1282269708813481722 ,  158797593477495582 ,  699293050108192292 ,  1598671343375015930 ,  66294508063277688 ,  569621847998657941 ,  716566632389679179 ,  951636909499919402 ,  381159932000339690 ,  153981446511026546 ,  1513546386247590190 ,  1992553465707110602 ,  840649803691318664 ,  172104508973974860 ,  314084964664702283 ,  1842740268820878717 ,  2249874280255775531 ,  123273647308081700 ,  1867175990587387079 ,  1300190895364587775 ,  437430285394041131 ,  1318507430858743657 ,  1002419920983170392 ,  1318563834156024746 ,  1205417098206158288 }, // x^2^554
+
+{ 218256844099909595 ,  2241046958848784164 ,  81099223629791966 ,  1552371782676324113 ,  1149255544099224878 ,  1945996248397374321 ,  1077350344224405738 ,  1498657561376410270 ,  2226467790074061356 ,  90100916273627688 ,  1920545240971559953 ,  23330742842903062 ,  761907684760153182 ,  1372084185989954756 ,  2292364850732883116 ,  1606523584232527350 ,  335097211427368924 ,  2191636154086761214 ,  1146005287088653429 ,  411560727968937246 ,  1574781450527691943 ,  1193726271464241253 ,  767064736519875639 ,  1444067834239855641 ,  1956009810016347811 ,  1760232929656284526 ,  149764530354609485 ,  1663110572292368454 ,  1671987875884735230 ,  1291724876279148898 ,  842672452234815091 ,  17261315928127047 ,  1502360599218460605 ,  611474471273175511 ,  1853723614092646844 ,  785683125016828367 ,  1555427651121914592 ,  1858079568503696019 ,  1696934849838042205 ,  2201571783017111358 ,  1400829368363087983 ,  209273618275810922 ,  959417042320723798 ,  1582984414192957260 ,  336768367289212688 ,  530780550246331755 ,  2140178912226288576 ,  2225525038046863437 ,  441162994876035292 ,  1947953119001039579 ,  1080047237652773193 ,  300461962075293208 ,  2039453457319243523 ,  1587110411925324146 ,  580673221854328072 ,  11913579289993355 ,  1054818158455288222 ,  2128940982369133229 ,  618561646006627502 ,  1131424956591649396 ,  1032532511815349892 ,  715804467792326063 ,  1701797506717723891 ,  1915103480158757367 ,  2294100619215926704 ,  1142904054478500587 ,  752370449488026133 ,  98452156195412790 ,  601287433583372441 ,  1249411737513777442 ,  1793770557950191929 ,  25505062554355771 ,  2299709995086941822 ,  1707012219053047995 ,  1818314341432887793 ,  384358554934596862 ,  106618210820975304 ,  816932470260636536 ,  461175341320954399 ,  1027390454006649590 ,  1983755499539935911 ,  1008275293296158599 ,  1772693982997318347 ,  1368646244325856542 ,  1251210188284097796 ,  1843715650907308991 ,  1946630310219571845 ,  62086174630689328 ,  1497845355339751390 ,  2073785498522863200 ,  1194095702080308615 ,  476675284980904219 ,  795117783162452644 ,  250470329541229484 ,  1203490920612730419 ,  359604713318146680 ,  1438248451740583661 ,  1420200012969194564 ,  2215333887243319147 ,  1360426381915664910 ,  2012044626106977963 ,  1331878905715718892 ,  1631835476882621625 ,  953640909275237165 ,  125193804888120182 ,  53137830614354954 ,  970013179492107302 ,  27045925878461941 ,  1602833926662849747 ,  1022533265073840933 ,  15784662044143908 ,  1709997594781798733 ,  1574459957534773392 ,  2071687137364609081 ,  885491484047608632 ,  2159580574211496688 ,  1091600753848695952 ,  1658322139812360514 ,  330499794969120716 ,  1652645908907550948 }, // x^2^555
+
+{ 1584280656576957258 ,  499203576377003303 ,  764652671718423132 ,  1819664415201048300 ,  2061551681778361961 ,  432005256525933863 ,  637118446966234053 ,  1178925435441555853 ,  1180492820580376543 ,  1046914227101549398 ,  1200777869399515203 ,  1047225627748717345 ,  552596092749973328 ,  2041071139906006404 ,  1548071965386135435 ,  1942085872281828407 ,  1069525780908661438 ,  1651849232443873882 ,  454766077410541645 ,  1473796987900110200 ,  579964239856154481 ,  806683838378324975 ,  123157926402672623 ,  717688331625748565 ,  1676180130958886765 ,  1668493969719905417 ,  1737333643812603144 ,  578893088821955881 ,  651614981452007695 ,  221991561765126444 ,  187459269592068242 ,  1362884125630947459 ,  396027748080212577 ,  2271196401884142078 ,  743526920728700325 ,  1525149045638745666 ,  205099202878867124 ,  1340243146186900710 ,  190660619402450844 ,  587176985972046305 ,  965496478695989318 ,  988607312954117777 ,  1564161266901344155 ,  2016230594107871833 ,  465163232180264 ,  2198239913887341520 ,  2118196614101354497 ,  1421377909374341090 ,  2006667132885593919 ,  1221220641983152593 ,  281654689614748066 ,  1076769879335516351 ,  1739788640779262861 ,  246450475907872434 ,  445371466168602781 ,  401097240850847441 ,  1089433820381042873 ,  934897049293979188 ,  1582481155619364597 ,  2065213745490703115 ,  224074937335203597 ,  1388048449701768282 ,  572476113644447781 ,  1490743133944525087 ,  2045473869718647943 ,  1684994200355652935 ,  1154414509498058941 ,  262713618026197935 ,  1357432638006294109 ,  1611554552116059056 ,  1090629707256197625 ,  1139759665878042966 ,  1936589143711566115 ,  500741502155239665 ,  679218603807767264 ,  1630704438839252606 ,  1623733564596897828 ,  5527978859571988 ,  259951181536789406 ,  1077026445475886526 ,  1505117441028078519 ,  1427044379483191857 ,  681234595282608286 ,  608333601175465598 ,  923463549394697140 ,  1073323554079541212 ,  2108259155279695189 ,  785333857758861476 ,  240492420045027671 ,  1910813674722506578 ,  1597036027297896649 ,  868802839786005991 ,  913275307156688385 ,  1377414819927310510 ,  870974573833251062 ,  1868648519533721149 ,  503097095364028279 ,  1798405125620273367 ,  589392789061661192 ,  1422781584132417736 ,  276911820774612282 ,  1085161115096749377 ,  1785906296710167933 ,  2290720158940859698 ,  564701333124054255 ,  1969555876386766288 ,  182657509332308324 ,  478424427309739823 ,  1790875757616872223 ,  1505641243977663685 ,  70780617965951613 ,  861052431191131666 ,  1874574073310145140 ,  1477359862579594923 ,  967431161630579372 ,  451964009751196421 ,  764775871683663969 ,  102369480588734059 ,  2059224867159716731 ,  533268503435621161 }, // x^2^556
+
+{ 1715869737709051949 ,  1303760350051748848 ,  132676539234608326 ,  540498875236609065 ,  2209023240220621810 ,  2054653407655770273 ,  826360376889026277 ,  877348997553327943 ,  224657017955595606 ,  2225745075012750448 ,  2223788481808439935 ,  990313890926633716 ,  888759917125392854 ,  627121487991881349 ,  1409026542749432769 ,  242287330964830501 ,  1042279444827172062 ,  301109199370225707 ,  1482885683603072196 ,  2000455485444928997 ,  349581414507299162 ,  780870534855415405 ,  246855602425295304 ,  154014432180246898 ,  1865121863715708257 ,  1683373781873390843 ,  438754067100313926 ,  493037532707160648 ,  745495396695023042 ,  2296255012080495285 ,  1772910408826546947 ,  690537451821333970 ,  590732753048228114 ,  2215728861810228284 ,  703679730104219187 ,  1397081553469475786 ,  534532765218389445 ,  658188851541185540 ,  1802495833888268914 ,  1270662260816516717 ,  1461856138796416038 ,  640195307368076740 ,  1864855796642410540 ,  992149447050765628 ,  544297220832841297 ,  1579478319318045454 ,  875678586170148052 ,  83572507913170507 ,  324970958522285611 ,  1733503579141026435 ,  489090347646849504 ,  1061602158264454 ,  1362871974561076114 ,  2127624583349807597 ,  1083875864725777122 ,  1125246683757871317 ,  304558132425911410 ,  1295827664030636568 ,  1755015743191505402 ,  1495218160442752721 ,  515584957304334969 ,  1877142540655257899 ,  463865206616127160 ,  2105000015086189884 ,  2113319517569810536 ,  1766178522184538351 ,  75221884994504623 ,  945983517283901345 ,  266754159713650867 ,  387486888304981872 ,  509170853687529857 ,  1242072955314955217 ,  1087437637837188336 ,  85849687595282723 ,  1672523091123565544 ,  605507436492616117 ,  1011431989160723524 ,  1094281000682866392 ,  1431037373472848131 ,  1483559205607692086 ,  1827010747944458689 ,  1856901447324799545 ,  43794832783055455 ,  1645068216745418390 ,  100243725642326231 ,  678409416304090836 ,  644975762483176445 ,  737685917145549475 ,  951609694020323043 ,  923683996706861156 ,  1407501265689477811 ,  997211448454645001 ,  410842306196358037 ,  1402650427065349120 ,  543996816897426771 ,  1057134663044526168 ,  1933456119572447075 ,  438636079125817153 ,  1341583443522246079 ,  1529672985571148264 ,  196954993060329835 ,  903542844422240793 ,  602940895911444246 ,  1254510967331754865 ,  1015615269477646375 ,  2168972649003042179 ,  1660749706323301999 ,  73404805156667237 ,  844857376932134396 ,  2007841600930503761 ,  203217403057508987 ,  747115553523254756 ,  1128993219301176535 ,  1416443185866094609 ,  2080985169481156851 ,  1250485691803405444 ,  550128250714891949 ,  2051014759382247685 ,  1289043788631119242 ,  1926756924422018813 }, // x^2^557
+
+{ 1184367954221656073 ,  18928997176339135 ,  1282905916508363635 ,  1893839566179155876 ,  202714158705296577 ,  1163159116400897375 ,  1235896570643965882 ,  1806720555708368524 ,  715985996962783289 ,  2079618498718753539 ,  1951138342244382023 ,  460675035031848350 ,  1386780477101927331 ,  1836460149104584230 ,  28708569179450400 ,  1690738847129398056 ,  1403972714451159392 ,  1093308079886250224 ,  1057814034721727928 ,  1557286496291541057 ,  227908112933384794 ,  545719740417424811 ,  357921707923775660 ,  1979396994147152950 ,  1708700693753872505 ,  355405811771986039 ,  2243123276833907532 ,  1135212755536359454 ,  542264223594100787 ,  1252148057313984725 ,  398113153440108389 ,  1186309668320211134 ,  454663199839431175 ,  303082920755055732 ,  326502712575841730 ,  2161464006852750855 ,  146375958769221784 ,  1890010509672762017 ,  2085097902238480972 ,  1024962709335371427 ,  1354901781249880937 ,  1411445501889539538 ,  740876087980673725 ,  958185241998145155 ,  1157106651204365384 ,  226788956937041387 ,  1386908560077487478 ,  196663687464702738 ,  576054877645622110 ,  871999966711826404 ,  876433083075812807 ,  1043966114012271044 ,  536281479915214832 ,  1916506966545485552 ,  86767751837586930 ,  65019124925715330 ,  1008840785108900962 ,  1989856642033322622 ,  1557683960902391062 ,  1159727287367112515 ,  570588170373926840 ,  36915243747866665 ,  1688140260379532408 ,  1010757160571792142 ,  2001621926708795027 ,  894324951319236946 ,  92723034990605329 ,  617181720135005138 ,  1160400571133922183 ,  1392196110046208509 ,  1738495248402837377 ,  1467968742711887832 ,  168629984235949566 ,  1612359682130937436 ,  1060754831643196011 ,  1276417246777232347 ,  1662561097419005648 ,  1892493577071592519 ,  1868913304934158413 ,  2005248675239688825 ,  2147266512207920574 ,  671018548392849667 ,  1579305937009891748 ,  518927142322666735 ,  1388951046020659350 ,  1291994000353308739 ,  912514525740777602 ,  1740199492289644878 ,  1628414357492616540 ,  1292857270678078846 ,  233411570537251372 ,  772979816400958000 ,  704619002271419281 ,  824238725863375516 ,  989009258801267519 ,  266434588252870139 ,  1108606138743546511 ,  733561826591525209 ,  2043470713194532821 ,  536605928714083120 ,  1057580244992044871 ,  333672029089459981 ,  1443178580543513731 ,  947923678631323881 ,  1753563816214413599 ,  1891057926565273489 ,  2077173139334686037 ,  2099648514348251893 ,  1569788814155130397 ,  1177741692199850181 ,  1635328954140797051 ,  2045691498598162032 ,  38497868747262957 ,  1402951527813828821 ,  1796074824778983656 ,  1374520956665448751 ,  179981293176341490 ,  428497419194410164 ,  1990351882001705282 ,  757603554739745463 }, // x^2^558
+
+{ 1227668655342313868 ,  1899547777082134576 ,  1808681281524880879 ,  1918742203055158698 ,  1915963111005477393 ,  1074335818803927488 ,  1620649856087148915 ,  1977380802664140216 ,  1447924023413155975 ,  1044671889398150567 ,  1400514301361556852 ,  1379542074189067810 ,  1325922619963350210 ,  2107060416347319756 ,  872800893553925947 ,  2170019793514416763 ,  498436623285641019 ,  810968301670633669 ,  45285001405221359 ,  721377769056382395 ,  501180917061380116 ,  1167731340617103001 ,  2220705751075628308 ,  27992464988073203 ,  1443057051913517731 ,  633904930173726676 ,  527908059927281275 ,  1622336910841692830 ,  378541844082019593 ,  940072019116281413 ,  1771032668196495353 ,  1603699004162656471 ,  687821373729442440 ,  2149240480951610301 ,  2199381485946615386 ,  149568797287500804 ,  635501947224071563 ,  1638139014024232952 ,  577551878528366160 ,  1457606285572696086 ,  1212051649153852080 ,  312173028930513717 ,  1152988501489353035 ,  2171207830371477242 ,  2235944171981421984 ,  2173988149356572664 ,  2166746677599341257 ,  847257868823412223 ,  1718087966982752737 ,  499200454491549430 ,  1884049495444723773 ,  617621319805329195 ,  1933628056304646022 ,  1817250162541347432 ,  1021194213564042270 ,  213229730998816443 ,  1408391578074780115 ,  477714195734676362 ,  1766937387606058780 ,  1173252104016980543 ,  1017386204328527697 ,  2214870362583332337 ,  1684362065190431225 ,  1792317502945453906 ,  1812532547233225749 ,  1028266065494918220 ,  443064824003049141 ,  2104855467782549623 ,  152677519725136425 ,  1424006609562270805 ,  1522607471925234104 ,  2728621016703592 ,  655874804913958853 ,  2285026189635372948 ,  701898897307015011 ,  14556478965870784 ,  313613696767636254 ,  1334348328351873259 ,  337988162175707879 ,  679196032684908769 ,  1446987485651487653 ,  670328816104238271 ,  2070203528157442121 ,  656669841254875398 ,  745894387002366129 ,  2017500478358738416 ,  1334585170425225621 ,  751946582152894366 ,  1447271706405395288 ,  556078886582430844 ,  1979192530774144959 ,  1105921189945765936 ,  463354320386919488 ,  1815550723921241141 ,  2091721794897572842 ,  1228845683423550528 ,  434555179703282189 ,  297160198289924065 ,  1936216373917408924 ,  1385374583665673903 ,  1710339208444988993 ,  2009149911259812932 ,  2207901295119583937 ,  97918015073844798 ,  1603611437831836613 ,  1854470414122737982 ,  1679848663151145733 ,  1865486468750016001 ,  2162828532019145398 ,  1629526840723844257 ,  2196338964068254600 ,  1176584347585771372 ,  590772946878834343 ,  670333048516668012 ,  891600072274069019 ,  2298326611912480913 ,  1443062163842655331 ,  300059733899883364 ,  512305612291650597 ,  385650357516654765 }, // x^2^559
+
+{ 1814354074453412080 ,  768134741487637577 ,  1931163498895393653 ,  39396171274660111 ,  444306642444164491 ,  1799811799484834452 ,  1395163656170224220 ,  1835887930099433241 ,  1429540173548183436 ,  285233830949102834 ,  43488378621914470 ,  204144870149130092 ,  1625344082469700021 ,  1034831709757116255 ,  2132530857303327048 ,  1373885498981055626 ,  1538107911587575857 ,  1602796495083815394 ,  968049377541405566 ,  1419618338474001184 ,  1145776378008871071 ,  1285231604935345506 ,  1078084220811641022 ,  1616285555358776300 ,  1688634302697490749 ,  2071282098891349083 ,  164056530414704543 ,  216386890014011559 ,  2238575001487814713 ,  1030254789445913029 ,  886471557675398975 ,  2063292131357662488 ,  1452533839217196940 ,  339235113816824361 ,  1552990903164568577 ,  690317452622271377 ,  813925128823276732 ,  1924646560975669661 ,  197132356310357232 ,  1530192763715600641 ,  767257463362444187 ,  1864312565487760874 ,  1813284363980046771 ,  1235916116233536221 ,  1325901888078803031 ,  2039663199418889740 ,  1085167387039993448 ,  2135465884868403036 ,  1089373286370803808 ,  1134462671969642822 ,  686915723870925588 ,  2090179865587893546 ,  2026430323915678932 ,  1711729686935806235 ,  1563000463193349322 ,  196370616852247489 ,  400063786450447613 ,  1353492797406571841 ,  851871500850205034 ,  1142221960765690790 ,  1133549079981525746 ,  753867366252770838 ,  135774766629725251 ,  887475381438934773 ,  1211449354654871045 ,  313298936349234119 ,  1684894545936835876 ,  2107340651034738053 ,  520766023797230793 ,  1241440252539776201 ,  1135437734825341661 ,  242775152516611675 ,  631213436754440767 ,  733845396717928806 ,  1335312594131159245 ,  993831683152541869 ,  573381198867021178 ,  573104678920356594 ,  353631397551954743 ,  1962421585070468759 ,  486571025173249777 ,  146085076824336694 ,  2063050506188370161 ,  63117336934973592 ,  1441541803379934745 ,  1566539030796573957 ,  1472961147241024122 ,  1494322319802055347 ,  1489253770460492579 ,  1688177773185542816 ,  461122496519627198 ,  339449576944107691 ,  1606422840512460853 ,  2080553632164342513 ,  67832362306358461 ,  2186222349141427096 ,  814105290965782401 ,  2164605759510456029 ,  1918112554555725016 ,  26903187388346921 ,  2022197811516265511 ,  1990705234311113791 ,  2150832430391523184 ,  751755299741283259 ,  883713992712023336 ,  942156726848162751 ,  550622262649213551 ,  750786754245630688 ,  1980861057236177368 ,  2196243190359017227 ,  330760786684040997 ,  1264585592809343915 ,  2200603704072523641 ,  892503221539706193 ,  948296151972704757 ,  2046499813408007260 ,  1591672557997524439 ,  2265937171376818073 ,  214872969300623314 ,  291729957026178591 }, // x^2^560
+
+{ 528034913902167818 ,  1103036851017272713 ,  2080637240504401896 ,  359072792596646416 ,  1130360199183834612 ,  2285818728476346637 ,  782345712971489710 ,  130495212573327839 ,  2185473754727273216 ,  340833926620445931 ,  826897662781081721 ,  134842940284560170 ,  1663456568043425899 ,  1500280374963638172 ,  2144323448352384087 ,  370594032334152938 ,  1876600051155140540 ,  1530726091582391660 ,  1590216370302486045 ,  135636079239629605 ,  778916602613019748 ,  1610952021838487485 ,  1751311555759374487 ,  134096862725670705 ,  2055700649681046667 ,  165129148395088502 ,  2036764003906808151 ,  1679511799185488532 ,  1270311300143237340 ,  1783678299836436638 ,  1008050579455274416 ,  173667875574757231 ,  1728377841832402682 ,  1659574149774512816 ,  130434684300397527 ,  442979934570192668 ,  1992374001952163490 ,  1721890996869835993 ,  904881772945050695 ,  758531635023470244 ,  1444373745383796134 ,  555060681594136584 ,  764969371604862679 ,  243163369206851281 ,  794930514313419814 ,  1524723927158027222 ,  831317526544937149 ,  1889787069962015874 ,  319407922200547961 ,  291716924598621943 ,  1593063694249387100 ,  533861329912833949 ,  1321726519258729436 ,  376883544335025441 ,  1357496590667710056 ,  166549331936139571 ,  2304782046227752574 ,  2093504052786385865 ,  203342014412984370 ,  269559910003489165 ,  1712358507705290208 ,  2114631814749189067 ,  1922435932993315931 ,  804401840289318970 ,  1383679636633637022 ,  1664754372944166287 ,  249448697505846920 ,  480550629031847498 ,  2203581053055198232 ,  1385774733586620438 ,  370516343057161343 ,  1608289493581026774 ,  455931131103664425 ,  1061809443415290071 ,  1776740378617249114 ,  831337051683034773 ,  1823971513612410315 ,  62461617632846354 ,  851893346218773579 ,  2302570657217263652 ,  859139623327947617 ,  995393125032467346 ,  613236834484436551 ,  1955826615646665486 ,  2261520357736934997 ,  1693892234275426216 ,  337803458487448616 ,  291718756366449179 ,  2017775846402098849 ,  1177978283777417928 ,  1003757634535120317 ,  111391869938908164 ,  1963295154271667566 ,  161938127347756182 ,  1629926178435815969 ,  1485718695311701936 ,  179185525363288612 ,  475934723742405629 ,  284080939497872014 ,  1513291411940876751 ,  1411293197189676859 ,  2170306478412993307 ,  1714762007342781001 ,  1208275283426454785 ,  538274643250947874 ,  323915423004952886 ,  1864206503115318733 ,  20798193400916069 ,  1699466385216269187 ,  674096308097432017 ,  1826014578034803265 ,  1669666359949810666 ,  2048976265206799527 ,  437399129096335733 ,  2164557788717655568 ,  1202230542434258396 ,  151749576006930703 ,  1946122492343960297 ,  462396777517782693 ,  2193199412588970669 }, // x^2^561
+
+{ 1927956430596505669 ,  176345476299369263 ,  986996060316430503 ,  85600806350522204 ,  674722671356467644 ,  2224690350636559198 ,  1966103419312046493 ,  321758403592745568 ,  798335934721023372 ,  649241149754500473 ,  1805683366611394910 ,  697588676599172316 ,  1298776681254280892 ,  2082886910235913245 ,  1154798052340460040 ,  2182324943738734647 ,  481183644625400176 ,  1014339039735494883 ,  1904583142181675752 ,  2122163193014988881 ,  2104641629766622921 ,  864899026413326146 ,  2247494306877817900 ,  1256081281469358169 ,  2220885546597062391 ,  1107520605201145796 ,  488797367726612080 ,  350344802435498269 ,  1186033449695150700 ,  754110844490820063 ,  333586984200392885 ,  489027527237830025 ,  643141269239617386 ,  2192235485921375734 ,  1961576825701050498 ,  1104951315823186442 ,  244841430156764286 ,  1474056807807609376 ,  307004270698960814 ,  470470737133691381 ,  523183332839094828 ,  251972842771741694 ,  645559918108692236 ,  1589626950797967073 ,  157156418517613903 ,  413670354664904080 ,  669060674572235168 ,  737912039904494117 ,  2237527273599715475 ,  788444916732468530 ,  749079011461641099 ,  1862124368765583144 ,  1006359956325355651 ,  1456330911771612914 ,  150299346969933823 ,  1101965848437509046 ,  370578127575346035 ,  67338006311426194 ,  215005540046448762 ,  2170047939009728396 ,  515945247018138500 ,  105739944961567357 ,  1850088651792851752 ,  689160010529165128 ,  633063743963050887 ,  994115085961052568 ,  1590180212288705755 ,  2021385940432080550 ,  1357949258066052797 ,  220501956501057951 ,  51543574589550723 ,  1844782708309820252 ,  424919266554463138 ,  94611889422799722 ,  845110535621948168 ,  1331345160177262382 ,  253899282510577629 ,  1788653245136476599 ,  611851228739134109 ,  976585837055484638 ,  590995052522457641 ,  147133231821387633 ,  1168066271183983399 ,  268584383545669902 ,  1487624705691802649 ,  365377627932033318 ,  319716628880984325 ,  2099641841452024784 ,  184489561209743535 ,  1599677575606324272 ,  373836561283983890 ,  511640085564304349 ,  281600874528014796 ,  1116100805149580651 ,  1839164978081943970 ,  2277719431335820500 ,  32188996676043040 ,  2232512339682823430 ,  742730493084744504 ,  613166456080847147 ,  915527183984489215 ,  57899436342373763 ,  720584878629939317 ,  1995108443402809406 ,  961154747948953308 ,  145901235260037724 ,  1325514935171566368 ,  878787848700577568 ,  1537282037592145901 ,  2159268629847347181 ,  1108697057911935924 ,  1520733124498859263 ,  658404720269092735 ,  599780895349690186 ,  339913923828270032 ,  2076521747963371715 ,  2019514516137548972 ,  1316410371861723889 ,  282673090304713300 ,  1001342317140388941 }, // x^2^562
+
+{ 76855111422658603 ,  1182864260588991579 ,  2223877970430086489 ,  2043334020252776491 ,  1824677518041970838 ,  542227031681790566 ,  1820841468703341371 ,  912470337033419376 ,  837559117026976038 ,  1382787393256780486 ,  674970461839732400 ,  280939063014586467 ,  1820295527898750790 ,  1502532174245523428 ,  323265548171374658 ,  1757670076622560467 ,  377258782140310421 ,  607318944334632256 ,  1021373721375667834 ,  140296143891732940 ,  2039211061277491719 ,  2215882996344772884 ,  1005540682730702338 ,  2266484818944837524 ,  1089988330285468415 ,  893983713259939614 ,  1694536865413272545 ,  1720723903081400768 ,  432105724162731937 ,  887553739530828523 ,  1010123511634631161 ,  255493440755216058 ,  1592821155561425707 ,  1156832474060102100 ,  298216108116664060 ,  16327961314947402 ,  2034467983294861390 ,  1762311448585786991 ,  2199116449665469714 ,  1165049987230314198 ,  1693364087496268091 ,  860434483025778882 ,  1876770275514406201 ,  839716476362973562 ,  1146208733036838463 ,  2096887638380951217 ,  495777096859333300 ,  1866925463933258488 ,  76235864019861152 ,  967471803665639724 ,  1905181793484038301 ,  1912104321384446165 ,  1743974922655154151 ,  747797255094005886 ,  1653134060074695285 ,  1559068854742542852 ,  1239851430055992466 ,  1374802971509318319 ,  1171971839788957176 ,  1883722543477373618 ,  1616493052093134567 ,  780950270420341039 ,  1474971103367864338 ,  841909062672813141 ,  47279178695654996 ,  544741732361137211 ,  472212642461175160 ,  1204379058735063097 ,  2218308818750463872 ,  76106698019530816 ,  1105122494778557773 ,  221848332547622274 ,  476221109446028559 ,  2023077898019105668 ,  1282476438601040604 ,  1504838001312376076 ,  731498960880620195 ,  226655746507926066 ,  422879499145369429 ,  582449391684612522 ,  431326427864551515 ,  541307536704659600 ,  1412357626311862975 ,  1866048720429217822 ,  622504387281977525 ,  371592747001738157 ,  2017832487090898710 ,  1798106124845905144 ,  128610651786828677 ,  1178184092428816130 ,  627846123457533425 ,  1659815154885590294 ,  186791100661120689 ,  2158738875300783464 ,  1283220275874440278 ,  396123920020560323 ,  108057248207695189 ,  719289978606827351 ,  238600254103566596 ,  234126444915617448 ,  1541275587886327927 ,  413655746995645303 ,  1392496942037902020 ,  1596668472515559736 ,  225139136667946930 ,  798861354241691398 ,  811168628768354536 ,  866707343120109744 ,  1594731308000166978 ,  2213364848530811049 ,  258132638748574228 ,  2155425005593096360 ,  237441766069627625 ,  24497875925420345 ,  861926017594580923 ,  1752716134769146548 ,  693812746029921543 ,  1273378862084754017 ,  1151268140556869139 ,  463790030172334970 }, // x^2^563
+
+{ 470498352946159806 ,  1773673570255665973 ,  164745513639354717 ,  1215684643617971887 ,  2153557698911584145 ,  672608699992132895 ,  15834405561019772 ,  1353964241870912023 ,  1162195498274740149 ,  1947199367474460716 ,  1755910769579033043 ,  1538596976009600218 ,  602036582135660111 ,  327764998894720958 ,  1998735182630049456 ,  2090433823426347274 ,  1572175958031368196 ,  388811738026461139 ,  1716349142939509347 ,  2065796248925594302 ,  681996754094181066 ,  2229055937292417355 ,  2236277263326926413 ,  154323601608592575 ,  927675303006069544 ,  571988309356691682 ,  1391197032739716220 ,  461283713741599388 ,  100648648363916901 ,  174303825959183854 ,  199251988610454177 ,  1325983248190765672 ,  1554602210166065735 ,  746408456696483208 ,  1954065617778335076 ,  822904027531986200 ,  1702825153481018864 ,  1929722769327725408 ,  464253900901069167 ,  503205279901771117 ,  1735156548730777732 ,  28829902404227511 ,  1215784192841723726 ,  1745482050051331190 ,  522240211307827658 ,  681176350069838329 ,  1657980437147875956 ,  1512378432001814191 ,  2133539032852106780 ,  485607688273253255 ,  1290105108255253760 ,  316903363950965412 ,  196545693980186305 ,  410668732271378853 ,  2199340581444602338 ,  344210434563157244 ,  1923503873775291059 ,  1966064442084304867 ,  2037706450868580469 ,  881348026656826000 ,  159754638290341290 ,  142637654133070806 ,  999713381963824940 ,  1069154893090655723 ,  1328743827523377492 ,  1560552563214885156 ,  460585220983254487 ,  612509431595080138 ,  1272520799046497728 ,  502838572536471153 ,  1621155449292523272 ,  1693936434230387653 ,  1739432129663945788 ,  1817881922300751264 ,  1000407830980260625 ,  2185248276509389584 ,  17467609368087484 ,  770419914404057436 ,  491644704154759338 ,  446162779095792489 ,  1074904070082718495 ,  1283460080667424699 ,  1118712332650603050 ,  1483036804804123890 ,  2090786947145117971 ,  140775484036609209 ,  350098690678864761 ,  1704876162945734300 ,  1934530380177605375 ,  1093858098732327760 ,  1903469741871242198 ,  2186930469088989221 ,  705309571211416977 ,  2011781291149476389 ,  820165633466736524 ,  217017640562047914 ,  107557048837053664 ,  1376223153477595720 ,  732587500173585944 ,  569322164668123084 ,  1687618204111924076 ,  2303514653355672282 ,  824858887388559883 ,  1961946843840679342 ,  2264021847735764515 ,  2189937472860156684 ,  487873047154278246 ,  280324735185516602 ,  1952924366151062871 ,  1756188562795121858 ,  556206872423264837 ,  443825967428121069 ,  690092157965666797 ,  643797371588143150 ,  1831517468620685182 ,  977750710581703127 ,  2010381882730453802 ,  2103880245344955132 ,  1611186933905941483 ,  1631862178567318412 }, // x^2^564
+
+{ 370074789273369742 ,  1200921146786940404 ,  1101206953498907291 ,  706983171594840438 ,  995157978683004366 ,  1828624011308000021 ,  2041531853030764860 ,  2174746332299311039 ,  1485538973088396626 ,  1396618186965217156 ,  494282443196252045 ,  1353307651261003424 ,  462534974693899590 ,  448701832443902962 ,  1592498763360108789 ,  519577690561068023 ,  822264969364994471 ,  1777036358575445159 ,  986025944450457468 ,  1588831930441270145 ,  48931555527062341 ,  1468621298329534243 ,  1331033329235563701 ,  1594715808905918170 ,  1979759934519468235 ,  1199306832467758152 ,  1736988502099353396 ,  1010743482672407972 ,  1089348682213503403 ,  774842264785944138 ,  148282939554313232 ,  739095286401731474 ,  1706602219792155844 ,  1276059967421402196 ,  1370988995393251663 ,  1870790081333064293 ,  1724712150098466162 ,  1088893803301361940 ,  976660458438900186 ,  860614170750997085 ,  587151817891195569 ,  133921022361633586 ,  946775280365782044 ,  1545056039825161741 ,  2275764401311156270 ,  1430917641141190194 ,  2274484828236664107 ,  1990082861750409250 ,  797766618771735846 ,  1961774649297470514 ,  1326623491468208625 ,  190941791733055479 ,  2046575371662647672 ,  390694138645557850 ,  476087370111264468 ,  200425240434953074 ,  2224053723378315529 ,  234834015116354053 ,  1050794929711031019 ,  1987579256004307569 ,  924988345830692990 ,  578184868333520621 ,  948076098131831545 ,  1963832564761495958 ,  1916069056091845906 ,  366185456553530738 ,  682364281062021689 ,  2194469835464323219 ,  2201579391861323989 ,  1115112083963488903 ,  1575894983059040804 ,  2160453589704845228 ,  816318137695764311 ,  1460691860512687696 ,  2232732942084599749 ,  342802238985802406 ,  2039944582914263162 ,  29689550872922028 ,  1675929213611724907 ,  384520025208552754 ,  1520775145869928178 ,  363460467487822912 ,  2094710598517817061 ,  1195384410349092888 ,  232889615453579805 ,  450080755448299194 ,  810708167601526051 ,  257834348528509716 ,  1405243442310570204 ,  297936539876503926 ,  1055047005789428300 ,  416143565717354720 ,  896235306903739214 ,  335636935855330762 ,  1892380563938462042 ,  1713330894622959066 ,  2263374656854800876 ,  2197671394261585592 ,  2270187048907847055 ,  1218560227918574540 ,  1496813230903174779 ,  416337585187494268 ,  882694560775437013 ,  1553878374970382195 ,  333039525679402453 ,  848541066646996755 ,  1518353973649545196 ,  1877018423862736573 ,  2279478416338274767 ,  1461068775900282728 ,  1571324523579134120 ,  364673123237752822 ,  1196290966968764048 ,  2037942138759270135 ,  904711075208053726 ,  929434025399070301 ,  1616638431957286119 ,  1396927946310784219 ,  2194214235375121259 ,  39795890480203879 }, // x^2^565
+
+{ 1100270740478888646 ,  1828352144803983316 ,  1890019134449470207 ,  1499757888940706318 ,  1666410553186700262 ,  601684424010163661 ,  811274180031788249 ,  1778539774300217062 ,  2278523812771283049 ,  2084792451778658388 ,  1570620868816635898 ,  1902785123335405579 ,  780183741521907515 ,  1870006129491899585 ,  2119085190669986591 ,  1439417615891874535 ,  1348864267778597764 ,  1965903893218595066 ,  1041224536804859808 ,  1503658224866282780 ,  1426682473984360994 ,  1841110561313053342 ,  945677825241979472 ,  1467307879724486010 ,  2115473546414630307 ,  1902649160412009242 ,  353579091487061307 ,  1640474755218703722 ,  2157465649824636876 ,  1532449941028697931 ,  858566539352537454 ,  2179293568755102746 ,  548142862931580537 ,  1319255872324345339 ,  1931368070046428961 ,  80959500974800425 ,  1115919071168044403 ,  1507069495354815784 ,  784520945211602921 ,  527923260767453319 ,  1892615596103087873 ,  1716824947877076897 ,  1470670402015732882 ,  2263170520285841019 ,  331595819034914102 ,  1214313413045317513 ,  1119106607191237928 ,  1297954484188109327 ,  1352072968780642914 ,  1803490407910002348 ,  848778570719066695 ,  1302142327669233102 ,  1938551232176784229 ,  839189726996420974 ,  814030872166631128 ,  2198284993201569090 ,  237636420097412985 ,  1036842312286818729 ,  2220242549329113502 ,  811308159666018725 ,  2259690201367936849 ,  2044419698761833202 ,  19434532243308437 ,  209541827270745655 ,  1159320861795732636 ,  630548203805514948 ,  2203344941751005163 ,  533710478095122168 ,  1602282821104119440 ,  1057355903868295317 ,  624105620620043871 ,  2018975654231534097 ,  986044672725782896 ,  674376632694522031 ,  126493345539335093 ,  946350520454689941 ,  1890194847936784777 ,  1925661199040161682 ,  2156863613533494191 ,  2242914867303611773 ,  187938808405814904 ,  1279725256777933335 ,  1473597517770173513 ,  1157844086022918252 ,  1461648812795129253 ,  1136280726467173896 ,  243471926785097816 ,  2043550653416294663 ,  53249528482071906 ,  2026338673631906103 ,  1735079493809533049 ,  1902492310298131053 ,  1964107035547944323 ,  2177318742419324390 ,  1019629285955917226 ,  1507411277766743696 ,  582662521649355256 ,  2185821762362848842 ,  1719026048273826148 ,  1574507400814670929 ,  2250361238876672378 ,  958055426496592561 ,  676312309081684753 ,  1824174632587396962 ,  1252534036870338762 ,  218966162375765777 ,  1085617745130005948 ,  28354989377592208 ,  2067047661417648273 ,  2260146289618641846 ,  1010305921670531462 ,  925261481867765098 ,  2039034262661567671 ,  988259010119946589 ,  1899775549173215149 ,  1768250958741858316 ,  700744004580707933 ,  451664305599706715 ,  1953241453924859526 ,  344959981636491158 }, // x^2^566
+
+{ 1849040055384735971 ,  1816696326640142875 ,  10285879529074619 ,  1439906741894946734 ,  1509801283437471365 ,  2289205756768488403 ,  465705193954677688 ,  1285289817006080831 ,  663920508914154168 ,  671378054558869266 ,  7092617210801660 ,  664317634728916019 ,  562530212571690800 ,  2118897972193050867 ,  311036959515935132 ,  1650343026511932846 ,  1142015617969205965 ,  675574780449779282 ,  407614806070919872 ,  981785067782379188 ,  1311708207711303786 ,  2064595333234537027 ,  710750084173444559 ,  2064698400144780854 ,  1404243853587089224 ,  2213593795557793653 ,  1534899595494334868 ,  1313493071725142611 ,  1522367108321358661 ,  913823337907494522 ,  47200245959961629 ,  1934804958668468777 ,  517601999245853728 ,  1978973310702976179 ,  1921287786655329646 ,  83798491096287340 ,  1192956498966935683 ,  1547319392502602233 ,  942056009806173295 ,  2169556002694541467 ,  720132876738466518 ,  1115656000593984648 ,  372898047451692131 ,  1453150387708395833 ,  753148436968188188 ,  897913900706619219 ,  1831028448405291891 ,  852665816464123613 ,  1581377982203133345 ,  1224739312629342838 ,  256264229511109440 ,  425555131756322383 ,  1790783689173886885 ,  131686083584228013 ,  52232401472455675 ,  222092714906229072 ,  990054858810847538 ,  449456637724354833 ,  1199725720160096673 ,  861712293821166785 ,  382232891705812368 ,  464035779983804745 ,  1731056118269463478 ,  81209798596262803 ,  1740210838057762287 ,  2130869014117873896 ,  822479729880661848 ,  754918388375320269 ,  772945889544135059 ,  1694713388548034113 ,  275622708793620521 ,  1769409436439808390 ,  1909919791825912913 ,  1264623176003205158 ,  287748845847782943 ,  1415942373455010571 ,  924826704349043960 ,  233798874351242676 ,  2023291518879706338 ,  1663137552568215095 ,  12122455417865183 ,  958166386376593255 ,  564142493357460135 ,  1245838662041453767 ,  1412648936164661058 ,  2163866670527891272 ,  2058395130317562972 ,  1922894811264418397 ,  1310645405845194104 ,  1372607914876775429 ,  1041202881004189218 ,  2039168239454994114 ,  318359259945403721 ,  243934241019571089 ,  1561322651303225016 ,  1085685705556583902 ,  928843483832170537 ,  592853611486862312 ,  1373649772931481793 ,  567092148621831303 ,  472791870736892833 ,  162719229794921519 ,  539694101338994959 ,  1431197308601107539 ,  541448625181471444 ,  1835898441656213028 ,  2155393765017292516 ,  1696703247610701995 ,  1494044941967687521 ,  762976507062985272 ,  491801000368050723 ,  872507148379216605 ,  2001127020923999917 ,  1298199554135458374 ,  1635726901736548907 ,  2022763653473628989 ,  1907956503402952428 ,  397156375643626559 ,  1285788469916013238 ,  1965252274888824962 }, // x^2^567
+
+{ 2305517443950183295 ,  2194903242744031329 ,  1983816985920755139 ,  1200591323554354463 ,  1569950842190295686 ,  664675189170358557 ,  981813035830867655 ,  2294037277751707981 ,  1213446716481986638 ,  318092217975126218 ,  832417657404311790 ,  1919338314213613140 ,  1907120208484085738 ,  667656700518077680 ,  183951890760426084 ,  2068898424917992607 ,  684409779227091845 ,  1111024432508501354 ,  1355979768390073272 ,  1342080718885597119 ,  1894844322490086594 ,  910780135920817433 ,  994235837041450801 ,  547605097926312205 ,  741215118949279015 ,  933904682285963886 ,  910757223066907176 ,  1888697806640432724 ,  842648160880226638 ,  1722349323238321978 ,  1081944948746554507 ,  216778845266597213 ,  446600888774253901 ,  114282621023530034 ,  469773759211454909 ,  1782361952178085278 ,  79420016556079299 ,  1269665991266810923 ,  880454484861093562 ,  1880608009940391834 ,  1193084893807396463 ,  96150822601827055 ,  1862555588285334742 ,  976039127652049090 ,  1000295118189018088 ,  2256263712966136251 ,  1826651527253362963 ,  2284203820171438439 ,  1164989546279188357 ,  1680207740147680128 ,  1455054162479981113 ,  1633438900804457555 ,  1155368134452612060 ,  1996040551908408049 ,  1963178970224754466 ,  2079006735661279259 ,  2059364519023983913 ,  1968087359791229355 ,  1274837391336667342 ,  12781735961389734 ,  2304903231719343538 ,  1075694454239745069 ,  2263046314731078777 ,  793179701483673370 ,  1445747614657829918 ,  17056079900681907 ,  2290238945835355151 ,  732614831738666244 ,  140499417111123109 ,  347173678249734241 ,  73771447933327101 ,  1089188918224151923 ,  1559755832941847938 ,  1819008214964912234 ,  1351357566849246974 ,  2207300121352608956 ,  1682392026508451951 ,  874252993461313134 ,  422809314874024430 ,  1844092817913223143 ,  393978681788977852 ,  1181500864620793396 ,  949808208055235611 ,  1625449038155387754 ,  395280693129991516 ,  1630128869954355569 ,  1693578367180247033 ,  142346053114352387 ,  410015220544904285 ,  695630094460570773 ,  1984304927187133274 ,  1623146025248657022 ,  390304982959949052 ,  1519438780471369333 ,  275196331442737063 ,  2182384869002766875 ,  1926388427941387208 ,  1189743602640175083 ,  2166801462190291246 ,  1541340985955675517 ,  580654301121750129 ,  366013151554053553 ,  2262197457228985242 ,  121712169607065971 ,  781732289073287269 ,  1340513834154222273 ,  1222491189381610966 ,  178894645244062211 ,  2000839652240195349 ,  2116319328894846099 ,  476115530427189369 ,  771807975131921304 ,  439415738221170546 ,  1040099377562087658 ,  1204666538093262721 ,  2297096545821835313 ,  272248705557186593 ,  1878904336807713976 ,  2227950115071890850 ,  1232383941067766776 }, // x^2^568
+
+{ 1626168703985413643 ,  1188527230386475573 ,  1751505018240831658 ,  811955117743501634 ,  2232187014538657871 ,  1718003995565916126 ,  204016484116824803 ,  1184274215275682737 ,  1676338163983265127 ,  296471134799924924 ,  2174740472647204376 ,  1153692193208513097 ,  983229876105235183 ,  1522852205744779086 ,  2089161602918477111 ,  718420209295915554 ,  507627639206410200 ,  891996457129443381 ,  1929100254266254886 ,  57479129551983773 ,  903780866076820463 ,  877803814282889905 ,  118379193908981009 ,  1437008371284878733 ,  1852497934838029526 ,  1672328436444271044 ,  1186702330738833719 ,  1745743922506051760 ,  601917747900504586 ,  993991097612191108 ,  1716635582306630297 ,  2296997859935921654 ,  1287058428214883086 ,  1284050799315117327 ,  1645042475510387465 ,  2187935111488807342 ,  522914560321031352 ,  13900413905863286 ,  1103505056746185216 ,  1087466024861716710 ,  909981805717591081 ,  470559052884953907 ,  308644488575609977 ,  1145547402340352040 ,  1197250814186545552 ,  10328039509540715 ,  158368272447715311 ,  1742457251110281400 ,  429202917769707713 ,  563039468952785814 ,  230471798260192144 ,  332007204947537243 ,  916802977629320131 ,  1322328156496110061 ,  1017592844570441191 ,  206332262108098654 ,  412313823411781482 ,  464653497546148207 ,  1424283414041311964 ,  1350920215922908603 ,  474194842910720649 ,  6913317022105522 ,  1586954323119099504 ,  809445428248737738 ,  1064405180057117564 ,  1610861559863444019 ,  557312662469593350 ,  2008131972779221962 ,  1813064452945666955 ,  686039644806716907 ,  1550050557745762447 ,  1122903980107666406 ,  1920565962577784147 ,  903145625719843857 ,  434182945213890534 ,  1684107747888534501 ,  1771058292721411342 ,  1841870537063081895 ,  1392874260552067591 ,  949570385542697221 ,  1512758152341956374 ,  1341081858542178891 ,  504954776617936201 ,  556869520266254808 ,  281764074657672617 ,  368289311266653111 ,  974385682734739761 ,  1309354202100017410 ,  318189375958948433 ,  2139628988684232452 ,  1570972663264835871 ,  358500061957958771 ,  1606301412718096350 ,  1642908106932866688 ,  2237985523059663204 ,  1417936368891522006 ,  927668248113924340 ,  387356428445538977 ,  2110387053948880762 ,  216691786502259218 ,  1685922313459169755 ,  116968122018776186 ,  1969878662175747446 ,  1821807416544422746 ,  1021378392483848583 ,  2182993395787907003 ,  522377906671020075 ,  1434497110775307641 ,  1112410696615111690 ,  450330095127859540 ,  197628510323776887 ,  1141027824047369626 ,  171471540856831184 ,  836278576715560016 ,  1542711065470579629 ,  83663416669919597 ,  1548069270709776222 ,  438477961419521696 ,  253745142246649629 ,  1927948128005357103 }, // x^2^569
+
+{ 1680548263079576816 ,  558394122499114335 ,  1983527691980611688 ,  1401409244147136784 ,  962534825128111629 ,  925309806656858468 ,  1958528138092795291 ,  570266308315365578 ,  1281850386511113668 ,  1909446519967459457 ,  926958443285451094 ,  2042033007924714732 ,  990248428067459620 ,  152766940555018652 ,  1001173747589632164 ,  856261519370395396 ,  2284928026503282458 ,  1956697259486255536 ,  2228016998424534280 ,  698050125753716576 ,  158790311205789831 ,  1011689987415634165 ,  651111936071597412 ,  813941255283075976 ,  447796084679921042 ,  2088581622738001222 ,  1810161756485883470 ,  1848025194489792842 ,  474668691639458321 ,  2088476332194676716 ,  895011260690754092 ,  1248397716262441784 ,  2287140403281693566 ,  2249566806214162306 ,  2231939201414474864 ,  1376162435696669356 ,  1117910570557901639 ,  2290848461939491267 ,  183416023713589495 ,  901336235450206568 ,  2204454532117853079 ,  1435059629886290030 ,  1610954130729779789 ,  1198311349763704002 ,  1331809390970488245 ,  472115627195658583 ,  233722957474187092 ,  2177413989179839127 ,  708407719681532039 ,  1204722687449787445 ,  394440822959731380 ,  853823621234381250 ,  683024364933564649 ,  2256780058934638832 ,  1442903415932727481 ,  1345957739971424103 ,  669392634819888582 ,  1794118649061940558 ,  2021829344006320033 ,  41834657330142919 ,  1679729054446027584 ,  1278164289249315087 ,  1527025456428832494 ,  2141437625814813070 ,  245657711054483709 ,  2265922971942599062 ,  1017808795300590725 ,  513938938371273647 ,  252656816798976843 ,  333000537702615681 ,  1897030250100044457 ,  496980712762905565 ,  1876600579240241194 ,  412547418438006659 ,  1774980315533228467 ,  2238811429387028433 ,  605890849606425431 ,  1052634792152119472 ,  146628456740895472 ,  1092537138102656857 ,  1604196933663219790 ,  1917804081435332354 ,  2048313796740657038 ,  1804390552613400442 ,  1069947274955272421 ,  1034970441174765127 ,  1780038610822543907 ,  1073593251540324681 ,  1799665957781653898 ,  1287412499622990116 ,  642298093922438844 ,  2047097459532722243 ,  1784005070732897852 ,  493323322546604805 ,  1356880624682850821 ,  116882419557144627 ,  463719356652639661 ,  1670954364339174448 ,  2241296107970196133 ,  1194406593593830953 ,  305154550631893749 ,  1189789777467032453 ,  264487214704062033 ,  83925772817827228 ,  922429730485581121 ,  2114026997128335986 ,  1316060064911063270 ,  15463781044062862 ,  1803131248590863939 ,  812787635806824554 ,  473194132836528187 ,  641889329697420945 ,  1703542105994801271 ,  1763353246111757500 ,  1064220513920358091 ,  197255240780741457 ,  2265532521458438122 ,  96108877001776378 ,  1541683551326002199 ,  1602643269154081386 }, // x^2^570
+
+{ 1600700001711068547 ,  368601397974993112 ,  1156768342195611806 ,  128518863016767195 ,  1844823888286075391 ,  2238269346809840169 ,  596608951882250916 ,  1364025261261533736 ,  195781257271072376 ,  1883171429657171127 ,  165904480621287059 ,  926741418084973457 ,  686269136678372905 ,  1895086220557925425 ,  1578166353169855624 ,  664345272320803365 ,  472496558325454692 ,  1751915454907236581 ,  1248874651132841634 ,  1780302845566959894 ,  1390189980475772903 ,  62600174429285266 ,  1309605159198367206 ,  212699054117981513 ,  846033128524796637 ,  741020754905353765 ,  1876009449609858174 ,  2038601208181540583 ,  1281707443441756816 ,  456697439714280754 ,  554918757692588568 ,  1290602728708990326 ,  990367037787650609 ,  1834221371170357205 ,  1728490135829237881 ,  1864825988247874892 ,  1572510854849892057 ,  1036140677259122911 ,  927851076051763886 ,  2062800366230444904 ,  371350600781819854 ,  198573229287446306 ,  2257381753885833896 ,  1525596533091565962 ,  1209367706922669416 ,  44372740628688990 ,  569364730833995507 ,  589758027012164801 ,  1088531532335509876 ,  458283975867587619 ,  1470345169147584884 ,  839667794252756905 ,  1893835664858916001 ,  796425382590649443 ,  2154411132133778020 ,  1568721409254024325 ,  2256969952263289011 ,  1988802321388849622 ,  515398780803273719 ,  358035807510951913 ,  752109327289043550 ,  1887469289488994688 ,  986927733537409972 ,  629522060218774223 ,  1288166479918286134 ,  310430010015059982 ,  242995635294737708 ,  2126647095021460970 ,  44145730110517142 ,  1395119617316301791 ,  945006082303468030 ,  786920508177948246 ,  1343278047743776428 ,  1245532815241212910 ,  1213365498869859235 ,  2052575043534691626 ,  1155166252850675210 ,  1936425315323352706 ,  1328269340682944070 ,  419360288248281100 ,  881090778115472215 ,  1184350017206873955 ,  174662984785339168 ,  841560087469376929 ,  2067084785512790584 ,  667250994843151037 ,  125160170515404432 ,  1967961641538968727 ,  978634116544863057 ,  2059907921891702748 ,  758500425508201611 ,  1491645835476992756 ,  556145524190803426 ,  914296424228132261 ,  1243202633096585306 ,  950067336993528010 ,  1382090912592333414 ,  1961721856805049336 ,  53870833651234449 ,  1204495078955079418 ,  313629637682935964 ,  1161055267604605169 ,  1784495485096123134 ,  1902327981543237681 ,  1410218312384049549 ,  2175791079842254602 ,  437401804580416911 ,  1567148580886501523 ,  1206659423633928530 ,  719844761935844879 ,  1381896303292289545 ,  2285569545405785306 ,  1382529112817906729 ,  1501696425141201358 ,  777802430580434836 ,  2300614927235388955 ,  1600659201582761901 ,  1173860911141949197 ,  794203132672710533 ,  1235588485720981826 }, // x^2^571
+
+{ 1173643811203910232 ,  1849725826778509126 ,  1478930718095772403 ,  100431340776953080 ,  51283114783937610 ,  172795590274709672 ,  2084152790981618743 ,  1154135090982692862 ,  1542007423298387370 ,  1029631004980948250 ,  1411608559120883025 ,  592872881875353013 ,  140554525603741005 ,  1520352557238037833 ,  12551538657998421 ,  2152567307572930450 ,  1617725342960799232 ,  1078236434453958693 ,  621041467726103809 ,  2293039453401815316 ,  51644117313575036 ,  240624968187024067 ,  1094648996362310178 ,  2229526690806326799 ,  1540295882933615378 ,  1327116864866692220 ,  947588920165873653 ,  633302832654244841 ,  1241001433730898399 ,  624796796301557212 ,  2280668102526808523 ,  7076541595059082 ,  2129985780204517182 ,  1883661012822465298 ,  1354632624854863285 ,  587994270258072398 ,  1889720313883106658 ,  2168792062938964987 ,  373493659534831901 ,  2087134662448251058 ,  2240914008682392062 ,  200427973792157510 ,  979424795120412307 ,  1352124638933083300 ,  176751062478019087 ,  1344589201809678606 ,  993622734238844723 ,  1874016931051989613 ,  619351376318804419 ,  897088986656031772 ,  1442392039814407617 ,  410891028436021462 ,  919954462577436133 ,  70128237026853740 ,  117455655783879562 ,  312471076282322988 ,  102699322667725127 ,  1925527559345639324 ,  2197974115896739495 ,  1568609328182699378 ,  1506339036045063999 ,  810841404742565848 ,  368471657841325816 ,  2196545350887773556 ,  332269401023501526 ,  2062687646381351292 ,  2128180943324681204 ,  2277118680338510515 ,  2219796161834594247 ,  1790233023490599256 ,  1670641976815858668 ,  108924197283776042 ,  1356782160712174816 ,  1536210650888783326 ,  1154836450640410796 ,  221288317983296874 ,  87206819234595661 ,  730653532248017449 ,  142647653768096243 ,  668522185193725622 ,  2302592353148356300 ,  82523695240290783 ,  1478408428494281847 ,  1358817128890851932 ,  2146352315507845713 ,  847886892526556405 ,  484935486025678313 ,  340320401209241143 ,  1140678393350676504 ,  1346963873316867501 ,  1391210567436687819 ,  1371315785945081037 ,  2186346972663729864 ,  1020891256756761494 ,  1121527169254615949 ,  309800325912840675 ,  969219643107165530 ,  1710005136931283144 ,  1512391930129189478 ,  1330647813598490286 ,  2154253733892609633 ,  984080140083508941 ,  1326510771849439016 ,  17335200692348756 ,  1751675870351162833 ,  1298549312506416338 ,  750188478877016893 ,  1353754590741302801 ,  1213879744906868811 ,  2174849834349365542 ,  1543742148319179864 ,  1695614249534381938 ,  1086225045698783170 ,  621510413071066009 ,  2092844548544795694 ,  670937113077438955 ,  1499496773768216973 ,  1599520812434455923 ,  984486124504743033 ,  242407265782024370 }, // x^2^572
+
+{ 113007853216783784 ,  160096230423201319 ,  51217203959110955 ,  1015247315148249135 ,  2125775302948490730 ,  603193742937350140 ,  243209963967547474 ,  1533989707559977447 ,  499359453244864913 ,  1445889423725957019 ,  1133789201826678343 ,  905701183264894239 ,  276285746222039967 ,  1042006496582568021 ,  1334653116473819836 ,  783572905968718006 ,  67958896454055132 ,  1665026059521506390 ,  2256025379122763387 ,  1929958196289149004 ,  122310873954963511 ,  331543130973927018 ,  1923032502708514363 ,  955024106283772666 ,  2286208954884934784 ,  1391443522398438225 ,  673460750122197364 ,  691860798812278542 ,  2067281935069199325 ,  896121476561719363 ,  1639701373070375449 ,  1137995260565899282 ,  590237183973933554 ,  1771680424418023103 ,  376119784471025249 ,  479946100439943765 ,  2196403189866828869 ,  2197670223897907592 ,  683234814498778839 ,  1526245655966832106 ,  678175131391631292 ,  4202323918018015 ,  732877224620656719 ,  1650230030905076898 ,  918532073895640935 ,  1040806157168324699 ,  1274338368674980626 ,  658529376246001422 ,  1464923526415492214 ,  1437599829483753397 ,  1407673706532092260 ,  247071624517010282 ,  1680909781091546203 ,  155880747128707857 ,  989259613955788404 ,  1129737564003206784 ,  498972510335420339 ,  2057569390416505609 ,  149867891003729128 ,  784189733352632134 ,  624482412131529328 ,  1442142177238965308 ,  1530105515641930716 ,  959259615234209658 ,  1163949915036504982 ,  1967257111743053629 ,  1534082210900613724 ,  1783156534210221201 ,  883018205685908531 ,  1966223189960340648 ,  42116390095370042 ,  696762323051822269 ,  764036584448422023 ,  1848207741684474802 ,  2167694199391329145 ,  955767991935098773 ,  1267337305190996701 ,  657199773735754257 ,  2051910534035534462 ,  862619448914688877 ,  1091262894860025008 ,  380931705300250170 ,  891791790581240660 ,  1221454146277303310 ,  798916500584462005 ,  388129393339237156 ,  599873553504584932 ,  739253830169505563 ,  611069189816311853 ,  1476168949821472624 ,  644308307434426381 ,  814646464105810884 ,  1014489701287775334 ,  1615646480810513980 ,  961954685093435230 ,  855796768315757354 ,  102749958147607454 ,  1038841921507300532 ,  2063973385292570990 ,  38238749304587911 ,  170977360093653509 ,  2104055023834730954 ,  1772189271887991436 ,  1826948938006285539 ,  844365359889294388 ,  176320497491194180 ,  2129054235831435356 ,  445356116815786019 ,  1728921859979147528 ,  390939672836648376 ,  2026684731628657769 ,  362725880855273903 ,  2264321854449109685 ,  1848812825527550260 ,  1706071604224743369 ,  1108904788065918086 ,  503308050402445347 ,  1115837671104117133 ,  1489709631104186142 ,  2084066573897962495 }, // x^2^573
+
+{ 843940871452113049 ,  2172042946820313326 ,  99176179958964329 ,  1560733261048451836 ,  1895188795665582397 ,  1100328479511173230 ,  2028365612400976090 ,  496439844711501986 ,  1627885057664192660 ,  1146381761263710485 ,  106266667479297134 ,  2173505644340496555 ,  1225887766661526422 ,  1343132978775526171 ,  1320396086426956710 ,  1943713575748148800 ,  1698189784983702804 ,  282760653208929815 ,  1420318224388851899 ,  1280262509567156257 ,  654953629559053656 ,  1600107883210247680 ,  1562133437600430002 ,  2159986052540943213 ,  2060176259201084310 ,  724402696353683054 ,  1073331147049219506 ,  2095648056982757997 ,  2289304640646843015 ,  1170678491262142647 ,  1147327221011571724 ,  1052841667316178028 ,  834231594666639416 ,  1260673259023786521 ,  1606695181489342349 ,  131422741320472264 ,  1119841912887053674 ,  2103204299084336848 ,  1860810325712268654 ,  1312932792304568792 ,  1038364405026290988 ,  2196211877286823649 ,  766279335115437164 ,  370638333185123062 ,  1893947531462619614 ,  1740220185654588658 ,  377821115789337836 ,  1139278813178496875 ,  373269415411571360 ,  540681965718385771 ,  1648703020402783482 ,  2083973905219718698 ,  1395159683585157291 ,  2271238029111619133 ,  1022414470498711141 ,  1750390853616739049 ,  3229518439009071 ,  1427422453579439787 ,  1084674863945189222 ,  417111321097492108 ,  284928100573145860 ,  1498547294036408656 ,  2273551289134464886 ,  1773000389765561071 ,  719681167999078215 ,  2243966709673096220 ,  752625359380098378 ,  1752800670099329018 ,  1669763882581469528 ,  1846851179393769894 ,  151330108802157417 ,  2229174356784913522 ,  1795416877124137241 ,  2173733803444750453 ,  384226196998782574 ,  1162245052783846042 ,  864834301114174120 ,  1829095687772156131 ,  552802228274037727 ,  1778251281677691634 ,  1915453455279541643 ,  680997663933983549 ,  2281644094083251301 ,  1387849773798551371 ,  701538290091955387 ,  289104371096562833 ,  1575833851879772053 ,  2102235710043824350 ,  284264835186092167 ,  968471558121852865 ,  1386483175628918997 ,  1065035525247543448 ,  1858284161418449319 ,  1882185885538138876 ,  1432937803654547447 ,  694353599068201621 ,  1804615314369468680 ,  1184648561674940783 ,  210359739760850705 ,  2159706236854528470 ,  1038471765960308414 ,  1743372840775377100 ,  896382395645418644 ,  962752954988573407 ,  1917494000330592208 ,  995760160301416124 ,  728891779928652546 ,  269639204187647641 ,  1225752981330947395 ,  1791163741930860979 ,  1096590060739008091 ,  618759016389345376 ,  2269912056201983517 ,  1156074258573363151 ,  864524431149871024 ,  1264410027956715913 ,  706492589682630608 ,  2269527993419325824 ,  266154752016941935 ,  425984141026236324 }, // x^2^574
+
+{ 2068663853035903204 ,  2033765960399254456 ,  67187542862478958 ,  2133358738026276884 ,  13765039039711444 ,  1005317345665906774 ,  1326026167988055737 ,  2305551212807454508 ,  1070349796709593334 ,  1658705420532152015 ,  163242892372250254 ,  1875972877552567145 ,  475994193220316956 ,  715377316368185407 ,  132783197736603354 ,  671999318477963673 ,  349414550241017770 ,  1993485113984693238 ,  937927048854101123 ,  1985090619866277354 ,  740392447186909368 ,  604913274843170606 ,  537762968371077754 ,  630364935999155965 ,  1005174551941913040 ,  1005058334627075722 ,  478159571510509026 ,  1694317623049829984 ,  2055414888582528474 ,  26838642651144977 ,  2151609062854656850 ,  1805876233166497691 ,  1827887420791093241 ,  1924321285178983783 ,  1891253119077973181 ,  126518481094259653 ,  309657384481421031 ,  2215473661076950345 ,  391274744996892978 ,  963468991169976698 ,  1262804948325557889 ,  1532716802504194033 ,  2269914875576067347 ,  1640986053386944730 ,  1328945053069347459 ,  2279826772389273000 ,  193082945185917353 ,  29364867512998660 ,  950627150875330815 ,  1614788120151764129 ,  481181493813296086 ,  249881047333816615 ,  1242072025941839545 ,  282134392564608212 ,  381207533799446791 ,  266626030452487193 ,  610361539936552142 ,  1182225158702404921 ,  2243026405855966463 ,  641867099152364363 ,  2024002085545283440 ,  1978938864319415374 ,  225245290419485177 ,  733874899755269903 ,  2031332459323931883 ,  1669553275550242693 ,  1609467112106202865 ,  1717955325479960251 ,  2230436682389294600 ,  507038998067085023 ,  296026582424899327 ,  1143499731169390105 ,  1492551828878815150 ,  2233828142869928569 ,  2182636021655370608 ,  1659652675706538144 ,  2093351867253588583 ,  1138205524693286714 ,  860446257281239516 ,  473370898102896614 ,  1294743352351702089 ,  1364660617796988114 ,  673992664027816265 ,  701492685119305521 ,  248523733618425025 ,  1015411081441948171 ,  978166574830151901 ,  842508291222726361 ,  515721337016061992 ,  10719363870980953 ,  1951678417738502695 ,  1625709113920236660 ,  250724759266806210 ,  467244663578283609 ,  1762911468370639534 ,  1937849552689749162 ,  1540999059742311595 ,  1156999666500538986 ,  895983278123859885 ,  815968850836615228 ,  18602873626359316 ,  2182218865450802949 ,  1960533337105014860 ,  611721415357761929 ,  582338539387425428 ,  1552657879361381116 ,  989850753864591294 ,  82658488515619292 ,  684539474342489957 ,  565450207510455967 ,  254852598198301614 ,  1807330525378307918 ,  721953713718875995 ,  658878099636217003 ,  1809289431202511912 ,  1208170762204055943 ,  1099755843484883766 ,  215221155477631718 ,  2305670348807814685 ,  117442652966925799 }, // x^2^575
+
+{ 1146433942196123395 ,  837680541469739774 ,  1012419341778080147 ,  1848535434885408042 ,  704264275368214041 ,  1176136426069696397 ,  143733628657489280 ,  664632435635736445 ,  883592494223240766 ,  1187492162599768059 ,  1218567896999589421 ,  1575334881621522064 ,  2280827311659514396 ,  1115151788375163215 ,  1063037338268097388 ,  567203596296825197 ,  122102773536339355 ,  901307402789016832 ,  1247080732239674760 ,  1393131292793315113 ,  1397913425411481748 ,  976928528110605564 ,  398728796078231765 ,  721681079824705074 ,  418616044788802881 ,  1870881870123556856 ,  1314378549958228315 ,  1227844886497302813 ,  2051273854775676515 ,  2141707637794531787 ,  1649725781506690439 ,  667213711459158079 ,  1945746579822177848 ,  824176624850463389 ,  1644198893290429605 ,  1173451884581469982 ,  551189179937931350 ,  166935745350456590 ,  1322124641313142019 ,  380369457242613970 ,  2126021287333973610 ,  221614326122515934 ,  1495538980515594156 ,  184435766305214173 ,  245061387508228781 ,  2137259934650155047 ,  1889792047249521910 ,  952700950123181281 ,  471101063627673582 ,  824719677262742865 ,  1039582064155482938 ,  663197069092404700 ,  515519813380836601 ,  1097400790671485029 ,  1753216732235967363 ,  1755330623205750577 ,  1282318864844491867 ,  1233453641182817442 ,  471882942407541438 ,  217209152221096799 ,  1960113727921656492 ,  675787398497211329 ,  956014211575811519 ,  912520936241386135 ,  889356668668108682 ,  263344210928128841 ,  2206644579742602888 ,  989675811667365503 ,  765468664317871342 ,  1822824238675589274 ,  1440669776042898885 ,  544977183281024328 ,  2171383116349195255 ,  685793305621273094 ,  771468296128864533 ,  1914880976544843024 ,  201649597773715145 ,  787020706327179029 ,  495848939593941770 ,  1841482578449514056 ,  2047951247376971148 ,  140078681749217434 ,  359316734433619416 ,  1899413351185577272 ,  1238408568090294777 ,  141856733442596014 ,  2091128291604479271 ,  1868836891517795030 ,  178926974913126945 ,  250895088880918465 ,  359669430843780918 ,  2217403991037885002 ,  860300174179270373 ,  1999426398816705507 ,  1619495104587182242 ,  233631931687957253 ,  1984652091754190532 ,  452426564903239368 ,  1266522386161214422 ,  844471820069155210 ,  1472347534141795300 ,  755228793814663477 ,  1561422070382380131 ,  669146285185810520 ,  29283960921765776 ,  2098092322811409313 ,  2131994843162249465 ,  622538294704765827 ,  2190171413136882996 ,  476500150639305260 ,  1504775059829908425 ,  478326102274534078 ,  663108706296619363 ,  1611749998639713210 ,  1097438917818104634 ,  551124030596357312 ,  209249402802544727 ,  1390128118149593700 ,  2208196531899092705 ,  2181761427241697674 }, // x^2^576
+
+{ 1273155149546274610 ,  324351152549609603 ,  241704642569027979 ,  1859339788650939606 ,  1539839903511413626 ,  659457139639755934 ,  1376852724982118522 ,  2159123960094867744 ,  1277435340802896678 ,  933695207909620475 ,  1961762156440181774 ,  2226853155815561029 ,  1135905893710601801 ,  1809607038733948972 ,  1769395968803776088 ,  1680627803747497045 ,  184006793956487241 ,  332668518116931703 ,  1815414535569855265 ,  611772773668169634 ,  1379351751142175058 ,  314780629678800168 ,  864033800265585872 ,  516125353368329645 ,  941664730036813025 ,  2079131001271034460 ,  1688351938835574397 ,  2288690348063349369 ,  1346560868541711479 ,  1047625680400988697 ,  1869742973224428110 ,  1841683097492019364 ,  812755647471290541 ,  700584032041925958 ,  1100020666627187967 ,  576556548457355736 ,  1293087640444338814 ,  307003249740634206 ,  1958341625644994156 ,  218387274724815138 ,  212212179634912964 ,  98583323817692405 ,  910177421055953685 ,  960851743963428748 ,  632504789401929125 ,  2180847324914063475 ,  1958032791349879210 ,  1578419796295787564 ,  410154448451994260 ,  1588665289804074544 ,  407079472433573354 ,  1891475541087295434 ,  840774412280018595 ,  1600440585271070476 ,  1201672678813574580 ,  1481597796981619915 ,  1603360329798831989 ,  191766392754933731 ,  2121722590197580374 ,  1190513318521640383 ,  266257983968387449 ,  1992253287211412384 ,  1689196512787678428 ,  2299647968311145121 ,  758063915903291211 ,  1707431954730466703 ,  1667803136465714491 ,  2240409695936626975 ,  1278046483665119617 ,  2010715661951927090 ,  2285496120253808738 ,  397419948664876953 ,  142905233320885879 ,  369822906561853879 ,  836757482072888623 ,  847169000743013051 ,  18699648232253536 ,  1415119473936886289 ,  31515202287588253 ,  605390948508402655 ,  1498150955582431590 ,  700432228763044513 ,  717815954593908151 ,  618682156812422697 ,  986572299152680418 ,  1475153064252302502 ,  982529076906494600 ,  1858352916642810175 ,  268433819706495654 ,  1993897064862776911 ,  1304508179844394945 ,  60262120084097469 ,  197493365327128274 ,  1736114366009575765 ,  1265254287199620765 ,  2297721804479329791 ,  1576590540018827432 ,  835996124824977902 ,  2232830988398421990 ,  1091875158103848525 ,  1406634704017518430 ,  156101087590314647 ,  660896764904217411 ,  462133642524141972 ,  805516727111085488 ,  1281818047378804282 ,  61459565265335597 ,  1140731994718137765 ,  1557727188423484807 ,  1607241978418636068 ,  845582897329339354 ,  2075452315650162027 ,  512134214511649237 ,  1659900203073811437 ,  1206080275992352232 ,  274066514145577590 ,  992098740950542849 ,  2305414824040161895 ,  2205999604413815162 ,  2147496211336415882 }, // x^2^577
+
+{ 1171980374053205218 ,  2221672030421590541 ,  336149523733506043 ,  697847113402634949 ,  828962966876683205 ,  1843542863485441230 ,  40456012057661510 ,  94697372078776229 ,  261557785240612967 ,  1395934500120971343 ,  32406474273900891 ,  534530263387047958 ,  1021101029998310682 ,  1862023799319315211 ,  1734892384790055802 ,  1740069403576111397 ,  1669122904244701657 ,  1375311192620294767 ,  1347132892519140407 ,  556256065208766569 ,  981632296345311031 ,  116847156788399017 ,  181366362600451215 ,  1760398000813313204 ,  1505328951611439469 ,  1121101325368421968 ,  1144133191583614883 ,  226163047574318213 ,  1862952898432640150 ,  1264474283049791962 ,  717878694466160042 ,  295775190672823202 ,  119744739164606253 ,  1249317307881065105 ,  1529645254268368917 ,  1456630795623012008 ,  629440053031995341 ,  1585014843459572275 ,  1255820239767377489 ,  1257375092924198594 ,  629908812890416877 ,  2019268193418640912 ,  1934574693643099864 ,  1180462769160288672 ,  995497842551325489 ,  1459311067435364841 ,  850650742494993958 ,  1827391608709216228 ,  765072172167645694 ,  1626639402890109244 ,  223792254924028062 ,  450808530133711876 ,  1460503873027198135 ,  472815534020827116 ,  1163977838332728960 ,  1690069204639648663 ,  1410550283353659648 ,  57401699252268389 ,  1551013204891912048 ,  344501835870282284 ,  1993338961006186140 ,  427112775426788547 ,  629502745760989828 ,  1493092108559058245 ,  1660379150842347825 ,  1164979110162133395 ,  449645452996308166 ,  642430170661866501 ,  951605626455374344 ,  1779161923801552071 ,  272078219664505443 ,  216750291311497605 ,  1741865302130415382 ,  65572397470293669 ,  944406887045291818 ,  1429746427888122359 ,  207119325544160671 ,  882590125421960201 ,  1526851309046084856 ,  1236133704571766580 ,  2014322098007988969 ,  596443676975303918 ,  2002544290336819938 ,  1323776188727056138 ,  1326923676838707075 ,  192914535295127324 ,  1352471215359997979 ,  1041778243608736295 ,  914369966136485619 ,  135537825149941682 ,  199565409802990384 ,  1567878672158080570 ,  263658790243555597 ,  1470211769748924717 ,  1767944543470263782 ,  579433953714210382 ,  685461906754017313 ,  2034813922305281158 ,  1344010217121559198 ,  788059942436574203 ,  1138544283535991875 ,  505555129960259093 ,  1880786420546171887 ,  1746479898652458166 ,  670366706759626200 ,  271842209649853149 ,  798941896149834187 ,  1126077278494284311 ,  1774536409744227990 ,  1594564046331803436 ,  2010901063336456222 ,  141595609635079936 ,  1419340353466843957 ,  2101559457871354929 ,  1338572675166318422 ,  786573468692493904 ,  1653577986659555379 ,  2211099647831941902 ,  1817197464650163916 ,  1424592062644210276 }, // x^2^578
+
+{ 2052226517778382291 ,  1989009886359258445 ,  1028399445887560747 ,  220266898973418223 ,  1206206926740437786 ,  327106253471920471 ,  1616123435108020872 ,  792424333440276042 ,  1871315979825431496 ,  1735161875158165677 ,  840494963545498266 ,  1715903375653652530 ,  892724332934585801 ,  230743555025192543 ,  470044462117560197 ,  2127244226338919460 ,  1037610565200918384 ,  1321205502719427414 ,  1839276969542450021 ,  2010443984094386762 ,  913778035631165838 ,  593507277493503634 ,  2236896776645799548 ,  915130670386865514 ,  109950615043372385 ,  1764503385243819954 ,  2183170996553002627 ,  553093127128197287 ,  1603202024149900489 ,  1870106954791406478 ,  610797759611805718 ,  769024592374366003 ,  2032875925342302847 ,  2225105848886641750 ,  1807266590276887664 ,  1531600534394040842 ,  1885958011011643360 ,  804719396415892778 ,  827401831480587730 ,  180743069931952596 ,  1116056952149326349 ,  21852927747400262 ,  953026987282591554 ,  917043714875311924 ,  1498492933044775239 ,  288358645942510310 ,  752765203429721334 ,  923906462331095860 ,  1123780992261968654 ,  1054618633167178579 ,  1186522300015588397 ,  347981547819454782 ,  1911515320225888864 ,  838917659428493895 ,  2140582266240903066 ,  209254283167684452 ,  1291950704176539399 ,  393928155075237850 ,  473209373288195860 ,  1969971007718513206 ,  408337219255456783 ,  376291807322221317 ,  1474650479680346217 ,  848769061232340358 ,  1109898437151280408 ,  2050894806907486351 ,  1900023531756964887 ,  1754920428292559023 ,  564009847452680541 ,  982194034511807598 ,  1392780232244679265 ,  1092225724455785917 ,  901051178169510199 ,  2097447087162301293 ,  839199559876491472 ,  280542532511639674 ,  48391621099553430 ,  593157421752993153 ,  413606101186476546 ,  1426398358210769475 ,  728834913585291057 ,  1289340115765999802 ,  746632340511508689 ,  700444588432035203 ,  36547453250739129 ,  723597711782092679 ,  1140818621985128062 ,  455531000674214817 ,  922162476784108949 ,  128614888005609538 ,  398003107880918865 ,  2197956337911601591 ,  141718322324111911 ,  2212555823269655337 ,  129038191809836365 ,  1827222030731009079 ,  400683675634428066 ,  1928456267359057402 ,  2257387117941548206 ,  79844711194024504 ,  488466364534561721 ,  1887175483759482580 ,  1056909500602206591 ,  1700231480592468167 ,  1283615692250046275 ,  2296389411242681543 ,  934566466436440149 ,  278403513573383575 ,  447623346564063619 ,  1610206144738399880 ,  1017116645731769692 ,  308596142804155489 ,  1910274731355118393 ,  767440943053761687 ,  2012161382253092228 ,  1192276421061945882 ,  1381323407543311986 ,  2102256039945274708 ,  1885362024975317888 ,  119651180928304179 }, // x^2^579
+
+{ 230752729075751205 ,  610770378414125123 ,  504472537611222369 ,  860540534662253289 ,  1961399273844691592 ,  2076694739005052319 ,  968619142291736337 ,  310755028557800796 ,  2099459089179011095 ,  1967023347663274588 ,  262614333724948565 ,  253520607759836194 ,  2260386818738589581 ,  1935941222675189475 ,  2271133476992714931 ,  1877131253624259912 ,  2257869681096698298 ,  1922474213671159660 ,  2214890234602935845 ,  984959462410397678 ,  1149236163359146526 ,  1424998767562892372 ,  902227007805005389 ,  2034259840864282312 ,  965862498517208693 ,  1178579794923662357 ,  223930261805090829 ,  1932101194652836099 ,  744211969675828811 ,  1469007248915273136 ,  767022305146887736 ,  2136979077205297033 ,  242221157243089169 ,  524251370247352610 ,  286929150213156605 ,  366878403273076612 ,  1139282965505283635 ,  2186708949402773729 ,  1193639321214412403 ,  443487857859495481 ,  675952069353256636 ,  1822655070883511516 ,  1314400598798613814 ,  1454804159478018896 ,  2202906878079226097 ,  1100883375907329078 ,  1811340957699999617 ,  14170991083890707 ,  2019161738353384738 ,  303745896008824232 ,  1421147060571632896 ,  301872720497575821 ,  1256562265052356991 ,  601447670171190104 ,  332878852614974622 ,  585310815153058343 ,  589936718401524608 ,  1959377440415259522 ,  2147407240080153791 ,  2132582361352340230 ,  1908298904793916706 ,  991059108984153795 ,  1767711645199627363 ,  293930896503730098 ,  348949939143138333 ,  60988818876044242 ,  273211918714082021 ,  1103856604768022742 ,  439394787411249923 ,  273424736124877393 ,  262414584146527044 ,  9315057229611682 ,  1618433736352723951 ,  195097304921904994 ,  1979202302589550287 ,  1390643003016008171 ,  301145307891866887 ,  2199510985807793322 ,  1614902845945116796 ,  1437619099102054694 ,  724065475027162463 ,  2150081151907346768 ,  1463506205211143168 ,  1250363458038800675 ,  2035393126269317610 ,  1085197679750010615 ,  1423635376448848684 ,  589175339883284390 ,  1203573805165421389 ,  641016662045881818 ,  294835668809490869 ,  1298647509474508925 ,  1631783464505884371 ,  327930201417559339 ,  68107647241561734 ,  1823202547091851604 ,  1624353979461675079 ,  1231768225469166947 ,  97264686657016298 ,  2077645988969350260 ,  2125076391419502474 ,  790959928901256051 ,  1777383298224547557 ,  1394787910572546336 ,  1482025388172263933 ,  632131747241168159 ,  1423047037307493290 ,  1810985850367235724 ,  1288284630971574885 ,  1787110511767108472 ,  171136783088926186 ,  857483912627586212 ,  1252440279655693711 ,  363910011673382781 ,  424338899790001830 ,  1786938299469006734 ,  1626027892580445327 ,  2244313318330274815 ,  886306990692139024 ,  1845192371556107969 }, // x^2^580
+
+{ 2243663865488651057 ,  1027390037252705470 ,  1665872643198141742 ,  1505568717353984837 ,  1958937781808836230 ,  284060463965814262 ,  647116923276345101 ,  1807853393035722105 ,  2204440511317999965 ,  364721375428334554 ,  514949047053085444 ,  2176790322216322875 ,  1575879216747034939 ,  449141100759890704 ,  1725870284094041981 ,  651307342100604076 ,  1856239146229310149 ,  423613774570815967 ,  1103843986459145697 ,  274037678691560393 ,  348755488469235310 ,  1826273693641216491 ,  1788053900104351515 ,  1451934737634647404 ,  1127565341559786728 ,  1902449498265877718 ,  1888776702411447021 ,  216616594873734779 ,  98892132584191631 ,  324935046751176168 ,  863965844313109715 ,  922910925344154363 ,  1778982260950767381 ,  237882396936554276 ,  1863263308039536107 ,  469382892480526115 ,  605523409480193509 ,  150849408945747850 ,  1566511729429265196 ,  1060099337618456153 ,  1539484635922480351 ,  789292376458647750 ,  2255398599354214076 ,  259150377628124736 ,  1101558431929167925 ,  1875033116673661079 ,  411758076500674699 ,  1553892854928595011 ,  140182529538251804 ,  2224496579533278700 ,  761925408002365879 ,  1156183918377957646 ,  1496993804478803203 ,  1827153625991653287 ,  889763188079101407 ,  2040317700018660981 ,  1563864404236915946 ,  2096597039663385913 ,  1995834326186161552 ,  397173766731266720 ,  1623648174652638876 ,  1221128829829496594 ,  907512607169986143 ,  813151064485365245 ,  546500977615511711 ,  1701800492490286518 ,  1833324013260478772 ,  1018327674764531212 ,  578915590642601472 ,  260737446425472157 ,  2171698511937695996 ,  554751942736239357 ,  1298084253050862210 ,  2026621141713442430 ,  1729026626466685773 ,  2201300142145230640 ,  1189789824138840030 ,  142979150389568374 ,  1547160696883348034 ,  1998915660501343695 ,  1573571724208499066 ,  1403681923081467883 ,  1140448472819013228 ,  1948645841427407286 ,  1688089262534992253 ,  2005798960201264417 ,  70170237059225454 ,  2112058097989301522 ,  918207838592074994 ,  1034289696829769876 ,  1872382280734883506 ,  297988992703107678 ,  648915562903901686 ,  1178258381756496898 ,  1155620951151827930 ,  1839230880774889728 ,  1151870736733642081 ,  39384014385817786 ,  513196048629650690 ,  972388787173925807 ,  398778409328829198 ,  1122013316892611468 ,  1820082254118581110 ,  797032999521138195 ,  1616656830831208578 ,  1722836050705133106 ,  1378247685442582383 ,  1640048045972291530 ,  1108960353525084586 ,  43238257824367998 ,  1820456560742391924 ,  336931591622804947 ,  719060543772457138 ,  1166267110178866960 ,  1378431977137088504 ,  571764193632495660 ,  831998103744794731 ,  526441799935459766 ,  158795227845435964 ,  197171208116264378 }, // x^2^581
+
+{ 1761666991027473096 ,  1053094198052105308 ,  2122011060131970071 ,  1045197793444830845 ,  1307723475250383119 ,  1338269012763499320 ,  1346066552425629643 ,  1667627044220324717 ,  2186964814327366874 ,  544277700609039907 ,  445068414453625414 ,  1838331822426886592 ,  1418053673895235156 ,  887852208631032407 ,  264660081004088819 ,  1076797668989313673 ,  2209920957877803111 ,  2004261145024591664 ,  245795282140746647 ,  529331952533306299 ,  70785770818861908 ,  115027185255664874 ,  1599091519246244496 ,  1134154349469345557 ,  633766084644027026 ,  847567994681285048 ,  1831534964678372512 ,  1000094663728080734 ,  1808610128684730058 ,  2163348723453507704 ,  835536034690823200 ,  945871448797632532 ,  733206783994328713 ,  675645607149073087 ,  388777849291540641 ,  415937615713867174 ,  1112257734453287896 ,  1149860043265551365 ,  1222446661316852777 ,  2177204536104292578 ,  1289448882086067239 ,  1994130798851763573 ,  1017803361303909458 ,  1731888328891213622 ,  381222962427901096 ,  994222994293042680 ,  910706468088814684 ,  823431606979107875 ,  1502046944530416156 ,  1205005537629792022 ,  1953274499152364265 ,  826597742218494436 ,  1214232149380729355 ,  2056811661997815692 ,  2302329617679954065 ,  928173307206877982 ,  2064217046375462808 ,  853333329354998175 ,  1687809685522500854 ,  123760948772830263 ,  429004869596220022 ,  1059351913648667492 ,  898518766969763406 ,  2296770670666256014 ,  1649821284706821217 ,  280589291406844471 ,  1981614601768374132 ,  771209582938313092 ,  2136935858852253324 ,  1146473814063573599 ,  827066951584283491 ,  1900056337163684062 ,  1706306236101468261 ,  291741497152397882 ,  816712220785760311 ,  99243444842074958 ,  2252825402737691127 ,  1257767738235962682 ,  1474745607858364927 ,  1836708126242424030 ,  245081655190653774 ,  2152085403663065524 ,  2096859040234114206 ,  739090116635012587 ,  359834827318697103 ,  1902214722116544240 ,  2303383433255246474 ,  495938029217114180 ,  706614772979266270 ,  1816859037840067881 ,  414415999600626669 ,  144703171807305273 ,  1835088609338276773 ,  1215398465506638131 ,  1961240831034278103 ,  2025927266849499476 ,  91168454136186585 ,  1126935132646346365 ,  380773318798647692 ,  511599246299989483 ,  2126292661039241795 ,  755602564964915022 ,  505697630100406831 ,  2244216805691956076 ,  799704009631449184 ,  1715196183603787061 ,  1874522439909120684 ,  560234102830917971 ,  358443441671627604 ,  1280071349351370252 ,  1775998967131423489 ,  213270999180168108 ,  2005826005644291081 ,  1266809176586393209 ,  1229291443045797878 ,  447220672642819876 ,  1187686646528028665 ,  2074987083048610776 ,  955991480247702723 ,  223851665809541015 }, // x^2^582
+
+{ 1402958113691503126 ,  846772706880917101 ,  1476110583849658636 ,  2090969557783299277 ,  574017647270374578 ,  1725952769449047494 ,  1981500864647547726 ,  1349806748330856116 ,  1176492345775023117 ,  1835868889388613797 ,  537074570672779602 ,  1299796485489015208 ,  1376915342013710082 ,  90071342623353042 ,  1390022316942859533 ,  652291777785515574 ,  333797672305418271 ,  144167458404078931 ,  1639438082247467141 ,  599768393323300126 ,  413038356070045113 ,  1985235993796085963 ,  146068927564823284 ,  2052132399776423073 ,  1135411536247233109 ,  1419955385944691844 ,  1281840586741918865 ,  39512437156159902 ,  546195766041196432 ,  149395361345808656 ,  1654314804328979118 ,  883963576586687275 ,  2212186229199616773 ,  1536621103741999635 ,  373971052376933721 ,  1670971039666429760 ,  1623670530448801968 ,  303865562092823898 ,  2151850569110359975 ,  1710701240269040174 ,  204895303315433238 ,  525214764432915170 ,  460786110445177030 ,  35177473731251160 ,  1919578507983089918 ,  1926822986788210982 ,  2089000754546261875 ,  2126539311215701232 ,  291365522724230640 ,  1106856832287881799 ,  1518859218530586000 ,  712292545826841216 ,  274662547968077490 ,  1125757223341153943 ,  2262038765330341422 ,  1641797415796925773 ,  1099133528129572469 ,  1982701913906559226 ,  2083592311062754628 ,  2012131540583957338 ,  1435902456300763598 ,  551256893475230554 ,  1413549898272460715 ,  627196952753327810 ,  3970963318240271 ,  1110420395091749193 ,  1384775831435822327 ,  1204548110474056783 ,  1363294836610605387 ,  1611562321327869878 ,  1884348669632016071 ,  503096538431749974 ,  1003118130806671697 ,  11150346043132040 ,  1972787411960754610 ,  979626292487073566 ,  713974753310603184 ,  1193992685370866851 ,  1195073120852770845 ,  1820459749691733524 ,  1988412691188316152 ,  2053504756068547773 ,  1976574926847596524 ,  134825811254295945 ,  278039085077717785 ,  706225009506358227 ,  282363864507685856 ,  2193643543111689972 ,  762841117495966999 ,  524558052009288614 ,  951249203955186764 ,  1740583438198295881 ,  2139419115985468872 ,  1768870118421198352 ,  940171416659839415 ,  344008172489423596 ,  1426970341431839324 ,  1339581113007770308 ,  3015359841488937 ,  235067741985245001 ,  1223271436208479018 ,  1497515540005275924 ,  427529697628936129 ,  1937804693263819893 ,  376869644776969993 ,  2249701338950231575 ,  1736006038907020272 ,  1892982548674346038 ,  1773245299193416793 ,  2115226447401338561 ,  61141364152414496 ,  218436940602939027 ,  46156821927936978 ,  1067700969902902890 ,  1496758351762801631 ,  1185869764501319080 ,  2076080856689900329 ,  1019100268106582489 ,  802177831128729234 ,  1134769163402403178 }, // x^2^583
+
+{ 2027175018139029812 ,  2219503352785054943 ,  662188156100200136 ,  1487446829579848940 ,  301928517420702371 ,  1928742644275246429 ,  1577940263246168005 ,  988281837271943228 ,  1973137661618689171 ,  1487150712603492465 ,  1514486504886986 ,  1677465108354704991 ,  715342969153688196 ,  1396194170946140897 ,  2282823864222058168 ,  1833491926641150436 ,  1493675361266728423 ,  1130831539857094077 ,  1188883709848128787 ,  2165659557532891023 ,  671258729218563442 ,  586253946988755807 ,  1494080158272465421 ,  503112155653953296 ,  1665086332884973916 ,  1980559167346564686 ,  1481557923555147393 ,  1646819088058745167 ,  1324319390931186409 ,  1614221700181707661 ,  1009737042665945509 ,  989304314844956562 ,  1450106321712858087 ,  82483943489770582 ,  1977340702558818842 ,  155126522452242824 ,  1748405043262692787 ,  489996696851767094 ,  353579828403125032 ,  1963461644650588178 ,  223266190386617678 ,  1254210524456139598 ,  595339320575454177 ,  2107945860668167182 ,  40473339713551006 ,  673028001459139191 ,  1963404486038256220 ,  1148367318515018730 ,  1485552604618398797 ,  2068488201719429976 ,  2107883851295561161 ,  1180443560795452183 ,  349281202788660841 ,  1761408378430597078 ,  1771602051341378970 ,  270826596418535211 ,  1267343137217415339 ,  1677290005923397830 ,  587551549670799017 ,  87393898714919129 ,  112971268320512724 ,  986313287923888604 ,  457550387000986696 ,  811011014278536440 ,  415683973984635847 ,  1777881782945124638 ,  1225643845007752517 ,  1069258163429571393 ,  1485102464164931702 ,  550958774632942534 ,  1999605532815885831 ,  2132880433415197918 ,  1968716573994663467 ,  983244566438400973 ,  1709436325546419068 ,  1647109323783015389 ,  1478498535576103343 ,  1557819594940586880 ,  550976616853234836 ,  1744095749066745431 ,  1324195229435249142 ,  1834192043107356517 ,  1298569165733617979 ,  1828455288206576821 ,  484479671640133149 ,  1571170453687742910 ,  746131010008415225 ,  1025121885835430933 ,  447117781691681167 ,  1038428881391772671 ,  382657428856109978 ,  1951094985204272028 ,  2281163139271331814 ,  1602483705266637139 ,  2191899695344530965 ,  1362026636520807316 ,  1535812312614084352 ,  987048539611508147 ,  745682509909946044 ,  113068681938790949 ,  567203458274874872 ,  1333317789813749647 ,  447024156053366754 ,  739950050629808335 ,  2148861207005234103 ,  1008354684314742336 ,  981051511236457066 ,  760296572737969763 ,  622783677619403715 ,  1215197581202311429 ,  1852621846773728894 ,  173087830664819919 ,  442790897406697617 ,  1361341066346179045 ,  976939202428056067 ,  488448094193864001 ,  617429663983020291 ,  1727832955246812900 ,  2045448705878035820 ,  928491821297826304 }, // x^2^584
+
+{ 690841565349549092 ,  886451269815797834 ,  856811718737740492 ,  639868538731513736 ,  2259435791021631789 ,  503289591782802403 ,  144549455053091919 ,  2013796304132731604 ,  1873639647658404333 ,  1138506192409574368 ,  1165076737322830630 ,  1897286547859770027 ,  1016772101715707811 ,  308461984035067504 ,  1895091404405710343 ,  439338467179147890 ,  716716089505861646 ,  577516574983139067 ,  969691385141793474 ,  721719100059664824 ,  532219676551640112 ,  330549646694286958 ,  536284092996231861 ,  1304283697058789856 ,  733250418651671171 ,  220155853363744871 ,  2278397662272632759 ,  2004327716350822296 ,  1513470491037909654 ,  261490949763850929 ,  700877313340739935 ,  862278103575942704 ,  1042325754671224206 ,  1012566201879526985 ,  1858495931693422707 ,  315845896618526469 ,  1704991710231964121 ,  935292253860775981 ,  2205254552727837115 ,  235729865211859231 ,  128281964166033473 ,  809788020861621086 ,  1305360591855182307 ,  27568433384132652 ,  2042408026182542254 ,  236148168833865762 ,  806619828616171733 ,  243374643248334032 ,  2057462918706052835 ,  564068638183774905 ,  1059681410766935145 ,  320353458169049704 ,  181494233508179043 ,  2148005310903789662 ,  2139640161853071865 ,  294946015324738787 ,  1618011677222189888 ,  2001617858256274700 ,  1129939619098109707 ,  1799266511453373554 ,  2249749985053980874 ,  126091059077227855 ,  31522993940527787 ,  727672305812503352 ,  811961499471622721 ,  1021050804699492311 ,  2036858720001931103 ,  1154440634171995893 ,  2126388691432575450 ,  1991893699609185056 ,  222269599878234858 ,  1519634644706319815 ,  2171875592459349857 ,  1520278362841509896 ,  1850151523770902784 ,  1797285427990876690 ,  1051383297625074185 ,  638739706563726304 ,  1331359785575141111 ,  1405200484939949862 ,  1264942548005428582 ,  898597329301745043 ,  291060431379562076 ,  718947878205861498 ,  2059217420133628072 ,  1237012463578494393 ,  1035371067045870968 ,  7341179659113392 ,  1538330236862851677 ,  1969693433867636634 ,  1216683442142795245 ,  200815037780612099 ,  1181710891815977458 ,  1579514307555851999 ,  2219139010865700193 ,  1530824123718627103 ,  1898184298067892044 ,  2152142084324390956 ,  548309837331085149 ,  209594372204982273 ,  491653635429723839 ,  1853781373968102060 ,  731962311771300276 ,  1671129117407317755 ,  1459374831119363415 ,  1577683984257833893 ,  969025470461562722 ,  69903009297161117 ,  859374409555658800 ,  2018307736842346568 ,  529697506436070818 ,  937148504053556379 ,  684038626790503578 ,  542722614196769290 ,  1314836249639523380 ,  1946350782094710485 ,  145349060008122534 ,  45076870247914210 ,  1261708654680444626 ,  15282265189922848 }, // x^2^585
+
+{ 1658866828454050893 ,  1844731884281399980 ,  2234427492856788658 ,  1767962393528740262 ,  2080283353003328320 ,  2066215980731959004 ,  626921845497370097 ,  169628040092550798 ,  867418192880791617 ,  322063171521360815 ,  479199897552197672 ,  1675640196066945075 ,  1632591084965159032 ,  1051099199644189444 ,  61399074046644387 ,  578201280206202615 ,  1824078996389513820 ,  2219222900025230128 ,  1229466618877036520 ,  472353468242235380 ,  984475275634310617 ,  658866882994935899 ,  1752265539145469108 ,  1979873788767199585 ,  1205797334483295437 ,  1279233048601885655 ,  1553623845091388315 ,  1101010043345293282 ,  357373339140363162 ,  2297633841559973988 ,  1971944606667627753 ,  238799013461309195 ,  1366142143989994248 ,  698931652929048582 ,  232995835027197380 ,  1598569878801953542 ,  1558245979448414536 ,  198858076794411276 ,  954915612204701688 ,  1569420286222016971 ,  1418725327008565656 ,  1491261625455396301 ,  75534096341001424 ,  1280748316215123253 ,  1667004147926877394 ,  921458972818065386 ,  883173154630771772 ,  106645828451526484 ,  1979259085047860846 ,  1014499219133243636 ,  2124130877526786816 ,  1620853949845090550 ,  913685217192456295 ,  1057246235612685477 ,  433891992737919645 ,  40115513532566865 ,  544192024112686109 ,  255847639119273765 ,  1556389207256507143 ,  1533979386582437800 ,  271605375650018999 ,  661343710385409891 ,  1825533420024141831 ,  173118842040737023 ,  23125643900840899 ,  1944507414208409772 ,  1549066115207793500 ,  412485441189605183 ,  2251392562842161726 ,  1233095313668249589 ,  1440774424484446412 ,  953447447810671297 ,  1010944207169105789 ,  1742917334760289642 ,  381589275016275481 ,  1191676902030498187 ,  676090109622561743 ,  1646626901285155032 ,  105961185789075352 ,  1679539121189696837 ,  344431644915709374 ,  1201490299060463969 ,  717769415217248156 ,  570737726512284104 ,  168859094797647298 ,  1338067524059384764 ,  2255710363180044247 ,  893788470509381121 ,  2291939379893546156 ,  59737168440647872 ,  1483257204135988500 ,  1427833948416493551 ,  1520849560527498524 ,  1425660318029724469 ,  2117112440311475022 ,  456443829706668968 ,  1379699466052403321 ,  1771553447596064272 ,  1296141641229834951 ,  205570224183665643 ,  903915667381553215 ,  786706212164263496 ,  1724766443132672843 ,  441650340979172887 ,  1777632033586327483 ,  1187196520546345980 ,  365347199144155844 ,  1922941157084369583 ,  485449614717518568 ,  294922090978842447 ,  1182189250899926647 ,  614005327239512120 ,  491869422684069293 ,  817708956740437090 ,  910586854796692401 ,  1804841427900399306 ,  329534466342962519 ,  1856649265874810677 ,  2226840686903432047 ,  1676406131807350153 }, // x^2^586
+
+{ 204500662273632717 ,  1424378655271792855 ,  1885644957820027348 ,  2138226093008793251 ,  2051994499206601246 ,  505779176221533217 ,  1929924811537520113 ,  1111760111439728577 ,  1539194220684835280 ,  1630224776063812577 ,  353023666238116907 ,  837787129170540959 ,  1447333465779395469 ,  2090336111170796928 ,  874313484895624408 ,  1389804432347680256 ,  2083930282690118699 ,  1290484354091121182 ,  1941181510021616493 ,  2154574303901037334 ,  1768977250431765173 ,  1015244687233370878 ,  372871176180700564 ,  950572685304817176 ,  2151814214473481630 ,  10440676538723372 ,  83377303106187521 ,  512226746757138022 ,  2173212614418451818 ,  1931828861774272789 ,  2288615307632587327 ,  1883088871128530688 ,  895958942179906048 ,  1195488299181534889 ,  211968343205344822 ,  1172512772950355808 ,  1690175265619172631 ,  1053583174671524694 ,  312686763565329520 ,  1283521895455934792 ,  2052882244588446079 ,  412491965136103412 ,  925402770684351020 ,  957034057162054663 ,  1155559181441868408 ,  1970889006489785771 ,  1732727193898540094 ,  1458202876022111679 ,  787747038935550676 ,  1410554118422140914 ,  2118263917530190179 ,  1594364994486136577 ,  1173219097553990356 ,  71578059664861454 ,  1790787522759834098 ,  1277918944325876644 ,  1424296179312362558 ,  1972504403051036289 ,  124146507411107049 ,  427200026526981739 ,  1419674080333313786 ,  636712435833368056 ,  407608477881135936 ,  908569531513715933 ,  1823894643867352335 ,  187872945632575422 ,  1222387471980781141 ,  2015916580165176231 ,  1055435559816787711 ,  1011043409164232365 ,  1567120389061934025 ,  1582465320106353447 ,  1250278762209640580 ,  1559042685710175421 ,  1726141604601189277 ,  728989934132714526 ,  631659231689490330 ,  2297896209490685407 ,  910622410467915401 ,  289800733640288308 ,  965313346683960657 ,  207757951771080151 ,  1654978654119195205 ,  1589996884885268980 ,  722834825212964521 ,  75725332178474273 ,  1973341420947990639 ,  366341273240713273 ,  306122494266056121 ,  1184283901052662090 ,  742016309272881364 ,  46826519546696392 ,  1954221770063533338 ,  355281928295479844 ,  1407165946487913374 ,  253134854062873392 ,  1648477851499492242 ,  55435075847643099 ,  1934096450656762888 ,  2010454040536293651 ,  259470778215923725 ,  6127812011945401 ,  1512162402381404527 ,  2215311566197388368 ,  1471293129913693784 ,  2021032582299049505 ,  1683729865716612003 ,  157390329813091021 ,  2050901767567812282 ,  1769804462454268022 ,  864079265177386534 ,  1401707133297950615 ,  588519655419240321 ,  270127320627859687 ,  1346033607989570540 ,  392663553113553356 ,  162124172022405243 ,  1173656935137363996 ,  2246997890509908347 ,  1046716519207061903 }, // x^2^587
+
+{ 842913653343985010 ,  369797516002855196 ,  462429590662348425 ,  2265056405432516635 ,  650129526273043266 ,  1201015688589471067 ,  1679135727687348595 ,  1390818737427052903 ,  194978255595245954 ,  1559292408857219145 ,  2238354109659963478 ,  1619934899302673351 ,  1600542852266883737 ,  1075872254928215834 ,  1873341294322124201 ,  1921159824616582958 ,  1808537499907837771 ,  420184786284102910 ,  728583710052483744 ,  1773058031412861622 ,  2270609396187275332 ,  904990875500827263 ,  900926348060846728 ,  901202766234236566 ,  1094414344805489252 ,  1108122356946459897 ,  888993032903479251 ,  2212969611698063995 ,  2064445385300711202 ,  128053490012688922 ,  1364569897134515993 ,  120090185035821550 ,  1897762335903040861 ,  1815844084932419996 ,  1915026888105721337 ,  2019028149494072958 ,  327549127892728839 ,  4722623526297998 ,  2044876173234900608 ,  1654213742972985704 ,  1848769082648991398 ,  2195510208135266383 ,  1144029720367352344 ,  795220038310113512 ,  269099971413922317 ,  1029976745360491197 ,  2016169829153851602 ,  88694484627369904 ,  1129585730749253792 ,  11932252267897949 ,  1499784537344669208 ,  1209240599786564571 ,  220263393544938304 ,  1997629603216476776 ,  1217896989714002083 ,  209308564935766282 ,  554827457645783772 ,  657650209656670653 ,  405853665804529258 ,  962882135973573198 ,  1450651570747271287 ,  738918106200789652 ,  297820155486195369 ,  2281783436595852055 ,  427812389127989961 ,  2304098269335249160 ,  1301173749386680087 ,  1246196352513390351 ,  454942326088070670 ,  128486433644633936 ,  1169837888648600708 ,  1812988257237769017 ,  917025265172145222 ,  676910454658226867 ,  460995155765881219 ,  754772059407427639 ,  1483260250570016550 ,  103953323930715900 ,  2243437171688946488 ,  2108352028499866530 ,  680594866581109637 ,  225850217121776655 ,  1995682983604898845 ,  446195193111842117 ,  1487651010992472475 ,  1025964296737190092 ,  534790700954521569 ,  592637966721263858 ,  1000551026860410870 ,  1742466805218126146 ,  448581569068210726 ,  543024479799310558 ,  1639829264532404269 ,  2076678147019935350 ,  1862600416734576102 ,  990542178744903893 ,  29245236553187805 ,  684756593942454732 ,  199096777033598847 ,  1451402087031318959 ,  815342591949923332 ,  1246511258881855736 ,  1116056129365356852 ,  1295046913643642842 ,  1958486576077504199 ,  986407428126679139 ,  874557420713817985 ,  1262398504390664398 ,  1375155813467808221 ,  1738879456111383486 ,  923970690264180860 ,  837515977278446750 ,  2154069194527476563 ,  969729795981458326 ,  851847184693755814 ,  1350424841364005497 ,  20134125664191712 ,  186146688493725199 ,  1159896716976655001 ,  2038378686443893536 }, // x^2^588
+
+{ 286152703902801047 ,  1335699237959249231 ,  1234642188276355555 ,  621171445532355200 ,  2130305022504545671 ,  1321696368422187896 ,  1546973761184782668 ,  1868232578240651885 ,  869139904351504077 ,  1153133750891018039 ,  1866667620410357876 ,  657719216962226390 ,  1549489835460249519 ,  2093357825214470643 ,  2094226479662880674 ,  236376888024493660 ,  1438766530546163799 ,  610029003891297119 ,  535717078962793283 ,  1541128457389739601 ,  469477778338581160 ,  1750459348228990507 ,  1794830384436173986 ,  1624428366111487038 ,  972346350695075403 ,  1251299463856280515 ,  1681213626818820391 ,  721499453669050970 ,  1429115957609268744 ,  665921920569372463 ,  1940471512505709997 ,  886266775401981138 ,  538000640351496499 ,  1855398054532282323 ,  1924299450052141666 ,  2072904906349838857 ,  1081170032012770311 ,  207927929961084074 ,  2104419939264759905 ,  1787680023899137349 ,  1723303679500180328 ,  241606400857243230 ,  1095062229655361131 ,  914249729158924418 ,  152862930096677827 ,  400377731953406246 ,  2118748544229260826 ,  1350856719501600474 ,  799167115277576075 ,  36516213284818112 ,  756704779375997757 ,  1065925736606594804 ,  1535206994526615517 ,  179490551277726876 ,  693916832792216399 ,  1004024846190955489 ,  494045455877926520 ,  271736739212338824 ,  249753589289613651 ,  1775626079453367935 ,  647000599284590709 ,  70748964145675458 ,  1511904567793723462 ,  1881450548898225473 ,  124168887885862093 ,  1327900555128185634 ,  1319360567261517499 ,  1815301872230443069 ,  351911197561539703 ,  1466791865025012664 ,  1230869588103915141 ,  341125972210710857 ,  1828282817161806921 ,  1618166729432588548 ,  1811382912814241464 ,  851360282036257114 ,  1186198001285512198 ,  1129212252028171757 ,  2270784469371052704 ,  562053531308726147 ,  52739247352724520 ,  1969867991301787351 ,  1132690647218891364 ,  1696983731706232449 ,  1059727242804713809 ,  2041327790147156048 ,  1525293130347126992 ,  2093241159098657231 ,  477587797232361026 ,  182898089910925430 ,  2119086689442800094 ,  1524721483900158951 ,  1110158931538551354 ,  2259083998403824960 ,  2284376010508040752 ,  702442157963216299 ,  2207901970570248659 ,  1066175974780712982 ,  1992192734051794234 ,  300271478223525155 ,  1704337695984582612 ,  1630220079509677729 ,  1844298943535740471 ,  1747940392846656681 ,  105963561573438647 ,  198415869070711230 ,  1231215543707701205 ,  991473266830491632 ,  1136716057264152468 ,  895655980890968558 ,  870222914274586295 ,  1647372038761086659 ,  1910323581687869016 ,  2011609353767169769 ,  935714961367914263 ,  384791905059773677 ,  2241353730876558561 ,  130001255917976845 ,  918067873727228780 ,  2052016365501925059 }, // x^2^589
+
+{ 1617263719437935605 ,  640050578647389102 ,  1632202646768291939 ,  1699725118631265673 ,  705499241408477515 ,  596107455435418207 ,  2054434767739275829 ,  2138900129849051131 ,  1322423864638984991 ,  2225117009055688483 ,  479281357866065314 ,  135310313762431663 ,  864173999749386268 ,  768890437264297636 ,  935169959331296518 ,  600358245179484684 ,  1095067698199972619 ,  1782106721896799232 ,  1555855161619642170 ,  1454805445089307471 ,  1833246379161492694 ,  2091145388347285298 ,  218493946967414772 ,  1205086491748288254 ,  145170327585973769 ,  807038101172739031 ,  2006606845995088699 ,  1868455163848571766 ,  929018481932006996 ,  1435039194197538136 ,  1878356443101106433 ,  2090583975661488367 ,  290114323977487143 ,  2137664395979720037 ,  1501387325902175912 ,  2255018086860400823 ,  200300802995137764 ,  133852251579047700 ,  2115560753429317260 ,  1302654770520359408 ,  2007337885533681595 ,  291260271130959002 ,  252297845805654831 ,  833982221886291337 ,  1012576802346320718 ,  12719603121240314 ,  2100358538383481104 ,  796039714161612507 ,  797273352657486312 ,  2037927495233989345 ,  483337055459540934 ,  1052408213189858533 ,  2193972768745131816 ,  1220504237818803650 ,  2110417551054286659 ,  8230613288351986 ,  1165229584767112913 ,  2038424530910693258 ,  2134285536090378668 ,  186799106364269391 ,  1795555371641790805 ,  674399996563016868 ,  1161642888025109537 ,  800084608548731168 ,  1370419174772480410 ,  283837837640930592 ,  1468861112677768537 ,  2214399335270015326 ,  388960368240548157 ,  1475297381005152853 ,  1119761333591464788 ,  922613286708822815 ,  1292930362487553065 ,  1212699722008887959 ,  184921708879587501 ,  1507116317280186067 ,  55744374333147515 ,  172701059763991482 ,  2060711253636621783 ,  1566241799280488661 ,  190082777131178658 ,  590056391747477638 ,  1274949571202216221 ,  1362229316091678955 ,  44245907613531243 ,  1187344281720394130 ,  745273844103604100 ,  1214394328399029585 ,  2258453871447185834 ,  1540134312403391817 ,  1893315328566402069 ,  1074939963058478415 ,  330047024253813676 ,  212833158452783084 ,  1128444771961911652 ,  1541864764897277408 ,  1669791383533598114 ,  1890426703336584914 ,  1122276241485685978 ,  1657663031212103379 ,  1405681594355956090 ,  1628446727522527495 ,  2281068665095745765 ,  497717749446120662 ,  1156314126133178336 ,  1095624408794657629 ,  987194973232229880 ,  1405912297768281752 ,  982940391496917096 ,  574002689605015363 ,  1406772624084454126 ,  1505525692767456060 ,  112637903885141658 ,  1260272465844907693 ,  808985931737779091 ,  2109059481109052692 ,  1624068244812098410 ,  380936326106806293 ,  541901720537556125 ,  2080340867255995203 }, // x^2^590
+
+{ 525883341186226926 ,  129316988562770539 ,  259996464914538789 ,  795517793028044390 ,  1781573432853880536 ,  1703183182087678660 ,  324562637593862762 ,  630808739826188409 ,  1946427316861580019 ,  682701502559764203 ,  1825218703796456924 ,  101029399170103697 ,  27313679367183439 ,  687757725347385345 ,  307343990292963800 ,  98314545897106768 ,  146285311997441057 ,  2182017332343673098 ,  741696067949095851 ,  188688633469807510 ,  2104193771752760105 ,  2167654385068864515 ,  1060615999286968161 ,  2020813441121104902 ,  723332658203284520 ,  2156932333475547587 ,  1610062488378198008 ,  2131461614015492590 ,  968471321420889505 ,  2165186173233521120 ,  1867749003924690 ,  177610570711931940 ,  1651599484922161615 ,  478827239542906044 ,  2220115088274093717 ,  831857766497526652 ,  949649507947280042 ,  2278827336212937671 ,  1053957723653318670 ,  1083751462277321413 ,  1752319678084871959 ,  2097186942139969281 ,  426447809070901963 ,  2131613603957512193 ,  405667794779132952 ,  807824294500201199 ,  289019111254935576 ,  1650143539410862679 ,  32070042621893898 ,  811363563396080988 ,  2213806938543206992 ,  1515284916428094033 ,  1055122700308634891 ,  2145364077732527691 ,  1280448682454594041 ,  210688790417935239 ,  1462854343601247603 ,  2020333785600305067 ,  1448518507569739737 ,  265147052805131519 ,  320996969931624402 ,  1197219347093370186 ,  38887268993431324 ,  2212290174877941272 ,  2253593790773950581 ,  552553391133083447 ,  312624091257282004 ,  272715950305500189 ,  2290799418613459130 ,  2190173363727925581 ,  603961198376651069 ,  253858850767235987 ,  2099184974191179030 ,  1923803303424694524 ,  1998280132896867658 ,  2213016665589349641 ,  831246846575088260 ,  2278898563368600461 ,  1694390292604738104 ,  1968238979342144440 ,  1363976125629156450 ,  2250658847655212593 ,  395596159849032689 ,  1009337668365952587 ,  42737878795226297 ,  1639066909196763087 ,  328791343488616731 ,  146538000640008521 ,  1076213538420198309 ,  1279526601071948835 ,  384550117861752938 ,  435111930839319450 ,  1031988331177997384 ,  951113499094203658 ,  493321634807173466 ,  296096710760972295 ,  1963238277646599485 ,  1942267790664246613 ,  877468808169872898 ,  1855388794493857566 ,  1420276479655096491 ,  1812467543991933848 ,  1763176006915296988 ,  2150985934080141317 ,  1677051463188825228 ,  2105324158571948771 ,  1126525667876176054 ,  1394962112345397454 ,  270107732529656635 ,  1638027217250408166 ,  1645244478927235665 ,  339589872021158286 ,  906220172428293128 ,  1452080866252224759 ,  1561428250336648484 ,  1238974562070860443 ,  2123615099131745729 ,  1888236514517949037 ,  1481949373183808083 ,  888248819574937170 }, // x^2^591
+
+{ 314908757312719942 ,  916446846769317591 ,  431297611072192381 ,  812975837584098277 ,  1262003097885210427 ,  959450006136460925 ,  1934503340344578127 ,  2060846493332958988 ,  1573940558975804796 ,  1908493034931405825 ,  2143713843299548772 ,  2094846427705989640 ,  932453754446985364 ,  710274599394685047 ,  2090226905106707586 ,  1768988384858957284 ,  104284472158234489 ,  657979748569245144 ,  1303106014639288759 ,  1737818744282909311 ,  2183451691452444266 ,  779773472278622909 ,  1073574182292274505 ,  1299222292317483712 ,  749483141371819064 ,  122384514753506392 ,  1742377413417212048 ,  913064633356093307 ,  1797082968196341598 ,  289088932335900068 ,  746615710810390666 ,  87316715465247781 ,  252363515509926012 ,  862137645345615375 ,  359629816339848233 ,  1776798901803821629 ,  1942169901580444960 ,  491279841236066374 ,  220389048248581792 ,  1992741982288951836 ,  757535967459445700 ,  677450121367243306 ,  1588335463955752159 ,  452523326619737646 ,  744104472736633239 ,  1952150125524713410 ,  482950560324934617 ,  420157028868220021 ,  2168433622713954254 ,  1866575935240277057 ,  1298540799859659599 ,  26793715414972678 ,  2221543044938301572 ,  1225775724038363095 ,  687636379071515846 ,  299567176025318805 ,  2168898750176270621 ,  110032444826001053 ,  1928044191590594299 ,  900761531817373834 ,  129541199183935671 ,  1979858707993144859 ,  18264015672350406 ,  1309162617512135371 ,  1147897426911145154 ,  1019320948056861139 ,  1764140764710947290 ,  2075191989441572564 ,  1905173617796523704 ,  146109893018290294 ,  880981909458286569 ,  2251944780643038941 ,  1782551193694934824 ,  1466359834944875182 ,  1861151643101791524 ,  531487807423099256 ,  1894293446040930110 ,  16859868364517303 ,  728698097764914434 ,  2247034458997938561 ,  65532036490930315 ,  208415949952550955 ,  451116857842102176 ,  2155382135981063359 ,  1958983013207161901 ,  1624158479976869145 ,  1617667205110575355 ,  2052761871997515307 ,  625837615262130030 ,  731334410568691137 ,  230438026394279973 ,  386445076274805517 ,  1555062420630782795 ,  469406364752532689 ,  2093286745098055178 ,  378233497737373639 ,  1961738048132645379 ,  1516494899486224939 ,  592498413094623704 ,  2190297593236312921 ,  1642824469853828152 ,  479080937446204829 ,  1504378243415904260 ,  971797956473097727 ,  684452416863923133 ,  94083228881718307 ,  1566022124430796648 ,  79378169254658132 ,  1001231240616505443 ,  9335971439636907 ,  345437720391718243 ,  72880148083467717 ,  210685040640579620 ,  598099925796820427 ,  1165103155721497940 ,  9402771931864569 ,  1525137180724706354 ,  1138588652161670693 ,  2140693889148049284 ,  1786379657756402686 }, // x^2^592
+
+{ 916447420343649813 ,  616939630915040002 ,  248966679163785418 ,  478566537201158352 ,  358241514504760313 ,  1907268970629600060 ,  1685854166350817145 ,  2160473885245226282 ,  2234816511264414665 ,  1211995284042085790 ,  2301605565352009469 ,  675370703550430405 ,  546484693861438742 ,  144275322199375644 ,  842590204518495196 ,  1232937417311896124 ,  1821426646645953113 ,  945181029346599002 ,  2147951668970598554 ,  1088939673051217090 ,  588398703691638299 ,  118534479573222512 ,  1725796400758559895 ,  1326194641269380601 ,  1165314457621454761 ,  1293466126731064526 ,  1851011399181355371 ,  1919678065318815101 ,  407290124390849948 ,  1527548195267129527 ,  26724271593194665 ,  154268198852252775 ,  1338661472294128604 ,  926887582489382699 ,  1725892335256369116 ,  1020175984218022457 ,  2031711382790823528 ,  103907493232253019 ,  2238545848488983186 ,  1309581131769744143 ,  508205155587464962 ,  488526665872660248 ,  1914650546487874303 ,  2117244257094419368 ,  1733368551953720869 ,  1978625830405210575 ,  286115760027746871 ,  950698539820940141 ,  990820958540033255 ,  1537715768476872843 ,  150893145736980369 ,  92993773642846915 ,  1224319086479898485 ,  756941859215174850 ,  1864164837358856833 ,  1711060606696694633 ,  1730970695890712751 ,  378041254350484390 ,  205923630318827683 ,  2263731424245706956 ,  1203912040779369581 ,  1949810998089944189 ,  2057494526793108367 ,  11872842018564910 ,  1924622525923478336 ,  1780093381022399435 ,  748037002787365944 ,  1325679523937039998 ,  789782566172236241 ,  1105953358297209172 ,  210058547489701880 ,  267276711201991120 ,  1188175923086184197 ,  1870020083973884262 ,  73161093122806514 ,  485558543937513479 ,  95117430843637993 ,  509876370436510204 ,  1138273165811640840 ,  794115754368130681 ,  1888330333877048377 ,  461481265566874610 ,  415597787287156177 ,  608024016749890916 ,  1969580571417992704 ,  1212617193691427838 ,  239033545332365811 ,  144535972127717587 ,  608122746316315355 ,  307490107917148456 ,  332418372231070849 ,  1197716002264704350 ,  785196674783416061 ,  1997960548596669074 ,  2049438127921667332 ,  1595047098816470976 ,  1809620686241075711 ,  755234033454382034 ,  990058756071871786 ,  2075264983161544561 ,  1803071589593626991 ,  320355891836691172 ,  214829861521322680 ,  1523089210139622446 ,  1015426550646843533 ,  2146480052473666599 ,  1105244765543296666 ,  605318348546175989 ,  1164983019539006200 ,  1244613926492193448 ,  1909535427297586029 ,  1136432385995391547 ,  1830668303822799318 ,  1026559901013589818 ,  1765585766732655148 ,  1017828687891637916 ,  826766673690047588 ,  359184118667149173 ,  436240677906936888 ,  660165122220932073 }, // x^2^593
+
+{ 236293798503050235 ,  78039257962703532 ,  1302312496341405891 ,  518546772494475843 ,  562637597227339651 ,  1441646870291837044 ,  75194629217706098 ,  1188980838761789881 ,  572556020905479823 ,  1999818888549238148 ,  1515193576643967740 ,  851620390338184845 ,  133020989119788516 ,  2273136420116574209 ,  573462449769590048 ,  1140306132578685699 ,  1649909673051233786 ,  1879596107081693830 ,  792926600311860246 ,  1549954238650302013 ,  506756959369873689 ,  1733323758921525763 ,  1335181056479480083 ,  1625430432533066029 ,  456405105451000018 ,  1900968718699875242 ,  106939346207508061 ,  211961477088650861 ,  2039265861371319566 ,  1223772835969483595 ,  1791438656958120773 ,  299035838251798058 ,  1665158492382708121 ,  1712456890463452072 ,  1553433173943704612 ,  734545314106549995 ,  1020840803550623829 ,  1486835660621730581 ,  490443205402984009 ,  27559519572901910 ,  2148804183983069349 ,  2088665377362842088 ,  256853106641237615 ,  1191263645823463911 ,  719504626276055449 ,  1577561477068667204 ,  237545523959123784 ,  919563741699608329 ,  1948265734720173181 ,  1782388411892999355 ,  305330286056878595 ,  826749575374421986 ,  1610399624153942275 ,  1116298428798040901 ,  1669877009913478305 ,  746987276818791605 ,  1784315742197571823 ,  139705459450648537 ,  269433198860895155 ,  399889997611939337 ,  2130866843595148309 ,  1954460485727469031 ,  2065980046865167249 ,  914444135093176619 ,  726139509335772810 ,  612326957574977331 ,  2091737882228946195 ,  1573033590500516691 ,  685330876803043104 ,  1221168453699789798 ,  1314724804263511653 ,  1467027818993711061 ,  245202647790474342 ,  748512380318562838 ,  1115514896574981865 ,  1880816589962750487 ,  187798183138189550 ,  1105115914772160558 ,  241165809858849067 ,  1831648338551641946 ,  1100045648961013215 ,  1560772318113301257 ,  1516206449219642839 ,  162091791965276625 ,  2248155710089875128 ,  1646929310232809898 ,  1051828473100752040 ,  1032623353706945150 ,  1439780160978812725 ,  1810295092177549418 ,  700490623631664062 ,  1300259306163916579 ,  537652670637679524 ,  2016642945746091538 ,  1832027110294836898 ,  513311593628373918 ,  1899658942120104157 ,  1299652466899003433 ,  1950620983399143248 ,  1981298507762474235 ,  210100779846522497 ,  1492967428006018343 ,  483069654982415304 ,  371697122209655976 ,  167859311263274132 ,  1395899951064226435 ,  757094081781613270 ,  1061182266444962744 ,  674400550793567391 ,  1170992321630898796 ,  2302465745052019009 ,  1885878193813453434 ,  790175589359446592 ,  1499258154678302560 ,  165792955156377759 ,  1829563641988308529 ,  1280149426808431218 ,  762737874130579690 ,  1288316766258887826 ,  1105720781557811171 }, // x^2^594
+
+{ 1450962752452544789 ,  838203139853135774 ,  2409658691542470 ,  247025778813878890 ,  765710909249544729 ,  1408476742718577839 ,  1537113527451371078 ,  1306794984857224869 ,  1110122058626215261 ,  1643710194235501903 ,  1545709891239291270 ,  420518760535432977 ,  988109538562222704 ,  1575133467804746760 ,  31500582427485589 ,  1399451542443040887 ,  43689389299158843 ,  43763710406905678 ,  1998634076497459210 ,  512867483479717074 ,  1429132872683085450 ,  627068262514946387 ,  774696336247360413 ,  1210409412712891419 ,  2233980105857752132 ,  320961443286926125 ,  375610246090712061 ,  405966809479912493 ,  2123224547299041717 ,  408955933282319820 ,  515324819810364806 ,  1913997553286395194 ,  614966180437640456 ,  1369110711927778800 ,  804399645921818863 ,  933096126267896052 ,  745760121479570809 ,  1169422201239450464 ,  1652106378187071930 ,  1558820629909072077 ,  763470036630819538 ,  1018757359845963308 ,  1740988832208873675 ,  1204183403982582086 ,  403730947359460466 ,  1619137552239089671 ,  143093699279239923 ,  613517788955114136 ,  460741803907311592 ,  1250373950929079599 ,  903222494536874006 ,  1389655233675808058 ,  278193100168477397 ,  2141123372690536846 ,  128018089364209304 ,  993349102211083318 ,  794592242450962924 ,  121819533606565356 ,  2048080850677417181 ,  322360971826365712 ,  1885583264982074848 ,  1188527135750168007 ,  1787659425621284246 ,  415342342441150098 ,  1548242297730664800 ,  1787096336778296103 ,  1478349819179086391 ,  2112926250095307379 ,  883373997850491274 ,  168295893903130876 ,  1997804171683515545 ,  1184744271730634793 ,  235004485323533899 ,  1195911244069827739 ,  585748647722759894 ,  1279653270534081575 ,  1715063653301568181 ,  78153361910686783 ,  187619420984561391 ,  128786145410208414 ,  948651211469755810 ,  2229537323351996852 ,  2209450496593709292 ,  1355921901857850312 ,  911479067744310484 ,  962051414264429089 ,  25214365095274891 ,  190481618610322757 ,  1193697783196527116 ,  1417969960959625638 ,  1072319348382800732 ,  2251433579218090192 ,  2239155931863691862 ,  898912977130205874 ,  1707148921422646876 ,  707220397027232061 ,  1824219145006313502 ,  1756442416837892496 ,  2008883313088266886 ,  358625049670940827 ,  2117581873076427026 ,  632312311588187779 ,  1223376867751068274 ,  998280813608513482 ,  1260492074681922335 ,  1534379361791084287 ,  883092018336362102 ,  1618868982676505002 ,  773397754266930127 ,  2081415072262448702 ,  179301509289146668 ,  471074132686300424 ,  485219288827307479 ,  1080722674508842602 ,  818758277527667630 ,  793216962929221710 ,  295034116072571314 ,  1201383822631074660 ,  727645738878468981 ,  1271965333133807835 }, // x^2^595
+
+{ 985104121180054195 ,  897350993444853159 ,  1720873158496907225 ,  773971025730049605 ,  2174314817202635816 ,  1272475604789884273 ,  2065560238840763440 ,  256153263855823006 ,  258861507707408179 ,  376636176661041480 ,  87393913800017572 ,  858821633033309144 ,  515240344603095760 ,  842750226636866603 ,  654608488029342849 ,  559038891732237153 ,  44950104495044916 ,  1957136816534514472 ,  840713983500578595 ,  2088060492221796260 ,  539441235900627615 ,  1083639014968340440 ,  2278397562727674645 ,  1662256647540214381 ,  1692408401310671843 ,  1522513069084896107 ,  1110938382274694303 ,  1832266263590422635 ,  761314982148310665 ,  1728538175941117540 ,  608798143061619632 ,  1216207228842349278 ,  447270487569347408 ,  1138721317539729167 ,  1893806595133166448 ,  1381001937620333765 ,  1099828436233457092 ,  1678197191085527045 ,  1925252145305115181 ,  2122420130778868730 ,  1009022930442444917 ,  2222520984912999687 ,  1459148312579223393 ,  2187453157024542763 ,  1925586015498468732 ,  1809369245367185779 ,  2174604494000786694 ,  1664380365241330196 ,  1195256729105476786 ,  59394519797358056 ,  1940410914647157689 ,  1516548904707777272 ,  1192064421516032039 ,  180710815414422877 ,  1905570774095031986 ,  1867015701922159346 ,  1434979264808881904 ,  2097750232111706405 ,  542440673112829598 ,  1027389320849392137 ,  1325593797496062425 ,  1636905635118476679 ,  1715453938824668449 ,  1841530517272221513 ,  560909714545420485 ,  1110120881815696688 ,  1586425036697543014 ,  1111977933441001290 ,  776168713548969830 ,  1584852946623952515 ,  736363906408990173 ,  956060360979574053 ,  764744609331612198 ,  1926004492021285104 ,  165260825793868733 ,  1213541386381167667 ,  695110129923052532 ,  833505569840262365 ,  1778512309061172574 ,  1405365204540874191 ,  1608406571519652521 ,  296103349570095281 ,  617337739522936803 ,  904495643312024791 ,  1923702026488355636 ,  815509858486273560 ,  216151648958989648 ,  1536163452304889736 ,  2102041916477083574 ,  2274562096212764461 ,  1266744374488733243 ,  197131583823283752 ,  2102937362439230492 ,  1502861899162756651 ,  1366863056280772316 ,  2227258609559743376 ,  1412483988466521302 ,  1566513516555204073 ,  1898502839475762732 ,  27761733650716951 ,  362695209854998231 ,  2060788814065764383 ,  1646457864172370858 ,  403005725641382750 ,  157629744451272284 ,  2158691223725811474 ,  1386404357657019175 ,  1405165793594894776 ,  574727948949614055 ,  1785780839044749792 ,  1874754389999618834 ,  1991328980485123178 ,  1190949295145975087 ,  1490945684270469263 ,  2237761482846392798 ,  98850626286631622 ,  1018308923103174640 ,  2154956196889537942 ,  1249055639436885707 ,  1675160580660915379 }, // x^2^596
+
+{ 1866887103688918006 ,  420082084284396244 ,  565991470679730010 ,  982580341589427600 ,  646268550294153365 ,  2281489159204892748 ,  1453609293611515777 ,  682602406417015949 ,  1275076413789552179 ,  1357728007543767806 ,  212254700384415677 ,  1897525658494147982 ,  518731495531680469 ,  1085270661648436968 ,  227647778997060670 ,  1800450430962491559 ,  1301479850514373447 ,  859180921702053727 ,  2297206988188963657 ,  1062429727041797156 ,  2293762136778197646 ,  935544401974929268 ,  1136391257320058725 ,  1065063990667246029 ,  1840434754693993840 ,  743897092767343641 ,  2010454718793661416 ,  1679955646598181910 ,  1181651890401922958 ,  2279414947695341097 ,  2296682289785271484 ,  1134005370082844367 ,  2179708439273209678 ,  1207904855182547153 ,  75870156992065192 ,  989649905894174722 ,  2220851801180748512 ,  1692220269297733093 ,  1584000778581011253 ,  862551163030755241 ,  1062708238684827971 ,  1810811793578903061 ,  406845986779040409 ,  2064997346950947200 ,  827860559316134648 ,  530605706811452087 ,  857504689751077706 ,  1692915549174252679 ,  768515935066753517 ,  715963558579768903 ,  2161188588991503235 ,  611216640320216590 ,  511953090141005920 ,  775490753582772041 ,  404338942538399079 ,  362659181851110656 ,  653700709337740563 ,  1837713997600308288 ,  70740610024167101 ,  866814975386603292 ,  1582070361004858519 ,  985810513196722972 ,  1457656165058433792 ,  1025084268114485295 ,  440087545867119632 ,  2240888841808574635 ,  1961296325516339550 ,  1012909051339156226 ,  1138052771277468274 ,  1973049411174811762 ,  1938973891557372701 ,  659056916008831507 ,  212491246579224629 ,  1240617939729548275 ,  1504112616889621776 ,  2022448349797296638 ,  2198383264637547579 ,  629092795652370027 ,  1310052854860918884 ,  447518611156492415 ,  1061231538339801025 ,  303627105253523307 ,  1498159320881967758 ,  196571560523399217 ,  1612788834901032957 ,  446573512593042381 ,  1147463255383950267 ,  1338438692746592509 ,  1087602424389666372 ,  2253640645653101121 ,  2070235470928891036 ,  891041102954883916 ,  1348357806780256291 ,  1168642153871595191 ,  2128342769970276257 ,  1836859085507924796 ,  1729608666367725243 ,  1277626598210130992 ,  917900011748565900 ,  571287740834101540 ,  1082789108589658536 ,  1284366210605144204 ,  931606684598731330 ,  1010480921902811821 ,  1255770172260461346 ,  134066679039395434 ,  311664656893203600 ,  400369852523959554 ,  147352134605704907 ,  1369963948539483066 ,  350011058952726829 ,  6454806259808151 ,  1728389785203316509 ,  740646172495302630 ,  2086328992296737648 ,  908597633714120121 ,  1672117575611078919 ,  1872585523330593560 ,  1065926043905570420 ,  291845024734932054 }, // x^2^597
+
+{ 105282266179099627 ,  1658874897549853152 ,  2091163616186240167 ,  2228988139772286755 ,  500568384938195928 ,  286208697716261585 ,  187017476170993490 ,  1946432339715667307 ,  165286864092690255 ,  627325018851701829 ,  1053961776196960063 ,  820854078986518932 ,  1324789094986536263 ,  1410108537967042740 ,  811065909935974736 ,  834352999393111907 ,  1738002326542172684 ,  1277509512293185589 ,  2110575492807849959 ,  336661399332488713 ,  97609550355351667 ,  1032626411640031628 ,  116413370538368184 ,  671074563943056493 ,  1044426483255186018 ,  1049521753000569066 ,  34423531401959739 ,  1535076531188887342 ,  1221356361200136587 ,  759188657106779135 ,  2054158831904822259 ,  1884607902164624627 ,  1296344458097527551 ,  7136082226438543 ,  847709333866200732 ,  426635688302725355 ,  1884422523181642907 ,  181701144597935157 ,  2133415343680534813 ,  1573094193733106415 ,  2003161892891060989 ,  2016642592577758956 ,  461703719813033290 ,  1699974349421400693 ,  153125714990939575 ,  2265744998381181400 ,  1008104292761892506 ,  1414339948835190823 ,  1179649300600164720 ,  592528889951282853 ,  617101027310307484 ,  1620779197323145673 ,  1939388817412157655 ,  1158567639635866913 ,  1348791499955752099 ,  10745945773091938 ,  2006893191341197336 ,  46941841629431201 ,  153770799199688675 ,  2042295824183655009 ,  1364877343294079626 ,  424158889269096626 ,  1273953518975608309 ,  522721974794415668 ,  279981318541743513 ,  1075004854890849968 ,  559496207409665596 ,  1973063093609217436 ,  902947967233125084 ,  629415452735834505 ,  1854292156395684423 ,  1527620123706472993 ,  1742707808617488004 ,  312030867370742670 ,  1313612397897867582 ,  1166540107053240385 ,  2209355688068819552 ,  1140923201811106838 ,  1387600924572829782 ,  2232016134985922914 ,  1980739975592904353 ,  1402409981508058784 ,  185846223348880631 ,  1646537611542498708 ,  1512591747657228036 ,  612200397461898544 ,  978661964266697331 ,  1098648972528308542 ,  2220730246583635204 ,  380862578556571438 ,  882186481571368883 ,  1807240178149473197 ,  868063099326937462 ,  380912642966132976 ,  1071550348113065104 ,  1760324067998418264 ,  982719948760658846 ,  749725646253417770 ,  699626264757913036 ,  679904950292209780 ,  459169861181485937 ,  1833637160482922048 ,  1908087528905794672 ,  1382120009044369847 ,  2217303972504516752 ,  1815932181480499201 ,  1141300986698757918 ,  1301056882861422272 ,  2156363128508966760 ,  2045988655874270545 ,  1306450904112949268 ,  2140613623051203571 ,  2287172507450455373 ,  80350551243212313 ,  999235296354612455 ,  986826467065793145 ,  1440927356514106866 ,  283370110019308512 ,  1529943077997060985 ,  448560849441591931 }, // x^2^598
+
+{ 1481811845750555254 ,  541789019940549934 ,  73075797499880614 ,  389420338566800423 ,  432683134514061528 ,  1997475696793442324 ,  1977937500444846623 ,  1518630566897865399 ,  695328412890241659 ,  1970868215603974149 ,  697606317981061717 ,  885666606584655882 ,  226978717989045997 ,  1559692441012135084 ,  498500451605173176 ,  1572099327028486947 ,  297835651899036440 ,  1020468258320890234 ,  58583657852157365 ,  1456467616069252128 ,  1061056252435851029 ,  1745362302838641886 ,  542155984309467593 ,  1788542586240769147 ,  504191654313434045 ,  1886443561730689468 ,  2248791114916844546 ,  767926514936917369 ,  1137821621493499787 ,  810871794666967562 ,  333088799552858418 ,  2089855369381938482 ,  2026813465134119218 ,  2045537889574214294 ,  548277352992473563 ,  2286370627410690029 ,  1052744791314688454 ,  28043315560757427 ,  469263989750162963 ,  788972994037513135 ,  1097979423498393322 ,  1901459259057397870 ,  951425196059354166 ,  2116080782415274910 ,  990491098783735262 ,  1543754537577799446 ,  478922806248084350 ,  1117300446998396167 ,  1798819063371981653 ,  452893507885973302 ,  1544122761362274833 ,  915664310457836632 ,  2011027850217623002 ,  2190993267888803475 ,  2060282244004188518 ,  1806030708224393342 ,  2180684983387063637 ,  1618453273485228929 ,  252168954397164042 ,  2162897175674128976 ,  139337448397850850 ,  37592621597192435 ,  307089601970063263 ,  389966845826157819 ,  230674705086242189 ,  2173428115332451662 ,  1510375789668283043 ,  1269563399392088570 ,  1086513503838261254 ,  614634351799121157 ,  471754155175888438 ,  2281559315266290305 ,  26622251638946182 ,  1177166581444709401 ,  1081651363167092160 ,  1769094788609149244 ,  1099816564310384937 ,  1224970582606590626 ,  1781764317472651283 ,  17346858597461207 ,  374344676717005357 ,  1029200893968675432 ,  1261202949966151045 ,  2023434291905940262 ,  801171979409746001 ,  244183447926436265 ,  1967237449302493771 ,  921819619656512846 ,  1199288523498886635 ,  1847895058577315790 ,  1191133368752422087 ,  1139945750217531918 ,  1493813548085929435 ,  2215980649106944527 ,  1755323308690479149 ,  2281098531957615917 ,  1469889093836111342 ,  1901472611130195500 ,  1221084186204639918 ,  1263412332465691658 ,  578858054386151559 ,  1014795942308415302 ,  1516408418546220857 ,  2100191787663660763 ,  826862994866818443 ,  209104389200298195 ,  1633559694851767381 ,  470587486790951703 ,  919800836818179232 ,  1266828299216886327 ,  2054536677609244788 ,  1144964248625336913 ,  1558586252457089077 ,  598968154351640894 ,  440480560096797711 ,  2109196767979337725 ,  1874805774780804024 ,  530929152812915260 ,  2286778669602695324 ,  666213456169067439 }, // x^2^599
+
+{ 191860047158124781 ,  452244611396877989 ,  106881462928196509 ,  509811947252738419 ,  2206020170401314359 ,  165664520963696095 ,  2018248195448138467 ,  389063123913212547 ,  701639948831598217 ,  1724120359083743404 ,  247663736179071437 ,  31340112924526602 ,  864402903135998339 ,  1479922533875997854 ,  444444221780601318 ,  2098397692162251115 ,  861528868643910514 ,  1033330242610411801 ,  328097377755972942 ,  408436175747962104 ,  681293728880541916 ,  2033936236154132906 ,  321072535353300444 ,  2202455113331458359 ,  1671645272709141616 ,  1843334241749554259 ,  1611629271236151881 ,  1957631166310663246 ,  418592588081526510 ,  1833555669636545247 ,  2194481829881172524 ,  1798232665419804194 ,  947500628667983095 ,  1817454836364562583 ,  1203356384028198724 ,  349395155917061492 ,  1423385622781078138 ,  2209298818009720229 ,  327141564823092288 ,  1422852384990270831 ,  959381336430587859 ,  1091542612633309800 ,  2050425080290555307 ,  1579314792626668040 ,  98661929880430274 ,  2201174705614259884 ,  433202979440685960 ,  2064016849370753451 ,  1759489001396004807 ,  19844769272004466 ,  1019372491046380534 ,  782304943771171902 ,  1993253847159572958 ,  287903500442769752 ,  1036097173242034332 ,  1638068336761003237 ,  926608324524176000 ,  57255029591506411 ,  297376792121731189 ,  1959217151968590533 ,  1651879308648635262 ,  444791801244770785 ,  2222604908951653825 ,  2262751524596517434 ,  599009903820681693 ,  1642973222512489359 ,  1115233327638565811 ,  936065053180944257 ,  813627239266850118 ,  1586382791170642435 ,  592287637012768802 ,  738787413748389578 ,  1768159879015579399 ,  2085039401881399001 ,  1519952832579654204 ,  1065814471014142949 ,  1991638085786756404 ,  1489500428245011975 ,  568751987182020875 ,  1481534494292899445 ,  786858557755709684 ,  408541151882576892 ,  976787980870489644 ,  1892755260767858677 ,  1167142648193553580 ,  1424539732767192864 ,  2299090534387367132 ,  1137730275585095959 ,  1192477938677715479 ,  1316287163095185080 ,  1393151581589580528 ,  1307865040180614546 ,  1868948229243817687 ,  1187210051006128438 ,  1374436855526340156 ,  60098293198477049 ,  2108859454261046565 ,  717301332681486542 ,  388192137588910632 ,  1619671383592314218 ,  1709751507558378857 ,  1068140323190712440 ,  882239094672855817 ,  1440374382895551183 ,  349262550957792837 ,  2197562116744634298 ,  1578787887460658999 ,  1981389752646478251 ,  1451084372860000000 ,  172382190660672342 ,  522446146149053971 ,  725009172524444481 ,  199184488424253665 ,  37105093080289574 ,  1082140620902254094 ,  2272804707528034427 ,  1044525628781324345 ,  1056527784894084323 ,  857217881935336884 ,  1300357573936660841 }, // x^2^600
+
+{ 1666167238472877859 ,  221044900568651018 ,  2019866332700751263 ,  2073190168109307399 ,  758387467382070814 ,  214453978467591411 ,  543533030214634249 ,  291445352333531403 ,  648318330396820407 ,  2262454738203845315 ,  2204556229487780184 ,  600776348613697205 ,  2052282336852158252 ,  2011688405404239641 ,  595407086356797722 ,  1276729126356923853 ,  1519098316198040714 ,  1026407954788033591 ,  2076385130067049967 ,  334067903881229463 ,  795217166127401676 ,  1234990083218949993 ,  344731708897656901 ,  647782744545885421 ,  74685646879785376 ,  352224878958863006 ,  2249797467240283852 ,  6511666391994525 ,  39238519386764466 ,  2196178606182077178 ,  421665368931967265 ,  429986493962661381 ,  743584355836961842 ,  1788166204630910801 ,  1997044699770755654 ,  1145970876765748672 ,  910404034112367326 ,  356820058949191059 ,  1395039551443549107 ,  1566133756472655588 ,  1522036052920272870 ,  940833948086769523 ,  1733476663523986151 ,  378497351690497034 ,  1810327726603510218 ,  2303206552662079005 ,  1718473000000610096 ,  2052955237529612665 ,  355723049739214995 ,  1820609870693772289 ,  1379716114882830462 ,  1541526331785569472 ,  1722009266288759412 ,  1676494957986280660 ,  106717087141806429 ,  548545111383709742 ,  934074802547102599 ,  1395975718935277505 ,  491653035680094044 ,  1480048782465267350 ,  1027695259678262375 ,  288962859702135881 ,  164433471302188922 ,  1574365650150496901 ,  2006550627517143204 ,  825626710242169547 ,  1904124274752171856 ,  1172317495249823487 ,  225652712844927497 ,  1535502470104416770 ,  530891105654065138 ,  1252378734424758198 ,  2067375330391354529 ,  1644358199948794028 ,  1796411802367310340 ,  2300692866711631828 ,  556218315836483388 ,  992763992612518252 ,  1440977827449050086 ,  1183093029147659529 ,  1738273374935707699 ,  1210018485041332047 ,  1898030761179387234 ,  1649092393552937372 ,  228865984335732083 ,  314756165019876202 ,  772093297127612121 ,  25132097299343414 ,  1349905085643208407 ,  1187443929580984616 ,  2004670990393896683 ,  110182399749722621 ,  1802902097647221220 ,  1443080909058004682 ,  2150739358533985903 ,  1573671264921077630 ,  493411184525033429 ,  1652569305755335658 ,  598996555354719873 ,  452220498044464237 ,  1026649595602324759 ,  755488998416771851 ,  2156582474113116229 ,  912201344268383872 ,  1018526060629671726 ,  1002107359170310596 ,  486334583447306992 ,  1114907315939546036 ,  901037952092073647 ,  2216350355160592333 ,  167252761973044921 ,  1610686019788026219 ,  2042912610975968312 ,  2193463982565364023 ,  1275785986828477017 ,  1713065055728569536 ,  159258881991710303 ,  166222718005241223 ,  1636383929513086656 ,  1728244232967156847 }, // x^2^601
+
+{ 385872903297961116 ,  2275702681176140938 ,  2103228393004734992 ,  2245884982811378573 ,  113949199194046743 ,  91151519451560634 ,  1833783289327384357 ,  1413144615199933274 ,  212698141390271955 ,  989894320155036622 ,  2303365476415032535 ,  1600134033048279668 ,  159030766583983257 ,  655983044359477632 ,  2045943207895586110 ,  564051983084708234 ,  1143850707580587287 ,  1929840436103555683 ,  424344033097203636 ,  1495498516645887627 ,  1667688587172736668 ,  372124977849923480 ,  363263998260892258 ,  233723904743035457 ,  1138994728511581457 ,  2267743037029729523 ,  404501754811528475 ,  1119854291316629525 ,  1832844733114842694 ,  1121521942660171698 ,  37795324560918477 ,  1514205708965524697 ,  1720518185449575491 ,  1464432285833790932 ,  1629476531967920954 ,  251072783121791856 ,  1270005179542192681 ,  1242075417088159118 ,  1505603588971747006 ,  233625445376341530 ,  1341491150628995776 ,  340673367421844520 ,  2017017803800083776 ,  1127530676020764761 ,  2048539164567853687 ,  1611966256267283749 ,  485329449417769827 ,  538626775031890921 ,  1021280238423919580 ,  576148672326773535 ,  1416868990409056282 ,  49238734137916062 ,  1101748495299276391 ,  1590294665033307481 ,  1582150571961144576 ,  114288038675375500 ,  1382624349132877970 ,  2303058053037674630 ,  1980902804576540793 ,  1528495029151628988 ,  241355162319328191 ,  251479459264874199 ,  1217453811789676856 ,  1256558847601918426 ,  2258469176342573332 ,  2172840254235477564 ,  1996052880278059289 ,  207047948326165906 ,  2009643637828650116 ,  960142153065960601 ,  1378736445101569406 ,  1144440427400256492 ,  2183821449614276355 ,  774032211606998662 ,  1152465126089393436 ,  623998734715638631 ,  1888741283881110147 ,  1968171035003673321 ,  1935067375694878885 ,  2011143688727909874 ,  1597941197552390669 ,  531091991574249391 ,  2178090718334878078 ,  1757170651961639223 ,  835337232721839132 ,  1397801287704052567 ,  952344137612981310 ,  1491478350040812269 ,  1282272971641081594 ,  1851013271992132162 ,  1096074595962128179 ,  1624053778837540 ,  49436867432309818 ,  1038760559433960619 ,  2203811582327586670 ,  861318758043571277 ,  883109496819987653 ,  702213352625345152 ,  457776934634983705 ,  2126158324848749915 ,  2285148828963659890 ,  17197701020298952 ,  708187276575840766 ,  998047578550414882 ,  1676214717851062999 ,  914389240596561459 ,  1241232037610676812 ,  1881493628399594704 ,  466627565497822668 ,  1509603754348842700 ,  1590448634598964733 ,  1999709581457196725 ,  1921678749145556135 ,  495390873970355966 ,  2273425292114556323 ,  1670589015395520383 ,  2064933507651681440 ,  1566106417802383653 ,  819854713036337651 ,  921364615747864117 }, // x^2^602
+
+{ 1439319747224085695 ,  1049099468311740672 ,  189762467032125858 ,  1558122421882936127 ,  466854963692480203 ,  1531870729974763468 ,  1651372176106935802 ,  1572385192361404720 ,  2223487275807018703 ,  350510114715285577 ,  22948604926092977 ,  664707542658471918 ,  457733498109864731 ,  939298497665767995 ,  603296546960043937 ,  452962635286148493 ,  1392440645991347441 ,  2073720320907241753 ,  1584814487806417805 ,  218563615168951569 ,  1809164677249931992 ,  1277007682632414408 ,  28135817608682399 ,  931260075239679962 ,  411176742561458024 ,  115219294696620969 ,  690060955000540093 ,  2012778994615021590 ,  1991102758549744060 ,  1508751877986266029 ,  489837119171969098 ,  745562636550632276 ,  1065484099983358965 ,  681311601986328286 ,  90063198906173712 ,  2151775611862143230 ,  1359089391880904267 ,  1956844867821598826 ,  664394320191971167 ,  1526688748184913556 ,  1179104589967924507 ,  1104040096524982237 ,  1922008032680717813 ,  1996282600816392231 ,  209634286000808196 ,  683946971757357984 ,  1055335908261548962 ,  1496478897828378944 ,  1353783186275855280 ,  1156572258704220111 ,  2206301920692928860 ,  1636214743365668947 ,  2175343200719292092 ,  61292395456877733 ,  761080628367822320 ,  1931828651889087650 ,  10789631823711743 ,  822168573320148998 ,  242774828255351246 ,  2229772179167838984 ,  2266291136723097697 ,  1310356150081965869 ,  519888915357644680 ,  1749938225180563546 ,  1530360738396708390 ,  1658229700187510956 ,  2036156111301959613 ,  75893967037942554 ,  1783186063488983730 ,  1279603204178569457 ,  382448724760739139 ,  663089573545550141 ,  216163458095914012 ,  488080951678658599 ,  1596597562070764302 ,  541803215211729823 ,  1118888168191513767 ,  1652097495692766250 ,  608221522815444174 ,  927592960183485749 ,  1283032988058000783 ,  967094337345568368 ,  2236770400907743641 ,  867711364958480031 ,  2188093611618579080 ,  1588879535941324334 ,  1971911669852176379 ,  1312420093299978035 ,  1624660519408545480 ,  1794749462116571885 ,  2015026966955340985 ,  1588808713229027155 ,  1577117930754083423 ,  441436365006458901 ,  1829280064134773217 ,  1374880219698422560 ,  1939589941188404882 ,  1214712691936646840 ,  469481299614198433 ,  1484120475979426457 ,  1404542174011873242 ,  1579978347143818803 ,  1489265433370815675 ,  757988703942594007 ,  555939399639915331 ,  176650606499036264 ,  1629726325577082488 ,  981147003801240787 ,  2276950523273850222 ,  891320622388993635 ,  1653062716654369847 ,  1239666155980293656 ,  1931095248999058742 ,  950205976132328363 ,  2243077284144921578 ,  1881843299114843344 ,  1809553998033444956 ,  1972969536857040851 ,  608853597552797887 ,  504633322493730648 }, // x^2^603
+
+{ 1290255064206824203 ,  1900626133158750908 ,  2068707609551168055 ,  2029422882767537891 ,  1245720552755152251 ,  1289690611198387976 ,  1199356353495302087 ,  401653565260062161 ,  1801890466468509966 ,  1072805675492518701 ,  459925414196352584 ,  64563333177297465 ,  578828026331784715 ,  1104247090332054650 ,  1023886734369042329 ,  1761303290428249893 ,  203526639360561766 ,  1324452133705021940 ,  1575421210929286886 ,  758951272611138263 ,  2228085049447313805 ,  410534530596844793 ,  1604137785124242410 ,  1720494575087774850 ,  1185159879811377795 ,  1799157366880399793 ,  723676339533799501 ,  812212728001449249 ,  860568688149705837 ,  96589890327661693 ,  2063653154296398518 ,  1162195523894298854 ,  2010209902063493309 ,  1713545565224726909 ,  340003790398103043 ,  978519510923482207 ,  2220259478439195019 ,  970159407186765859 ,  1329678686628665852 ,  1428486352775760432 ,  709912566486382434 ,  1475417489407000396 ,  1140307983661269638 ,  837557911341971852 ,  47103701926416566 ,  1915665389531953173 ,  190816314094779947 ,  147396451358636378 ,  1411172659627144173 ,  757852526081353286 ,  113883506467447888 ,  1254726838127016325 ,  1559939042297235550 ,  661328583749003113 ,  955104041709240458 ,  593413761831142577 ,  1190612196420724684 ,  74003953457303287 ,  631295136637662544 ,  1820743379478426055 ,  3502620476793922 ,  1624089780386325556 ,  2071085457486051409 ,  1389745885740081458 ,  792598633414899501 ,  296135497688765519 ,  841545284387575158 ,  1412751376090947399 ,  1724440871657258550 ,  1079571446512195741 ,  1095826913061678058 ,  394586196147594312 ,  664894712902743343 ,  2133939942798065576 ,  58160060433123079 ,  1174384661637946323 ,  647871062598047814 ,  1413654617026182705 ,  406647987164543730 ,  90678853972000602 ,  1958921348485141910 ,  2203789501097092502 ,  638403954269893595 ,  1281602693776023780 ,  1041432233601598367 ,  590448721481238506 ,  554763237654082749 ,  107031013463633839 ,  519810439121692864 ,  1381565868560074301 ,  563628255688537583 ,  1250281617376143664 ,  503728206979847893 ,  293122764696242649 ,  1412005140763149929 ,  1834757570761903757 ,  2210269395101055611 ,  1382255877031772646 ,  518992859434938823 ,  555711289916758864 ,  1002921387607730793 ,  31376925290841697 ,  1493379535684113064 ,  1051024854397557318 ,  230074575376875348 ,  1027680845692983978 ,  1415819851994469209 ,  2092329205880204017 ,  1763011824837145808 ,  2138483207062020386 ,  2000893519190246739 ,  597197869617947344 ,  1367175567043233047 ,  654002921268411835 ,  200501449566115003 ,  1826530606342628432 ,  2075141124897363864 ,  598289041455463204 ,  1055514038737588041 ,  2264746064572958747 }, // x^2^604
+
+{ 337069334145418864 ,  1180585525029423126 ,  1958114714779117275 ,  1923141473807558007 ,  123214144183431004 ,  509282829906456502 ,  318069292215469638 ,  2092872583946103334 ,  506280934656925714 ,  707687028379927395 ,  952855363332407819 ,  1462619304044542969 ,  194813076499155293 ,  644305614524791334 ,  1265668156187473766 ,  854894524179972007 ,  689442139209601225 ,  576134344078944769 ,  2110864482969813252 ,  1741171501173085918 ,  1478978825344207842 ,  1817141194558867757 ,  822954676834234507 ,  885259500469826190 ,  1816308158680676679 ,  939904000806781304 ,  548491620213474167 ,  764190301878066422 ,  1799159029757270216 ,  522514840793083315 ,  1718509411822955718 ,  1858491051743236102 ,  302950818050377141 ,  667524628455540286 ,  2050636141702610358 ,  256003155072772497 ,  2143426555292243888 ,  1424659626891880978 ,  1443095352981136830 ,  827337209401865173 ,  2221807140352838374 ,  2046661741068948616 ,  967212758036856966 ,  250373225667470835 ,  702708447958507877 ,  1230393971363651846 ,  606819448528012759 ,  216369875005450867 ,  490711767782407392 ,  420750220862430592 ,  2080164309307443214 ,  1868215813825040834 ,  385808357002364621 ,  2068974983475743248 ,  1518607077432356700 ,  115120665833602447 ,  537892245542409320 ,  1583313880447479840 ,  1887697378594794396 ,  992430468482388549 ,  437663784727508284 ,  1484267454591316777 ,  635522769485714306 ,  2233518631522543667 ,  386235920966564447 ,  1498532280015349104 ,  1384163182826611183 ,  673681552322189440 ,  612844479632638918 ,  1016351625899780117 ,  1476148980173868366 ,  164274210548761429 ,  1597733678839554270 ,  1774044606360860562 ,  2138330715959461224 ,  1604672531033766503 ,  2259150293856600511 ,  2017172266036544676 ,  672775132612711919 ,  177707218084660692 ,  807508434110161979 ,  349515698552871633 ,  387996559392249265 ,  461704877409996688 ,  1829814637133551810 ,  1082110442484077533 ,  2270891211325138273 ,  1680180611460136432 ,  153555194758091541 ,  2238058195103611919 ,  265273543833270802 ,  22672652501474068 ,  20421909828151393 ,  2292761184422383131 ,  2000396290722500955 ,  2019707150155143175 ,  181770838559276777 ,  208744957407289409 ,  375031450054837965 ,  1817943076395189629 ,  1985984378388998069 ,  2246400250979232434 ,  159574269719557008 ,  780761304747215333 ,  164875481849774671 ,  2173532712305301866 ,  1288263430398858814 ,  720289265927904789 ,  239784247466206293 ,  920232022614093476 ,  1971632423253493663 ,  274609211599441478 ,  998527464088426824 ,  582998850204292800 ,  1799390009740291837 ,  664529513143538975 ,  1896997337797392398 ,  1577578011631703664 ,  344931915822349411 ,  1081441351551016093 }, // x^2^605
+
+{ 1505384109507956621 ,  913691840503434982 ,  922360911689757903 ,  2178058864352014312 ,  1378228559566546100 ,  2278188419084604008 ,  883943193569517910 ,  1401576180342339095 ,  391338219677747308 ,  1930307473308230347 ,  2158594896361856518 ,  1551440937192090826 ,  521047295544106638 ,  1372781458210668699 ,  1366519525967209601 ,  2286044421931511415 ,  1869721618190024380 ,  1474918973358708287 ,  259156647115407917 ,  733525062379243049 ,  1222810022377671884 ,  376345705561799153 ,  1610571617152963634 ,  2037937338393057789 ,  512203068059094288 ,  416122264720316392 ,  2179875114279080404 ,  2132216221053657644 ,  742261690980631252 ,  894381408280420773 ,  180441331816703548 ,  1142406170116354327 ,  914837393108810881 ,  837590239651045510 ,  720685509260386033 ,  951664186410932997 ,  999232524033010509 ,  860263045629495227 ,  583040326219611255 ,  913608927675526316 ,  190095549231747764 ,  2162158964819965130 ,  705781519973016406 ,  1077811536023404413 ,  1610163674516106717 ,  2021932128021579282 ,  1800716060621075767 ,  1671153125229159811 ,  1331707600677570251 ,  2132795828962277271 ,  890811581227922225 ,  1367206815841075956 ,  350518187979249916 ,  183603172617760558 ,  1304189623370690975 ,  592160373736717580 ,  219831120568291858 ,  935746759555574804 ,  918694305422324491 ,  2185414868006553349 ,  1456134742296125943 ,  1818888086618850060 ,  1539199184285022229 ,  2169532639578884791 ,  1916950068329891883 ,  694098937388401827 ,  1753823465493304665 ,  1965683752117845116 ,  1584380134203161156 ,  1961615084548877704 ,  2275646368642838531 ,  953751891127600756 ,  1483711772305618974 ,  1349010095940883125 ,  203386281746567206 ,  881235934824349168 ,  530854593782173255 ,  2029303021673765311 ,  448098636834738803 ,  1261752533131629081 ,  52239178270068033 ,  567510555858952583 ,  1520173738527062811 ,  1259434182054984234 ,  916806066033040369 ,  1148487497138256044 ,  1406335298977722316 ,  559683997823672476 ,  1266492461184843507 ,  33438746063030950 ,  1993969593660491638 ,  222628794948360846 ,  333535925163140561 ,  1786666128912211169 ,  141319751806999909 ,  1890314928737636195 ,  2010057510552821958 ,  1533666040175632017 ,  1424292660449892214 ,  1825653927545762476 ,  2283155349225511776 ,  33503727044098785 ,  1485019762691851973 ,  1461346388985030688 ,  1708095683918867637 ,  625961579475496895 ,  845695881594609654 ,  1534870689007480 ,  278796864098385510 ,  1381248830676451483 ,  934626382131690864 ,  696184834579109591 ,  262271528665550700 ,  1362934618619900627 ,  663438942644234507 ,  158166552315587227 ,  2070731688478555935 ,  1013346833580678731 ,  1832346514050031488 ,  1791248076983414573 }, // x^2^606
+
+{ 2040536041834134345 ,  2049136253562932406 ,  1152904643177074515 ,  674512377213444099 ,  966542989376342202 ,  406217558955632906 ,  1344247933395095095 ,  1569935027548889728 ,  217503695601720625 ,  707133476066361594 ,  835201488783209093 ,  645223751605425061 ,  1364155736361010640 ,  154613257480361663 ,  2257887395281209266 ,  345295587887586162 ,  679169985880400399 ,  867230574458182574 ,  1188956231303553362 ,  375521748774622417 ,  2108674853096483764 ,  1303000066303230361 ,  454792803297686166 ,  1184200387383415026 ,  2119525693406048838 ,  256521246708899666 ,  1085644329465979871 ,  1238765770164715161 ,  1541119621450022295 ,  1670531463670256289 ,  1325355050961862468 ,  1662238392699866339 ,  1131899036665192742 ,  2102435185643023787 ,  1688173550995204346 ,  493878657093895282 ,  1493511594139022984 ,  105750105657449152 ,  1324510720522834693 ,  1399980678163134659 ,  406580890467359780 ,  1810391827881935122 ,  2215497098006653937 ,  833572615338055122 ,  2011451238754153538 ,  252545897616670748 ,  153456971413168749 ,  2298048183742456942 ,  503436104093181565 ,  1898865903849324614 ,  550005137680881392 ,  1114222278853850198 ,  1104920063943174822 ,  1348679339822909310 ,  139996380799067519 ,  1303695745381262447 ,  1479080935079261867 ,  803301189312329401 ,  598711153973990710 ,  514715314017367675 ,  1171214305584497408 ,  25572803460571788 ,  2208707498360646393 ,  441858272717058702 ,  323029085860865408 ,  1473690946432328551 ,  752933113406532466 ,  877138596552154925 ,  199217831686486818 ,  938780655399555476 ,  1205353197004325771 ,  2252345373506821128 ,  1562267496096022393 ,  2251680189039244367 ,  1801324851008239004 ,  1543207808519037004 ,  184652198615095959 ,  975642579574550774 ,  1379920453061535261 ,  1593870798409826578 ,  1766735916370815579 ,  1452169769764904712 ,  1576149738587359433 ,  850871279503114823 ,  508524621282262908 ,  671295922487530200 ,  282601902663007642 ,  860574477198074275 ,  149467446133643303 ,  1913556369994919441 ,  691890702889360095 ,  1110732640375370883 ,  2232014892746877493 ,  1901316074542824801 ,  767069806810070204 ,  486546240403742469 ,  168339903278468993 ,  527402329691702445 ,  809923797024512417 ,  1142898459276131227 ,  1348794892763901223 ,  370833958928690254 ,  1920431245611420741 ,  218796032334766261 ,  683505967417408214 ,  1813604630596297970 ,  1964288609907541952 ,  2141352640107423136 ,  452906861178170663 ,  2107867982798517043 ,  1362866718749230847 ,  1605704864770695331 ,  2176227002334185726 ,  438832538038198930 ,  292936116528936287 ,  992590261226309328 ,  924531137536410717 ,  2222051102541767734 ,  2180605679447686696 ,  1076812217386865198 }, // x^2^607
+
+{ 1702388768883613399 ,  1488070969978789282 ,  1261943558291722728 ,  200410773119178649 ,  1964171058854483114 ,  2044821874067262265 ,  674205898458949439 ,  213586655257767146 ,  10049318686614547 ,  1697430352245864176 ,  577082746286980275 ,  1624584015610691780 ,  1211504525003516205 ,  146576305369319119 ,  1502256679719686047 ,  1641151178077116237 ,  128345532869541897 ,  1608151370243494153 ,  1437187338036185857 ,  1754222531474196790 ,  1077257535977466361 ,  1364646604585689515 ,  657110294860889208 ,  1911398379812805922 ,  1916955742271567788 ,  2168205136316837875 ,  590470602020817703 ,  1940918878778753472 ,  1683574404079991068 ,  1235348974026836973 ,  2142007042360373998 ,  1890605068263094537 ,  87216118536362483 ,  1986607788051507302 ,  2260924247987792123 ,  880207104340966485 ,  2148071248426873456 ,  1556179970764394037 ,  1179683442310130961 ,  804086277196228686 ,  2137743644766985272 ,  546600272942854397 ,  720628181225881161 ,  550669243656388387 ,  488026207034861269 ,  2151286452406490542 ,  1405772241885829385 ,  419087107868319941 ,  1869818547532416136 ,  1788909215063417450 ,  7815201096375360 ,  718982116368707545 ,  2250273379853095847 ,  473024451622967335 ,  326258317563680410 ,  898923652655897458 ,  412190223353971987 ,  719920715258288108 ,  1533784712256904769 ,  771661058026738964 ,  616703752818444501 ,  1488684106568187015 ,  844611144816333045 ,  859385997977008341 ,  778300932838980784 ,  850467401722072413 ,  2088703329254837390 ,  1528325148796374376 ,  652460874067969026 ,  1925035720689664484 ,  460259344616314514 ,  2093941497887894779 ,  1927444320021712652 ,  1326351788609226721 ,  1698957589478326284 ,  311807580597440408 ,  1263151361317451129 ,  546391971136897319 ,  568633063281008406 ,  1111630794544219604 ,  440382854095137046 ,  1932081279402478575 ,  361710530242287745 ,  1022818236950429735 ,  540434361645458362 ,  833750790943869332 ,  2120899527090143297 ,  1822328626615827910 ,  1043234419087454158 ,  940707230152752209 ,  830865985257763900 ,  1765710992020527456 ,  1989833218586734533 ,  497202576974218830 ,  1558635057529407953 ,  1677763013177155946 ,  369458858622811023 ,  2094410379805478547 ,  1540283842557821743 ,  627110497103151466 ,  421678777709188587 ,  1142496861156432986 ,  1152001973938801419 ,  421159948228281703 ,  584135664450744455 ,  1543535156648193823 ,  1995800825689433012 ,  215604807150518754 ,  1846317925957423122 ,  251717215900917217 ,  552694623458297141 ,  138662703835376522 ,  137010775345048921 ,  1548611867157705891 ,  1315997259782751734 ,  382130969051457524 ,  1499186926073576939 ,  1731688212453088472 ,  2157059917023870803 ,  444663453665703480 }, // x^2^608
+
+{ 551723971822777169 ,  478540346901563535 ,  1397018261136009444 ,  1319340484608325319 ,  2111357796480641459 ,  1873571552262203312 ,  1457574366895684948 ,  307023686520501450 ,  894832126250018051 ,  914117993405373115 ,  248717065728493501 ,  17309778785150423 ,  1626891421022650061 ,  1761096680790418099 ,  2299562659423716449 ,  130823436401029664 ,  659408199413847009 ,  2234711947928629669 ,  47415947985467337 ,  743470932169822982 ,  176776365469846271 ,  985164998109974421 ,  1941761723209584075 ,  1314710475722632436 ,  2235994544611564034 ,  1395989495436727895 ,  1086552256079992960 ,  284725900307195270 ,  355303385596439998 ,  1613990460991733126 ,  673512167675811459 ,  1457216362378678209 ,  2190173193866972711 ,  939344188363623380 ,  2288684920504322484 ,  1735588983376111183 ,  2199568403211712835 ,  376167115639783062 ,  2002743058958947583 ,  1528286738151303472 ,  1018515716163947372 ,  60344863624346039 ,  980639899141731379 ,  2270925422557899026 ,  532708804373009321 ,  725144493982811585 ,  333711886925459458 ,  1335985521192973783 ,  1798677635076017261 ,  178397891659892668 ,  1961461752793851723 ,  291270713412729767 ,  2087292316914431093 ,  564807895995503331 ,  661589143209389418 ,  1814536184645317216 ,  727872062166923780 ,  1708317095142271810 ,  1816653496737807384 ,  1143498693535415061 ,  848278482368466119 ,  1793431389182419996 ,  1989872750056621477 ,  2071967308844479545 ,  595838427354614855 ,  879777622250153873 ,  1344566504834460238 ,  1021625660991811188 ,  2181744692743379235 ,  1461818736920423531 ,  1199656954676231609 ,  2056457596551100505 ,  451507821139642382 ,  511030895685732736 ,  217177124080221497 ,  1839922149452539544 ,  1419911409688129911 ,  1875195937303065680 ,  205442974698222965 ,  1519104270405856068 ,  1966455248976810469 ,  1733590292581290386 ,  2018093215391098752 ,  2169463153320302631 ,  196423618740754676 ,  1985181742878020180 ,  1269289506826274318 ,  1856415021437343406 ,  271700646962230819 ,  989234930322702244 ,  460857638943483919 ,  1326041809028283421 ,  1088479780292367237 ,  1388523533736354169 ,  693189788043888372 ,  1893687051501402132 ,  1869579249166437894 ,  674108321790950046 ,  1876930725613191139 ,  144665595421711439 ,  394224260543341546 ,  1763621520325382579 ,  1331422969992378681 ,  1231638635998526346 ,  1321033773110030517 ,  673031814865676702 ,  983495949839134641 ,  1774560045948057608 ,  1030232921938942565 ,  2060698103060201576 ,  729562768076427797 ,  2012127448404554687 ,  1394330157065205062 ,  1932448272058643838 ,  1963691645722307525 ,  1462026087267539548 ,  1978765083211203974 ,  1190379951874747543 ,  1838478880614679463 ,  1917984140908572208 }, // x^2^609
+
+{ 2244604692182697588 ,  1839029614228586665 ,  820564448729910194 ,  2215571216178100916 ,  1686295295481728431 ,  790128832700820855 ,  287428883798156009 ,  1203760675241411148 ,  217051067746592349 ,  1652441278194621054 ,  2242836678631369204 ,  458585422817871653 ,  1197945627766158209 ,  42129304161371017 ,  1799191216468409655 ,  1220832128074695039 ,  547234159761330209 ,  1924325908624312018 ,  1442834423797109601 ,  820694572360690041 ,  1614287737384021798 ,  137046080816630805 ,  73034442892413091 ,  363248298465899355 ,  593919949100936281 ,  1667678293455896775 ,  944359499236996316 ,  1109371040449569160 ,  365636039193604597 ,  2270746888263280314 ,  808049902612222569 ,  367984174008949361 ,  1388345337190057393 ,  1607217988798205288 ,  301822826204773162 ,  2271531634165259850 ,  1368359776471434769 ,  1440229969743221021 ,  437465265767030348 ,  689646064987386059 ,  943750973824810519 ,  955579938872878047 ,  812043481283179957 ,  593392133219622493 ,  243118256663938132 ,  987198421392779752 ,  1924133178140174417 ,  1944176490888153751 ,  997444467123102435 ,  1771842064816838909 ,  1707040970417692279 ,  2258054856539281752 ,  1211018367432666021 ,  1611670432550900721 ,  358628176063754441 ,  1939959117203486583 ,  736748655658822677 ,  1849469086818174246 ,  1175239778707762547 ,  811608818203399079 ,  903237727307645491 ,  655112842884732182 ,  1107104836454926597 ,  1636928054507126015 ,  1489801045829435550 ,  1636481369450846519 ,  829685567600269641 ,  388205881661170826 ,  1946971016315555332 ,  2129011968950568919 ,  1983817863720175716 ,  758016767256388368 ,  642440747044402479 ,  312168645729333071 ,  2243599271939323449 ,  2085402546752121536 ,  743388998428177104 ,  1170213206256871050 ,  188522334525413160 ,  785325157838432443 ,  2176095201257179097 ,  810447048016389890 ,  177768691194188769 ,  202002949583028206 ,  1012815650660955301 ,  919997247865927767 ,  183420414084901493 ,  675569264040688693 ,  1624936641059876920 ,  22382649871258496 ,  1325218676097655475 ,  1298273872108697607 ,  355620262555728501 ,  1276629415591605308 ,  1087637932946471133 ,  1011345021173292680 ,  1107745276159348088 ,  348729028314829779 ,  805422565235867626 ,  885190790311076073 ,  1020272331090673832 ,  954727793955587910 ,  369768295109284927 ,  1374980307322574243 ,  965659794610171832 ,  661202622894060360 ,  2140824164902604730 ,  1788923537124787707 ,  524416034213666871 ,  2097549852322588097 ,  1399127104668888499 ,  2008721346584973785 ,  1975402730367483393 ,  1955822806388678885 ,  1230791178219717431 ,  1437844259562266722 ,  1939349764470888670 ,  735284486148588617 ,  1780428356244856488 ,  2301486381831848428 }, // x^2^610
+
+{ 2178821878035885812 ,  1776494925554323940 ,  764495803713955097 ,  267747032134829047 ,  1598777124651518727 ,  183931458809334703 ,  1988967554873581709 ,  541762073348046867 ,  1029073662077259237 ,  1517918323268796709 ,  1360528141509994039 ,  1567370417133156259 ,  764436269902110467 ,  1947476365823773623 ,  495776609859718939 ,  191278230892162773 ,  1909945203334849724 ,  1998281347945392749 ,  74053991140522991 ,  1135932038706350753 ,  1996390517177234350 ,  1914617205160418928 ,  1696854132139973405 ,  641612968303782604 ,  2175850284723657169 ,  1325451971281852467 ,  1790768655197554357 ,  1435043248589416207 ,  2279733417875891895 ,  924357883578598213 ,  1693557782437237218 ,  323838455085311076 ,  1271940197304574972 ,  1161073683967656318 ,  1229503545493732757 ,  1555705926435132314 ,  1604573275694147044 ,  1447360935255331653 ,  1432098275094196152 ,  2245511142672466217 ,  440264253647108600 ,  622812642802442393 ,  1123459775878511892 ,  1325963054135486713 ,  124555708225553605 ,  538691014099356557 ,  1008937447826815832 ,  2110910610461406878 ,  712076286145884744 ,  952494596193528424 ,  597149536280392890 ,  819742772968970270 ,  1687762070631268722 ,  2207598284247815019 ,  1411540988627479388 ,  1763355311766547535 ,  1481712488066157584 ,  2202034796838270377 ,  1306723549460646672 ,  1274002223049470731 ,  1148130673385460697 ,  1877361145800313756 ,  832222323019970949 ,  1380427767348857082 ,  226263908621726445 ,  2058848862368691357 ,  676173983579051612 ,  1796695547651664477 ,  14938521506862592 ,  84304502779397991 ,  2007619765867027419 ,  534526498398714476 ,  1997718218381176637 ,  9082552414593706 ,  25269324309015275 ,  2086996013536530976 ,  1474228795338509916 ,  1197517639408096185 ,  693691312014269660 ,  1282595331727423992 ,  1851588481852477070 ,  78489831003521866 ,  1816442512127993789 ,  993573948537605860 ,  450145495188596255 ,  1894736976183545925 ,  274624114594064960 ,  1088557162882553202 ,  971219277972762422 ,  897961005590782337 ,  655889711319911660 ,  446336095500335084 ,  947540125764258632 ,  2066841224152028294 ,  2195256364862597642 ,  1364852876441624921 ,  2082514620154971680 ,  1487665768503341559 ,  972949025097057421 ,  2080998239541795094 ,  669193132294556710 ,  2069424782847869526 ,  690645642937019006 ,  1601283537706251195 ,  1639692625000693344 ,  1090124779891672519 ,  593901201460406600 ,  975615565112215281 ,  1400866263396203684 ,  166820556996020522 ,  1426686919497381637 ,  1162628392002198433 ,  2004064461650413488 ,  1110631155198482180 ,  295414748797430161 ,  1456699125516983001 ,  1066645513917971771 ,  1434419770234697779 ,  1382626189313298881 ,  1181130283579559069 }, // x^2^611
+
+{ 1699615651871902406 ,  808062614336530262 ,  1463131792325159844 ,  970474494138814273 ,  1577382599416179687 ,  897083018338521599 ,  1022611061817999141 ,  2061842861862283050 ,  1843047588025277517 ,  1603851095058631523 ,  1199655492798147651 ,  1129416538273745570 ,  703575597498695642 ,  2277713230683705373 ,  287249318393804989 ,  1691929241800617685 ,  878122774860470546 ,  409998580773431888 ,  878212697358266438 ,  2033449466615330468 ,  1905879488243793299 ,  460694282582121124 ,  881771971767346474 ,  1597285630082164916 ,  500207933452907109 ,  706839111764412090 ,  1229451453413080663 ,  1263503466919027516 ,  104783270905096904 ,  2127092773937549526 ,  844141691031363434 ,  646430785405558604 ,  715094944409985308 ,  580189966435808914 ,  119604582911251975 ,  1252228371225938693 ,  408543694168244709 ,  2201834564928558387 ,  2022952156626499205 ,  220379178332538467 ,  1469859042233340203 ,  2115738531262470727 ,  566805015132058554 ,  940094707900714042 ,  324435744359893593 ,  1189069158415056019 ,  1863198975869203905 ,  2198731038601122427 ,  1690933908973091410 ,  460988338537818875 ,  169599617151529057 ,  1228579625121883878 ,  44682181695756075 ,  1164296276714426808 ,  199705412529648879 ,  1725342555577402165 ,  1832503260536770503 ,  93747188940522299 ,  856859480199850552 ,  1040994871623003522 ,  1781103918774880710 ,  605311785791351679 ,  735761881055401245 ,  1671837405192902323 ,  850694202617140392 ,  177252535655869526 ,  1708842954446105425 ,  1048466635876820882 ,  1166894079452352295 ,  558747120024664738 ,  1580786193847670973 ,  616912558149663612 ,  97593396339947189 ,  1569033797997894520 ,  726138319448161953 ,  2123063579699459903 ,  388794727530041520 ,  1202196767484687532 ,  1161353474674609267 ,  2198918938986860572 ,  1235664474723420109 ,  512696396616221571 ,  1703740008935549599 ,  348639612142579808 ,  1807263112412226031 ,  807798491693304723 ,  327093779989104900 ,  510189346725896253 ,  621773713626337622 ,  1146545969153579290 ,  1753007997149814527 ,  1575823588718278257 ,  1847708016865324079 ,  1447320484508572878 ,  730934623253270035 ,  729433998841589321 ,  1661365731956679040 ,  1488006702863521696 ,  991499847896931465 ,  973928674739678110 ,  2291714989580468872 ,  1240812539713933913 ,  233889131345238707 ,  1251965830074661239 ,  1824150979783559036 ,  1306309610045866271 ,  165266754492093858 ,  574410967759472583 ,  1059348264501861057 ,  1766914699528971138 ,  2128049111633833075 ,  1858205226637949123 ,  1156490589796329985 ,  686453583344348999 ,  1006217447646512194 ,  1009171841133092356 ,  2285854671132116524 ,  370981209955442742 ,  337039118675483833 ,  1150680550882938024 }, // x^2^612
+
+{ 1120023672969697872 ,  1439960387825164682 ,  1757493066040053340 ,  141871706680748453 ,  1434931934009279458 ,  720319636139026874 ,  2246784060803265744 ,  1838193146658797621 ,  1227268776648938019 ,  481505369213883781 ,  1863184802489497167 ,  85012836927469864 ,  1780049992371364573 ,  86288544675685280 ,  1571507103843305009 ,  564756907237322627 ,  1025082151753276916 ,  59845798915027930 ,  1497775909499824791 ,  777438343100213446 ,  1284963459400387049 ,  24316296868124662 ,  2105680279973668586 ,  709192780454889562 ,  247205630380826526 ,  878108937231502392 ,  2012462255925289811 ,  2260799560115086781 ,  1774060956846029896 ,  1787617169019078723 ,  1989175001337342605 ,  2149996622192953154 ,  612671891542826097 ,  1903609179464457138 ,  1047772407666479961 ,  362460724422098663 ,  1568855248938330929 ,  2230028257847917627 ,  90508898839955018 ,  1433875754618892498 ,  2138843735602831754 ,  734716510006121422 ,  254016249923928534 ,  1570501328506243738 ,  1265600641970758667 ,  1040946689731898613 ,  611596104353678416 ,  1179004906620683244 ,  1512326184323061775 ,  1716588285046244737 ,  2250381065300968188 ,  1357211794795216415 ,  354342072544667065 ,  2239555681021622629 ,  746526152855616256 ,  1094906425837956222 ,  1550562378989933802 ,  1017706887815490576 ,  512962681179927906 ,  33276935394422838 ,  1312685857528289739 ,  1780517871741609731 ,  831176965063618434 ,  287202159597835837 ,  808313921065848672 ,  7882434605621300 ,  2281021331498004828 ,  1142179152771158324 ,  2070852667053936468 ,  817891016723305867 ,  274217879498089124 ,  1427288126423231451 ,  1247232409496040873 ,  276492453101299512 ,  1512374289404303207 ,  777964402817497012 ,  510605333138378385 ,  911243418757334156 ,  937250866306515898 ,  377204989661125158 ,  716919288065057150 ,  600442375977570911 ,  84188309578125928 ,  1390408555762627166 ,  1015731800439625110 ,  1843265917326726664 ,  317479856972622659 ,  554603884612062000 ,  2146228398446612279 ,  2190278398232874017 ,  1922575484382949595 ,  325072599968324441 ,  195070564194069944 ,  2026767621509184730 ,  618359600513140913 ,  2019274205191176033 ,  612565495595706337 ,  788957955318592047 ,  538845800561008941 ,  152242787494504412 ,  1111674962027628655 ,  1143359897156703950 ,  1324355672785848371 ,  2018689877959318380 ,  257079378760181615 ,  1070371025549727701 ,  1520576194516631568 ,  980633350863640134 ,  1989526357044958699 ,  1793371721183465386 ,  756711021242611658 ,  398207706869123500 ,  1448178120956534628 ,  2074284471024840996 ,  1564542388905555759 ,  1175263172207152349 ,  1183075157695796565 ,  931961070676914970 ,  1180126153536967720 ,  516997810074697896 }, // x^2^613
+
+{ 1235121261727376102 ,  1200229034661023081 ,  1892018623122547900 ,  2116909168592357859 ,  232218251974614928 ,  2084716040049918577 ,  883307994862818797 ,  761278596001619573 ,  235404975989384288 ,  672566332709333473 ,  1098749155616401102 ,  1726333931598707989 ,  2213012176534787868 ,  1644314944383660524 ,  1174737359660194044 ,  412795741404989336 ,  1140990261184478881 ,  272168131406757864 ,  387314074916710465 ,  104464379111316148 ,  1405629883707093 ,  1443458004601622561 ,  253510624439869108 ,  723150533682678693 ,  1153316616054990790 ,  2166192233123289301 ,  1717156444777269067 ,  548901933260091601 ,  39029154152383977 ,  975876322746501382 ,  2171044743737519745 ,  34662333312940841 ,  291168198412106841 ,  577788991717421903 ,  1816457982978308586 ,  420457369377110839 ,  1221858035029090218 ,  1209972695955992947 ,  876509372725755211 ,  908483265072388831 ,  564380708092337203 ,  1978739127977407732 ,  658334665657346555 ,  1476228785555291765 ,  1047085348266382646 ,  1499082241221443597 ,  1127886760680710377 ,  1672744827236661485 ,  1484996899547515133 ,  862314497236244352 ,  1816071663439559032 ,  1361724382316913543 ,  817317689368591477 ,  1811649539174491725 ,  1964155146340760157 ,  2284375128849156828 ,  2053591595281555561 ,  263238433433859708 ,  981211716838731927 ,  2302287583430900786 ,  1769284685362639796 ,  1377263599240994593 ,  1422302529066215693 ,  127038420639988351 ,  1335147186666502186 ,  2224518140381366853 ,  1613295446593601523 ,  2112142594226875298 ,  2127525499276378567 ,  76998532309086925 ,  749108568729996555 ,  1961912627688299075 ,  90226471818728086 ,  1753748343296732518 ,  561234621185509642 ,  1903807520260001218 ,  265537423650551935 ,  741264725721360699 ,  2178608049827729614 ,  611677616835999491 ,  1635171228240685876 ,  169134646719652183 ,  436752925703995948 ,  1379011199709510516 ,  369018113459751689 ,  347492723939650857 ,  1278495925899540872 ,  1621207072128812323 ,  1273143540400982380 ,  65539206629949504 ,  2166941321599353091 ,  2293604624176631649 ,  2097955546848126554 ,  1154954906938957836 ,  2060471050392294852 ,  317994367921774862 ,  1004128206278802222 ,  1876406762319343890 ,  343744218381361829 ,  892583219360720469 ,  2142742460737793617 ,  1981682903979860704 ,  1277418066739617693 ,  1845190432955321501 ,  1583165241976329526 ,  2192431461825463690 ,  279710152275288703 ,  375664017995588218 ,  92100208994956343 ,  386317822101080828 ,  1100547991810205742 ,  120274224491309455 ,  827063321747803940 ,  491426084372110437 ,  2073919533795138270 ,  501184993864898448 ,  656834924550331758 ,  1446566517992079630 ,  1858400670546106480 ,  711538333297458162 }, // x^2^614
+
+{ 1209280727538026822 ,  440709333866924386 ,  1756379896690695961 ,  1956830294319919770 ,  341661042117786613 ,  1264108127064041962 ,  818802208841769684 ,  969232386788068197 ,  1445366771556642237 ,  149833339157560654 ,  306602187050020863 ,  1672902909373038922 ,  1592007283955700629 ,  2243786441164148300 ,  497382999644159325 ,  522344065276785640 ,  2279829057488861562 ,  1612444114486596840 ,  2243314388262117133 ,  1196212038488406061 ,  1539374619702537073 ,  1425316352475846941 ,  715068963681735729 ,  859556485725587586 ,  195442278716407427 ,  593141132300856637 ,  631593250520864125 ,  875709556737509697 ,  1980935290134026775 ,  488996021647825448 ,  1409675242137464143 ,  241403176152475493 ,  675508465675688898 ,  1526144552969975763 ,  1422501979664624379 ,  645117979300399729 ,  1921504284566504698 ,  392871084836171814 ,  792803203836354663 ,  988468744948178700 ,  1663893733421587296 ,  1099007161631585591 ,  2080039813045937849 ,  44492308692664154 ,  72319118487867059 ,  36026914506876334 ,  2123613688860338399 ,  1144598895718643090 ,  2046565883425615947 ,  363994575928024031 ,  243492089514161269 ,  370892019354083396 ,  1358186561686815448 ,  1737966234485485916 ,  346363337723777968 ,  2078802414618409498 ,  1229439027289634563 ,  899334463820825512 ,  1541152549069686465 ,  1196057205427591282 ,  2278727941013120095 ,  12165709384825016 ,  1096000834974929735 ,  2174140822191281111 ,  1127233213296261867 ,  1082298229359598767 ,  901311049602075747 ,  968534628015152625 ,  2105989539672085026 ,  896309204853600481 ,  1353146443034927568 ,  142824256332491243 ,  194182813246444622 ,  2631584501454491 ,  1095332210237020812 ,  731342377086090359 ,  150941117021618703 ,  1219839791915368693 ,  35707320567336692 ,  1341194529887475040 ,  586407858152364694 ,  2241071246567930201 ,  2088797692751604126 ,  304436097990875588 ,  2088018175896419025 ,  1271542957624043595 ,  806065498849277935 ,  2243495597566272160 ,  816054124311784415 ,  763399479141531066 ,  1948573751986160199 ,  149392126479942340 ,  885185000013640620 ,  1368111921966811750 ,  861254423239730019 ,  874882548843622776 ,  281650394483296724 ,  1052935820745444040 ,  674946421969369882 ,  1246045775556316058 ,  409444991398409526 ,  322045539239911959 ,  1788373528161929463 ,  568047143945979198 ,  1635719141800154451 ,  62127588764992055 ,  1220355675810153890 ,  1311181416219351889 ,  2305369424336986604 ,  2037012414664635007 ,  1954208763240045359 ,  311376928039786149 ,  115898838334011648 ,  975625789943644122 ,  33043193484219375 ,  1411189644997365892 ,  1486872910361552259 ,  1749747474332262606 ,  15406176822574677 ,  245953075227962327 }, // x^2^615
+
+{ 1168019712086361024 ,  1483264307997541286 ,  1701340994905296117 ,  1851329215276275090 ,  537655535637652859 ,  287896504049591986 ,  2010298513970409260 ,  885713585850792496 ,  2107642407617275767 ,  638403712008486687 ,  1607002884630153145 ,  473264271055821053 ,  1131508640650741774 ,  783872082572486243 ,  319178473958246711 ,  715540739929322926 ,  1545508109088892894 ,  35744744319909955 ,  1053851579381881580 ,  2131059817694520212 ,  1127805494421922211 ,  1131070904678446199 ,  66769745719011708 ,  2285352577127554230 ,  1187749253106766040 ,  1670895915684357837 ,  944395868421962222 ,  2099527232343580832 ,  2095168293143758907 ,  532885118503540152 ,  2075185023025982532 ,  802571534079904345 ,  1032617171457001576 ,  101937705395677329 ,  1338519758034779356 ,  218920840169683657 ,  1764288911366168642 ,  2110012916283523947 ,  393012071747902873 ,  1076454274996298542 ,  171092759555628549 ,  1046455316688855527 ,  1376107409132296486 ,  1559603193415351817 ,  1200775974363711141 ,  1990778026409586171 ,  1505233774313835109 ,  725066578047886273 ,  296066133895767494 ,  863934845124783305 ,  1721380687965605617 ,  588966758804186043 ,  313868901521261938 ,  2066697742412157766 ,  698649565687579041 ,  2164180907175595919 ,  1600320749454452116 ,  2207976494237328848 ,  1337477719638344939 ,  724466421124502175 ,  1364216803734951942 ,  1192720410877828096 ,  1108823102786871630 ,  1778372417576509417 ,  772417997606612630 ,  1803363032867686864 ,  1678022052257102890 ,  405491184220443195 ,  2023046133106406867 ,  2139593527275869659 ,  455887462623806650 ,  2007786523706822807 ,  392838050033820301 ,  1475503836770023640 ,  2054182618009511132 ,  294846126472421483 ,  629115960643998495 ,  471614951334579715 ,  1068478339594235326 ,  1615599279817130911 ,  2060370434009369441 ,  397815524454479695 ,  2008455424246009372 ,  1152058076241698014 ,  849416450582704030 ,  778132736446385354 ,  1750742156640222197 ,  1529982651467353992 ,  1587644793275604286 ,  1987494418706450735 ,  1941282031758308142 ,  2191122872959382610 ,  1581430725112281069 ,  1233127444192210680 ,  716540592412760245 ,  263545942726752044 ,  942230035257910117 ,  1220121583374022328 ,  1297362431803853635 ,  901978215666373473 ,  1562523676538997060 ,  925367293920043556 ,  1838183688233383565 ,  317454837657523951 ,  1133878947760919338 ,  2230272607193680116 ,  943327059703468215 ,  875294124079910651 ,  1250153709167654329 ,  1324248538060682602 ,  879764047605938671 ,  1818115101927506644 ,  2163496110596021556 ,  908676769497962736 ,  1630262926512934734 ,  558488725964765029 ,  910771019274453897 ,  2266018370586267256 ,  1495423148242962459 ,  2283578834856774313 }, // x^2^616
+
+{ 2074852140962891080 ,  796844484700209188 ,  1676001187826591960 ,  1247329587147284116 ,  2214114982942812726 ,  1903644553435855374 ,  678478049721068984 ,  1467568448130053181 ,  1668301307169885262 ,  1872528877347501102 ,  1949329216307581420 ,  1852909039738096762 ,  40445469311258170 ,  1064427158587098127 ,  616736737472650387 ,  140243084184542405 ,  2096581852974145630 ,  1207554598808986032 ,  125871029471320615 ,  116892273628465113 ,  1213593168879692947 ,  553721677956712446 ,  1626919699803085345 ,  2149677457887404824 ,  909599419152278866 ,  714458753228227148 ,  1465320912540982207 ,  2190778984774659769 ,  1381239637019302412 ,  1710058911832538967 ,  163403526150959009 ,  100543522971844035 ,  970780512135863496 ,  1700170972669042679 ,  1072335531444196889 ,  2011901896500077199 ,  1282353959409582146 ,  1561870512462645033 ,  2135462980661590092 ,  89527638389357045 ,  1279465500207234116 ,  273123931531464872 ,  942222758145958601 ,  849140066914862019 ,  1981395994350796870 ,  674745273977287983 ,  1007669060054347500 ,  2225942140846568744 ,  1289896744665194757 ,  29337709588002421 ,  1226043016568468966 ,  1545567779604181861 ,  1842255919046551019 ,  1968651140662239756 ,  764363882554073637 ,  667723371436145499 ,  675910574708206836 ,  228422674120086316 ,  1866657135097115931 ,  1566402176494943931 ,  798346014098535762 ,  1453550355962283619 ,  612341521298534236 ,  470848025794252181 ,  10595949719692311 ,  1655065131287838561 ,  262827372028567370 ,  1656561938361125833 ,  774102685508974704 ,  727483952104339017 ,  742911955549119435 ,  682185608375945553 ,  1398182166729488878 ,  1126047912098362757 ,  1686103840088467611 ,  1974776263613412163 ,  1031568831119046227 ,  286414460146410598 ,  1289380694872809720 ,  976892675643378389 ,  60228850637436234 ,  927121296370004024 ,  1360528734026169508 ,  1504422401799117621 ,  227497209720642450 ,  1986067597108318856 ,  1294939784971601219 ,  656190771266727386 ,  493416417378191499 ,  1118996476906777627 ,  2219731154068210526 ,  342286444323612600 ,  1864292811330558033 ,  1047526464624075951 ,  931872871509480459 ,  285824921889886182 ,  779303794871101153 ,  1259312374047000818 ,  1787947882108754906 ,  90599227749926223 ,  226104850595887140 ,  569722150840246256 ,  2132246009946961438 ,  2136593557041431327 ,  1386053737747386320 ,  66405787116676396 ,  641452859012857402 ,  2022867612604133233 ,  364970338557279262 ,  263976482167844102 ,  1454349808642021507 ,  702126103456063650 ,  1054796713325263019 ,  1889061466818669311 ,  732537608475479618 ,  1856042221015577578 ,  416442817346007645 ,  1565373758000507087 ,  1427186677335105223 ,  1927481626953069533 }, // x^2^617
+
+{ 498088736149516219 ,  955151088033613725 ,  60231211392013370 ,  752700008773469237 ,  9885832754700867 ,  761864237294200971 ,  1362198558941407757 ,  893707101673572769 ,  1137475954827918589 ,  2208871547173755390 ,  570897351361425928 ,  530864896697732362 ,  946130413981799701 ,  1188483268943307077 ,  261735002018163812 ,  797008977203363252 ,  81130206193431472 ,  1268666488725073708 ,  2241788342223013124 ,  80905879639516424 ,  1331178353811529076 ,  315705678073463015 ,  736034202875521384 ,  1093126307257184421 ,  1529049629721463601 ,  1733313413049797266 ,  1554610769001879631 ,  2185181918763772180 ,  179133427458231778 ,  968873900224912312 ,  207355792763461135 ,  1749589638311272974 ,  1635208257501715713 ,  1756036718058277732 ,  780441483161047326 ,  1098063343646082915 ,  1430190134635015727 ,  1585793362682938952 ,  2218746062596981902 ,  1721363676321696733 ,  1414259217530402157 ,  266538666440503902 ,  1539493164324940047 ,  1043074553957249033 ,  1149605679724388549 ,  16233829459978524 ,  171095589739883552 ,  1679605456509552849 ,  1237615309345047383 ,  2173375828245497511 ,  1507177380368705754 ,  1968640183467983632 ,  1480550009433311540 ,  862227590446124380 ,  2094975160102439927 ,  292300073356361408 ,  765127611613154318 ,  484405797102776181 ,  960440285102010060 ,  365473001917653166 ,  1089993833720861717 ,  1722254672635848289 ,  253269024774782417 ,  1560801378391643959 ,  1530060820888182282 ,  2256362883591250640 ,  806167597681320011 ,  673650919313806438 ,  652650590066477332 ,  1192013281884295072 ,  2300596484769110703 ,  585285459240189765 ,  1232559239275733338 ,  1462462952400773035 ,  1989467021854569910 ,  22567159477435051 ,  2142271242238262937 ,  1739959312420558125 ,  1865919840873841837 ,  1227743638477030313 ,  100326351208177426 ,  1275109699839848046 ,  1284263870699759181 ,  2192718336755103827 ,  590483915343919004 ,  2196369249140215741 ,  1672123175439262585 ,  1946786758449803410 ,  67091640987497303 ,  1490356651671143658 ,  1828020905284898566 ,  300318150389567058 ,  496733707169246824 ,  439771305515893085 ,  1603192046466396563 ,  1632920414695253858 ,  1545600409855126214 ,  1232905340408128324 ,  1517859061736625227 ,  2175171927039664087 ,  1296078951136878212 ,  1134923691666302274 ,  792168745574603962 ,  1687423269889655916 ,  2246391924486885942 ,  2225195367424475898 ,  1259469474784592093 ,  405457702715000676 ,  28804068884913505 ,  120519331695514035 ,  2017326974618383682 ,  1623680145847724224 ,  1426923802026761479 ,  2043890923617650951 ,  995666665582021629 ,  1032922251708667650 ,  1901273054920230032 ,  2099271815193234276 ,  1118571081762261918 ,  678430059921768615 }, // x^2^618
+
+{ 555395380106676088 ,  988341097844098449 ,  1529510098289177114 ,  1516589659723832603 ,  331828453920219738 ,  1273872695881385493 ,  641073442899170600 ,  538876398618871675 ,  691179934413978680 ,  769523173917474897 ,  899809327569786009 ,  329475964121611521 ,  1225088819154375533 ,  75310354659066481 ,  367441243753195280 ,  504545013336469723 ,  386011477891970498 ,  1855271521554655534 ,  872310453527635635 ,  624846606391100798 ,  676381584152575579 ,  2222439619106420849 ,  1446595003447970137 ,  1146631149298298327 ,  695231622606564842 ,  460194607037329394 ,  592853581576426294 ,  966124122884682465 ,  2010597109953800862 ,  992927334876763282 ,  2219490724808545218 ,  789172282571410383 ,  2057160356952205483 ,  1326108387760407946 ,  72461009611116421 ,  830998564241628615 ,  1962568265868185756 ,  1078447181471172791 ,  660239179500757558 ,  2101834005425924541 ,  1958106978996656840 ,  1262363408824876581 ,  1273482062832712475 ,  372535642882691817 ,  1700091669805211978 ,  2004970180832354442 ,  1141770684452583484 ,  877883817224423669 ,  1150942069529707715 ,  930307311761007691 ,  1621209506390558578 ,  435582851768811399 ,  2242927061996098914 ,  2265468315327262844 ,  1152578015291824656 ,  84567971515292078 ,  1883278215275435252 ,  384363222082484780 ,  647562004193020991 ,  1400034155035678090 ,  979079311384374176 ,  7236687226807426 ,  265842740785966885 ,  152204048142207282 ,  1972672622848484669 ,  1294829109590435683 ,  1954083559645053500 ,  1976375124178445740 ,  1061305012500096789 ,  282477787774484545 ,  1549409255739384835 ,  1074748152769524472 ,  2072430932090991607 ,  947354418328427166 ,  594281256776795659 ,  1153442448697414353 ,  1728118934607641283 ,  467299059559524595 ,  1619140064615878950 ,  146329051578836675 ,  397221887494534488 ,  1260624229375382906 ,  866167989087575865 ,  2149763254031331815 ,  563410230940502938 ,  713271165611889406 ,  1651262537643321712 ,  1167261908822948786 ,  740356544867191327 ,  1505273636719103378 ,  1880769410653179773 ,  131871196304759765 ,  3873051832823364 ,  9418569358738063 ,  1018534830264084020 ,  1511417689217049863 ,  392854680928253712 ,  1448410687868821277 ,  632273159705406887 ,  447321887800834326 ,  1559037349838758749 ,  1955299732484552756 ,  724838377719168561 ,  1266230768920486891 ,  491501111793383419 ,  313094688293726282 ,  2155207552826575063 ,  2061783430141775052 ,  1158892918095342665 ,  821195713444005507 ,  1554490358034369746 ,  2271132193509706011 ,  712017758170424573 ,  793163009850712858 ,  1415654769964218265 ,  1230740635176892605 ,  2244771376579097277 ,  422540015097583659 ,  1188594506281957006 ,  1766816477124794111 }, // x^2^619
+
+{ 108686534669603310 ,  934571959505154983 ,  334745479667227852 ,  1681157729727802996 ,  482507411065641646 ,  1099765905124412050 ,  1301497276074436021 ,  1024233969792564204 ,  415176690733579006 ,  1476100419215449107 ,  1539982634295386729 ,  1662032568298791692 ,  1262533533116037261 ,  1034919036001385406 ,  264860075741493344 ,  1527102410460331661 ,  1088989307963338614 ,  2144503195659433038 ,  13765830588771881 ,  540451160247758533 ,  1282245579013660771 ,  2178078034144308773 ,  63998895018007455 ,  1978555932687479216 ,  1246660595004776698 ,  123197464412264178 ,  239557035981582974 ,  816576911877157436 ,  913373526169533305 ,  90126098489230070 ,  165597967808707695 ,  519197775746340925 ,  178177188445751329 ,  378585983491868681 ,  2260711741698296246 ,  1238070791462361657 ,  1189206357007915998 ,  627146529179116025 ,  2053650677997031760 ,  1742489724908924376 ,  1666054469809380925 ,  753325334528141802 ,  100984082300253288 ,  229248913460216099 ,  676903943731097061 ,  1774154652627743208 ,  101145455291438210 ,  1819710810873687036 ,  2305450823235017955 ,  436507373117802610 ,  327224699774540936 ,  1762617196050595445 ,  1827462821481140277 ,  1096979671147083258 ,  1131660714641334516 ,  1182417407103187960 ,  2018573023809197244 ,  94431027371299213 ,  1781910615930139885 ,  1005653476420951601 ,  481209740239885654 ,  301827401874920653 ,  942379068754105961 ,  1619327912325725010 ,  2274624983984282709 ,  536988971085050093 ,  247029658191653096 ,  1747640428522146747 ,  2182722395508812403 ,  687333370561167866 ,  172374521632298204 ,  697424543560449711 ,  115858283290070392 ,  1679159444816807299 ,  1095858112428463589 ,  217039605328741967 ,  1323576668153140103 ,  187979634877306181 ,  452877942083152481 ,  934788985580028901 ,  1649648373170308858 ,  338918492325001227 ,  916168273979291139 ,  531144983735859276 ,  1609931095263057681 ,  1610187643468197584 ,  1715086571006465417 ,  1522338533645823613 ,  1392188525757006798 ,  2097833201829572458 ,  1441663958907189837 ,  256160999599978753 ,  1844662277284113012 ,  1054789534210999924 ,  1226446007455453126 ,  203280868392690539 ,  2096626155573836278 ,  1464489784315477665 ,  270052909766547569 ,  1620557818099774063 ,  2094942892754483719 ,  330610336511602314 ,  1560252336028514262 ,  151811131846137217 ,  2153697682196273322 ,  197650046953920101 ,  971546839230901277 ,  2256192693942542405 ,  1348636735498251 ,  2273678638899027931 ,  1997210978820861162 ,  830096028851179412 ,  1946003605247880715 ,  1467463225378767209 ,  530248906827859437 ,  2131469482039443851 ,  1856185971742711704 ,  1793886537343893626 ,  1080334554031885176 ,  2180969722550202665 }, // x^2^620
+
+{ 702774601667153825 ,  1101541606117007461 ,  2206884978559947264 ,  1286460022671835105 ,  15914727712394364 ,  1034231961333106730 ,  2091065482082404305 ,  2272339654356772226 ,  52432897497411230 ,  1592530468598824652 ,  1518424789040686303 ,  1406255078038495527 ,  1228607455528028388 ,  1187876334986244854 ,  845893960415599375 ,  94413215004991813 ,  1912563235320900835 ,  520061376110534252 ,  642839700309842442 ,  1595604984761739904 ,  1191376909151550895 ,  147762299600839731 ,  1486438138677086280 ,  1896795669356747174 ,  592322234789774438 ,  1836558786126701644 ,  50813506756337254 ,  1984921227875575827 ,  2152414453862209446 ,  1115825408081360511 ,  53402041477781122 ,  1145654409795262210 ,  2118418804113462021 ,  1254855559052888291 ,  1899029501338063981 ,  1636268234751573984 ,  1147939137767637995 ,  1640232539986930871 ,  1582476073053328582 ,  757419107925477990 ,  1030768290499345081 ,  2255640534903046107 ,  355398442415464297 ,  1724953677835837339 ,  1852104133131816013 ,  1115712383551218680 ,  1690014523637484592 ,  160054158075497324 ,  2238524909221535678 ,  360939599878467827 ,  881398063884736779 ,  1000371821102770903 ,  1592855022939142894 ,  1416652156152137162 ,  1588367383607880352 ,  2081458210569978510 ,  1099271837717263577 ,  1704705512313411221 ,  1006617950171886968 ,  2082179510236793429 ,  2245399548416867042 ,  1002750766583303368 ,  1663837868085919842 ,  1682993234469953867 ,  1059946695695384688 ,  1014190409633777902 ,  57692064802398755 ,  123430398381031249 ,  511246978629656785 ,  600163708562342819 ,  1183507936825529388 ,  2268633157280051353 ,  750919766526046787 ,  2204383186769876839 ,  123348122773610054 ,  751062580035939579 ,  1010384405027573565 ,  214838231054297137 ,  84697312546365851 ,  1032184706370803255 ,  369320761562622456 ,  708464195419059337 ,  2088333745775947875 ,  2240337818968033337 ,  2042545569169621878 ,  1507495278268786039 ,  619394467366129863 ,  627543281837934026 ,  2221180738191040943 ,  602303969263834028 ,  1119589753119158616 ,  815439155070950362 ,  341453474584439224 ,  1769533881803560837 ,  1724138770194747144 ,  699819951470641434 ,  1790377181826556441 ,  1046059410940254672 ,  1689797847411845933 ,  1857700748506772556 ,  2181337917209550521 ,  261350408933463959 ,  1497699584163826633 ,  1594624552037353364 ,  639072404377088174 ,  605136364645039627 ,  712542044955813912 ,  591341577606984808 ,  2063710150702595234 ,  915037468185363402 ,  980804947970953324 ,  986877057555417435 ,  1022514359876466027 ,  437701400675382535 ,  875371313648567903 ,  280000172576583450 ,  2151237045009200106 ,  290300294067994053 ,  1513739282369205359 ,  972021669765904857 }, // x^2^621
+
+{ 2151024243879768967 ,  647955885058234469 ,  1905644654410534766 ,  1174445450416771840 ,  1858847846927017687 ,  586485024995178042 ,  1876340557510351240 ,  2282865339057166626 ,  364536723828582318 ,  2115034882028840938 ,  2109747376822236166 ,  593956990825971781 ,  1399578491322523493 ,  1081274802529369741 ,  623199865886295649 ,  2070844690829473927 ,  226518995941787730 ,  437761446229291299 ,  1323814185832021399 ,  418657842636445729 ,  430988646089673863 ,  1967711956652628153 ,  897307986251285813 ,  1072388421362471349 ,  964861889641564237 ,  760565930688378356 ,  755007769434551545 ,  1215765895043232219 ,  1895059614113191145 ,  1400676956925226087 ,  2114704561131006421 ,  1783025453056843641 ,  2022380486805510202 ,  1666419473108543919 ,  594487168552624254 ,  1017695714968816054 ,  1466808933992186488 ,  1056090625689839313 ,  1591793397852817263 ,  422983981806087307 ,  2135292471088226371 ,  827127269650080350 ,  621721375645714097 ,  130371965150988916 ,  799689730304630673 ,  421122079637150851 ,  1154846652683587740 ,  24959052140846482 ,  302278272708098210 ,  1981678902326548174 ,  2261769853306770897 ,  538990767568178653 ,  1637799276453901204 ,  1150100367016320136 ,  987789130135412536 ,  908238804609895131 ,  1179676492219742705 ,  91335176000069918 ,  1189308190634477612 ,  1937830568608597239 ,  820793680469419075 ,  943571148480197584 ,  1884314041048979583 ,  2109826957450381546 ,  379536032409236099 ,  685919586892120896 ,  435198533940860991 ,  1482722506725329411 ,  2003783142228941472 ,  643089639442911811 ,  491088847103297451 ,  2272468738076478541 ,  1941091694173071287 ,  1092514131742755454 ,  353551821822806770 ,  1566997167820145079 ,  1387180989852302684 ,  1726752086756630543 ,  74474067435144307 ,  2040936882984890168 ,  2125330435267848143 ,  971744556352060567 ,  1649646232753252907 ,  8040578193626875 ,  1215166148155211075 ,  1226693856202768463 ,  479400556524349812 ,  492409737327955301 ,  1692424197835635627 ,  1238152782023654264 ,  218001000586599025 ,  2148695234488012435 ,  1764436894811611255 ,  334611075065306998 ,  935610395317688025 ,  1785407523294484219 ,  340879105552557951 ,  2127484528549842005 ,  519614936317663021 ,  1995500175860815443 ,  505137947533067531 ,  2260030819503521803 ,  133910012382013298 ,  2183515912982448342 ,  188450336957218100 ,  1699275083466978985 ,  809592816907008783 ,  2278355232762329342 ,  750405121967034814 ,  962192817157418880 ,  643371414961875592 ,  1507061519531330081 ,  2278459663484662132 ,  622352251964059664 ,  501792464768781945 ,  2060624168311533725 ,  409328047226501233 ,  163611750874662658 ,  1121594710370612192 ,  440655132942971495 }, // x^2^622
+
+{ 727334752858822339 ,  839500131396937431 ,  1596920293435172351 ,  2016004325463643853 ,  1169216468380480883 ,  1276390903822621797 ,  1709636235636186645 ,  247839784818489300 ,  356694086264355582 ,  585684031845043825 ,  850849551446428250 ,  1950499628701542143 ,  1725906493621450850 ,  1682901204097382497 ,  1459839094137449618 ,  1009730668048029285 ,  335758580155426805 ,  1855750195819194748 ,  1664963882811030540 ,  1780754754201050871 ,  230904077805416632 ,  281137837288420416 ,  70470110332966459 ,  28990388926779440 ,  772539172056809243 ,  2266481505173690248 ,  1891697131402400494 ,  741177020098557704 ,  408886993532626026 ,  407749424565675460 ,  424178479300918988 ,  409365924349571528 ,  1888800798616830174 ,  608038369597133804 ,  952133245539123519 ,  1513076844829016342 ,  2095573813970881381 ,  632558641989343301 ,  610315025748677798 ,  1117044609414965623 ,  123582966299254750 ,  1049037717472556662 ,  1576455764311739273 ,  375315698173403758 ,  1210790068071031210 ,  1746382245470475058 ,  1959438142271158432 ,  721544504746189772 ,  1492855156722396206 ,  2021204441475385898 ,  1707231527276029668 ,  871597748236720167 ,  2185557721992637765 ,  69979134846170286 ,  1266768901405312526 ,  1695742574969818333 ,  990138871519781809 ,  65510404986020591 ,  278256858070696605 ,  2086384912850661422 ,  126325274959748474 ,  924347451153721782 ,  952263174101201436 ,  435888843707095864 ,  1733876371913347866 ,  1183199396790533604 ,  637131673582721815 ,  1758046154905783103 ,  343347101408007799 ,  2116676676568650752 ,  2252258755942848050 ,  1340537948589711700 ,  1983396267739320801 ,  793322498093005385 ,  1705728266082114174 ,  1949665698969285753 ,  1171514434419042123 ,  1318429098222003207 ,  1696177339303353598 ,  1356256830368427894 ,  44346718836652788 ,  179944655709524651 ,  1441348613985992410 ,  463141472450212651 ,  918702986224546460 ,  1968168171802484142 ,  13596185124313868 ,  1291278063959507932 ,  1149275307848001239 ,  231950962537309950 ,  57834800796867385 ,  2244037515972677031 ,  401641246100749234 ,  2099038352034244025 ,  1390987814996516964 ,  1113182878469757491 ,  1218460263491234076 ,  1532105290022263255 ,  379240948458165603 ,  2073275980021124755 ,  1791809148138187242 ,  2271162692285573400 ,  1843648102761257145 ,  1292334478885226478 ,  861023893925328883 ,  2003030733628355165 ,  380510923189928154 ,  578697877939004259 ,  1899330919677194765 ,  1902049862980492081 ,  1898037827556395459 ,  881483686514108632 ,  1939491741539222110 ,  1904014905071753264 ,  558570869623504458 ,  1029155214665476496 ,  1699573038856053307 ,  521085901971392300 ,  1943358045986119826 ,  327685619408939233 }, // x^2^623
+
+{ 1424703174217809413 ,  679168160827934748 ,  2187246305673347928 ,  1588894737137740584 ,  141591146284066590 ,  1370136380247311542 ,  49030372007875367 ,  1883086679008991252 ,  1032593979399643014 ,  562122226169004089 ,  401736548025985681 ,  50674008185732585 ,  218808899422897823 ,  1987495000250452426 ,  534964960724746626 ,  691061595933592611 ,  347110764768000806 ,  1631752432214071651 ,  1156855011447460073 ,  1630399503178289531 ,  1816365652317471040 ,  1954239637553655348 ,  1859273787450286390 ,  1552163106131166190 ,  1049263315782239279 ,  1057695840620124378 ,  1476432232150261485 ,  1586649782721775561 ,  1184209847002335534 ,  2200428413741056170 ,  986960885689279003 ,  1476128386448972184 ,  1375601475285473949 ,  345253502276703965 ,  1461882673239501263 ,  2142312706255137013 ,  29837814296277833 ,  219517583745989051 ,  2217580540964039801 ,  427628448403313113 ,  1003294124119594492 ,  779950401934890395 ,  2051022240464210961 ,  1551416607061236746 ,  84698545059888484 ,  330882938351306377 ,  1615309365800773711 ,  1019136404110885510 ,  1544674669474522096 ,  1574569511506257705 ,  274586206913285602 ,  955345567585901408 ,  2260965472642784917 ,  1119091676952280513 ,  780723035057895671 ,  930285644910944816 ,  874986374627693261 ,  1594821453571590836 ,  262325352686440533 ,  53272275112274095 ,  787150942005366264 ,  2063267413339235290 ,  817866092265835475 ,  1730587572435101669 ,  1252245633548439217 ,  297400571178511101 ,  1934987124902501259 ,  1813739083269594449 ,  1088883954809785940 ,  2036026141992832623 ,  1723598235283673534 ,  769894379629638794 ,  934569721860816351 ,  46768998705884089 ,  1223027180613838246 ,  402134019047474614 ,  1406484422223480773 ,  1010263206200292 ,  1814310902908446427 ,  1284804595273833562 ,  1733182508937890225 ,  1434581670224172042 ,  1729990785747854765 ,  106725038562084159 ,  328854827045710981 ,  1827204648209588711 ,  1632091949405488810 ,  1231051401234594699 ,  576117296046750037 ,  1231723649372540830 ,  323085303649508954 ,  540921748386464065 ,  2279988437787583577 ,  1558277640825824561 ,  1935876582771082030 ,  792434202298313991 ,  493546046582815888 ,  1976132712764724073 ,  2001401431187726426 ,  1191680781797736968 ,  2137413451026629731 ,  1252541615256657826 ,  1770428269462598214 ,  1875717334181981474 ,  330537455175414560 ,  1759930538459286212 ,  662127422793186037 ,  757189830097338120 ,  2127637895011011579 ,  1032182749006407867 ,  145369437681037400 ,  2203030738405352473 ,  1718049630571699474 ,  69777904842936880 ,  65881570362523058 ,  1756299043789937778 ,  208737413821291476 ,  2168696925548753559 ,  786953632563859913 ,  1156423126835698150 }, // x^2^624
+
+{ 662603720170190948 ,  844799366712207946 ,  1589639519252678464 ,  1705572344106393403 ,  2204267374716527760 ,  1234032223547238281 ,  1712934362945485955 ,  225427625711416018 ,  1626338722608432664 ,  20566486049316542 ,  2200757571946952198 ,  252893505291166657 ,  468870338554810324 ,  2082645816919119433 ,  2098062688805116489 ,  1546601674439846632 ,  1517262657237592499 ,  1311927891125050411 ,  1420736075126813261 ,  507607569223297522 ,  1086187149897782900 ,  1844786987358594706 ,  1213418564673361596 ,  1704379596631390438 ,  743336790672070274 ,  1005031135974825008 ,  1070034723623108279 ,  663483894000264070 ,  494520938742242941 ,  1808644606401882968 ,  789179961584896533 ,  802633720918950098 ,  46141438252377117 ,  1296995219585729466 ,  353309222557559868 ,  1527707850091998398 ,  1729418965454472750 ,  1254356460585839664 ,  38162967643139459 ,  827658595891279432 ,  1367661254434490864 ,  1475781237599147949 ,  1214211154176232818 ,  1301013182659354899 ,  930679419689281373 ,  469299359735422848 ,  1470065369738059195 ,  1960464915854492691 ,  23806068118948432 ,  1196703755726802435 ,  540658498287893931 ,  2254792089053096003 ,  305326552817307688 ,  907726511811614158 ,  730343551342604128 ,  293952376721904621 ,  927232721391850984 ,  595893826498978815 ,  11812108946125794 ,  2201970123519054518 ,  1499381767109034174 ,  949873261224249239 ,  644298104006675815 ,  174513260854469044 ,  1637585747965467980 ,  969555991337392831 ,  1395947377821201406 ,  1036753991042840722 ,  339320436378315814 ,  2185955977447705637 ,  828603271661480055 ,  215108225984182017 ,  1326320552023591056 ,  1228566842649929127 ,  648395284839422753 ,  2292691786705576689 ,  84237599148613156 ,  1785676458521169974 ,  1564681598848852244 ,  2115058557928314081 ,  1247699080164577359 ,  325642813724493620 ,  1874986368664640233 ,  559234828686518832 ,  1774521457613171670 ,  599521762646697571 ,  1187717178482854743 ,  2067415010348538477 ,  186022893444047792 ,  1824413920902390762 ,  952785836094067038 ,  171959182959643882 ,  1372773582177886837 ,  1162637302663335312 ,  811425857105430479 ,  773952140961510301 ,  2055098272454819504 ,  706129743024951953 ,  2152145441386831562 ,  2169213224325093786 ,  138030859096476594 ,  1346324639801791595 ,  277714344850592193 ,  821820431430373373 ,  1037589196361542770 ,  1586556814632509978 ,  1420209144703963551 ,  1241746064320593362 ,  1546047425321261675 ,  1328484359609178489 ,  1906305372731114407 ,  1739446326950654361 ,  633647367151008555 ,  1922717343825330911 ,  259477188687456306 ,  513256778256538904 ,  977941891671796276 ,  734588432388521144 ,  1605168068471686809 ,  824572079416084751 }, // x^2^625
+
+{ 1210968457871111581 ,  1526223548351087279 ,  1298236777296454628 ,  2184992262414444364 ,  234315735336963268 ,  1962958027585982256 ,  1267459487919812548 ,  637542039330284512 ,  1273235228801989205 ,  1407193931489188926 ,  876788302220379503 ,  150423616111846431 ,  950098269040132662 ,  67284437392675241 ,  1660855635630020754 ,  1429328025475748079 ,  1614907700542543166 ,  1842094072400892091 ,  816396773067161716 ,  1140104590154193749 ,  862384013824544405 ,  1735613849576465998 ,  2231071518840073222 ,  1357684973979350668 ,  1753043434724119983 ,  691428341494638216 ,  1970657545262285731 ,  2068549703649083680 ,  1978457872852942708 ,  1035581697261141119 ,  1171347137689338847 ,  731655949179010172 ,  831869806799716753 ,  932843892268061794 ,  1964585787876102806 ,  2252774584036185579 ,  928381624646033642 ,  340981091806879986 ,  1311823020980591095 ,  269061342845264575 ,  2270688548471866089 ,  1251657873345643921 ,  1374629381123091950 ,  753347133452938302 ,  32611315043173401 ,  388833430954529349 ,  1868192260603160386 ,  709323606101315630 ,  1827839826338014767 ,  1877031871711770978 ,  769474267900198313 ,  2037970404759931160 ,  1007608472270543981 ,  2276691175029474564 ,  1959753493182546693 ,  171645142688219447 ,  983374730371178941 ,  1502829021749754900 ,  1968201442596133991 ,  1509224880374276675 ,  1242531333431929008 ,  1882368515425484998 ,  699572338352106687 ,  2202015399846885312 ,  1820947332135825231 ,  2302730845830577462 ,  1359415016314121922 ,  1675820101734372370 ,  1838898184083501545 ,  2068247220355647600 ,  1812377890966455445 ,  1308435388624264371 ,  1587207851228210719 ,  784997181821083335 ,  967135976133716110 ,  557965600613040063 ,  2091260389304371168 ,  1745622370614776164 ,  1266707189032742714 ,  407675855436472240 ,  302533262109820023 ,  2042857182280767362 ,  1043624942986775759 ,  1061983076896807933 ,  2070994672482929183 ,  440918208637339206 ,  832914639486809492 ,  2236460293472088798 ,  99662272231184761 ,  1953354261211517478 ,  1053371602485466211 ,  2227673428135931138 ,  872160457904744623 ,  1806282456821423646 ,  1088647500932087674 ,  2236680947233055618 ,  1286859413952428336 ,  279428784159659103 ,  459636811420827649 ,  1713694733284138508 ,  2186973813665735083 ,  1379206234483993877 ,  529833909198821121 ,  1243602177337102652 ,  2120796535510513186 ,  1114979663930740471 ,  1879167409922857743 ,  2141850433211153061 ,  941957769215475901 ,  1740305177881493908 ,  1293233393557942135 ,  844721998915477443 ,  340807878162379187 ,  319414614536103352 ,  1884962291759624713 ,  1567797035356140362 ,  438105850248905205 ,  2291985193684831677 ,  2225600374946692225 ,  90778373803968454 }, // x^2^626
+
+{ 901954633329764024 ,  905599330818538892 ,  1201090890001081986 ,  634313211460159615 ,  1731997654169560754 ,  689792646607326750 ,  1991607251854124758 ,  1469682076266803216 ,  1764002714984346033 ,  71632640609316723 ,  787652311255891995 ,  1488643779212563836 ,  725867841785203123 ,  1926181728682119998 ,  1037586039884648351 ,  495326039989207984 ,  130155491333926877 ,  772235191415757493 ,  310831147969263147 ,  1443348336521911876 ,  1534805479269542601 ,  301553593198983642 ,  416893729390487727 ,  464049122153769037 ,  1818968882514487382 ,  1727499340123836115 ,  1028237113909801684 ,  658495427762245448 ,  1763088553118649029 ,  773567936712103792 ,  2108412908137085394 ,  1556465296819443457 ,  586066231320810258 ,  1063283487785312066 ,  1763162099435705246 ,  917527761580817470 ,  411138001468657918 ,  1998391049845260378 ,  1222515925097198247 ,  2124868201246630516 ,  338876396913882201 ,  432535811890153814 ,  255526391648913571 ,  528861956035138080 ,  701664559793780477 ,  936441212403336262 ,  2146673713669937640 ,  79518489583712948 ,  1141449093675591483 ,  814056581433214177 ,  1204203161103125538 ,  1121763125321644093 ,  1413408382272800692 ,  469170816592212113 ,  256506074016972475 ,  1547488670716995135 ,  1260557201083396352 ,  536726833098207421 ,  1690489033833977441 ,  1289543324350530021 ,  693348684341094997 ,  1149143308346079788 ,  890499608198143566 ,  1880151665354566798 ,  581740339646937557 ,  894124052497323923 ,  2136963331424022637 ,  1919883090895943382 ,  601883431044813637 ,  1459773316735244332 ,  483897001043426146 ,  242493117030663040 ,  739838559923625124 ,  1846922410550852300 ,  1902621822909208247 ,  419783985041265263 ,  1799532736504672759 ,  674699631245567476 ,  2078518416962549266 ,  1067035420175592144 ,  1158610058613372537 ,  1928576368663198836 ,  524181346949122623 ,  685985499047987185 ,  361937278734064181 ,  700341016259244020 ,  49568457376302473 ,  1036496970643845054 ,  1293533509847001094 ,  1753639433694560174 ,  1975950976011878390 ,  1109726577221132436 ,  497508075776174235 ,  1041378811987192036 ,  1097615260891079350 ,  1407622200501849021 ,  1415944739507599280 ,  2287239871947784462 ,  401435105303895110 ,  850539164337031042 ,  670451752154419451 ,  55763053644209273 ,  372860496466184709 ,  2072270581201189953 ,  303549855042374009 ,  383271185568051399 ,  661105406798062399 ,  555483958776201469 ,  1087479973593963041 ,  533631546941069199 ,  2147563476585674097 ,  204012129339820573 ,  479091841388382736 ,  872572342145328397 ,  1012230521604744651 ,  1300961298162509371 ,  655666038597453556 ,  2061453294932363895 ,  488301890761890745 ,  2209583447762310980 }, // x^2^627
+
+{ 2208025825163410029 ,  2263373512022109902 ,  451429905070376451 ,  1832513898184877456 ,  368623404606472056 ,  141038660115327649 ,  1119550582136905536 ,  1833404883324274272 ,  1164704667226424388 ,  1200224778594407202 ,  1804009909770035067 ,  1654910336776593404 ,  940217453795742317 ,  392986721659771890 ,  2252563496330581922 ,  2064603632986767466 ,  1404763164346968828 ,  1640822191371102010 ,  34143601171966641 ,  1595089897764907942 ,  2288853000245320315 ,  625802017476820131 ,  1321151930628822447 ,  1569152244284048786 ,  465284413311646937 ,  972416631052333582 ,  1817364917484745987 ,  11265573400524437 ,  185409616050081355 ,  518981355230046851 ,  2132285732189500630 ,  179187802663890762 ,  1044933124056080470 ,  783758290705001847 ,  894401502547820054 ,  981303137929133289 ,  1120534593856558974 ,  801308606801911215 ,  1537222810026881826 ,  2120116270541394231 ,  1633829777034804919 ,  65922641511299072 ,  513426757424418222 ,  832935031843109618 ,  1638353902047501698 ,  280882760242773508 ,  1877641175012183586 ,  1587778714788569874 ,  1392544638898316242 ,  325824657871809660 ,  1575885484970233754 ,  55886484021009508 ,  1865933557902181741 ,  1327601712027262710 ,  1780695748488553718 ,  640774561245265916 ,  463352685401470099 ,  636179459964231774 ,  1325563771896950547 ,  1694377580026440058 ,  105977285816651679 ,  1571355594012380459 ,  1871492909712133838 ,  1570667527297334745 ,  648464553425266508 ,  1886365633519041472 ,  802084217318048553 ,  1030539255715442566 ,  974249955258743653 ,  2172002907677182652 ,  404619369703920792 ,  1159453337889959187 ,  1591324464689772030 ,  189383484880058453 ,  1796361230522986653 ,  150095453418635602 ,  937562731251244350 ,  2049627647282211186 ,  2173974202295281029 ,  1498820990009122412 ,  1827068263348783385 ,  267785287135749958 ,  1481068582434089501 ,  2291356609673525813 ,  1187319393111717885 ,  49759570129909419 ,  362339627233802486 ,  1974660407032337153 ,  680108380988198010 ,  1791962524367732756 ,  1135858010212685862 ,  1592802876842165899 ,  1381324938249720638 ,  1146320738022233592 ,  385837395495091535 ,  1998744703905628602 ,  1035258917055801917 ,  1853314990413119838 ,  1853314878419103457 ,  1775775203589805318 ,  363059928990228587 ,  1700189764569499843 ,  800711271753261948 ,  891612061984807901 ,  1841796675572655612 ,  1745878290839632563 ,  1927218267374452886 ,  1490934864814619858 ,  835967909790688943 ,  525694777558398787 ,  138422834635475512 ,  1352140169043629672 ,  526544816611183892 ,  1348721168225233212 ,  167456797980421528 ,  1250528959090903650 ,  1270631817295114153 ,  840834343087133852 ,  647742237652762162 ,  791123107685981004 }, // x^2^628
+
+{ 342747703819612000 ,  245569276447335835 ,  160488276141676061 ,  2139693350897198415 ,  616508432748895977 ,  1322373734402243278 ,  2218944130930344201 ,  1418601445280522210 ,  1775606232463504999 ,  523828418561622220 ,  1577802419347883741 ,  113679539168293007 ,  1294253592621776324 ,  642182174122829869 ,  1955536478563499984 ,  2144008742840797988 ,  266533714403118444 ,  1914970801099553910 ,  1205784714697486157 ,  1214284709476473140 ,  1523499584356938911 ,  225387930236803573 ,  1104120412124801096 ,  560281672164082534 ,  1209015391104373652 ,  2100954236960487820 ,  2025893868548204827 ,  877345627536553874 ,  1442381409667908262 ,  45933709578331693 ,  901243597736751167 ,  681086951454870524 ,  1931836509136404204 ,  1074036893824057023 ,  1910099353685426121 ,  978932453970981779 ,  892575088241445496 ,  1821476452744891744 ,  878324875455318461 ,  637950387566939940 ,  255825938868610684 ,  20681386286760499 ,  1144296321299288256 ,  1671510044615772026 ,  420957902204905704 ,  2016274476122002407 ,  1667023774497124461 ,  2004520509423529707 ,  1278694823829526155 ,  2234519640374347584 ,  261529788955564520 ,  1013349531006748914 ,  1189256720892834849 ,  326003562253839816 ,  1379258376295892896 ,  1089012447440814901 ,  6810868527037348 ,  1806108323711156153 ,  2112386135837186385 ,  1846951466302321023 ,  731353494431477108 ,  340033646126032992 ,  301557327714389659 ,  210973446465814339 ,  357985946049672641 ,  1031821551801082974 ,  886960483623411286 ,  597222758993467586 ,  1483106240853600900 ,  580647949474436242 ,  1282289881705801245 ,  2126205877073721519 ,  290826562450349591 ,  922189652283458239 ,  592946159607552208 ,  2268355212587196656 ,  2264539592099254614 ,  992695536092660039 ,  971523754131129809 ,  1215769166297952461 ,  757763556358239202 ,  704629117102605853 ,  1886786076300751152 ,  670382550748437289 ,  1208165944094760114 ,  605107126412953782 ,  1312190305433546871 ,  1764732346824954950 ,  578001764004473068 ,  239034811255984295 ,  1433124573050066724 ,  773577728344950866 ,  1191261481347515997 ,  625074403382194939 ,  168239905139890340 ,  1265244983715876185 ,  541348050377076547 ,  896149677615429947 ,  981199521760264959 ,  1224306387735290010 ,  114412198318384915 ,  433532555937470424 ,  1125340065728559827 ,  2122153253221291275 ,  1679843976336175585 ,  1514451559362715469 ,  457494899664886246 ,  1399993531276037586 ,  600460277940337457 ,  1765900857156753127 ,  1616167163498639223 ,  221055692467304597 ,  872991012377029590 ,  1616330899864777370 ,  2105141523448415324 ,  1837554670805664838 ,  2284450390004260724 ,  674672013912484912 ,  790245513329787448 ,  601353379128558317 }, // x^2^629
+
+{ 1368448190214880002 ,  789799686949717819 ,  448770118431686712 ,  346176042494585891 ,  946877541881494927 ,  1939718853721062392 ,  666553703489568571 ,  1720008396143789469 ,  878523695031004126 ,  1057434594634267911 ,  1546622162690421938 ,  1341720436232002947 ,  1841160437798886682 ,  2147315440684086424 ,  118501444856572308 ,  2027754444908537015 ,  475449702417479133 ,  252916289352031850 ,  2135953101430064726 ,  351532998597936318 ,  193730866324712203 ,  1879810466029939113 ,  1976997672317917240 ,  2121206843468484554 ,  642467258998797975 ,  274617293702587511 ,  1574513600849406587 ,  1724738181226638095 ,  1563916770797505410 ,  923480474354011903 ,  2094960017845566545 ,  646433466846772619 ,  1843153459926869006 ,  1817736355399549328 ,  2154076528033126732 ,  1899874876709401717 ,  795034612878892545 ,  1498525816716956109 ,  497889068312766173 ,  1674850913546181797 ,  408123364082206646 ,  274347177546628100 ,  1354119614437168486 ,  10902380845204821 ,  499042538181704373 ,  2174769199391207731 ,  1093316011491475022 ,  107923309575189169 ,  1492898285598474665 ,  1558820665382272714 ,  1177055856172656940 ,  1666837462492267004 ,  1996625331944978099 ,  164180487458533340 ,  152369158770675177 ,  1155858192676285103 ,  1087882925676929451 ,  729783096741745304 ,  2175100305637840533 ,  1146569670232249613 ,  936499230999182479 ,  1983233634938723328 ,  1620393177166193931 ,  125251670521483389 ,  712460124704032461 ,  524935257133454529 ,  431712804416171427 ,  640876347832392782 ,  1952021641101913276 ,  1129888510906544649 ,  380826696718250663 ,  642923950326706796 ,  2220348374307115580 ,  1927658484890817648 ,  1818783398440601083 ,  2094897861533997380 ,  2046746516838020147 ,  120864564857093592 ,  1664554505148006163 ,  904604546306084318 ,  554208874940038526 ,  1940293881065077018 ,  134760203376361214 ,  826765864136530499 ,  432667177300526891 ,  146127172093710382 ,  1571224930675880297 ,  21000198353406122 ,  471736842611647430 ,  2280278424235143959 ,  714485192051793470 ,  1363049358337721985 ,  121700809599502560 ,  2008894199231249167 ,  2089030356855525897 ,  2068102025311461295 ,  20901890658116922 ,  1757392252162705741 ,  936449459497681109 ,  1202644136408465938 ,  960514412926805788 ,  1791921781695024550 ,  1163764661094117822 ,  1062445239760468508 ,  85406704447277004 ,  1765941372258501791 ,  1807390614101625472 ,  1717933446740551585 ,  992934474411608302 ,  2104193008245122388 ,  43387546725401135 ,  961235871240927527 ,  554753666404225831 ,  1213708518333026229 ,  1380589505948324303 ,  469910602382341527 ,  1138213305517231425 ,  1344286513812352075 ,  352418465159855318 ,  1380859566184695462 }, // x^2^630
+
+{ 477665117162090821 ,  2221686001475033927 ,  1478773635261532367 ,  911312363021412154 ,  890474527348037496 ,  1444008520531697358 ,  2088014809077906910 ,  1587663570692673703 ,  1464971329363944457 ,  175592496657280219 ,  608751036787197937 ,  280434045247981320 ,  925018190068799540 ,  638870912406168690 ,  1577377165015813553 ,  350692894461341762 ,  902641517758478114 ,  298755351890862046 ,  2005010172009989507 ,  470998567782456225 ,  1101522444264044588 ,  404469242227039526 ,  2249435698056779633 ,  799484909263548464 ,  1948838903598545124 ,  668306682665140485 ,  1110908159909188453 ,  1744708025833399643 ,  1983914398826032664 ,  1473107878361213777 ,  2105547851541458518 ,  833319087814258072 ,  456535185900577823 ,  843467349491571964 ,  1488176979405759047 ,  2112101970485747521 ,  640779371230204453 ,  1612681241512938687 ,  463979476921955165 ,  388684844906485598 ,  2136881532668506838 ,  466834245819643444 ,  2037517798551340129 ,  97665386729259675 ,  2265729320258028511 ,  681777881911242314 ,  158182811208319000 ,  58878729396163247 ,  1909455599078307526 ,  1398986872700018288 ,  1836451297336424703 ,  2305548106662536789 ,  19334993851573636 ,  239488560695663720 ,  1142207714616635892 ,  2164673918201509240 ,  1398697157308761860 ,  829364024428655269 ,  710330639051285935 ,  1936406563777941930 ,  1365019444073805050 ,  84447802992760865 ,  1379038165812613492 ,  568847767844400716 ,  580242950264426935 ,  1970212954499861218 ,  30058703429323029 ,  1202647865461339058 ,  4650940974955020 ,  2239387984610394960 ,  241045550194824577 ,  1060339407847403494 ,  995520652143866735 ,  162093454394962844 ,  880009926880434374 ,  2215508340174284631 ,  1146690822033422629 ,  2151074331879320638 ,  758978903109739125 ,  287141294507346811 ,  1432645802724538171 ,  1507693940913247394 ,  1879372835675019251 ,  1017375069974240018 ,  1405124991277263443 ,  823275240412960644 ,  1742368464632811691 ,  492721176057249418 ,  2284313518038560817 ,  2095643545096545323 ,  1025165657808629810 ,  810066065686974223 ,  2187124334880273714 ,  1998483391921151734 ,  840659753205108 ,  1010103624673712717 ,  114902148370716168 ,  779396016921153979 ,  576387397742253262 ,  266565427148696113 ,  1306575757724767304 ,  510173584475315577 ,  1526176758614926760 ,  598006627279363240 ,  1915979060752360293 ,  2236647296076742192 ,  940147944057392521 ,  1398948066909090568 ,  2168921003048569651 ,  1710358952515230084 ,  1363784550654988849 ,  2113707626609619488 ,  594128940681287094 ,  1054409510534287173 ,  1979060916448679176 ,  992868494573064431 ,  649150244407633154 ,  1096258617732249927 ,  137733652670404491 ,  1235989022912630752 }, // x^2^631
+
+{ 1394685389083230082 ,  1152771025952737656 ,  645666906896220673 ,  1027819537490274169 ,  797791366620476870 ,  2203603192996814552 ,  1369360731027922663 ,  931206076797179744 ,  649680908808116859 ,  633513787693504232 ,  1676056397701855678 ,  1755692099106570624 ,  2141042690159185937 ,  361287108399166073 ,  1972722656275955772 ,  1820085354622570088 ,  559953839812876539 ,  1925272114501295727 ,  1293157218728668072 ,  2179753271436772819 ,  1419542994296314636 ,  28224799711822378 ,  1849931552408798148 ,  1758503577239059851 ,  585006378359685781 ,  1204237216406410596 ,  2078072810405543851 ,  2215004308659418506 ,  991893920344341013 ,  18475089965393695 ,  863776149388498664 ,  1417534587899360527 ,  1157943164334799636 ,  1220386511501001434 ,  1691193494208328421 ,  2060982807901922191 ,  2109370329118026493 ,  866343638931677246 ,  1983403878218853356 ,  1562642076451850759 ,  1408759704906015458 ,  1454713008182529343 ,  1961305898057475140 ,  899840658964544328 ,  673918463534900960 ,  773205586584971619 ,  369262437064777521 ,  1093415770073175624 ,  816975642873623112 ,  1499588138462113418 ,  1969361345540111012 ,  2251202501289966170 ,  527513209165146284 ,  2224713148218997935 ,  956460600633795913 ,  1456947716472413459 ,  1671370524282744866 ,  1546884653535586554 ,  787552546342550745 ,  2237145213964992581 ,  1470745588371068228 ,  1568183338921968505 ,  159248881267877611 ,  1184566333022000972 ,  190594082320655223 ,  1578385003909093791 ,  1303041118621886059 ,  1288557149804892120 ,  613519331504575926 ,  2281842513103440084 ,  1897953394059282419 ,  47245954202689932 ,  1700485649954553202 ,  588885155467756851 ,  66074739562050198 ,  982219670899911300 ,  1797411092610719743 ,  2108414524140764355 ,  1208280518671104253 ,  490116744558170617 ,  1879356815698241437 ,  253262298539510081 ,  2095121887997122331 ,  1669977163556150418 ,  2269449846517817076 ,  2113857439988046987 ,  414576869263349123 ,  177401881681997711 ,  1999230808946671446 ,  966004008453237485 ,  927630713496176513 ,  513453844133458469 ,  1003005489849254454 ,  1051610469579112405 ,  1972516836751355840 ,  2172201488929947461 ,  1513833665370718879 ,  1265190556892062198 ,  1447504208407522144 ,  2151576900714191932 ,  1999666574364276720 ,  1273734877539925631 ,  776546255161528114 ,  1163857834255854705 ,  2122266409876950966 ,  358733761989124764 ,  722028063708249400 ,  1496739395331611099 ,  1959028912201890362 ,  1011620351187400893 ,  420667581945456955 ,  2127310333739779619 ,  2088954258165125118 ,  1483232931143966627 ,  1707492425448310032 ,  407137415873724564 ,  63697555302591966 ,  1163183543495945363 ,  627182850150962632 ,  2192869716175896550 }, // x^2^632
+
+{ 622811539357420317 ,  1258413569168863510 ,  168639341537175655 ,  2266411702694150376 ,  773970102371919137 ,  1688411817487557552 ,  998660798856458516 ,  1299303030446100955 ,  1446117809249525129 ,  363738721747580201 ,  44763338558737255 ,  1319544700697133655 ,  111259482009669621 ,  712270682902545913 ,  1541348340906401387 ,  1460729345624702982 ,  546039704707766536 ,  2001796681343356360 ,  1303359485810518650 ,  415723754822758266 ,  2257116543926342655 ,  1149980341206270169 ,  2232971336089450544 ,  1015934265669753155 ,  1966814394069246362 ,  1958268685331929159 ,  2302073672926867952 ,  1190101729727425235 ,  100868934924790306 ,  1575328854939556950 ,  1314586230334897337 ,  1715133943385743089 ,  723233348756693502 ,  293976306189752239 ,  2171450705958456540 ,  1720775971514293468 ,  1382171730314563427 ,  1638527914623373275 ,  1481134508478891816 ,  1630571127011778592 ,  1568598774672444700 ,  192562283518897789 ,  2134638939893680512 ,  2250608675252193661 ,  86040700312252142 ,  599279628567408213 ,  1697388835133600593 ,  329826879815467387 ,  1475332995536450529 ,  2160754641035986742 ,  572693751120962619 ,  2167783277772240393 ,  232496811785152709 ,  1030948376218357597 ,  1382644441133205936 ,  586072686011894508 ,  1757207803699413741 ,  962994430011883170 ,  2091434056999668399 ,  2200196616413818510 ,  862538846933629674 ,  658355821202297951 ,  2233152337019685080 ,  1847050429215778601 ,  1833871371388884738 ,  916535591102989699 ,  1306891151670469303 ,  2285092451059995972 ,  25510812876365327 ,  2172712617368268886 ,  161239405299176682 ,  1663745631719988858 ,  10141906356101554 ,  631393245716568802 ,  171213469428628465 ,  2053800439119165100 ,  445547334284932651 ,  2117724987430179543 ,  327578118449510080 ,  1075696338217063719 ,  560789968094236596 ,  2097559269498856021 ,  801414605009021283 ,  732210291288037968 ,  1202078026103914749 ,  2056040143043561610 ,  321599503351276643 ,  1019864018654683202 ,  1568733381121776617 ,  528283704124280563 ,  1179960025033003557 ,  2196313302304558101 ,  2179857017472494364 ,  312307638726146198 ,  2302046576224498042 ,  1674425925214770117 ,  1927278981560331131 ,  1198242460950342957 ,  1536832780631254119 ,  102834512918347424 ,  1903144650925755979 ,  1776530555146136189 ,  264162117455043837 ,  2291269443760075 ,  1485143674563565458 ,  1946517207594024518 ,  684966180769280536 ,  957547592938487578 ,  133751147584451262 ,  110663041305137269 ,  715469681893349733 ,  1867362094828256856 ,  707512501494217360 ,  1840368859087558123 ,  1565994618406266397 ,  1261469550308586697 ,  1965290313716685544 ,  1566939107549295774 ,  341743208496371176 ,  986176627023434495 }, // x^2^633
+
+{ 1565550823892975614 ,  765918582973617728 ,  1130095005707930523 ,  67068951509187060 ,  1836404155146590951 ,  1918162879098281171 ,  289182991692928311 ,  1607754671498174386 ,  1453138454156269 ,  1652981565313519585 ,  2236671829708819814 ,  2079409255226948267 ,  371744501430542542 ,  1533731811887145128 ,  1670164106864420561 ,  1674213873826117324 ,  229093619196821305 ,  2010598549249571810 ,  601650992654513488 ,  1185661127272080285 ,  699666146611279699 ,  889999649216911489 ,  691594167790530804 ,  1772748945093018167 ,  716482588208284083 ,  22370103192585795 ,  1323596631398105130 ,  1208927844211819831 ,  566534655924562784 ,  824437092908215219 ,  404067260116018181 ,  1369399941990430466 ,  1971210013998420878 ,  355200825022460087 ,  2291437074108371794 ,  1211182895575128526 ,  458038423706502035 ,  1576252650212207586 ,  842266000801347236 ,  1330752635437409739 ,  1615036303488762449 ,  633890153302172770 ,  1731332597588757480 ,  910979960578203855 ,  1871984126116199748 ,  2290612937378568962 ,  2274374149071174053 ,  2301438954142840542 ,  490876437741486859 ,  1962923667936928777 ,  557820010113571999 ,  1845330922219730783 ,  1834092119091301506 ,  1619531833145531985 ,  1038881387827106176 ,  1967229394546214864 ,  13585103409766533 ,  838583436062601369 ,  1456990392081591047 ,  1822104129775658789 ,  137256235530802318 ,  753150441253356206 ,  1197535533261363224 ,  80833875508420722 ,  1393777405465788065 ,  1197696740749671927 ,  675591885154803086 ,  1828725804445024503 ,  1845672907516567301 ,  728433495058613091 ,  688037608600807147 ,  383378647818381153 ,  93661308032271894 ,  13657368015952346 ,  1796890218515752109 ,  240598710313675933 ,  1008530134680864116 ,  85631017204996986 ,  2267131747853549189 ,  1739142452945536891 ,  1104134324192600727 ,  1986613858719230010 ,  1785565281869406323 ,  1493322268539214448 ,  1285848899816481717 ,  1109501641269709516 ,  975198917451160670 ,  804905648280144611 ,  497446920564422245 ,  137379529028695285 ,  553032624447282548 ,  1613556759204242726 ,  296628519754886570 ,  763347077956741484 ,  1729724509638767947 ,  715186758296788801 ,  317619028681655918 ,  1844672229077283985 ,  1289338788403694169 ,  1389394491507825701 ,  1677756477790725132 ,  1483655654650735969 ,  452759989425329277 ,  749869507675613892 ,  1296348411240839472 ,  478001185973501601 ,  1247779062732756994 ,  952847901742853407 ,  1452318776779935611 ,  889499897429945374 ,  2175052061329773186 ,  267834828928242910 ,  233857208526703173 ,  1605752465038748540 ,  677211057700673512 ,  1923234820903412653 ,  827591625117004621 ,  1139984453186113147 ,  962801305776412648 ,  1016984407236636116 }, // x^2^634
+
+{ 1482626554391655174 ,  457635158364755281 ,  1254558756821888903 ,  495131210922873073 ,  231733772815997097 ,  1101560829390017932 ,  1206365463661273781 ,  1136216929033574742 ,  300905932090932375 ,  1703495896075405167 ,  940438536063139592 ,  150558712038125480 ,  229303655379529755 ,  124198736796126220 ,  568129127287040335 ,  1790217992529801290 ,  1635142882818245963 ,  1891740131790513144 ,  1492564299291503183 ,  1182913892137885078 ,  653810463960624759 ,  1167282876918477462 ,  1209047352744147854 ,  1791306791549043978 ,  712622734899473036 ,  1232156560246965064 ,  897299856736020043 ,  1169232122852548673 ,  1640545609175776418 ,  1406906225063525871 ,  1145923055248161047 ,  1121579383705740603 ,  1388880877507452048 ,  1124339464008741177 ,  1176348966392344099 ,  1228078170704501011 ,  2080566873069894504 ,  1586606687245200931 ,  928113831124904896 ,  1387444586861207576 ,  851835690769955362 ,  1995084957708585539 ,  1136823618521922296 ,  440659816611476193 ,  1492800547700891045 ,  1476009782022135288 ,  1412267757822144015 ,  1027783920970837134 ,  15455869952372247 ,  627654974774702868 ,  1356939990608579217 ,  357909643568514297 ,  1926399920038046862 ,  738485197290901103 ,  1728061461583033446 ,  344059546284892977 ,  1592522133280699194 ,  201960956688692098 ,  1685368680906220029 ,  198164928638093279 ,  359100778485951280 ,  1344763489175984855 ,  350750893930859923 ,  611209960657589588 ,  1531764960649789224 ,  471608868676981147 ,  636682215986332254 ,  1404012910517233021 ,  1918125002468219492 ,  1015529207277936375 ,  120958782449472443 ,  1765890957898390199 ,  33284762216781398 ,  1012555106575611016 ,  1889553079917948713 ,  2286605084311828807 ,  795326275590059411 ,  1141082442398912145 ,  2287513922967946318 ,  1116007397694985553 ,  639796741795366423 ,  1386841038436029079 ,  285330510514340655 ,  2204576298769303225 ,  1437965120042904145 ,  826787349749543923 ,  205321096233025144 ,  1568367482877434869 ,  1921005571288837051 ,  459894319809638642 ,  1861028108458370926 ,  1101543130041340495 ,  1213919774924389096 ,  1673017384327549097 ,  296579044937267379 ,  632671471156039742 ,  157215072681271871 ,  2103518471960393648 ,  988299713649701824 ,  2271418186550867504 ,  75711710423789947 ,  2293335870749821810 ,  746589086822736360 ,  1437896313618800246 ,  1311013160747145351 ,  1283742099659875532 ,  1076453718276163840 ,  2080462587420017638 ,  895078162424606246 ,  2274621125937169706 ,  1277246277481867110 ,  1652471875746767900 ,  26333369271326185 ,  1232436146718995600 ,  577242706451208722 ,  2022216097355004776 ,  1028098301323903872 ,  957521884809426523 ,  1211420137892274675 ,  2133437650134616866 }, // x^2^635
+
+{ 99548584474304095 ,  1601777812667363222 ,  1563149581888982364 ,  1294626096946981602 ,  2261033251118435838 ,  275591938474999404 ,  2211196185293269122 ,  13137923479830893 ,  402166702650857974 ,  1679781084170157357 ,  2038774693560918547 ,  1678597373121979738 ,  425609053796580202 ,  685238937534184339 ,  828012565256973245 ,  1288487238571315720 ,  1697883553778448981 ,  1125646309732570122 ,  649358042234409918 ,  2247498711194719407 ,  327311306989373844 ,  2217074936700762294 ,  1267613661567957871 ,  1792931081491025558 ,  363718820719407257 ,  1275120364008519613 ,  1131465409001599114 ,  1654260183574107194 ,  1704727068711194790 ,  1679622132041768480 ,  1005037047457971011 ,  1248374406360272708 ,  888973986806056061 ,  1496053658126225746 ,  1421420005489244042 ,  1681995999744139273 ,  1571672582292533474 ,  2000068915708820915 ,  2035499640440345381 ,  1475342268067508990 ,  2038173649680310663 ,  975930387865345751 ,  276826413233984390 ,  1860622075866333486 ,  2219261385204054188 ,  573361664507350609 ,  2266366528286896175 ,  1039462122169084232 ,  1777381972782447394 ,  2029703505496885251 ,  212120422753187403 ,  2299946526929138216 ,  1246919760420901044 ,  667857887617148268 ,  1161580384804025899 ,  1299146747049166208 ,  331045559782248069 ,  669265598680079776 ,  2202593669352944554 ,  411274491120487106 ,  1994326500863990538 ,  1145418261975034021 ,  1884328595705765526 ,  1850027955695558249 ,  1682384122482438477 ,  752726641834155475 ,  2175226223582179340 ,  1778028776291617805 ,  2090319924619390308 ,  1604596005351497107 ,  809813364200979619 ,  436496156208527173 ,  291020017867435724 ,  2271562531634457125 ,  1392364836587367079 ,  165416009466991046 ,  471080206078566718 ,  298273263854664333 ,  2034694995320564672 ,  609579136132440699 ,  427571481742855615 ,  1869842365849847453 ,  927323082285290366 ,  1102847614414401219 ,  2011489613137378732 ,  323264391609351189 ,  806688909022168342 ,  401439301033920629 ,  1162758178302596462 ,  1368723326381108106 ,  67584060113093756 ,  1566257122596822572 ,  1245575353857840952 ,  1392073717403098268 ,  2084873692883750752 ,  987106505966517076 ,  2067623395555480851 ,  728078970117323708 ,  1891378879814906395 ,  284691582851915421 ,  1827823205663942689 ,  1220290405000085909 ,  1637221002109458281 ,  504961662667699906 ,  116436517635082794 ,  735332849111701073 ,  392529661903486194 ,  1637242802680486549 ,  1350765817334520348 ,  1570802170707571294 ,  356811213131670908 ,  176162011783489159 ,  1190375019728251412 ,  1386945275885913384 ,  351551613529993570 ,  463619327494417757 ,  1784769800565298047 ,  1504725608964305539 ,  518830884670209699 ,  1275548777559611061 }, // x^2^636
+
+{ 741297275514072523 ,  2188032840562306314 ,  975099515474992815 ,  1693801483586009675 ,  1738682469416736515 ,  1924097513874068616 ,  1363382647197935280 ,  1571764516378360796 ,  1226414599406074148 ,  1867762996769087086 ,  304581617504524043 ,  1887591512636534090 ,  2033431258437878742 ,  620129113034823401 ,  1731189416880616597 ,  2193613869841650797 ,  1308233483979307666 ,  868822522899173522 ,  2088323338864818130 ,  587818558172607143 ,  1591619721115504387 ,  229829509504484919 ,  697486180446939828 ,  164999395773979500 ,  1327062711468066619 ,  450893269844092302 ,  1345770240410364947 ,  1826186936267364578 ,  501311025610314472 ,  1866360961489216064 ,  664788034754951164 ,  981025428342921804 ,  2029131561197225227 ,  2121883242764021837 ,  1803883254132239988 ,  975405716868349349 ,  1102191065744843925 ,  857195837988858864 ,  1101934954845881230 ,  35026235251370969 ,  1922823160515611365 ,  1765688962192306270 ,  581328272926396308 ,  1851319996790635653 ,  2112013874481747589 ,  1459773808946235228 ,  347000324748211636 ,  304998519999300601 ,  213960934555202456 ,  1772012891038589994 ,  319170008048044099 ,  1047471946839523511 ,  377380779387844118 ,  1783825888189042517 ,  1121984218375335420 ,  1131954025917626810 ,  1658242929915120330 ,  1337858017848141059 ,  1834945238873127598 ,  648566509646549593 ,  737407963783847889 ,  1424616233181048371 ,  996445038148664264 ,  760515965526159805 ,  316939692304017306 ,  2072642047678676658 ,  1810239603946753070 ,  2034886021072205007 ,  1746929691755043091 ,  1753864282872021908 ,  1908795817954640427 ,  1308644135464458997 ,  1115770160637925311 ,  921550442470168933 ,  171026360969678487 ,  2031870998642807984 ,  1117053602530324146 ,  2153836507422403786 ,  1546908814996960510 ,  150850177840696581 ,  1251309758075488616 ,  2010230694582284268 ,  1609798673078456526 ,  1233218312899134775 ,  1434420845424335888 ,  1055775045231562086 ,  482822977787739789 ,  1744389097538691481 ,  1419146726923896216 ,  526183402838192316 ,  402070994158713569 ,  540287513720017043 ,  1027700969006811535 ,  520947837288048756 ,  1867803707393814231 ,  1192792801360468438 ,  1314989501901144314 ,  1516743972743173459 ,  1689729378720291432 ,  1646139093583222495 ,  212329461688830008 ,  1334161057161887370 ,  18659429916247972 ,  49569430085076934 ,  1359533176290077910 ,  419271325191593478 ,  404744783198256160 ,  1503313986072721284 ,  1793666075973142879 ,  1037936419666696446 ,  1355728510767129874 ,  661403239920211337 ,  1993652778634369239 ,  606573956019846258 ,  182507726741626663 ,  2253066231864726539 ,  1547067964279983932 ,  410146746317597110 ,  600306682905511123 ,  848608049375970641 }, // x^2^637
+
+{ 1926096541355102391 ,  2043279604687724530 ,  1881997913350313616 ,  1007399749213551593 ,  1111055778589279003 ,  612214114989378059 ,  1115349767024997634 ,  1552640765242042217 ,  1806082914130579959 ,  1273949945295074155 ,  158201861729020252 ,  783098834228720267 ,  135751024392513645 ,  864054976669279752 ,  2109877232154559456 ,  721485480969488705 ,  899487109926826243 ,  769977853528599448 ,  2049932378764879624 ,  2203922036285551436 ,  65176260414534076 ,  1636590150681944512 ,  1666217338128194464 ,  1066039714805308592 ,  339132802128133916 ,  1684846434460025516 ,  12853423059934094 ,  2044799850388816191 ,  1920828866536543872 ,  130327917682787253 ,  1521665374653306754 ,  506700803029128588 ,  468464396547647034 ,  95631333513956862 ,  1246129700010994558 ,  551898307270093083 ,  2179694864089592072 ,  349970032880917836 ,  1089515645464270334 ,  987569833662951069 ,  533660442178588951 ,  489262431266572205 ,  1897638180393855982 ,  1084159937478345292 ,  1326414338302294596 ,  2132519397754095162 ,  1467514875950226866 ,  1392902106829242142 ,  1456746089940374593 ,  1569188102095506881 ,  1722862839216229138 ,  990321805179058227 ,  211575506559309839 ,  335879307479258508 ,  170187307844028956 ,  1226582467701732866 ,  2072158316884680181 ,  1238355610448041214 ,  1969948671285609827 ,  1594393793452883311 ,  1402705114472731277 ,  532098646124992610 ,  842548777986498542 ,  1480610954235613557 ,  156029023411843228 ,  22618949310940256 ,  143361301813793602 ,  672089227373741098 ,  667181611395565049 ,  1685798713524896279 ,  1765453747552196396 ,  418820581481759107 ,  554921930612810498 ,  526251370374403207 ,  2091123007445253194 ,  1967392998519866066 ,  702079171632061136 ,  2070139289390405935 ,  922042575091697938 ,  866270985696307381 ,  213243847017673341 ,  858481154246743533 ,  398425191058823838 ,  371140661980007536 ,  2050838644294604243 ,  2076173399259957308 ,  2298128101841983134 ,  1070016608524572089 ,  1945802585594340719 ,  2121866436659641567 ,  583090420228759865 ,  102249783775396565 ,  584572285565326309 ,  780532534639834617 ,  987314636579792122 ,  2299557978583623501 ,  2209835782504314966 ,  2145680209783575712 ,  134273801220240484 ,  1207730260785240767 ,  109663464489536079 ,  101530631733252567 ,  1342502850038244195 ,  194270341916478222 ,  2298277270521082365 ,  134545423168893864 ,  2067544250344341277 ,  1697788553395409970 ,  36982034859205086 ,  1660692998421771274 ,  2084722554167406318 ,  659429184172840211 ,  867675242545093299 ,  2023576311364460823 ,  1047793836743813256 ,  882306822817916870 ,  38917116742940308 ,  140617555951492958 ,  331685229936535513 ,  834413677592207575 }, // x^2^638
+
+{ 2294876688630644226 ,  1747368898985488453 ,  384571055665214178 ,  1317168507783003550 ,  639470207723090742 ,  807052343877064305 ,  287060014976988837 ,  2204271034642895883 ,  1874231309385027118 ,  1524888873974881392 ,  47513329361858053 ,  1588096644303344440 ,  435850594967091315 ,  377861926151570284 ,  1545447441326455256 ,  2197110496835318716 ,  1863537416937745486 ,  760462890467725625 ,  1683055781780089044 ,  1358240513268413115 ,  811135363040848860 ,  2188978514147196354 ,  992624758163019614 ,  884284238221354302 ,  1924447667162510091 ,  836496232626172910 ,  1885850255117015430 ,  1552058453105818995 ,  692618897930749528 ,  117599219796302007 ,  291052122970666660 ,  357694817608899800 ,  1586304102295077835 ,  1323817205889937468 ,  522284017538145065 ,  2247890140449480462 ,  585586989314917368 ,  960623392833190727 ,  2252080726369965754 ,  2217059785586663391 ,  1289632353402335478 ,  1821435926192662689 ,  1577444473168246216 ,  668482614071428823 ,  494124953884860409 ,  685464262289224988 ,  460501015112190529 ,  1718886909679275535 ,  2129241695490206049 ,  629319620942137257 ,  1782770976088012516 ,  254897351333765534 ,  862282719831915653 ,  2292190931881596403 ,  1549092025299575604 ,  1765007430775847617 ,  1961073933546787845 ,  1263365301131676338 ,  2254134655047289891 ,  391565316938044173 ,  493349308966579485 ,  1790270079491759723 ,  854919031639560289 ,  811705316434994828 ,  587434729009878910 ,  2090467812298121186 ,  1793637553952798587 ,  173126612260603253 ,  1879986871494577763 ,  681977016567514407 ,  12134915580377063 ,  2292903789861866751 ,  284507726744660472 ,  935164278912279567 ,  1455267060397764583 ,  1760217886009423018 ,  2199784089929491116 ,  1833904114764121605 ,  172478641636827257 ,  1224190464111847195 ,  2107398903118715621 ,  639595489547702724 ,  696838577034207143 ,  86485875698699242 ,  2098861023557745109 ,  802178645344405582 ,  485659659906742408 ,  1671846004751123488 ,  194492342819894152 ,  2012911229979911717 ,  1570288006306092775 ,  85391065842791639 ,  912502869369633472 ,  623009111219465799 ,  2025757680231839542 ,  1187879022922916501 ,  2039994904165606421 ,  136532043880260214 ,  473521320192721572 ,  1232369414859118817 ,  836617985107593204 ,  790501011938512832 ,  1919406526919817349 ,  2065889651173228980 ,  1208757106711512940 ,  2172244937718433668 ,  1674345646963904583 ,  1054705337768209654 ,  1404786016070052278 ,  1742476264312923549 ,  1665060147738868922 ,  1033144368352663369 ,  2125520546634838425 ,  2201384593042750369 ,  2244958216020847621 ,  510241681104381256 ,  2132960677516482420 ,  967463514739281305 ,  343367057720022259 ,  1234177395184579754 } // x^2^639
+
+};
+
@@ -0,0 +1,275 @@
+/*
+ *  MIXMAX
+ *  A Pseudo-Random Number Generator
+ *
+ *  The code is released under GNU Lesser General Public License (LGPL) v3
+ *
+ */
+
+
+/*
+ skipping coefficients for N=40, m=2^42+1 and s=0, low to high order, a0 + a1*x + ... + a39*x^39
+ made by skipgen.cpp
+ */
+
+
+{
+
+{ 991191703985478986 ,  607473781893209399 ,  56791941591688518 ,  617411191367515012 ,  827042503342522762 ,  1820551557416771711 ,  540191307990498216 ,  1775700130610552821 ,  316192235968395996 ,  895019576520970310 ,  1334616173584594940 ,  1308604277390948020 ,  834768497232487062 ,  1543232085177853410 ,  2238229371270928748 ,  2278046280368283154 ,  663883410070760619 ,  1530415782409740287 ,  673098747160176950 ,  1593707697470348399 ,  1508505823073395257 ,  1914725868554845744 ,  1835191321651442847 ,  136240298974961077 ,  340608542902427797 ,  1850039996045070190 ,  13485347329352709 ,  1954955484887827770 ,  176805722569914391 ,  434476509121975342 ,  548543160895883646 ,  1156924021212158808 ,  1144042291570453279 ,  1294091743571942164 ,  1382603582080254067 ,  262641776453864989 ,  1908258816058532403 ,  1423905980439719168 ,  210434049064156811 ,  482340991230591441 }, // x^2^512
+
+{ 122414642347415826 ,  676019526627585892 ,  2274077815396305980 ,  2284659259745483349 ,  118708501062710183 ,  948783566615964675 ,  160257087913245700 ,  1062028444218817956 ,  593430562427917245 ,  728355220458268608 ,  2083625274914978908 ,  630147626501572702 ,  1264063990541030255 ,  238794304410706724 ,  806685042391125116 ,  292021027246521740 ,  691945890690139678 ,  1294877058191791267 ,  304539482977022769 ,  2212002487306711962 ,  846584491419054643 ,  872068620051632595 ,  486760897032218499 ,  157756086216764589 ,  1278455733343769282 ,  2160488623230223197 ,  862212349209328707 ,  1689260555718261757 ,  1835984161653025270 ,  582690362882178695 ,  1240747762091807286 ,  209248986043064541 ,  1464580288959503494 ,  2025737899169241531 ,  1310330838922448177 ,  807107330336203118 ,  1789440082646899489 ,  1493186687459796152 ,  1348986255173279075 ,  522242447556223338 }, // x^2^513
+
+{ 1919838355610857833 ,  74105719308267599 ,  542649532433394096 ,  2260403987650801144 ,  1329257839765835960 ,  2207764049159941868 ,  1762509916759555182 ,  2178826001904478979 ,  2164717937136162873 ,  406354868516976608 ,  1769150042403737889 ,  792054329796127581 ,  1124546720600337568 ,  1248815930134725279 ,  1499004747471361264 ,  492678619957501823 ,  782517474387017904 ,  2063622951275907495 ,  1479031320066963346 ,  1048663325478605613 ,  2134833133888426287 ,  1674720123121179263 ,  417038924976463836 ,  1761123181726605540 ,  380793377277877540 ,  61469477991488137 ,  1475462363573809530 ,  656543710638476500 ,  189658874223402507 ,  696833759305242669 ,  196167640545256099 ,  1238582216379011314 ,  1824422009248921715 ,  1562180393091441430 ,  832580311514224789 ,  1721661284415019319 ,  581023098804196779 ,  158698185938946173 ,  1830089286416339561 ,  878308387988287128 }, // x^2^514
+
+{ 1999993637629820025 ,  60792293528506069 ,  851660754597711640 ,  1424346255916121298 ,  335235318195701631 ,  866851936530592617 ,  2034179041281623083 ,  1909214640816978084 ,  403235193417103129 ,  1740687141595471507 ,  1881720866506900844 ,  400298559472449664 ,  304528041534302481 ,  927413346618941487 ,  1289436848618856750 ,  602135931868439036 ,  1112446585588583805 ,  1873532287124424116 ,  1435307405674635600 ,  77059075939791760 ,  591493918437204420 ,  373919446592160777 ,  164097269190565969 ,  1864255782889042553 ,  459776155694764221 ,  342909607158389569 ,  1481217081701709858 ,  710385580723734470 ,  1800696711470485974 ,  975511312393095574 ,  1365164293187090065 ,  2127562256675600400 ,  1736277124391076574 ,  1656535575091118115 ,  1147441029199809337 ,  1283110900123676614 ,  2011135056167124718 ,  810396708345053169 ,  2195594835652220136 ,  1575867573267819008 }, // x^2^515
+
+{ 2047153984010606825 ,  1184225483587774387 ,  64827349241112855 ,  190457209199020105 ,  1202439121771499994 ,  1665138459036229574 ,  1998894996157892338 ,  559090246624745486 ,  149741699222413435 ,  2234983236322000750 ,  315830067098541934 ,  1748589126480167154 ,  2295242176669416563 ,  1048118760885755591 ,  1436626886525148995 ,  358183671127379130 ,  1086207244431832936 ,  90590012608604296 ,  590977128304681213 ,  367202975824712902 ,  611229892816457644 ,  1077416990903259078 ,  923037961683472901 ,  312379977006226004 ,  1561614112052869270 ,  369655348580718135 ,  536875930272067795 ,  117447075584886523 ,  114941929715718013 ,  1832205183567301421 ,  618662464500870725 ,  677784060235604282 ,  1714831963368611387 ,  2121664303334544141 ,  1589684766077601524 ,  915170927349707458 ,  1252026309212320500 ,  1670749686857796954 ,  84386201717021134 ,  757641007418143208 }, // x^2^516
+
+{ 2216037415187282126 ,  1255611011883864503 ,  1493651180730649377 ,  1454443038764633054 ,  282530998774658690 ,  823895884927562218 ,  168135640784746107 ,  1876655508192697981 ,  114555519385121700 ,  1228902267377972059 ,  54138604244833514 ,  1792829385072239846 ,  159855133995895350 ,  261855129377085969 ,  1970030264607739261 ,  1220455933957435481 ,  527684288208388459 ,  454800034781624230 ,  959666466545884317 ,  386353317966238913 ,  323143161382348788 ,  1063233646261210698 ,  2252763157364064398 ,  166540229949362252 ,  1739562794328674142 ,  291565304994952940 ,  837354554975546910 ,  1190617294526481368 ,  1116313177487830187 ,  242949489093329234 ,  1056696317201761383 ,  635357698634912546 ,  955065719718230564 ,  1363797079234966793 ,  1754712248015578562 ,  2042134223702518354 ,  1891037496150547225 ,  766306727808247695 ,  132885019895461045 ,  1801785319254869341 }, // x^2^517
+
+{ 577053476704308680 ,  2015637935907680681 ,  379594156519395875 ,  2029982749287400370 ,  2289604784138464485 ,  1021978519008371999 ,  434403567489749906 ,  1665821798143417395 ,  1762798989505135955 ,  2205431835756718238 ,  1309521343439063809 ,  1154470948353166423 ,  352459039791041391 ,  81820669038723859 ,  2107499862908925296 ,  352745520896301567 ,  316181861841325590 ,  827471799469033419 ,  857838378913398729 ,  21708078142326996 ,  502650998906022302 ,  1650384014268187532 ,  1250219126117394543 ,  2117648688698479033 ,  2059558417607581116 ,  1855406372128926191 ,  1879028664725650233 ,  1931941925946595966 ,  1195437273200665092 ,  1123361258064088011 ,  66342337776388282 ,  1011385914394992435 ,  21659529555783943 ,  2242835487200397179 ,  387889202437341473 ,  295132305050216973 ,  1116122158227464636 ,  2105082957408091303 ,  399913856633912625 ,  2229926459647749838 }, // x^2^518
+
+{ 954968106549582719 ,  109074253167624143 ,  1056601236963090299 ,  1559816734301139697 ,  1548369343164845693 ,  1370977847817149583 ,  1036201486417265551 ,  2080190222525395688 ,  1720590181764760100 ,  308703656683185212 ,  1016383219242395521 ,  868799213541174679 ,  2057256073046338002 ,  2075359098361362775 ,  1246116039236566990 ,  259812774611559052 ,  2169631519289095096 ,  98712242573938261 ,  973216986696214487 ,  2295355798734957726 ,  1984639164700981455 ,  162367341387321262 ,  2224594622076047536 ,  126110238117960229 ,  10148367930228304 ,  1814561697302377519 ,  683235268877649612 ,  164330435575034520 ,  1496688646616099002 ,  1632890420495265817 ,  2241732720139688342 ,  1424287873400419078 ,  2245776872491837896 ,  810280477866360899 ,  2015759633931842084 ,  1945755682465319037 ,  1296263187822754077 ,  46848550900556379 ,  1374634913446203419 ,  1282936854409984635 }, // x^2^519
+
+{ 840600926316798768 ,  1844061480821374613 ,  956922859609854270 ,  2168412882882007824 ,  2132769824485202411 ,  1760082115237726756 ,  389913909323222832 ,  1000022312308851525 ,  2294055101470130263 ,  1561104148459497499 ,  811972377700004765 ,  1511358988213599299 ,  724021458579011460 ,  967527626759609832 ,  1099841605201162446 ,  1283537701187324444 ,  1556403679946957758 ,  2116387075236098265 ,  2019736388774476095 ,  1731003605283091427 ,  470253375161892142 ,  2073004875609317711 ,  422189790530373676 ,  910292180455386606 ,  1410611686069460222 ,  911670101288601741 ,  2119510134656361423 ,  268754678545017621 ,  373949335365017083 ,  307554928222216035 ,  255878147178357779 ,  1006257615831988503 ,  1519327541723443222 ,  1091775535344431278 ,  1379627135039149534 ,  1053711221514797365 ,  782544607749266942 ,  365478805794062205 ,  2027998551036048109 ,  91863327144335472 }, // x^2^520
+
+{ 1011815507914850677 ,  495672703816145995 ,  1377255110107650772 ,  1989537852532070105 ,  366172735619879461 ,  1281388454214909243 ,  1980172509767488169 ,  330495815894375370 ,  1269178893970950545 ,  8700938697513931 ,  71511338820249149 ,  429075449801795521 ,  104325366164945026 ,  2298207934431794887 ,  2084756036258720922 ,  620856122944031917 ,  639444998754997704 ,  1476406513296177048 ,  1888420621047045259 ,  411933024332019749 ,  1376841909858938338 ,  956599900563671930 ,  1768033348278680300 ,  1799439378668776190 ,  397974444711262789 ,  2287707285624673974 ,  1310473215373880506 ,  1339271543799427100 ,  1488549093576989916 ,  1304599231763190682 ,  1792827226645402034 ,  580901896333646538 ,  1614419184288788907 ,  1151305294271922381 ,  447905672887855697 ,  950469441076722410 ,  1539320503617026597 ,  1039952122372365003 ,  848162230898546856 ,  1556918987118692664 }, // x^2^521
+
+{ 1192086502868883984 ,  1154236775245231987 ,  1934640617452630271 ,  2224783533442319805 ,  1571070528271521374 ,  1180075283793489228 ,  1032372393834100352 ,  2221440204192626106 ,  1984840725524293246 ,  36170850644791480 ,  243871353820550410 ,  228134882146928625 ,  1668882919551333783 ,  1743231391541261171 ,  2263360451936206478 ,  1002647791855040891 ,  191265305977476565 ,  211686374806497632 ,  623813706112234751 ,  208546326262282195 ,  1596800506165900894 ,  1333736481696697399 ,  193877447322956071 ,  323664055425859456 ,  693678410759595942 ,  206917201438933458 ,  1369551194570394716 ,  331299678516931833 ,  1945730026409825330 ,  1529075673320480306 ,  2024770678669163572 ,  629000364293719153 ,  1575757868997960547 ,  1915933050938178173 ,  278943135529073501 ,  2212765539807604723 ,  1058883591229491366 ,  674160375142426986 ,  727409648979575278 ,  481669746030136435 }, // x^2^522
+
+{ 1078383652730046349 ,  1409334285020133244 ,  326519013963227151 ,  873264935234008852 ,  2156130415050199869 ,  1446448843955453704 ,  1415614056761129720 ,  7976924653461430 ,  2026703514455608208 ,  1680478569928817558 ,  738157644088750600 ,  111853367857868368 ,  416756829292244743 ,  585079610408950384 ,  881227931545817339 ,  398763313350688214 ,  943306921357361061 ,  1577646861273078028 ,  1441156230301307776 ,  114870071997151499 ,  2132577267226984416 ,  977496830093310589 ,  1608791713475158002 ,  368093301514945154 ,  1326343710860635234 ,  931423514455906930 ,  854556882141317845 ,  69736308056362638 ,  31373586279470376 ,  706439734459024744 ,  1558611314635732905 ,  1233351848746069378 ,  524852564966665902 ,  519147160683726482 ,  1370774648525316516 ,  1237093403451308030 ,  586260622207334450 ,  404824863351530488 ,  1599895477302249337 ,  1810569498325807633 }, // x^2^523
+
+{ 1934928217389515356 ,  2229585860730528604 ,  471917437688951035 ,  1253015378815673440 ,  1925222932585030618 ,  259657707258555512 ,  1228903248191322610 ,  80346508270537585 ,  119600839009493981 ,  1506996542874809582 ,  1841315280707643727 ,  1366726176203423361 ,  1754303776104966601 ,  57328716149695141 ,  98975980191899965 ,  581889736284637238 ,  1326175187579559080 ,  1817280048970914674 ,  140919577088711799 ,  1248343551137884021 ,  2141428094739892618 ,  1974705469633587511 ,  74315541675544404 ,  1190182222418423145 ,  422711977483817113 ,  510562467534405453 ,  1197224636001452043 ,  230193178568230626 ,  1470111603108699993 ,  1639776330616261247 ,  602842181091690102 ,  85532453571118662 ,  2125273859819700272 ,  713680828193672677 ,  1096148205048735212 ,  557681934053554141 ,  1702187843186608712 ,  1141247286188839506 ,  2033216970513148065 ,  318257358996414046 }, // x^2^524
+
+{ 2270530557016354051 ,  785075836586315108 ,  2125441755417902070 ,  936676590963499238 ,  858821913220912263 ,  2243619797717980300 ,  1616712238897741076 ,  470338149417606347 ,  1581368078115177847 ,  177752484802042951 ,  1681016780265833062 ,  1316169229185281133 ,  1457919381295334531 ,  1156803952976498115 ,  143399821820192901 ,  334357009745925156 ,  1633541385866112667 ,  616899713218627241 ,  1508823912506915493 ,  1909101440523856563 ,  1563815732992095166 ,  820041201660160044 ,  1613322795987031823 ,  640609142160879086 ,  74690160564119624 ,  1635530767581455343 ,  1465705979393224738 ,  844841865510219060 ,  1410535036547923537 ,  535397993399759935 ,  672890530008627629 ,  1777054010860868063 ,  1341472683375683309 ,  1208599825691763788 ,  245472541068752972 ,  1103935707585282810 ,  2243177486563030415 ,  328177181144987753 ,  391304323738102203 ,  1214775234795197231 }, // x^2^525
+
+{ 1303846751890184906 ,  1485223494775070554 ,  452359558125188970 ,  447711095712317823 ,  1440499068517501528 ,  906188887879515429 ,  919264472301691730 ,  397871288605163027 ,  1990277129483058051 ,  1116132754808068164 ,  1815146152093505373 ,  1734467893783560480 ,  805935629910978000 ,  568825009024641527 ,  353831690933246115 ,  2123419673582416028 ,  1221830329898526588 ,  1003329079143504828 ,  1305557514462467308 ,  1831495267365028244 ,  558487065197262924 ,  1188915777817915893 ,  1641672318491699116 ,  2111868319432388753 ,  634046171378337495 ,  1723083217155274309 ,  515177818452896098 ,  1840119725253085086 ,  1159974730735214715 ,  1758040185497647066 ,  113523547529557497 ,  940533385714573939 ,  1014307705342101642 ,  952905236332745189 ,  1887740835614474748 ,  403996709185182371 ,  1338286381163533900 ,  1673610829126837771 ,  1403373929589130360 ,  1245458158928195725 }, // x^2^526
+
+{ 1718147135149891328 ,  1870269944872457424 ,  330701149247004348 ,  1213951459531308271 ,  1715683538752264021 ,  2298948342804818611 ,  1932807829825819979 ,  1757895668252256782 ,  1270642440494311025 ,  1461601954118738241 ,  232888129056105858 ,  480748634556087709 ,  1966646800877445990 ,  2087843965971088734 ,  1644376159614116773 ,  241109266670962935 ,  728807088551650690 ,  1651174530255900675 ,  2239632225245655465 ,  68580589050949953 ,  1403338894127376830 ,  1447809411785916634 ,  13604629083898904 ,  1203254438807414236 ,  1600625364486328266 ,  1410059676384232324 ,  2238480363855535052 ,  2034869116239893117 ,  1606248399417498794 ,  901032525376430432 ,  2102549750370337563 ,  2116631110072109823 ,  766113327928474083 ,  1015341495985833201 ,  1372814855166318254 ,  1023420504749340289 ,  359422488691188818 ,  1541671655726857897 ,  1612591814218054519 ,  691814842770848824 }, // x^2^527
+
+{ 962631540036953824 ,  1166210580069453665 ,  785772598713845821 ,  1669869822390723194 ,  491145205838737620 ,  2123398635854658880 ,  1217532924224111189 ,  1444711011923108207 ,  880085002316097501 ,  1593187283216936979 ,  2133520573007172015 ,  2029456324503519115 ,  1704152613314259015 ,  187485302904379592 ,  1604086159874147855 ,  597174762442520082 ,  771376772405455088 ,  327320877372650612 ,  1211306953677762474 ,  2255914408552087128 ,  1757790280002531176 ,  2133277090271223710 ,  1341630458814853839 ,  467591453394542178 ,  2196281174550468092 ,  2041457120494956803 ,  63119319300965541 ,  1304932069001873938 ,  2182694115147457731 ,  973037013251650166 ,  825768947727256993 ,  154742487906598562 ,  1195037412998959450 ,  1799958298775824713 ,  1211531311537207393 ,  1278665222496502644 ,  245180610563602516 ,  1049093555401524924 ,  1792339256333133600 ,  1622116862385449259 }, // x^2^528
+
+{ 951235154295966667 ,  1972332819125984549 ,  905947280673458763 ,  1075603757094986216 ,  1271157375932740729 ,  439212697370224708 ,  905840783281698252 ,  1916727426682604465 ,  1631765155753886936 ,  1746608217316005738 ,  2190502850314010630 ,  2146899597159336767 ,  944441537436793473 ,  312390655349546241 ,  1207883751695474089 ,  1272314239705498963 ,  1013748630144686788 ,  1156658497161527689 ,  313612697414197553 ,  751275973769285689 ,  1802963444293656503 ,  442291364740017835 ,  194771333030590224 ,  2237671597497205214 ,  818376774925846038 ,  1241654079538195806 ,  784485425381953593 ,  340643109564265858 ,  1666262672743974221 ,  156409854577165862 ,  2198355485414754151 ,  595203640188772713 ,  1824810206999799424 ,  2055120004626931864 ,  1467808742124127757 ,  569918705749111886 ,  175334615792791483 ,  1155198564719024055 ,  1970930126729520652 ,  1589713722832249220 }, // x^2^529
+
+{ 2304997394796271426 ,  1061272877008422128 ,  686086039686931657 ,  511306748979366590 ,  743432459588972389 ,  1402186970859121526 ,  552355171128826958 ,  554100897013142908 ,  1853930859662963681 ,  1474924020834541256 ,  276902606583943581 ,  667822384060910332 ,  2011288685292056859 ,  1006918700602418415 ,  1865862490176085270 ,  2246905890262194177 ,  1376302262846526053 ,  1314700018951657994 ,  1967366725931734965 ,  1670491109276813042 ,  1715869596662134888 ,  191863984385708153 ,  804672832196669673 ,  2254519143544263546 ,  834532851799115188 ,  289690000663793783 ,  215669044282644663 ,  849374277303575613 ,  788250489532584011 ,  252923829097337711 ,  2022434788231445849 ,  1532504920036755753 ,  552246423725132488 ,  2182185075025986856 ,  1799093164205385169 ,  978137189023831262 ,  1005725690426649471 ,  2109194550328646423 ,  1279370295354298125 ,  372571751889601027 }, // x^2^530
+
+{ 80165173208259466 ,  1213491222872013189 ,  1736553180401260517 ,  1686498236546933048 ,  159937756477205547 ,  1259161930202431182 ,  1044414759465471072 ,  918326856176839772 ,  621234979947059799 ,  1325560736618242870 ,  1014988515713127846 ,  2158716770979881818 ,  2048124329761893693 ,  1284379636505214982 ,  1584435969070896355 ,  2174149630124986004 ,  279008902136484558 ,  486304611441022962 ,  673162527118197973 ,  1811201237463557283 ,  1136225098529746487 ,  1908683437708272635 ,  1324655550831028771 ,  1719435093937273170 ,  1006703014910633488 ,  1116082015573285915 ,  449985379539831952 ,  408675214662052976 ,  825842346114142833 ,  2068456944899420463 ,  80305287076185748 ,  1193571589055256211 ,  2104601308875697506 ,  849028574175223751 ,  164943230207523989 ,  891296920487117499 ,  1741243623485302148 ,  1539721940242230372 ,  1443029192066778177 ,  672522843496620486 }, // x^2^531
+
+{ 1289774321142752126 ,  158767742205794393 ,  1609383662357044313 ,  1860536863810836085 ,  656466526879505631 ,  1921173727931228592 ,  901714299968645628 ,  1094070157882973819 ,  249932771039295762 ,  2255413710956131558 ,  377523413145295621 ,  896692064216709155 ,  1525538523185519996 ,  2098940946346979930 ,  1721112948118892212 ,  764302212854092340 ,  730195207683992040 ,  1952887078209584746 ,  1334124278942169297 ,  1555388938875010799 ,  1940129431236248163 ,  595865456309572993 ,  282191862430223904 ,  970103292523235727 ,  2134627542725610300 ,  1687061572869569215 ,  528541010804753941 ,  564930141716814025 ,  2017142175254043312 ,  1807591687423415011 ,  2012180023284132357 ,  191553314138838626 ,  190653160583731479 ,  2221626080756250698 ,  101668085062585224 ,  2064767492150445181 ,  1164746594250626131 ,  2068711971833277216 ,  1166307790013675714 ,  948420080273676730 }, // x^2^532
+
+{ 2157010612110117611 ,  1028092943345598521 ,  395874754484698965 ,  79349657255367345 ,  1638910784180862011 ,  515795272025948812 ,  2092057009212645192 ,  1934267680425265877 ,  940022005331560922 ,  1418995056003943650 ,  611331334304088343 ,  1740925662685487972 ,  14890297729362921 ,  2021791461491017606 ,  1398481169372877556 ,  2204616600960795406 ,  2132212580251985835 ,  799411491167399273 ,  1935878666813951104 ,  2086577525971351919 ,  2075630572485748113 ,  1650521971508195481 ,  771010085345025954 ,  919252134183242274 ,  913118186950238886 ,  667762355668429554 ,  757041072236728182 ,  1578899039546408423 ,  607479554885566724 ,  490048424481128366 ,  8480653647536730 ,  1961218020517412737 ,  951854647440034064 ,  158072590165948008 ,  164457316656766723 ,  2026221216088192678 ,  1735147147329065881 ,  250201447725536226 ,  885188846694705832 ,  376698431107754425 }, // x^2^533
+
+{ 136420311709122086 ,  559216959821257901 ,  1866057345721884611 ,  1926150903889834940 ,  1355864991470321907 ,  1255755843942123187 ,  1127631084178437291 ,  2093265258277582362 ,  1836668091310737909 ,  679286686097016009 ,  1077971195212653347 ,  19518899262367222 ,  2025234002836591420 ,  2118540533024423606 ,  2238096469134037363 ,  1555407693414497429 ,  60997549338371792 ,  1100421173920003446 ,  822369746740554164 ,  2169685523007058007 ,  2092963971009633526 ,  1215288841690324934 ,  222831608669957940 ,  1472751870576788728 ,  320442958498556857 ,  1903404405928790444 ,  1991243902807634092 ,  951452833186854866 ,  1583716359042211082 ,  446358362528559633 ,  135688665388999363 ,  285108862264622364 ,  1100540596309641504 ,  257862979576846379 ,  1546597582982525245 ,  1689833024208294651 ,  1769683769141558704 ,  1520584822686562544 ,  482351384876389052 ,  1000493393547545418 }, // x^2^534
+
+{ 1345673670179789315 ,  467671467171498867 ,  593422061733586440 ,  1428283760223560489 ,  676733775555511423 ,  1407602686209497851 ,  86871026609370657 ,  1625057982377355630 ,  459505669760151722 ,  1288240205515609956 ,  1520104220928501887 ,  612860648920525637 ,  733980439867446040 ,  21408010215262488 ,  1668792648151575166 ,  271195316023712794 ,  2254500187546348074 ,  1812382313926921742 ,  1970209724112075258 ,  1825936741884773536 ,  623856656670424321 ,  267830947824073887 ,  151737054103727149 ,  853164156264651737 ,  812838278611953888 ,  1350064139436601029 ,  1948182895336934279 ,  2116679422930480385 ,  1727739134763562029 ,  152177021243449334 ,  1055320153389829582 ,  378618193329955376 ,  1085427396543588911 ,  769260201733363454 ,  271636781290702584 ,  2007280334037003680 ,  1528059495608944213 ,  1088551496249439599 ,  129566501333183424 ,  1946391742363590941 }, // x^2^535
+
+{ 605150415084529077 ,  1864338287311410368 ,  1176999692838386916 ,  348089511333212997 ,  1989436411497598639 ,  1721092212779890439 ,  1258720681874525664 ,  900633195065512702 ,  1863847478819246488 ,  1222383819272755578 ,  1498703688196364753 ,  1588153926699054006 ,  1825255654198085143 ,  34180159554715411 ,  9877812026053095 ,  1900479919975447032 ,  485103910486343281 ,  961433062944636834 ,  336438115361736265 ,  371778084995242361 ,  1566794350375537469 ,  1454524701863992625 ,  1005345659773245212 ,  886516234742879293 ,  1043651053682770304 ,  2205005117954118605 ,  227515021071104243 ,  999367415345016463 ,  471634258630491753 ,  1920523709000599020 ,  789738553685609525 ,  1570721024572203318 ,  242297345466539784 ,  2174672449721989854 ,  1129290249058544188 ,  1777422788516161457 ,  402315008143633478 ,  2221374999007368533 ,  243949543121984244 ,  718693069887754232 }, // x^2^536
+
+{ 2218065544446757084 ,  202669849618440753 ,  819522080516020081 ,  1954381546944814740 ,  834749148483290556 ,  681297592681902059 ,  678331463279283164 ,  2225695571894205990 ,  372328815542110186 ,  372383396678865893 ,  508843499998492630 ,  456166308269182519 ,  2140880487709098272 ,  1524338051139314699 ,  2244735338590220884 ,  96103811033170704 ,  104625637285348956 ,  212388674997748833 ,  387606885936222661 ,  1186688571538479087 ,  463599219733719717 ,  574913174121850602 ,  13484531770835570 ,  1738920080221177141 ,  995337719738771720 ,  2202976925232856042 ,  197165009995108649 ,  306034765309680963 ,  751191056681553470 ,  1809998915705088102 ,  171971345245075760 ,  1986485981202593349 ,  652609274913471904 ,  1815590528182027033 ,  2257117809676144295 ,  1124249263335338344 ,  726440948960185281 ,  1517222831265998926 ,  257094789998252215 ,  525119573473714090 }, // x^2^537
+
+{ 1616299433340970727 ,  1487704840703390364 ,  1700294782910156454 ,  1039484203319812094 ,  1524365667629354020 ,  1961071575649054030 ,  2253079377861679567 ,  2039354806544490096 ,  2148514585292876415 ,  317526590950531339 ,  415101566432862999 ,  2070929265834431558 ,  1717193978982764968 ,  1417906830173504024 ,  194852989666253889 ,  1096024472398008571 ,  119088208720224984 ,  2115711490237994739 ,  1746865587952813730 ,  324625107815113528 ,  380457550264362323 ,  681228104776128843 ,  1011245107151313613 ,  508763288122626845 ,  1745458656617808772 ,  1902765204565872286 ,  1121069972439240139 ,  1233554435666965290 ,  1266209916244414651 ,  601557721835812715 ,  1372518756788622618 ,  997085404644898964 ,  882501347341615306 ,  14165955236568405 ,  149399388780648117 ,  84190287724924877 ,  43982920295964265 ,  1583604519951948849 ,  982900386384485850 ,  1101532833002202091 }, // x^2^538
+
+{ 1136981464324861162 ,  645198282396142752 ,  378310361023070848 ,  520716942160570159 ,  637749989696945261 ,  2255277315421129519 ,  1598242761032072785 ,  807262655108596918 ,  1461015966875189658 ,  806747397174462742 ,  1310339134074133327 ,  44840389267982305 ,  447918468754736093 ,  1282691108164738303 ,  2105893899218086871 ,  1707436637755243831 ,  1338534247627425430 ,  1906404980621042802 ,  98972804318089616 ,  2185869984304971453 ,  1780029383249911689 ,  1230536556825950959 ,  557716691493913856 ,  796969765687160625 ,  1000977333645263604 ,  1886013799214615054 ,  258545124216056398 ,  1684311174389241791 ,  205735928289645306 ,  1058014152694724817 ,  1328625347449640340 ,  1488867168627606292 ,  760317540267705650 ,  1379292935054096713 ,  1748213260906487650 ,  120791621462521498 ,  315583974297521626 ,  790587414726925499 ,  1339562029997501384 ,  2232515410682669784 }, // x^2^539
+
+{ 317156709565177721 ,  1611829131108715319 ,  1102221801113839799 ,  1193139800743413801 ,  1517436117469352510 ,  500840446355487083 ,  633719987887809679 ,  2293567966190838819 ,  829603582557755709 ,  723592071278704384 ,  2128002262545307060 ,  1991866131554819556 ,  1160561047765442847 ,  568691152145391403 ,  1703377452938720206 ,  190619861147306564 ,  1270485186631708298 ,  2286711823741112015 ,  859652275447710671 ,  1077672425391159292 ,  1186771782961474330 ,  835216244787550259 ,  511387411963819768 ,  1890135584667892719 ,  826696747279845583 ,  1954316107404954616 ,  1913206135285558660 ,  1868747779682794299 ,  79273219976401002 ,  883467340638158506 ,  1836256294184504585 ,  1863151933080047566 ,  660069455600587056 ,  610903338788243974 ,  1212559732801646810 ,  879498609605397831 ,  594516520566507132 ,  2119599403739299533 ,  248975006847968786 ,  2232634882968844893 }, // x^2^540
+
+{ 1384986160759745562 ,  446350775124006803 ,  1994828615514671494 ,  1030698097087037699 ,  604657471141931767 ,  1933516706645301958 ,  1100132923797771579 ,  1254463698562793066 ,  212104278503941508 ,  98019186707881701 ,  1231750856284549502 ,  1569918215854814905 ,  1701606267726033156 ,  1213054453523642573 ,  1048900909600500904 ,  1342460740018684586 ,  2287930731524381122 ,  1464537449623384675 ,  2189912181496148015 ,  1530530842738620173 ,  740057861304438410 ,  1768806730675187143 ,  1514778235906905374 ,  162645292720648369 ,  1951742850712551001 ,  24978124928878831 ,  1967984457543985679 ,  877531667450931597 ,  1368996892338568620 ,  1582474412481647020 ,  402537504282292441 ,  535115444057522634 ,  1633241000126953339 ,  278721264606341509 ,  1457210097430168839 ,  1802526997633175579 ,  758762405084501521 ,  1957837410073516245 ,  1469792929326265882 ,  1739708712811142778 }, // x^2^541
+
+{ 1749787289437236398 ,  456786635369182382 ,  369059143206682976 ,  1362541723910682174 ,  527122885699778522 ,  486245031284165440 ,  1116243250848868684 ,  420940873766748239 ,  1833751130588920541 ,  1671823525882043786 ,  4273269833251749 ,  1059027415230102484 ,  807084538872427460 ,  2058321325066553671 ,  2125348634941251636 ,  1805780972610224040 ,  1677182300229252798 ,  1000362279599749517 ,  953390157335934523 ,  1426560715603494523 ,  2202734505379715169 ,  1502525949708115925 ,  464023039175689091 ,  1556912803068909953 ,  800883972275108849 ,  818274574053258186 ,  492705875364278682 ,  2154533162856041631 ,  97619377990104092 ,  580181582969995841 ,  1673309622804034137 ,  2298869927249189065 ,  5998631060641792 ,  1663972803104513418 ,  144639827858247298 ,  1099170715370730911 ,  843387151757807161 ,  95113075459124042 ,  1062652048331845097 ,  754981350616346555 }, // x^2^542
+
+{ 471379096957168542 ,  1338143708930288478 ,  650013558407514096 ,  230306995885876907 ,  1263315689339522991 ,  332896913339600395 ,  1495017928510030407 ,  1305905223412247587 ,  1157129210909092866 ,  1425577142097569013 ,  1957196381005969960 ,  885222839735600966 ,  1846844511557458992 ,  1847948613175472169 ,  1704519679904447875 ,  1536345967719212562 ,  876183580916121968 ,  1020173324130958330 ,  1375463694229081814 ,  106903119913770631 ,  1887311480504869196 ,  1697534758943229474 ,  735360225104736395 ,  1118266679784192622 ,  1894661118239841477 ,  24149206481980505 ,  696536479961927538 ,  910218693683275165 ,  100962472975584092 ,  2195128524470588802 ,  652654859900454468 ,  1670638008120467333 ,  1019473321411273756 ,  829488341570119516 ,  1374802219781776268 ,  1021560654941072773 ,  2160465714151700056 ,  122560359782154369 ,  1429207122829236958 ,  535860361325992742 }, // x^2^543
+
+{ 1643975221519823986 ,  1344764602283942906 ,  18165240619240001 ,  15113071147295997 ,  1549305499546254338 ,  1572723347728024908 ,  1388770540958944254 ,  1667896268073539460 ,  1685909261716301576 ,  4863582395322402 ,  275427816276180310 ,  1759146489271877388 ,  42048536502636972 ,  443769847638503229 ,  1000760447369343727 ,  1314030579575179463 ,  1684351023780318373 ,  426199628213689171 ,  2062726544254798922 ,  937593611039959027 ,  1286010582688145373 ,  1210804349216713467 ,  2196168466777741545 ,  1236172725347366811 ,  944429632197166660 ,  1314543554753908462 ,  2065731720609462669 ,  2000614689700219594 ,  910737502866344096 ,  970406302161749699 ,  270212866714524922 ,  1739438837533678619 ,  1441908549554176844 ,  123670228176290581 ,  1181451428417579651 ,  15848339465658756 ,  901594886503088880 ,  1436996223370855728 ,  28940936065729666 ,  574237113080793504 }, // x^2^544
+
+{ 589243221527345756 ,  815272578974109221 ,  1294872417511263800 ,  2230223659039371328 ,  1355676479485586157 ,  1450176254641061653 ,  281170419445141122 ,  1882157265120370137 ,  714303743061026547 ,  1070805061400748760 ,  824062231063664512 ,  1710744281021037220 ,  1009917669120500267 ,  1468226133265660101 ,  109183617998581974 ,  1824985337562143731 ,  48600063586440521 ,  1865088080480742946 ,  563354354370829403 ,  1516541404600454244 ,  527079419916896401 ,  732350251593662865 ,  945030677082698443 ,  1890246298378007268 ,  159737249676179477 ,  9658601943685581 ,  170449950099407901 ,  1620859678252736216 ,  1704770017289874517 ,  1778456943290093796 ,  1576565834567336837 ,  746527116139383067 ,  1210806803263101087 ,  1060112786221260790 ,  1205425292812176538 ,  1962134719186343675 ,  2281475460731352894 ,  2080617010223022288 ,  1383353256616076621 ,  768400975966741629 }, // x^2^545
+
+{ 2026915830723094351 ,  885676407719646725 ,  560599829566977894 ,  848613064018643040 ,  410091165537429052 ,  2102253493590622541 ,  2011061022499945287 ,  1679200225782719413 ,  1070900024889080844 ,  987716892036776174 ,  1779879024022815702 ,  1066355932737684320 ,  2133932732460717925 ,  1531788373710199964 ,  1563463302373003075 ,  2191864843034715699 ,  1987598514320840047 ,  775407839383340 ,  1191454631421126616 ,  1266628128028860794 ,  1389020629597198522 ,  866860605624247610 ,  603684414118799315 ,  1370558786941402814 ,  2210104061743306028 ,  1880542295106479854 ,  882391682506790519 ,  104368231224913043 ,  1340674609396215680 ,  892181354551699910 ,  1954086845526180838 ,  2210726078086166089 ,  322475604028422519 ,  1565155116114491448 ,  1863643254907335120 ,  139929594879250631 ,  1577885785549890343 ,  820687168654852098 ,  2258961903572737136 ,  735785713611183933 }, // x^2^546
+
+{ 1303749471263954772 ,  1232325583783122477 ,  2187062887538938157 ,  686678324448485337 ,  1484832922986938799 ,  260866544635119787 ,  2142717588827437499 ,  998522134340336430 ,  1640094817616270816 ,  1322672558930637369 ,  65430455089496619 ,  2152054738538412252 ,  1026326542982555481 ,  284786879568341254 ,  980743270939042836 ,  717288657473562483 ,  906279875543568057 ,  1769550751525460167 ,  2056283724536127171 ,  1680115501486509849 ,  721433634266465237 ,  25489675061610317 ,  875444843055051959 ,  1559119127961465453 ,  278746542330552085 ,  134609280246554290 ,  2080088003508105789 ,  626742044321845517 ,  1781444543606366639 ,  2297813875694020941 ,  1336577130526583496 ,  885179735286020741 ,  2270618341603357621 ,  1138474209855919334 ,  974059665042342312 ,  2305649997483238180 ,  1301462758583507502 ,  1489114480734322058 ,  1681176615654022656 ,  912164300175382851 }, // x^2^547
+
+{ 787776060776350348 ,  78721553835207772 ,  1770570019401284859 ,  835028081785307437 ,  1181782572215392782 ,  2210841165502888768 ,  1290790642733414816 ,  1629661493872770346 ,  1760093816957587047 ,  1515559417267131616 ,  2012750987892758927 ,  260574495716831329 ,  1676309352502235138 ,  1997170992284618482 ,  1354000906493726503 ,  1759675581374577376 ,  912726034236760721 ,  2079703691625009203 ,  1424740489503745444 ,  612655632724769486 ,  1366574497980612131 ,  1681007176587637958 ,  1389794631647630483 ,  686210241733414297 ,  1104711885764043613 ,  552730330089368857 ,  222223314074059441 ,  287393886407252745 ,  1671025165323138512 ,  446297884017527107 ,  2235558744734668436 ,  2293637805888731568 ,  1967566101378033999 ,  2208141348649226797 ,  1812939769716780554 ,  1336070726364261736 ,  459620413996534095 ,  468557384852287759 ,  1431420796628658420 ,  57915735279399058 }, // x^2^548
+
+{ 1205393720950832643 ,  808260548981954880 ,  2039511338731138371 ,  1961105474256076910 ,  1252461741950910754 ,  1148931137125206693 ,  1563333202593970438 ,  1001026753417808572 ,  430928588715900624 ,  497335373483494302 ,  405461249756104952 ,  391466269554443039 ,  1171921927306705962 ,  59650908126249221 ,  1248199288211440044 ,  1656880758967371305 ,  153054697540852062 ,  223255870025938544 ,  1266871157412293952 ,  2197994571634084868 ,  2145626502236910882 ,  2033056871571726189 ,  1891169044830796979 ,  2044716727793623188 ,  2232300845859740391 ,  1727165402708379997 ,  682433889053736551 ,  2131019009323103970 ,  486649720338292153 ,  417338153990685273 ,  798122918749446161 ,  151085614561808646 ,  1181612775708499109 ,  1049971209408018156 ,  1402485977684691465 ,  778307861651505362 ,  1413153985161421074 ,  830388512065290348 ,  1771134837233062083 ,  2264694831281143444 }, // x^2^549
+
+{ 207370224900339502 ,  282031358283802110 ,  1490308835631134215 ,  395368762769790325 ,  144538702038582504 ,  422830620198631034 ,  2031885261809418252 ,  1192648656901539374 ,  657520331977985720 ,  871659738525194377 ,  1095005346216298516 ,  733340346965527096 ,  207793739306094326 ,  1853902391727804024 ,  1266112631125465012 ,  776148108023307636 ,  1842091101477542477 ,  2216172390942143658 ,  1116729347328738920 ,  804879777974020373 ,  1516103100599443255 ,  2010695647613133256 ,  1852946474167556440 ,  2243748273698967946 ,  599267079607404993 ,  1480437177047553652 ,  882414013114643185 ,  908101030890246871 ,  599923022176374174 ,  1322800809268683368 ,  998455311719116384 ,  1339846977401501000 ,  648481784229955197 ,  650009683407881546 ,  1407932094420016685 ,  2039086542250970183 ,  1684162678936123370 ,  296404738129864050 ,  477904508939341213 ,  2094435353015581361 }, // x^2^550
+
+{ 2132019667168703630 ,  359524718873669764 ,  1498514111631721243 ,  1757877821578367246 ,  1703218737737853266 ,  1936644168270181257 ,  531325729652473232 ,  413915565866826051 ,  1364487929226478608 ,  1454086741587251913 ,  900145646430081160 ,  477118601657053954 ,  626418738528291289 ,  40835352415869820 ,  22940022342110512 ,  388389373489919181 ,  327041424660151196 ,  2129340747995957852 ,  535095143616621418 ,  479477378077839703 ,  1330056856470946979 ,  860840178846192969 ,  2087623480813021303 ,  64861559436345783 ,  627679806504500055 ,  638012204477997404 ,  227346167886895036 ,  822744043086304487 ,  320484899170409498 ,  2219950404030664297 ,  126253932804520040 ,  240125843563525121 ,  2191216276953303679 ,  2085912620174748720 ,  144341274928578184 ,  403731936530468421 ,  2090998646008098086 ,  856436551999147668 ,  1171596386613653714 ,  251156827876305269 }, // x^2^551
+
+{ 2087529103804322572 ,  1213876004020169071 ,  1313682443229288750 ,  198304972212131357 ,  1664850175426674373 ,  1984119875523209097 ,  569365138923127027 ,  1162390143215216253 ,  373094460238055298 ,  1103811648907349691 ,  1081418531148211462 ,  796530204675263237 ,  938701632982284650 ,  1573836815934045622 ,  1697853778607922957 ,  28259552082350377 ,  2289013462285124905 ,  1333367359897315769 ,  1186855995456820261 ,  1470848299682034071 ,  2081716631010385708 ,  1414560420458082836 ,  2297552763558558785 ,  5093518798061278 ,  894190063123775994 ,  173697430217745862 ,  308514886596184272 ,  2252574124677826735 ,  1564848954123075847 ,  1506023194724504275 ,  618995267427556738 ,  632774857557399959 ,  2188511604173680962 ,  65172085808152987 ,  298347769773969703 ,  300896764327607191 ,  1709342860222936890 ,  1254814187134694865 ,  295429885181002820 ,  51581038280478237 }, // x^2^552
+
+{ 195639094079891275 ,  1860604345580268212 ,  95857497454762298 ,  2000114160450292441 ,  1669518508718528053 ,  137463514739909157 ,  697086947822478409 ,  1283925248636232619 ,  358492871480988131 ,  129242701982097935 ,  115243417308243049 ,  1522859444582089155 ,  1055970188329168977 ,  1478076821667799885 ,  1006708072310400653 ,  1330943458290498869 ,  1515486355774172110 ,  965058046720601895 ,  1849510748674069749 ,  2217785230856642553 ,  936155781956536452 ,  110865805473796695 ,  56389553512739446 ,  822541530749454923 ,  851373217672357024 ,  941030431240869165 ,  879396579818140607 ,  664440700648259459 ,  1459931183884172698 ,  171735200368962242 ,  1992514984311664041 ,  2156252274882418819 ,  303086209447824699 ,  207676586618768862 ,  1925237166915945800 ,  1369074846724118864 ,  1815720356227287286 ,  257776432592207675 ,  1466668671938086241 ,  711936056878258549 }, // x^2^553
+
+{ 1557984771186607951 ,  1263725354668808338 ,  66537240834360482 ,  838100997694696896 ,  1319593888983771451 ,  400151780707677779 ,  811546657356029610 ,  346917061672167117 ,  1116280224788742345 ,  2107911433094035535 ,  1857082044012685157 ,  404568199791243486 ,  2007946278862700881 ,  677811729273586827 ,  693463062547123544 ,  2109189462191098492 ,  1208091347433873520 ,  2217648446551874584 ,  1714279675836578931 ,  397889460657071854 ,  332883004954587942 ,  2267981313113677806 ,  1768904198443097218 ,  1798673061906429176 ,  1510095705591743066 ,  462801885229054061 ,  975944684298583142 ,  2142453057000983594 ,  1294623081536204384 ,  1688904864571064244 ,  28825807755777001 ,  2177299273829442485 ,  1410286311941690613 ,  391715148391201264 ,  596510216888098190 ,  1305090389154886278 ,  1443462604973307355 ,  1303553456075612927 ,  1029043855565166542 ,  1834943486277681679 }, // x^2^554
+
+{ 494390119586928374 ,  1768911740539086579 ,  1452186415462183425 ,  1446495790458505094 ,  813731084891919361 ,  1833481333908235583 ,  1987841125736206066 ,  1932210955300855149 ,  1068380616800595332 ,  2071854252044491532 ,  1333701776822414035 ,  2171353926794847492 ,  481580344700157485 ,  1623425801463736407 ,  1042402903909744543 ,  729174053667511195 ,  603681377674285300 ,  1399202047922254158 ,  1775933339909669502 ,  2024568357079641964 ,  670066914415483813 ,  305595623177655985 ,  627897191036570560 ,  480393870421482932 ,  511434160860531492 ,  579984799193296220 ,  893383816650883545 ,  1394596774107159856 ,  1848467957401571337 ,  631910059731864140 ,  1912656474447357749 ,  839440888381318795 ,  455206082449099648 ,  2208498016678820054 ,  82112151688840768 ,  1167274506821779656 ,  218434972574435749 ,  2283081139987242531 ,  251840978459456263 ,  2295667820574104145 }, // x^2^555
+
+{ 1618593921944523978 ,  2140676751571614516 ,  1141226786477819071 ,  79487550664413055 ,  457555379554497582 ,  1225703783531091112 ,  2164014660587870781 ,  386090901574870704 ,  2022949825782286186 ,  706628308777153129 ,  2198058832519661010 ,  1593833670738899052 ,  1209725721478246350 ,  2051968583312994454 ,  565851783788629231 ,  84290215616899471 ,  1108773888181390679 ,  537487485390480753 ,  212206883509947081 ,  2029407084253544957 ,  1265232910625535956 ,  598393232175403875 ,  1133598904370765331 ,  550783618404471676 ,  264418835693619980 ,  876592824371384637 ,  2285558219332957763 ,  68787644411556517 ,  1678450746013946286 ,  338324989498305687 ,  54893455532725095 ,  1311862750947566696 ,  1009020418439917743 ,  39128449318520697 ,  392621226312267245 ,  97338712321653769 ,  1442769740831718628 ,  358739108906403794 ,  1266374717706418815 ,  852697060347417495 }, // x^2^556
+
+{ 527747650217731941 ,  2135692466536692718 ,  739458196196555608 ,  2113217705739195743 ,  2164069219006217150 ,  997458363238571215 ,  426219054463868196 ,  1372085556883119943 ,  1048079036848194289 ,  293348912362186460 ,  2272891993114582374 ,  1550941932856777150 ,  1188687469093999116 ,  637253031176476935 ,  975109053551611952 ,  1577667356003947929 ,  1581219932182676688 ,  69839590803609253 ,  923447556797823588 ,  1570417788141414160 ,  2163185397333239499 ,  922681034017667801 ,  1136002385371744225 ,  1397635194071125422 ,  1035696487644741027 ,  1576851585789479790 ,  1881490467897556272 ,  432214724242769842 ,  2173982400684468445 ,  908570685772001832 ,  564384722752822810 ,  1058313369244091408 ,  1349030523272527872 ,  492210359479433151 ,  1147494109294170244 ,  1701636112515119613 ,  858157137534642198 ,  1463612006135503263 ,  314912679888711600 ,  1466093672343248379 }, // x^2^557
+
+{ 258922277292400226 ,  1788257798608410905 ,  632819296637106311 ,  168848917117783632 ,  2260182400138790708 ,  2031349221210091855 ,  2239107274550424670 ,  43241273355960384 ,  565524131496393050 ,  666473988828565395 ,  1120939706895970308 ,  601372368255916120 ,  448860653040242457 ,  404482775336225581 ,  2170626164827260935 ,  209542015025187719 ,  18089531920845329 ,  299644065575707455 ,  1436723557598828155 ,  924459615050034538 ,  1413994790040177720 ,  936193940138982261 ,  371895777088506719 ,  1637659018211319524 ,  1325172646549817223 ,  529131862125519038 ,  2136214121813542655 ,  1238177929847501285 ,  1061753799428121645 ,  276351071473804417 ,  1622420437538343485 ,  1699738746296106995 ,  1305533526513274940 ,  840144099717789115 ,  2276936585569910938 ,  150859695796211746 ,  505301115511262438 ,  1184012322946475373 ,  791846381392553363 ,  1109925724229027810 }, // x^2^558
+
+{ 1818618349865426113 ,  639721609106351209 ,  1828978191616231975 ,  1402141098680321984 ,  670431489148948005 ,  1474247300002557348 ,  1250787824949540073 ,  2069898762605569143 ,  97914305169135009 ,  435199128341437190 ,  2156729055542620919 ,  1200538931720451111 ,  136238530495619450 ,  1945440727898797368 ,  1896766691995846775 ,  802453457438070769 ,  2227505096456957823 ,  1370936004404420326 ,  536050489676317276 ,  1682412660206632950 ,  1118535384135117658 ,  1309172521386336550 ,  930341519673713219 ,  1688179168522065080 ,  388018768455150165 ,  889015321779718632 ,  177105278395329797 ,  575823269580020 ,  57108030462915008 ,  617455640261772735 ,  112433371287863715 ,  1251598244173119934 ,  1177189597441672265 ,  1215208909134479235 ,  1166643300965743855 ,  1738075961244106309 ,  2161476597767176116 ,  1403243597114399515 ,  2008790454819339944 ,  55209800692924925 }, // x^2^559
+
+{ 1826990119519333135 ,  1701576785414339168 ,  899213906191582158 ,  1450408074556763739 ,  1927544072731762023 ,  1078731315983881351 ,  1515737531022518014 ,  980605040158441780 ,  1164637859212220143 ,  1968869820419655188 ,  1997696908776174156 ,  1772295378984594195 ,  182251633995026629 ,  1693337976655566495 ,  945068900902696918 ,  1945717156240115452 ,  1824267525225489425 ,  2031348637028423235 ,  1622361648729944822 ,  1321019989994245669 ,  1599297978333116449 ,  2157113554160837426 ,  2040361653067033688 ,  1101976902252242623 ,  1153272791437298927 ,  2082925014546526716 ,  1365440822840438140 ,  1736910435866097042 ,  1382823242283689400 ,  1660278480291006117 ,  2172269263468228269 ,  1929384813638502361 ,  1658096547205953052 ,  769568029949442973 ,  874057862085252881 ,  2086592646634342554 ,  446136069801764725 ,  706378103813425565 ,  446902726405842988 ,  718735669209019681 }, // x^2^560
+
+{ 556170715448892694 ,  1349798745060785531 ,  1019672471933147828 ,  438420231612009124 ,  446611488621705482 ,  1009354385407035040 ,  1083472742723694338 ,  221482344027101493 ,  957294672913326446 ,  289042776730581289 ,  1042465912372756695 ,  2097498219322914476 ,  1282588117409307342 ,  565726902569462278 ,  894200493063138960 ,  1213359917901118929 ,  1156009819666905062 ,  1045502100639587348 ,  398998814114904522 ,  1752652570254165198 ,  552750712472486480 ,  1003900608600611324 ,  266007760902158907 ,  2166977912272414569 ,  167665288243787285 ,  2046505177254229906 ,  1149307890413293603 ,  2253108346059690718 ,  2243337194632328080 ,  267528637052384601 ,  1994312567684310530 ,  709045755207537363 ,  1971325011761579542 ,  610867727205231384 ,  1420637795712198518 ,  1881964132387077589 ,  1229199054443284391 ,  1000127296261033698 ,  476344435288962709 ,  1235795206744254213 }, // x^2^561
+
+{ 1347019751448169232 ,  945789176905596250 ,  2157683662115419817 ,  1633513430852892163 ,  971683139949958833 ,  321937503043603041 ,  1350058076715267477 ,  1637451593948806377 ,  818760576171427035 ,  1020520932742267617 ,  1089494716085638404 ,  381538538790548088 ,  1321879199803109713 ,  162018866308858863 ,  1001484409166159799 ,  1339148615914812067 ,  551353563769972496 ,  1281287773045986095 ,  1208629863386743507 ,  1240268295098012279 ,  638486557939331447 ,  2212840371212103273 ,  1409708470411236188 ,  2283280154069782764 ,  1405841776387763838 ,  961882803309744053 ,  310616128495101501 ,  584576868977330433 ,  1203297662746380149 ,  386711125291710795 ,  1229879519619522951 ,  537649979960173336 ,  1925966815389396689 ,  1339847957259705982 ,  1719914376143106977 ,  533875658210692441 ,  710655860318230835 ,  2222147425921452590 ,  1942489948446330076 ,  1371519977067582086 }, // x^2^562
+
+{ 382274229540990114 ,  2102086421249596496 ,  1979934444349959235 ,  1267208645479903791 ,  930684561670434222 ,  530671026206083272 ,  98498059395884271 ,  2624541822089478 ,  442163398437939089 ,  205898396610378451 ,  2294148713200858089 ,  2141978743496408409 ,  1411193831411763131 ,  903867847315447907 ,  1711611946312916081 ,  975084506028393094 ,  32345244233625810 ,  572204926338204547 ,  226141949491616266 ,  132614552843709464 ,  2040585762326047310 ,  1691146368938096333 ,  76328274070575200 ,  1460109366516960717 ,  1505684086700324347 ,  1614846156573670283 ,  1627275405734888592 ,  2080043894623629348 ,  698087956430745805 ,  1961481602739942514 ,  706494791797809436 ,  101489702524493200 ,  480125133932046952 ,  1139230764696084733 ,  1432144091241878025 ,  1519497504307982277 ,  169312671977501160 ,  1716276786968274737 ,  1649816490009148109 ,  1470696432556131446 }, // x^2^563
+
+{ 854317466675407681 ,  633472974030103483 ,  1947291513692031686 ,  2051731523554440483 ,  1389413783229209539 ,  625136881542705821 ,  61342693192181011 ,  1669597418505120442 ,  598977383198812454 ,  225863611476772383 ,  1267541596648762360 ,  1469390707016411680 ,  1018445857287486300 ,  425603461585683870 ,  1648151657207071629 ,  1937127784089769611 ,  735309163268327930 ,  498355819342284742 ,  2231950603037902169 ,  77659906074016403 ,  1012197021062964753 ,  770733161804098911 ,  13508273060736986 ,  1763503792370720661 ,  2098011677650691643 ,  2033758097370742895 ,  550228614025099263 ,  110600008110738908 ,  1656034218102679946 ,  879998138923639941 ,  833464774726250554 ,  963630915074393244 ,  2216797391198475618 ,  1171604535626962370 ,  2175794731808807741 ,  1876203007989984236 ,  1836114595002674028 ,  1409290689772509813 ,  166072352884802473 ,  1610176450662142592 }, // x^2^564
+
+{ 22331385798030494 ,  1142401816906138970 ,  1252754717424686877 ,  411119736438761851 ,  935812229720636222 ,  82995173218344911 ,  1618085480490183428 ,  1044614336557257872 ,  172729362061287668 ,  1058639480102627762 ,  1526612283392369192 ,  796147924391446180 ,  1079018578353296529 ,  1804225137233924844 ,  1590187196660748966 ,  693076716417502290 ,  601195054982874085 ,  2032657857702897475 ,  2072244315195583102 ,  1717746659897003213 ,  1051789578595757030 ,  1574446997092501833 ,  1985518614197209306 ,  346360965407713131 ,  673098226660900127 ,  266094728059320191 ,  710341224671939353 ,  375057979166526883 ,  1895290790358207402 ,  1116366850410594878 ,  320953227737961611 ,  1287515405231831727 ,  1444636840228967299 ,  2080328171808836218 ,  1995309334014133485 ,  1333883427949138635 ,  1961442448254789654 ,  1641023948038021640 ,  2016215870650019961 ,  945724441961686163 }, // x^2^565
+
+{ 688186250816331436 ,  936943012615603939 ,  1687471820799053773 ,  1611579877322638660 ,  1406748433654846083 ,  1537546340619013552 ,  2287394532968787179 ,  851904486935097809 ,  1424258166909775206 ,  1603579057486565423 ,  736554894177024152 ,  742989256602161969 ,  1713503663049948771 ,  148264709640574788 ,  1879320595456442987 ,  1615276409083791851 ,  782521609380774731 ,  1676172461881486722 ,  1130176662166483833 ,  877182403501538513 ,  1908582867591335117 ,  461794037535388513 ,  1791766045747990462 ,  903829293896410550 ,  864130558278258934 ,  402103029620378938 ,  1042472160187147152 ,  234513278224938090 ,  650029334160880336 ,  1764990841542158005 ,  1889897383577940873 ,  1392930014518947587 ,  667816440355966740 ,  250690904626478258 ,  2038103312130907759 ,  2290106907000770684 ,  269193604173964004 ,  2020810924031965891 ,  2220526022484285840 ,  1326828933526284779 }, // x^2^566
+
+{ 1732851618895992452 ,  2012785370083367788 ,  211995292806677177 ,  482165725567898902 ,  983528193531932990 ,  9507534473072349 ,  1046376027103990405 ,  1373385462526869077 ,  735005089768074787 ,  2133241001214313069 ,  954516037700244730 ,  1864315939802355351 ,  173609842139410866 ,  1074949002123639402 ,  706246639619011649 ,  902681430816240148 ,  2223257722539388750 ,  1976359607624339313 ,  996266739808573556 ,  493747858883907778 ,  192248461059789499 ,  119738568729290833 ,  1782561858560465424 ,  792877540725357814 ,  925832287748140329 ,  1761189588787199198 ,  1957188887816020107 ,  291566843233317960 ,  1894786277574935682 ,  371980713034506237 ,  713403771764123555 ,  2266102653419378718 ,  561027784969997901 ,  1811692148357304576 ,  2103659374719299991 ,  1712862311421829830 ,  475555114404496161 ,  2072185243109634370 ,  625776843794804888 ,  538651267039117698 }, // x^2^567
+
+{ 1222705515035730156 ,  2169774281887489109 ,  2104592604460442826 ,  591522217233013478 ,  528401118701437065 ,  1878440882581755650 ,  2166980837968647904 ,  1613794928284709481 ,  1130504067707617122 ,  205751419870576 ,  1607215901819002947 ,  1983813315180074263 ,  2139991184444977403 ,  2133583634309371207 ,  516792033084978447 ,  1072553191601058110 ,  465178166059996655 ,  343772909094767755 ,  1155042070557066244 ,  648511051946334146 ,  2233201022489269700 ,  581853447862204043 ,  1130738385125141077 ,  2213455846888939043 ,  2095719651814845627 ,  618248110346075000 ,  820935672096009265 ,  1580805431416092735 ,  1820979677707568143 ,  1512311846834446915 ,  2618626062925831 ,  1241851263538826662 ,  1495543986004206942 ,  785464691935695981 ,  745175603371578902 ,  866200175980253517 ,  463364864379436457 ,  476830316788966798 ,  2058798962758773757 ,  333149230238245323 }, // x^2^568
+
+{ 2164115204437574135 ,  1620740043400803036 ,  1569103372616309632 ,  2064292688141902876 ,  566324802926982998 ,  1571808750198075535 ,  1912737981307256761 ,  820966378388230963 ,  1681971951156653295 ,  980719820855218347 ,  272992272473478655 ,  1291627292437633319 ,  2265318880911660563 ,  801406839900780531 ,  312281839029542027 ,  2247631633090710456 ,  1932075760203608588 ,  1245008089276664664 ,  1603665030100185423 ,  658405050344216901 ,  18966025047018030 ,  1533187944813184569 ,  1924125389292787752 ,  1751134238169847862 ,  1715787242652585251 ,  1116708671433638550 ,  1210221636629198692 ,  1748759038179430413 ,  688641951426145791 ,  1999363275993446656 ,  1356087509873474353 ,  1014569804769074686 ,  1704248576037692762 ,  567057267004550965 ,  1134619326505796700 ,  1256173838029548987 ,  1560555897157902758 ,  1793656837375122074 ,  715537575474694026 ,  2149222342720762695 }, // x^2^569
+
+{ 1645223890678002734 ,  1407592259488171082 ,  1835230793195976958 ,  1285593400613644262 ,  1149382911675685584 ,  334312356082324855 ,  663924146449491152 ,  907274508064094122 ,  1306556146047665464 ,  1342918571889672206 ,  557884044594642355 ,  1590026067892893820 ,  2131323552816447316 ,  449945309401611177 ,  675560163124109163 ,  1450926242832897693 ,  85740217103484489 ,  1345145558916839293 ,  546266420025921848 ,  1222623901040438382 ,  1850364765409495386 ,  786614643209124484 ,  2158691654094294457 ,  1122768118792557991 ,  1164386530263441770 ,  1590706086102431981 ,  124144826596113596 ,  2129745318583014402 ,  1466568142407911807 ,  209998098307935636 ,  92992513727652175 ,  2235764363834566737 ,  2019971041265215450 ,  1162743630362936198 ,  1573183887109814017 ,  1106178980160279160 ,  1708586343821565005 ,  1631274507068483802 ,  475810761282769732 ,  1390143785350306093 }, // x^2^570
+
+{ 1908178833351570116 ,  1074166266977418767 ,  366855342115103890 ,  929029776807983219 ,  84193912153579921 ,  150532637976978195 ,  1814705050878753509 ,  140967095109837923 ,  1356251535481115347 ,  732622646133465878 ,  1418429834705182776 ,  1198908792505439890 ,  2151313823230728112 ,  891819640532576315 ,  1105167022927213737 ,  523132376079059855 ,  1168891901736464441 ,  1006086140544988077 ,  989237428597949179 ,  2023120898477156855 ,  2142813209043468967 ,  85896159430070307 ,  1882846449560087056 ,  1486794792263898047 ,  991539338996425575 ,  2249489413333347766 ,  2293527643343954133 ,  1960498923853362326 ,  311859773645501114 ,  1797872993224159312 ,  868414390604139103 ,  1404936019882149792 ,  2001477736214287644 ,  702694998137394329 ,  793442079054387072 ,  32014077957061380 ,  541206660069555462 ,  774102889810276194 ,  1252174818994029139 ,  461462455508966389 }, // x^2^571
+
+{ 2175839631915026411 ,  1628786204890545397 ,  1194445309436557133 ,  846559403694117755 ,  427567569825539789 ,  592210637931135946 ,  37990694361341572 ,  2293949615909701742 ,  205876234319259702 ,  599620459776132643 ,  138638565552229823 ,  1989973160160466877 ,  585542455130771224 ,  749742106778682921 ,  1972919590025793469 ,  221703952192029353 ,  424863761427094802 ,  1632929323671823093 ,  1516933180959205582 ,  1993513587384776612 ,  192296341666899358 ,  689195869111743930 ,  2243922969137105632 ,  1970480397865102556 ,  2213544786990909976 ,  2296676569758859867 ,  1105570164276020075 ,  127883163625203531 ,  249100348598513711 ,  2121901524189391530 ,  1739760067362804018 ,  1115205733924174888 ,  1708464585465142164 ,  1351882830379634809 ,  1021860533191286052 ,  808521069628914153 ,  988714176286468300 ,  1639616366132970596 ,  1485692478767403453 ,  2297332874475081394 }, // x^2^572
+
+{ 1527234848851325078 ,  2154029928395870196 ,  1459196749313490645 ,  2203966776732514133 ,  2274620798364376218 ,  1888741692487413180 ,  1772674528519129965 ,  692575241248269931 ,  12740778457042942 ,  585514651713394139 ,  2292497732618764995 ,  1592868796324883954 ,  911775178171362101 ,  2014258709829300251 ,  1105051149818845640 ,  530906247474025322 ,  351189566487512549 ,  1962172682309163793 ,  787719227461265769 ,  857339937857107631 ,  749031435809442421 ,  2151778922319950366 ,  742815284160130410 ,  2230993612648304800 ,  1636733425008853276 ,  1077611890929567121 ,  1891970782443241260 ,  535376944662031432 ,  1221503364051311597 ,  1402383237466454224 ,  249674519472489259 ,  119633303851392912 ,  1175982980792396966 ,  1072607396588519267 ,  1276677941600880921 ,  163563954480072251 ,  56176324508141710 ,  1669548719025757358 ,  1847310212225414950 ,  2133814708751315630 }, // x^2^573
+
+{ 953319811306407316 ,  231144865642286826 ,  1808362380619738098 ,  515158177557259186 ,  1670687027507536137 ,  1014495906425471148 ,  14503702393407675 ,  1296916881751155703 ,  973587467097850866 ,  684654559210186850 ,  2152720916299972551 ,  1305213185831885022 ,  552192852206985262 ,  1205308167656888214 ,  2125351084321102053 ,  132452986141311184 ,  109078381067299170 ,  2020979922044814483 ,  1996526114087288431 ,  490082123517495531 ,  884642843479970459 ,  980675378373829959 ,  308461345148210984 ,  1477527341497222086 ,  962859448399674652 ,  291215929811466846 ,  944670920217005347 ,  1201535792199304961 ,  1067089433548777909 ,  2114427610427161664 ,  2033550244585933975 ,  207126414377226505 ,  627868230068793529 ,  1771114762093189404 ,  1874577393477266687 ,  791498160900135119 ,  1222152753631854697 ,  675852766397918317 ,  736590180914800687 ,  578212682530067795 }, // x^2^574
+
+{ 320919294147402667 ,  1347788419151343992 ,  1406990255878781200 ,  1894920159731269152 ,  1611890361040829233 ,  1758401831709877842 ,  696921235751686230 ,  162930316792916858 ,  304598311073629410 ,  1983047112960203446 ,  194427368717283771 ,  1603651649010896807 ,  1546547546999644943 ,  1786405850939215072 ,  1661846616743336512 ,  231508443252004864 ,  43340160713605532 ,  538719052308972346 ,  2249129261301596660 ,  1747147246301477378 ,  1741262652732430683 ,  269588578339037236 ,  1319083514162445280 ,  1966328607087557055 ,  821502880127785923 ,  1799799806686590779 ,  1455519200266506821 ,  990811726066022223 ,  1509508140680807871 ,  2270033146082170910 ,  492331436742279975 ,  2095389170660810898 ,  2283858675969700661 ,  1758679715833335973 ,  346202955761880397 ,  2168540044166560703 ,  299141148108237219 ,  1510587758028650038 ,  230798761362384067 ,  771944083975238300 }, // x^2^575
+
+{ 642851058764634990 ,  288078724278542009 ,  1295634780148672577 ,  1694458521375533352 ,  215996604059988986 ,  402787792654583955 ,  233563828653484585 ,  1611692155145942322 ,  24449783728246575 ,  745942869472410333 ,  356182231340428163 ,  996660081809141856 ,  830754041177983546 ,  2302250707134838392 ,  888818782133630086 ,  1422471399806566093 ,  1706335687996521161 ,  1946972629448902303 ,  77427415648049853 ,  1242955035817004815 ,  1421369430869438692 ,  2030703906755851465 ,  1991563326037920954 ,  666123267522382491 ,  1351396619117236977 ,  1705937841476418712 ,  944630820814599334 ,  921126808634714687 ,  292788826957533332 ,  912326331177906953 ,  2277012925970983387 ,  1875414948057813306 ,  523414260175594928 ,  1837808442559133237 ,  32185704836856046 ,  1955786308980504119 ,  2119699076758994052 ,  13633150328500301 ,  1810340598397626253 ,  1093739548387225191 }, // x^2^576
+
+{ 1765686488906463663 ,  1923199600436666766 ,  20001143572403834 ,  1765124817727763978 ,  2158318646433497006 ,  1072158765217700785 ,  1737270023358635514 ,  1724458099775889875 ,  521791380820913170 ,  2195623645519658547 ,  1191025674234251968 ,  1243262096235554941 ,  911935283425079606 ,  587589921462503107 ,  1498365378456200751 ,  1649906834867979985 ,  2295895661547817245 ,  1829123199793871370 ,  2060480440988115316 ,  965819582571426416 ,  1434692976619064260 ,  1550698598723260965 ,  433267227153998618 ,  1443951471325352758 ,  1499231144916745859 ,  1652683829907108564 ,  1176658029845857181 ,  362911026851624616 ,  803408385352668333 ,  1546135138112437320 ,  1861429270783019178 ,  1455710934577756823 ,  25790849193454849 ,  323471040852425767 ,  2034238041155153326 ,  858853469919386747 ,  1855243823493014512 ,  993585910325308515 ,  1541109583394557044 ,  588745224723924347 }, // x^2^577
+
+{ 356610703842744476 ,  2047661491662153010 ,  1630580249380507082 ,  2140795342790257966 ,  1680536930438772599 ,  805260351170714116 ,  273791222361680902 ,  1123810559653492008 ,  1708146735715390382 ,  1561322689648122187 ,  1304871437314133855 ,  1194314528974569783 ,  2099596180829083564 ,  2205984039322566311 ,  1316238983244251750 ,  711092448308851570 ,  2043988867857400465 ,  1110812015133572772 ,  1908614468469802388 ,  2219995191091708934 ,  865537809161229639 ,  1864585420839252004 ,  710755207696169590 ,  682215789211347125 ,  35646239422600033 ,  2079212498819373272 ,  1790563278489633253 ,  1611294725702052853 ,  1390619573076981226 ,  1105291340093509940 ,  1712210251025357377 ,  2001787904744712891 ,  1811133624897781163 ,  1828078704808019096 ,  791492480812812579 ,  2063506752181098480 ,  1294999809573168538 ,  118222631912891842 ,  276861018745905927 ,  1084656424623681039 }, // x^2^578
+
+{ 1680592512828834452 ,  1610988577205603295 ,  1514464822023687542 ,  1231244177172775047 ,  1961496802253381513 ,  22406442163065214 ,  384149470383764820 ,  2164186769374161731 ,  1732059240223081783 ,  1326230193077571993 ,  481903004831367362 ,  163117320082158902 ,  1398721247035682964 ,  1838488866141278674 ,  120184320888041150 ,  560696994884233965 ,  638627219435399082 ,  2139195866535677020 ,  860660586721400922 ,  545147436955475341 ,  1216501967076798617 ,  304520954104641055 ,  1649161936966065124 ,  1510718259460440771 ,  1628735401846152386 ,  874180130619649444 ,  1089225702193170232 ,  175427616536395129 ,  49678912565413428 ,  1422491108722543635 ,  1274458483820408874 ,  300050172833430670 ,  1344705913212894155 ,  111783132395964558 ,  266239164191959236 ,  2260051625896944043 ,  71349319823059559 ,  1986679604269322222 ,  1361348072013463842 ,  1964917399792930932 }, // x^2^579
+
+{ 923771314839277070 ,  1885311736679031055 ,  2137953607817813957 ,  1844997571313953843 ,  1724976049774557312 ,  707958572437600269 ,  1740159607076706901 ,  547791195830890210 ,  1910688315487706560 ,  1386518063443112270 ,  3298473126410887 ,  1006356080611136995 ,  1046074041886630299 ,  552624390661869974 ,  1108923532042506297 ,  289642725184778162 ,  1889366726861430893 ,  1507261432576669035 ,  1036810892139724037 ,  2196968143673791365 ,  2241732931048720818 ,  2215484829793217044 ,  323671499449073698 ,  2082958029074767067 ,  930331326893728064 ,  1098089485339331396 ,  922531450367625931 ,  2006055100650643259 ,  1885192558727317684 ,  123053436557251517 ,  1359099244045929106 ,  1631386581225526080 ,  1228399611930493052 ,  1310505198255971772 ,  503137504874462574 ,  657371069088489760 ,  527930407758926870 ,  899455052842087544 ,  147594509391368316 ,  951419041513584450 }, // x^2^580
+
+{ 928633316602974170 ,  2007030652060583879 ,  1982079965268061049 ,  730722222847592279 ,  1896945811075966633 ,  2234787257607601979 ,  1182170190205543348 ,  2126905706400623112 ,  17626937914254384 ,  857497039069966528 ,  802755947893362706 ,  1262975533455727817 ,  403428126781431673 ,  93998689129085235 ,  2276059692015548609 ,  941854653832926967 ,  2055828031580366910 ,  1110547407949114349 ,  983524975961817323 ,  662005047975985640 ,  1050905672888127010 ,  1638854393705768293 ,  558881153827215440 ,  59913121779422054 ,  433439379971106813 ,  324490149399142138 ,  2282062682013624834 ,  600877206988799095 ,  1419364794620057835 ,  2095350203344811289 ,  1529030187231859731 ,  486599470178579752 ,  1876597808090734354 ,  2270662832999688725 ,  1357398050832307175 ,  1951476992659175176 ,  531093899622425834 ,  25055215746141160 ,  468556578361620006 ,  251095798817184532 }, // x^2^581
+
+{ 228539507154373977 ,  1152368978842741540 ,  1231068139409828604 ,  1098531879075467195 ,  1887951038572362022 ,  934568730664194508 ,  1929072790327150723 ,  1165832352056136593 ,  2103555037187689984 ,  1306261274158482447 ,  610129393049891514 ,  510547252862769112 ,  2077400102579446836 ,  34810409751345405 ,  2214911691715983233 ,  995585218422819019 ,  1238696087694194802 ,  1230657278376841445 ,  450250074918098719 ,  1852517900588923499 ,  720947576897549183 ,  308413198546068443 ,  851112826893907257 ,  447740981405547567 ,  41997395531031785 ,  2211052276239944463 ,  1666306997379952774 ,  1016700716621962617 ,  1583510633956477533 ,  891627800347533392 ,  1159704132746372484 ,  1920031347830331690 ,  1150122123721808912 ,  1906719390779089297 ,  21306323219669434 ,  1849599091739619776 ,  1114800361076292695 ,  2150442896694072590 ,  111816954834512608 ,  83079886470503325 }, // x^2^582
+
+{ 710608786356902565 ,  763200232914437328 ,  2008586659918070051 ,  321865095105753177 ,  61533573305834752 ,  1849808636743875983 ,  499329743999111170 ,  361579488675268647 ,  646030207560770425 ,  234926415830018250 ,  1113960595164754587 ,  2099033883973431364 ,  893144137192804935 ,  490701891333561967 ,  1372137305780856384 ,  1636055369219173712 ,  1134833606574525515 ,  685781571560810692 ,  2216674498596430174 ,  1399877653117976591 ,  1077145161607303647 ,  115211079039491508 ,  1589495060203204494 ,  2134714519750968445 ,  1239760470269261384 ,  510981354062870994 ,  197548951904556429 ,  1523104464001244263 ,  754440880748365793 ,  1263902846615109105 ,  1222465576959088137 ,  1083665661712824484 ,  746898923127801340 ,  1888333775563815920 ,  2087939894457188965 ,  1356296617411584305 ,  773417742945081379 ,  8960197888997384 ,  1004728197699121491 ,  1958255088455329782 }, // x^2^583
+
+{ 1044724526164404998 ,  2234562031625888756 ,  784901961892478338 ,  84445431432646787 ,  631854769623514669 ,  1589754812017341866 ,  819504832103921089 ,  1894348204198247404 ,  404235287681802315 ,  82164228339510842 ,  1221760532850425535 ,  1898736838092841274 ,  613670081028603998 ,  771605383052284584 ,  759916273134022448 ,  247732209723013567 ,  1697915480332219407 ,  418768682991949572 ,  1418842517208403890 ,  1635318905059297560 ,  363212023640939373 ,  801012715644943470 ,  618101276523793758 ,  665078486813063923 ,  1728737167244483243 ,  1751138299996164253 ,  123342668388432584 ,  1485788683742448820 ,  716915748083104743 ,  1515091007551194449 ,  537663541874789926 ,  468880866852059301 ,  1519048199167109921 ,  514644860713162819 ,  2100091204781632031 ,  1554616563427226625 ,  2104829458603773657 ,  488226791580582714 ,  2261014307108608462 ,  550143880074511819 }, // x^2^584
+
+{ 599914125439763792 ,  323738799606182605 ,  2114254200783115647 ,  1874464234505683746 ,  1892448183656149619 ,  1759355253443477425 ,  1944637174266610739 ,  55719606623381403 ,  685726571661294714 ,  1458921901320599247 ,  786292957884642560 ,  772776995873189690 ,  155971526425663059 ,  386803740810022010 ,  756126950212389220 ,  1255472967977439660 ,  1479321913964724400 ,  1275691175732068314 ,  1775658849273322307 ,  1840296016055217995 ,  963287820990382717 ,  1943995218120111088 ,  901157903316648452 ,  283955097113250992 ,  1904632660857505138 ,  843045520689076338 ,  2279870210849475065 ,  614215819714829319 ,  1646177708163948447 ,  692245214867080988 ,  1313985993958919728 ,  477898324540528765 ,  1971316549555287271 ,  853793982487309659 ,  2105928311363923632 ,  622747346156153937 ,  1402841293644320268 ,  240013445498165525 ,  2023022375790250116 ,  1127775338680373402 }, // x^2^585
+
+{ 798771252432040956 ,  147535725588847868 ,  1099459700061063582 ,  456561686400746651 ,  377542892269315523 ,  151247911752018179 ,  1832242504440841574 ,  948461519489996940 ,  1225079948949072987 ,  561379203564114164 ,  1096736882852003564 ,  2185721399912960591 ,  140781075027170273 ,  1598335342503506851 ,  46548143655511919 ,  185051182832633215 ,  984901637296758113 ,  1509401547864080229 ,  1320517439296980630 ,  77447075234539803 ,  491812609716698691 ,  1205473002425991345 ,  285261804416427615 ,  103574087007656014 ,  772082351615279074 ,  740453604519749758 ,  1219268781524965409 ,  639006466136883821 ,  1033923338916039200 ,  1252624624014009672 ,  288913649165275837 ,  752579356857288403 ,  50599941520980915 ,  590925852284140497 ,  59651506480543461 ,  1297533319826539408 ,  1345633962749482130 ,  1579905058044253566 ,  1336793673692066775 ,  2004223690243132149 }, // x^2^586
+
+{ 518109403117755889 ,  1952319841661570533 ,  676571586418173288 ,  53039350195743553 ,  975720146414423697 ,  2055288372654901641 ,  2271270117275085497 ,  410842324135528362 ,  971528460651346068 ,  411934834549661903 ,  1381746312426188480 ,  1080256799306607209 ,  1139543958677508842 ,  635402758896008926 ,  1289573660506219529 ,  546028257251141001 ,  53679460078163817 ,  350933905135360201 ,  410211057729025503 ,  1303340721773549282 ,  1844596558771306662 ,  817520642180653529 ,  1657412443410094026 ,  2250295699335788134 ,  668564663583877065 ,  1246626347108326905 ,  773765845633590898 ,  1032025442717700036 ,  1808759503900062599 ,  1744578463881751993 ,  1218059527739200885 ,  73886443181847421 ,  31023083064611764 ,  18376813853879403 ,  125929408516551882 ,  331554261148731083 ,  792889792177062014 ,  1255455221122220869 ,  1300659836277808029 ,  1874611521696764633 }, // x^2^587
+
+{ 2006130561774696192 ,  2055637900600369587 ,  527367356498698311 ,  1310879669164321841 ,  1354737576890667622 ,  387228652454118850 ,  219645505615551730 ,  844577571113373530 ,  252789508783346757 ,  928192467540861936 ,  1490900335629229487 ,  586145728396075481 ,  882659904052273917 ,  2227547145512974567 ,  672313497486180157 ,  2214939333441899851 ,  97243612828693325 ,  1497405979998566820 ,  699432742798753479 ,  231427245317511321 ,  1571159293514883871 ,  7683792219576652 ,  383124594979749222 ,  204259398902716937 ,  2201935309854278222 ,  217497061723656632 ,  1064801041371273795 ,  1770645355503953101 ,  1640446324633347370 ,  864521090709862969 ,  1619084408760343185 ,  1816290648050834223 ,  105373150095027246 ,  1504098745271538771 ,  628565340658149911 ,  2221917206673518806 ,  1634738330237862102 ,  1544917001864932603 ,  542303685846369377 ,  928272221004704821 }, // x^2^588
+
+{ 1012456729622965808 ,  1395336204635778258 ,  1675427530971598754 ,  1297392815649868107 ,  198670519818850686 ,  1521236276529043951 ,  354738764449887219 ,  195133460252792742 ,  2001687110600900483 ,  232538756089473772 ,  528550034562710768 ,  426285009486650741 ,  1332180679812400928 ,  2126889486079448600 ,  1774734646287214608 ,  1083481303609445756 ,  425028170323656004 ,  838585157984642480 ,  2214802536923313362 ,  1043402119637376770 ,  698279835830933263 ,  259326380429214462 ,  2057496656270498900 ,  2222205557338261667 ,  159100906353170683 ,  2108809183962470727 ,  305133267197999518 ,  1424579057868649464 ,  270890708887092793 ,  135981396661822749 ,  567785115699780291 ,  2006844880181908546 ,  91783723265199807 ,  2068848804853025806 ,  1948184407984428066 ,  865524268282613989 ,  45594887845092963 ,  1465600607518170854 ,  2215548575248851444 ,  1208435443871821920 }, // x^2^589
+
+{ 918025902495819436 ,  456607966644960832 ,  54782236858813640 ,  1633983708864070661 ,  1405690611014147142 ,  262603549563756044 ,  909091931950817728 ,  1854073889356085944 ,  1443053179061292767 ,  790788613261194436 ,  399577891602928828 ,  1794673821919209342 ,  227329097387358106 ,  1040419317021741676 ,  219135274474616594 ,  1677547964586013741 ,  1605736244242469325 ,  1158167272442038694 ,  1073311767329824813 ,  373324173398377498 ,  1213602320411060214 ,  69414791393736928 ,  449461617397010439 ,  1941429423829596367 ,  1580727961959423300 ,  16644220106933075 ,  263943747055717107 ,  850235100458297763 ,  225698370820869783 ,  2062283736106845036 ,  332895913591036601 ,  2003923059827614001 ,  698492704018763018 ,  2187380284779483279 ,  370192974212577884 ,  1776462459620447328 ,  1028348580660468161 ,  160638099741018745 ,  963195150158895787 ,  1763063465095774212 }, // x^2^590
+
+{ 1693928416275001539 ,  1950777715067332489 ,  329649184925001618 ,  693220922507215395 ,  862658805575626377 ,  483811118413014116 ,  1977801310304252453 ,  1762165811024834178 ,  993580066381405855 ,  834907333530786807 ,  1428056794087835486 ,  2099979908726817628 ,  487860343692218895 ,  476444995852860012 ,  2207921070763886415 ,  523636604270948019 ,  1596275835479750202 ,  1797715449473858735 ,  998957636080053075 ,  2164556812554891557 ,  1784126798327184072 ,  1005498313895724723 ,  2048895118187522724 ,  1739749254832319605 ,  10488701620633128 ,  459876414651716314 ,  1595349835613345943 ,  2192009558113408173 ,  981461025627139675 ,  1638267595566025793 ,  2177630781726061366 ,  940665308619815409 ,  445122467087628160 ,  2037264428110451268 ,  1457963551088907799 ,  1169123054259143851 ,  1523131854972527305 ,  1833574036747830534 ,  2232415103942435146 ,  1547337244255373974 }, // x^2^591
+
+{ 1096656087052388395 ,  1439285044061339192 ,  1778528018413441675 ,  1445796900672673551 ,  891486189433422885 ,  1753203811060953284 ,  408268160445131483 ,  1177920412967434275 ,  2052891188939744677 ,  2019600489155028388 ,  1696499105464025205 ,  206442220811957347 ,  84176024987311662 ,  1951262166581276855 ,  1666575869346970762 ,  1409101607171308289 ,  1828148797130551227 ,  243271791037702493 ,  114311740365365621 ,  409480875899853602 ,  554015929803179693 ,  1333547149072888316 ,  467073963330789594 ,  467239565116654915 ,  1447459429776855073 ,  1731910412630245511 ,  1691165869603708187 ,  1185112050173394486 ,  1762609857270807201 ,  1387416206766922539 ,  1738477054107410036 ,  2090630939130666279 ,  2063613866579493005 ,  1189332959721560590 ,  422870986956218749 ,  383363177509849065 ,  1927741694874766672 ,  1896467298708904366 ,  229437051103164955 ,  1364385761303344501 }, // x^2^592
+
+{ 1265443690830199490 ,  1653872521678534310 ,  1128663249255629140 ,  1688133460727986952 ,  2180447746783335471 ,  1528958034484355291 ,  827648876027331917 ,  1814213802460524365 ,  2108030918941218588 ,  641568729288039628 ,  311454959653256699 ,  1537922709701687700 ,  753703115854140735 ,  20402140393045856 ,  314711089228759218 ,  912344683055104712 ,  863718829019077148 ,  2138160704450724994 ,  75551119011492188 ,  1611233401993831133 ,  834294400796043722 ,  1492725825053179560 ,  1451968971252291706 ,  1529442949419573085 ,  934526207948493723 ,  1934101890328009697 ,  878128136075645149 ,  1416445391800670383 ,  1215292252258173950 ,  1916593925307348806 ,  898253081759642900 ,  1724124128285601320 ,  260383991347990018 ,  936620050743848456 ,  1305929862437758505 ,  690827604360247327 ,  1363177316426177692 ,  1165616038090911670 ,  1168185232099683032 ,  540318537316811734 }, // x^2^593
+
+{ 1694576959101635878 ,  902873752388570729 ,  1422849899840060123 ,  742349664217559695 ,  2189232679535895458 ,  641744206323412250 ,  1402434969245895897 ,  405974251723491355 ,  677749215998273401 ,  134531949639637692 ,  1934073339940712990 ,  1130533787161316749 ,  382081109520657202 ,  926511205018511974 ,  997097978276069556 ,  2010269152316865381 ,  2213116195116761767 ,  1524072240981950645 ,  885460429436258112 ,  1621824584024290856 ,  136666718731686537 ,  1129394110353568867 ,  1657594788172445511 ,  1721972582759266490 ,  1699242522208800837 ,  270676844258649783 ,  1710756102949264096 ,  684152273942898751 ,  1108024233019853503 ,  177078834789455461 ,  2036917595133213437 ,  1645259736201372914 ,  1230451994556001887 ,  72153204247069942 ,  1189597275630583536 ,  2020401876662609255 ,  820741263729599442 ,  2031961975182417569 ,  576478436438880374 ,  1096608865734448696 }, // x^2^594
+
+{ 1615801489144117384 ,  1377221668715074344 ,  1988809515291632297 ,  1987758384797973200 ,  1633888110542634514 ,  1035912224239806930 ,  1922167242939833349 ,  689852243980002492 ,  375416012477212559 ,  1338669405089827856 ,  1415703365008213500 ,  773543003309841954 ,  148974668962230655 ,  2276100772533574671 ,  311960405898192476 ,  626914884447872041 ,  2059553361172755816 ,  772497523884053290 ,  992002015547097929 ,  921943953236116697 ,  2179115482397627160 ,  587682383351336266 ,  4379112732601599 ,  1229482573695836540 ,  2288036026143369285 ,  547958348129992927 ,  790394053116601549 ,  696669005042858421 ,  2099488713660874923 ,  882371418408265370 ,  1396065725337890631 ,  2222766368232931858 ,  945361622075800686 ,  325126611149365160 ,  1159977186015024392 ,  567815386697798594 ,  956491357355108333 ,  2230661259376299186 ,  1728505535740452270 ,  2129027097230093093 }, // x^2^595
+
+{ 1588032082361697441 ,  1849860570234873477 ,  929506778807055972 ,  1199992723970632380 ,  1328444593435966357 ,  7091104077492114 ,  1459503733364356180 ,  721499699139197279 ,  1500810327551259286 ,  518368356582070577 ,  1614073865531016818 ,  936484938091872967 ,  32734344061164464 ,  440613243216873322 ,  1686497265506210154 ,  168541530968417693 ,  1400662797841323749 ,  591908806043036287 ,  2279244454239978246 ,  197696428510617469 ,  2280740260601976236 ,  787559050404709792 ,  911592627569056399 ,  232698710143276548 ,  865916954320389938 ,  1733841304223939247 ,  162249801938012366 ,  2265639881899908782 ,  571938315287358919 ,  686087747591006653 ,  308738260995526693 ,  731448223688490081 ,  1313604842601036822 ,  170063729185355411 ,  840721607587916236 ,  1575655557662202888 ,  75136119113600372 ,  979723506443972895 ,  1018610664033501161 ,  1213148534938976773 }, // x^2^596
+
+{ 2002613045369851502 ,  605132096468820515 ,  367778558559692087 ,  1657747479377623878 ,  383524933019473984 ,  846878098903803900 ,  2099051582438083930 ,  224295213126500928 ,  106114449720708094 ,  164679507614732262 ,  1561702744265101881 ,  1309881716776284385 ,  2021677687869878969 ,  2249555559537265877 ,  871244960185073213 ,  1033605263616922296 ,  279219904446657235 ,  462059660133317844 ,  529253865005049027 ,  8776441107314403 ,  2158363421070904780 ,  1514326981846917050 ,  806822847905248196 ,  1628630879143226979 ,  1755837128496514825 ,  60792035050649956 ,  2124692367422449675 ,  1770083975446778529 ,  1765862356906542113 ,  538157634719114780 ,  817192274274297196 ,  603886433624999286 ,  1831610145755406632 ,  1083465760594288083 ,  891983263942363345 ,  1035789222202622558 ,  817555152916267924 ,  1232044534908651943 ,  2228208691242064339 ,  1471945660776119751 }, // x^2^597
+
+{ 1499427897937563048 ,  409272259570657619 ,  873761730517475697 ,  206870340204854891 ,  228100761226161696 ,  426288393869565334 ,  1971723093798342437 ,  1529716082812415853 ,  1238400470084127944 ,  329348457381411832 ,  1256593248659675898 ,  2099044794226247483 ,  2109761625231684446 ,  589142975921162290 ,  1993570708520584167 ,  1805990710373911438 ,  861436380839121327 ,  1900245662529064764 ,  662990160958654951 ,  1241470930817622003 ,  1322074232425998158 ,  1922274881943112264 ,  727268614571858583 ,  313108468602522295 ,  446135936068052276 ,  2115636934870303389 ,  1666214636097947175 ,  610993937304958706 ,  1478304346290836962 ,  2100015673290558073 ,  1795536102007412219 ,  2297253242407123244 ,  1521584890295279684 ,  62686070430148203 ,  173245045904325573 ,  2027900722802790900 ,  1179656925538611822 ,  2148033837981096482 ,  1179014308328602010 ,  1940366348348037783 }, // x^2^598
+
+{ 1317595832150553540 ,  934243178686954290 ,  1849592563190841729 ,  348297479146944895 ,  2080049721744978591 ,  1762941802386578641 ,  243107839738286508 ,  770228142627061063 ,  1780656099299290613 ,  1609659972782258458 ,  1460591637630932356 ,  1879984525211403705 ,  1201142105586151009 ,  2259659897621393307 ,  1170739822409597066 ,  1872571367693965767 ,  984479505528006786 ,  43031376781878006 ,  246169205664373811 ,  2014067811178733648 ,  1803939922586842117 ,  186262743618870268 ,  77953297264966991 ,  988743906454000350 ,  1179115082113086095 ,  88414323485827815 ,  1682030951759901377 ,  1947102246555745065 ,  528122434569942163 ,  2080557112684577632 ,  1002140401332317618 ,  302714442917306597 ,  775328560322608934 ,  959634900055225050 ,  913118321168289938 ,  1887121292256733766 ,  643649241498974565 ,  6171506837758419 ,  1146854435315639737 ,  750975736958131163 }, // x^2^599
+
+{ 1230001767187416087 ,  927055274816732421 ,  1950249312242913493 ,  925427518144394855 ,  1345109506251052489 ,  687726144773969979 ,  1751129309814372847 ,  1953462005808512145 ,  1255557317819478065 ,  315156888423471527 ,  1938141230374358922 ,  56902849742601230 ,  1353922488664893754 ,  1824640828735150877 ,  1070984044356721319 ,  256188545343197793 ,  2299962123404811485 ,  1860906773548279246 ,  1379338438859093584 ,  1024101170526533800 ,  710191478015991025 ,  2161719500646559632 ,  32114513534898489 ,  782839896852571542 ,  1258206347695191998 ,  1808687132393659993 ,  942475890794417908 ,  1608993634620911183 ,  2193233541039542993 ,  1079709551618133705 ,  1468732689974674157 ,  2204982567316381292 ,  116329655502322745 ,  369037978626082489 ,  867387830982468108 ,  1058521128288125128 ,  2192217334227603208 ,  1913466390194079673 ,  1851754361822161549 ,  1057947001583413760 }, // x^2^600
+
+{ 446875212569694640 ,  131472388154937327 ,  1867791620861548911 ,  1846470474239260787 ,  1340881618368191377 ,  915021390279697279 ,  958135290888736553 ,  2152741502667467748 ,  405812044545643737 ,  769108306436543240 ,  1558017676304148321 ,  1094023779094637549 ,  1173870256669188236 ,  598848811874787786 ,  180644882589997530 ,  496060516505678983 ,  723599989643193098 ,  696149575624683027 ,  416745927106462863 ,  1255391667082627406 ,  872144076718695236 ,  1256268239643001437 ,  2229584384979359368 ,  2275073229711841498 ,  1484033551042449314 ,  747327919083662052 ,  2226451624510510925 ,  1564858523720984088 ,  1436636435430769818 ,  373505566174470951 ,  1853360407836532557 ,  418997155966250845 ,  2149510131622161990 ,  1824947084652050366 ,  463071259712319426 ,  1976717280635738973 ,  1168432307158746950 ,  513409183687820223 ,  233289164838395698 ,  2261073815780573690 }, // x^2^601
+
+{ 1963202377254647871 ,  1842338906622963187 ,  1711066337411652279 ,  2055712342802489204 ,  1562231612777196022 ,  1457546867582961616 ,  999518410774909722 ,  1720342198094031437 ,  136472361885704961 ,  1807305617132364398 ,  1513430375870849209 ,  1442342584886792947 ,  146558982115960805 ,  1746979142999700784 ,  1872403044404380660 ,  50617225937803751 ,  1230737570492419856 ,  1065673844876674559 ,  1161963880122016666 ,  116580173912722188 ,  204261743361463608 ,  2172768458145589755 ,  928177008950298646 ,  1036064003658676880 ,  569279192026721531 ,  1431966830899654163 ,  1961625107260470627 ,  2221027172488439461 ,  807049929495851177 ,  832917338786964321 ,  218526090280083881 ,  2076544432974620966 ,  881252183227363035 ,  1684524786772216178 ,  545195288480706252 ,  509841782797270334 ,  2161449217914317626 ,  1552460983119407075 ,  729903187567984839 ,  2157070463792929951 }, // x^2^602
+
+{ 1005614400596185882 ,  2128273524089743297 ,  2111078319277795439 ,  1937606136929699291 ,  1052134125409987351 ,  2285971707410434940 ,  1334507176371874716 ,  332414201387237681 ,  100856852058691210 ,  28273765535812712 ,  482932573877066889 ,  599477902102794658 ,  1062220154903850374 ,  92702230619161249 ,  2266314362145817747 ,  1357293925177209167 ,  1215346077599259220 ,  2025015290766752862 ,  444233076677493128 ,  2011592750526838991 ,  2063099692215097832 ,  2032696944925550790 ,  1156060605566763159 ,  221549688405175822 ,  648735196584527957 ,  1176395662542023926 ,  431124042051001110 ,  1071159865427239541 ,  1395919654437201228 ,  711459026410332506 ,  95319598862150233 ,  463157695002563198 ,  390956127779265230 ,  1357270450185143184 ,  1030838381124279078 ,  1184909236412172144 ,  44849930243785398 ,  889005824112616952 ,  1377609862589563877 ,  1714143547269248596 }, // x^2^603
+
+{ 1761262403014068503 ,  750715793802172772 ,  232138269287909635 ,  1215617808673035377 ,  2218142624008268419 ,  1788609443021376615 ,  2285466262454021549 ,  1985696235090652399 ,  1925821637796519369 ,  1128259901282171075 ,  854337452627522777 ,  1897710552699789559 ,  2081949461668569112 ,  1160130261612548308 ,  756769051679398111 ,  1941742172450983690 ,  2229471835813971673 ,  1015099003968150798 ,  953975284481748524 ,  879888893454334752 ,  2043074547289659104 ,  1026162174098442264 ,  1933298207477978324 ,  622281704034130753 ,  131863220640626829 ,  1927231384487915662 ,  1920818057153439214 ,  1227471297981249836 ,  1420477600908278832 ,  1333188610079087133 ,  135184115293175395 ,  524301687565568293 ,  1227252090373445148 ,  1106387582223649389 ,  1684522437411227885 ,  1287740527586990660 ,  879329047423625823 ,  1685220029040346541 ,  2067890474699971670 ,  1790347003475122179 }, // x^2^604
+
+{ 685420493969144720 ,  508219404157235885 ,  1379267082632570603 ,  2244835790904980916 ,  1848491213201271074 ,  697857108500392165 ,  2250396256853466584 ,  2190773118282705365 ,  1989497089864907018 ,  322940982904526992 ,  107042982429383491 ,  353217500472795472 ,  1008822522601161026 ,  1033210736827823580 ,  1962877205157162935 ,  482893419370752339 ,  609958379713842995 ,  1096455120688049248 ,  18735384946411543 ,  1285961856534991403 ,  1921638714737441852 ,  730761404776885855 ,  842443237170370671 ,  925722456912693235 ,  1453576348527507985 ,  948311990900665822 ,  388671243737177061 ,  1596542645101856145 ,  838062924690049843 ,  461002802076242871 ,  1258366507235525577 ,  657393072465829641 ,  2122986499056817702 ,  555783811857580169 ,  1079074657940955776 ,  266831055056385319 ,  1388443623431306115 ,  1400846695473619500 ,  1384818610923397174 ,  2167933640767708373 }, // x^2^605
+
+{ 1099429921217757033 ,  77004540297875286 ,  632321784485995567 ,  434259457524723691 ,  2006966155580127148 ,  1332065268632161325 ,  424981480092443598 ,  37517012238763931 ,  1252448611499538511 ,  625600752032297074 ,  1831131536228802857 ,  662444492867543684 ,  2165067927700612977 ,  1202885692439944744 ,  148739468972746963 ,  2126808595504425281 ,  1710477012062168432 ,  778762076434253460 ,  210342523093824706 ,  1331045216152389334 ,  1004361429115679929 ,  864651356858148870 ,  1279066379355445416 ,  779184004002969596 ,  156428661971117446 ,  984990603525444044 ,  115385118291823116 ,  818554092554305874 ,  1663937584324879384 ,  334116340553837556 ,  1799315029257361417 ,  435163711420733432 ,  1429788463807057931 ,  1855174156408730026 ,  1508149953346242507 ,  1468737130729950406 ,  1867975052597092018 ,  1206232724491290341 ,  1828706078174751471 ,  34905725910623800 }, // x^2^606
+
+{ 908315022344005822 ,  398819262848173479 ,  1421502131715157405 ,  2224704085627064358 ,  1674279353833757981 ,  1904041964362398993 ,  995276499920694899 ,  2137428509916433275 ,  1983354731786234721 ,  1117541680996369722 ,  333299853477731643 ,  22540477848306380 ,  1189498992947572988 ,  1961781288603760523 ,  175831520817932803 ,  508827272356794035 ,  1864100252714866995 ,  1731065517697271734 ,  1764468603927593720 ,  1314903452688049063 ,  1892430703256864199 ,  2291185003366655360 ,  2264624676728736293 ,  2021240483743782328 ,  1385628825831270626 ,  2163696360813923520 ,  238472628232271083 ,  880783974991133156 ,  2245208390391282048 ,  2166027988095207536 ,  2109853934244169739 ,  1190011470940673074 ,  238813533919119594 ,  1991359749822728637 ,  158085832596981915 ,  1994744986313151120 ,  1216306680499667520 ,  1409442352373224098 ,  2295358204313289045 ,  1083256594492829135 }, // x^2^607
+
+{ 1557104248098033444 ,  1591135664503223710 ,  723945655222116331 ,  1004028850294669580 ,  2044053508876128336 ,  526890078223526225 ,  1433170756838806621 ,  1250196001567303089 ,  254026837945148040 ,  1909174021711122325 ,  460742087533563362 ,  453385367340801026 ,  1281664492711730638 ,  886731339164461294 ,  1344304944810181130 ,  1203803743683758573 ,  617937678286481697 ,  1430516358350961429 ,  1690154185883135874 ,  2098077170161433274 ,  1868155492789510615 ,  501074533697335056 ,  973267963856133204 ,  236431107267210837 ,  353350855592576043 ,  1613926490194691557 ,  2073044055445040912 ,  1736523580153445166 ,  1931208172718836523 ,  342789905165676229 ,  276717852509480919 ,  321854822775981618 ,  491635225220582057 ,  1300238141314745416 ,  618259428957134860 ,  1973826445499518224 ,  177865992729744788 ,  147243809721011583 ,  1745888208789103528 ,  1721125840457935472 }, // x^2^608
+
+{ 1113496660716353694 ,  746282844161429348 ,  494740032501719969 ,  1341016371370215014 ,  825063986572320340 ,  375069745038144363 ,  23751416984778151 ,  700117258090509819 ,  2230228003441550910 ,  674045728550429841 ,  1999217590849337318 ,  1050131691300289502 ,  518034021438634943 ,  2027600209154634891 ,  1561534701516327924 ,  79825563838020417 ,  704218030604992823 ,  982820218306694460 ,  690082899634859327 ,  1350991649092654032 ,  420652073229342546 ,  122376041087031720 ,  247374634171020511 ,  1087057027393632805 ,  1838848391941115899 ,  1073923302820503181 ,  1773057307236266830 ,  208393943787714924 ,  1042829000897379951 ,  1754198215574367164 ,  1163195189739092860 ,  407537667017003285 ,  1965011943760118737 ,  1608469655511073663 ,  1431862192893160424 ,  973743906450635359 ,  1218869795703377361 ,  1047779936855408286 ,  1558618389514332043 ,  1144669766443860108 }, // x^2^609
+
+{ 802586682405888571 ,  48317042140755047 ,  123470982967862404 ,  1751194906794211023 ,  345900182349156230 ,  2094707224191925308 ,  840692034797074759 ,  1829966760447952453 ,  2203403541937452704 ,  1343185834813050869 ,  542825980265218785 ,  91972246748817393 ,  776094136687791748 ,  1429047902511907428 ,  171845799783533960 ,  1185851681980906634 ,  1307768689734872964 ,  1663536116052390612 ,  1904753619718620777 ,  479385374637950519 ,  2069162609472293494 ,  709668918648755470 ,  2143933406076367019 ,  1963197906616406997 ,  2011337872179854240 ,  1882414339345232549 ,  627687000528520279 ,  721051313377380121 ,  1440688369475809891 ,  374592468524213558 ,  916953638710846232 ,  2097698750777094810 ,  2142844841228467622 ,  1670138720898273639 ,  1748766595516102698 ,  1063893862888985312 ,  1638420284157777613 ,  2090281669105338890 ,  16064119195362978 ,  1546580025938809713 }, // x^2^610
+
+{ 76627846526318067 ,  609679367946149883 ,  292738411392364693 ,  1957922537414170376 ,  1589193960558247295 ,  1599206067463095777 ,  1135156430266409353 ,  960767492821486120 ,  2120491638556043649 ,  230177961101429505 ,  406444166230030096 ,  2218305498429948456 ,  395108976339934887 ,  1230943896650768719 ,  1183152292092560303 ,  1566144761336976539 ,  1169930098759010315 ,  2003071931351994621 ,  987148244615651052 ,  149488101336170241 ,  1647004577351391972 ,  2149274541795421033 ,  2278688992386911688 ,  972443861232956060 ,  1453951023206043973 ,  1856629965577219390 ,  417815119534005991 ,  1564340963038458017 ,  29071635280138124 ,  1941345342832645320 ,  1844154155671170554 ,  1301617130703325330 ,  684709158076969982 ,  2189868861683244280 ,  1781052817702458199 ,  2175341954664216058 ,  701609705137195194 ,  223987540077516110 ,  810235417740458406 ,  2075856539632406652 }, // x^2^611
+
+{ 110419402744680670 ,  2095991674623553785 ,  1429929374922992028 ,  1928809326903414324 ,  32974876685858903 ,  897431919681484896 ,  690388929232589228 ,  1906097020013849430 ,  980918364004429080 ,  752771283627786256 ,  928705201037916247 ,  891750298846514339 ,  2165569364977673708 ,  1045394062880210241 ,  1611092857746119327 ,  107566437204173899 ,  701699884310188809 ,  229220587638978845 ,  2224941791113724297 ,  531897120732820356 ,  1688748435342052615 ,  218718300437258507 ,  1529233086667307442 ,  1152292466652212356 ,  102624189945913434 ,  55340001495637998 ,  527574825309635398 ,  21069257624428778 ,  584176383826812946 ,  259325392444609371 ,  2189900868492148920 ,  1499145119774048657 ,  1537196732241581318 ,  1558421637660053854 ,  1854406858838405878 ,  1014078178154494301 ,  1587315935735210371 ,  276015000758415713 ,  1001941072742759046 ,  293257549300021182 }, // x^2^612
+
+{ 702190462176852745 ,  539944849696799650 ,  1125447666744355108 ,  405697963837152476 ,  404965958530068116 ,  1458245939725365599 ,  1892103949676671511 ,  1564964560142177584 ,  271008085489981164 ,  761245375218088630 ,  2305657438444047156 ,  1604919352298447774 ,  1353657985986346385 ,  93366086938019670 ,  2296293443179223882 ,  1570306148449550171 ,  212878218270392472 ,  2236929896175284774 ,  901210864137673192 ,  1789498379677877516 ,  2264394725035891146 ,  1795220805293054483 ,  1626029006946217684 ,  1664952310810327407 ,  1987521339216183092 ,  1023496690370986612 ,  1136405588164952822 ,  1842598889736016832 ,  1959327782661936944 ,  431927236854501304 ,  145212273219333537 ,  1285573374121034932 ,  379944618622355784 ,  947215193095207048 ,  1505806832161869134 ,  222446902160785564 ,  554273421690249314 ,  463776252095600015 ,  1591921016202610351 ,  1023934403171268767 }, // x^2^613
+
+{ 693030321104954012 ,  2226018937682467481 ,  2237163497673843149 ,  802454646836375011 ,  694423612321512459 ,  544174743770901597 ,  1979742546377523194 ,  135986798410913375 ,  1316623818376087404 ,  818645638970205612 ,  1507784640493343957 ,  481484681881435917 ,  881821558618789516 ,  1997712194026576081 ,  2125422875688225854 ,  2026601308332384574 ,  578261410787655312 ,  1654302417896510064 ,  864546851097533770 ,  2300253079747211886 ,  621226492957401582 ,  802092212385014040 ,  2216703444665033955 ,  648697164098704296 ,  578307502323694319 ,  2111048566190374859 ,  2038007413398720048 ,  1698013069313418499 ,  2223247398603011820 ,  1994286524031530829 ,  2215361518483240933 ,  1977949083627733945 ,  2162248794478069222 ,  2262254899540009729 ,  956561021646321235 ,  1369606069979524065 ,  2164423133176702119 ,  1621344903575861050 ,  1945335910674555856 ,  2140435191901467287 }, // x^2^614
+
+{ 1270506237873120786 ,  750111873051826585 ,  616369201400024175 ,  2194818021844839735 ,  539515013581791934 ,  809270927576998152 ,  1675286146825551490 ,  468693574327961283 ,  25611788361160635 ,  733127852696523509 ,  443519950193213242 ,  772060995188217691 ,  971383870526801716 ,  226846815509642329 ,  1870224216821920903 ,  143623847739675825 ,  1050614439022866306 ,  1308027951385735972 ,  1214885140767303114 ,  2105545603328986077 ,  2023354837556377243 ,  268145065378932499 ,  1291414558798720273 ,  321026460420743170 ,  1261120720457199191 ,  633931043028181696 ,  1460601700077407883 ,  758238247077020845 ,  2186160654169421814 ,  1063170491025512691 ,  173700289757052880 ,  2050291737826246575 ,  771899112502853855 ,  1647266363855722770 ,  424065782413672812 ,  2162225775481753134 ,  1965087969438913751 ,  1472509214215096121 ,  51190045874371242 ,  456128803591144247 }, // x^2^615
+
+{ 319399194517492138 ,  970885538257631394 ,  1209482835358863853 ,  360850507345824899 ,  1416860140219158396 ,  287500296363944446 ,  420683097042245906 ,  976350339390862941 ,  878334682596096832 ,  477952831501435593 ,  1915354136348665373 ,  942422252852216565 ,  1470080465407953579 ,  1113852375386833177 ,  1985134454865939759 ,  2286092555930097660 ,  2302751118777843786 ,  1784650249661519316 ,  1359913063716407370 ,  867735001391023867 ,  962466868944147109 ,  1857596877870242144 ,  445411643347899859 ,  635684438481044917 ,  1136581940936501288 ,  2217052243486750031 ,  1275864549305953278 ,  732865521702491000 ,  1752996277221904630 ,  208158698376404955 ,  485317851087266716 ,  1142794547504030686 ,  2121741211345274548 ,  1316990746091665331 ,  140638022102483871 ,  2024458852805885780 ,  2074074609900952418 ,  446920824764744231 ,  1292058482024746250 ,  1973543505160245867 }, // x^2^616
+
+{ 1167590737194923171 ,  678924700089194094 ,  2048653437375436815 ,  1351200132225307896 ,  1893904072107870865 ,  668331782396855168 ,  1459616900221024403 ,  1114572160399658577 ,  1219317877483859069 ,  1885297373959155693 ,  2133969083145450969 ,  2162159292359083340 ,  304818971369904753 ,  1076665989237421575 ,  305418975511449062 ,  983822650324813170 ,  449589104319412478 ,  793643622083625899 ,  1178535347858163729 ,  1297769740809092568 ,  1391301679815954110 ,  751134946178615083 ,  2181247614827027041 ,  1221195777601556515 ,  1523275995417846794 ,  441549045250225543 ,  684607186024386563 ,  803877926624153012 ,  323551556179804228 ,  1874173233771559013 ,  1342404257048724419 ,  2187993288724260650 ,  1631428204038599147 ,  1262242888489945939 ,  414738219819001039 ,  23909130730895514 ,  480288225834322694 ,  1001339164439009544 ,  514788800038410452 ,  2079777108517651346 }, // x^2^617
+
+{ 3705886583526811 ,  2227786341514289527 ,  406423702508941685 ,  492649046211749582 ,  1255657560362556710 ,  751150698125995099 ,  583124795473402954 ,  1482825955185869754 ,  1230685828831318066 ,  1646577179971938119 ,  1895624460151751721 ,  813182710190247624 ,  29834521092756448 ,  1547434006658249405 ,  1835061843555455360 ,  1033188701389031222 ,  1416543969845788791 ,  1438428260331908902 ,  874238235789905365 ,  1329568472578161848 ,  833250241643648666 ,  1301444732377576938 ,  223760486349967658 ,  1276992144293793178 ,  1040136435632064139 ,  502533603174701044 ,  449778714494731188 ,  1928616263409083797 ,  1472467508243960766 ,  583108072091710267 ,  1346287220610646950 ,  2163059968131878885 ,  2168621590502053156 ,  1710069667371579287 ,  761836541828647085 ,  1462474973427804030 ,  2056949446032084939 ,  1003354631480872501 ,  1289213264481662260 ,  1824767828279042903 }, // x^2^618
+
+{ 1324297666989377834 ,  385725325859854417 ,  1423252842423895117 ,  2254652797610197652 ,  751394951153301220 ,  1743626267357284069 ,  2286635774030684570 ,  1609450144551025993 ,  1684541499171682952 ,  1074221101937932803 ,  112233709042869254 ,  1998780644607894386 ,  6801434890995157 ,  2130221839822000242 ,  827631257062950847 ,  977876953066497285 ,  2237029939818513334 ,  888014879369611689 ,  140905001760578190 ,  1255521296403982726 ,  1011359625080166211 ,  2233192156274953626 ,  610794552864083502 ,  1605274562182968942 ,  245345380045316232 ,  543402904971365975 ,  1097682071977206211 ,  1273005732082729849 ,  474654192518059841 ,  199565679971795214 ,  925324821208763602 ,  1685274737753042386 ,  1834148300232007466 ,  2258704201055428000 ,  2281930915765456372 ,  590258277568041624 ,  2190312440956595747 ,  1787663930265768212 ,  2070961036356842305 ,  1782156228137965805 }, // x^2^619
+
+{ 1382182162918579748 ,  338346353909610886 ,  2072737112484082680 ,  374824780977531608 ,  277323210691566889 ,  847598580078642757 ,  909924455079247836 ,  37585995201366945 ,  1324332334038072388 ,  1508599979930195913 ,  1603947976024243279 ,  2246769207760134964 ,  574645636103020073 ,  1121337197199042924 ,  2227199548968654228 ,  2135211071939115675 ,  523135258938028485 ,  355113743097739074 ,  96227430954683598 ,  1447682880059904510 ,  329527204556647471 ,  1995872147080448531 ,  2243505233347005776 ,  1611340985815023837 ,  1191555046442309290 ,  490428727677205880 ,  636876554345427800 ,  746783713196368370 ,  2110421900128727026 ,  1412616220800855613 ,  1631272083963203272 ,  996196725008170481 ,  1736654456294123689 ,  2098870563614812086 ,  1538370176217918139 ,  1109247000980495187 ,  1115906391251719065 ,  1018995087089091707 ,  1990202742345306467 ,  1957897573766574885 }, // x^2^620
+
+{ 186741935273922464 ,  1731312068911892986 ,  1463981443318498031 ,  282450214082415321 ,  2223830227866349093 ,  1567353405391015897 ,  1723174207469257735 ,  2299151202475480735 ,  2118794482049112392 ,  407966454207761932 ,  2209989527511645815 ,  1897238614347449858 ,  144397831593442186 ,  573770216029241942 ,  1851244408630082411 ,  806881689616125403 ,  816662132216068621 ,  1244678128612980135 ,  675419766823934159 ,  885022806692031796 ,  1718340999366901022 ,  998632941323722155 ,  1834924881552686411 ,  1801046595901782758 ,  1033962270368562917 ,  1125093217452587941 ,  939230379208482073 ,  2162779372661731296 ,  969527909146590339 ,  34660635966687101 ,  1816844090986756603 ,  807873688684718142 ,  615704845148235751 ,  1121446407599255533 ,  2292302625030375704 ,  385089538222830206 ,  801372557160308890 ,  759905647641536889 ,  1933934843539637724 ,  1383589997014435873 }, // x^2^621
+
+{ 1952147557520546485 ,  1365145120223553047 ,  734448484606324341 ,  1887281323880121685 ,  283783792880114308 ,  1584108624110779650 ,  2215454127597448341 ,  597590547002757147 ,  2298955464508723985 ,  2132890150629491971 ,  1465058228788690183 ,  519376946531243252 ,  2270605202363104915 ,  2139988175295256766 ,  778263544048978023 ,  558356475417942638 ,  648232301593199891 ,  1600919005481069252 ,  1924825194914766039 ,  439866732651609863 ,  1006272748426736888 ,  1631874528093631962 ,  2049267894561203830 ,  1124944442238793634 ,  1922578693907291884 ,  1500236349988829061 ,  1699820036616451369 ,  981210002526050763 ,  1198861857639717084 ,  1006620200969292625 ,  632952329374079706 ,  1308871315405215902 ,  1859949459166096411 ,  1724808129021097487 ,  387305802535646680 ,  1895442601651214062 ,  1385788625870157665 ,  353463600942534512 ,  926880085978269282 ,  941576864978705729 }, // x^2^622
+
+{ 2229176815403784091 ,  1811779493348449600 ,  320767144630975869 ,  2125829585344164615 ,  1954045874096088378 ,  1926686479205998364 ,  1478963003390095447 ,  23348596273305439 ,  117889055744913018 ,  2285518164794277905 ,  88574434317630309 ,  373428481491433037 ,  462787200784328040 ,  319912180727490338 ,  2169187836547770149 ,  50752835715401274 ,  93019844267329043 ,  1132965574560211980 ,  1745060376802560 ,  1073857278997593672 ,  894215555372948359 ,  255932818238607400 ,  860799593190416587 ,  1707155276862850531 ,  1535787831726701291 ,  1382129123825246776 ,  2217180194905437742 ,  140090018710666772 ,  670245290749388481 ,  1180366662367244260 ,  165051973400565805 ,  1736579399572128146 ,  1707711889264807613 ,  2058522711004928271 ,  1426139631876188932 ,  1491189444670600656 ,  1816397423501594215 ,  1317120304356614162 ,  1947052574690776809 ,  518346354670425938 }, // x^2^623
+
+{ 364488406719230261 ,  254999882279497795 ,  1882894248960865447 ,  1908912945031386173 ,  199248764331507730 ,  753345573880360098 ,  86319600828750656 ,  1369280509072931862 ,  1050312262993592389 ,  768307225735963161 ,  1949201883719968556 ,  450191621207479737 ,  1582467826137924750 ,  1953307731184619285 ,  628494235435845388 ,  1422356234192291754 ,  186390508452729296 ,  1729693915001301569 ,  26472501351840253 ,  1754319271878416667 ,  900668828562355324 ,  2068423424744455404 ,  1292221493171882428 ,  2276333328659855353 ,  1643880234045439672 ,  1503815210146582101 ,  609240560436387963 ,  1905099382228579908 ,  473471089692106819 ,  2243682217432049262 ,  1212081069879191540 ,  259204250500558923 ,  1470317123479635675 ,  210746046434788134 ,  344134170867285167 ,  333907130966848849 ,  1458345235621499461 ,  1915860610807574581 ,  1612082408377922900 ,  2084588469082057993 }, // x^2^624
+
+{ 2230320650922952155 ,  641112809466596057 ,  1315469985207299238 ,  985988154272151223 ,  1702301066998535993 ,  2242703969703231784 ,  1475218785276957712 ,  2191949258956044105 ,  932510388804635049 ,  1452356086728674337 ,  1275694502313737910 ,  1947280879416570697 ,  1128363471900864933 ,  2227515812088937608 ,  1362869205374215565 ,  915867011813540411 ,  1730509340350599756 ,  1216429137563830047 ,  1391293824269889682 ,  1644821483964384731 ,  1426530111908694749 ,  1740908729159716087 ,  418592700529865209 ,  383105118931695465 ,  663931327088498760 ,  2164214050589016372 ,  50643135789886016 ,  1025620185205000528 ,  1897145806522201010 ,  1439799845570102120 ,  2011290630782751554 ,  449811189784715661 ,  1205304361943436842 ,  1482165875125669904 ,  1248210347765231980 ,  2154523202078760824 ,  663871871705199968 ,  1523722089647214900 ,  1430357578036026308 ,  257280306798348311 }, // x^2^625
+
+{ 811385372221986897 ,  1819450030453376043 ,  776321375491609516 ,  882396695394562140 ,  1649175504701764421 ,  940067024518511119 ,  1869187506108598788 ,  143362256981004394 ,  803096983699678331 ,  786203002715031811 ,  913970414767850957 ,  1954142203849796038 ,  1172097848494688904 ,  2261993461113633908 ,  1000677042046140621 ,  332943352105329804 ,  145469419552517433 ,  1122291703211114838 ,  1549554310223563745 ,  1356115518115078989 ,  1917898337234595347 ,  378681549927371286 ,  616564693946804865 ,  1789218833261653605 ,  376261341115760675 ,  1204013216637894938 ,  1351552765774394320 ,  326588903007607993 ,  669916779454828152 ,  1211324194770110597 ,  1089562394710906840 ,  2201372711670691863 ,  481587348862269116 ,  1713840886412491915 ,  1919728723113377218 ,  1324441257487491725 ,  1925944242708535284 ,  1243255655186785435 ,  1876357423734667597 ,  85410652779832775 }, // x^2^626
+
+{ 460409732128114338 ,  133932408347730701 ,  2132202405886802920 ,  1846507220701121560 ,  1788511059457864939 ,  79032308235429487 ,  1588989044054569180 ,  1892691909715561465 ,  1928718358624535138 ,  295576464712001425 ,  160943107609818607 ,  2031657950607059023 ,  1532179945613421552 ,  1291736898327207025 ,  1004477364591768823 ,  364664273679515538 ,  1450008224831895430 ,  998070675398573155 ,  1957490255050233448 ,  1443843223441743439 ,  47369943489095360 ,  788302076398385703 ,  538641889664610250 ,  928302945957092916 ,  67544031671953762 ,  1562058982292704358 ,  279578542852263685 ,  1104468061962927902 ,  968080911231159429 ,  194923437498575524 ,  970462638894477276 ,  1665545295043897710 ,  1095552625799826907 ,  1624251217698168093 ,  642685083543683373 ,  2254987760806671917 ,  460750050217608273 ,  790520676574861450 ,  1621299354781558048 ,  1063663556937082096 }, // x^2^627
+
+{ 1886908854961152111 ,  1129974290201964520 ,  1860021593455412318 ,  938571473370347023 ,  424926554348758074 ,  1058799677657790382 ,  1503298237758645659 ,  81202787303831778 ,  917126369693600975 ,  542826390765865622 ,  887416966296206679 ,  881989921855072873 ,  1191438474781387384 ,  2062136296040582789 ,  2001495143164374930 ,  621548977253108130 ,  1396860441067257034 ,  623673458450863757 ,  214802880742353240 ,  784163153144157394 ,  74640128476100125 ,  1170197629702975881 ,  786956747202077970 ,  1907264949695163940 ,  685726477124183284 ,  2266629064006163507 ,  164044935805894618 ,  79859199573615192 ,  398083575076493795 ,  599805627315392938 ,  113253650034147309 ,  2206117682327343716 ,  1632416897717714090 ,  1470814830628701642 ,  1108845018416719675 ,  1294043053565818206 ,  500845292731618494 ,  1958547052266411050 ,  944603276440544257 ,  195764303020937091 }, // x^2^628
+
+{ 91751227711582928 ,  654101456340806369 ,  767702702780915404 ,  293510063087615594 ,  1966665240668971845 ,  383716449714607576 ,  2064942851582627847 ,  774528682258107763 ,  165497964186915172 ,  1769254899078272284 ,  1428546316445445376 ,  1688187985152938566 ,  1245193703624729076 ,  933954561904720839 ,  2253083087063761309 ,  1835305407014170841 ,  730577161167631421 ,  249652022436095700 ,  767457894253355042 ,  738414642704681106 ,  1860351527310842837 ,  2007669737853176193 ,  805000924954709394 ,  1345457344914939008 ,  273681852130456035 ,  1222331892966439299 ,  812119891664540542 ,  90652357069691669 ,  2147660637735487992 ,  1085364909247389582 ,  272187190773543917 ,  1431464760120251722 ,  65423536470575760 ,  1786698809963425943 ,  1558763640208907676 ,  742703866258700227 ,  1766260696035285769 ,  1821074035725032824 ,  1699728525263593519 ,  657421444354394700 }, // x^2^629
+
+{ 2241782406489722316 ,  1101642994029096344 ,  1753036732773809686 ,  1914306416889222931 ,  1796507045852408935 ,  1232382180956753036 ,  980599531796664838 ,  1853919640595973379 ,  288379323389019749 ,  277870040341336993 ,  756641891214161359 ,  1216362846212002716 ,  1984880786995487855 ,  1754309505246239829 ,  95394368933141966 ,  1565193988054084102 ,  671819055203122719 ,  1814255898956947610 ,  126322513712005344 ,  1411304153039869917 ,  1548092215666173815 ,  1540230463576826801 ,  515325210800374385 ,  149284017602814822 ,  1078874202500629507 ,  6760277624867440 ,  235678929091180704 ,  730823815531760385 ,  154794058946756630 ,  1102752308958605803 ,  1795984821277991105 ,  574561497476934056 ,  1893224474540420480 ,  1117043379683758770 ,  2134840485175422120 ,  2200579243930091577 ,  2264316258521688994 ,  9285146901552980 ,  868168119863927852 ,  1548162218862749323 }, // x^2^630
+
+{ 1876949687913325745 ,  1283825731484549124 ,  1154158431846575094 ,  892244529364032755 ,  244537302601435782 ,  1072380379648905908 ,  1716848217770549788 ,  1225002585117670882 ,  2160032696086399021 ,  83748283794008241 ,  1318762555918733780 ,  1329142678464809690 ,  329368568427473598 ,  80824145346720459 ,  2110103024124661121 ,  950430216386484601 ,  520594733855912063 ,  415860273821993834 ,  586288050871155742 ,  1314392952977544561 ,  1496758189965135350 ,  2133754435156511323 ,  1968661118420029745 ,  494234550791405779 ,  1533872020354181447 ,  325202011528737735 ,  1940233531470602113 ,  1177001747852227277 ,  861399355898452517 ,  510629834854776734 ,  1754834485554257889 ,  919471072299681144 ,  193447457199301290 ,  1935179761971176090 ,  151060547350434592 ,  808929480058320274 ,  771806201758596346 ,  856343349074523132 ,  1728806464875861936 ,  1794839961919059214 }, // x^2^631
+
+{ 2164088579744354630 ,  1136845334555655992 ,  1953742969164718154 ,  1494118730034001133 ,  1093382561342795132 ,  307536887005079856 ,  1142213593988684794 ,  263808422549057201 ,  554646103042448846 ,  135685053045160756 ,  470740745404856864 ,  2048238921624714577 ,  671643965514366941 ,  1202322827500823707 ,  1232177435409579466 ,  1945916294356873430 ,  46552923392638738 ,  1408891001549956992 ,  474754170081084150 ,  1507559705484397838 ,  1710954136891312960 ,  1069951274264098439 ,  1912171716887036692 ,  239732312830379001 ,  1298637897103017235 ,  1910002553183739989 ,  1908448141564928479 ,  1960722753615616104 ,  694040787236870342 ,  745559592040572465 ,  1276340095626935516 ,  356336369528667078 ,  49938680094346414 ,  1319335574773487256 ,  1570123578540088378 ,  815843147882431335 ,  1237489354713104753 ,  2067684321940337507 ,  1623020201136481527 ,  1225861190292527681 }, // x^2^632
+
+{ 681893390014010042 ,  364833498732160197 ,  347280845980363105 ,  1932930524763108962 ,  99099804098230526 ,  1224771140223776975 ,  2233720105932630206 ,  1382472154986104905 ,  247627648974705854 ,  742411137469068607 ,  1865279314134834176 ,  2013031660217020274 ,  2029027075181804979 ,  2137629766708298499 ,  343007322362914510 ,  120219187724778261 ,  127401864216834668 ,  162571221359945653 ,  1714652400993162225 ,  1736559765485262575 ,  1803482958283898337 ,  714601019014198351 ,  753975295206468045 ,  907374441700976086 ,  1315515825587406966 ,  806365535054925670 ,  2089211476949172431 ,  697152567620064941 ,  278125053297022691 ,  412934134703932313 ,  456895672509916707 ,  1416001682950529352 ,  1372233294532944170 ,  1924634065148844835 ,  432456658035317629 ,  516900911042412136 ,  1326700753240125943 ,  1175198402492106937 ,  518969815802661455 ,  692732994173913456 }, // x^2^633
+
+{ 438425363966047453 ,  231749598290714720 ,  1633679329747211826 ,  182442758079822926 ,  2015883661980359180 ,  1662624749325024921 ,  894722348997525968 ,  1186924024989727730 ,  2137071626562963917 ,  2109924349198720874 ,  14338064225355310 ,  2020538446627033577 ,  428424515167134808 ,  1162698302275026661 ,  2048594764865385648 ,  983863966404772328 ,  681767742224098918 ,  1494152573145186625 ,  1211397160450162255 ,  2086328345580367221 ,  1731866628866945951 ,  1953504410040297605 ,  1889004508144367948 ,  1141668264320775378 ,  959080283861921248 ,  3446795158753822 ,  217653486740220475 ,  179302773823101965 ,  2192387135923793596 ,  1175433756891381563 ,  1110449730964575172 ,  1060218219484813812 ,  2261414959174306534 ,  954927956610094472 ,  1774248140108233302 ,  1226933808006280255 ,  729563985720011705 ,  179043402769742979 ,  131747874425955288 ,  1864641624490043903 }, // x^2^634
+
+{ 179553076648254213 ,  1526858235624305634 ,  270545322112498912 ,  1808811806061611981 ,  1554000384879997292 ,  617292365815660888 ,  1749442098917616955 ,  1262092756319151505 ,  967658257547502639 ,  498394304268315835 ,  1839782047198573132 ,  355306783305475432 ,  136930071456133383 ,  2106458766773208254 ,  2263124002772811616 ,  29588005837725266 ,  319364955770907965 ,  1378142351337098562 ,  1415285266660095996 ,  2223472322607595890 ,  824494353262912608 ,  2231714706774552431 ,  205286352923499558 ,  1594031434681948799 ,  811443097026906615 ,  1597670546270343539 ,  1618798820439094596 ,  662087913573919445 ,  244134259059344015 ,  48403813813350989 ,  1332807473923887125 ,  881296626273121680 ,  1336454058505343985 ,  2139906487233382315 ,  6165365976608033 ,  2152198744971875354 ,  418059048196211020 ,  1856579476322241689 ,  534628019949368178 ,  1675555179060250155 }, // x^2^635
+
+{ 1051643610382852668 ,  782276496666957677 ,  1089568368647728051 ,  321171154669675210 ,  1340914766528839952 ,  1808305205958624388 ,  254879491232978250 ,  296736599998750900 ,  86529240159857442 ,  1402913958659399451 ,  24808797389449415 ,  977486048815614068 ,  358555373128244322 ,  328794955464493315 ,  346505323692440683 ,  1203919077495428248 ,  1439848190783390539 ,  138804556174411645 ,  735435877813280529 ,  1791614338846720661 ,  278223572292267141 ,  1827050929833034693 ,  700643587788693345 ,  903866988090730626 ,  1825768436181020660 ,  1469262469552699139 ,  1195813813167970967 ,  198804794791650744 ,  2051265503330826467 ,  1229225483245354890 ,  1132015137853587783 ,  2229405645111753829 ,  361808758439103074 ,  1578856629545327593 ,  1963707804859204382 ,  1478953981469131162 ,  715078017841398823 ,  1288490460568277780 ,  1045504728710982043 ,  1580669596421823533 }, // x^2^636
+
+{ 1937106908615817767 ,  1357739807989408954 ,  1039512898430140813 ,  1699807305898031069 ,  1301013433334178181 ,  490293354629569882 ,  866265392405379791 ,  1082387357413164020 ,  721028903999977067 ,  54547192048039114 ,  1368314366795394643 ,  560267551863035565 ,  283282746745178680 ,  215196956917439905 ,  614992972094720466 ,  592654485487165712 ,  1889721433505894451 ,  1521581911829020961 ,  115413391431719853 ,  149039582842805364 ,  789027897427424515 ,  1398214080937841414 ,  2033181792252744208 ,  757501306448143846 ,  1766796954024670304 ,  1116438126863325826 ,  1395027120982341517 ,  805010958160414108 ,  156321795178944657 ,  146235656071805963 ,  2011493178066217392 ,  2000553609112923462 ,  937660712419443351 ,  1261908398057135810 ,  305717345410594701 ,  379684600521951984 ,  70150568436513788 ,  2298527521823853555 ,  570478249310757259 ,  2121029207279230110 }, // x^2^637
+
+{ 1805980607673110708 ,  1917141576562461729 ,  1870004978933798078 ,  550275649857772126 ,  1510104489437605517 ,  1746146858677596301 ,  291405946131249271 ,  1228883330914583072 ,  2008463076166718302 ,  22653589895800493 ,  1763206333344893985 ,  643214011343084767 ,  538244292093969927 ,  1642843207772064897 ,  346939007514072737 ,  1636788446456924009 ,  318638699339496417 ,  665299335693604484 ,  1783704033866523036 ,  261394621370280786 ,  1841993641744096537 ,  1398301222181459645 ,  122870521063702921 ,  32687628700347499 ,  1343935851024322239 ,  425906783108711555 ,  741925298895482291 ,  876499428060356401 ,  2080747273109615061 ,  2172744708595224294 ,  1993361039386797238 ,  1367794163964803936 ,  255675880461352088 ,  894313710461537977 ,  458251791932101414 ,  850695425264054176 ,  1830448518416295628 ,  2229882874664154484 ,  1591056360667587143 ,  1093274807595583726 }, // x^2^638
+
+{ 877547492313548567 ,  1209637319042692539 ,  2085070741010913884 ,  802188997126137356 ,  175753170146774594 ,  685197759629500356 ,  1776323284647407205 ,  687211050749715800 ,  1755585068048664108 ,  168930467580930932 ,  1839102168411624411 ,  1794722934105345581 ,  1826954927586182470 ,  1121154448789243152 ,  1503781449777437626 ,  1257492658207474238 ,  1782121210348890923 ,  1385562379505569513 ,  328080292375968012 ,  1336291729787251717 ,  2098626843570699041 ,  1229999685242890626 ,  991834798366877302 ,  1533820298008567584 ,  1301335796953581807 ,  313732753249641143 ,  1332758638269595750 ,  61718812463020151 ,  541098408810272696 ,  1212153091328103799 ,  1165482981694645156 ,  633628632684535041 ,  1944276075490229538 ,  1590522354616183553 ,  276270602500516270 ,  31742897937674675 ,  1681211572352130140 ,  699752907503611401 ,  1861541054193956142 ,  1461193587880186279 } // x^2^639
+
+};
+
@@ -0,0 +1,275 @@
+/*
+ *  MIXMAX
+ *  A Pseudo-Random Number Generator
+ *
+ *  The code is released under GNU Lesser General Public License (LGPL) v3
+ *
+ */
+
+
+/*
+ skipping coefficients for N=60, m=2^52+1 and s=0, low to high order, a0 + a1*x + ... + a59*x^59
+ made by skipgen.cpp
+ */
+
+
+{
+
+{ 1771931954848924736 ,  1599964781256181566 ,  214489881468079957 ,  1066496903600206923 ,  723421126754307250 ,  635629891304833751 ,  155107863412613036 ,  796633869987149928 ,  2263014110850584722 ,  1621213821875515749 ,  1483050375183488578 ,  1545115787397748660 ,  732989682933118514 ,  2133120917153022009 ,  57466591860121990 ,  918663934650923259 ,  132756448393634993 ,  1753809052700836893 ,  1229416466213655511 ,  2167015705049698056 ,  1715891967374679843 ,  453475131537295895 ,  1539650049821066285 ,  275360309953248939 ,  1493927097214050746 ,  2018084661738394547 ,  657590284459854826 ,  1212762460582676964 ,  63861315334379750 ,  25805455809731247 ,  880421474061761960 ,  1760830290224659267 ,  729245736244405013 ,  473974773366526534 ,  25226518106936347 ,  1776142342556181668 ,  925155405490963387 ,  1688447195253322267 ,  342629950036159331 ,  2178018184551462860 ,  1602923751924790941 ,  44359278174640000 ,  470865957409857285 ,  451929317337895986 ,  1595530383714488437 ,  2150188199838465481 ,  1168551490398734747 ,  1520869569729902450 ,  1347258237869391104 ,  1642968783919029636 ,  2195044146798711933 ,  552984038349619331 ,  506073253745846679 ,  1200752961818065345 ,  1241596638366571925 ,  1701930716178272661 ,  1922272210298130855 ,  2011991276066707589 ,  1301364353726819058 ,  221456151838001313 }, // x^2^512
+
+{ 450757814316752468 ,  1508348946730039550 ,  841706189127515206 ,  734342192516964785 ,  2100574886425336538 ,  590977146515122629 ,  388907876881017073 ,  401130087032748016 ,  689444423276018638 ,  8201361488371013 ,  1671848396371729673 ,  2187024110121835714 ,  1898342058564630944 ,  1880310605158175891 ,  1296609873303991556 ,  2035908084172219535 ,  320658261583835483 ,  601021120603592893 ,  1016768892183026416 ,  827814389527402485 ,  721771167932340474 ,  475997234329333389 ,  1689037087496897809 ,  2173187938028434102 ,  2235537866663791588 ,  22926383846877475 ,  1956860914931685256 ,  1936588095194539632 ,  2009317750534109652 ,  2056702323667380596 ,  41677397699723151 ,  555057315363979343 ,  1394948723441068460 ,  1370604293934851481 ,  1566596098193837845 ,  377185735613844340 ,  1749464387449497468 ,  269921236618253779 ,  444058247044703393 ,  1317385417128824520 ,  1745869892662979690 ,  1205965931196926884 ,  2154018848539490162 ,  942519153096925355 ,  1000323708146484118 ,  1394375599423612536 ,  309532696239028471 ,  1312683665115146689 ,  753309492022179293 ,  424255716135313270 ,  516216982142489421 ,  1629738937789822396 ,  570087735363540574 ,  1993307853351805353 ,  360637913324491738 ,  1950887727507424289 ,  1195577220948992254 ,  1449558400564197043 ,  2141240646555118153 ,  707854385746369388 }, // x^2^513
+
+{ 1370956456009674878 ,  963429174283750286 ,  1588365843781887983 ,  1072258186292565354 ,  1253948872796409503 ,  770633740610433425 ,  130268218820649963 ,  2192657623360692747 ,  1274367502945957572 ,  606382174826716065 ,  825366893707222009 ,  44693539208491852 ,  213206478984615638 ,  991705429267088923 ,  2231567873428351603 ,  512081066147830069 ,  23929555731737551 ,  606854662276882875 ,  2830539470882885 ,  526980382441897498 ,  1886209865085487642 ,  1517993266845986519 ,  567266133543626971 ,  1665920136317838532 ,  1261725246659100520 ,  1906550409347126827 ,  883965251051461300 ,  1347362035977377918 ,  1404830940164319304 ,  197489882568854829 ,  2190624836844467317 ,  1181082750742881136 ,  1227660327873106513 ,  2047336815538693317 ,  1778269413380401953 ,  1617573603680160021 ,  1778575087443207645 ,  1480538952683909890 ,  671339027772704682 ,  2053215810391079511 ,  2071847560667943797 ,  955439928517347128 ,  1989891372757459387 ,  1407987333089531503 ,  646875104807891782 ,  274003163110138912 ,  2016991533842116183 ,  630565235963085466 ,  183702692229069973 ,  909871805534927516 ,  444094207065313491 ,  186551564701159214 ,  2071343819638995178 ,  989516325091542045 ,  888690227767288651 ,  75994897862387679 ,  1253219704571459154 ,  1993838309268677028 ,  12338101301165185 ,  1404215121720329929 }, // x^2^514
+
+{ 957128587686549494 ,  1404851208062418918 ,  1975969056390776876 ,  820836341360688222 ,  2190329535842597257 ,  1349997436592712740 ,  807308825321617329 ,  1306714335909303206 ,  1795406231320155449 ,  76899403639603375 ,  1805976571145409564 ,  1747347656324981474 ,  654972238993631372 ,  1723889356526558967 ,  243408128711371838 ,  1682238322111666695 ,  896652610415795391 ,  2110987210971224378 ,  1588434592030041215 ,  401873983760509155 ,  802578181255643487 ,  982945647465908766 ,  1060839338954330949 ,  438879557089328874 ,  1082271979762728408 ,  461031166061110848 ,  2290342305178641960 ,  1704763056142110398 ,  186268359328175844 ,  286663137397476116 ,  1658096474125471485 ,  1488991901477465002 ,  1504817976730006226 ,  1147568933810307913 ,  1609625944018702817 ,  735798865413069064 ,  1640536965744860409 ,  2125100048806479616 ,  1777223991941001939 ,  201399147586943158 ,  350958751435187954 ,  115221958202056695 ,  1546435067454811051 ,  1188025724605126726 ,  843774755052231162 ,  1897471908344269647 ,  1777122699804846735 ,  2164237915258173091 ,  228591421565315095 ,  718955651813889516 ,  1439921913800839750 ,  2007637491864882801 ,  1628221410737914535 ,  693036439157108833 ,  801503963085349536 ,  63145921446875644 ,  1430088837917705290 ,  1501238116965961300 ,  1488473532930815480 ,  835323577818518028 }, // x^2^515
+
+{ 1923454204150810406 ,  1417891132140384567 ,  2161771552937450221 ,  1053185875382017346 ,  444126819138846123 ,  169584869028195422 ,  1330016338591254633 ,  1990804427584789669 ,  571530557639672786 ,  770317727008098830 ,  1262690711787150014 ,  1844643870509689459 ,  870830191850583350 ,  1672964348406371269 ,  1224357683634185873 ,  404436337070866489 ,  463109849601227278 ,  1356933174725117344 ,  895963067813238820 ,  694977807830569085 ,  180928159711678500 ,  547611818341338265 ,  1438051476700586603 ,  1348986055042175715 ,  444661096716603569 ,  594936327737626421 ,  1301408749376780503 ,  1560086678851845955 ,  1820742543919478182 ,  354871428875129216 ,  917311320604338470 ,  517452997671901149 ,  1038537288237981792 ,  1612130236922012380 ,  1069253629289415500 ,  295837811619594666 ,  552061972687900807 ,  1519202910857899907 ,  960157109473679464 ,  1322408554595961070 ,  1706826283727658964 ,  1824090964284203308 ,  86155975764987351 ,  1623867643690787414 ,  2187564761260308668 ,  2044457886492295025 ,  2176478690220578357 ,  1326177581652759919 ,  476957947139264241 ,  869129159658798918 ,  1447399065005711443 ,  1890831579966286500 ,  1879119720490012252 ,  631662305344067932 ,  621230410700241075 ,  337766096036748408 ,  396272784697249905 ,  659693793258056286 ,  1929607059355944946 ,  278085039337545812 }, // x^2^516
+
+{ 697574779847364753 ,  618300259314374711 ,  831042343448498636 ,  658443459308716294 ,  480416216212003722 ,  1496808334828040927 ,  124122292534000449 ,  997102578416746468 ,  427124435082313297 ,  2094518779249729859 ,  2206090642359092667 ,  1439858688171379852 ,  495769325221199725 ,  1391254390431495710 ,  2129853452876889834 ,  503594834748088037 ,  91255410442593377 ,  316830861822164754 ,  1450354634947988933 ,  1771627291934380673 ,  1815493712888515766 ,  419740000168844260 ,  1950208247206713986 ,  161434786536410671 ,  70048511616575077 ,  473172157452935625 ,  874393439596433827 ,  2149924335971554353 ,  560144923979936907 ,  1237225564748889299 ,  1606933526007075494 ,  989665143748232085 ,  2271445614610994192 ,  638410168801932064 ,  396277739908426457 ,  695863980388987959 ,  1639853317695080214 ,  1822476352536281512 ,  1102394440578346097 ,  1680683502280842340 ,  74695266706690082 ,  630233688417197012 ,  2127139647820490456 ,  1872926087623169928 ,  1086691525847075489 ,  2120228871251011280 ,  1052218629439265249 ,  1649304115664336919 ,  95021793578047563 ,  352579275827284605 ,  1202628314275279361 ,  1482565834064255264 ,  60335824446861905 ,  1531225419002675907 ,  1185503079698138730 ,  912450783806117883 ,  1962874606019458305 ,  992421222561909929 ,  2013322998768724665 ,  415815191838179544 }, // x^2^517
+
+{ 617625637845972467 ,  1902649166676629713 ,  1286022780925454898 ,  164449085086696978 ,  1034980847513708233 ,  1205301649480772984 ,  1873639142031436191 ,  545584961866513314 ,  1274602432182619110 ,  2137009395145026821 ,  1959609835953253215 ,  1431324805939421631 ,  297808016023502284 ,  501550798001714797 ,  580086929949907299 ,  289112939830555556 ,  918195281376441027 ,  880383719923152525 ,  790390500798416332 ,  718575545906455261 ,  514515880289872373 ,  621346041520019567 ,  2239624196970101635 ,  471524186868812777 ,  741683984545589128 ,  2150897806136481848 ,  873192041600232862 ,  1478485841189561624 ,  2102296018845750822 ,  827594673264123360 ,  1467149172833939603 ,  1987111001625410751 ,  681009283377307509 ,  2301720979973450282 ,  2109686554843740346 ,  1673219886163850060 ,  1698990213012768112 ,  1813119614533751622 ,  2067237259796962047 ,  2224161167100522980 ,  2234823050555432004 ,  22685911553977117 ,  395155094925479740 ,  978254162907519175 ,  1174023766438564904 ,  1671308579006437772 ,  1654408322961441506 ,  2264921559417636152 ,  301005520904027324 ,  386851924317648709 ,  1953116963780560070 ,  1625891205071907795 ,  116293473617161868 ,  560595151267848298 ,  1402981559844256368 ,  141759437737977782 ,  1606319645077805695 ,  874663092200046672 ,  1207841250365746807 ,  968253223451586106 }, // x^2^518
+
+{ 1143199249352418227 ,  1534186430286794205 ,  1563846627664811992 ,  1915342585667153036 ,  1714475962042422046 ,  391554919633690539 ,  1010252065333104719 ,  422182802312276151 ,  149792911691751532 ,  364735411257548063 ,  273440767282977074 ,  271404582304769105 ,  580467105128003043 ,  14777831566851503 ,  1218472458002393393 ,  1848926642171052910 ,  2207152728538743486 ,  249851280593803103 ,  1572650274875847695 ,  1485341429386788449 ,  2089223609983141782 ,  89605601630609925 ,  273767575857031010 ,  1442036682116770801 ,  1575707250831969246 ,  2238350001131089184 ,  785989467399779542 ,  1095987158161785292 ,  655918391544098225 ,  426254558441401114 ,  1637542010291514034 ,  811495493955906595 ,  665697987423078943 ,  844789895082059543 ,  114757509868506032 ,  1880408875289152605 ,  1407965345697132252 ,  349885852176799880 ,  566722712325109137 ,  2223620173112022250 ,  89894647562377407 ,  30110207095650228 ,  649215299914939570 ,  705692989575145610 ,  1780013625380725234 ,  785061723828097096 ,  1694422086507165633 ,  2172349032620581630 ,  1845207907807806163 ,  632513375374316640 ,  1417266773033675791 ,  402031770886881442 ,  521035384137016460 ,  394512124583270945 ,  1180074776241648301 ,  644722533001513812 ,  386668217483838670 ,  842276861903071378 ,  158086805541853431 ,  2198883185836384077 }, // x^2^519
+
+{ 996582380995309846 ,  2096939557708708441 ,  2082255105805965913 ,  2152893653513289774 ,  957361028318741863 ,  2241587311260234417 ,  1278542147917129871 ,  1371631154312136496 ,  1624312815684272790 ,  512888921883604012 ,  2204763103107681171 ,  2188082655769911605 ,  2001531161485384230 ,  2078834339934235558 ,  856366218626955518 ,  2000492153597669732 ,  674014121196540023 ,  1800606626552357287 ,  2297775572255247692 ,  1329792651220396028 ,  474648584680009560 ,  1006509168873959983 ,  170401101942488966 ,  1571500666935536569 ,  1471222042389080346 ,  1675705606002215457 ,  985700561781857102 ,  836916936164624665 ,  180851953993987747 ,  652086724003970287 ,  143771946822155062 ,  1331957652525984474 ,  1182141364728030729 ,  722876723216761148 ,  1802210242885855443 ,  1796880546918320777 ,  1183445881397920941 ,  641775674938757477 ,  1775745683875268265 ,  584413530685428700 ,  1925904182456650363 ,  329783674531231453 ,  1548488072055845429 ,  439836548963717523 ,  1738158913138227121 ,  2144508532020417782 ,  1932533662483892053 ,  2117589663715369382 ,  681418391416484485 ,  1572599860133317103 ,  859312529227478121 ,  257410433844986638 ,  1512843138222267295 ,  1190284818095945566 ,  96958438550175989 ,  1946229474764084361 ,  151460137335822562 ,  539404193052498368 ,  2461512308214271 ,  2267303439165912432 }, // x^2^520
+
+{ 628444067320727032 ,  902568525851563214 ,  222361812454767107 ,  2090975425566506652 ,  1984029869352719092 ,  2293151831372007117 ,  16151005310741701 ,  246115146647740828 ,  1083207904974119937 ,  1550041881694698635 ,  48903287208859804 ,  317550671245290537 ,  2043755000099870892 ,  1299046587655809901 ,  876670733785107296 ,  574400666376642035 ,  1010915775366257568 ,  2087710361829250771 ,  993552281343737111 ,  1886363232132754592 ,  1192626935192704193 ,  2262450240837300666 ,  998403459685689695 ,  937909231291833070 ,  1968197391915725027 ,  2076351230624181784 ,  434982679191213963 ,  2202030385663177798 ,  1748040120337856415 ,  395228469574691323 ,  963280877259290844 ,  924697399533452665 ,  986811150693154203 ,  2113037935235908658 ,  12036044362504144 ,  1443376317605381218 ,  1743184434859578055 ,  71578181288911527 ,  791315324740923325 ,  593597184083270642 ,  772211349605276339 ,  1317536178321817672 ,  1836023602670804109 ,  1434693642623220508 ,  1338872867255061033 ,  1961514429609883150 ,  207282025190943489 ,  2175327412902836116 ,  1080338025671936255 ,  1436763282202931303 ,  848677700718076416 ,  1352122598430002822 ,  209920672872110450 ,  1744986695432205487 ,  796653016635325633 ,  197355764205653668 ,  1522236259851265114 ,  1432688546345412955 ,  1101061771300974094 ,  1830133208943740760 }, // x^2^521
+
+{ 712414362037233271 ,  1860480858158086297 ,  1579705713822030494 ,  919548815582600156 ,  618839255002716634 ,  1584260110922952852 ,  294447675980569021 ,  302051245560955043 ,  873766769546859806 ,  1326742605283143201 ,  1868106956521949910 ,  762621413025146490 ,  41096172365308953 ,  804628096448770545 ,  1881623877112181396 ,  1954259493893265609 ,  1520626890129506475 ,  1283097053386305339 ,  1703552041448393566 ,  714071618555129999 ,  1365464460158817711 ,  834734184652306563 ,  1751145722884754066 ,  2233268311930958391 ,  521809907351336798 ,  1448625466044922224 ,  1250117094135325191 ,  728394791225306914 ,  1434510403154048105 ,  2302466317692188646 ,  28912906881921383 ,  647341514527082688 ,  1308828958468257127 ,  957356804678339928 ,  1565172358317722915 ,  878729987207765268 ,  361132500493769652 ,  1420798604473676673 ,  122785163483086871 ,  95565858763513829 ,  987176383666942636 ,  1131402690729321954 ,  1362291920144400488 ,  1005044545840464749 ,  754696712425371233 ,  1506750296128777567 ,  1416756280467045049 ,  782102654857837618 ,  217967846638319963 ,  663269537492050807 ,  2260503977874496605 ,  2092628890715349962 ,  1534921681861950425 ,  1688245738320434625 ,  2227733940859119132 ,  1877144527735278004 ,  1491525246869112623 ,  1062575271841955560 ,  353286017002575195 ,  407611627061757645 }, // x^2^522
+
+{ 668841122661696466 ,  1650266313257363202 ,  956754982354784510 ,  1574654693675413528 ,  1696100769044202713 ,  869165239399614474 ,  1352414083155273094 ,  173654535171090989 ,  2199789956861541066 ,  1365235240753941926 ,  331974945961799506 ,  1096144163853451929 ,  1283818771080671835 ,  1101603357384260472 ,  2126601919707921315 ,  144387852125724627 ,  1534126555840266644 ,  1779570146078389289 ,  2130767513432219110 ,  2003114817424395170 ,  158139473176806154 ,  938969571474528216 ,  2212042205385396998 ,  1162789470150489070 ,  463943639736651579 ,  2156308897305056111 ,  1662246768611573536 ,  1265292040578045830 ,  17640061124818233 ,  1893271764229977572 ,  807609001523060390 ,  2138349783143657021 ,  823320511766851910 ,  1081823775781235370 ,  129995286417135006 ,  2242759650785757722 ,  1843249810561618143 ,  1024499930789835992 ,  1934343763919482787 ,  256833379022413710 ,  1061551660957360200 ,  1169119649124635726 ,  2263514828817872488 ,  41428707970933681 ,  2159616896727910767 ,  2022039973694846584 ,  670597624126133528 ,  2294012452066916029 ,  1778781106742877161 ,  1013168809457715096 ,  1108220879100347111 ,  439797195731276716 ,  2135449327195584024 ,  1506725611888488756 ,  2258986941843907302 ,  230251233343646292 ,  876197060054130310 ,  952989909202840501 ,  1629172744620428211 ,  1574454105923279844 }, // x^2^523
+
+{ 1347337593404996011 ,  1223125262086458603 ,  2227179529671707299 ,  144929847045422088 ,  230727384123387576 ,  921669995530834277 ,  1733488241171783384 ,  1606662443487496565 ,  928291761112690315 ,  1610374099921065869 ,  575737265800848845 ,  1001598331310522970 ,  859277781863635107 ,  310539567263492396 ,  178017404859746425 ,  2218663573416562232 ,  631943022092150539 ,  2225507375132236761 ,  562268827591897621 ,  227204875170716417 ,  1063542677239314615 ,  1104466904580074732 ,  1839015000775077300 ,  566346747921351393 ,  2144781547287656357 ,  782712580481673462 ,  1610935230639435582 ,  759571942108059324 ,  344167101161852740 ,  875875295990273212 ,  2107536545637463517 ,  1212278413006096048 ,  355471802761600929 ,  593592246969090330 ,  2209767465835349723 ,  639319143658636414 ,  1772077779467463410 ,  2107316094165786771 ,  546021426282305419 ,  1257951925903544566 ,  655900865707331419 ,  1025039501722816106 ,  2083587898645924183 ,  2131828227391427460 ,  189844874293119120 ,  1036021804735624411 ,  1195519844817664819 ,  502606458713310989 ,  2002936599923871438 ,  1864502314410101562 ,  346182157047121356 ,  163074486862096721 ,  1850415906577949007 ,  1052763718724513841 ,  1746164096786607735 ,  1996314257614723371 ,  1158913548098746046 ,  1807525129408914525 ,  1184934818526363175 ,  420530969481572557 }, // x^2^524
+
+{ 44338690107403396 ,  1510491266044921319 ,  1731971403325028004 ,  2226805067240568414 ,  2067982742414539712 ,  1967086647190528021 ,  1049007909799931080 ,  1495185605266012689 ,  1881316070685901245 ,  1176715079448215788 ,  428593594325267359 ,  854373075288715904 ,  564497248304674318 ,  1696501974905527040 ,  1630570221757617694 ,  29989668053002144 ,  1723683010490332557 ,  1827613121254647958 ,  253258133183445831 ,  1517425746666114256 ,  193442134986100081 ,  1212370976281890946 ,  555380857356341934 ,  1266177438550025098 ,  66755998578587993 ,  584967169209238932 ,  599226382338876621 ,  424673429458009251 ,  39540676151988113 ,  61623960321953360 ,  1162477820395735518 ,  1432739641269903257 ,  849864290258505044 ,  774569207443070550 ,  1686712651474477997 ,  968351482565461005 ,  2067675766738806341 ,  1649079376677760208 ,  188108370608628116 ,  1568776605632489168 ,  524335231471774904 ,  479964589410174451 ,  256614199349107519 ,  32473947509027435 ,  2184784794279006352 ,  383664757665841987 ,  1404695215004415976 ,  894365774651583455 ,  1568344361240420570 ,  1233972278195631165 ,  507456102882141604 ,  1482835758888810559 ,  352945645479435558 ,  2154328738372686674 ,  1292170021036688419 ,  570958256171388905 ,  555175760278763000 ,  383290552770465341 ,  1682664119540870852 ,  2059875990025493734 }, // x^2^525
+
+{ 1329182570669543107 ,  533376100908080921 ,  508972123904931835 ,  810586718949505491 ,  184764881828156093 ,  1724332799624887825 ,  410453411974897922 ,  1409697063518355745 ,  193685041659081694 ,  1668665776278279774 ,  1231254741160298545 ,  1177014715376104489 ,  2138653708707238158 ,  1927741659281650238 ,  541500791773766205 ,  1712155041897211081 ,  1954138917007523121 ,  1000835249977935423 ,  1671248481222186104 ,  2202547584371505303 ,  143843634173203369 ,  730128933267534284 ,  1669327841273842312 ,  1705703470202421592 ,  1055238300889629340 ,  1879442134202563269 ,  736645023860091700 ,  2270405258322796390 ,  1126396490470187821 ,  1857671441515088801 ,  312361146879780718 ,  1847717508323557686 ,  372304514866722231 ,  820131417870177131 ,  1319408564904378706 ,  1022558682617567331 ,  1414590094128715069 ,  851823222565416898 ,  169704732636126932 ,  1836387485446063761 ,  1174184325902715541 ,  617313178808497937 ,  340821025952841564 ,  1083449702616527340 ,  1551054388635932128 ,  148100356199600411 ,  202024151887764499 ,  546466775751797291 ,  2127751137716168100 ,  1702716339137951877 ,  427821274285617925 ,  1333123793495513016 ,  1907760157737513173 ,  2240466912595736429 ,  279274997244659975 ,  495273629751220953 ,  620358048718985402 ,  949228653451833095 ,  924845795270168309 ,  97936915755488200 }, // x^2^526
+
+{ 1311956473346756263 ,  1756870937949765099 ,  582386808740059691 ,  1988534122376545736 ,  606946416864769406 ,  1818508722712093801 ,  2057407505307085162 ,  739251270718324074 ,  1061584222392313291 ,  2029939178464308724 ,  110263150098788342 ,  181295837255882494 ,  2198022637170637361 ,  797869919853085469 ,  148197986465353110 ,  963089195769882431 ,  363207852042137355 ,  1795565423681930777 ,  1395183453708270579 ,  612654231354716517 ,  121268502826797823 ,  1163628062964593077 ,  798533320791165961 ,  566477402068303117 ,  1471528590494088287 ,  685463005707498889 ,  1257548600499023990 ,  703091014666919430 ,  1248981162782347191 ,  342455874716773962 ,  2056153525212507435 ,  1608222715460618796 ,  1215637003954898786 ,  1143398832978960262 ,  68064450045540170 ,  1986148174249567688 ,  427171531215150203 ,  1783883602736798675 ,  502469425363217803 ,  2292696995351908972 ,  697322525513115116 ,  1812722420065266036 ,  1658150663620513697 ,  736859561752737715 ,  327880055096514378 ,  798831162233061339 ,  978816358615405095 ,  1434431239674988159 ,  1700953926560776493 ,  314514502700792012 ,  1439877319881462744 ,  994300593519447676 ,  399297664790367353 ,  403583217084268502 ,  2252827420283866413 ,  1643548676055633573 ,  1746968412143808619 ,  606915166351520757 ,  1105942025519712376 ,  30898867913252814 }, // x^2^527
+
+{ 1788239886155958636 ,  1267370708392913339 ,  989533484497540311 ,  529397956864556930 ,  1206708630965784432 ,  1627093370438635496 ,  642094815863719072 ,  216776469126760585 ,  2100811288001152586 ,  417549795967063975 ,  855568825383980438 ,  483779712116109191 ,  2118603773477283771 ,  505701335281314124 ,  2303046426092861534 ,  1189732733567098834 ,  1694326811169980332 ,  607192675055216474 ,  1764092183865560457 ,  119283640343121199 ,  1239046837660504281 ,  1147783283694357900 ,  1620498202929193414 ,  683643221525101963 ,  1850773759933607841 ,  2286194458668852974 ,  981389700252241251 ,  1702921996324681056 ,  484750275426241569 ,  1412552197302225145 ,  450592401421886810 ,  2167584088870436185 ,  1389482022665303244 ,  2246261306761603373 ,  1155920507315190027 ,  958870061540790972 ,  1957610026007503671 ,  575626750950647181 ,  1770503358388771651 ,  2090248439136982925 ,  1572792917457556706 ,  1972977929539773342 ,  2221677392808876782 ,  1588526032405563841 ,  548958528237856358 ,  1828844843739357898 ,  753708940544987557 ,  1041050676828744722 ,  1789906162568327182 ,  412023703398990367 ,  1594433925907738464 ,  1427841043078542430 ,  1200401196266355341 ,  1671735911049671764 ,  1921936784598131749 ,  1066040494496884858 ,  2166516950354902113 ,  1393147160692830194 ,  51391731579099905 ,  478358190297536968 }, // x^2^528
+
+{ 1366703538594559683 ,  2265468092961031401 ,  2193413755640693716 ,  1631715554681612982 ,  1251196525942917788 ,  1095083795353616045 ,  576881926175257829 ,  800732207602456653 ,  2142722715455990383 ,  82438233232950461 ,  235578396199874305 ,  599290892328227268 ,  1614999245782972254 ,  1255751006016853546 ,  63469052449287859 ,  1974203357920219182 ,  1421681707510888778 ,  1536174760477767574 ,  818627701890180686 ,  57409815383954357 ,  1755504323610698311 ,  1640795086555825956 ,  901324062985403118 ,  260638433047603993 ,  1112740975615387541 ,  1760603270539804138 ,  1782532941210497273 ,  136160568020138145 ,  880163939040754416 ,  1946844532987129775 ,  340625172326528193 ,  1020002518597618633 ,  533203202759594420 ,  213997786021239594 ,  165058625392895592 ,  1518153485408115650 ,  2198882071650640016 ,  148449190601131425 ,  1397705654225525748 ,  924418881826279700 ,  763187393240346538 ,  82141410442623670 ,  781719452396551944 ,  948998618651125338 ,  152902515463860213 ,  1407542161738934242 ,  1144865631916302429 ,  274794475640046888 ,  1620749122090700845 ,  534267057677165620 ,  1142293365158503156 ,  1637020013932931914 ,  1869684331354028351 ,  1093983523669379647 ,  1316117178809808322 ,  1491896531860345050 ,  642865872969060406 ,  1131453807743258955 ,  1175646124751815113 ,  2180374190714926801 }, // x^2^529
+
+{ 877233621489393672 ,  1367315106002693433 ,  1779637355632938560 ,  1383470732613191015 ,  1916368278032711781 ,  868074334834426600 ,  50045035482961052 ,  1753729502875910746 ,  617849210864472513 ,  218600968365512276 ,  1434243266204049312 ,  1668812633578229595 ,  1387262819876391785 ,  513294710592667883 ,  659740900806417526 ,  1626151491186286782 ,  1653119505580652953 ,  453854641198962271 ,  2236112842998279446 ,  448536898020635738 ,  1032335059018047223 ,  346007769502654420 ,  331876872186776510 ,  2072920144746390533 ,  1469031042889058187 ,  1058392656737847378 ,  2043249559388814731 ,  412174237027239901 ,  1358589166921153009 ,  731032549065608320 ,  105511514236926856 ,  580431738267209882 ,  1035213507705904937 ,  2076998718041291079 ,  1804688304557291129 ,  856648276194952838 ,  2028824375223810020 ,  1481213302735454165 ,  1860788330496594853 ,  2088229253268442722 ,  313294516017366795 ,  1121177218735855016 ,  64185270543432672 ,  1358614868310809059 ,  305873916691283982 ,  147809798668145287 ,  1411385095101138769 ,  118124786575836959 ,  1955614653722729348 ,  169061737438362730 ,  569991404974357463 ,  540208640016626861 ,  43105555267399649 ,  346078254642706040 ,  2225321267667714678 ,  1630687327705645090 ,  2206163167531144549 ,  185544604182275523 ,  609653924966212092 ,  2190085926988963650 }, // x^2^530
+
+{ 409594050340477218 ,  442872594935482993 ,  1766626355888206844 ,  1929236631142208569 ,  2072761171383322099 ,  1722533337150055445 ,  839401270479221730 ,  1822007600693964595 ,  152050638158033687 ,  1915291828617754062 ,  471718874017561010 ,  889419562294187419 ,  1028338340016340455 ,  965077358126751460 ,  1777635522414754721 ,  1642048714413507513 ,  867674986700806431 ,  754174491269283099 ,  1364324702260709263 ,  267525336758573549 ,  271201884089124367 ,  1218082785294272303 ,  1280572970179129855 ,  2108109849614888413 ,  1710318539755274908 ,  1713368862933655757 ,  1245137880256788508 ,  1813548932413450447 ,  493845833559111465 ,  716228958577880118 ,  1821213283765803707 ,  9996747790501488 ,  1793955666358925221 ,  2154865892606032438 ,  628670147218040736 ,  2269145974862559117 ,  2002468109411966318 ,  1093022418347448966 ,  1041021259659873017 ,  1221877529022395260 ,  1773321638329467807 ,  176931223812755592 ,  1940433275201547935 ,  1187953738798927592 ,  1107335008500114221 ,  47727229936605171 ,  266378979420021899 ,  1321669232809765493 ,  2292870897107840327 ,  2163387369463693563 ,  596832207590438133 ,  276523177855916882 ,  2015182016658740029 ,  466520812927324858 ,  1127409514005573484 ,  2285791647462339175 ,  577848020419392298 ,  436014144461082205 ,  1152283179324533165 ,  1172424576628195381 }, // x^2^531
+
+{ 859598818089596731 ,  158818621436341957 ,  26003227901461272 ,  261929750989411455 ,  145820436356856753 ,  753564487546137156 ,  828959715727658298 ,  184874369594368484 ,  2119250891962129342 ,  972457392533792700 ,  2196770471574301738 ,  1070761431890850552 ,  1651089475664767262 ,  176636853058139464 ,  1152463240507850502 ,  817671369164990890 ,  1107729329603058671 ,  40110132350238503 ,  2077902818126917084 ,  301020139168641575 ,  578560947669822461 ,  531420298703998472 ,  2111504902857645392 ,  414776295575822822 ,  2138881295545537563 ,  83203133152295815 ,  2112713968483342089 ,  2138696867774164222 ,  27729854795748313 ,  220815298718047975 ,  1908610156416278580 ,  508100617428476366 ,  703150556647833589 ,  370371406690197734 ,  1611827746752092317 ,  353141433583553256 ,  56144928954757361 ,  19860991539405833 ,  1302658661123570240 ,  780777157733721473 ,  853595563299421353 ,  950510865632953998 ,  177184196802884674 ,  1867606355293057871 ,  2135819334797881864 ,  680335227504888165 ,  1179510126306969718 ,  1675076079175809398 ,  2260732430714918597 ,  975639884393413501 ,  489193770117516901 ,  1755020648145458709 ,  284942693743791383 ,  353681071114685256 ,  1661866459179643671 ,  2054719064961403672 ,  2127594981456081522 ,  71598937071358714 ,  1317446610342077644 ,  748221956168710838 }, // x^2^532
+
+{ 1800864492675624991 ,  2295393151063153659 ,  1777794841074900367 ,  248474323395459960 ,  1798579256094752207 ,  1683680500268888262 ,  1728973328380745642 ,  1790808742351097222 ,  729306862505230668 ,  589682072824880974 ,  880150579277175088 ,  546129591177331246 ,  540877562372089063 ,  89851282550969153 ,  1654234927584898537 ,  1830515178808020347 ,  1849235586110571118 ,  1871059530542246335 ,  239909045519555875 ,  1107011160161802761 ,  2199042940308510455 ,  634124378402370026 ,  1265612104381676211 ,  1159938947994171816 ,  300400805192427356 ,  82255768878224309 ,  1693028663542042815 ,  1129661244340126651 ,  1738376632024719083 ,  492699049355031247 ,  633224749086014515 ,  1587962364559314079 ,  1875332842792151771 ,  1227062755543970804 ,  1452202103937004698 ,  177759033001439009 ,  1213794170447921606 ,  1911364970062446752 ,  2182345689027561969 ,  1144383950774348690 ,  1191286979910896380 ,  424713037140865786 ,  1605192534700193298 ,  752659853067627174 ,  2113863849055457965 ,  1595760688996227300 ,  1646002265588864324 ,  535382694659851303 ,  615717762826006516 ,  963463365941799108 ,  1860485322878172323 ,  703750776167762279 ,  1947206107360055779 ,  1109299547309040171 ,  967336763630040033 ,  60091558998224421 ,  1955125638423591755 ,  2114538232718877421 ,  304715789785352517 ,  578302470907731749 }, // x^2^533
+
+{ 345751225801012550 ,  1631527013481421941 ,  897854143338801148 ,  1514759833666294620 ,  1686657486744391877 ,  476571014551845353 ,  1146884923357326396 ,  2157232979022514429 ,  575597402531256357 ,  254582065533458379 ,  1414076686109089740 ,  1930099132626386876 ,  672871944317114481 ,  1962546328701819832 ,  807483682334171248 ,  1162992943201995100 ,  680823609567377258 ,  739827999622482035 ,  125089180561798253 ,  418723337531200727 ,  2183972991586721612 ,  1426014770332089554 ,  794039978452968177 ,  1735226710784504009 ,  1921322865090065436 ,  2179048000860313887 ,  1165404952589495311 ,  72354215316702024 ,  668305487240476261 ,  1930511759112372221 ,  1373767581582255834 ,  128641428404411058 ,  1353224653897974930 ,  1020739570815970684 ,  393974634881612764 ,  687944240580308845 ,  1181340831818609819 ,  508605287434175442 ,  1243579557669626510 ,  1510723380455823868 ,  550325536743912515 ,  1437596009168917122 ,  1914481840577237489 ,  175072944164395355 ,  385094389230631496 ,  930621553835014903 ,  190894124548084040 ,  566473886687276768 ,  1259345875531256502 ,  1753433370717634548 ,  561603236471138861 ,  2091604468013287720 ,  1554199191909185426 ,  932825105339032941 ,  1884330998632289223 ,  2196850821554999484 ,  1931989643863719013 ,  875492183617455932 ,  1003229778620652798 ,  1777367156474326060 }, // x^2^534
+
+{ 2020576850187657576 ,  111790250950366015 ,  1776125170684800699 ,  403453867953501265 ,  1772262339143751125 ,  547246328029207601 ,  1997877343080962557 ,  752795830805261126 ,  1448578842718386121 ,  1802463649386408753 ,  1765526309689247487 ,  519101598174615 ,  73230998125466287 ,  601870170570261508 ,  1527146298344937604 ,  2092732078381695922 ,  1926300580564435779 ,  686799041072127809 ,  1986937633640731384 ,  259299486315597589 ,  1882733359609064291 ,  669641058291617896 ,  2164194635707605710 ,  729011380525736086 ,  234499792981117202 ,  2226455164621649569 ,  96914452844136865 ,  1990740874166186402 ,  1664626362423971297 ,  119032407890634949 ,  1084684534795169528 ,  1197928521351979256 ,  692305817888616041 ,  1938841326011839986 ,  599857271047328124 ,  1124946825427302780 ,  1164534598892499319 ,  14869781752373216 ,  994350487593620629 ,  1911158342407252503 ,  907507796679062587 ,  1820109246071310205 ,  192722446933947340 ,  135148065427536405 ,  1981227927528370976 ,  1311487926890842047 ,  2039818003104399670 ,  535491256927796213 ,  90686356939802349 ,  2066397850107074594 ,  115998350606727868 ,  767287973320246065 ,  102441950336801243 ,  1740580875114969769 ,  840782374626156486 ,  2136459491533506841 ,  1599995546046815797 ,  93067919999301122 ,  1707366352248207729 ,  1214369090323992709 }, // x^2^535
+
+{ 807273152102729583 ,  643738235219522676 ,  604969143063040581 ,  715233156018318692 ,  2082798612440960173 ,  88671773789543458 ,  57333991074306274 ,  753992190435113837 ,  1744395467645266014 ,  1538144549728071517 ,  94663025432499936 ,  599548226245647526 ,  165301531641611580 ,  1210471061196560440 ,  1518022604404947292 ,  550638505734351630 ,  1882934897362962043 ,  631072646880090668 ,  599078581108081539 ,  198188195003374254 ,  371600623486668507 ,  379573682518169768 ,  1614183923403149993 ,  990939960615081773 ,  944923403786623281 ,  1132554776725134031 ,  1293481847225445811 ,  1079095875081130335 ,  1306529785875002487 ,  1964613585870533538 ,  699620719879863910 ,  581431746813079802 ,  1844287637544997770 ,  1348990576047100524 ,  901983173594681491 ,  1581915198755637536 ,  1894375404548837273 ,  1245041595973670340 ,  1705606422333219497 ,  1504144097817777227 ,  1261314664493131282 ,  190861693598257125 ,  1096665436834309983 ,  1814038641545647200 ,  1868838165371299572 ,  949464748294634989 ,  1699245861707952776 ,  1587915390013194345 ,  1477563903033012863 ,  920373257392797532 ,  732197847571631986 ,  2200214431874969730 ,  2288163957088141762 ,  1885393922047863713 ,  504907269915661677 ,  18479044299265588 ,  136541050234414435 ,  1128435568664758268 ,  2238256124725522115 ,  590762798985589246 }, // x^2^536
+
+{ 1832303699208681943 ,  2144783495488898395 ,  826063866782973689 ,  2018685357919038726 ,  2152974412896080641 ,  1312502237530991210 ,  1770668467174293441 ,  751285059795703830 ,  1837580304165782021 ,  979919940978569528 ,  1969842351858289124 ,  817065017700411481 ,  2041150513770681197 ,  2019879339424350478 ,  2054384113349105752 ,  789452419603077612 ,  2258694068984815360 ,  517731477053432779 ,  1939362293566121372 ,  281593547685248990 ,  2248575733367295984 ,  938193353337411731 ,  1133612311495644281 ,  568839376371088645 ,  2136038778896296207 ,  1390955435834021467 ,  1402683083481113130 ,  396467947960098192 ,  457272976351253774 ,  1673589333307077489 ,  1705709687341780747 ,  553719475400501069 ,  1428047083229233561 ,  1556392243580092126 ,  413017321632952301 ,  275451337818260002 ,  1889516518204214249 ,  72840040711681524 ,  1433822170979969585 ,  1500845751268819165 ,  1527873995082812512 ,  1981046122230632818 ,  2059766695547052118 ,  899570366733950324 ,  1775473346050275350 ,  482168539781438089 ,  1532541569436690802 ,  414645436689505691 ,  1835996063953373964 ,  1491098610249280887 ,  1372604569559020694 ,  1541202233113111850 ,  791126343952948365 ,  1007918741272077461 ,  932372677225693030 ,  891989691055695029 ,  1525315200303291346 ,  442711632473544765 ,  373608007549220117 ,  825517311179815256 }, // x^2^537
+
+{ 134669986007247487 ,  5531495729636723 ,  190047509035034981 ,  1231858040889012890 ,  1888852199047704418 ,  1237666418941350838 ,  2294979119347349331 ,  1031768345082463247 ,  1674911311564442384 ,  1625916032535846601 ,  1012318370540457782 ,  1060177276910942734 ,  1763967681754181974 ,  2287743035351009090 ,  2024664265192726277 ,  28648241967562723 ,  1090109431148221536 ,  1083893371632141099 ,  1746616915181611236 ,  796454079844832742 ,  2175447682990021824 ,  573182625412725545 ,  2215719933043193651 ,  2261521476071805809 ,  745335247475633378 ,  2043230393672412804 ,  2118191729137340298 ,  2038723435921612892 ,  119181009022329414 ,  231948497298428757 ,  1284365365695416001 ,  1330491739242629208 ,  994799572950486275 ,  1704050008786845178 ,  1410377002677373988 ,  341587814014932825 ,  1004821021140949723 ,  1055748880274013830 ,  1390695868723030601 ,  1453668365736530547 ,  369833059561403592 ,  2019203919579088261 ,  195812241839501698 ,  2120766426052763533 ,  848019250635208897 ,  1638438249320451234 ,  1921478141968555525 ,  1513414811368855906 ,  632384223406927289 ,  2286205388649013661 ,  1639927295736831608 ,  1792106270581623758 ,  1314008351457821160 ,  1812964263831287693 ,  569673015890126287 ,  1187047761195390815 ,  1836082405386894365 ,  163871036792693689 ,  1490029265150990983 ,  2276731431992280656 }, // x^2^538
+
+{ 1671136301026471252 ,  63987338376221575 ,  2003369971747758585 ,  1682792706537311082 ,  1062943746432943109 ,  564001670723765309 ,  164074142347227372 ,  109116854016803709 ,  2176907112938926522 ,  900772202092051365 ,  927515841658252636 ,  840991794741436617 ,  1508008095957392071 ,  404365218724157975 ,  1524871798072841258 ,  1942532692122292331 ,  295870966654493195 ,  571478558320253644 ,  972943960968859841 ,  314911137396851777 ,  1093901202504070502 ,  1971899940556588749 ,  12025555492992665 ,  1736288255895430511 ,  1259505474335485338 ,  299019817936290669 ,  348451462701491740 ,  1065544335493521472 ,  29654907265262144 ,  322361077275470419 ,  1791148065951703965 ,  1275240098264502903 ,  1217357274195962953 ,  736226029435596760 ,  1026362617933515652 ,  234515043507624978 ,  935190263280647045 ,  1752488052207989725 ,  770505379581645553 ,  268665977718959281 ,  679360301619221928 ,  921340452321610543 ,  1578507551613473386 ,  204040545258573785 ,  1319964364913957177 ,  1404969379668546462 ,  1224792683564884321 ,  101275223755241100 ,  1958211685297216679 ,  2115531805770372126 ,  1723732643806173110 ,  1154914361545521618 ,  2018072638289745542 ,  541167646466377979 ,  165996551494009827 ,  1466085895581950609 ,  1445575572757848369 ,  2263204051868018194 ,  1137722806060336913 ,  184994641004287277 }, // x^2^539
+
+{ 2313573522952129 ,  1902199350234195243 ,  2131567044941727088 ,  107786454804263175 ,  916797216935275216 ,  2266116550279637626 ,  367140692524990794 ,  27031783031920420 ,  1110188551539284812 ,  1341855706769670049 ,  1821395766928281190 ,  753600003040335409 ,  1783626242738716140 ,  1594104169690989529 ,  302093303489542499 ,  582359136317746406 ,  511111806035802790 ,  1381611970487218674 ,  396683375095408852 ,  1051263090025858765 ,  1663824214932489739 ,  870954312806063971 ,  2184185135212343916 ,  2075986625558380380 ,  1352955740492766421 ,  1246284816310713942 ,  1481956394508894033 ,  1683431079430583211 ,  1450180034923664690 ,  2095236015378293469 ,  2059810818621904415 ,  894960905790337527 ,  758962190493262396 ,  172003414113084586 ,  402572215048615127 ,  2257714523852676423 ,  2219831971352549187 ,  1378041594057344149 ,  1342585518441966047 ,  1730249513677462810 ,  240087367225076584 ,  78375923804277814 ,  1971533711978090768 ,  674676616474236056 ,  2094574916869454181 ,  927387564387215054 ,  990166255389588442 ,  767491421816943314 ,  1627904263445210446 ,  113541522365607931 ,  1442516854372317656 ,  751432644316335460 ,  382942874692299163 ,  561879254442364410 ,  1433933371991316718 ,  1540480918356342070 ,  384409404742048546 ,  1325139768385264889 ,  280824389020047167 ,  166641809804662682 }, // x^2^540
+
+{ 30299764595387931 ,  1053995652241724588 ,  790431121108036390 ,  1481292586310090599 ,  172855809214810314 ,  1840209624120979087 ,  719856942261523744 ,  1038848165153237471 ,  415701776586003871 ,  1388232272543471380 ,  1753867670576178411 ,  1621242883099862051 ,  2086550600319604570 ,  923400024357340890 ,  1583494508403246259 ,  353045135164611737 ,  855977514510911515 ,  1796203109071093501 ,  532359010755058261 ,  672863570054327435 ,  29025725231162784 ,  21329672854009896 ,  584263355185886542 ,  1377909869344776179 ,  858868030069826431 ,  1429417803335590377 ,  831311096272578853 ,  134432997217105208 ,  841182370797073498 ,  1607372144735139130 ,  924528083202516579 ,  700956873759040181 ,  1783836330909202008 ,  1536709903349169564 ,  2087802969840088761 ,  1212348439280773179 ,  1795977370884894172 ,  1523117148109215229 ,  2121427304675694290 ,  1919559739175137757 ,  915869521242169480 ,  1907313173832664811 ,  1130910242090025485 ,  864032015072600083 ,  255925600471500588 ,  839715998334995507 ,  1072240565883700877 ,  1580847522219463985 ,  2237453048493177362 ,  1652859845259985228 ,  1147449433285744835 ,  208586628625852472 ,  732456464675296402 ,  1842055995544940952 ,  1009432845290411897 ,  1407775259552133811 ,  28146067760871491 ,  484228222387499675 ,  1503294559376332075 ,  1740864487479992505 }, // x^2^541
+
+{ 635162002617909576 ,  2088217225965736800 ,  1881735966432687615 ,  1185818310850527571 ,  1515373452878970884 ,  1502265800594576354 ,  766347101027427396 ,  1894034137536945479 ,  530866566357334783 ,  1781827099243927355 ,  492093145834367223 ,  1003132239338308021 ,  2043192853804861885 ,  357661964901557207 ,  407975222438444492 ,  2072337515661572899 ,  573878743526313696 ,  1460138104303992243 ,  457445293738069201 ,  241416096934123433 ,  669172404785549888 ,  895606920493688619 ,  558124894557551201 ,  2091422474846559509 ,  1898821949731187995 ,  809466668213947999 ,  1163217533501753558 ,  12842614607258802 ,  1744152534808388942 ,  1017110799538073457 ,  988224271851894106 ,  354357883953426515 ,  2109797784454013613 ,  130638038640320148 ,  1083382409840873250 ,  360743251577451447 ,  2262935446470744309 ,  2270111092070605169 ,  1625702593936838132 ,  1135101360416394816 ,  817054550187928212 ,  893099653870226695 ,  2158757851545907808 ,  1067087080563081302 ,  844569376543352749 ,  860183800765048010 ,  1569874726924255209 ,  300037310746662780 ,  456802256621394503 ,  1642613119029768750 ,  618265951686287148 ,  1313437080892468572 ,  1595917766356858667 ,  570331598785004755 ,  505932452425074553 ,  267996660831346955 ,  615446589048478166 ,  823673751414827265 ,  1268353471583733358 ,  190651462539850748 }, // x^2^542
+
+{ 405709948458589969 ,  1310204541219779870 ,  692226794795552703 ,  1936268223731204047 ,  979900892347699715 ,  1147911538038689873 ,  2266512414899041649 ,  2175485654410305065 ,  88996164100148147 ,  519757773666687614 ,  63236223747345449 ,  2146232925362193907 ,  935955249297589734 ,  1560055650726482122 ,  1454908673387363496 ,  384443591966364946 ,  953814798150462395 ,  1949909360429901244 ,  795262718761505749 ,  719873765413065632 ,  1026942692581738696 ,  1098303744082209247 ,  486108338433958484 ,  1904555577172595889 ,  1028691837396660137 ,  358251290309940606 ,  2029493233029807563 ,  110499621401588752 ,  776382292903951054 ,  857625998591528041 ,  1918416970476018695 ,  999560740800017641 ,  352714562159929897 ,  30753399379648598 ,  1126458490420331087 ,  1339577025757609988 ,  1519167368287573881 ,  622771997171296963 ,  479995627310131430 ,  1898455887816808921 ,  1810380981670658689 ,  1238922756777362182 ,  827735258043753780 ,  225015619802406383 ,  1630025244451785541 ,  1723983666858859681 ,  1449540899535674717 ,  1821837021609946812 ,  858461970089768358 ,  1387309746130143872 ,  1799350739429871688 ,  19858335988223145 ,  1935174576796341631 ,  972268227617232016 ,  789698229893197786 ,  1647579382096464921 ,  1626167424347718375 ,  405525038050864578 ,  1016071144728696959 ,  1454534138249286920 }, // x^2^543
+
+{ 1774449641213183482 ,  1473830443336792410 ,  724809407768971781 ,  1379183450387243211 ,  870891929657588365 ,  710122319529479600 ,  452723222818457015 ,  371335706639477865 ,  1175503436807018263 ,  1216798029477478994 ,  1236154027705290352 ,  431320143408600662 ,  1959290508035585680 ,  1080971833214451390 ,  1220252582530169033 ,  2027356151507179230 ,  1517797975481827542 ,  1501032713862236563 ,  1886895285945576937 ,  515297375805483340 ,  395765900713451744 ,  1623233858012439636 ,  213829556005373022 ,  138628390663316310 ,  1043883604637735923 ,  1873317319954830880 ,  87584164857244793 ,  1381371589261780497 ,  1925344759275714517 ,  271989583186998347 ,  424097552504074549 ,  1177924101796332900 ,  584249088352910590 ,  1252880852946766567 ,  2275302629025557597 ,  790908867034173610 ,  201404548819549139 ,  2105961444300414027 ,  1678720563414356183 ,  1224389541895265552 ,  257316910050080136 ,  2222577314572936071 ,  1968736871288356949 ,  2305802165612547362 ,  408757773760687092 ,  55192239256786681 ,  277390276895585712 ,  1579107296285491692 ,  2224323792108156423 ,  2234026207806254983 ,  251345423420325678 ,  862485404644975496 ,  898910688200649941 ,  2025160109963285422 ,  1955788822798177689 ,  1290787149671765073 ,  406644061208934685 ,  1945616594274183788 ,  47988122395949003 ,  1290714780803014250 }, // x^2^544
+
+{ 965850243191434762 ,  674824933248960013 ,  2114798888063637342 ,  902959334241410632 ,  2095296021785969536 ,  239763346069471868 ,  1063496796014324561 ,  2249754298673306631 ,  94097501255142001 ,  1961831020450852876 ,  1139820178144713373 ,  2272640297949662124 ,  201617039523544304 ,  592069364699219293 ,  579590687809292630 ,  1253895588870010932 ,  305037287306433226 ,  939611777450480588 ,  1376793265036440019 ,  286346618595095045 ,  155982068090145758 ,  295376983551367267 ,  2227389152961755820 ,  780855761734478477 ,  1133500985645020051 ,  2160825095786321216 ,  1367776908658858115 ,  830493339289458003 ,  1733524406413723601 ,  828407074067705451 ,  858774928988257449 ,  1008282604316715417 ,  1674760644126307735 ,  1700823782853116981 ,  1841196012240542073 ,  111963548841235940 ,  1605878433098615169 ,  890761890410039020 ,  1670603230316958466 ,  1001167281189500359 ,  823200541076997024 ,  741212395892717799 ,  556700229746938587 ,  325441486824545116 ,  931935802899871055 ,  490674446076969154 ,  827200928189117057 ,  1820960445183439684 ,  1135300573391941468 ,  1804313605316542207 ,  1281393596094793066 ,  57294689224003893 ,  1038596193914334918 ,  78461075942556992 ,  1158597528377486319 ,  1440657660214436580 ,  580047166299917476 ,  595798427068533073 ,  73323524735657559 ,  1254261749736860208 }, // x^2^545
+
+{ 2135078074360600174 ,  1503608327329504429 ,  487086627487506027 ,  1570016613362355293 ,  107376086250148106 ,  741479129650534067 ,  1687537042117652706 ,  1161022176972426560 ,  1362392649657434282 ,  507805832568037624 ,  850947247533772154 ,  529908375225376299 ,  1072427237295562383 ,  1607806637181811793 ,  2018226021908914796 ,  736960217341384461 ,  2106108188548143505 ,  267477929704738315 ,  1211408337007312106 ,  441352914907209930 ,  560429673515461031 ,  1228860008686674027 ,  80325956541030442 ,  223204813621216502 ,  1246427518080614313 ,  2103014523643115474 ,  1824759678277757523 ,  2179086074308078161 ,  728262908223622812 ,  115003846845468996 ,  1282948200683701436 ,  914106394373377457 ,  859508176221953332 ,  256461619126719431 ,  2069133322415592441 ,  767477862959054994 ,  1397291794070152068 ,  678261532460372852 ,  497456976052412102 ,  1201408697530495898 ,  883909101806648382 ,  824479777928395307 ,  1502507667283420510 ,  1708168140372499993 ,  1323955858480380362 ,  963793065889469678 ,  1767621739784354328 ,  1125606845223822403 ,  587318575264447687 ,  1100325938868247819 ,  1608681531973658647 ,  816199422872916949 ,  1583742914167693995 ,  43088017797334412 ,  1274471325851452630 ,  577199494288644682 ,  2191375877203404867 ,  310256613644662037 ,  47995832628731126 ,  965455816254930200 }, // x^2^546
+
+{ 82095739789335005 ,  251455931613315731 ,  1389680696002150616 ,  1513540013849049606 ,  326569998621279262 ,  2125302329360237026 ,  369629610124288035 ,  5211781474717185 ,  108748074231116975 ,  72189885315089894 ,  903262552294048876 ,  1757516296966010525 ,  1292846666214974174 ,  1502632775465285498 ,  1445109929076205982 ,  1422968095857384590 ,  1892379863272332236 ,  311108117414274481 ,  1783429139198710771 ,  892918244435612629 ,  751456896557340635 ,  1964546885361668724 ,  2154081167950018049 ,  1774150408139411191 ,  306352949161451283 ,  2208061704966432457 ,  105556531765198088 ,  1359790370509361054 ,  630813812540908641 ,  1662215716680287118 ,  136203165580414982 ,  204417048789985738 ,  570184051074241047 ,  274881982672924972 ,  1534044020493295235 ,  1987034114587066177 ,  1653768807597844945 ,  377647173134425173 ,  1278778641456021385 ,  2170844905540727193 ,  492367856066350997 ,  705265831304153777 ,  1811652380468669816 ,  717759524218094355 ,  246794363438677762 ,  962797958665587290 ,  2070956868833808742 ,  937690549289041243 ,  236215302641171596 ,  847507166833695141 ,  458741869765761869 ,  593949986793953281 ,  261222481394615194 ,  277934314863507645 ,  1653838651071263403 ,  32214839816066231 ,  1820604894620942920 ,  1797092448686184639 ,  2104641859974747400 ,  1644262397509263325 }, // x^2^547
+
+{ 1079388850570377912 ,  562776541657193105 ,  840893390863828687 ,  303464612515784342 ,  553156761305567354 ,  1519347093810650855 ,  959361994902004442 ,  1313720697362255747 ,  1549976069509014098 ,  828681191245303808 ,  1094002269007742462 ,  1708691625921013229 ,  1286066289053510744 ,  1982079652698081188 ,  1013945303769051408 ,  2016746473786383944 ,  2179254814627462051 ,  2091065473385157340 ,  718358114306000959 ,  1809330948868685600 ,  1254533734039541410 ,  282797159311940483 ,  362450995963945271 ,  1599681234433891021 ,  1037906997863580581 ,  1604136641177098157 ,  2089302759879610605 ,  1840336238705428413 ,  692979665942291083 ,  1246507850815143607 ,  1316440551821351673 ,  1139215834489824709 ,  26669882788242302 ,  403470287320916834 ,  407176815695254546 ,  593907791819657652 ,  384997947053096017 ,  1961955684661900924 ,  1801847724097295164 ,  1160341639370416038 ,  1695024558565527966 ,  211464542999009478 ,  182875832511046673 ,  876752304282304497 ,  283915270435759551 ,  895632207357842276 ,  612704842210915310 ,  61987769747698907 ,  1265629844617919782 ,  1939283113715459884 ,  832177982182344876 ,  261793589167951065 ,  1497231586992202698 ,  1598190960553380805 ,  2299728001895304160 ,  621563393312122053 ,  995486469426633031 ,  872954267164338123 ,  1928386869173233547 ,  1523219187823090253 }, // x^2^548
+
+{ 151916076143745260 ,  337177439297890207 ,  852039062523844353 ,  1947779348350701166 ,  1335182289299722552 ,  1333143839870592058 ,  1688538211567094090 ,  1685344560233110995 ,  1100037633842186664 ,  1253643946087522361 ,  2186437616763111837 ,  746408830906371209 ,  706005229161459055 ,  2230040562591845279 ,  385303581465028723 ,  1107250633328421063 ,  1722214111627624266 ,  1968604473957889370 ,  1898741888615097217 ,  1743458831274394396 ,  1306070291248616203 ,  1391328867794868474 ,  1283004563993336930 ,  1229839638822420947 ,  102771268292259454 ,  498043035525406016 ,  746080811913294239 ,  594692609903886830 ,  59617272301771124 ,  696410015186371183 ,  1081589417966399957 ,  1103651550258574650 ,  222656150940157894 ,  352507089170378518 ,  1332255323633827533 ,  2173652376222288898 ,  848886683521744455 ,  1754852320228030362 ,  1278292721237463506 ,  799260885118256564 ,  83681520779452809 ,  1377611515743235682 ,  1652975222413655560 ,  1307020095501329257 ,  957573716327673411 ,  1018751803806085768 ,  591068931997393726 ,  2173345678414545865 ,  1557694954020319339 ,  2274987127593011184 ,  624271505880295414 ,  1582358700871666026 ,  1151338099909551646 ,  1543251514972633886 ,  321293258774514993 ,  383358718947980071 ,  2261943606358663883 ,  1098918548015472649 ,  59835305016430625 ,  1281005749934249631 }, // x^2^549
+
+{ 1183531946040378846 ,  914387925622870493 ,  2219518125648718081 ,  1113472746129755301 ,  1706631545776064211 ,  709756447845969506 ,  976514068556756582 ,  1010045821467210492 ,  1469352053311347304 ,  2253159941327444717 ,  1802565853198559270 ,  365832546715674221 ,  569814594829277616 ,  1028156059633002476 ,  1455587722153194692 ,  1194939738577775482 ,  2173599965694054682 ,  167082825497224299 ,  13075574441304244 ,  1226539970804962111 ,  1403874131462950947 ,  438657978196338174 ,  1240894088214617816 ,  559976164379793424 ,  453518297879321992 ,  785006985363309376 ,  1162036511497032042 ,  1905571469924075255 ,  526868782267529094 ,  1600235970287689693 ,  971406529826141155 ,  269205842508748010 ,  1889753344264171670 ,  2071596605325992194 ,  752831241434672788 ,  1529296320088057356 ,  1410276525424932599 ,  1485974616558650448 ,  547806660064237002 ,  2271374927202710466 ,  1621935888418910055 ,  68336106568591654 ,  174486141842911643 ,  872485702063751713 ,  1616965563670707959 ,  1100687963953169339 ,  890782826619146719 ,  834058329977641638 ,  352204775681697559 ,  397057144677078191 ,  1557025693359340049 ,  1758759697551687189 ,  2277432197871932807 ,  296728828106848945 ,  2194112436678380692 ,  801231172868525574 ,  121991178011461950 ,  1570392257365526183 ,  1215666386898251360 ,  1026415830220412616 }, // x^2^550
+
+{ 1791431236031522102 ,  859230345197615254 ,  830028761481913958 ,  1183676605996601024 ,  1017388368767960834 ,  1897493804407500683 ,  1810161436516428130 ,  200113465894831354 ,  587925271821097973 ,  2172938454659103573 ,  117423589806312838 ,  2028936703160934502 ,  1153439382947641678 ,  741207402613732246 ,  1360989857410584308 ,  1762508346722781634 ,  1919938888506914168 ,  1650111098153431308 ,  683749255812212819 ,  1759223654912513946 ,  76907591782698928 ,  408456454155859915 ,  1008346684379517476 ,  919915276106802807 ,  1222477334809824387 ,  681976234908779562 ,  1298946521614116086 ,  1975403220261352702 ,  513153103639588254 ,  1855385015475299437 ,  1602757981886533597 ,  1539836397914103449 ,  613373323187709318 ,  2304186750133730613 ,  970996716183344315 ,  2133164586967477237 ,  1937813958402798661 ,  544440618784193430 ,  160431297317742979 ,  822307472515009781 ,  2188131896024614449 ,  1683859307601822849 ,  1312646153769129667 ,  251607627882848750 ,  1670859318122139218 ,  1685105130981564029 ,  1393047095323752302 ,  339094951947662710 ,  801359940805116921 ,  403937550394240447 ,  1792299361804926191 ,  280440823882779302 ,  1683322667296268115 ,  1436348416010392171 ,  137378680704506720 ,  759655860158649457 ,  2214323165877365729 ,  1145748560263844941 ,  894959899206798694 ,  575865526482946220 }, // x^2^551
+
+{ 1371713484730350198 ,  2223468220339497909 ,  1594998677896676350 ,  1876514679088446115 ,  214752984153933790 ,  1437711952771440497 ,  2032327559207192915 ,  807294576784933425 ,  1480384601523757978 ,  2037601315109143369 ,  629124843552145713 ,  1705279803540306735 ,  725987485873814951 ,  1547206813401471163 ,  2182316387725658273 ,  285166078573331964 ,  1315678266836739710 ,  179864142880080082 ,  768727512587299980 ,  1216659490157683370 ,  610602521228680793 ,  182972405785918352 ,  884398905198295134 ,  33454067804327212 ,  916047558083444359 ,  910880817803253530 ,  1894027430515358098 ,  342043056276796938 ,  1422874491422292907 ,  1839239027674840465 ,  1025406337854937914 ,  945910633633768732 ,  1555688731168710608 ,  236015926800377905 ,  48709384029039907 ,  107898266548661138 ,  1772001623439327140 ,  1892247922025725176 ,  2094285678385200994 ,  970359833692147608 ,  427833786252058597 ,  337926042152380245 ,  1678447557523273124 ,  1052471099181360270 ,  2112035608383665748 ,  453809339728602051 ,  212922286648830860 ,  1477517910468496001 ,  145847080074135272 ,  1945945485290256296 ,  1711359979153362690 ,  464587220802279683 ,  35136883584011123 ,  820769306218077772 ,  1447494822524165176 ,  1050916445591376176 ,  1822883593941269550 ,  1796032981745671337 ,  2281149637228302664 ,  1183189488109625250 }, // x^2^552
+
+{ 23408207564291310 ,  2118709438641694013 ,  66320350117116034 ,  268614951938013096 ,  1545418832651528190 ,  426011745055422224 ,  2177019841898947082 ,  535294899911391948 ,  1263422739300843144 ,  1745835362735881029 ,  560109199424978003 ,  2009405174153243236 ,  2058082962744235270 ,  423339506642566970 ,  500221806620442879 ,  1855252420615326297 ,  843594127001358174 ,  441312830077890790 ,  231940759505230888 ,  1533409320347235536 ,  1529223093129597488 ,  2090391951684802336 ,  820751416499141355 ,  784288263787085323 ,  2259204493122171023 ,  297935385058604281 ,  329547913521904323 ,  878414027883880651 ,  1397641374520488176 ,  1423898105797939952 ,  215667252127802233 ,  2242743763789578832 ,  987422373158555449 ,  1566102002738503248 ,  15526480444097709 ,  244314716605489838 ,  151813933114178767 ,  1568781000531666400 ,  1696379471419335587 ,  74760270016046704 ,  2053730357819249222 ,  764441441459741397 ,  2111685183915221512 ,  527602769086422166 ,  1935802556326389425 ,  1708419033872918355 ,  547024125123768195 ,  1457354908955761177 ,  1120061247344525033 ,  2124819186445096114 ,  166218649907794485 ,  1478741328560118624 ,  875337287354630139 ,  1662751268989364238 ,  1262409301785662246 ,  1018277470382892638 ,  330884703032813618 ,  1568066118770363119 ,  621314608310697443 ,  2111481295462605424 }, // x^2^553
+
+{ 1386405449073015355 ,  1040809698506879305 ,  762438262594155679 ,  475328799320722611 ,  1700050522976557221 ,  1287485120996863594 ,  2282591093649437359 ,  46177014224275091 ,  2109116833215476897 ,  2194488031040604347 ,  1068944909993071165 ,  1018053790461954090 ,  2225931541290141307 ,  61614143686790438 ,  7029442556372085 ,  1834023151432238146 ,  691845470385641090 ,  618024897882899512 ,  1689044984677692445 ,  2300742334723182614 ,  1383736453171524386 ,  1846728765583498036 ,  611037298779100170 ,  889795914425193419 ,  2166774417832275577 ,  1969178046810236150 ,  1546955458518428183 ,  2282990621583348107 ,  1114090717570617396 ,  309730614743116458 ,  894920893129398732 ,  1546210205471180742 ,  1513671725758094072 ,  477186309096992650 ,  145492242822229962 ,  97802509844643929 ,  49588094277275472 ,  1675233510012987634 ,  315373463829947301 ,  1349369195175106034 ,  1264170280169661171 ,  603898238379357043 ,  1361903142045644506 ,  154623741075132593 ,  2011879149236609806 ,  32055976558273422 ,  706898504948291810 ,  1957698271964267290 ,  1066586800697300843 ,  2250855978765599865 ,  1464094381160001648 ,  203692414086370923 ,  1551720714998347465 ,  2131074158481388499 ,  217053610764950478 ,  540963590769814587 ,  911242695175386827 ,  290380812764768135 ,  946989090999987033 ,  1890706087381473002 }, // x^2^554
+
+{ 1087474468180340056 ,  646155304295564933 ,  1309805338088752523 ,  1034419498406626507 ,  321938421273541135 ,  163724507639499557 ,  22900573006817509 ,  476201828958513659 ,  1091746808909023438 ,  1173469619153952038 ,  1157988628807916042 ,  272723178201474739 ,  219844309325989995 ,  1011101695171907908 ,  1189233842350701227 ,  309416442797981110 ,  1001905471689496898 ,  1056024819651304205 ,  957897858076552309 ,  922005553577533853 ,  660582285731327475 ,  16925963097646863 ,  1185042406507213110 ,  2029393499389579204 ,  221718432909884972 ,  2145522336697583709 ,  176837823501006585 ,  1622003062421284028 ,  2198934304142338264 ,  837265987091614128 ,  1653966608431118557 ,  797088962134279313 ,  2194720138324182474 ,  1812746742326696323 ,  87559857597788628 ,  649477093793577133 ,  436468669484770716 ,  1533280577122679912 ,  420584155800905227 ,  1154851986096047444 ,  1655472262643218699 ,  1947929520122504972 ,  1393384973454527835 ,  2104330387715884830 ,  987082375481560454 ,  1919937692402743206 ,  1160104833483315721 ,  2258785776921715871 ,  1061752336380121670 ,  799882924748586584 ,  1318060455777233525 ,  2013490695133027038 ,  1418475925652586027 ,  2117564823185406039 ,  1869037107986761690 ,  2100006777945269079 ,  914405270165327553 ,  568086234857271241 ,  1848564023521655636 ,  1144151715913222430 }, // x^2^555
+
+{ 406626253620384694 ,  1493272606207133097 ,  90594992930090423 ,  766461168429769996 ,  1996320705771672875 ,  1986125090426581241 ,  2111897827153045791 ,  902381207497302599 ,  628121727110545097 ,  229848271955359033 ,  442588025436985473 ,  2057744492690875755 ,  101865118823160679 ,  916522755444178491 ,  1724928612658080 ,  2006517275606578668 ,  566043681062341582 ,  2059315492831643090 ,  1278840493715584129 ,  61215285691158962 ,  212319590462481154 ,  40547004018756600 ,  1000050913309850991 ,  862575187558099102 ,  282179929169217893 ,  182580176849327276 ,  1938251861536085876 ,  1165207911380756571 ,  1354318710551168943 ,  1474561690670817376 ,  1278192020105920341 ,  783056244671486495 ,  1931444868733729953 ,  1180759001799236973 ,  411037879349122677 ,  1441367203730631836 ,  1818702162083938346 ,  1849266078074723646 ,  869533896925478985 ,  151660442774484323 ,  891735577615200160 ,  487821314670283726 ,  1258777433162701242 ,  1942951367951357593 ,  584090272117125063 ,  12295629766178033 ,  364681868162679933 ,  129570163303482 ,  1535341639980060859 ,  312370834312244988 ,  1912489890510286794 ,  861965020286546495 ,  12203610606594806 ,  1254877648528560829 ,  1089147323922249077 ,  1658295211586455373 ,  778677642785807906 ,  1134359778711516754 ,  1534888882950539868 ,  1183606274241214461 }, // x^2^556
+
+{ 118750756429623807 ,  487756616730559012 ,  1530434953282859269 ,  1038983535445842504 ,  1272411773102733942 ,  929106105181667498 ,  733762568103949490 ,  748573049490558798 ,  430823111099646165 ,  307070532874815243 ,  1981348797403412785 ,  287335502224018413 ,  562939830086845891 ,  1506855210940531581 ,  2027887229802213151 ,  136618548747922206 ,  1976569348135379073 ,  156977344411892140 ,  2036607238792406956 ,  2125355317076243724 ,  1107507156141531273 ,  1866752186359400620 ,  1418124230518455058 ,  2181963162834726756 ,  1967026359815703851 ,  2126729839690966725 ,  786091016605527487 ,  86313912327238685 ,  2213443117177310115 ,  710754670788715471 ,  1911640198481448752 ,  1579570258276499229 ,  793004595775974995 ,  1851374592078341168 ,  1307287315665829539 ,  666562681351471078 ,  1116748778297416836 ,  1374811704493756360 ,  1793056950446154449 ,  1672112543492032836 ,  386618834603464343 ,  1268049717743189938 ,  961717743281861738 ,  1815979989089382404 ,  1669527298270814077 ,  234511055175155211 ,  2014525157292116837 ,  1994993874441939782 ,  1874945358339097251 ,  664498158185159242 ,  1941336811918801912 ,  1828726030308859152 ,  127997164288120718 ,  1905058426702778606 ,  367441760542453154 ,  1032098369154270241 ,  1554314879209203546 ,  2109829428915879897 ,  1117146993944261752 ,  105335437313373452 }, // x^2^557
+
+{ 944792669468838305 ,  560924474870807136 ,  851460585580560200 ,  642968646813552861 ,  486852424783552681 ,  488924460948288668 ,  799523626590978315 ,  1462014286774308684 ,  217030994781228046 ,  2107050340099448679 ,  1035420062759208613 ,  2021304974783937044 ,  298316489418212290 ,  1711710946902929284 ,  2090261530700544994 ,  1740898671916722014 ,  1002643380765132389 ,  390205530722762014 ,  997480785944240245 ,  1837089577969791916 ,  1279489714856306549 ,  1457823040168392863 ,  624746771999332012 ,  1098945325824996012 ,  1450801773173653003 ,  130211221171400184 ,  1781876536126421486 ,  1838205096666143692 ,  166764172203629327 ,  2250987207119495923 ,  483456811284057214 ,  2256373059220135238 ,  446838188754875035 ,  1880689714369297849 ,  1173782051796617148 ,  2293449862230119155 ,  1755454890780517096 ,  1530908945061092195 ,  1741805210766431765 ,  1233748697771666238 ,  545837500104077418 ,  673186117838004447 ,  1223474573253676569 ,  1438098939664527795 ,  1276979620368215173 ,  1505555360595429565 ,  1673669899684908852 ,  1462953772263367118 ,  1072487062869210415 ,  1744277872610643292 ,  1765025074447235886 ,  823553376869228401 ,  1005508244457027902 ,  142939830529102979 ,  1990236283169308721 ,  1942439720208614232 ,  1471091011972939686 ,  1772418257239122273 ,  284578774650075891 ,  1926810556853743048 }, // x^2^558
+
+{ 1831554641963803736 ,  72595490173655288 ,  714107493284650705 ,  1953213368975725099 ,  2253973953269823597 ,  701237398888173739 ,  1960060391532864613 ,  211329867343337848 ,  1695534683358664391 ,  408535265238552067 ,  1391146887238143691 ,  1880566528878415117 ,  2086603805448165722 ,  1463962513826604915 ,  385354141223721047 ,  1890612024921395251 ,  1228491637955855027 ,  1585981534685711804 ,  381196667389893741 ,  1208407346964819819 ,  214176115858679612 ,  1305569636618966749 ,  461983765266672271 ,  546677127091541974 ,  1358856435341563045 ,  2063314898147466923 ,  1465831500346486738 ,  1186380626179538568 ,  222138603345246180 ,  1341824081492661336 ,  1070821577086371381 ,  421418545240196939 ,  1656310000601789420 ,  1281180822642982974 ,  1955190114575389874 ,  2017329277840411825 ,  710960604258888481 ,  995230548957474947 ,  2009354577419436262 ,  870103495517367589 ,  78659649445687180 ,  771103929524894465 ,  322337384266502222 ,  1963830011612165140 ,  1023534251249174483 ,  169943956472532811 ,  346436857520654048 ,  1258372747752000603 ,  1273154660248290809 ,  1595603056735415442 ,  369120751938509940 ,  1023820667881384856 ,  1445150515565828776 ,  1923377975233830058 ,  1474754367886523917 ,  1510803082163694905 ,  1404123411724403351 ,  734313594751143064 ,  668983121004404934 ,  1469307039280213250 }, // x^2^559
+
+{ 1135302025278620684 ,  2086035698794475378 ,  2163735226970401310 ,  1758169958684856311 ,  260015969380875754 ,  1584937843602108817 ,  933524112721679012 ,  1790461060792694816 ,  2282221995401949780 ,  1583623018237772633 ,  469208295098988070 ,  803725288747827688 ,  1277212479529902870 ,  270366583337650904 ,  1912916526619055503 ,  365488666410257073 ,  916741126267706451 ,  2096644550739774342 ,  266621370936451429 ,  2187539265505889545 ,  852482265467517316 ,  1715781999170539540 ,  2040301162434177856 ,  456144170496695957 ,  2282706124600014137 ,  1576852774154906559 ,  874780398934540685 ,  1704383930744340706 ,  1052013167914053880 ,  572229716324947711 ,  1182498751102384195 ,  420397008934866081 ,  674635236297428108 ,  473855763819292454 ,  2189387945465714807 ,  1025414966785212689 ,  2225125256288738779 ,  2298294768609438013 ,  1602443055708139120 ,  62328276286325146 ,  715655413111237521 ,  1128965781384587718 ,  1504874747181704209 ,  499179677929163932 ,  1207073938179057199 ,  961431629924459499 ,  690269079546754158 ,  1517257045635613128 ,  1079550043614211008 ,  1556149997424400397 ,  931396895800419780 ,  554416870234994880 ,  162585196054176216 ,  2173359738367358099 ,  338356273808840427 ,  1556769186152718582 ,  1609648721053294925 ,  479801864381957649 ,  787927104656830242 ,  678372393011223381 }, // x^2^560
+
+{ 1245538754724223376 ,  2199966155125144182 ,  2146329986518383484 ,  227842881232346995 ,  1561550229096646490 ,  1764179450848327776 ,  1175233231902802984 ,  425309924189049989 ,  2045479616049481488 ,  1231164355535073294 ,  485652911586782636 ,  486069947151023102 ,  1222519341491788413 ,  1336706032557037304 ,  219649309228621538 ,  1244330117490617025 ,  1158746486526791210 ,  812390116619370543 ,  2177262385211927477 ,  939436419282728000 ,  1307415089331104035 ,  490779807224817465 ,  1723542583924492169 ,  424186309077657455 ,  2091176834177938923 ,  1586337580085777541 ,  1450518481834522339 ,  1235575458777697222 ,  1733004196199956314 ,  538032874402921015 ,  1210167051233704068 ,  2050996742928819021 ,  693689677082901726 ,  966711421108912636 ,  262498440705375078 ,  533393261552969021 ,  547375387726016423 ,  1507682159242746618 ,  2079959272935100405 ,  917718643984217813 ,  1904709549084355096 ,  163853586827166804 ,  879797854646354959 ,  1945446307287243087 ,  2190162711950573752 ,  1626583573414995718 ,  1500886691967397073 ,  1358193706953042743 ,  243816369464533145 ,  1183307756769862558 ,  1882288376370551567 ,  1268130235231021260 ,  1115223688968931003 ,  1904189985464944640 ,  704999997444222496 ,  2216935685035137500 ,  541983989657503598 ,  967236959435327929 ,  476101496861461415 ,  2108894499873836074 }, // x^2^561
+
+{ 45824862867484463 ,  193075403817260346 ,  2174939774429066720 ,  2181283836290054745 ,  2069041941874989439 ,  2077452696954999950 ,  337307110854345861 ,  2174782891689236288 ,  362331284027207099 ,  391598146130646629 ,  872976660048179640 ,  1041111695930515476 ,  1968902043706303742 ,  2045196445830001762 ,  2075158595993527295 ,  1721358602805403082 ,  770692242627558454 ,  1943734389750553302 ,  1191209737310826246 ,  51568894973011742 ,  301984331863579415 ,  862677245950017371 ,  99102509355235504 ,  1426795485268446565 ,  1239232858029192932 ,  1356538767307644606 ,  1997109515324763085 ,  1010320330161471355 ,  1298843002961132795 ,  1602695887210317644 ,  1425886300218849219 ,  2142554991028972373 ,  1598543884379777136 ,  1051099814315557279 ,  1265354478208246117 ,  1825031104797156931 ,  500097107283805273 ,  56463054342331559 ,  308365824534774587 ,  893160445877111436 ,  1239041716298848071 ,  204618373866823899 ,  2202298284519058717 ,  2208282274222837569 ,  754417706558311313 ,  2136378102470849820 ,  431865029656936438 ,  801071617808207117 ,  2154453442308707183 ,  916691209322341347 ,  2060946229983231835 ,  346627117986200199 ,  377752505300990596 ,  1235977894469565309 ,  166306447952027292 ,  1876895018621161542 ,  940244836193876343 ,  1469582833117544426 ,  397329442627821929 ,  2288483562651166212 }, // x^2^562
+
+{ 73386198985759142 ,  512304105410809574 ,  804135568599858259 ,  427671492071699699 ,  22351346999386247 ,  1133914459806942493 ,  1626452397752201451 ,  2161121818843166507 ,  1609113091410438949 ,  1984062964322348587 ,  1930992739556153188 ,  1622311083056189575 ,  597577984724984318 ,  2008468456584453411 ,  1679340281970752471 ,  353096563337277790 ,  299185118123670617 ,  1742948436914025104 ,  1647504043745873563 ,  144603861744404898 ,  410906087213599115 ,  292294467645563667 ,  1487606039965977934 ,  2093980852628184582 ,  1827574301825506643 ,  1520262265071770670 ,  1298870256679391498 ,  628471342063967306 ,  656637466416812552 ,  1172254100490298895 ,  2070816669972411600 ,  1644565579979833851 ,  2098363407302118790 ,  1172669211996259188 ,  538917515884401190 ,  708296547301461427 ,  807794089125102537 ,  2065213426097381342 ,  632839681503860170 ,  1184899151169655587 ,  684189093124979340 ,  21195024669843098 ,  34092574542573702 ,  925932944482399574 ,  1732422954885156069 ,  2264374805982592642 ,  2011103653163511448 ,  1990645056033764374 ,  367275437668172238 ,  174914140230026602 ,  1290555431107707688 ,  1373480797774792882 ,  940168739198022991 ,  2003662991786813323 ,  890838193425426946 ,  1491402286436613162 ,  1162153060656905710 ,  1736963001882565047 ,  404453067302005428 ,  2082213644408283354 }, // x^2^563
+
+{ 1835888902482357533 ,  722528950138884999 ,  1817587581102178503 ,  2241310226478601493 ,  1176187948873177183 ,  1788804843545405129 ,  1386304771830422530 ,  643795158105850030 ,  1163650500982206104 ,  1429859307427051291 ,  2265034141639906686 ,  1203419150485300811 ,  268652458294391019 ,  1127804235751063619 ,  2280635321260835842 ,  314875831869749615 ,  1966819525660084408 ,  2184311760991205238 ,  851405773060956382 ,  103564715708124798 ,  2237604003215718880 ,  1237501477243563339 ,  1283339172261194665 ,  1574024337278828786 ,  52157013970314588 ,  959198247652866496 ,  760501479741711331 ,  688024418588233403 ,  301564271986301036 ,  2302426217735098451 ,  570674322883171131 ,  164334986408624084 ,  1941712558179885588 ,  1244191616628876823 ,  1134765083256401934 ,  1643612313836144292 ,  511533558971347179 ,  1743249571231344575 ,  2185233324697993958 ,  499462002998147374 ,  2016322652487601518 ,  1152233770071209561 ,  1864721602642838599 ,  940394534891683591 ,  1238790707595417860 ,  2223495313958086510 ,  130788941499945573 ,  1978128030939580014 ,  1082591832184678799 ,  2145432244169503156 ,  265051570981309395 ,  93078615116402691 ,  1500338269344799087 ,  1794466702580528411 ,  1398275458528967635 ,  1946092684098566994 ,  1660299753349582301 ,  1434303052988125412 ,  256883890916629741 ,  1330774340557177289 }, // x^2^564
+
+{ 1259452641990916454 ,  1309934872485736930 ,  2244361985557287163 ,  197577040533428933 ,  554361655831181551 ,  628452638105032510 ,  1071160830794300323 ,  1735679408112740719 ,  480102282267721126 ,  118672494601571633 ,  556014907096015060 ,  2100269150498896467 ,  1860493790828503996 ,  2169470254110169409 ,  2061509043220989073 ,  1990686284543936302 ,  542308942477801741 ,  1154726499346295393 ,  1513396900055532240 ,  621606532573732302 ,  1314004044957238556 ,  398389197260815881 ,  825632289575142212 ,  498939865228929105 ,  2211743099933859615 ,  1510402985000714510 ,  1972214663994001885 ,  719681302169588857 ,  1402335131813547319 ,  1310478440701738265 ,  119328059147571036 ,  903873686834496662 ,  962787917432502195 ,  1667102407079365408 ,  999523142732322610 ,  1908456676207047495 ,  132961737277138521 ,  250531949716003941 ,  1690411202585475073 ,  876083892581202586 ,  921811427311014815 ,  777279152021211244 ,  1041738946816250139 ,  950905402433993907 ,  154298304209900123 ,  1179650206873210069 ,  1253888001592789306 ,  1552221206936042151 ,  146653314398379377 ,  1999702024519656926 ,  1200374301280837922 ,  462591260425849823 ,  47370928060067558 ,  744910739736902750 ,  642588165205140755 ,  844776924619636523 ,  997007475799886271 ,  1319371213201205164 ,  1465295576178214009 ,  2021535586477228358 }, // x^2^565
+
+{ 1385731255030149835 ,  871431926984997921 ,  716585609736060124 ,  468283472912600637 ,  1380087528572623239 ,  819254333231635269 ,  946089418879955220 ,  1039214289701118563 ,  1709191814378803639 ,  709212144404357537 ,  1888034509942100590 ,  2281027388006271489 ,  624084293025611369 ,  352303769346077261 ,  1527219426572163655 ,  360546975415801188 ,  60027139579350767 ,  2195807656559062155 ,  1969074681462089063 ,  734920346045340861 ,  291376867889672033 ,  24211065020368324 ,  1116342125255884362 ,  382749886705363815 ,  838458068964940776 ,  671309130180110475 ,  2214890677510517204 ,  956161230863576124 ,  1289772734815511313 ,  114321364627836614 ,  303523119003763733 ,  1693795371901440277 ,  1485469904218113218 ,  122986509928914905 ,  744726794087648783 ,  1341451586547258306 ,  709710373508447155 ,  716148613378943306 ,  123652968765313856 ,  2068466771994911154 ,  2158090376508170003 ,  1067275538144320147 ,  709599284194007318 ,  243051303720232166 ,  1416286901742898431 ,  2141596813517246461 ,  294578233007834053 ,  380231401748498833 ,  38697295596491952 ,  1264528430858381824 ,  766486282333589525 ,  296355717633088466 ,  827438937044023645 ,  619099094072542713 ,  360129446373512061 ,  518373972371328677 ,  1560614476552405685 ,  142510305572689198 ,  1268125676826998213 ,  1894153610422533492 }, // x^2^566
+
+{ 187149078734442490 ,  1815326505325614850 ,  1525147640725955792 ,  1318709308178055126 ,  1637414104714734607 ,  1011802572162834625 ,  600169529060133598 ,  806593375824057043 ,  2154258219496445413 ,  605842419538258413 ,  134357005387581381 ,  1408586174845079072 ,  2240747979384973678 ,  952431333727219551 ,  1390004372014169411 ,  2124445483020072853 ,  1978498137596951198 ,  1440832262610205962 ,  699227339342436128 ,  247552790522248105 ,  899499081046156053 ,  1926824346852246572 ,  488726757649828474 ,  1948181679020497584 ,  755351528408386644 ,  165579832245215773 ,  539884832321631439 ,  1676121825096107270 ,  1413713554747390867 ,  584134989469214327 ,  677468536348398269 ,  220685770407981852 ,  819141375028217284 ,  1167825887743978247 ,  1218820862937918129 ,  511682373566915348 ,  1370931020373513000 ,  1398547022478965200 ,  764935666291669408 ,  176892339721371636 ,  1875231764751878466 ,  2059107940376133255 ,  1855650863359898667 ,  312946333076698744 ,  744199427749773027 ,  707724980354723143 ,  2286992352474412963 ,  1936322090570573925 ,  2168163110695672438 ,  579068394037229079 ,  1111559062898167368 ,  1832982533962882331 ,  769869421691876911 ,  766871577319102213 ,  996735146280524568 ,  1013359195999958498 ,  148394456368272607 ,  124974047391248764 ,  1796308988072913331 ,  1491539462185834787 }, // x^2^567
+
+{ 1488269117657528170 ,  1670271981578595116 ,  769825812113803504 ,  684400581367793068 ,  797111633922061905 ,  867483476827899840 ,  667418144113629472 ,  1879154776581064565 ,  2000479719229142679 ,  1521114277914761461 ,  1257451808746354803 ,  1130166164940564976 ,  1912673217040869300 ,  1947166153732760804 ,  10449944906629942 ,  712420743753628619 ,  443460797536303291 ,  942297198985297831 ,  1266332783134624859 ,  388938949807635930 ,  1412085988141106080 ,  282471671734757677 ,  1406495945469407041 ,  419196772769663365 ,  2069684115306729146 ,  1704241631178301223 ,  574878368039279620 ,  1266194514441228991 ,  2088480164811432240 ,  1018008288063136804 ,  669118684283104702 ,  2247308270837207047 ,  908006232991424447 ,  2064330791869922717 ,  1197357113482125192 ,  2146379796096074347 ,  499085042027763422 ,  1202254142750562718 ,  1960418812004401390 ,  1232139690334047542 ,  1568346165446395288 ,  839325499284131211 ,  1004984433734346069 ,  54016920474578741 ,  815055463870879442 ,  1088699867985004333 ,  2151522932548010872 ,  1213269292743584652 ,  1326303463589733917 ,  305637672857081466 ,  1014399951289971657 ,  1612500700921369501 ,  457762092920733368 ,  844567233446431123 ,  2123014581443590419 ,  2276762239780002543 ,  619621343886535210 ,  411629556490348335 ,  757584936612066786 ,  1051402169262303638 }, // x^2^568
+
+{ 985056157802700968 ,  1589178698534219558 ,  442664542389652538 ,  1609040098558066938 ,  367667968582153830 ,  940785325829463903 ,  2049234950610257843 ,  1775695178484591446 ,  1239616086500566000 ,  536366031898250719 ,  967823284143740336 ,  1060051009439157203 ,  1458350102975585522 ,  1983171644679907209 ,  189373097025794981 ,  2152628936614480767 ,  1560665830430208996 ,  273005309716847236 ,  2131663580523282713 ,  538830982403783326 ,  809958619301740330 ,  1694163530322151770 ,  775061685233553422 ,  853094226576190856 ,  1050305310325891213 ,  1279642425303334288 ,  322535569374285310 ,  1432616663102306329 ,  70084394530314399 ,  1713330222281141832 ,  2069744141079898653 ,  363577095121770896 ,  1480582498342578478 ,  2203218738379712803 ,  728341610109700222 ,  2206742890751764723 ,  267233943119894442 ,  1533957115598005202 ,  509690448360030325 ,  1078175682719659266 ,  236852556871514361 ,  820113390195248809 ,  2220580467014361343 ,  147973120613710659 ,  1674355961035377791 ,  272132380146372227 ,  1160679636025054094 ,  1752238456676983103 ,  1194590977002544365 ,  4542657672399297 ,  1332651868938694394 ,  190372252585936489 ,  2066733110066608869 ,  2140951940470634943 ,  984848637722965445 ,  1233778969653523550 ,  1592848543197664836 ,  1934225007188756987 ,  2289880323240810250 ,  593721477145368875 }, // x^2^569
+
+{ 2285470927275147224 ,  2167047702959324514 ,  1373993094051970232 ,  1759822422155886629 ,  91318726578547871 ,  648314188423888320 ,  1876952851984536273 ,  504176367498964587 ,  1588287285991431663 ,  2127374622504250745 ,  1614499764226592404 ,  1766888683818459503 ,  1016906725112224691 ,  698905902509624426 ,  870715936833207180 ,  533848517754398419 ,  1129938318023558812 ,  1648777982216842170 ,  2011204378107161047 ,  1603644363623580576 ,  383065316429229651 ,  1485214291359924384 ,  423550702564287697 ,  920038326987109708 ,  1840973408730382458 ,  1725216051103915829 ,  996544776540575480 ,  336215090418078881 ,  2210443417851582209 ,  1586019186504326537 ,  811418610867109361 ,  1989544525128177194 ,  778298174611845686 ,  199531691617421058 ,  1976957490288489969 ,  97210138652115882 ,  785873915064195819 ,  1038125622770867048 ,  2129765551454359497 ,  1224123278739593532 ,  1972229949724922262 ,  2017891167326130933 ,  1794707866844320014 ,  811654585772338061 ,  1756826750779646221 ,  1348653154890260252 ,  1063627689809304903 ,  1706428599128348171 ,  600976252206256875 ,  2223048635490438022 ,  1706972507018707413 ,  1862841409578221388 ,  1828539431384899225 ,  1422260609975497711 ,  2191875236913620264 ,  1805149786454967811 ,  298560734062937338 ,  206101529690701503 ,  47578562593179841 ,  736980073999614407 }, // x^2^570
+
+{ 838919528898431851 ,  255737550991816138 ,  274206007384993654 ,  163041104859467208 ,  2230545048199925348 ,  155811181095197807 ,  1975996844213575356 ,  426030633763637282 ,  1803603528342669387 ,  1563154415341003317 ,  1299990853818338227 ,  817207292526513963 ,  1375136261048193637 ,  1329119093457668711 ,  518412774528839889 ,  1839642030809302616 ,  1098686861687713966 ,  338574821805822780 ,  941147697330142674 ,  2028725501645595395 ,  1794386031210180001 ,  738793356074109039 ,  62684509574134687 ,  177175279711031467 ,  644583643356175697 ,  1026104449953637993 ,  1734455981950133915 ,  483253011970179046 ,  1046003046396124703 ,  1132917423723619934 ,  1995849986456447314 ,  2275746956180854018 ,  1682037372059400574 ,  381192353899072927 ,  1457461514983014848 ,  813828540892908358 ,  773494471933513647 ,  635184253980314532 ,  1666615365351483389 ,  597597288694214621 ,  1668869928363820323 ,  1042253001774206337 ,  2144271684935950132 ,  775180608885978741 ,  2231275082029348070 ,  858551509769059201 ,  1943960410788105699 ,  350328144113564891 ,  257715910196592903 ,  665869644663995446 ,  585169112526765998 ,  668489881731368125 ,  1135740195587350637 ,  494840399946526897 ,  239818618816645107 ,  1146638841559466982 ,  918328585025395675 ,  800523739280042936 ,  392908836113147758 ,  2064961484761305396 }, // x^2^571
+
+{ 2158446560541601399 ,  81192036682277828 ,  516854593023546316 ,  1439174854050537351 ,  2154233148472295770 ,  44153065969126696 ,  591499977784798112 ,  2260186749544509912 ,  682105878069717354 ,  1489285864764362387 ,  239631407674944089 ,  1104299068399761014 ,  1870268216406993173 ,  1169938833566969168 ,  375160975444473266 ,  1817076986088354989 ,  1344626839910407207 ,  2090125740631344347 ,  2230271277996634638 ,  301563939809122246 ,  1456714115539715162 ,  1351870905638191183 ,  434963472693088911 ,  1126302435885954570 ,  737939806969517996 ,  1529045093983507339 ,  2000147791072135194 ,  686125286982652734 ,  1774921616656790044 ,  1453812719415404782 ,  610379936522480014 ,  1029444013388406942 ,  1461633403400324955 ,  2201665591582821416 ,  615460264024736961 ,  311373680684650386 ,  260193296762325823 ,  1218784752178231612 ,  2004880027547012036 ,  1417835182674628014 ,  1679226967065394081 ,  1751326130015150057 ,  663161849995959820 ,  1084812566832670046 ,  1308376017721152700 ,  1066006275908086182 ,  2188907633993331119 ,  2066808244380287179 ,  93490031941137416 ,  667102724793810328 ,  1715941661915651689 ,  1188699518863180810 ,  1420960306082670554 ,  40032968442000961 ,  20194863285896772 ,  1678689865712095094 ,  631111635232269931 ,  1457718463449355948 ,  2000585813646500499 ,  691513462629929985 }, // x^2^572
+
+{ 1967356023762078724 ,  1240041495354097381 ,  1027609562717133556 ,  1555073388182408153 ,  2172522892106525013 ,  2179508508713810256 ,  211836740689694142 ,  1159410428773912763 ,  139014984286321899 ,  1837429058397765096 ,  1744696988143329115 ,  1238777110739895292 ,  1983695815231630433 ,  1369346026009686524 ,  1475898373968290116 ,  890012923541973748 ,  876144137611913742 ,  1900530592554659408 ,  754698448996471961 ,  1962201720334966481 ,  12263085086264360 ,  1219876215792484364 ,  1836524817557831970 ,  1455643014728031891 ,  700708700283372658 ,  777426803957332416 ,  2189928850083424554 ,  1298654349632897617 ,  763496722106591289 ,  598396339722644262 ,  1405193009715014465 ,  1102680938165883956 ,  15377811142971620 ,  240532618652698587 ,  1884017557273689227 ,  1171198175982940968 ,  1221077964469972098 ,  128025475654180251 ,  2011954730973804680 ,  796337640534435540 ,  1292632426236386840 ,  31091969997198000 ,  2116135042006709611 ,  304110534687577555 ,  1750414450424675435 ,  1450039551407856462 ,  610776938832368798 ,  1591010546721634149 ,  1722322332073446378 ,  1079268118688802423 ,  1915788987942482402 ,  1919280809202105369 ,  1951941504063542764 ,  1311542825976294828 ,  1038094089858231007 ,  1122163749595764052 ,  187539234621860734 ,  1929527035006947852 ,  1086103641272059646 ,  478316779243075944 }, // x^2^573
+
+{ 1420431831390301484 ,  1916899758843507876 ,  1974598264342444184 ,  2001935780396499268 ,  85001355206849485 ,  521340835881625401 ,  2164035866905203626 ,  1922214743167086758 ,  630382834754330864 ,  1524114720972790815 ,  1257404642077554832 ,  1068250443614492396 ,  382474674321552110 ,  1878947451262914675 ,  2109818067284302009 ,  1381650514042753846 ,  761269205878269818 ,  2295511354778924846 ,  865904278177853823 ,  1240442322411891973 ,  1025681608488728588 ,  1742407941650173652 ,  261994606811067010 ,  40383982531442300 ,  383761050330220638 ,  808815113792435628 ,  63557443749871343 ,  1788647468581636268 ,  113318096641380392 ,  1375385307816616614 ,  1478353030067905129 ,  1789570923272697578 ,  765282217136405715 ,  2303107799841865828 ,  1861113583223376929 ,  2024094360609340740 ,  141415150057387088 ,  1886227493436365444 ,  1129382932390872662 ,  1986648464070258267 ,  1501012205071518743 ,  2174337666693235862 ,  2159985616220527676 ,  2120966055473699858 ,  794562101194512571 ,  294608898329168588 ,  1036565928222851955 ,  2052060602050761774 ,  116826284555593578 ,  1307686978567585670 ,  185443782930932092 ,  617715270337867065 ,  365747269336369001 ,  932605182311155947 ,  36461419324237344 ,  1497838685303590115 ,  1946171647382875465 ,  244893508186154429 ,  849960949750550986 ,  2045554857290814257 }, // x^2^574
+
+{ 2024389879970552526 ,  1353535008860794948 ,  1845500032519978117 ,  731671211238374773 ,  1732535362229680838 ,  603442200302602531 ,  154145585063933764 ,  1997648003109326297 ,  1777194313950570142 ,  679728627204653679 ,  231951636882360080 ,  980475024285873612 ,  1187022305579195511 ,  891728967843934367 ,  1262870967957569322 ,  1163169677442487895 ,  1846084494404986077 ,  453113153904684890 ,  2001220185181908736 ,  230210010653648233 ,  267492232086581103 ,  2218595722564920819 ,  1733018484018586376 ,  2055297905179526811 ,  2090641393369498105 ,  966006751255275844 ,  1962801617165846716 ,  616692514237722860 ,  406486585981226903 ,  548189106064585308 ,  2253365858185771254 ,  145617954686867769 ,  2107567372367812936 ,  1913248612150345984 ,  142899838382803711 ,  2210504159275645081 ,  1359298939422700297 ,  1905287545483155491 ,  371274600782374344 ,  1336136140695874660 ,  311774893759098354 ,  607765782823964668 ,  793992448093013138 ,  2077279318119440342 ,  1656230743110277213 ,  433502598927498407 ,  979151171521797702 ,  2254132652562375812 ,  1971794276751389161 ,  1800694110645226013 ,  1459995538198544231 ,  160406800008715559 ,  1589440394772557837 ,  317102155349691319 ,  1444039203378269771 ,  1467971931941135773 ,  2059741905558549960 ,  742993231088921240 ,  1721393098233319552 ,  2302672409495960714 }, // x^2^575
+
+{ 119449912489059915 ,  1359455069464794502 ,  235977883817847157 ,  298677122595239075 ,  1135110806020969705 ,  1520305432211902463 ,  213742480722483396 ,  1513091962921045215 ,  846126201773105971 ,  1706239442996223891 ,  317256929607381105 ,  1558543136260623167 ,  1032094119157507217 ,  1814477084853251506 ,  1886193163135914376 ,  2032867781012140406 ,  1765914152075525787 ,  1475894387713638881 ,  1591684997835529583 ,  2167559219864556268 ,  1369832744602791628 ,  962965044894367494 ,  821396054317318482 ,  1769318640667276614 ,  692592061298693491 ,  229614870627740693 ,  2045679961825629200 ,  917483371217491875 ,  718871467975359058 ,  642959937000172122 ,  603389605890131194 ,  800149563745312118 ,  1144922282469186550 ,  978644722069184244 ,  1628251286297115735 ,  1617870290684667560 ,  90000550143271103 ,  1821763906836561003 ,  381458307760012126 ,  2213774048764081403 ,  131695567401415577 ,  161817902279323044 ,  314909732173243218 ,  1246903501541429712 ,  1705639930160165073 ,  1221674557611923856 ,  745131276386318629 ,  1645880870307046779 ,  356109512647937136 ,  1942730753168311323 ,  929727352266721351 ,  2045994542141522701 ,  1583339537378982954 ,  259976029073988707 ,  1269443456290171411 ,  368986463635924530 ,  2060672473903947642 ,  2141680389677927 ,  557485531601495820 ,  1077338411949962298 }, // x^2^576
+
+{ 2272638031422658553 ,  129836629552190421 ,  464892527394296443 ,  1705337961458103183 ,  1979071660302284833 ,  1554776313618586260 ,  1909419889278656458 ,  1386728783794634137 ,  1798032877737165407 ,  1637558484378938937 ,  1054916746550284318 ,  1704477416192937412 ,  2242059767982474923 ,  869910738133312649 ,  417671002258566838 ,  491493776792439745 ,  1623168860995306486 ,  302971637657824549 ,  2108514890568746890 ,  1589046371391050432 ,  416686972305561723 ,  823270767142725857 ,  581503046490953666 ,  606400719397208639 ,  511445000103908569 ,  1825175063292694723 ,  709388185862051085 ,  1932787932968086211 ,  223665406690584431 ,  821459337933276939 ,  1084380648236048584 ,  885463944474363409 ,  874940867636586186 ,  1828813799280113990 ,  1776356081999698948 ,  971952203812230567 ,  1848615355491027217 ,  441674713245961590 ,  1936387615276795862 ,  142598804603099295 ,  1767239278210884011 ,  1927988793230069852 ,  740916700289852450 ,  2158470407115624502 ,  1053459744165550429 ,  1128869307201671155 ,  267430056489488654 ,  95538607862454009 ,  1061521279127446877 ,  864471213503377369 ,  2101905300297715940 ,  325157074586592863 ,  1624164737283735400 ,  719307851357859319 ,  496902220576093984 ,  358842020049403159 ,  186912770701102503 ,  454250854070566129 ,  1663870098949402349 ,  791895274710717881 }, // x^2^577
+
+{ 1920350654407585137 ,  307260220149594159 ,  2073534197734685238 ,  1451482316520758132 ,  754364681222215005 ,  2247701609833323018 ,  1445092017945395481 ,  12519154644104129 ,  239487569880249028 ,  998359745858733534 ,  1409018967936429143 ,  1467926208237384350 ,  2271281226742771696 ,  1885266353050596733 ,  386886886231848441 ,  1344909660629013127 ,  874352184968340465 ,  1243959285176973296 ,  1701287088598638322 ,  1873664086645801446 ,  1926769726951640008 ,  741520619888859242 ,  1674724898558365256 ,  1868911125151931902 ,  1421567919140150225 ,  1670380293743572442 ,  1345053073592807400 ,  1942405431462834512 ,  1893507771737888775 ,  418697621599660722 ,  2247856193130487755 ,  1287084223470476488 ,  395285101566711962 ,  1871664114266789301 ,  1873255630071191677 ,  1081552124872630093 ,  1206955180122292652 ,  1568416581612861173 ,  308857572862337648 ,  503947148931488278 ,  44721361202421768 ,  1839191924876499161 ,  2003333143579306925 ,  865887539405136134 ,  828345863921351140 ,  1420590978036907441 ,  681438089659321404 ,  72607484961786958 ,  1964214096338859128 ,  1546314717498801896 ,  1283528067032290549 ,  406949413782172386 ,  261903806378341316 ,  601356567618096071 ,  584705624690735072 ,  189368160039888384 ,  1341669767225865158 ,  1574148939806017816 ,  1482680953447732743 ,  1638921573559081952 }, // x^2^578
+
+{ 782878750834728829 ,  676515003696067586 ,  171764853661706199 ,  613924757986825235 ,  569575930450998667 ,  1490584120574243144 ,  599720777149342254 ,  617480892852225762 ,  278463749784426095 ,  1132469996402879400 ,  492008620627064729 ,  1691419042544349699 ,  2130819589379097555 ,  1280448305782357414 ,  1548470267832075885 ,  217627085171902268 ,  1935925367073754410 ,  595658992470795505 ,  1592059672674939039 ,  1839803944619060884 ,  1913105311305426986 ,  698072096030102185 ,  1173223539493968183 ,  103202361017378982 ,  1004604338139547378 ,  693298134954758645 ,  1337470426747899262 ,  1198483619303871744 ,  872562422664376244 ,  800071392819525795 ,  988202815469398109 ,  263035024139053200 ,  1181167825467451330 ,  1915600669316993173 ,  1325819089418064249 ,  465055128608322570 ,  789370734901287315 ,  1545057934670433982 ,  116226119951716462 ,  95288005853860380 ,  157533354873868422 ,  25694591919215017 ,  1518094252819586763 ,  1585473710902132372 ,  634322660844206654 ,  543063950142297462 ,  1949700315507365001 ,  2058528698581362833 ,  1454662173201463089 ,  1477561814919685552 ,  1033285200984439190 ,  1580489709862707661 ,  1904128247355881308 ,  1718931733104866291 ,  1862373935320947631 ,  1188117004268629874 ,  2147726927786146867 ,  1063067310922168421 ,  1097533332111237533 ,  1348406091462540870 }, // x^2^579
+
+{ 1776596071486084078 ,  1824727706332688881 ,  901446152009225560 ,  1986937985096257368 ,  895230061125146190 ,  1352697209207651973 ,  1765763008541458023 ,  176353110653868629 ,  1484389837907138512 ,  239239188009376878 ,  1725640294724069547 ,  1821601242026442570 ,  1681029739775781112 ,  997914300802171566 ,  2139670932790193835 ,  130350637419732164 ,  1145103454091123001 ,  268048907896928440 ,  606839137788554369 ,  589330433154823037 ,  1549296050352073075 ,  956454690505077805 ,  139041482979205568 ,  1367567291586524519 ,  1496698235627693713 ,  2229929032270327785 ,  1288532904767311994 ,  1967789759280552884 ,  723897917814532652 ,  845668831591638061 ,  766764160409681995 ,  1594807878787939939 ,  1495162219277374522 ,  748261684740914248 ,  1812417067544380220 ,  1797579718008720205 ,  785234552348428760 ,  838848818361067184 ,  1594702000215724200 ,  1820152974049914119 ,  1016795843690086177 ,  1239020986209345919 ,  2298073061470309060 ,  425314626541998432 ,  231172847597714109 ,  188567857057104796 ,  1097644858301946362 ,  335886386392984342 ,  1812214571116764617 ,  259386338770131834 ,  543688121103028758 ,  1435631514221580088 ,  1716051482747211955 ,  1323027891547667215 ,  846755431455069368 ,  552465991078437563 ,  1997392452795778733 ,  2206111874420926884 ,  930220697555183118 ,  180651111558665630 }, // x^2^580
+
+{ 1472141634005477373 ,  199196420940107560 ,  873641282888809132 ,  730336586539341174 ,  1804148600463240214 ,  2230713947066875005 ,  2270182066426489623 ,  1307678728444540682 ,  1782251754037059931 ,  1268445954457923070 ,  2015230896761440945 ,  253526686260940229 ,  1664099127463735037 ,  1168243803940930001 ,  2133851655116739734 ,  1025224630710254569 ,  1110119004885680079 ,  58760590778138193 ,  2113104327233400039 ,  256265802567383278 ,  314461202011975789 ,  528521316319956884 ,  1424317521863509675 ,  2191987762086949264 ,  1258405626410367546 ,  822873401960316693 ,  1975663650812852174 ,  1544017518909995429 ,  1212125673642698995 ,  997886787039071836 ,  303123486333598670 ,  1626351798902563983 ,  279453197462713822 ,  2249226312966786904 ,  939932036712164555 ,  513370969303647089 ,  1521341212247718921 ,  369000598766042953 ,  17850687632338759 ,  984951522192118581 ,  2048927738756261862 ,  1670339290165962851 ,  1520781254576149263 ,  1538804468049463317 ,  1676884957390718014 ,  685567752081042052 ,  737053525894053501 ,  1096041508046842440 ,  1435771690048317032 ,  1136586729838883307 ,  2138666768055949945 ,  850581418846159590 ,  619106908218087789 ,  1048877782327421083 ,  401505831351302283 ,  1816118706216932858 ,  1076934118526536716 ,  1997972183391958850 ,  750995474056027605 ,  1840623483655282470 }, // x^2^581
+
+{ 1653971816161446858 ,  2214781361823114892 ,  657158241315168372 ,  2024468704938610647 ,  105739847898915403 ,  1410973151905033509 ,  1372202237049209073 ,  1818470514993385029 ,  95327852933987245 ,  2170234973945481021 ,  1565532305577569914 ,  1573885705049846090 ,  826279545389611563 ,  175439963096286213 ,  1091067271169731421 ,  2305785185336471156 ,  1217743085842477308 ,  715979520769925044 ,  424922095602402558 ,  88294709665894111 ,  1659671231230139459 ,  600128203048723417 ,  940620920306189061 ,  1242694815326584365 ,  1797538007882183792 ,  841362488646701078 ,  251296510350440801 ,  2177370854271706531 ,  2081031501059308766 ,  776883824378860808 ,  1625073870337594290 ,  529411851506415060 ,  1301569122649781726 ,  278142762412408915 ,  1190745768367860422 ,  223618688522682301 ,  1032530442515373275 ,  1370901768331546827 ,  1765934919295447568 ,  969647941347023746 ,  1316110353787313474 ,  869482667285873756 ,  929151514054849092 ,  2252592869462838647 ,  204604276703577958 ,  1468569538499100939 ,  1816692793732763282 ,  240345286460731998 ,  1934540783083798574 ,  1297308130250771722 ,  1237823410828409092 ,  461344465061655593 ,  981033063777181288 ,  1250340755556192268 ,  1380173831990185842 ,  30957710853114058 ,  2270097419031678966 ,  1642632254766468869 ,  1430496851332430182 ,  31915478222120066 }, // x^2^582
+
+{ 1461028264040323931 ,  2130134718140393647 ,  1423927426956750847 ,  1523000441946793440 ,  2220424068468262891 ,  675149514937059626 ,  1569726681404040132 ,  373553561058105986 ,  1272957110577482881 ,  1987186620381890787 ,  416173401060190832 ,  1728640495880603480 ,  283603066991661212 ,  2144040039595602171 ,  377710931421458650 ,  2088833188485414702 ,  584989132633760665 ,  123928968891181415 ,  1015321123663572998 ,  2100188298396775945 ,  278716197031240937 ,  1947519704992929814 ,  1193086625792818489 ,  581184668138621281 ,  462000624237476161 ,  1084323483984701284 ,  1964322315086401020 ,  914766176878202188 ,  1712373568494612638 ,  1360124481439941535 ,  128257603656773834 ,  830522184649124884 ,  1458993893528610310 ,  1820407749051008737 ,  467247888123286845 ,  432563659856223018 ,  410599969427687834 ,  2211819334949656386 ,  969482017599364176 ,  465446421304508384 ,  796684717403524523 ,  694829794947495654 ,  56115599603055837 ,  2138737897973678893 ,  1345353555937857035 ,  2299617865056364862 ,  536436205345700935 ,  1563167166867417543 ,  1390508785865483846 ,  315427625378839333 ,  829706845395222063 ,  1157324907153984993 ,  1262238978280700448 ,  930437688071821944 ,  233542868021715208 ,  1576464044915480601 ,  2249604691256316490 ,  2258958103552714293 ,  1965690010479126678 ,  329850825196712822 }, // x^2^583
+
+{ 1291681051085314305 ,  753972113302044873 ,  1238423367352549892 ,  803718814471602417 ,  224975585786962319 ,  1081015084999663699 ,  416208854065800100 ,  1295765052501509099 ,  1864844215683678370 ,  1036657407444606574 ,  147701549298963086 ,  1436738540062309362 ,  1809859855152772828 ,  1074308820392313391 ,  1249682727660457598 ,  923179811660214142 ,  653001136752263068 ,  1597238760216546751 ,  2268817121141404226 ,  428004005136712544 ,  615131829626572707 ,  603574158130486425 ,  1966725790270027776 ,  1745206773441191734 ,  1512434259413500225 ,  457705721382435562 ,  476621836419393341 ,  1727558786257998605 ,  83533454248686576 ,  1427231017834514006 ,  1258924777782693653 ,  361332488681677487 ,  1216160645947477230 ,  2271833931710909571 ,  1739795712125252212 ,  1647618986947395904 ,  2209245745065662694 ,  1828690510769254850 ,  802106574680966470 ,  1692698033542586617 ,  295276929821674619 ,  636424820402188311 ,  861973099184290623 ,  1832389810487791367 ,  59243825734075053 ,  1726922545147479330 ,  2250926212606407400 ,  84711523432650028 ,  2209372151910317763 ,  1234558441211554224 ,  241714864450969270 ,  1727235003264796677 ,  427198865612377111 ,  623266248750000008 ,  693926043941879781 ,  695776843164331974 ,  629195765787198671 ,  977944898574972171 ,  1797931427419160586 ,  850725672763985672 }, // x^2^584
+
+{ 346742363850432404 ,  462414699222481581 ,  963220284136580519 ,  1831313504814358740 ,  27585842003718487 ,  1088304820748356472 ,  1952951689255402219 ,  1053609456113961547 ,  1053427893456109669 ,  998752869714840984 ,  987959441511284277 ,  1455817179586543997 ,  1648009318529246501 ,  1958248695953337697 ,  1114943752895319305 ,  118913927302935505 ,  17617071638315901 ,  2187392329247039086 ,  2141241197556137111 ,  1193517135897333737 ,  445240635966729138 ,  1871752430666522381 ,  950195291625521774 ,  2114681319838836177 ,  96273300100357758 ,  39010296210438519 ,  2192639110199913946 ,  1226485045988756721 ,  1112067608398766305 ,  521876332126226212 ,  552723322447792667 ,  844289176934522085 ,  965921828892604749 ,  702991556567194294 ,  2050575262139046155 ,  129019760004441118 ,  1003467658059765636 ,  413461443662689395 ,  1252321241348282601 ,  1446960709803049696 ,  1964434274844583153 ,  1942640483620685627 ,  1539388131138304010 ,  1896881314412352477 ,  1456094570544686048 ,  631311492257328023 ,  1580239285201820858 ,  1385453282514418886 ,  1635477058357889406 ,  471072432244623321 ,  1352638123974310858 ,  93040286739729050 ,  658802874313481277 ,  290722311605493614 ,  236353418277734008 ,  1359257130156191649 ,  1918540219725613270 ,  1076817720940400226 ,  1165161001691651938 ,  751437822255837314 }, // x^2^585
+
+{ 1413062874351891076 ,  123409109236991874 ,  1789721987964543876 ,  1907773659058574834 ,  2175875354403163113 ,  689459545394136562 ,  1871077405074727551 ,  1591606915278800956 ,  579829143408241208 ,  929615612046998260 ,  905860164944185978 ,  648774554329430741 ,  1371342546082112649 ,  213499073216888365 ,  464256187199293622 ,  1439260613983030646 ,  50989315924892354 ,  1768721994847175488 ,  903020963751690007 ,  1749084732178376613 ,  1776946707959523766 ,  1687908153827822311 ,  1657580287404594788 ,  1394914739309447013 ,  2198729243122810390 ,  734442752063982650 ,  577343769400042343 ,  466652592020937746 ,  818501182376721148 ,  288262573562196404 ,  927599460096093991 ,  1997754957832415444 ,  374740478520692384 ,  2167006925278092129 ,  890255588778549937 ,  207688522446190095 ,  1006219767326296230 ,  480626025665481042 ,  1126031880955074597 ,  341618933972523111 ,  622118906736265701 ,  1762111922093818678 ,  73133387370271356 ,  1859577560934051297 ,  448419567659431181 ,  578397167256811147 ,  639015127359156717 ,  660330473261819798 ,  301689611866767470 ,  1335725994077668231 ,  2033072927594211543 ,  304134062032106537 ,  1424686430148420350 ,  1540286297864393348 ,  887526046239338347 ,  1877477063752729926 ,  266602915382175770 ,  1835840059943204673 ,  2283875930635611160 ,  2161203672236825698 }, // x^2^586
+
+{ 67044970447595887 ,  1266445158400327245 ,  443516130065096455 ,  418891143143534411 ,  1891446866713224178 ,  1898997866053233768 ,  1099073334139352686 ,  1203474062854465317 ,  351437651827600872 ,  1215776696173337196 ,  1916314688788518934 ,  821856100275521902 ,  79122747981465444 ,  456395470513871870 ,  1595784587897195496 ,  1089327071829692046 ,  606784661445709820 ,  27242375895158133 ,  1289163854228683807 ,  447380146101555316 ,  378344966904997273 ,  625732770997065907 ,  1973922050902809702 ,  2016409350890383898 ,  1977144790426307734 ,  624209534683563276 ,  2114157119433794786 ,  1140790212266567519 ,  1864375047041336990 ,  770033772844075282 ,  1561205376341246437 ,  2111053196998922595 ,  1440113941746232784 ,  1172969592548358837 ,  599921940583501745 ,  665459406783727884 ,  2090160845746820916 ,  941098296231940008 ,  186476307559020977 ,  1382229284440053411 ,  1744471086516740290 ,  1345706441615969387 ,  1492606982945750895 ,  1722910171318006618 ,  1404534878857358213 ,  1736814698321100044 ,  188504102172937198 ,  2296165506325436505 ,  1842021166235281816 ,  1504245734338533849 ,  2262337720589733352 ,  1462102536375268773 ,  1227858535362132953 ,  154178943333576581 ,  808766255389062244 ,  2019339826735927436 ,  546593068989946729 ,  1037037442630280788 ,  2186434031472217144 ,  1663242062901383381 }, // x^2^587
+
+{ 1564626051073802847 ,  1099334532150021119 ,  2223079148970222996 ,  1765711476431389917 ,  993717245765255325 ,  678331544776413676 ,  954653607781032237 ,  881878053642889931 ,  1877544939048804032 ,  1827437292050190636 ,  1444006516408153747 ,  250348603480751596 ,  374608281055986920 ,  1423456368676310457 ,  1556549791137641021 ,  2014173738717632084 ,  511380223954656127 ,  368804298615764111 ,  1368471263264028234 ,  863303865435900973 ,  1875716697744637880 ,  1751161412117846335 ,  722036321945552560 ,  955002277388014958 ,  1824870013441256573 ,  587720231762313763 ,  1532033924489668273 ,  994338114591730506 ,  1289498549809232568 ,  94042799126306039 ,  1376550753431224638 ,  1248921855622732925 ,  419493144933760819 ,  1808424934107074083 ,  2202715817563191600 ,  1213489286477740526 ,  180150813367950228 ,  1473115235988485833 ,  574129760319199594 ,  1563158385838265857 ,  88705221431709008 ,  581076691964223607 ,  44854190073998999 ,  1743686445728147358 ,  1581648058007717498 ,  1539220727333886142 ,  1592704062888707656 ,  198062386040942635 ,  405112544077064770 ,  21170514240000941 ,  207849328512046302 ,  428638472359810284 ,  1992911141656529581 ,  611100281671160615 ,  339672944363050467 ,  390776374736290107 ,  1484205978691393452 ,  1626899594640425418 ,  1303385694839709196 ,  1567310818253620712 }, // x^2^588
+
+{ 1213752741909269396 ,  1370166442699385173 ,  1402852752477494823 ,  1838536789560730512 ,  67499323988673084 ,  1517874223256451205 ,  1058679484297483707 ,  471283406347345968 ,  1393429148617815922 ,  1611038377881787760 ,  1358541270288773336 ,  1546573885702357989 ,  2019956510634619199 ,  654884514743877674 ,  2152679255446877460 ,  155045064484940022 ,  443359148848408062 ,  1417750069750749429 ,  1911271045097234572 ,  822220749512713726 ,  1136866932989485244 ,  1799621800232482149 ,  1909343766566145462 ,  2140462060024473172 ,  342631034215439009 ,  1961060296652581758 ,  1677835452429087201 ,  2236707458530828892 ,  1032870746462232735 ,  2109994034133340821 ,  2298771035336132424 ,  205925164721787030 ,  864431406690402257 ,  1994758057038236625 ,  221652782695022163 ,  2289241075898194049 ,  2224428549861293672 ,  373742600100988750 ,  1669703755258365617 ,  168681781087672824 ,  2053129208963824900 ,  1766722828154979798 ,  1547791930023828093 ,  30601973797073801 ,  2140966763482692913 ,  212103462502964004 ,  397120555938409167 ,  696321266086439641 ,  535562927069730712 ,  1169561479538337718 ,  850714974487975213 ,  1597155780547973236 ,  640952861300468465 ,  1573638764400844842 ,  1340305488043848705 ,  1098366695402876783 ,  216583702403927258 ,  1109451309396298798 ,  1881782768690674735 ,  1461484864177612877 }, // x^2^589
+
+{ 851152536858498463 ,  1322158668290843892 ,  277950014720432599 ,  1671108401338083749 ,  1073482932348312644 ,  1696897309286922648 ,  1510307540341006620 ,  2169819932982895095 ,  780841104201241329 ,  821911466719138152 ,  591423824605826729 ,  1829199533394317582 ,  479245762956165359 ,  840515506317137644 ,  1478840456405823718 ,  1246138445135871155 ,  2115725081647719753 ,  1718257076860507948 ,  922536924853284834 ,  1511053142822174994 ,  1581292920156906501 ,  1898589613569589584 ,  115702938986881763 ,  1209554465425474119 ,  889716188918021132 ,  918639996437274464 ,  294174468035522660 ,  661918066095275639 ,  1625521216917306576 ,  7020382022827945 ,  1441129470438554815 ,  2078971007697666298 ,  963525685639695601 ,  1520172236111316993 ,  708336996176623154 ,  127545474655998006 ,  916823109927643192 ,  1709888172614813606 ,  519503236151929663 ,  1596282163278269092 ,  601066837969108736 ,  898185227068514999 ,  2112971829440310592 ,  48677510904012039 ,  1014992477564895245 ,  82337117074938562 ,  158984003461283857 ,  974659471980905301 ,  947687985776541625 ,  1456382050191025390 ,  1169536700763513653 ,  1180734010686780583 ,  1025119410927294223 ,  107946720640577277 ,  315431895960338702 ,  1276355048946717792 ,  158563914506298904 ,  385534949705105204 ,  1811213672045771890 ,  1562292358673219066 }, // x^2^590
+
+{ 1569416397421223297 ,  64725931044813876 ,  325978219611028992 ,  2119192286237517874 ,  1234050568281934000 ,  425457109487986613 ,  1840288279045430856 ,  275284597719186718 ,  884048711794119581 ,  2025539828142492008 ,  761136900241677246 ,  2048126384361382232 ,  1072427118031035083 ,  1164120529362962894 ,  1154327262900449436 ,  732629189351759994 ,  2165291918967974737 ,  584708332865763659 ,  1011345046447632197 ,  940968888984405576 ,  114945481100344878 ,  630296913919908728 ,  1618733436836335863 ,  1118400959172058624 ,  1092347233718448098 ,  1138623080666979763 ,  632266183169114611 ,  1570641186751123637 ,  1997990818194910128 ,  2244752404909769611 ,  2141359163510551046 ,  1437125851161392989 ,  659673786532239198 ,  1294791598949338382 ,  946051284344658463 ,  188329567958120508 ,  595933504954477706 ,  654245927505932375 ,  1125360498354795266 ,  1151396939405319200 ,  1104986070438278533 ,  1030291054248905173 ,  582410122050964748 ,  1958224764211162581 ,  276817938375165683 ,  885927305201693418 ,  1648964823235563717 ,  1964101123600291645 ,  766624163087897238 ,  766093634353353180 ,  495925035729663795 ,  1353747418858429141 ,  1690531341681209384 ,  1145350555705961347 ,  1197614957113713470 ,  670721213783156474 ,  1578476781547635108 ,  2024970907555141930 ,  1612527749813398880 ,  758396956886023635 }, // x^2^591
+
+{ 1152059857347018883 ,  470295268687147684 ,  1523872420588052466 ,  179713205574122336 ,  1850674395544911574 ,  1393505900670967082 ,  474488912854365732 ,  628159064110150014 ,  969566683321527747 ,  991151321783234547 ,  1197837559013458761 ,  1791280713792218875 ,  1829661974861864241 ,  1600521545699592124 ,  1011883533297681151 ,  236226012837982456 ,  1153722561093322666 ,  865633702018858707 ,  1523727409058810075 ,  410369483071383930 ,  1874891942308726807 ,  1891895204196805477 ,  1113459533059601036 ,  1305112991628504470 ,  418611891981927647 ,  285054563723623525 ,  1626979044528649117 ,  1681147690808773568 ,  305465996250685064 ,  1153221652606407035 ,  676314765838755763 ,  289054249310612505 ,  2219327058621249703 ,  956814027909714834 ,  1200794023264771347 ,  2179144652356610584 ,  1072597984041580131 ,  244728482160150169 ,  161106548453564827 ,  1099175990233116483 ,  1667299002609142044 ,  309239613922315031 ,  315464225680499278 ,  1865943347518386712 ,  440138774136749158 ,  635619741908227277 ,  1815947824357285605 ,  2021490150487897030 ,  1494038208156884626 ,  2004693204945326864 ,  868784686751651553 ,  504758422828977328 ,  123544372274872594 ,  1137193608750702748 ,  2184248296584702749 ,  1780757631371369064 ,  1411024066989318636 ,  108868059610389053 ,  319127493084060686 ,  2075398501463797645 }, // x^2^592
+
+{ 1146411614531168582 ,  2113258411227066230 ,  2299764693228043885 ,  1673269473654863630 ,  1218415789917299686 ,  884827485179575224 ,  2116144283734124691 ,  302877498489867631 ,  1660196226612197166 ,  631582827917317901 ,  930349061547172395 ,  884095029496073997 ,  735665520598946164 ,  1204829199473147201 ,  2102094647942447924 ,  174972872936663095 ,  466776334958685576 ,  1321454627139848437 ,  954341985501035023 ,  2055401361829104120 ,  1732527421162365548 ,  1438172425242760800 ,  143216021207164728 ,  1224391556752866862 ,  825291452186418034 ,  2149421148035688053 ,  254431095585190669 ,  1902667326930194103 ,  1984388774769373424 ,  2041197716213307845 ,  1681469462935322909 ,  338308374429933473 ,  1790483611786293870 ,  932987395320911409 ,  2096422378907332886 ,  755803345641586080 ,  106933562589640711 ,  1040174712418714462 ,  2087533510149214378 ,  416684226454093144 ,  1824472859467253809 ,  1384432020190518140 ,  1739758512256929037 ,  1369572931343336501 ,  1708788211932800968 ,  1865395576492220207 ,  2056137638169726392 ,  1510103963599621002 ,  2154015279688547415 ,  1412789544255858249 ,  1683511998159204879 ,  1954986956910757814 ,  1817296270324512320 ,  1078385691299384252 ,  555266958746291013 ,  351563371910158937 ,  2055619914535297835 ,  1118845214642324056 ,  1862524486291182927 ,  1110667631155851231 }, // x^2^593
+
+{ 174101074092793585 ,  1243876171408028259 ,  1222890224717758871 ,  92663431714405081 ,  726440490504579183 ,  591486567288991850 ,  955127460169200217 ,  1905171848416266765 ,  1090708860886391086 ,  851871082610754626 ,  237798732735229420 ,  1788734618496543231 ,  282401765357026583 ,  2147285170689302865 ,  188227002743450035 ,  49709065791516835 ,  2232219977017539286 ,  1994035281872092531 ,  1364225067527727245 ,  2129236534265717277 ,  335862849251325468 ,  759287090892828857 ,  2142230253530191549 ,  2041746517382631525 ,  349763660210770117 ,  1348037630490523010 ,  1943062365178306010 ,  1938358304752245139 ,  1606997273071409925 ,  2159472684571450431 ,  2012167898833964148 ,  878984213180042257 ,  742929374031834979 ,  1031372018796478232 ,  596358483332662747 ,  1880595412174550871 ,  2109165007965621352 ,  118607425840023600 ,  85796586512237789 ,  926003030863851498 ,  703043911735380809 ,  358134177043070207 ,  142757541773227198 ,  2084413532573785679 ,  727805136099357113 ,  590443998078046807 ,  1673701382839243890 ,  1036885983605095443 ,  800945223527609199 ,  952935452968621797 ,  485478806038117345 ,  1791166614792938825 ,  774780307912274226 ,  1604043434249249059 ,  2256072632180715346 ,  1022231103836646626 ,  1289845996757046051 ,  44663649932846249 ,  316806437602062271 ,  762099495486301675 }, // x^2^594
+
+{ 1482150952912735357 ,  777173875809999353 ,  1673290016756941697 ,  2117471655865356852 ,  482458035418865207 ,  462827013223898509 ,  589708543348068088 ,  1176712152944473674 ,  1042708549707346205 ,  1758993466922977028 ,  1434970273676039570 ,  1019773747675190254 ,  2103662251607965873 ,  1191642912064572013 ,  1564866995929644245 ,  495200311889467813 ,  138390034772507956 ,  772351903322393939 ,  533589210316311892 ,  7649402255584047 ,  222616982502720235 ,  514502971717392021 ,  1883273365136196378 ,  1730584491838188001 ,  714884902182038422 ,  1441857710005136306 ,  777578369855875282 ,  1125176145033218476 ,  1162031637986037263 ,  1900766333796026288 ,  1093560371551205317 ,  2178467803304202459 ,  246527010465887426 ,  1568559395307067240 ,  1117926638539126628 ,  776401392109182039 ,  1965717263675857619 ,  1930574668743530221 ,  216683333252254949 ,  1202969095701094502 ,  1253374099361500342 ,  2172160536598207475 ,  2294418824039793135 ,  1155476175427960370 ,  2258245436548260928 ,  750892220228831689 ,  161545201400696694 ,  601702260659929634 ,  698847089264798505 ,  957381920833638239 ,  602485746672336448 ,  512012153958865362 ,  1376068784307554000 ,  579592061098456037 ,  1367253426467257553 ,  1110058185719213909 ,  504740103049618265 ,  997102972257254283 ,  227039923473885998 ,  1306003744729508347 }, // x^2^595
+
+{ 1367187795895459054 ,  368042538838870339 ,  647397842091028052 ,  777145380448685179 ,  1367821803860092984 ,  1800334696607537893 ,  1805509607889447859 ,  587941896752295011 ,  1750700847344994557 ,  2034694029312379140 ,  2099617539616741587 ,  758946465768438575 ,  1044347477854020866 ,  1927976361746380363 ,  1021582207482299000 ,  1325791117696687063 ,  545740996443881750 ,  1475130629539066860 ,  411293895787124845 ,  2010653895683838439 ,  1882828893065596121 ,  1166249819393070971 ,  944204584830614201 ,  1980900504605291767 ,  1303813407237690020 ,  127692036652911616 ,  704710428656343761 ,  612632130924535940 ,  331378875938572820 ,  1402845526950644029 ,  480597138770134711 ,  2204275262678579772 ,  387029559397498351 ,  568226509929931409 ,  1961831947618544576 ,  1731606911474575194 ,  578145682144179312 ,  1587792573939522036 ,  1463230872555159218 ,  1097356257250617063 ,  1740295209493148982 ,  1870326186853740269 ,  1350716884148356867 ,  1274206615254254943 ,  1360906401050396877 ,  795188845333084233 ,  1220026661757424966 ,  193643049670160998 ,  682997056297049585 ,  1784206042249826619 ,  1310774244832584656 ,  465642395203919229 ,  3472516254258269 ,  2170734980266614108 ,  2007809590874474639 ,  678563721850628243 ,  1954277163605375269 ,  1743795249934642850 ,  631281220929090937 ,  102978620697984364 }, // x^2^596
+
+{ 2127048066696292785 ,  953651404349488860 ,  1074698048018315416 ,  923215289988397981 ,  160337621732761854 ,  1358144058110824654 ,  122375917364977 ,  2071418607437844070 ,  1085390661331837651 ,  1653415080994358449 ,  2277720992530884526 ,  1270790044788062651 ,  1169224044682830578 ,  1426099596757160780 ,  1613452416650565715 ,  1841235876637952286 ,  2262150098056619841 ,  406818211011744997 ,  351845326627014391 ,  83452439577511175 ,  2188770280297277381 ,  2063405738651832174 ,  784461985054798832 ,  1178233064109164908 ,  1215611770084064800 ,  2086913379501199970 ,  688583418338986178 ,  1135295911609354609 ,  1170493205079935487 ,  106978968830917755 ,  1678768320067394325 ,  886235295597259501 ,  2066819739269836992 ,  419614652625306014 ,  1970321319145882453 ,  1650513678174851 ,  88434011683483680 ,  315777382698639823 ,  1065687261139891912 ,  1853528823539799875 ,  921706851066335583 ,  959210114350993667 ,  1366893606807584264 ,  295684065419879914 ,  521682781920683875 ,  268835944884521233 ,  626484079338580878 ,  616119946054314514 ,  802754579599894085 ,  655394559437197644 ,  1176073508988416409 ,  1248794328806552486 ,  676546306514576693 ,  885673217314778460 ,  1421126414606003115 ,  2138004735302025618 ,  1409064195430994312 ,  1246620063035226676 ,  125688833571801806 ,  218246352128636635 }, // x^2^597
+
+{ 1168069978496928443 ,  1418043323018919862 ,  1596092214232971282 ,  1381386820823544957 ,  553896987317520605 ,  1313710245128530843 ,  250928972865555569 ,  2030449838941633534 ,  1839398220728183773 ,  224216886848296924 ,  2267125625970702043 ,  2031957156652525204 ,  234100373299108692 ,  270467708707405406 ,  1381196305786805177 ,  1846564496482305832 ,  405880090771758843 ,  2115471360012879205 ,  1475004613818275601 ,  1621565272918278429 ,  831489169356528258 ,  1116815359987127140 ,  1816469690660415969 ,  884576030718804182 ,  908161991488556219 ,  994632616983249390 ,  1005182152546992182 ,  1933091467484643538 ,  644574650958727544 ,  419376163612280020 ,  2204988293387301589 ,  817652870425714746 ,  788745377181394855 ,  2275636694845452455 ,  240725998056451038 ,  1222404173558125401 ,  589279156912544694 ,  1022096297238808688 ,  969925536549757997 ,  510007520149892226 ,  1228073047880624516 ,  1041324759142790623 ,  2143286802087234053 ,  1919874893499368646 ,  1945798429447897466 ,  2222285805359745051 ,  1320492176883854708 ,  1081708184853943352 ,  149267491658442643 ,  103335381314509994 ,  1486620365699596775 ,  68488143109074785 ,  835400102743443985 ,  2095162926389785755 ,  1036413321236407400 ,  1849128215185903123 ,  1358510409508641964 ,  1982337441690893925 ,  1781927152408382872 ,  1445788446333693585 }, // x^2^598
+
+{ 1372508855782196881 ,  1007303580446229334 ,  1574849500088737771 ,  788235595927117217 ,  1831844014479740625 ,  2069857195736802659 ,  1295083998459339326 ,  1096719378628904456 ,  2143814203032108479 ,  1338110081013239344 ,  1872817474590204162 ,  453134222118609000 ,  2037266166545835024 ,  1075302838212430504 ,  1549200111378484589 ,  2100276377294283688 ,  571622322223078680 ,  1721050583687641554 ,  1689632322475896137 ,  447684764392158391 ,  582889353686134191 ,  1265818841951499060 ,  506264166769041409 ,  234224796078442977 ,  660043835350996812 ,  514346674943717087 ,  1906287253425495145 ,  1846288266469144057 ,  2144729691280404394 ,  98545890258713438 ,  2277871277477144758 ,  841926853258386246 ,  167377855585563006 ,  1087279902343426554 ,  939292706883008515 ,  1220545981567173268 ,  456974289714043170 ,  1139985910475353780 ,  12258208757934805 ,  1463518671894846460 ,  1992897475809293412 ,  2006347239380015932 ,  557235655917241185 ,  1213907377230704135 ,  580096193798137017 ,  1985055736210636166 ,  1874539048542593309 ,  575297999190273490 ,  2066915090050610071 ,  461796402995507030 ,  2106688147323109217 ,  177621831179702974 ,  2278452923392792839 ,  1593155148506559764 ,  1884646757161171438 ,  1161056586536174777 ,  795256739026544024 ,  942350706528731677 ,  302259547622479930 ,  2091088117450925265 }, // x^2^599
+
+{ 1142043114588075180 ,  1449602095420944275 ,  419871962968421783 ,  309268968249069785 ,  497254199261262680 ,  991294134754186880 ,  1952145702081817270 ,  746965105578429054 ,  814728396709974757 ,  325925358579263206 ,  349229460355723640 ,  1145033113244410727 ,  665473463190595704 ,  1068681133566894390 ,  172499729192093337 ,  770904870607950779 ,  108441593368845218 ,  1338384470961778136 ,  1285849110521248204 ,  600300412273059322 ,  456068195436606113 ,  994362899890527911 ,  130558823208243711 ,  702719444513364361 ,  242349477150182561 ,  2086143126819653478 ,  533525934552016872 ,  2117491612755262937 ,  793326616405572863 ,  352058865363423961 ,  59760802204462985 ,  1224818710581680076 ,  737814133705612285 ,  1737624840182482458 ,  1185230745199025434 ,  547766111450230728 ,  1252323650877193480 ,  78723615085468620 ,  586501129641892492 ,  606148763121505834 ,  928435999485252836 ,  1188487214200913166 ,  560751552466761171 ,  170419254470104126 ,  629602976059315338 ,  1402258954933170780 ,  947877124541923499 ,  824822020526296903 ,  2241475229702531915 ,  766942185558817487 ,  7390305046294500 ,  864558367957050743 ,  2189138922528316653 ,  976634133681239259 ,  1248406214017427461 ,  109142956320575828 ,  783563443422648935 ,  1399997521243359213 ,  33319718056841407 ,  1598159179178381785 }, // x^2^600
+
+{ 758248955412862371 ,  1331875149882383592 ,  127654786134636012 ,  574674257669053815 ,  1871396769291981198 ,  1114683162003220628 ,  164465589882236185 ,  1671819299102236958 ,  2231638055129242425 ,  91155582132486032 ,  904747787763596876 ,  1057964734656919930 ,  1431472607667465614 ,  829709400210585470 ,  1515655817355512513 ,  1943044141182121640 ,  223901731127419653 ,  2015285335344717745 ,  868017590858902195 ,  1914251037641487239 ,  162634524254613680 ,  239092740311905133 ,  1620608867603973157 ,  2166392068247181729 ,  1335002636657357984 ,  2290107686301009820 ,  679719590188748072 ,  1050130248089463949 ,  772578644980361161 ,  1125095086314133409 ,  936235954929942264 ,  846166622301018537 ,  493662427904236268 ,  2264912289708515541 ,  1613529743023660871 ,  1686592098095961610 ,  837639177396953426 ,  1608753346373881700 ,  92021434665800448 ,  95096802834148690 ,  1956443591653935168 ,  1603917836861442241 ,  1824301760086266291 ,  1224569744020180219 ,  1456384346469900977 ,  456262096971182857 ,  140624502200580014 ,  1339869903879204359 ,  1870829216934772829 ,  1533685071117639154 ,  2057627932669503666 ,  358339837239838558 ,  499561041270856043 ,  1610682071127495218 ,  949304098768110667 ,  607404993438404060 ,  463419466040058842 ,  300292923235593980 ,  942612435316562313 ,  488572356682258334 }, // x^2^601
+
+{ 413856505842420481 ,  189659201130582905 ,  1485540570367643398 ,  1593072427600074263 ,  51919825787933114 ,  473910736405699864 ,  502500478000222082 ,  715559368378622570 ,  1804901094962379114 ,  1505732429091465850 ,  2023519198691250043 ,  2182120745631038218 ,  1869555927681113994 ,  1136519100377956789 ,  1111418334951884823 ,  2152852797623597784 ,  765240787889176172 ,  1827124168991081176 ,  1489359492619064952 ,  490171509119185043 ,  1197408642074249271 ,  1191137563557028599 ,  826684777349531940 ,  942347559858128757 ,  1035557243391391689 ,  1647841015791205389 ,  1811565772727319954 ,  2155144679403499351 ,  1478555915394523008 ,  2005183849526787368 ,  1710409633729518891 ,  2046102468692338499 ,  279059130646051397 ,  487466447127249336 ,  1034303129701819302 ,  1295929475412185496 ,  2066585691171782602 ,  562994494187738304 ,  1896201429416412693 ,  2211541382956917696 ,  978147302812926840 ,  1789989139524039438 ,  58846673836299161 ,  188157520745739921 ,  630867557519135204 ,  509037926025505664 ,  2108492428647114750 ,  1610843060587335806 ,  1702831264162650595 ,  1510798143141655572 ,  1257631347004624679 ,  1405548946432052350 ,  1614950268986936402 ,  2147244172993742362 ,  764471629320358832 ,  1203735589053455445 ,  324119098898859301 ,  684607047872827668 ,  1509800931020540704 ,  1703771255507188965 }, // x^2^602
+
+{ 2095364601918293978 ,  1277545038126663754 ,  208552060613440879 ,  517362148481560271 ,  937667447473303093 ,  537312932063417732 ,  1900780845117943958 ,  1354985732994430037 ,  1864675650700538709 ,  516660943395754227 ,  1738555630007370095 ,  1733789171792636317 ,  421375704600253210 ,  1720528003802114674 ,  1194148267756194956 ,  1799636305648247835 ,  1052209906442639284 ,  2129889872079542541 ,  763837587965725473 ,  1769626437036506518 ,  1682989972653492946 ,  870924222979086830 ,  2151960258901316067 ,  301767186042538984 ,  1946695489338087961 ,  1326950201730426194 ,  347072408353684909 ,  310704396247476020 ,  2130956324241026605 ,  1261834864613926108 ,  277077118634307869 ,  1331281817389134725 ,  2057939166780853960 ,  780860980181021133 ,  1418822501206709197 ,  808109912106301455 ,  1754751731890351062 ,  994143044247506724 ,  259027776781895987 ,  1101317299675575905 ,  692695741827849369 ,  2246188383858936934 ,  228789520212291536 ,  432900417857195123 ,  1748876366950699512 ,  640696015384478456 ,  1679896265569744466 ,  2132279540898466423 ,  947611720387291324 ,  1983452898189902519 ,  1896325091918509821 ,  311270364122997674 ,  612542688646301835 ,  2216524264245784846 ,  1374369822315519980 ,  916938647737523697 ,  923074904215168356 ,  1575231923019165783 ,  1864297634708190755 ,  703887133506694083 }, // x^2^603
+
+{ 1300629818096323666 ,  1399810431071546986 ,  2249789187124507687 ,  250818366841300170 ,  1382065311915447195 ,  1129483335533617314 ,  1488576770931624722 ,  634104501054223089 ,  1784264105595480180 ,  1375810530016669903 ,  1965528094782241736 ,  1096389576965407448 ,  1903186662870569327 ,  1740852045381199516 ,  635657061942809794 ,  2184635325685711435 ,  1919823117247624451 ,  194230237208049981 ,  167489379831817315 ,  1033052032505840212 ,  757976744518783589 ,  966886703904159188 ,  1528227624875273799 ,  527372151887888475 ,  534339986103585270 ,  715352568583760538 ,  301597129647160740 ,  2219065562677826624 ,  1677193220922781855 ,  178028066726748097 ,  401245402887541490 ,  380698753157183510 ,  442346914026154012 ,  454902600883567127 ,  1379032726601592700 ,  363411447192797401 ,  486522068858015616 ,  1476316613118270237 ,  253922341475212782 ,  1090302775867911535 ,  421600837587200057 ,  717979357833615807 ,  1401604988169859067 ,  417158042114339438 ,  672510007867583721 ,  1981511601036176218 ,  1925919173388051550 ,  164228733194458289 ,  864680250596126065 ,  1521170702108325784 ,  1913693546173149536 ,  2199935293256554327 ,  424325228128926751 ,  222162226328508231 ,  1277692033199818342 ,  881088958093480540 ,  1625018784416351573 ,  1997059741094099803 ,  2241662622464006083 ,  1248245711550271726 }, // x^2^604
+
+{ 2263309717443027944 ,  1610988368340588106 ,  1758128231297280027 ,  315949653653310415 ,  2184995719282583668 ,  1098464039048164755 ,  65195797109368350 ,  483369130270150197 ,  30274352867954310 ,  1507852812383580794 ,  136197512268781987 ,  189774569964649453 ,  800288652539026618 ,  857006690628607365 ,  1431389010960136635 ,  324656212876932403 ,  978369084646229001 ,  554812839403499206 ,  1136034219528858530 ,  2297918453941765097 ,  1496100125530854522 ,  1425949528827889187 ,  1330359858204913592 ,  1667262521021858314 ,  13813620254057284 ,  266334390926218442 ,  1130880094012883674 ,  204005621156762082 ,  938979619897783402 ,  1212950679575620902 ,  1057189940077376264 ,  1359906192611958144 ,  976815062821492648 ,  599250140921994384 ,  2016196752047050518 ,  867655965509975434 ,  1906947401807710043 ,  12710415870994028 ,  2126889187433343139 ,  652832175931754661 ,  2016461147529647476 ,  1186783123123498890 ,  925278490001471322 ,  1021060246795661862 ,  1721388654634121711 ,  1335798082726280328 ,  367221198066716478 ,  1155678067889201352 ,  589816942408330140 ,  1790502166646370857 ,  422722380918358267 ,  510791056634949066 ,  275788966986160944 ,  1761834219646095637 ,  548027411247797821 ,  860837036517022855 ,  1036990406228526572 ,  23506711297941070 ,  12300472299382030 ,  1661089082571160772 }, // x^2^605
+
+{ 86321543401848250 ,  509738059955159652 ,  100537486615294890 ,  1086570566766405145 ,  1505322475252804134 ,  2082639701967307383 ,  1230035862517185847 ,  771438275871627529 ,  1474088266880430961 ,  339915280007538774 ,  2177967082369249956 ,  168365475936571235 ,  2016040168944227341 ,  1310963024903702847 ,  2255838867436421110 ,  1977061967098020552 ,  153212883566216545 ,  1159000329060324180 ,  2105374116451990103 ,  1509093849326463161 ,  303333938247217693 ,  1044693388248732798 ,  745112412967973641 ,  1051133001053400626 ,  23309875868381956 ,  1362338712251083764 ,  1575691245712304470 ,  1485893576047543331 ,  506262604303784791 ,  1164396387935476284 ,  1015863453540729007 ,  403865063850346948 ,  1440961943246366746 ,  1935995585734832121 ,  442562693577860185 ,  1004760621026784283 ,  1392082239196918122 ,  1146348165367467509 ,  1835705029184011125 ,  155946303462997664 ,  2238546983242071504 ,  1139068165017897220 ,  1086350854849567431 ,  146577296933432999 ,  1701468507244952772 ,  2057104012480499214 ,  1990604339797898539 ,  492712301952569332 ,  1117030350335160099 ,  527607786146514488 ,  1904884840490557586 ,  239442007615332885 ,  366778619357561872 ,  1115078078200522746 ,  1035788640381422143 ,  1629103688771440831 ,  1199115719304961414 ,  1479257162985213452 ,  1755892425161257490 ,  832011232739378037 }, // x^2^606
+
+{ 1136528610629017997 ,  1198845547295170750 ,  2129310449763621463 ,  998848530587965438 ,  936297311370039447 ,  638770795740376835 ,  2017040873723662085 ,  1089822577472643905 ,  879179618326352271 ,  1504751085750379702 ,  2020022190353152795 ,  1951207642639690222 ,  2298743264965168058 ,  769664114095188944 ,  857420366703417093 ,  1006462847762348554 ,  1665389504974108608 ,  2219652876278597335 ,  860545422722126121 ,  761552163948622118 ,  777647413653830429 ,  1420290735428674213 ,  589996236494465661 ,  1367695691027893855 ,  598898377976188594 ,  1847400434210472409 ,  1624637907534046727 ,  1680160120975690570 ,  2257434907095002060 ,  92201381790051308 ,  1541649198470148998 ,  2114524037437091166 ,  621975845858275031 ,  226501427536682480 ,  1340906210522243412 ,  229763717010315968 ,  1480451225192415752 ,  1406673137761826118 ,  1717304481611917476 ,  2170550537792524696 ,  1973343930512791521 ,  1282532817999118645 ,  1884795406526299482 ,  1056613859504533396 ,  58727177273388162 ,  1597194054637779237 ,  1094405119465128891 ,  244358785466072286 ,  1806593712438047372 ,  1427715527065677008 ,  228560803040530734 ,  1851577895815020095 ,  203716413505397325 ,  953384161869513843 ,  1806733211292790210 ,  1484303052899253958 ,  380830264284574849 ,  522672567743793971 ,  1068085272970991874 ,  803779143444764802 }, // x^2^607
+
+{ 1943880638443500114 ,  28886459922600955 ,  637453676738872724 ,  2036416340744170099 ,  1153029075905883403 ,  879858084730003312 ,  1507795115584119570 ,  195997499838856918 ,  1051204787607890994 ,  1361995397778838724 ,  1169330247007649226 ,  636347048380818035 ,  2170246737714582116 ,  2143276668496425827 ,  1176352624773754893 ,  2127753395942227548 ,  1462192827032855341 ,  573467038910467967 ,  1319924900693211635 ,  1713802606608731242 ,  449676883372192022 ,  422346107261665366 ,  1233547949198699139 ,  1464560350183400438 ,  462871216624029903 ,  1203503070584767212 ,  1677786565233905572 ,  459109821540404056 ,  11995810771031111 ,  483501907069566520 ,  1493334019271691301 ,  1808130359199364223 ,  617021604661398174 ,  1993068945457883240 ,  2212723315477942173 ,  233084719054648056 ,  1301093081794285810 ,  1219928193852810202 ,  493080803210815519 ,  1432663868872908052 ,  1209970956673359460 ,  709192290713392846 ,  1867224004022123166 ,  953128054958819648 ,  911326859904117605 ,  1276559197514217853 ,  1559629280690589471 ,  1293224238743629990 ,  841092480936402144 ,  516418487658274935 ,  68636757311011972 ,  2179739553885318252 ,  1409783523382604324 ,  2038417759523562891 ,  1093082796194130389 ,  475539708044782688 ,  175501846861064504 ,  672698684067315622 ,  497745454247492883 ,  249892900246084039 }, // x^2^608
+
+{ 1348073700862097719 ,  2106596377051251247 ,  714697341678431854 ,  2282597938172300459 ,  2144421715314851114 ,  1379606899028230196 ,  1643507550748064277 ,  1673429572180040157 ,  1132293666666094693 ,  160729379031305489 ,  121771575229507908 ,  155717677307164663 ,  2034639315376477723 ,  191670616369466814 ,  1747812610382582753 ,  245831855611058146 ,  1869533496347233926 ,  1355903443785956660 ,  401243153487864151 ,  1465915165188457537 ,  159914847719578921 ,  2221861244996735065 ,  137080906978259523 ,  1862382715402939657 ,  1839802032603911627 ,  693801671008219792 ,  362672323981939588 ,  1115884516138688555 ,  329806264688060728 ,  227821779867349749 ,  1677261142383130957 ,  828603876460613 ,  85866726977865841 ,  1603217380906274610 ,  112447611113463987 ,  807953687978259312 ,  1766189278167950448 ,  1447336445548638577 ,  1781565180071349629 ,  2033603112908171535 ,  483610392027564533 ,  2004696531126795223 ,  1948843980701181534 ,  2167927740614890309 ,  2181139840900215068 ,  1397929942307996296 ,  1484966671918869924 ,  1232602079951312313 ,  342964377325622084 ,  2073394426121610275 ,  754815842511574807 ,  1491244728901232735 ,  1034276860101446749 ,  486909279398122120 ,  1800331872956873350 ,  2231126784335967534 ,  266658952472352093 ,  336437291866530270 ,  1693155250678637475 ,  389224542096643307 }, // x^2^609
+
+{ 9042981129359558 ,  2194066207061788565 ,  954124657580355157 ,  235777663087358438 ,  1944375331700803796 ,  503522879028976936 ,  1439037412721756975 ,  267015536397031126 ,  1620593746918479561 ,  954954992436685758 ,  758648142425941474 ,  676470974514775885 ,  1352960664405657677 ,  123985534504769780 ,  1888037366534216960 ,  8030386279129389 ,  638206960388035137 ,  92542453320091615 ,  732865861789953719 ,  1177976573471511989 ,  1011109279832284470 ,  1449953034838992416 ,  627616242780538126 ,  799987791933522568 ,  497815583411436996 ,  1844434477840429620 ,  1833701073904409107 ,  816607066288603607 ,  1359729152117515514 ,  533853874636334138 ,  1697817700394956005 ,  1977209979760123230 ,  1366745062207165711 ,  806949453267649754 ,  364527687748567786 ,  749562964995259189 ,  1946823291794999323 ,  2000980412907534199 ,  581916728011060265 ,  235882292354765800 ,  2247686940976229771 ,  1551612255904391139 ,  474061164200738741 ,  2028320616536885586 ,  471761140011856778 ,  454557739893717505 ,  271904336397897219 ,  1786136723474049145 ,  616975819369070485 ,  1629536569795632523 ,  1389892985929498422 ,  324005824514450283 ,  730408205704078565 ,  627883806720644090 ,  1110416775803057857 ,  139908255745665333 ,  1555439135770212681 ,  165108524063141996 ,  2028872060122343424 ,  2194055542946854412 }, // x^2^610
+
+{ 2131148212571746578 ,  618936514705239737 ,  174199705039538385 ,  693743966733178759 ,  29319706037615221 ,  369602126509099814 ,  1703366228583032912 ,  1104834532973490523 ,  1954990595542654605 ,  1179648474511735870 ,  78662353189287159 ,  1464336037385252805 ,  1100153704227069648 ,  548675865042321178 ,  2033934076872760291 ,  1235814328754664556 ,  1827545181119170010 ,  1890583577294328799 ,  1758234185782850037 ,  166299089745765556 ,  183988894003378517 ,  686420517785299736 ,  983162102024001087 ,  1948502522075902261 ,  1181094495323739644 ,  612436884774358852 ,  2197689050777379792 ,  1435333963927094130 ,  680138191957222868 ,  1668197312124059942 ,  1401195167156731678 ,  2157476405962007933 ,  1990200378047389849 ,  1789404185437360410 ,  2249426811105654814 ,  1580715165253907391 ,  1396500562572441998 ,  1010467781799733342 ,  8166066026944294 ,  968827016401693964 ,  2011548370137137017 ,  2027046130099310784 ,  57994548326516577 ,  242578382131158123 ,  1605627594026215222 ,  209175086267127358 ,  233903220361522658 ,  2139477611293701805 ,  1766320745729933310 ,  1670683469239026437 ,  948038397036106883 ,  1271546723105128710 ,  119024902678628802 ,  1196583917134891745 ,  1317199345630510687 ,  1769494839674058585 ,  442822382819560090 ,  1541945711122745516 ,  222473145685362943 ,  2032436384302227144 }, // x^2^611
+
+{ 1766112793008499975 ,  2103934178272712839 ,  185520132951683883 ,  2252256731589699419 ,  401971898547621935 ,  343242849879399045 ,  155081617675587205 ,  1727879422474098901 ,  1541755100776012091 ,  2201160902566092242 ,  253846882573987344 ,  364045414402429297 ,  1744282473514406821 ,  1826449914474656545 ,  101786913151203549 ,  1610095434729610489 ,  2248495097760757204 ,  292103985150308129 ,  355465828822668774 ,  636244109314856164 ,  1847070510082408050 ,  1106926646890463117 ,  2295429623140168253 ,  1784903092132971843 ,  828020664285054431 ,  1893957938422624707 ,  2051667968951581750 ,  548810751964841061 ,  1422407370211569921 ,  1806680722219762729 ,  1829971053831248609 ,  1678181477411079469 ,  393918004732421220 ,  643598009549325968 ,  961852881546212597 ,  1395155633168164143 ,  324312432233381956 ,  637118582777175769 ,  1664008054121551637 ,  389733314290259578 ,  1489333969638319347 ,  1304893290812679031 ,  1688388359043272414 ,  231138045846507116 ,  433588748393783269 ,  1228188213943873918 ,  935309238923912788 ,  1691726881653273282 ,  391206276301283061 ,  850990982725782630 ,  973674845625957128 ,  1703464163896244858 ,  2058855724199833952 ,  120203124208623443 ,  1570331274570127577 ,  37241469624709830 ,  1361291341343362813 ,  2170934718293916236 ,  1029649930505101813 ,  1137145398950493296 }, // x^2^612
+
+{ 2269245478985042111 ,  1133856552619228996 ,  938676054547321734 ,  348455224024484641 ,  1535386951216006899 ,  1845486386025419990 ,  1836927251846916352 ,  856101613144542529 ,  826341626079817715 ,  1157297214115831442 ,  2109137373024487024 ,  15493499999558398 ,  424172178014978213 ,  1483350875207208690 ,  882810574547057886 ,  1292165203769327041 ,  1964201845537150377 ,  440636666351868564 ,  1184122920671628997 ,  1097295395658055138 ,  720177297300028198 ,  104767912638800697 ,  765364833823696647 ,  1115575782221470438 ,  782637816335656630 ,  172670727045123250 ,  641156740791442941 ,  144666400946779884 ,  923836849206816758 ,  2173193376932681998 ,  1420432821639556072 ,  1428311221412831996 ,  1645975265037035725 ,  1948706801458186672 ,  1510059055932142168 ,  1328576689059146434 ,  1605898017208997099 ,  2000745921821470552 ,  1678931323124935060 ,  191686362364057504 ,  1129720569578082246 ,  1265323106793470719 ,  1411844766084040933 ,  2118017769294667084 ,  1901875214209228273 ,  960948605195605233 ,  52434879698143760 ,  2248143390963151915 ,  1368259082177956732 ,  1561121363589063658 ,  113723691225097186 ,  1248331894109132165 ,  748175777126236449 ,  1647133115779553676 ,  1962055921315288263 ,  1499996486398005105 ,  894756034321724890 ,  1311556871389073624 ,  80326476439965885 ,  1976233277541787346 }, // x^2^613
+
+{ 2087385573444809763 ,  852688236411386534 ,  742656554580942033 ,  329570053016094636 ,  1182508664142590741 ,  1979264899432685086 ,  940880804744287908 ,  618911486298814040 ,  1512585958333099143 ,  1880355111244670535 ,  2083569714360308357 ,  512961126905760481 ,  679371804872854712 ,  732967544415716026 ,  69027263423866013 ,  963208898024453834 ,  1831484334200661960 ,  2085768590900566217 ,  1504465746591255732 ,  668347712909156481 ,  1285609556620159458 ,  1988332551791477929 ,  2285262331123265297 ,  1960326673093604914 ,  494767949820423021 ,  2016368846049493186 ,  856255948578192670 ,  2078727831674650758 ,  242847727845668485 ,  243620103938546381 ,  936798631973053 ,  1629175137977079413 ,  1041360945951384189 ,  1792994417502876152 ,  1236340309763042118 ,  1223796157521128132 ,  1127214900104683677 ,  361342362840437125 ,  586338942628728150 ,  1682696734625414167 ,  253892914064485397 ,  315105402918752552 ,  220811996294482618 ,  2201271664835632967 ,  714441270279913459 ,  2024124559053891706 ,  2216685917496334621 ,  526529465854312644 ,  208823694894349035 ,  1803789738291351795 ,  50213819692478486 ,  207361531448735738 ,  1914883965802673343 ,  966380223961554995 ,  414111955753016317 ,  2241705759207689200 ,  844413913892470838 ,  180197839996113575 ,  152679281152261925 ,  2255337892302830749 }, // x^2^614
+
+{ 1190481077363375942 ,  911187402904448331 ,  123567738133773406 ,  1236277450403894482 ,  1937297111743268452 ,  1704957167698596457 ,  1885235339927478022 ,  1177893367557861634 ,  853797726052641934 ,  715715740900595774 ,  1928410610432401976 ,  576033255548907153 ,  14585174592921388 ,  214373217355699425 ,  243513711686469743 ,  1874372294701249431 ,  2137722879369576314 ,  1915337432437823209 ,  919897978014103354 ,  283056605103802437 ,  2039606437752443340 ,  623629873488502054 ,  1611614386068070169 ,  43448415688808324 ,  223295444380003545 ,  51546768832140924 ,  434401127490315570 ,  1194035659676926319 ,  498702078991683665 ,  347789522424096578 ,  1164540071945574359 ,  118113573647785983 ,  2062208761060542398 ,  960153374736118521 ,  1412000445627332490 ,  2067177331029538039 ,  428711799583698095 ,  687071349462486815 ,  645035603133919226 ,  1349040067739895000 ,  2096279046021365738 ,  552201330964603704 ,  412128682072816380 ,  879596991740924515 ,  1466897340731060387 ,  758772395163012093 ,  2142913066698357021 ,  1315539083688960073 ,  59248658590330582 ,  1205007147508363088 ,  972081713034480111 ,  1776570792750033383 ,  1930619719180330819 ,  1739144268517024435 ,  1031704024199744060 ,  2005427780017767367 ,  1440969742855150734 ,  1965156251036848459 ,  1410563388408748850 ,  1711055893362991374 }, // x^2^615
+
+{ 2170439383893244783 ,  786880019637112794 ,  2241068733275384759 ,  1664024885848858357 ,  675475344882990923 ,  2300362219537628534 ,  1533519804478982334 ,  1440660693882062181 ,  196434807156016937 ,  667373893085591480 ,  1194997125935714206 ,  2266201787496165870 ,  1007957800545725282 ,  1573297560396302866 ,  1502038820731059854 ,  1085636633702946853 ,  1518988354611661123 ,  875645436674595075 ,  1837344008112002030 ,  1392596247456557564 ,  508269850988701192 ,  2204545390579756997 ,  486157740068112653 ,  1522037316927782345 ,  587037013193438571 ,  1318958546835051563 ,  350190514115714987 ,  1793854518589645605 ,  1679906785174469793 ,  1178901141049767060 ,  955962156037080149 ,  434889171218942601 ,  252761050255474402 ,  2166117873311254221 ,  1579041319189170867 ,  1257881295045924451 ,  946816923358343580 ,  441877641553687757 ,  454539806571297961 ,  443669044810294639 ,  2209653792595530589 ,  1528036494106928369 ,  837466654424178038 ,  368305040188395145 ,  73987849342247875 ,  1097051072194267576 ,  84649389585115854 ,  18830911448921251 ,  2228021913073152677 ,  1826838487382423031 ,  1361721450887756045 ,  1380320255856781534 ,  1754942895702903326 ,  198837695940070401 ,  487408457814661515 ,  117667829733839633 ,  1564915040355801055 ,  1158793939251952196 ,  1244595527778903068 ,  2286304765801512752 }, // x^2^616
+
+{ 1234409292164299563 ,  1220179443647973182 ,  1814758664130378145 ,  1260255913323447230 ,  1648229119713633781 ,  1496273958785486724 ,  1518012318649414731 ,  588543629151561874 ,  1980758360871245425 ,  1109677436870024635 ,  295300694902371363 ,  492491504623882978 ,  2252907742333464080 ,  2302958286183815912 ,  247442199197233973 ,  1048211480301665146 ,  1447035709629564222 ,  510677321235602064 ,  461909757131634399 ,  660684097526165397 ,  762576518726803452 ,  1956818881332764643 ,  1589331012346716212 ,  481094385937223350 ,  704010586741433824 ,  663163138296283172 ,  1792449202603503343 ,  1980065304965522391 ,  1265560655216257296 ,  120946428236925482 ,  1425978451689012038 ,  214023748441786460 ,  1276654803160347772 ,  202095403001384943 ,  239903393030904959 ,  25924191652479269 ,  297802157637935635 ,  2209022965537692270 ,  43800729572018191 ,  1685694825389227638 ,  1439406451710106472 ,  539578809344371104 ,  1469413660792950431 ,  1450012275835833328 ,  330016297343116681 ,  69027955800616647 ,  1870989039746821425 ,  206385522797868355 ,  469442147236410069 ,  791074329415889643 ,  1287559434000219180 ,  187711339346836531 ,  1023781210947210920 ,  1032618481513070665 ,  58095816132163079 ,  1026213848613383059 ,  1135074624224976944 ,  1053695058594526041 ,  1847417483712690325 ,  2157541622270306099 }, // x^2^617
+
+{ 311585305572275529 ,  555253588823254531 ,  1779644121821888806 ,  885990814500622669 ,  1709516013143250954 ,  781897479501626876 ,  424732459410275222 ,  957325829372230331 ,  889000272766800451 ,  401826995780195872 ,  1143867726496146578 ,  406677938697371019 ,  654040486916056016 ,  1603582834300142676 ,  1695735534512212121 ,  978621025414970428 ,  617999188077225767 ,  1565955011604309112 ,  2284693232816642733 ,  1595021042482114175 ,  1255110723479306187 ,  2058978386881178119 ,  1533831868773711657 ,  506944946199630913 ,  1261091839167215475 ,  516365303143604877 ,  1235231084124342221 ,  593097497282987662 ,  1288261488072783198 ,  97552205977216058 ,  1666861330075931648 ,  994760641149138909 ,  511004606220723713 ,  1910717919662326626 ,  1972067050094944473 ,  2043520917284397441 ,  1712692136887195754 ,  156312828394865219 ,  2291347434332594008 ,  1574138227353848011 ,  1923078870519516002 ,  2165062001150149773 ,  531540495589718962 ,  1693644061668730253 ,  223658355177571982 ,  28953540685329266 ,  1179088155209030127 ,  1298947905081020560 ,  1033570667519156343 ,  304073542113021404 ,  156435926175543167 ,  1188293411094790002 ,  2262693538073031085 ,  270052718057510789 ,  1895510075931096422 ,  1865361235472247160 ,  502234880331644322 ,  840434874839456651 ,  1114204481788894524 ,  1534321063254992894 }, // x^2^618
+
+{ 1839216925026700346 ,  1154437705640353569 ,  906403795964478164 ,  784053130555043881 ,  1882972263945973585 ,  407477974336887504 ,  1337291833511353150 ,  1130501611490256395 ,  1411119010105855049 ,  1929875103262182180 ,  2204698823545240974 ,  1806153854775384345 ,  1856535468244602284 ,  1379050153361090027 ,  1598196152932092053 ,  59145849489275534 ,  597132519893359475 ,  1116787004858393323 ,  381648423453744384 ,  643671494361043722 ,  202962281354792871 ,  1993211236689697841 ,  166694313632247595 ,  74424421049089338 ,  948438915521066675 ,  885357342474940674 ,  575985035825545499 ,  2303115248402465698 ,  2293660459073731290 ,  2227428632638202979 ,  2299477102926267552 ,  466285328039648515 ,  2065803997156181146 ,  1449648428316578942 ,  250003433716671333 ,  1195644804079628903 ,  2131367658169218963 ,  952230699721889683 ,  1263952341410868950 ,  2177147707461629279 ,  1633636390516344602 ,  908977540278115775 ,  1293284802766231651 ,  1601602749565061468 ,  1839185625457234562 ,  843055142235509460 ,  894962612761939952 ,  1885266154060308175 ,  1383085169823284075 ,  1950455657703573603 ,  1766937012407670983 ,  6464960589754186 ,  144421108092547108 ,  1641091473439538425 ,  127673029375940379 ,  285568657439915983 ,  753287227899726991 ,  2148601413940590490 ,  1370130976265795213 ,  921206107793553087 }, // x^2^619
+
+{ 408566202305323241 ,  1198570237287405656 ,  342436165223685480 ,  1369340367862390181 ,  984935459907412636 ,  724949171846774424 ,  16680901301915952 ,  1130054875324544345 ,  194710273792093968 ,  1594749860041664312 ,  996202965080644032 ,  18909672472075674 ,  1832261973872230093 ,  1087539367767263188 ,  1445441211106328980 ,  832820397175568102 ,  1701112089545398965 ,  2112702111622289514 ,  2092283376835409835 ,  569795214579334088 ,  1817114259321366853 ,  176408896753358328 ,  1055718787677519737 ,  1233419970461503343 ,  1620728226857270590 ,  362323287800577339 ,  923800684139687912 ,  1581043797448572445 ,  1597126785150042356 ,  1473005831881387973 ,  1163652010594286472 ,  1711948002104386185 ,  69158968738205296 ,  763969380710499216 ,  1443652826532076397 ,  893006849010182913 ,  2130732675905051889 ,  376029724125276398 ,  932808154049860970 ,  1465918371212319108 ,  568007683481358783 ,  1710075033839798802 ,  1608003675732668871 ,  1131384585876706650 ,  1428230960435882666 ,  118849691916776392 ,  1368952058827536511 ,  63422104992723854 ,  909268431092032185 ,  1395149189096845154 ,  1761396037051664355 ,  1812121238609688835 ,  1548811273138147602 ,  1351228374694232945 ,  1113921022241488359 ,  1225394647257178644 ,  1929463350071225549 ,  633187343202330417 ,  1157595197737794407 ,  80995683205039212 }, // x^2^620
+
+{ 1866976739727412235 ,  1953103848900788734 ,  2242453181400489027 ,  565719473304505416 ,  437310086628645701 ,  15495402435210377 ,  1762102472312233290 ,  1103855841006114618 ,  921729645208429559 ,  1561543376944736749 ,  676875056867454314 ,  857800080760669483 ,  1580306654790438374 ,  331773390302256187 ,  1657946640002844666 ,  429969444259736781 ,  2294725842208637203 ,  536238806460452356 ,  2253634346545960765 ,  1150078614081310507 ,  691437668014290741 ,  2075824518886479163 ,  1166943621989152582 ,  706108477028357488 ,  861213745176974824 ,  1953661489639126933 ,  1306445402344015131 ,  2245625946003657389 ,  2132134565512207754 ,  1660559130111916318 ,  443270969279812413 ,  2189433182391091154 ,  1438009483751044824 ,  1731894950780746552 ,  779074106320867210 ,  886632335503707845 ,  1483896750540136409 ,  169618390595942909 ,  1564257195919207403 ,  441609237040177266 ,  1045334855015196748 ,  1802024730834398536 ,  1623957708949513587 ,  1843454457655242685 ,  624027116447096234 ,  1963185539212703051 ,  2023839400845267732 ,  1017867542399600522 ,  802964039955251249 ,  757459597169189971 ,  1485759855540041484 ,  387783932459608962 ,  2232624922967371820 ,  1955204970419337160 ,  1532473735985807860 ,  71495532627146230 ,  1874917077942583104 ,  327948427572109623 ,  2166950582643120527 ,  1865636635991957522 }, // x^2^621
+
+{ 2030661191958660158 ,  1010886409787486992 ,  100438188130259331 ,  1202297581081732755 ,  2082621358956387688 ,  1031335752388174563 ,  416691209809490768 ,  1220948758657654777 ,  1385727129363205261 ,  1379789991810763426 ,  770359204010718831 ,  1399544547060813703 ,  1259425678643098595 ,  1000434333278515287 ,  1109860263778762363 ,  1842927871458739171 ,  471036195419774012 ,  1758460562080323553 ,  2001560963211218346 ,  386349188778843653 ,  109941711900901252 ,  2038677931699862302 ,  1015123268492177679 ,  160642827283232144 ,  1537417290809357860 ,  565233269832806810 ,  1425104572398163181 ,  1768022800201047653 ,  2087835542165536534 ,  2103782101303572588 ,  1156060663449060885 ,  2305096209619174645 ,  1071110733923390909 ,  1113653541956561757 ,  1167142210046513521 ,  623716564377229318 ,  1956770416632188751 ,  2131969816908931221 ,  752014537022708706 ,  1287889875628201838 ,  979390851509948445 ,  1820322839280600238 ,  1283791049248598351 ,  1928675736002895183 ,  626310690967492864 ,  1471698798443510958 ,  1118264775305841804 ,  1571021772287450861 ,  1297874459356917507 ,  1464063540647784228 ,  1094908429926227597 ,  912926939477563271 ,  1536182367451124518 ,  1198038709262226018 ,  292164169440818979 ,  735436015834061374 ,  506473144208326493 ,  2045095553464140778 ,  759994804177568603 ,  504879090656272637 }, // x^2^622
+
+{ 1262625840617762001 ,  781203130784338154 ,  98750785490768574 ,  263721555232873378 ,  733288350058965924 ,  790151264519458603 ,  245384502997514086 ,  920463752681134263 ,  2061669643824588127 ,  1800842868640361883 ,  1548872813759447481 ,  1571501451480084087 ,  82356558771514743 ,  1802297759285041514 ,  1094765590415835751 ,  1606178814705648837 ,  2232243727892560261 ,  1972753363321383670 ,  915041592254172044 ,  352547181298101400 ,  1994489475641798536 ,  245740318235130436 ,  520177747112747018 ,  1218302622504130069 ,  1213883265130817551 ,  1118994778063938085 ,  2114220667204818480 ,  2046449230679015066 ,  165749158808027037 ,  669876677810627465 ,  1187277678680223357 ,  1037671881178886953 ,  1932351735805478828 ,  1894420769112231267 ,  1925285885930561145 ,  1557053833563074536 ,  334514903557119754 ,  30365142330955650 ,  2093022526535329650 ,  1540443968408647400 ,  1694988220354931635 ,  800094263268392557 ,  758892544055953849 ,  1826233329713157386 ,  798745009225828300 ,  2292814854102670457 ,  861932584779683710 ,  772444204075029178 ,  611160258303757031 ,  1395994440625597365 ,  2055349179193683295 ,  97321774779269002 ,  1572338815296315092 ,  340919873290518028 ,  176910614408906991 ,  68817782418962348 ,  45476599884703500 ,  1206828097420268337 ,  1913228080971057895 ,  1865921952770308682 }, // x^2^623
+
+{ 2233285525899367338 ,  2178931571571130844 ,  1494100564134002313 ,  188947169578299778 ,  925358674932307 ,  2135598773799931313 ,  2106777020729742020 ,  1297549562477228930 ,  2082526390564535712 ,  1304254071917087186 ,  1088533486996649424 ,  1944745291554046588 ,  1692589100994107992 ,  120475553716009241 ,  2187637274897910072 ,  177139430795301982 ,  342846623863699709 ,  1498256615407886440 ,  2055237242485910434 ,  2083285374871223839 ,  2253966780785542506 ,  90593695949284413 ,  632487278358784735 ,  964522436025303013 ,  51867980617629656 ,  2257165165940188911 ,  72510010952848075 ,  19860975796871732 ,  1896565813008501761 ,  26461934658218957 ,  1419716126566058084 ,  849545953908038337 ,  643641348057499857 ,  294970953723687939 ,  1838725802782554053 ,  906295469786838615 ,  1309920718998672623 ,  1991777108558380003 ,  1416488567265688511 ,  150373997151352192 ,  1693465149177082710 ,  941627886969484065 ,  2168657777782496237 ,  2224793322751934830 ,  173219766471445528 ,  1187097107567336773 ,  972639525823676621 ,  926520109258023546 ,  1082241401002138741 ,  1590383717920741552 ,  910018370290647962 ,  2265577006509442911 ,  584986590967588822 ,  983516953993898073 ,  2046714110078601611 ,  1386646679311876954 ,  714701515489045857 ,  1144285752142503906 ,  509195834453895434 ,  53155697968692719 }, // x^2^624
+
+{ 1484464284885884395 ,  162421505858404286 ,  1193452441587488362 ,  34206751658655863 ,  1889343177219359166 ,  629489498863497073 ,  749138106602312819 ,  429947725758804174 ,  568124294658348271 ,  1201930207391333882 ,  554392220292797122 ,  1600030185624270290 ,  1768908693142796617 ,  1838115866831376049 ,  822081094152560494 ,  1535777649496252915 ,  226604909064290211 ,  492551452199582614 ,  791706259126561743 ,  585709070585944679 ,  1569851278688416072 ,  296594002837092173 ,  1513776529988834086 ,  1309711222572210348 ,  1094390606087422534 ,  818161516942460977 ,  385896589560914644 ,  572783245546413888 ,  2209823636145059056 ,  1113387445495119826 ,  2211243562960182415 ,  1682693835783871386 ,  1795550684909152417 ,  1266275199254980927 ,  625052668652970215 ,  612894597745126497 ,  958403805467329804 ,  1070115544611879100 ,  1701285042697174247 ,  1627027232610828435 ,  1131035294254932376 ,  1315803394450418858 ,  1506222745333568084 ,  335668445610467608 ,  666684835547142843 ,  1437492008252304022 ,  151545764993890753 ,  575420365803976882 ,  1490102039215785089 ,  517276541031852359 ,  1410433274300266278 ,  95113703949215775 ,  1829447157390930666 ,  298832289274502401 ,  2825237467874724 ,  683624970892007536 ,  230569539422718739 ,  1219835901155467854 ,  1070524402390905141 ,  838169214928193412 }, // x^2^625
+
+{ 543452167335232055 ,  423839801251311138 ,  275635761806261502 ,  1555983125051653772 ,  927583160807509327 ,  1988365697597863825 ,  1540936724503355302 ,  3016032816451123 ,  884272439462442284 ,  447674613778604648 ,  240944124681369192 ,  814639307319528683 ,  117071738623926236 ,  142832424761005680 ,  1937392089559421459 ,  204787204579883076 ,  1271480991701003768 ,  2118603155940592656 ,  226273008851211083 ,  684622128614134398 ,  766026584337765098 ,  1030165472046823669 ,  1875012935089235438 ,  1701209382447179750 ,  1345651381283401162 ,  354931906488706443 ,  227024592083050584 ,  1894899673510411994 ,  1439032004260670894 ,  272798516478878332 ,  823563603123205201 ,  1392852026817632718 ,  1801937718594124738 ,  737819951630603944 ,  1707974279454439718 ,  1269138900282389633 ,  751774942223191320 ,  562130696587335632 ,  1046165977312650623 ,  2100522417512113308 ,  1549605900288087914 ,  1082670718148452501 ,  1727213885128307619 ,  1864368076271421207 ,  1872905987877699015 ,  1281171935439660723 ,  1261009486019311921 ,  1003453062311898048 ,  613310906025945390 ,  232126790261164720 ,  2164884400864952769 ,  1926209020395013508 ,  1403613491747827496 ,  2092311589737875871 ,  655660579804486803 ,  291265180824337095 ,  1427578467399146364 ,  1625214520541402010 ,  177189897710406405 ,  1162775992027129408 }, // x^2^626
+
+{ 44521746986927390 ,  455107010445011963 ,  222557524956743692 ,  1129411505260817893 ,  932169119889963871 ,  377579218523567757 ,  415727423726795846 ,  2107026309666564559 ,  995053619877772960 ,  2240033343542904493 ,  602720143271267451 ,  312590951633008150 ,  1946750847215946316 ,  2267280187048347192 ,  352751124203933596 ,  1697649657269262467 ,  2210655456421418855 ,  1304237719090615506 ,  1827365275539310331 ,  271380881762829319 ,  2285080902474179838 ,  1878805278086816405 ,  448857769110530585 ,  909607307659112233 ,  135520422518291794 ,  1251153333581871683 ,  759241050167264782 ,  1845757052950539237 ,  153319946780543262 ,  558729389050661802 ,  423750883688331927 ,  831508562582959309 ,  1657455486319606250 ,  659620061445669338 ,  756858654636439510 ,  2254085503023890481 ,  351927260605813233 ,  1211033119486097023 ,  1817009026422530719 ,  1727828961595283028 ,  1578345949924906920 ,  1777691465020929797 ,  1548342987040952938 ,  735427682971440291 ,  1267829731110013140 ,  2062231700969341194 ,  251109484758061828 ,  1482167982582758856 ,  1971826543029484264 ,  1266167728855984848 ,  1082736661493825659 ,  1360772131380722378 ,  2107894677481030324 ,  852827201771617118 ,  1666951758516489794 ,  231189869711879975 ,  958158080749534449 ,  2128558259533057377 ,  361239726268923944 ,  1270417460364028742 }, // x^2^627
+
+{ 1695825833565052558 ,  1436502614177685208 ,  984091736924531967 ,  1520168743166546861 ,  708881254166879170 ,  699300964464842404 ,  1511776367616020954 ,  1469792918281823942 ,  2224440126295903839 ,  2173809430562651901 ,  1853768679033014220 ,  1991652035087549428 ,  1355833768173877562 ,  999762917736946668 ,  1814651104837065022 ,  2093745321919121076 ,  1943206864461138754 ,  242452875377983520 ,  926352690773493005 ,  1365080245894309257 ,  2002221802985895184 ,  2227679474228828391 ,  1767723228383215394 ,  2251157748267549481 ,  536826446722171889 ,  1392983082157577199 ,  980084543427261910 ,  1638075815137706382 ,  996706218344204070 ,  1487802062279617888 ,  815212431646460883 ,  1608736231761116827 ,  327053546996056868 ,  920364505239796873 ,  478957193706958273 ,  685006035956630700 ,  1465444507538678703 ,  1641594672419572612 ,  2275661985144769549 ,  474422251834110219 ,  204727389435086979 ,  1324630364571897928 ,  1743477954557400606 ,  972878303511338597 ,  1797322557772285913 ,  904401053458154109 ,  809663380937234535 ,  2010376552669340507 ,  1586505217222988827 ,  256824968975318766 ,  1438448020870932218 ,  836979253394362169 ,  1998688108385937145 ,  2054722378700150461 ,  1084304912099357222 ,  1260456853265789401 ,  605039676887828510 ,  2078981158844545008 ,  1443543029332848291 ,  1811501584574776276 }, // x^2^628
+
+{ 40013421815397323 ,  2132971361499397679 ,  685737538278538059 ,  2026201983352207713 ,  822110053946863026 ,  214298095223391357 ,  2197215339351258059 ,  1228763273855732826 ,  133483923034579423 ,  2238449093306454215 ,  1383960232363191092 ,  1059322023965824416 ,  2133420073069901768 ,  1562852270714842327 ,  507785541993582336 ,  7965535994512336 ,  1393353225980318076 ,  1848031893405174108 ,  594426375537719066 ,  1000050597662961780 ,  948212481870194775 ,  308144980191022860 ,  2004334542481269494 ,  1382694529096022704 ,  1016745642784638925 ,  262385029856974043 ,  1162459179779957057 ,  41035310894851587 ,  2263897266732990368 ,  869173958005703284 ,  1724119373649237471 ,  1067079927145320142 ,  359970688403380827 ,  2230729192873722219 ,  956580087581794357 ,  641681466827389023 ,  628188333224724361 ,  2010088815033123175 ,  263282941024216972 ,  2024544245550533083 ,  1115789778274472956 ,  767957080600183809 ,  945777448658789840 ,  892145430812454727 ,  1071925019154748040 ,  1074649297218871639 ,  1800828649820742637 ,  1362631430948874803 ,  772574727111168568 ,  265136266836920648 ,  889588592816819751 ,  381379948187420705 ,  1649864370764169614 ,  414282093646935334 ,  13836618844726401 ,  1343493847152745690 ,  1336631047253613971 ,  152205638009994696 ,  940940154901868699 ,  1978176681773140091 }, // x^2^629
+
+{ 1485167522289472977 ,  973187275987656551 ,  1863188148903291641 ,  1262613299188848907 ,  1585390122200851448 ,  1622232607916106137 ,  699484799321342510 ,  1969176695115076454 ,  1713281699780198087 ,  354442130003499875 ,  1471059493861815170 ,  1194414579592141224 ,  1074022701702369688 ,  247652744135369297 ,  218267932632097541 ,  1266045871099428644 ,  682387594686639072 ,  832507079586617252 ,  1678870662064062371 ,  322590564093158131 ,  1310238543512164402 ,  356051213118914074 ,  1550698298171021151 ,  1435769284151570328 ,  1229270822398486455 ,  291984401280148340 ,  1109383225963309898 ,  692328058928825314 ,  1593338219225579315 ,  1134201381585297617 ,  66945848055747336 ,  462127293028855417 ,  2248512923602324568 ,  1641238803719971538 ,  1449105265599164653 ,  1167481896293488259 ,  1082348954511967848 ,  705731688075946756 ,  44372072160704674 ,  2301781731539387489 ,  1308145030539818894 ,  280930611087493344 ,  643134764394166265 ,  1526043117577682910 ,  2976589198154715 ,  1075925538929983488 ,  1941195270059125368 ,  1737965286029190568 ,  667277111539472640 ,  389838749227635853 ,  2209554038487980282 ,  1428516381743426029 ,  455108349874995544 ,  299941685437959543 ,  1989347008114852795 ,  456986292019047027 ,  658119630870054394 ,  1383514962242624267 ,  1665072238348368326 ,  586815199113598550 }, // x^2^630
+
+{ 1290783370122158023 ,  718015197454795634 ,  1351372895366255532 ,  324152077679712804 ,  1694594818012693908 ,  1001376403361666139 ,  813584967691399119 ,  315391877088092891 ,  840847409168991971 ,  249871514318278208 ,  510657081434725430 ,  1221761637861894455 ,  1476138385847852302 ,  645366993129845989 ,  360050444960511199 ,  1071068358303760748 ,  1452271732805341683 ,  2165218636392257740 ,  2305568030496930359 ,  2202898676614428305 ,  176510146144798958 ,  1773996866641973822 ,  1648822893464155735 ,  2295193325051236613 ,  243033682131401530 ,  535934109469330890 ,  1150421656275103565 ,  400124988105373638 ,  1776585444597389790 ,  307339399188196941 ,  1086263140570580199 ,  1216548642173283825 ,  1761199698596735217 ,  1835351841093720062 ,  2128580847744546659 ,  2283689160493548639 ,  294269378809450740 ,  176218526368173346 ,  1381645242893801508 ,  1190159392083783560 ,  1168961209658643681 ,  116987616584989310 ,  1296493860873918700 ,  768183357331634985 ,  1085706995190214595 ,  484570704265939905 ,  2119985896477230929 ,  211202640228793732 ,  2060830315233882684 ,  587108284501840940 ,  2034117382259555490 ,  722646734395577359 ,  1446745109305779715 ,  1090309753556931885 ,  2006768866804772336 ,  403179430479265198 ,  487714169681354505 ,  682253629303606724 ,  353027713915116121 ,  261978114744218532 }, // x^2^631
+
+{ 710620105003603533 ,  1110404451561529867 ,  1195740463114152487 ,  679558975175639217 ,  519632499121695803 ,  753593202386829170 ,  560467259601516402 ,  114350132150570118 ,  589634940241101703 ,  2071229499516641671 ,  1560042419378912206 ,  1797478068642953681 ,  415212680307670591 ,  1795283183559602524 ,  556638703910068853 ,  1867347143637601455 ,  1328398510118334562 ,  933298876480751520 ,  1292303953745120185 ,  1018459686702388564 ,  1517717938419856791 ,  1180480954227240783 ,  811757895920437343 ,  521118746126330388 ,  1621516411650061668 ,  2015992348706162560 ,  1188481822956641199 ,  934572497149736731 ,  1909974848049143938 ,  634652930220226711 ,  1213605427391426903 ,  1396884904066076963 ,  570260607609202670 ,  932634854746004857 ,  1010457457586408403 ,  907726518558367790 ,  352550588590211935 ,  549134469131063557 ,  1521676296154264559 ,  352956015414469465 ,  292469660618657850 ,  1545573730365083944 ,  304162604787516557 ,  695474597168153083 ,  445606352791481990 ,  76891156121184355 ,  2195059563451654258 ,  1682648133112111499 ,  1511843074589795384 ,  1704344362717705012 ,  188622476269031831 ,  2208891046027783467 ,  838810893509957950 ,  2142577614927103502 ,  241110475127295873 ,  421018419488204116 ,  1991096333716364837 ,  466610422700277610 ,  594453174197943590 ,  1580197923118960236 }, // x^2^632
+
+{ 1666714844419449976 ,  292583223942152333 ,  732310306465534963 ,  2271239413931761184 ,  1346003951716998663 ,  78174372143146190 ,  81681230158474924 ,  1966495971440414941 ,  1084133633439914806 ,  7785125702817778 ,  2120169845445941917 ,  1891941076187719421 ,  2246204270450106181 ,  1847498301141147527 ,  768630222232265925 ,  1837557452429620188 ,  501228644559604324 ,  1438438762138989508 ,  1417262383341561596 ,  1500717121306003578 ,  1828471839380332023 ,  1040102989598493674 ,  653833106181505370 ,  13464566055638180 ,  795265816642871646 ,  2254953709290956011 ,  2128515092241248408 ,  669764720445049685 ,  638885351669417862 ,  35830659382470744 ,  698316762767938477 ,  732825726955033203 ,  1665840719728450613 ,  202565574818024931 ,  1886195449783194141 ,  1486382012443316922 ,  1880356519748953903 ,  606525762672549540 ,  1209172544832949891 ,  868418119200083963 ,  2206612335685012201 ,  514697995199047335 ,  528548284273550409 ,  82874839156984217 ,  1157151548479849191 ,  64710082837233357 ,  479363999893057964 ,  324540154582386677 ,  1234445060600000508 ,  1444913338429985523 ,  1973027150655742257 ,  1694052013911609971 ,  1907630668260441699 ,  335513605594065245 ,  1829427533118550851 ,  1352103587460889698 ,  450825962585826935 ,  1297959834703143377 ,  1034738033195629828 ,  473155952703696066 }, // x^2^633
+
+{ 1098027664197470928 ,  743280318671260899 ,  1251255579449775638 ,  152150229075739553 ,  464090065927647976 ,  458082818483015526 ,  901715316140331974 ,  2130154781132920728 ,  1276085071595890385 ,  1516804074755527007 ,  1861505305648186313 ,  1317907325188415694 ,  1882514082107370334 ,  1551730293920705403 ,  1240233657110245566 ,  1120085983140351945 ,  2032546960307116012 ,  1473009488919401803 ,  828418048248640431 ,  1088658709858076697 ,  810506781817800943 ,  2168167781660563130 ,  1837398094516473314 ,  2204811022494568853 ,  1175441878471891819 ,  297022919582388388 ,  167925693119756906 ,  1387672177722200558 ,  2173255657463577256 ,  416240869550710720 ,  735242919231176492 ,  1591925850935205972 ,  86027605645543241 ,  1209038174956467408 ,  834632045541196564 ,  114875477200121084 ,  1699561119415151004 ,  1614600439337337721 ,  1120859627357926965 ,  2271146256847929356 ,  1081856222735607571 ,  635003327870426059 ,  151144236093626009 ,  708915827027229148 ,  227472956562037574 ,  909718948345754672 ,  733478165219046860 ,  1799446664688617565 ,  1919412887668621670 ,  1843080962592598351 ,  1066915669622946819 ,  1880590907139787690 ,  361443130821666300 ,  1335295534963186858 ,  1688285430283813263 ,  1225828088086227676 ,  382183301484243651 ,  1017450303966565897 ,  1630320317318546860 ,  155586815508837374 }, // x^2^634
+
+{ 745126045402017592 ,  254680179159320005 ,  495571100712511971 ,  602469244837923191 ,  849182330851763380 ,  1948463581796952892 ,  879455966316907971 ,  49199802728910372 ,  2267068576719231286 ,  1806865513113884939 ,  1672184132512286586 ,  134435205660087507 ,  713282143524286172 ,  530209307315526111 ,  1377056364650660437 ,  1024881975934542374 ,  171689381814174842 ,  1409660787289578576 ,  765205080899298539 ,  1687032862576334655 ,  44544153295813288 ,  546275100331851785 ,  565777534873608617 ,  2114721908829381156 ,  290717172148359998 ,  513081913375818335 ,  1042624659119985112 ,  1588293026426313813 ,  2194629072245120789 ,  900469392518482881 ,  2003625624309829059 ,  1251901218724410930 ,  1638980115146583875 ,  2231976481346442694 ,  1283951945511265940 ,  1105825067884358700 ,  1376652618302251812 ,  1674478071978556956 ,  1467459464417340823 ,  954136972460357266 ,  429135897887249564 ,  2015251167562091620 ,  1169733132976274790 ,  1078785552341192785 ,  2000443426828243564 ,  2256787663284654344 ,  398186126206964619 ,  415200678875798745 ,  557725066739422090 ,  1982853269687443978 ,  808202473309086382 ,  1138529382820661504 ,  1502287951617037834 ,  604316613199487093 ,  1394092443379387093 ,  302496960153668930 ,  1155396094216043522 ,  1426273031138865048 ,  841604189103910737 ,  1384158806904034018 }, // x^2^635
+
+{ 1385891735368922518 ,  1902230291552032009 ,  312668072007865493 ,  1083805081659717141 ,  809092170261078617 ,  1338718805349203241 ,  837359575294901248 ,  2198295283835469032 ,  566591028978613384 ,  1311138254264338449 ,  1368686249202377973 ,  442620160871342139 ,  2105513181930971162 ,  581041158436366855 ,  145721007531012477 ,  1126297169948667251 ,  527154587334174208 ,  1590582812443903229 ,  2294202125181455658 ,  2182685316044695728 ,  2044083527330072388 ,  252125822333567662 ,  1089678897509301872 ,  2205935692249621389 ,  1804169132161695611 ,  996710469854506054 ,  1316543569400838400 ,  2062227915127702376 ,  2227728579956389483 ,  358098451510213741 ,  674152278096010413 ,  134087016395820080 ,  422988210013547427 ,  118915825007434475 ,  1279076163162087447 ,  1417931960621751279 ,  1646680805173249172 ,  1262835486878550479 ,  1658918929537662623 ,  913536720433648056 ,  1302644874884503954 ,  336761289867257215 ,  910437372226698603 ,  1349867844569169511 ,  1957820972519570353 ,  627436425484685674 ,  63924806346190113 ,  224651548937054226 ,  966274015661471846 ,  1347119649307019191 ,  446236139624804760 ,  903565372394026649 ,  558802919433899269 ,  183942247338336883 ,  1167237863896996099 ,  845978726360993120 ,  2159505928346574945 ,  445780477602619765 ,  837964383243808000 ,  1895904615991554642 }, // x^2^636
+
+{ 1436379327367682421 ,  1292938015040098270 ,  1635761245955531423 ,  1176693704084809561 ,  1289072670707252456 ,  750476048627794059 ,  1698549245125873274 ,  2231971095527384563 ,  1332318212565187995 ,  1353411770967961641 ,  1108830755032475007 ,  1254211179543374031 ,  1363105653959551669 ,  1831427039939950808 ,  422075290689389774 ,  1146817112954121461 ,  2258241237861517972 ,  781802866778498737 ,  1905354507438957800 ,  1570880366538201672 ,  2267896308611955954 ,  941434038323861295 ,  998523947106460623 ,  1058095770162703960 ,  1766207475973185875 ,  1653697926461774557 ,  548235308488007767 ,  1821389204643787190 ,  644709561883348918 ,  851382122491312973 ,  1798763081930468174 ,  1787916025154707030 ,  454515106678242039 ,  623187555356336207 ,  1344011402436712824 ,  393025047684792635 ,  1399947746527062975 ,  1177492732852693357 ,  1045807592069497728 ,  1633587217723816727 ,  656338961174425985 ,  867038893523310818 ,  997981544605804631 ,  870015092666440997 ,  1280534449705312847 ,  206645500023785519 ,  265606371485793996 ,  248370430382539669 ,  336325512492523595 ,  1130695624160980640 ,  1694528606851872730 ,  214528112810521178 ,  202407979092222408 ,  1086261717211085443 ,  1386497422930907293 ,  169980031271752385 ,  1761864116327140163 ,  1939935383267642564 ,  857934305359979324 ,  1622301700473637897 }, // x^2^637
+
+{ 1359235131778384966 ,  1555271298021515160 ,  998537611192538612 ,  122409859356530864 ,  1198839908046367867 ,  280942791594538621 ,  864032710804785680 ,  1138269725205171883 ,  621063709637087849 ,  881384097825221344 ,  1208053625845741853 ,  766854578138965856 ,  2155663377880600079 ,  428987887552639756 ,  1568620372912307320 ,  2289573489544032256 ,  1919495081398529034 ,  1679571548717190252 ,  1754880312302196287 ,  2805471984124608 ,  1240764893970752747 ,  1946220088119749714 ,  345565750516354624 ,  298167699560554338 ,  462214724993908159 ,  870129922016456583 ,  1413359476521764423 ,  2288782125021039524 ,  156322506164134195 ,  1726494570983906643 ,  610627719509540757 ,  1942421375727514560 ,  712120956649347198 ,  638611024369258552 ,  2302860885489644056 ,  592380576342422878 ,  2220575423947307889 ,  1396983426163240412 ,  257866959990791651 ,  661645802493908626 ,  1918031033015527377 ,  969189040491880632 ,  899533287315691299 ,  2161919207848701777 ,  1525183798517098505 ,  1979731946285989813 ,  946515856811873046 ,  2264164099252007920 ,  220867120155780110 ,  176295257850932296 ,  816858976909268510 ,  831431586399931379 ,  1706966508767052170 ,  1077763634141545254 ,  1205447868403155620 ,  847518287599372178 ,  1328400369781686158 ,  2279339462106839394 ,  2091146575515368379 ,  530152005705030892 }, // x^2^638
+
+{ 776222025189964014 ,  1694685984120312048 ,  2239684125060020689 ,  550836131055157688 ,  2179045525498580667 ,  2065440331518089690 ,  2065669869032579428 ,  1559391554186731784 ,  11220090339982835 ,  119456170733869891 ,  550856571282994976 ,  15413879295159994 ,  401671113183159643 ,  983617870336815521 ,  23728548100543730 ,  1212848762279323851 ,  1730348206713817046 ,  1393786631802355973 ,  1478880295835384514 ,  2007871497271029491 ,  1639066640349385026 ,  2077300812646545470 ,  1138668010514250429 ,  955433532113568903 ,  364305293713847270 ,  44167643557354385 ,  1820875519432939069 ,  1766522030052537314 ,  1519410799376131226 ,  873506512515941771 ,  1864287633360325098 ,  2110478717260260409 ,  1130815651377875979 ,  1301896134525721485 ,  1617259591491812113 ,  1544309874754761093 ,  1808264290656406132 ,  1241751909512474221 ,  1448705875055263007 ,  1413602643083131077 ,  1249080434628526015 ,  219873385225966101 ,  834879078331027915 ,  1658819658911431890 ,  1185444341278514852 ,  1430181902057858294 ,  546978498151224162 ,  1165728635307619053 ,  1134340892874233487 ,  741726307967983999 ,  192556066689940281 ,  959481576819622120 ,  1530547936919303821 ,  741804905971425783 ,  1477999640202605371 ,  785421332992568493 ,  807067552131161206 ,  908283641902528476 ,  2274514708954726494 ,  1038128787690518057 } // x^2^639
+
+};
+
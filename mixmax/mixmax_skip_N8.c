@@ -0,0 +1,276 @@
+/*
+ *  MIXMAX
+ *  A Pseudo-Random Number Generator
+ *
+ *  The code is released under GNU Lesser General Public License (LGPL) v3
+ *
+ */
+
+
+/*
+ skipping coefficients for N=8, m=2^53+1 and s=0, low to high order, a0 + a1*x + ... + a7*x^7
+ made by skipgen.cpp
+ CAUTION: the period is shorter than the skips, streams are not guaranteed to be disjoint
+ */
+
+
+{
+
+{ 1104486435185353232 ,  1826187966621988162 ,  1647447067329771093 ,  1901078116878106029 ,  295833311744710246 ,  2174273387109931829 ,  1741219390099516017 ,  542428188952712 }, // x^2^512
+
+{ 1307686591667408534 ,  2277773057039495024 ,  494785003079409592 ,  1642249585469414061 ,  1599350983009879411 ,  729089232087561782 ,  497559989869018406 ,  1056974115245553106 }, // x^2^513
+
+{ 2285628880330339411 ,  1485538269021542736 ,  1632191582279626312 ,  122097096668220350 ,  501616100049901037 ,  331779093769198391 ,  645493220904967465 ,  1769753900006842486 }, // x^2^514
+
+{ 1549721390060907976 ,  605722542543669543 ,  1422744938541015782 ,  358307300400074766 ,  1922557329977134877 ,  459427045102203214 ,  898691895147555937 ,  2065946086272698645 }, // x^2^515
+
+{ 731650100299140722 ,  1319822728693156644 ,  2183620193461251379 ,  1569442051950590980 ,  1344803711560761280 ,  33785460679029301 ,  2047188328970381608 ,  285627249342841405 }, // x^2^516
+
+{ 1248406903815953518 ,  1834787066686971060 ,  1781528623947289634 ,  1024200742384547541 ,  939418789604159418 ,  38748061913770554 ,  2006841726844068829 ,  1153536267006789983 }, // x^2^517
+
+{ 1521518769029927242 ,  1218700931093848914 ,  2226880115764545596 ,  896081776243666630 ,  1259003174529479869 ,  2268594596645873069 ,  755958104530931342 ,  1310469817107858627 }, // x^2^518
+
+{ 66104383158530245 ,  73509091133705638 ,  1687695267514855831 ,  1373595682636900548 ,  1337290177127327232 ,  871631964171301765 ,  1097942103841428806 ,  1218516752662192896 }, // x^2^519
+
+{ 749349439904255653 ,  1284576891840488385 ,  1016546636701375797 ,  2105604731671389343 ,  183127372125492723 ,  966504205837879835 ,  758152877757854945 ,  2135043260958287184 }, // x^2^520
+
+{ 1348807766129053387 ,  939373288891033443 ,  1124502247939026047 ,  1856925362115968032 ,  1306336688091936620 ,  300995176997721997 ,  39784328016580323 ,  1411140470664797526 }, // x^2^521
+
+{ 2248207956898061085 ,  1690538461079328258 ,  617302730802835447 ,  789621214550993812 ,  1972452676114867726 ,  454650532438789472 ,  587930580721247419 ,  660384392699893995 }, // x^2^522
+
+{ 1901412853033000270 ,  1436854790797846845 ,  1252490272133283129 ,  2197926690786073354 ,  1635178331875962080 ,  1374016010902667087 ,  1481861067091493205 ,  1080482176995637950 }, // x^2^523
+
+{ 722491931839111866 ,  1690779229955536210 ,  1367234008201587188 ,  1427389800761450054 ,  1107832554225721861 ,  101980459764875586 ,  863628139098905951 ,  2239274015490249174 }, // x^2^524
+
+{ 2166719799917056160 ,  1381148084622849667 ,  176601236076713348 ,  939634020232473864 ,  959369890986982899 ,  299465666852713775 ,  902954706629611668 ,  262291558748106356 }, // x^2^525
+
+{ 374756685466486213 ,  1373278665761509859 ,  1112909526584347153 ,  1197921294454575546 ,  1364396585739998709 ,  75781110733655069 ,  548440646289757125 ,  1714609641718161272 }, // x^2^526
+
+{ 228524655386655691 ,  1839350189434282577 ,  1722314117873521361 ,  462439675177069756 ,  257395692460542523 ,  2276363946102061676 ,  2026249673806585901 ,  2205503823680312251 }, // x^2^527
+
+{ 337258281553699953 ,  2101222252974984155 ,  111183667895527849 ,  2201906460076755315 ,  467034653397549028 ,  1178426581828864119 ,  1113234881880725923 ,  2038906606747078021 }, // x^2^528
+
+{ 1307460583721103458 ,  458637382952316055 ,  261076010610723093 ,  996236286236175473 ,  214055627507925377 ,  2281712992681949307 ,  1154237405954290344 ,  936635654435846943 }, // x^2^529
+
+{ 1367994500073358241 ,  1653064890194961136 ,  2164956870525432711 ,  2000442823189006780 ,  2128484612714594601 ,  1694820518950454865 ,  826377281402651040 ,  325610766379805479 }, // x^2^530
+
+{ 844401349888901452 ,  400043163661954044 ,  2289367779712035974 ,  108707664489095141 ,  1252192029935065452 ,  853082230609212998 ,  757597428897345948 ,  1795287802545752497 }, // x^2^531
+
+{ 1063034870654694666 ,  2186906649842351212 ,  1775074832000757193 ,  537049047093057613 ,  2047409322575867898 ,  322865846499680635 ,  203191418907335814 ,  851859255220415624 }, // x^2^532
+
+{ 1117353367745652471 ,  1937106867508666 ,  985451710780313761 ,  1300647760485282833 ,  1733773343071566141 ,  1730730520826480536 ,  1734346157485378308 ,  1696049067692451480 }, // x^2^533
+
+{ 1478882881409854649 ,  2022048881112284341 ,  1357336162467360766 ,  2070302368460426723 ,  665850196440881670 ,  110119977187089798 ,  721168742797051526 ,  600629881607497172 }, // x^2^534
+
+{ 1863752522432477147 ,  908632442343426971 ,  1889440937907158562 ,  146271836703775342 ,  664443476966148944 ,  1437128994233339814 ,  1196601990401205461 ,  843905479446906351 }, // x^2^535
+
+{ 152535336371668325 ,  947808224238939647 ,  329406425310686996 ,  1429802589693756206 ,  69828565807236724 ,  398762251155791214 ,  1996450056556198252 ,  210805367422765762 }, // x^2^536
+
+{ 1186947461849881964 ,  641763268431505243 ,  727140695371599962 ,  682947003579947162 ,  1072021508951966852 ,  1448803747022850279 ,  841969837307294221 ,  872748861018942847 }, // x^2^537
+
+{ 1534946567365072322 ,  1772894025586677443 ,  1583629682636890708 ,  2150422789106347499 ,  1508795679069839671 ,  2252270868849364732 ,  989593210187425471 ,  1105663373317212914 }, // x^2^538
+
+{ 826878342445869174 ,  794333721091059274 ,  353054070720383388 ,  1682401535763708772 ,  1638727800936289465 ,  917914938044885540 ,  1559858670681375146 ,  1984016150770297187 }, // x^2^539
+
+{ 1234515334643943069 ,  1791117080219285401 ,  394948885075517371 ,  2036728931964833194 ,  985935585603000515 ,  1769862274861394476 ,  1868079528010403135 ,  1801505656585198244 }, // x^2^540
+
+{ 2063911770420268356 ,  718904056793096975 ,  2100763426894735449 ,  960119358280414953 ,  891963139855583700 ,  2298346407234813085 ,  1213576986836963844 ,  1564924624784382201 }, // x^2^541
+
+{ 25860708405032958 ,  1514132221159586135 ,  794988933348755253 ,  1879714455327194088 ,  1619176303045560315 ,  2299748212032810216 ,  2211927533860358504 ,  1305415293827641013 }, // x^2^542
+
+{ 939928658257940400 ,  794539846094896475 ,  1317442343754422480 ,  1279929742852816894 ,  1909295129403133824 ,  728978260358511133 ,  236615089556647666 ,  1730523158129096917 }, // x^2^543
+
+{ 1882867442133150699 ,  927175444413404789 ,  266617813193824315 ,  1472288008087141978 ,  354319259050749825 ,  450079481145013723 ,  1593311294059450551 ,  1304633795605864062 }, // x^2^544
+
+{ 327883151077611883 ,  1957485504039123143 ,  464536975720911628 ,  1962200568818360499 ,  697140133943770250 ,  1794273712269535051 ,  375672606344761035 ,  168392190353177326 }, // x^2^545
+
+{ 2129143767849176953 ,  2050884468401684150 ,  1245360187814396168 ,  1772671105706198201 ,  2292335211603627485 ,  1291844850900412645 ,  376638341400769222 ,  1934774521089203281 }, // x^2^546
+
+{ 1667192294887291054 ,  1402903527427970711 ,  874659428490030746 ,  1776363031506258141 ,  935190898183248965 ,  2111721267584032793 ,  966605920072851628 ,  1126691231452435572 }, // x^2^547
+
+{ 481488042254799656 ,  1083287444431269047 ,  1712429273003688097 ,  1971635252290415450 ,  1822923282440785549 ,  1489925192115677530 ,  68497623473291906 ,  435772543628808788 }, // x^2^548
+
+{ 415992520563108132 ,  1930324664485163847 ,  593625029557112260 ,  405956461916840064 ,  707345405047373024 ,  378495340627518287 ,  532076680566072182 ,  28934870602796466 }, // x^2^549
+
+{ 2235201820152955113 ,  1279700336587171310 ,  817924064262968222 ,  803326460520874672 ,  70894129598237691 ,  1043097231445536503 ,  1565138680044612601 ,  658568818750599656 }, // x^2^550
+
+{ 1405489265807078955 ,  534795699472973261 ,  2304021092932836127 ,  78817695375853718 ,  816735258350357927 ,  1784129941140526107 ,  2102554682646116843 ,  935082471657620987 }, // x^2^551
+
+{ 2211455510031877317 ,  5916754378413091 ,  722938104472480981 ,  310399443958967727 ,  2022971981037008336 ,  1225625264072208207 ,  1802444640954877262 ,  1301664336689817109 }, // x^2^552
+
+{ 831793258163159450 ,  182668522628296002 ,  1153477252130142796 ,  497391361266901113 ,  797087508603710705 ,  966263909171776872 ,  890525266409626400 ,  2149745050503138773 }, // x^2^553
+
+{ 2053030091940694756 ,  18729611238788984 ,  884509052762452477 ,  1567294687206133421 ,  1319006264612610362 ,  860863757251227333 ,  1767353778367291219 ,  44819675578568523 }, // x^2^554
+
+{ 1126118175493509804 ,  1983163554317566162 ,  1871403349636566157 ,  795170608905295698 ,  1464138948841960226 ,  156864206463976461 ,  98245091969566031 ,  1643826444889019878 }, // x^2^555
+
+{ 1090223331064926960 ,  1834631706162886935 ,  566950271292050052 ,  2234938737084962824 ,  936574775243690393 ,  163581754146559393 ,  486522266199901452 ,  1382144396448958003 }, // x^2^556
+
+{ 631979008223037238 ,  979932055368086911 ,  1104053737142346964 ,  2204802427258342639 ,  154530535714542975 ,  17049160214020287 ,  527445800495876304 ,  1058703602259696207 }, // x^2^557
+
+{ 1455455479935199299 ,  203903477577466352 ,  754830990273715013 ,  1467076859764784371 ,  1835762788664411595 ,  1350510696151979742 ,  1739383123448853147 ,  809603605287079190 }, // x^2^558
+
+{ 1466436348352152972 ,  1774844749856611477 ,  1189776111880162188 ,  1923428355455913750 ,  1035124239152862911 ,  908684532661312922 ,  107363503843034174 ,  2072452940028994143 }, // x^2^559
+
+{ 2121077422844640666 ,  1381073152937726678 ,  1653679716178152763 ,  516911309865304340 ,  179284786152113088 ,  1091382926884650061 ,  1450980480311228619 ,  2205099105862031646 }, // x^2^560
+
+{ 2210395971710788263 ,  875235808394754972 ,  2228192879709275206 ,  308842619268584037 ,  1694841428341444528 ,  797082494093675757 ,  461986846311464935 ,  699338466279557044 }, // x^2^561
+
+{ 598018812887736689 ,  2014058195659896680 ,  1265212967191755627 ,  2025935275744808912 ,  2155316754892593330 ,  2183629935818539685 ,  1961568391025387491 ,  922883819498400132 }, // x^2^562
+
+{ 2031617454110085183 ,  869511400765561046 ,  129520611340465336 ,  954982986254965761 ,  734225228678328007 ,  904536113651151802 ,  911482854349777413 ,  1827474093325021614 }, // x^2^563
+
+{ 946273510842683720 ,  403289457308389071 ,  1887801170060070215 ,  658524354888265094 ,  965570258420099646 ,  919284057551961072 ,  321087200161258920 ,  812879724671965238 }, // x^2^564
+
+{ 576690764083835321 ,  1599256285565530618 ,  2190153512650979164 ,  661461670719753230 ,  117238995978345755 ,  2028512694875469843 ,  876139066794458659 ,  98402346592906054 }, // x^2^565
+
+{ 278306186614297180 ,  2250915093650107509 ,  622196208929420096 ,  1992004681324174235 ,  67596080451851560 ,  2127975088292255366 ,  119847526279314692 ,  824151349770118944 }, // x^2^566
+
+{ 1185509644749509077 ,  1107460426159153185 ,  2110911977807325550 ,  2190654641198720818 ,  639273217964265420 ,  914815338768529871 ,  1166871663630302623 ,  1151014401177338199 }, // x^2^567
+
+{ 1879688274510431448 ,  157678056669976081 ,  1713353903836289252 ,  2154528101783866214 ,  86900259867928039 ,  2141783801738611101 ,  1414665400245199876 ,  919664301767044455 }, // x^2^568
+
+{ 2216337927500916674 ,  2143153261939644981 ,  270136755247553307 ,  463529659220594023 ,  1747455859525685181 ,  1970627385267200150 ,  2277909872324457766 ,  2246246142603074985 }, // x^2^569
+
+{ 2264679068366008301 ,  742957292369992322 ,  1156836909981734043 ,  72073428712412211 ,  1259191611612459559 ,  1489507654288183995 ,  2189774118682085919 ,  447744763465250553 }, // x^2^570
+
+{ 1206491539789060621 ,  2043413973143190968 ,  168010247939576645 ,  2037902032346647065 ,  1804331095439397082 ,  202525640601525276 ,  1550204775958751681 ,  750396866490858947 }, // x^2^571
+
+{ 164598699368725780 ,  1507608210534278328 ,  1289560504216312164 ,  2124873956944763051 ,  596686509856262966 ,  294312240265611062 ,  1023899772503572256 ,  2003791995756299936 }, // x^2^572
+
+{ 1777947862862351207 ,  313799689893343332 ,  1773163165722051162 ,  1430020373156177688 ,  1902199895637811016 ,  1601880929897304388 ,  180599459499570535 ,  314345605027111976 }, // x^2^573
+
+{ 1893067360988349008 ,  2123042860920259207 ,  464157624373338758 ,  1125506291626821873 ,  242167674867627356 ,  1205183626311785196 ,  317391449823237395 ,  92908082338820863 }, // x^2^574
+
+{ 1429202678422014938 ,  756282637172721283 ,  151262992099175593 ,  1331965738626856126 ,  773937267524801313 ,  2085160360710323287 ,  1099086567114626 ,  354891710280208214 }, // x^2^575
+
+{ 1928508573008239562 ,  21039260624803203 ,  255570839647383618 ,  306183975020543044 ,  2053907686620800894 ,  1900636120160709790 ,  1403834215445324450 ,  2250859948334399068 }, // x^2^576
+
+{ 787832141946292183 ,  1836569709300718583 ,  514169775242175272 ,  792279260241509194 ,  1514617613211047452 ,  1080940176498716924 ,  2151011240299568927 ,  820274829654535625 }, // x^2^577
+
+{ 1823728933968846256 ,  50546213922947053 ,  21579958768751060 ,  1664721496503286260 ,  1143074006639806366 ,  1728203775953049679 ,  413729628565883590 ,  1121571613763546511 }, // x^2^578
+
+{ 1957157379280035821 ,  911968549609607933 ,  266525803389719391 ,  866645285889945993 ,  984415564091483604 ,  1597032190939285272 ,  599903748189403697 ,  1084578015692123926 }, // x^2^579
+
+{ 1673340407659905207 ,  2206175655897997929 ,  310267764103281004 ,  802915625959087590 ,  442396825781263573 ,  1203887542696014186 ,  815642765091054174 ,  1943588693355135233 }, // x^2^580
+
+{ 2093578467385304685 ,  305180812741387050 ,  673443906877921482 ,  702791198870925704 ,  1508829307429116920 ,  1920823086697987098 ,  397407173282142731 ,  93675757432523628 }, // x^2^581
+
+{ 853456072596524201 ,  2089335322936437165 ,  1549494136499069588 ,  1706781565827869087 ,  1603841236304708115 ,  608161365059510015 ,  1783442724680744760 ,  1685212136390889304 }, // x^2^582
+
+{ 360699608867091299 ,  1231625871767124820 ,  1780893181610958309 ,  1075925233229593 ,  1159200117939839301 ,  118922260936079512 ,  1710802346176293589 ,  1909241730251834026 }, // x^2^583
+
+{ 1932023438174952001 ,  465457024460566408 ,  2265671890440584591 ,  1607360757933360636 ,  659682298404170378 ,  2228319913479781555 ,  878360350480522522 ,  273236295299612206 }, // x^2^584
+
+{ 1474527058663108673 ,  1949350250071009190 ,  299751378748678608 ,  727658079650850725 ,  1962446121357771804 ,  252864621553759051 ,  1596556715950024914 ,  2020461817144139369 }, // x^2^585
+
+{ 822976972822484286 ,  909177926346576843 ,  130881206289603341 ,  1669978549823971781 ,  766814009515669089 ,  56887199941885391 ,  1068091412816754100 ,  255022471632315383 }, // x^2^586
+
+{ 276782371478944141 ,  1863259537321220263 ,  1046090028586172547 ,  537549490014756048 ,  487465977804709627 ,  1333463895092997936 ,  2049548446014039789 ,  880940834251704 }, // x^2^587
+
+{ 1257004959215721681 ,  1073185237481998361 ,  1022292045537722224 ,  985641623969646222 ,  1279158228233429744 ,  639725486966929371 ,  1267821216053116569 ,  1458435877454009780 }, // x^2^588
+
+{ 106737647088161202 ,  1137838916673493248 ,  288068793224616525 ,  1328516182598851260 ,  2187591977971423428 ,  578572328694886907 ,  161039108321952315 ,  2062270089533470905 }, // x^2^589
+
+{ 1461346723088969916 ,  2190402973798746204 ,  2304342709270892057 ,  1433367739889901094 ,  1528739871003402778 ,  258625654295220516 ,  1178830486024403127 ,  1985493518020579120 }, // x^2^590
+
+{ 386899622787952911 ,  445604428889392980 ,  365990464914299927 ,  121827245889560740 ,  1083963629710990566 ,  1422791624245658531 ,  516718350216614226 ,  718758457895796061 }, // x^2^591
+
+{ 1114136138427427634 ,  19694900548842691 ,  1879019033491501828 ,  1704368253051985451 ,  226467689457057672 ,  1188526875650628910 ,  413909265273433068 ,  1374264397451169962 }, // x^2^592
+
+{ 1646547042823772376 ,  1291785498746086402 ,  1267226188144475123 ,  1529753657024298410 ,  2208491504027498708 ,  311199319894647305 ,  529287941153563740 ,  1660053222342407279 }, // x^2^593
+
+{ 230608662066996671 ,  944878443467902887 ,  677544152830816654 ,  117780800911881894 ,  2186780311548344428 ,  876565697188421752 ,  1780459214225260544 ,  1611768045212977000 }, // x^2^594
+
+{ 2018912205877420832 ,  1667598552173127209 ,  2137738055192746122 ,  922045873832805111 ,  1510378370871795573 ,  1703011731703915382 ,  505687886016784355 ,  277524345565141754 }, // x^2^595
+
+{ 1734221692903580826 ,  167145126955069475 ,  412156674730658032 ,  1438293965593083221 ,  246656994754637717 ,  1372160572654246048 ,  2143027935061865861 ,  2142425864075881259 }, // x^2^596
+
+{ 2136682223005996504 ,  1154567228550919781 ,  419757615516042074 ,  155116647312254850 ,  724183633817751777 ,  502869264679213528 ,  1795908323360659985 ,  2061366236399331594 }, // x^2^597
+
+{ 475035596786124552 ,  1897639360455633372 ,  757261235453463598 ,  1799243849528173406 ,  320365857251403016 ,  2276026911590109736 ,  162248589212085170 ,  1673792416573148881 }, // x^2^598
+
+{ 1886397625292788618 ,  1992454577782306585 ,  2234252482231083093 ,  628200235078858892 ,  64922991417968411 ,  232930005802927677 ,  621220339503433204 ,  84231599616149750 }, // x^2^599
+
+{ 441387759722753645 ,  1916315893688321262 ,  1182871935071210208 ,  762837411768283370 ,  30329984137023887 ,  341025210165951347 ,  1425126377852546654 ,  1125489263877633047 }, // x^2^600
+
+{ 1985699671413026791 ,  1662474302940564341 ,  380415517651703669 ,  1367218448077295037 ,  1748376335414623454 ,  658592412511402466 ,  292881166928105893 ,  338760377419173205 }, // x^2^601
+
+{ 282234664481247448 ,  1926528213024057582 ,  2199258793415333132 ,  1460028995175218594 ,  515458120836194571 ,  227173937104006768 ,  452205935282471152 ,  245863531405783211 }, // x^2^602
+
+{ 1166710436626564850 ,  2095675966975198796 ,  1893239143635114577 ,  638506901535122189 ,  1715440803041906795 ,  835962989884037619 ,  203208957714580145 ,  1620942307329455731 }, // x^2^603
+
+{ 2245782182787432661 ,  1250453644367248860 ,  1186925147469387313 ,  1644826344133902625 ,  1920998340334566236 ,  1126811804927885529 ,  836538439271060635 ,  1325866125690895008 }, // x^2^604
+
+{ 188374175640712911 ,  552690414430585833 ,  415920108388761576 ,  2168042369168067248 ,  2189938234550441229 ,  1346371026928357692 ,  1803227037736590684 ,  1934588208663557493 }, // x^2^605
+
+{ 33461407695464162 ,  2164492092647597038 ,  1344433529542264008 ,  770607333550005833 ,  1062977854901596913 ,  726550426794116911 ,  2122087688482625902 ,  2100277454790899648 }, // x^2^606
+
+{ 794569499413684189 ,  1945950069152500590 ,  2147785553839194600 ,  725153244868178645 ,  1023538733611676051 ,  187744021720016048 ,  310393697106154633 ,  984889648065416272 }, // x^2^607
+
+{ 1840671085407545785 ,  775828813330371974 ,  2041396657967534873 ,  348999897186360591 ,  936111410181037480 ,  1500061150915662252 ,  1766963979543287503 ,  650495976386072622 }, // x^2^608
+
+{ 734431720012182480 ,  266789716782519097 ,  971778857959525325 ,  1238911049921742979 ,  1883569352648434186 ,  362284992758126025 ,  892874311866737710 ,  1520192342367283986 }, // x^2^609
+
+{ 589671638398256093 ,  1422695742149122275 ,  2047902174823760211 ,  1626020197954592326 ,  875851932317286354 ,  2041408994037921776 ,  1280672727875171460 ,  1119695656269333225 }, // x^2^610
+
+{ 98102082152158650 ,  1083935428086216481 ,  723077762102903781 ,  853986157678277701 ,  1763904013639733177 ,  1156226308656806630 ,  1953890102777315401 ,  996052195821693670 }, // x^2^611
+
+{ 2211843622386016722 ,  156782834009586020 ,  30480731845106524 ,  386453411388217646 ,  707918685370034414 ,  774254494847309062 ,  834806504416889059 ,  606162835620652400 }, // x^2^612
+
+{ 863853852633755029 ,  1409610280375977633 ,  1882506873202568022 ,  1671087730433821562 ,  2223089677957345987 ,  105074862017990896 ,  1506345203345681176 ,  1272711962282315927 }, // x^2^613
+
+{ 1859997860785399381 ,  1957758931251281010 ,  669957099565589418 ,  1263483936923156680 ,  263992046251087529 ,  963359295075360546 ,  1244119670799295361 ,  151879462080665590 }, // x^2^614
+
+{ 1991422238309036610 ,  2097331064100121005 ,  1893029543770038810 ,  198342647129533250 ,  1220211666191012567 ,  1193709987375767267 ,  980353749043163770 ,  237293706017799887 }, // x^2^615
+
+{ 2172096222515310169 ,  1171178326496945072 ,  1002235365597521568 ,  695853196282012879 ,  487910789769635897 ,  2221334678001998931 ,  29538932278975214 ,  1044217502575245201 }, // x^2^616
+
+{ 1524792009249908809 ,  360495565870863131 ,  1027725135158679958 ,  2138115321875553731 ,  1251776723781463648 ,  1524918571475854613 ,  1112828747514574918 ,  295732392268241700 }, // x^2^617
+
+{ 480289748558574919 ,  935603127668855015 ,  1926494834777173595 ,  547319142702176071 ,  59721664766440786 ,  361519643435512959 ,  2103341593455869811 ,  1131261188673886412 }, // x^2^618
+
+{ 996651921667206200 ,  1476144153794714020 ,  1786071360132463482 ,  1542044364203307556 ,  1742854006661908531 ,  978625273020840051 ,  1744728173250806523 ,  2278997278937668279 }, // x^2^619
+
+{ 167451055834710864 ,  1866227088886134947 ,  2085834611254269860 ,  62409957797098885 ,  2275842944704356967 ,  711897294745053421 ,  2228230221798002512 ,  2111677835683208136 }, // x^2^620
+
+{ 279103755401181200 ,  1156354291925391524 ,  525611391221451658 ,  362854996619328390 ,  595660692634099836 ,  776229374188363986 ,  150854304785281775 ,  422576870717539648 }, // x^2^621
+
+{ 1151617259446297688 ,  359742984143408242 ,  1908153365204523891 ,  536898494535647689 ,  2279320322961828888 ,  337332385501735091 ,  617588449156166942 ,  907888615488577804 }, // x^2^622
+
+{ 499398776109346311 ,  1261933585203454508 ,  1157828841371723528 ,  331442493713432421 ,  32354114497919504 ,  1322195321361816963 ,  664460343223655719 ,  1165426217605899391 }, // x^2^623
+
+{ 2267909070925977063 ,  1403585138172470660 ,  1363585204366709562 ,  1126163768686360765 ,  700862142299096809 ,  2281303462154145436 ,  66573956322163805 ,  750791027647390793 }, // x^2^624
+
+{ 159134521432405747 ,  2046602309023356481 ,  849320703761058333 ,  1576406373282608821 ,  1724405850045736253 ,  1254390110226149502 ,  204511789701456220 ,  1284661778447155335 }, // x^2^625
+
+{ 236037124735484482 ,  1143427344091208207 ,  2004655259632703252 ,  2082987460918364521 ,  1011141635658247825 ,  1550432851402132359 ,  1526483699972118724 ,  1066384564396802424 }, // x^2^626
+
+{ 928621428739683478 ,  2077288100764822662 ,  1793094634754903588 ,  2206421317293810545 ,  816428533302006927 ,  158256786799712323 ,  368607261465682844 ,  1645438260995459213 }, // x^2^627
+
+{ 1722038147953808131 ,  743695967805520973 ,  1803013236061218988 ,  1893213070749632584 ,  1568327946132124128 ,  1382476708802281775 ,  920054506254183413 ,  1276603993533375641 }, // x^2^628
+
+{ 551373148386142702 ,  1703853249346174805 ,  777830980179333106 ,  1482900405865734388 ,  404671338951047546 ,  1614172823595712665 ,  2198896086377857071 ,  279319079437678510 }, // x^2^629
+
+{ 2001341004659347530 ,  1116177819151152158 ,  227252307490468117 ,  1785079276600121923 ,  2235719676386534994 ,  1541375924873867085 ,  676572166972383751 ,  1289838344037464512 }, // x^2^630
+
+{ 248387527880512279 ,  1996536771224087030 ,  1645849766514687576 ,  1722045773083649147 ,  1886860291000895275 ,  1581811627177108371 ,  1689054677171967040 ,  769663214772703274 }, // x^2^631
+
+{ 384238510744704815 ,  1824995069029368879 ,  272422117922131725 ,  2245514862309961320 ,  916616903006790862 ,  1587499731667472349 ,  113621395637783955 ,  643048963266600096 }, // x^2^632
+
+{ 132096796212969263 ,  2238596912353820084 ,  1320155048143411330 ,  494595427882547421 ,  1027979334631458501 ,  1263394384261973721 ,  1053176280083110780 ,  2281546980743583004 }, // x^2^633
+
+{ 407651354235382639 ,  1256721181730023047 ,  1589672478910068908 ,  1928469498278245159 ,  1134367973409412049 ,  1702206395395704850 ,  485709170290933058 ,  1992740699641192904 }, // x^2^634
+
+{ 1742702050951811030 ,  1931232491336894931 ,  1703878079908639672 ,  813326742365837212 ,  868031095786701616 ,  1526119396101894222 ,  344638959046949694 ,  1883858708924622882 }, // x^2^635
+
+{ 203445361236061681 ,  273446373567228999 ,  2068351945555714266 ,  2115180510981233965 ,  1547918767268064158 ,  1801163431263064391 ,  1768470083628043440 ,  136011603748772598 }, // x^2^636
+
+{ 2156630765007528839 ,  1237209473519300014 ,  1562406961869407697 ,  73903487678374356 ,  2050612981806353791 ,  1261436591918783812 ,  2205306577378392968 ,  1784212951586946629 }, // x^2^637
+
+{ 2099525876680808350 ,  1073427673637866030 ,  1402861411257695845 ,  47017146795493607 ,  752122598629529090 ,  1646748235123922334 ,  621461217950728335 ,  1382243543454989265 }, // x^2^638
+
+{ 1782024452275751764 ,  495109764930512651 ,  1442274806810843334 ,  1590963151453820836 ,  362542958535489452 ,  1311852143021550176 ,  651574155320860135 ,  1593656822916222357 } // x^2^639
+
+};
+
@@ -0,0 +1,275 @@
+/*
+ *  MIXMAX
+ *  A Pseudo-Random Number Generator
+ *
+ *  The code is released under GNU Lesser General Public License (LGPL) v3
+ *
+ */
+
+
+/*
+ skipping coefficients for N=96, m=2^55+1 and s=0, low to high order, a0 + a1*x + ... + a95*x^95
+ made by skipgen.cpp
+ */
+
+
+{
+
+{ 1436252762587014688 ,  1967703393894019713 ,  84546655927764481 ,  1334100225958084130 ,  2108765934618249414 ,  167439610695457498 ,  1760931820858094017 ,  146492667037090114 ,  708292326710145868 ,  573733503725789809 ,  2201407073586018473 ,  908665301424105817 ,  201684570697277457 ,  2268649403709047681 ,  156932061875535471 ,  821280874583085286 ,  1998673826692844021 ,  1971630782052446253 ,  237232345707106384 ,  404844569157854867 ,  2269646806020120417 ,  1608385966722664121 ,  675129903505272446 ,  661232188475318334 ,  1361032101744735539 ,  41419190120314833 ,  637276982617269965 ,  2187392502387247135 ,  1153941630386284238 ,  1161425194082771070 ,  771974866696616794 ,  1968319055233370200 ,  1800316470098376832 ,  1355286559319134551 ,  1473456046217103971 ,  1783679050482207998 ,  1532101760375563566 ,  361505148019663773 ,  581482117811430005 ,  1366462803840225804 ,  1895009371927143240 ,  1277470352477836817 ,  1955341248778462367 ,  1830229539619315939 ,  930905164128674754 ,  2145447005214808163 ,  114020182242835293 ,  552567415145574962 ,  951645530138250182 ,  455778622805738861 ,  332965369485284530 ,  1141946846765527477 ,  2109014203835914053 ,  1423520517955508481 ,  1493700907009182957 ,  1579961158078719413 ,  1348691981877897961 ,  1786628137223078726 ,  1686003682306391718 ,  232760231963354379 ,  2237804811943010744 ,  919562233385736394 ,  755674456467888345 ,  1896373969812168388 ,  770214589129074525 ,  1489691590118409355 ,  1462973238903347634 ,  983090118361529258 ,  1321985222704453914 ,  718366803181494808 ,  944579847375164074 ,  1471216530284530464 ,  1100993534313954529 ,  2070926690034831206 ,  1251699123383724773 ,  1989833025171991324 ,  857327342821812538 ,  734870406602882411 ,  1050301606536363063 ,  223460120716135815 ,  1220450939665270601 ,  2130922179215265266 ,  2301480878921639692 ,  441381660419862144 ,  1202682740632952544 ,  260257918468871665 ,  529218783199586825 ,  1461192828804267713 ,  1831839430373556436 ,  1514394382008847573 ,  404089197640041456 ,  1172938583201179167 ,  1794255667585631468 ,  1811216197236571822 ,  1407372257037165276 ,  225597041531830047 }, // x^2^512
+
+{ 2108329371620122833 ,  1528417868500347966 ,  1067247383893702960 ,  757808724992774500 ,  2220273257750819737 ,  141613452062466754 ,  1987107777153864539 ,  527036468505219635 ,  1890402904315665493 ,  304511250165324465 ,  2104466563683535460 ,  648390373805674644 ,  983552822719588973 ,  272557805632068617 ,  561723652611883321 ,  1572833431619264725 ,  1559150797947366564 ,  772844393430419102 ,  1677077485261988487 ,  602990060715342089 ,  1384388680367781466 ,  1635094557140690979 ,  456506328440119592 ,  1731136829137633726 ,  1383380947989977200 ,  1771677769481613189 ,  219202670809719362 ,  1642301069885360591 ,  422138014825656032 ,  1036163938011959336 ,  1896420184334583305 ,  1999415326313554942 ,  138232529353818216 ,  727558609421159987 ,  1413806666362603408 ,  2068915161700362767 ,  530800912390097861 ,  276565740796427614 ,  1301245705080745534 ,  311374321817084734 ,  1858438320969649973 ,  1000672021947850085 ,  1955699585081036120 ,  398553262941792877 ,  109828210573197928 ,  444790799895548647 ,  1021910503533699552 ,  904271983695925025 ,  1037087072251902032 ,  1589412777476146611 ,  1394751685117451189 ,  1965565443922440164 ,  2172689378252779740 ,  187436340907388668 ,  769277914526651170 ,  1642838352295152918 ,  911441526543652902 ,  2162427487918747879 ,  2286125361838881513 ,  63893333679317646 ,  430850089989657671 ,  773560289262054419 ,  1704318475948958713 ,  1395425915250982967 ,  308190124559756037 ,  303440198908905060 ,  1630612156278852599 ,  2109331678206958367 ,  1641383523186614160 ,  2138827015949338005 ,  762018949823847211 ,  283346374714762934 ,  838547206104845675 ,  1025870536212923157 ,  1995352394366727458 ,  2182384126274467023 ,  681832447647037100 ,  974675776932949482 ,  1038227036431867697 ,  186791038034928392 ,  225230268449617895 ,  1863009119624443932 ,  493468335749142144 ,  903023399063636547 ,  42226925635988613 ,  23994003845152326 ,  1971417546862842231 ,  2204776224779757969 ,  1869696680908031245 ,  964126964078125809 ,  1754835097767154688 ,  1984625493103909108 ,  930349963711126908 ,  1052102483447772227 ,  1100454141399885330 ,  420561943209056907 }, // x^2^513
+
+{ 1441146373978139244 ,  2192904935781895309 ,  658098016602656781 ,  176145714498866753 ,  1997478638730161371 ,  302830191294296023 ,  2082369777746661549 ,  1602268995033204029 ,  886858897409064362 ,  2294955953793973945 ,  1452436740459549791 ,  1036756297541932441 ,  1962751393160077321 ,  1303196538304349450 ,  1373014946451099171 ,  925652364711371399 ,  392340491904451934 ,  701816221373247895 ,  740900957648576030 ,  965728512771349270 ,  1421067234756825178 ,  388125444211349597 ,  2092721625678550276 ,  948907871269480936 ,  925573095408708970 ,  1247763862897167020 ,  119066345668132615 ,  1765449309229948114 ,  490456607832666777 ,  26189733037031302 ,  1315608670365302617 ,  1144808683286319241 ,  78177320194569887 ,  1101189467367390410 ,  2102104469717338979 ,  2018375398021361833 ,  332049308423798757 ,  1221529070317121287 ,  395979033937254112 ,  1416208298400460077 ,  96087588176171089 ,  2026833878493964194 ,  890485488340372857 ,  1849137628203891258 ,  175973816894223260 ,  1781187941786064744 ,  356747142140538541 ,  1923109833232548519 ,  41214061125005068 ,  1629365010859841285 ,  17364169676340544 ,  1797010751325938872 ,  1969212925594640501 ,  38692908314295645 ,  1266567598688187254 ,  1981555014114654077 ,  2025674894445124953 ,  1641598862023761919 ,  492345646264012644 ,  1103469015621460030 ,  2219939163564706704 ,  211557013946119396 ,  56561207760772406 ,  987711587722463900 ,  1723661824641146233 ,  960767846774892877 ,  768782590919764397 ,  159517676523988897 ,  762097879499269043 ,  504903059434686691 ,  1028461514311782666 ,  1176871677148833349 ,  1311481599479210787 ,  2110212571321101906 ,  236462129664143720 ,  1092226461917337518 ,  986548461812702006 ,  1413029403544666118 ,  248448584720153514 ,  1829639722805957995 ,  1879982393005988103 ,  166042168825108279 ,  107109429651579513 ,  1796513155990473565 ,  2084268090172953068 ,  1606756614762937663 ,  33049429929739557 ,  477900413820264193 ,  1846155612082246954 ,  1351421689866866129 ,  1097416098253382142 ,  218247514409999787 ,  1519508136304532510 ,  890503975351217882 ,  1025023472283335492 ,  1535394805652729463 }, // x^2^514
+
+{ 945288983877149445 ,  1919290204647906441 ,  1149266658690171118 ,  1368894823591955191 ,  1764938164962911844 ,  694573106411997911 ,  1056673142294053788 ,  487671010469890814 ,  1454799113608651355 ,  1808179841303376579 ,  1349931124065852752 ,  984409685735758594 ,  1541843327586237680 ,  2083801467895796975 ,  1966480443655719384 ,  2252542821463144053 ,  1708447645686619335 ,  867301796821572114 ,  1096932607065468948 ,  1116481394555353299 ,  632303785108550085 ,  1392126469735557480 ,  1183722204137219695 ,  1802697309076984181 ,  1231963651771492367 ,  835818773587204125 ,  1079858924804715881 ,  231348116037848866 ,  417763023660467059 ,  1057062022633616387 ,  330046665956209682 ,  2093475020513137546 ,  831610629757077933 ,  575760454362866992 ,  1930103234497038046 ,  1762564610807314019 ,  2178204276764638337 ,  1690533610238173700 ,  1130198580968567690 ,  1735798078316995790 ,  1025412690241332101 ,  610413877105981525 ,  1209687810620048872 ,  983022745478814341 ,  739874079198575245 ,  1938478229174380945 ,  863505076664388786 ,  1976519060937480105 ,  1839349039105409367 ,  971317648932723176 ,  401329395577990984 ,  2197915547965208072 ,  1777393194225024940 ,  1499851598857716905 ,  1709057566972179336 ,  2157453997379583253 ,  689282242523639235 ,  73479712679945007 ,  235387510832431688 ,  1840387618968016957 ,  1187298874401937660 ,  1101356105881758106 ,  2046201979142033801 ,  955352549111864520 ,  968038304830366952 ,  787999194254183145 ,  122723402127061327 ,  1119857967066573008 ,  2114651459582764040 ,  1936365292189041503 ,  1060494959541293918 ,  1875880391613862792 ,  913268984999413315 ,  1369917608203012978 ,  1714415407442537249 ,  584260253731474937 ,  336732342505628784 ,  1051230573280720638 ,  1971919040236723760 ,  112308485148964945 ,  1621847074520745078 ,  208254710542516053 ,  1267711231107683129 ,  1291305167669182892 ,  311666766852694767 ,  1973924796791321992 ,  419073303415028759 ,  1075321690821702046 ,  2112073307174388356 ,  1533004198321979727 ,  2105401504025227115 ,  1094128638481704684 ,  1738011163198142918 ,  1495968528701950601 ,  2035278678607862326 ,  2201651334101073384 }, // x^2^515
+
+{ 1956496030256428717 ,  234659008802298699 ,  1138659127454633649 ,  534056061045207905 ,  1565598873671071455 ,  1824806214165781572 ,  1088566633321281961 ,  1438804745851811460 ,  798274799084830046 ,  1194913452610915886 ,  1790055741504904835 ,  2039916598997520865 ,  2273557061442675331 ,  2142630550578976498 ,  1826135014164921051 ,  1168594285901163673 ,  1021852626208710053 ,  698332405952282813 ,  1742672060062151660 ,  537568748129634449 ,  1398398695518672578 ,  712807418888818267 ,  772214308594095571 ,  2076058837838329941 ,  2251941777968348287 ,  1701338015074761200 ,  97700435221538017 ,  81084047512151617 ,  1983620895987516440 ,  122148492758040350 ,  250240094202131641 ,  1219673588293996499 ,  396469949113491943 ,  483542602935761308 ,  1709116450881346529 ,  1203020517459464903 ,  2175103768659158585 ,  2101031456113736702 ,  1432702139492999167 ,  24663856386185973 ,  1763689862464696174 ,  843916233139382660 ,  1262487354246040192 ,  1188821881803157147 ,  414592194772867043 ,  1835244119006199305 ,  1097617083780359078 ,  293722232610647970 ,  741446666135388824 ,  591840159866394109 ,  1864946311519681715 ,  242075595576960194 ,  1314832923602015131 ,  2285408880254778801 ,  1063618853638385422 ,  712702106590040909 ,  407852391234839248 ,  865115313456000319 ,  1485662261863116001 ,  1033190712045840037 ,  1271518494026556622 ,  1236704046145468310 ,  189295513891073432 ,  1735815344892080576 ,  2131922100438634839 ,  2297473568221990916 ,  1108974203806536688 ,  964191295739456358 ,  1342144815951545868 ,  84887253402981722 ,  2052032523285972337 ,  2194059836071310792 ,  2019084330501424119 ,  1763295189017358866 ,  839150032259353446 ,  1835732680121457045 ,  78806057085612870 ,  2077147958449048345 ,  1370853601252264069 ,  1975718992874510761 ,  1542679060183713625 ,  741741183353340944 ,  217624561920632513 ,  1721615425943454095 ,  1515832580055055258 ,  1974729543755298979 ,  1269782693411740800 ,  1786687830725981575 ,  1184677271343011865 ,  755515334270652359 ,  663216896802084145 ,  1607556512394486455 ,  2273727239438474876 ,  1730914402349505215 ,  1673226595673515623 ,  544779076158379186 }, // x^2^516
+
+{ 889566409805783966 ,  2008270561352832554 ,  2113484823133383746 ,  945662271768443958 ,  387935633481405611 ,  2180796392232857226 ,  1671621367399288520 ,  1603389898197715168 ,  944594118918120785 ,  1313703147561802839 ,  486095297739150621 ,  1616846875233688620 ,  1540102437165306024 ,  530231813765668008 ,  950936322792996910 ,  513797684972574844 ,  1582090022238627011 ,  944274566391137998 ,  2215001307845322136 ,  2146856479517611301 ,  1667859075090437228 ,  55116009396325772 ,  312233196974093053 ,  2026977622413855627 ,  451863365235127178 ,  1522564428808810646 ,  1768485845739526989 ,  682869022962199856 ,  468219753998652091 ,  2278319542472293087 ,  410963840426530184 ,  1639935427582133145 ,  1216486141438634929 ,  161582686549300617 ,  649555325975355557 ,  981037420083875314 ,  2037659681228723383 ,  692224374648702582 ,  2169627118974533680 ,  1912597111061680256 ,  1883054774457014267 ,  260832601511255160 ,  862697670937824584 ,  293951618304699701 ,  887805305232351037 ,  371070508814360580 ,  1914561234086133891 ,  3433750178940079 ,  1702646158989300983 ,  764075566846832643 ,  801645102400553713 ,  1925547919091098671 ,  1140036751590915015 ,  1916295674295766349 ,  356677528545709604 ,  1890625680048211929 ,  285219917727153347 ,  146206253403730095 ,  1947794571714947741 ,  36204390447735293 ,  1497097591350462224 ,  202836710923843414 ,  842520637729309975 ,  1230423660506099834 ,  1955350995097958834 ,  224567399963027419 ,  1758550808925280322 ,  608042776688982899 ,  2047576101113643052 ,  855485773476089279 ,  189902090940840860 ,  1006050151716613889 ,  2073972380471194327 ,  671246223900424960 ,  662532407293531833 ,  1246267832052876353 ,  1416936728253342651 ,  323043904964950404 ,  1382472770063321332 ,  1945706087875630923 ,  1155551079312594241 ,  1357554910976025918 ,  451425971803188629 ,  1167576070456326143 ,  913296335957888127 ,  901089595327799116 ,  216044317624708026 ,  1969215866111697371 ,  48913421745717810 ,  1698453278306426657 ,  1057448377670295709 ,  1003097798057806309 ,  2152869258381817485 ,  924576537062498525 ,  1345710201556332882 ,  316303058986005340 }, // x^2^517
+
+{ 1767184830604490230 ,  1953093103624745127 ,  1660915485049440987 ,  1759635963020985978 ,  310509105776845052 ,  611584252340428213 ,  291383121508944219 ,  1824436648424087998 ,  641683863964460583 ,  1205055872802947162 ,  604018536697804025 ,  1349066148762377443 ,  961039129643606387 ,  1682383215899579942 ,  967236234832844989 ,  1475753899329331669 ,  935125215181296990 ,  1123089008251573183 ,  915087451962135835 ,  149762481960416765 ,  1238402525400641524 ,  631439852617658080 ,  1330660956190294173 ,  957446252270394167 ,  2248366064306736737 ,  572149927699317684 ,  1418282347669713455 ,  1731554277695539085 ,  1045732654472601387 ,  1504455103765934225 ,  397530367847540321 ,  2227348238573761922 ,  5826621015348043 ,  1201160014346559145 ,  151151431364481244 ,  1792729853150893831 ,  758203044853992766 ,  2032979551607049009 ,  212816193987945221 ,  1330983691196891627 ,  343953452186736229 ,  684099108238087616 ,  387296728750058382 ,  955968475295498231 ,  2274830862640889088 ,  1101635322384072987 ,  525458230438267396 ,  485476420716889582 ,  1593058988745736450 ,  1837211739939408288 ,  690697527925236467 ,  782636275716158653 ,  705003430373414044 ,  1870920345694853810 ,  1104472197615138254 ,  549870722569627684 ,  1707257230174482637 ,  308496429429511687 ,  2103340720005327400 ,  1847861369412066764 ,  1577861869245069412 ,  1516249566916806125 ,  67943943325455266 ,  1860151150503038052 ,  100656740494300600 ,  1032183239668992852 ,  606077334082240362 ,  2036491354436251982 ,  1534247129177213068 ,  2016093111547995141 ,  467749813636663625 ,  1780453015372627637 ,  1261179478717533182 ,  488457173138751070 ,  381601234053861360 ,  2025116503777888141 ,  930276499964551601 ,  469466266586112357 ,  332376272438368717 ,  437593103855504151 ,  1918712879670974141 ,  1161829367500866187 ,  450289674095636060 ,  734799094385597589 ,  707141466814812313 ,  1108762927459324898 ,  155744668067296994 ,  650528172269434873 ,  932358388143201072 ,  712815388792916583 ,  1345037830967429774 ,  1836782526320956813 ,  1953087301232790973 ,  1877407324298759460 ,  951174432112515411 ,  106710197516580971 }, // x^2^518
+
+{ 1964366123055509801 ,  773608712357866744 ,  1782603688912185177 ,  556431347632505788 ,  640230480793120710 ,  176669865021012082 ,  53395995258697063 ,  1473321963070486560 ,  900862787942918366 ,  914323872391021037 ,  2147620680114706932 ,  25864442451257336 ,  1789351295976809716 ,  871980137133196163 ,  1909082021565836408 ,  1398036914822441710 ,  2083924776861582172 ,  926831019532587358 ,  1083148297278265807 ,  556910956258768020 ,  1889014714854128898 ,  339327511449414316 ,  1850752138657579510 ,  1922177820938545579 ,  2116172819555054774 ,  544552283600575840 ,  958791816318495660 ,  1075433238721647446 ,  1656491626424751320 ,  2201082768217234873 ,  607334935096584694 ,  84979974303708643 ,  1594658539723810617 ,  2016173192126631673 ,  1757985347110243578 ,  491916554611434413 ,  1402810068640696170 ,  1222839094925343008 ,  2149206512851264026 ,  1401584218808905696 ,  502984787801451733 ,  1248242071873264638 ,  1333346804608683996 ,  1408758526339358250 ,  20281432304620560 ,  1101403447584476551 ,  165575994682476036 ,  1117433400630074780 ,  197791113808782796 ,  1682286164952699251 ,  1721919757303323524 ,  2180865488403991432 ,  480617658121311273 ,  2196293973492367167 ,  228278666722149909 ,  377128063972442426 ,  859712081917712376 ,  1578939047220913605 ,  1487237760691250709 ,  1897022922564574232 ,  1440760930647062953 ,  2098663523621078113 ,  1229956198360099597 ,  205272418578421524 ,  639782825441984647 ,  136237091388077222 ,  117562042492841397 ,  1795574601821408620 ,  410317915487629604 ,  603449048312682495 ,  1658925205926946858 ,  2216126893778812700 ,  334168657582514472 ,  1334594656791245144 ,  147170936312078798 ,  1849512246741052247 ,  531603296191699293 ,  806943082056398615 ,  1957695774396992295 ,  1501863509981122761 ,  1195227284926117687 ,  2037672894009947831 ,  1674579308753178151 ,  886351109234917945 ,  835118751188854041 ,  2172126176577908173 ,  2154111347777377964 ,  2186646536683461745 ,  1118324551126437375 ,  1053660479926979746 ,  1904398389093921645 ,  1189279071073213808 ,  789166473436795646 ,  1313652097506620899 ,  2130037207381432787 ,  1724802971615613178 }, // x^2^519
+
+{ 1076572885501658331 ,  1736819230498892050 ,  952970814918670189 ,  962945498123478971 ,  288515129446819583 ,  361244760111480886 ,  469889515282173068 ,  1092678882261698866 ,  5292128219331084 ,  2025778911087434395 ,  1417058239305753581 ,  1376079010695587843 ,  2200026182865105594 ,  966167204088100732 ,  409273113085175328 ,  485266821691484433 ,  1142044517677226779 ,  978094243069835094 ,  1447275848105875003 ,  1544606554624241906 ,  329657891812588543 ,  110518782451732093 ,  1285213462191421986 ,  356694266495975633 ,  784336817667680032 ,  1177860231760664972 ,  1631743847818859031 ,  684517218200823385 ,  2173674268751489489 ,  611807933115593495 ,  2101329269281412462 ,  1633469460991460289 ,  1751932386384679482 ,  981812353119450758 ,  667900569101155929 ,  1029951859680270764 ,  344645803593127279 ,  348997359345270140 ,  2044790828409740848 ,  1112789271252649671 ,  1822947418327085599 ,  1360486299586312511 ,  1827247694136156099 ,  396027180895166334 ,  2142058281789219671 ,  1414423369664439323 ,  1420568047899145916 ,  1455659134304237326 ,  494084580025935112 ,  1666094566172257623 ,  1791816849782828652 ,  1836282477719177633 ,  783392813288356304 ,  2277010562917900405 ,  933409003006456742 ,  1300498736186660258 ,  2059222940203134915 ,  536971648858166590 ,  844183296714400900 ,  1063511070079470347 ,  527873370465170688 ,  1211401478736317266 ,  794264505152685924 ,  244561148019789174 ,  408894468788656401 ,  15172635257119641 ,  1424303824080392859 ,  461001229512023160 ,  2116979117483652134 ,  1269459495453092993 ,  1060525059484230697 ,  1721940925460499398 ,  32985419789978096 ,  1021501637964316263 ,  2010117942065293052 ,  867610796575827145 ,  1229157572513905377 ,  2207688966816885672 ,  1787701640260715946 ,  761427239266268975 ,  1862642343486738595 ,  1809357557170207476 ,  348454718232924978 ,  637640834090657955 ,  1710728577558820586 ,  2154364676906043051 ,  176601183159284558 ,  182270245139033348 ,  2192552308224139565 ,  1512359846825652099 ,  1313329470478854612 ,  665519556922347753 ,  1076815824658651938 ,  850971818041598869 ,  1541555754068960054 ,  1379131027038015240 }, // x^2^520
+
+{ 810786564720087122 ,  2178444630528055993 ,  1272260725865984339 ,  341286332732539932 ,  1448363920081949743 ,  283551057454337648 ,  104261713087930381 ,  1867907775244617338 ,  828687396174013471 ,  575307290204570229 ,  1996643519649087409 ,  1053111057218321582 ,  1704751405545855839 ,  486179686106310995 ,  959411216372815814 ,  786111055533769785 ,  1373529829643960899 ,  800497537367621728 ,  1483776761312487280 ,  783525783187854671 ,  1884114088555786753 ,  1223926015939752466 ,  1011660959731021256 ,  2284537092792229366 ,  2298258226510167333 ,  2076890073193639126 ,  2298138314539039819 ,  410649071251238952 ,  138640896036547894 ,  1587568638133330684 ,  787824808040242863 ,  1419423446527299578 ,  1139722150860196244 ,  804159816558880381 ,  2262627808165392242 ,  2155581378148745621 ,  2006463359843847501 ,  2061138629919441968 ,  1630053344731093020 ,  1721618070558861802 ,  462865111855941048 ,  2283410468272334278 ,  499962051096799625 ,  1914049447729001769 ,  1547918920497661293 ,  1021217420470145966 ,  1568525129448577383 ,  202088265784209668 ,  1346754060740305328 ,  1736413650528695736 ,  2075318051890239428 ,  2267149934681893977 ,  1877467414639797813 ,  627024932573252544 ,  453714202697649349 ,  2136648730682074770 ,  1257234207947879888 ,  1417381457313194817 ,  921244762816935802 ,  565112578099240435 ,  569916004396129912 ,  2228226254380416315 ,  1717321819317839012 ,  1989946292303798310 ,  1897414844737349023 ,  1343117400362659959 ,  1987393485577588911 ,  304439499550886443 ,  487561883184710173 ,  1776537162479895736 ,  590587699053526740 ,  2245328344188464728 ,  1803487700978478518 ,  298231036450998264 ,  1931452873640183851 ,  1068376933693057705 ,  1265432866206808962 ,  547285042822348578 ,  1219235842688690718 ,  1742163937226954679 ,  1152047750671799011 ,  1518804174670462477 ,  685856427691253009 ,  1561650904753743841 ,  1540869951236174023 ,  1242748664521144585 ,  1901927430634776648 ,  1364532930727740187 ,  754854191261989421 ,  617816587652785634 ,  2139163745543843317 ,  2151998442839855895 ,  77762001529024204 ,  2248839508424081901 ,  1053823557728912830 ,  1207328034863107575 }, // x^2^521
+
+{ 592055801208969341 ,  1313901264283630805 ,  286319655888415131 ,  111927473137847263 ,  554063024337143306 ,  2134943503389255105 ,  826569833099647598 ,  1919220191469138562 ,  909357985441626187 ,  60952338647287751 ,  999825445814312476 ,  29439897735512582 ,  1663369767300668988 ,  1321739192632758910 ,  1222982998421194872 ,  856548170875993808 ,  1032493841294938472 ,  896087002474147526 ,  225163943883877840 ,  745761548081286718 ,  845237695816782146 ,  1103384429390329345 ,  1056717793669701159 ,  1513323749653049519 ,  1809388962728534369 ,  1136466675677032805 ,  510055444519051593 ,  1613905893336456230 ,  372418599471615931 ,  1959505010330607002 ,  224868761322844266 ,  1276807452511057617 ,  1588754321634295478 ,  590474300787057639 ,  934184673677236025 ,  684396681404202355 ,  2043031529470604910 ,  303473899324263762 ,  749681417542355743 ,  2174932127101361825 ,  1899841676458009128 ,  1020118092495813438 ,  731422792203553677 ,  86085382934358130 ,  1464244208762142248 ,  1540113399166792851 ,  1450589476090588377 ,  1275172418232626043 ,  1109842965945763465 ,  527462446876485640 ,  352648204701584578 ,  491975857274285572 ,  1003235996737544597 ,  923882021939167257 ,  657129849725834120 ,  222288799955678235 ,  2059289713182958345 ,  1650121244198467710 ,  1730115000897204136 ,  25311228555098414 ,  1072588155824241384 ,  1141172297975178915 ,  33696749230243905 ,  1918964603698841048 ,  1949673604959056122 ,  957173226427917284 ,  704305616510449035 ,  1965269989151984082 ,  557651113091951004 ,  1738942617153459862 ,  432884957360744362 ,  1252174871335863025 ,  524022463594416524 ,  2211853714176424939 ,  1995485772755573463 ,  1666463209208004108 ,  626679809019238862 ,  1928416488436661482 ,  60898549390047705 ,  1796695787270859039 ,  1012350324652045935 ,  541050741381810621 ,  2256167730635758080 ,  264973043758277962 ,  1811966596643381483 ,  580086407040731723 ,  276144581546474053 ,  848342674465114946 ,  2017130127326880951 ,  798142006726695688 ,  460642916994291406 ,  78919049854013794 ,  401085037468185872 ,  576100917849446910 ,  354971038491444431 ,  1678471540653970966 }, // x^2^522
+
+{ 1234674536287700893 ,  883254707784823536 ,  1259091844909485815 ,  1430557129794702723 ,  1804927466423223885 ,  1457049608382395932 ,  2206846805874489538 ,  881861121379646038 ,  1243540892399309885 ,  1775610202924970153 ,  1304515876821895987 ,  1555716245303062269 ,  1652996171594686992 ,  721319828320787271 ,  985681905842268682 ,  1793392519238197772 ,  94889528901098373 ,  2256200243344129277 ,  471932904341726810 ,  531519522435495308 ,  768618695815381151 ,  2012352653789841592 ,  351142840291008451 ,  2193183566292275516 ,  695893576424488624 ,  182693914069335544 ,  2074541362759070228 ,  261711904951874239 ,  1460625342824827254 ,  652903664369129427 ,  1266619555234921013 ,  228651499158243984 ,  318118617780793285 ,  1991442961533030628 ,  1664495824701112703 ,  1077331074445801519 ,  1979019278982897288 ,  2171902081904662405 ,  1461432181856398830 ,  893707775878132434 ,  1865412580962066876 ,  376341852199137952 ,  1445766031494541758 ,  2204935658993128717 ,  1654209775150775072 ,  1628393455274831957 ,  1542852121201212001 ,  514038762179555234 ,  1786155591115870823 ,  1907329289431556110 ,  1582099303942196068 ,  1967833436705007406 ,  1291892625619931942 ,  1024764147005743383 ,  1329457663327853373 ,  1992378240217111967 ,  622837619134382778 ,  1929886264331258881 ,  53935921645271561 ,  608012367927043829 ,  757496132642624433 ,  633147225339127528 ,  397794714616331611 ,  1905787298661007288 ,  1686215097190519511 ,  1947575181530841673 ,  2139591534943771478 ,  123912731073669554 ,  855747233792403529 ,  926303396210158739 ,  1972768170571305046 ,  447683626194165523 ,  467399648299920710 ,  1225156423423001045 ,  577605793357061051 ,  311223016918963171 ,  718437098156128024 ,  1102390530915683816 ,  879380317055041005 ,  1331172249873266993 ,  1739139842157869905 ,  1707162090099541105 ,  2203753733695112788 ,  567039754358794217 ,  1916489144150705870 ,  1879449506460294342 ,  1393727207582471333 ,  9919413289651701 ,  1810426755248852000 ,  632930708688462351 ,  2142526383169117188 ,  1918359884217952467 ,  242639948790008411 ,  423537371806175103 ,  1410808630077007665 ,  1097268811520611824 }, // x^2^523
+
+{ 1807685917756412414 ,  1741946992771777010 ,  1002403391359890804 ,  1031027715448472432 ,  1991097840732587286 ,  2044759009101411705 ,  2107850067354879318 ,  973176410916715193 ,  1251907677552086925 ,  238961762011020512 ,  2186330910022470765 ,  1515362782613507069 ,  931184405849042449 ,  1935035648593387097 ,  1849220033392302722 ,  877502044981275024 ,  283717996976050610 ,  1927494354042688837 ,  693353931837341193 ,  861174359002047471 ,  1913911994564298797 ,  563217093132833179 ,  1097436843359937436 ,  348893567680129804 ,  1910609512855186005 ,  942477622840271805 ,  1385726375757032531 ,  2044054463502963583 ,  1995463704153574242 ,  1862107170395043537 ,  1630623040134170385 ,  1964232403381022402 ,  2005817127807911301 ,  2062137286947406819 ,  2108921992430502568 ,  2027163322760306330 ,  501267792942854937 ,  403749451730150922 ,  2063645544839384988 ,  1129736026372593267 ,  1264464732920145647 ,  1184513484840228076 ,  2031804836008374383 ,  1613278489631704137 ,  2178900337452392189 ,  1396967616889942103 ,  109344092266712241 ,  2297401182174776203 ,  648600592373574165 ,  2091870839626189405 ,  2160748028102815842 ,  1500132017944975692 ,  1987834071114107797 ,  1854888906426314534 ,  764443529646228169 ,  681011247032000454 ,  1550819040747893778 ,  1774388950315585981 ,  1830999987675598822 ,  766043760053711528 ,  1826536764174965770 ,  79099326165803130 ,  2154066233849958869 ,  1267597043975427594 ,  1630074735903912249 ,  240679757870176254 ,  1787615943779373284 ,  1892717069131599921 ,  1941699786073628738 ,  1352863057898951636 ,  1623544111641368357 ,  956343320365946341 ,  1333321741679008280 ,  1948064397183149816 ,  72576683000974948 ,  1574208217338998294 ,  1049297486877479381 ,  1819240480818821125 ,  516641140797849960 ,  891023298303657559 ,  1897407952167733501 ,  1541118211374341306 ,  1586559510679857498 ,  326839554353208438 ,  952898977343394879 ,  1321089763058523371 ,  1225842257555235069 ,  390826880550879576 ,  848321810783475769 ,  2205106941514127146 ,  797134074694610455 ,  1511493707226558049 ,  1935230591533158792 ,  142065698440159647 ,  1067428552662047061 ,  2115260333254972334 }, // x^2^524
+
+{ 1259743603368397466 ,  1106537242643831544 ,  556470654478020365 ,  1900365669246060025 ,  933019329716281354 ,  7237002091846976 ,  68047773764123591 ,  560776517653736339 ,  1234138562469014323 ,  868845434352445993 ,  147161582271108581 ,  656377073060103392 ,  2008764742857444454 ,  1945886991804800160 ,  1340047037631596922 ,  559946869695808743 ,  1994221908892024492 ,  695811626464367174 ,  825456904504519343 ,  1544639015690514303 ,  149440512785919030 ,  95324700639152472 ,  321533093037815838 ,  437278223571027653 ,  1235546388763879327 ,  140463915832213214 ,  308491495904966474 ,  1324736445615282330 ,  2189592387183006762 ,  857535987971250941 ,  1667246410363079396 ,  1662747334045904286 ,  1599575348086335418 ,  379785223818330270 ,  1637963793446738375 ,  1052372981724200875 ,  2072305273005103338 ,  997769407865803082 ,  1641956495650826173 ,  12654650479465103 ,  1519352490755744911 ,  2025118708237998020 ,  1163791940638135388 ,  886745400578413985 ,  2147897656572699913 ,  298758185700280137 ,  1924512165987840604 ,  1104868714644551832 ,  1211142229472155357 ,  1528205329564302755 ,  1069465802986326560 ,  670939045262952532 ,  1991880934393623044 ,  218059951696278121 ,  1481291306993951422 ,  819288389723468429 ,  1634066415364810436 ,  731257032450437640 ,  991490884077415842 ,  1958302998347734080 ,  1544223947216146839 ,  1992825801673800770 ,  1722045466061623672 ,  1241286240295191430 ,  1025849987328833797 ,  2073230099189280219 ,  1280920887332382976 ,  793772790343562742 ,  911872477434561835 ,  2083366732171750587 ,  683332555424991261 ,  1291406405486578292 ,  1460194328927977108 ,  382586534719618910 ,  449145448629609361 ,  315112405619609148 ,  1211672576671556459 ,  544615178705857033 ,  2256157470896116176 ,  1370574987476133788 ,  1543531836093046982 ,  407637080817375438 ,  1731211919737432143 ,  1682007776505336574 ,  82133448714285450 ,  70455781589839842 ,  1863478130397104912 ,  952176190919094976 ,  728171936153198337 ,  974836691719704288 ,  1323370609552742799 ,  1746486267604920837 ,  1428680318021075157 ,  888659014426040990 ,  2065217013035720128 ,  1534221447828636473 }, // x^2^525
+
+{ 599699307270162184 ,  158817338703172327 ,  154822669423245165 ,  399727708864035975 ,  2279905514074832297 ,  1559570533133652056 ,  201621963323071572 ,  2145627174479056872 ,  432599410087266803 ,  315799104786356220 ,  10428595457311111 ,  1693524042443951457 ,  2114666564663714165 ,  1799582444374990389 ,  1998516786456670218 ,  1043460994140054375 ,  530593147085419359 ,  1565371346157641548 ,  1201082551279648379 ,  938303268304017955 ,  903971899646002372 ,  258469632704888722 ,  63529201026330860 ,  379259947702550172 ,  1963202172932037489 ,  164119119242900052 ,  806427356762608130 ,  21409792071878734 ,  464292501178127527 ,  2097526944600884320 ,  234528279717550170 ,  861056052508378870 ,  2078146291959854415 ,  2067322319223998917 ,  1538698430973974559 ,  357503509067625252 ,  478082486830146631 ,  1490930380469754771 ,  511663126075716828 ,  1440998448758699824 ,  767160951732439258 ,  1007612427585425346 ,  1182195615073638738 ,  1083533160953033305 ,  1445087611368767581 ,  1072861052864141237 ,  1904415468316536757 ,  693666130989658020 ,  626605842212620094 ,  2080164683532059233 ,  962402793073715028 ,  1971274048397638212 ,  1515256650953399296 ,  2120974507546475505 ,  565180934139728870 ,  1429387327534994204 ,  259209212021511389 ,  1056121704639554047 ,  2267590503218870539 ,  1166972383991949605 ,  1505375976331888358 ,  489629388191017183 ,  1976773880050733672 ,  787168576344459245 ,  1282253284734624858 ,  454526713443122922 ,  779897100145636474 ,  477470587228991736 ,  516925938268358889 ,  1953635168159180711 ,  676498401120516688 ,  1356781765480814957 ,  1295381786095878045 ,  531798351697455739 ,  1462766915559709283 ,  1391205452788507099 ,  1103509854320543975 ,  222823025235416103 ,  329521066777084806 ,  678049947165544771 ,  1303424397821662712 ,  1239912662784072208 ,  1621293068138630803 ,  476631009503577257 ,  769894678930736721 ,  620662637429128591 ,  947669580188396112 ,  685890046760603909 ,  740059703478868439 ,  541251797032200618 ,  124416090206389931 ,  221287782234590711 ,  2182408940188096522 ,  1932041593823934456 ,  2160475977164981694 ,  1390245817732196519 }, // x^2^526
+
+{ 392434703038870550 ,  25781010047653594 ,  1941227177620305375 ,  1279624403660149995 ,  514997871174794457 ,  1159372328301213095 ,  613849430912787013 ,  212232202048578407 ,  520476460712242979 ,  488685400068075358 ,  1533060525288569340 ,  2139613467271489235 ,  1224706714257340246 ,  1643046419197858978 ,  1252324077302102037 ,  313523919766281389 ,  746138939584398901 ,  1149478600731757209 ,  625453922254731643 ,  277218997594709884 ,  1266006219259931548 ,  901831919922308707 ,  337428789160516988 ,  796356933390083225 ,  656569167695121581 ,  2273998708539704899 ,  6786608891254465 ,  2093504062606164969 ,  401279100728716372 ,  2191290731665920731 ,  1907788717213866165 ,  2042036172930227513 ,  1010717846877723679 ,  2076792327377888475 ,  370806050142774299 ,  458196520269164170 ,  365766084401614761 ,  1775637932776532106 ,  444251322110705842 ,  616665564949282086 ,  1073119656185561945 ,  709490872734820176 ,  2039827599238139022 ,  37308855493362665 ,  440440989342529424 ,  1809606385553948713 ,  937980026032178751 ,  103348865762666878 ,  2236072836985450483 ,  711727067114690405 ,  1098154167360688853 ,  2021395756523531487 ,  9052054454674255 ,  2152505596787889226 ,  236283007676992179 ,  2107494586468801446 ,  1169976679767698012 ,  279930174790454546 ,  1476645587305727972 ,  1700693192607047577 ,  2270329641484340978 ,  610982934765407256 ,  1457997993876566145 ,  718411004324907352 ,  13497647816616133 ,  1827556212553841127 ,  653336682173583308 ,  1839240611781801821 ,  1922769616317909434 ,  679375417697431075 ,  1085412942019882815 ,  596390290640155127 ,  2106812750499075258 ,  14387740601346059 ,  1361835614892271810 ,  1666085439996417743 ,  70379190014264936 ,  1843717730603540073 ,  2080912441529683688 ,  275704456748661723 ,  1624623253810325385 ,  1007882523165667310 ,  943186390239636875 ,  46404477630463357 ,  1883491164427982796 ,  1041776476364360707 ,  948868225074994684 ,  734630520100315370 ,  232071251897694780 ,  425263935689134645 ,  1600761766829494377 ,  452555073534688654 ,  1614704505627411544 ,  1792634342436415422 ,  1431437686864571653 ,  642224651103861527 }, // x^2^527
+
+{ 1060710830237381584 ,  1030891861300638422 ,  2193432726021156523 ,  153498505775131770 ,  1344719994246430720 ,  653684878285976186 ,  900730251579185408 ,  1190236227859826843 ,  1527349327334814635 ,  1772456965672326407 ,  1899957335586693261 ,  1391713734446686069 ,  1563948462338463778 ,  2101509655726863481 ,  556902580835681273 ,  1910028220885401663 ,  1812642447882027865 ,  2045695159487674964 ,  106986957831015258 ,  2185101667579235230 ,  73258307921601975 ,  1985027812432155485 ,  407600884560061183 ,  761272347036657910 ,  749003240894468071 ,  205019739696914379 ,  220820252177003739 ,  635139093801762575 ,  762073440186959331 ,  1871645074168334680 ,  855736015523077429 ,  681537740184090756 ,  1567045190339978427 ,  2052422028549907967 ,  2052383929625622671 ,  714825082581229058 ,  2045538206158861259 ,  635267908833038245 ,  48226571867381804 ,  1613094533408157524 ,  1647555751207051425 ,  692484055622458690 ,  1430587044924838887 ,  974606352135839311 ,  188493042652873692 ,  1793647321023091408 ,  1108022885850948221 ,  784560248056039240 ,  411535172674795479 ,  1101297861331193532 ,  327817967380052247 ,  1486899152405232840 ,  1206497719700701524 ,  294542475980942475 ,  715500145912168265 ,  1203933698447978096 ,  578325477940737089 ,  1817871796523739461 ,  1843564561500770629 ,  1081635476333611823 ,  614228664984252695 ,  146964036077077234 ,  2000588522032160804 ,  1604958700820389111 ,  2266631943713586019 ,  75914605869110922 ,  1357738210117550612 ,  1403814412025380184 ,  1372990642117239906 ,  28616440414913436 ,  856266268315330327 ,  558494446187548456 ,  2211224290168985165 ,  610810014725219538 ,  403089878038849357 ,  1455610478970219354 ,  562527574502148388 ,  321945052224706929 ,  1860042838123600962 ,  1097667785344332545 ,  317248279627198361 ,  1976666807068966721 ,  1680366432708901542 ,  1977783275469938433 ,  1535454783201249924 ,  1860602203011192311 ,  1295056446528895658 ,  2079574114740001707 ,  1118601660547318414 ,  1860383299144804010 ,  883035293610413521 ,  1001951046756180462 ,  621799754187212763 ,  2226186519228129332 ,  2051376857073517096 ,  1455449725151599151 }, // x^2^528
+
+{ 1832330056638137883 ,  791932094090957367 ,  805544705747603700 ,  941316396305585051 ,  2211835115695558042 ,  69387096372804471 ,  913654315147187960 ,  351220546337245621 ,  489448676464417046 ,  285532785488123051 ,  646171274563443319 ,  2145861881519305570 ,  2254888216779881152 ,  47528698145794904 ,  1681237261624696244 ,  784016110892045362 ,  323023240908164019 ,  2061221174071357377 ,  295569668726112302 ,  1421286656204252019 ,  1047523820582342352 ,  1331025981880823913 ,  1777218191053655939 ,  1598444387508106553 ,  182211464584016694 ,  377111098395144789 ,  1504443053212904572 ,  153657507380745700 ,  425083246743290173 ,  2078460694052487821 ,  2276013879834572742 ,  2161058879755389483 ,  78887688115965161 ,  879303348974144661 ,  1143031568930898370 ,  56005999337419018 ,  1288038756292377348 ,  5595863792135013 ,  1264225676644932192 ,  489832142255765108 ,  904166606914870001 ,  939614043684804721 ,  1402314699825635145 ,  1352922936474331027 ,  362781498382884550 ,  2041086157436769573 ,  1902311924704704176 ,  1028725504172205544 ,  1022145191723737924 ,  132696626494710443 ,  173959411380398381 ,  931974431103956601 ,  2188165204152551104 ,  740203643717743425 ,  572215751865096500 ,  479582124771883420 ,  547218304291349885 ,  729706546945901788 ,  946475876950020230 ,  717549798074923139 ,  117858287635279962 ,  91874267647623539 ,  1849637254594245075 ,  1992137202706414371 ,  114638968857076232 ,  1347867041755164582 ,  2204036234489348310 ,  864445764041447454 ,  1805991973039404824 ,  460067351264465317 ,  1666138491495496294 ,  107170503981743461 ,  1487053882474829299 ,  874968272399732705 ,  1008780924084824198 ,  2078155246026848953 ,  418136205819896407 ,  840532594941911710 ,  502695059178494425 ,  1354025642611449776 ,  304557516465006635 ,  1045749636055830868 ,  1718156161321588374 ,  1483476664384457863 ,  181334755047611518 ,  95004851386962486 ,  1549107539335178548 ,  2163191329676422233 ,  339728096231303227 ,  161460013899428386 ,  1170295302470619534 ,  899424397107498394 ,  864037126341632455 ,  1556905674569222423 ,  22265517761727445 ,  146077086708587408 }, // x^2^529
+
+{ 522213200567940916 ,  1417335036932912785 ,  1744322655129943711 ,  2285806037692341907 ,  1038155107325810753 ,  1113538823740443433 ,  911453474013193024 ,  661578153307931266 ,  1499851884533381172 ,  1167692411209368104 ,  897058578058487248 ,  267978944110235015 ,  393217283512195007 ,  1701159021317712232 ,  1490758431608783569 ,  346411202295162374 ,  1934701368531187597 ,  1483797792140146227 ,  1290693057507072898 ,  1502524548894349001 ,  443602449209335263 ,  595355975467074963 ,  1920782654575979361 ,  1604733462724274595 ,  1901765707319775428 ,  1993809887172393934 ,  207924729592223642 ,  317207024318144586 ,  189619684549770023 ,  438782856221648591 ,  1669879309395927380 ,  522338458053763236 ,  1492784689860905335 ,  921852985370368353 ,  738320625290667790 ,  2069829049548522917 ,  973670377504344449 ,  1914753877951299027 ,  1873833462037797837 ,  1861364740377515056 ,  1276520466196873183 ,  528619121612525819 ,  2220482176541098244 ,  1511101174598509340 ,  2154409351237336189 ,  1217180734903129161 ,  1655778895138295487 ,  1034371986688248855 ,  381539908625768682 ,  2138227741717052197 ,  390783388056013704 ,  1782403999171543820 ,  554174264172877383 ,  236002328523919388 ,  1020939202531790864 ,  2134933794752133583 ,  646456762783380099 ,  1586707516287930318 ,  146242826747527642 ,  497068890206016905 ,  468247612327440275 ,  480476394818006193 ,  2049431059309491738 ,  179528092163575588 ,  801237883402824381 ,  628148411762335642 ,  2196838307486778378 ,  1045633354977002436 ,  2269059193227393536 ,  484997773478061871 ,  580264406558927088 ,  973976424084652948 ,  925129658054244007 ,  2032986817441868919 ,  870373912513838628 ,  378024882048906867 ,  1245708556525528147 ,  745333904280533220 ,  765472373550147785 ,  402659153807957940 ,  660000212176836325 ,  935077218530030869 ,  1501588239396045785 ,  362799210738008768 ,  2210111254911739753 ,  1404515011493240716 ,  1967731936413258248 ,  1383212799355404215 ,  1576071114871768245 ,  83497388162432076 ,  1004392887140513478 ,  1555010883027852162 ,  1587892661818266743 ,  984302682545846752 ,  657966603186310042 ,  646289245181109753 }, // x^2^530
+
+{ 669217210644175451 ,  449017835379363455 ,  1289064270342290440 ,  2060300870743389379 ,  1300946383729326133 ,  1371726791022903241 ,  1538399077859447734 ,  396681038683620203 ,  415670774744057586 ,  1546572709087094060 ,  1324742117066354061 ,  1180423763850944667 ,  839840226669021765 ,  1428949636860973892 ,  1677840636824154241 ,  1285956897556564693 ,  1377471736898456917 ,  2189608000682289153 ,  2064626997212859446 ,  275692650285357144 ,  1612563898219646844 ,  1452748672385474743 ,  77476771623641831 ,  2246728488978087637 ,  2304062291026854056 ,  653131022367253021 ,  1484876223550894491 ,  177813102398706824 ,  2066878283264252005 ,  1860374747948168557 ,  2126174360483302420 ,  1781576433071333024 ,  1941566911097081400 ,  8774718959411685 ,  1590201171764227142 ,  1389806617577511232 ,  835069823964626545 ,  2044538212944783349 ,  1675817109228444590 ,  2052664871579006813 ,  1774286194345294876 ,  2055000926066459013 ,  426929417831776902 ,  2037883549066673273 ,  31550166730151755 ,  824083694117356135 ,  1079483916520952206 ,  1841657317489019064 ,  1679655472357121560 ,  1540110417559887406 ,  260916984149066077 ,  691648178785525662 ,  162724056703271410 ,  595192920137923649 ,  1432624399810626557 ,  749204613806531502 ,  312264917413972507 ,  1550443367651097009 ,  183547181669443214 ,  970970870014507322 ,  1064877662009031726 ,  1783469674208100093 ,  2174184067483136931 ,  1447949343639990130 ,  1799986127141843613 ,  883319231831439213 ,  1606295609263044614 ,  191623995739410127 ,  724898116046390469 ,  366795855345537327 ,  1761410234501133319 ,  1912085155655649895 ,  1100312937900981296 ,  2160244503486136848 ,  1216649110945994310 ,  1656382801900374139 ,  1507231892788602956 ,  476804240933853689 ,  37171268424275613 ,  2286976179004851786 ,  1189135107883187473 ,  1725313506664384466 ,  579805811953110761 ,  1868604679826812571 ,  1617451574790846488 ,  1001287847981253151 ,  193072002369406152 ,  1311552215939513484 ,  819090378371078274 ,  1165020594189630540 ,  1114208404148330964 ,  966921378840408568 ,  1652150951531390131 ,  119839684464404299 ,  1620990676407438715 ,  1160652198937194490 }, // x^2^531
+
+{ 309117990768998794 ,  2080609347213982921 ,  1456079330599617366 ,  333657818700580289 ,  1452379773668318576 ,  699163629169291023 ,  2005888153789762135 ,  1654580480349897300 ,  993220241800840858 ,  215753455152774150 ,  51245740653723147 ,  2193957524425912408 ,  246768928311050525 ,  1648429904862696104 ,  831012770789496158 ,  272283521080994190 ,  366971958286449966 ,  73135533200700261 ,  2231194005416685810 ,  1043034473442264192 ,  1358588205000889849 ,  1146220212389569041 ,  1226671791558653471 ,  2284861573961031399 ,  824283054542474272 ,  1509895253425386151 ,  2128751132078035948 ,  1504413532192982114 ,  2293253621772686819 ,  784818368288331919 ,  2033739155501333797 ,  1038312308805188588 ,  1347875890028062154 ,  583756055296346603 ,  432942368393372822 ,  44278186259228693 ,  1323938711586480287 ,  714894911577405108 ,  351281211374665569 ,  673661680085968729 ,  1613962596393662070 ,  1141322975920300751 ,  1311403931785502478 ,  65693057683023062 ,  275331924826649104 ,  847302693317213582 ,  91996413269395041 ,  253624818530805628 ,  687296203856948873 ,  1707970600303414231 ,  1766772598246805155 ,  1212421990708540298 ,  1588208219801260830 ,  114973505431834986 ,  1441589584383162545 ,  1758154844424051573 ,  203162560179237724 ,  1856248099246315776 ,  1276547060044330924 ,  1302872949018380614 ,  713307223883051527 ,  528061219841075223 ,  948081463196037140 ,  1517920266473874719 ,  74955997752735488 ,  1502888906793371727 ,  84429104933571530 ,  2284691973040095106 ,  1261649579830024962 ,  200204177913691411 ,  466009554389147889 ,  245247582326025550 ,  1053881147017933572 ,  1385726370520464804 ,  199395297833034580 ,  2014613914935390674 ,  1630186852341249808 ,  631610455061383896 ,  2049874139209916744 ,  371576371004723305 ,  1727908137704903880 ,  1047419309456277659 ,  369048162402439880 ,  2229627639904816606 ,  1813178314865586109 ,  1143357534717965138 ,  1540047297187292713 ,  53552836695324834 ,  995920751450467598 ,  801767674385652047 ,  1979547286320107222 ,  876585992753946689 ,  286049353334839860 ,  337737035227698844 ,  1816884131448343481 ,  1722054139781500219 }, // x^2^532
+
+{ 1082917785863325723 ,  177786479564131453 ,  1093271665768087567 ,  1959011270405503006 ,  876299346375870182 ,  899715829136266343 ,  1148293129726793919 ,  1877387890919530348 ,  576457542896577078 ,  303288449644662198 ,  952705186667810867 ,  1280212493434264885 ,  1951265087864754417 ,  30139854136035813 ,  499668222356424913 ,  487277031888243899 ,  116861922182276081 ,  656048381319844952 ,  2034554649815734618 ,  545419656556358050 ,  97648552439165338 ,  314540035325868075 ,  1781227275095276284 ,  22943847351265789 ,  1176718954644546065 ,  136614404523016885 ,  1876486070512094715 ,  204227150277347298 ,  1883571321380070153 ,  289339453000496663 ,  1366623652001677970 ,  507840236764145991 ,  473516743340912247 ,  713521455922047911 ,  178658275384144698 ,  1636238122011273315 ,  2280502216708207172 ,  2236540868280314894 ,  47979917362828010 ,  2181208979376581559 ,  1251220976921224222 ,  588295304573007921 ,  1529452224318323386 ,  310116524829166275 ,  221104518028021217 ,  582526640495359642 ,  1283855853596509719 ,  2100725485471974552 ,  1891815552412781657 ,  1409684747683950150 ,  717241808910166728 ,  450480568655017499 ,  1844475447486040207 ,  862458198275926661 ,  387616187447253208 ,  1568537085409030150 ,  2132141369868312157 ,  728366981753195699 ,  135891668911687809 ,  1516848043867162941 ,  1491516268234933663 ,  1995931809011376059 ,  44776014734349536 ,  452606803577799268 ,  1761234063221472938 ,  1988310678226991748 ,  1050538409073500449 ,  1703235270440472391 ,  2082465573281230214 ,  1346772337229589381 ,  685874454456412415 ,  1118700649965397754 ,  780197439618630269 ,  529609888829546199 ,  580942674211957448 ,  1534817707247792830 ,  274106907801266875 ,  1242461905972562931 ,  443626889995303002 ,  2204552529504175046 ,  940226510662349478 ,  1264624321488913257 ,  1677061599164215516 ,  1193410990958525531 ,  150579721715393341 ,  1924117886928819180 ,  1129019431263951364 ,  1697417404197728614 ,  523777954743767185 ,  683491249052065090 ,  1784004558040391498 ,  2293887697715837633 ,  1476107330019931188 ,  1038352162585665423 ,  86517490436201527 ,  1443298404746418834 }, // x^2^533
+
+{ 799124165436164524 ,  2237604020989208622 ,  611245327912974639 ,  630736465182885867 ,  1183386344126486454 ,  1384624527283072555 ,  145794628615405993 ,  1019236606050731274 ,  1335309408186760532 ,  357804954360887910 ,  1597056280690221181 ,  2098192901274733113 ,  182398284242552649 ,  315109703848682247 ,  1808199509365385813 ,  1723794047466127912 ,  238460201801989256 ,  1904259884290560717 ,  1924952754285585197 ,  49700129899213631 ,  1499761909523235607 ,  1037040107057984597 ,  1601059741081564066 ,  1651567115754977204 ,  787687386657029068 ,  1989572576263762426 ,  826651157219937499 ,  2066856717949135061 ,  329233822815915089 ,  1726487991113653197 ,  624278313867813134 ,  2127740710913521228 ,  1634800026966532283 ,  428801540793907725 ,  310521901561444240 ,  1501229834716591110 ,  264664274187226580 ,  129291780094993587 ,  956509801425212104 ,  485470466983600653 ,  1344680072770428361 ,  1815213813296785164 ,  517868115858253172 ,  5948312648396916 ,  1424137936938866501 ,  1896804793142828337 ,  1656773935466267376 ,  1896401187754614317 ,  1933223819115019169 ,  1828835008652674933 ,  289021577793345606 ,  929821467362427682 ,  186426764210377532 ,  540454117131994156 ,  1249861481063990560 ,  712448140614421991 ,  1047592430485747699 ,  2134971338009761394 ,  711100806731031319 ,  375057079274879050 ,  182181314786509499 ,  1869303582953175213 ,  880642757671066584 ,  1950655312590575816 ,  2132438654434006054 ,  885039355257129972 ,  60770350963010386 ,  373247568766545209 ,  352639663877943149 ,  737070455422332445 ,  1158803796668563216 ,  269436857564884699 ,  1962370373722904359 ,  976170871555964991 ,  2211689014783750524 ,  744700254349082357 ,  120306621120660423 ,  537324915784291304 ,  1885329357086015320 ,  776523950623041422 ,  81965809825334057 ,  1997853713362526780 ,  1086455705185090124 ,  1632461440741674370 ,  270282171774652164 ,  1893123015671826988 ,  1922304032607775895 ,  959910649262060265 ,  1390333413269313454 ,  349521159302290042 ,  1348855814034251228 ,  1553993190131636918 ,  865917692533047673 ,  469589606127421529 ,  1911641968592175 ,  805803651725313031 }, // x^2^534
+
+{ 339082651970107642 ,  1353627951673699229 ,  1901199644921533059 ,  1497565185443763694 ,  833853545675122784 ,  285593348526652563 ,  2199846241333700445 ,  2080649563874447648 ,  2273471691534890422 ,  1938698677580002791 ,  277756040398488077 ,  1269764105291198295 ,  1327025292416772378 ,  1246361787277514817 ,  1161940633460204719 ,  1428684216745959585 ,  864598068287259762 ,  707771288884767844 ,  648399199760690900 ,  266963357961070705 ,  2145080691646494259 ,  315404040112984053 ,  1953563102009691298 ,  1701208151653541480 ,  1118003406733283325 ,  2153202861972603840 ,  967575894197557755 ,  957936753216950075 ,  1671957912067414049 ,  1403624698977319969 ,  1996600945827811085 ,  624366988842713669 ,  211902411285492259 ,  481184397252520449 ,  290160389309562635 ,  1078018522408717864 ,  1444775067669157116 ,  2252332174367728127 ,  2219217982656900404 ,  2215041784633027916 ,  1026791359460750219 ,  1790263991369622457 ,  852167679472169364 ,  1522714410077338334 ,  1871306384235270806 ,  2129412318668889358 ,  1006787565025015709 ,  2140941794251114942 ,  2054992068903306100 ,  107168706593274100 ,  125339063856284532 ,  2108682636056478008 ,  750159614227394358 ,  1186187196849998018 ,  828913345201619737 ,  1048693225790486492 ,  882695669845060791 ,  1701416888254462430 ,  2271777017032597977 ,  1219983564053320216 ,  160098872456810224 ,  663953587169204189 ,  1469052108263227741 ,  1745486785429109652 ,  1932756614969128119 ,  488995143623948549 ,  99108095216789431 ,  704108728746177658 ,  2211042399288444503 ,  2118265959643846222 ,  1717771650587042540 ,  1662672004713356840 ,  1258287681694600373 ,  1054274457235967505 ,  1514927570864900119 ,  599185197652408963 ,  480000672562191373 ,  388390087144819984 ,  792545655069119101 ,  2264132974729865234 ,  795864814241164548 ,  650988579264506291 ,  561588331686488442 ,  156495794294096376 ,  1895963790374264076 ,  1982751434647302015 ,  181194059355333977 ,  1176204037297221984 ,  1298819681930538882 ,  1034194907928486351 ,  808004646125552488 ,  1709028656321272256 ,  2137472087311680673 ,  2188365652080475005 ,  924883222832709536 ,  1924804765927048324 }, // x^2^535
+
+{ 2055431962399221752 ,  2036891328954450095 ,  2015575166157513823 ,  562116464780517886 ,  1131212270624312403 ,  135280149461639679 ,  1457692680026093561 ,  1790494043618508972 ,  644517438749249725 ,  1671427694669900444 ,  995247797689209650 ,  305105083508049154 ,  2170521247564183599 ,  1758771723495934581 ,  11521142719935917 ,  1935071893948419793 ,  1257887253174971426 ,  1256533715788589246 ,  1604443665536774981 ,  1897473205872100028 ,  1790111442999069423 ,  560548014079074421 ,  2014425723265374703 ,  1973520945586161350 ,  761064908309348787 ,  97664579493265765 ,  1707948173100072299 ,  625290130665069186 ,  1776628787717616664 ,  829642717526816568 ,  543234512687500329 ,  1435762777774366593 ,  532111811970685778 ,  1833229289661433716 ,  1809025616202664581 ,  325020460501881530 ,  1177358214437152754 ,  1211706706885180394 ,  190772806612087289 ,  1500631774123245823 ,  530252774905375517 ,  1160934777329197103 ,  1620168814095013190 ,  1308112409393393271 ,  972342182812534256 ,  537261022230281284 ,  1223527237930087396 ,  210386778822452318 ,  820060889727900877 ,  2133077307873233992 ,  255195176242927637 ,  809103014777964562 ,  2142236375982427969 ,  2032176773742052152 ,  2110337026259000979 ,  745569589076338547 ,  811769052343105743 ,  1110247486012924788 ,  1953190359503038521 ,  1068841707137794374 ,  218362955658048912 ,  805027696620678907 ,  1447617802115311338 ,  1618338953140113423 ,  1787910959789853663 ,  759393198412297188 ,  1322443653354874714 ,  524957800993619520 ,  501224401616687397 ,  1539149407916308558 ,  2299871449448361208 ,  268749133996961452 ,  1298859366531144382 ,  1316393514624746618 ,  1591888684955572621 ,  1150871719973662075 ,  978611796047943722 ,  229310189639066990 ,  390185926767427346 ,  421560482769320361 ,  526129308480649253 ,  884710791143798513 ,  906619749709566678 ,  1516455159301262014 ,  292308094780346642 ,  918642197447528983 ,  1614484019917330936 ,  1376122137600049206 ,  1086785469010414407 ,  342682825991379621 ,  1970432917535157246 ,  94143923819925632 ,  4372647276898230 ,  806375386661735444 ,  796344975108081242 ,  1739019455657414271 }, // x^2^536
+
+{ 1083826964069047688 ,  65665059322199174 ,  818733669019241772 ,  1845470892734534535 ,  445775398890627943 ,  2293739702273959475 ,  658948570881586522 ,  1266801364032656489 ,  1710680736969468098 ,  948487166069265776 ,  352594429569083071 ,  1798901620499155494 ,  57312102581868974 ,  86056511509709041 ,  611846460074035659 ,  847416723488260534 ,  2226666749165193130 ,  1361360759980455751 ,  452581742047868020 ,  1727494881094228050 ,  2263306810852670116 ,  2219135854907788213 ,  1949276846666165584 ,  1891756664524211288 ,  721054688273891578 ,  636970477686144712 ,  2000053668706658693 ,  791198998966228650 ,  489042729169224734 ,  1717286610356168525 ,  724766892018932436 ,  1083815491050339419 ,  1887364289836778976 ,  1662508519681714838 ,  183684663878590395 ,  1100977847167948282 ,  445792204055668398 ,  1352590600478876219 ,  916891383159037566 ,  777215240369790269 ,  610885469778697055 ,  304595726063213040 ,  1757170180448142169 ,  1125973128109189044 ,  2233367958486320407 ,  590853040913948777 ,  1105699127490313168 ,  767905814747445941 ,  835235229134074705 ,  1652196472697714249 ,  1963442875534956142 ,  724407176607682022 ,  141682424750482897 ,  1255182189578096369 ,  1733427453498763471 ,  1582718486880453717 ,  1343668084520134707 ,  1627251907078595200 ,  199347322269222418 ,  1041056313597532727 ,  536410100574835386 ,  643475124076743928 ,  1667910827112275083 ,  1835783812329942708 ,  1042716455142709449 ,  2270659606614534082 ,  370151902477948627 ,  993261543866452317 ,  1749824914289088618 ,  2083605043400261966 ,  445040447165685647 ,  1224426733180045662 ,  1868456219945834574 ,  599028663612457975 ,  153329329870913783 ,  2219919347273544255 ,  356037254876257002 ,  228245611292494997 ,  1471122898017985239 ,  164049486113203418 ,  2053737854830839571 ,  581677862475357549 ,  1735415119945399536 ,  86314291641413486 ,  115150546037344265 ,  2029836926746820867 ,  358822414115485566 ,  2147429966397747505 ,  2291737055687289233 ,  1553646009441397524 ,  1248134204973215604 ,  1453010458769238982 ,  838960872576425871 ,  392275506656790984 ,  1069511710712613279 ,  1278397236194334752 }, // x^2^537
+
+{ 896995001433282562 ,  250065889579499613 ,  688511434682013017 ,  831789386464221566 ,  164752469606347188 ,  83545884183643632 ,  1519385009747203944 ,  107971880743661635 ,  247795392045746721 ,  1098333690971643425 ,  997342123153448218 ,  1189224283393966568 ,  764173941027859811 ,  1781949690349284020 ,  442242128163986703 ,  2141836109576644380 ,  416298466520939094 ,  575600438468928675 ,  1472502093324866837 ,  656266621851861449 ,  288232804682298361 ,  1724243489688267392 ,  40247300522638834 ,  648011242569951933 ,  1845774485994140327 ,  337389419845293492 ,  1928378587560735808 ,  2261163556517750131 ,  921054120695878366 ,  1861927201120378622 ,  2054661399975139434 ,  1029448672106351248 ,  917451208752223426 ,  2235025900021712260 ,  850379983972215341 ,  1620554248468499567 ,  204775979100468226 ,  2305357889942818518 ,  838612339676396894 ,  2162456465162625425 ,  398900951655152927 ,  614267982230907592 ,  1407347139754313865 ,  1663906968769451264 ,  1916145868574919007 ,  2008350530792851231 ,  825579206721109827 ,  1623510829153249876 ,  332094929574106413 ,  387873011948774521 ,  1770761163418403071 ,  785868484837933868 ,  2260431238173373970 ,  1672846968436951221 ,  2200880141457547672 ,  2046974882952667069 ,  1153587168665899857 ,  1551115574542911441 ,  1114035759526834689 ,  173128639233079195 ,  536661324165425712 ,  694598986815495645 ,  1177902042454793799 ,  797993662479756167 ,  2160764564974299175 ,  223061991487304010 ,  613280270717389135 ,  964395749355018866 ,  718600166507237197 ,  1360368003350326807 ,  1909928515207776766 ,  2159470722503301424 ,  1485622897844289970 ,  839419176465070138 ,  2184580599018691502 ,  905500131782279971 ,  758173834400561399 ,  1727099849313545918 ,  1191529360652630070 ,  640619399357519624 ,  1060627638220727123 ,  159161791274211670 ,  1488484298643669998 ,  184254030574161154 ,  1346043440826897909 ,  413379475192349632 ,  622328363122320997 ,  872022232387844286 ,  825628950396731213 ,  1257559886574665898 ,  786816901430462687 ,  219230666015555832 ,  441216755629557127 ,  951925536882651021 ,  279128386979650599 ,  1959364350534075575 }, // x^2^538
+
+{ 1289051347189350730 ,  1965791796554049826 ,  748391408445557446 ,  38707008094640939 ,  1906814588546832517 ,  756468875654489792 ,  188195245690276998 ,  1776853596243792802 ,  1576610845154545447 ,  2106563071299024792 ,  511765448797524313 ,  422442117211344437 ,  2024502274603807714 ,  1223545430090696807 ,  2224267247761431858 ,  1633395942712808244 ,  1423022362252718110 ,  1509268631339597830 ,  2037179825247897920 ,  382302676052387344 ,  695136182623939257 ,  1246759807033796175 ,  1399605416655833565 ,  1902208949772248648 ,  368288482760861912 ,  13714349848945351 ,  1866337857940337605 ,  333655138189687731 ,  1594731017050318932 ,  410249554380786346 ,  1963712417165398967 ,  49748795008470629 ,  1088412883699485961 ,  1847181857934522727 ,  2117275952511122466 ,  1352907705654441975 ,  2234349435063270497 ,  1368222282751727026 ,  2267429818092144710 ,  1073706407345893645 ,  253877266443531310 ,  362205934251118581 ,  656104359538565542 ,  1914480981041149072 ,  355227092887153890 ,  154831537897640521 ,  468084436627668096 ,  1221788619938720018 ,  1454357828007955414 ,  683451669498889397 ,  2036789002456739850 ,  2226482928318826270 ,  760470749943203067 ,  1739805738135602904 ,  158178906193598104 ,  988757957991343978 ,  1687501232341543646 ,  2204512414259120215 ,  1886881352458850439 ,  1344042369241549280 ,  2039775944411019344 ,  1504291779772192935 ,  1973731304620842716 ,  1243106890723134492 ,  1984877494845419411 ,  371288017961001631 ,  2036018330849815101 ,  1773049021826881973 ,  2287837927170148184 ,  1406094474194157581 ,  1105612120090986550 ,  1122755902022780414 ,  2223141510013416827 ,  1816216182004773779 ,  1131035450443608872 ,  2121498731021747437 ,  774750843131498257 ,  1050857585429056361 ,  1806812117929702518 ,  1522798854000426013 ,  83069498672493179 ,  1104017239181272618 ,  1197155699999964783 ,  583535269423815075 ,  1114507671342944903 ,  3692568497769278 ,  593964018019571640 ,  853374142037289950 ,  646715302125574691 ,  1052414222216576289 ,  426109263382542984 ,  1412071437542566260 ,  1401854516169384212 ,  554078163927539742 ,  2067389059576746403 ,  2121038014380741476 }, // x^2^539
+
+{ 1943065566325317838 ,  1767952568308208275 ,  1376158661171898310 ,  1932893294891651431 ,  342192878088508186 ,  958343232284638044 ,  256626961698378155 ,  212521890697309363 ,  1265836661805515052 ,  183517101125620591 ,  2140775958627568670 ,  1429277867121410443 ,  823198572639481414 ,  190578661613980987 ,  197610103349980741 ,  149908567805250568 ,  1127631299927056887 ,  690911132591460550 ,  1518658822483271846 ,  520319333276292694 ,  920833911201225313 ,  874211544468901392 ,  2272194964532365647 ,  1661206139897012631 ,  762397558218488276 ,  445838632914605775 ,  1916263925793945917 ,  1388989213576969683 ,  2117394634592262257 ,  879773204665762662 ,  351079599293184102 ,  2054610295060679670 ,  1639325252809916950 ,  1770170074278444656 ,  1441771357702488600 ,  646788546629848101 ,  1920319711758149929 ,  2286303737050927903 ,  2203016775841364541 ,  807906287241943788 ,  488185240665708801 ,  1483673954882350446 ,  2134433700644359922 ,  1693329994262198190 ,  759992386927093541 ,  331124647525611870 ,  397828770514441689 ,  1999348119999157457 ,  558031792460368907 ,  53181948947608630 ,  494291329278739561 ,  1380948968261294567 ,  1069921935107450960 ,  372841688176319206 ,  1129103646321904348 ,  1946825693045203607 ,  1925364192178437607 ,  2193647909582948086 ,  1591310616307946927 ,  2104518820956505961 ,  1164592045667145628 ,  433695651840335002 ,  433435220375805017 ,  1085987283765234762 ,  1011875617472996848 ,  999106287681267404 ,  2170829334869205892 ,  494370075386019691 ,  1732951990530705615 ,  2011730652172744956 ,  1434246771458666536 ,  2096777100897798471 ,  808079399378752280 ,  1898152371198532473 ,  1832785152825275204 ,  1674654920858729641 ,  1756791103355453872 ,  1229305938352926261 ,  2005162462586447118 ,  712537917113595869 ,  1959370201952810333 ,  896594046550272964 ,  2118651588866409344 ,  514670759375438933 ,  1921516319591139858 ,  1138576623173853231 ,  981461401203850622 ,  1303690569068855821 ,  1688204562870137099 ,  48669569584622781 ,  270163507938933930 ,  1840503276747190033 ,  515021018406464738 ,  1662733363742526258 ,  1187085697283630716 ,  870530494264375733 }, // x^2^540
+
+{ 1569704684102204723 ,  327244998583923439 ,  1232349168493219132 ,  2245621626551589152 ,  2142773789603432031 ,  1474656647014032944 ,  463961954434274174 ,  126603599638710469 ,  633115469904383182 ,  1345710466293831706 ,  79350883198256547 ,  986411854148402186 ,  128468987662784147 ,  18712928544606024 ,  1775648086332286814 ,  856286337300586172 ,  907000961326630313 ,  1823675499733945995 ,  1737985634697769754 ,  29230882363700060 ,  35566365172662797 ,  2301691188331668711 ,  679394653982019870 ,  1921265058912001181 ,  136401424292700658 ,  561731445723141292 ,  1851334163573288974 ,  1297517760423664226 ,  1888443457049737477 ,  1563440350602597924 ,  274005137838423862 ,  1325528617768739690 ,  1702622376113126195 ,  1248856797372526893 ,  245028109868755991 ,  1757914340847331612 ,  2159313367417047216 ,  674271667472524062 ,  1668400314184746936 ,  568965619940618678 ,  1857571247418498735 ,  1365069189322595840 ,  2001658095350924358 ,  20008812227095484 ,  218574813589733534 ,  137638043458681432 ,  1431701905829121171 ,  2027108311260006507 ,  1493246932759349742 ,  1578205303385594844 ,  62843482800458209 ,  1360426955310295803 ,  1209697121593890079 ,  919388099662717029 ,  1105380601113385980 ,  96694946137872225 ,  1688861453618312570 ,  1537620744200190429 ,  1246242377710155522 ,  93025270959964586 ,  2156727703408636377 ,  258788105881278306 ,  2069043176255033492 ,  1048803223759425285 ,  2069551721763091729 ,  1560407766488051835 ,  2165921755011805738 ,  1524518977962935520 ,  70106908591418787 ,  710956063455747083 ,  807423868975958097 ,  1721043302756102770 ,  2228513314062346843 ,  1051047235889973704 ,  2224488714268623424 ,  1868583529046822834 ,  1636822718581699131 ,  844684998880226652 ,  2250425798449454028 ,  1012665513802904655 ,  434302974636584487 ,  1554519957870238261 ,  1396732009711602464 ,  1232987251052311 ,  1207377034030975111 ,  1335307741277238273 ,  579271079247466790 ,  1480161068358817470 ,  1044560746820721147 ,  64533416389793624 ,  2290383964237626264 ,  1031896737107422027 ,  32154217417823263 ,  1674086849943678077 ,  1376725723736729207 ,  227488444340460488 }, // x^2^541
+
+{ 1146283143274845179 ,  592418884484707032 ,  330654169495420884 ,  526222684810071866 ,  1146185625374523547 ,  348700981159742067 ,  2272575242727353881 ,  1924653846964579045 ,  1672698754969946642 ,  2241618445665706941 ,  356810012461217898 ,  470566305726621819 ,  2104431744728467245 ,  1312165864949760837 ,  2102093013005151851 ,  2191706319131276857 ,  1961997264939728949 ,  423806912261789127 ,  1910090488224958192 ,  1585425674568533502 ,  870816616268332609 ,  1401053739917751819 ,  58289937173863559 ,  565199417027779316 ,  760698722006172451 ,  1769206103211899329 ,  429905266513337184 ,  977921839652537659 ,  1644521446739989722 ,  1019629142993360538 ,  1422872791615726920 ,  347692598539100446 ,  1811037694353133480 ,  462322909682559858 ,  1283252028124717450 ,  1218571688830439366 ,  106777944490834020 ,  1315312587914412659 ,  2174882600409067115 ,  794497140115637266 ,  422562940951023133 ,  1491222298275166859 ,  561124765725844815 ,  1195490940365567136 ,  166980579636628169 ,  764900857958424481 ,  1611009776788511421 ,  1473475604946501082 ,  164141497328643289 ,  2055440183133394058 ,  1735806893606401930 ,  845404031022895115 ,  1138612957830379221 ,  1551644623299241587 ,  1490347650746241172 ,  912149979897042167 ,  1310844677098172287 ,  584286730347322000 ,  925572990319076021 ,  1093707753356937591 ,  382001744167907919 ,  2170132483601432697 ,  1074400946994246570 ,  1377199923117779040 ,  2195678350663095916 ,  1795621851373543022 ,  719088089722820517 ,  217407570043511143 ,  1301402619819135226 ,  1261374080018801210 ,  1819093410983889244 ,  960582110718564412 ,  1732823207936314396 ,  583809549767443867 ,  591605990235246058 ,  1230191801361594290 ,  112871323358820648 ,  2041902876233655929 ,  1028132608226543454 ,  259721545588125860 ,  1489510079945719068 ,  312327078386482386 ,  466195767430376607 ,  190935976299649705 ,  538845824300381347 ,  477444406763251506 ,  2015084224988452324 ,  1505379849741912808 ,  1830753410245597701 ,  2289045520268541107 ,  305858508498858127 ,  114911775442434502 ,  697559161358868534 ,  259682476181953353 ,  1264762750990465349 ,  1029877992423446434 }, // x^2^542
+
+{ 761730588970216695 ,  777191301038940672 ,  385246896809285355 ,  471989108025122246 ,  883276847794819112 ,  616997376529571624 ,  2242231351149754908 ,  211974362013308088 ,  1873238362843456149 ,  1152935927980834216 ,  61505654252293097 ,  61340262389896483 ,  429031427766060275 ,  1587445958821047412 ,  868523431642455498 ,  1266051649817007132 ,  1578894768319732534 ,  1128011869889866193 ,  198769052547402263 ,  196349781242677262 ,  1736681183933024229 ,  1383832712276416907 ,  1363046716369598758 ,  379240388391639733 ,  923221612880811879 ,  1942563819901179585 ,  593118993056437631 ,  1401631751492121500 ,  650871290492379242 ,  463678656024324310 ,  90088876525612915 ,  1963750958397001728 ,  1297786363633725490 ,  227769164375889893 ,  1796878353291099080 ,  1183780660651601921 ,  1253438739685779234 ,  1925889581086726904 ,  732001409023723226 ,  129194121164919784 ,  1039985277198933512 ,  212877273221156368 ,  879305514389001900 ,  1994025640950474185 ,  1477549254742367374 ,  789527060631449795 ,  464769674830758366 ,  2257056658859243585 ,  1348693026820665098 ,  378477632388366052 ,  2117766918645116935 ,  2189189352777641370 ,  2085051742926930828 ,  1616346656474397922 ,  959100410430468220 ,  675662750668553585 ,  192294713697987668 ,  1818427949990717731 ,  1135196328432273824 ,  1570407722718564031 ,  1302826490908772390 ,  224864072383248619 ,  2073002844288912019 ,  1411962189945949492 ,  1881203105568960009 ,  2221079314746061572 ,  423031777498230553 ,  101852275870809326 ,  992193294037986843 ,  2157413369645671404 ,  759801393096354194 ,  1400099327175197187 ,  1444229685227779202 ,  1446201073335719382 ,  808531520468338089 ,  679458551748147410 ,  175690706873354597 ,  1914767178577947455 ,  365935576833143240 ,  229489625246291007 ,  2019575635823662127 ,  398202922582115169 ,  1305424191275112498 ,  1213481820763207631 ,  1966714078516312372 ,  1452934267883061172 ,  759816555844620854 ,  678053057899452178 ,  571718785546116079 ,  1121739810658981550 ,  99616949037787355 ,  1676788954864313274 ,  1698944877410759454 ,  953743031552049725 ,  309970661827248249 ,  972211966307908182 }, // x^2^543
+
+{ 1909054924512743980 ,  852558546171293297 ,  1743186777095861721 ,  943420572197490767 ,  1185196421614464203 ,  1183615965532412578 ,  2264019127028776800 ,  1221781039734394331 ,  208723816029271270 ,  707868765343847562 ,  1851451126863150759 ,  1908796991085978256 ,  1891618733011438682 ,  1356992462627912248 ,  1695684409974839519 ,  1800813882188184809 ,  1705416754650859933 ,  202814625161170779 ,  1750998687621234696 ,  1176800000336211713 ,  1601901828713927828 ,  1761723397194227867 ,  631801103206388081 ,  156026719461614032 ,  698525902939581134 ,  629880771192717627 ,  275316617284497172 ,  736137342744870869 ,  1909310928505616254 ,  156689543537536082 ,  1753001014949409811 ,  1324285285441254572 ,  1157890317869495063 ,  1002484561833820927 ,  343625643391117687 ,  1587233771535126334 ,  631553412335300944 ,  1689479741390240963 ,  590865396801974308 ,  1856217448645844023 ,  520298102321587711 ,  2239380244073583490 ,  899383442288113635 ,  671508359506925969 ,  643981331776714890 ,  459532147000091620 ,  1292127729953463965 ,  2284032231805170016 ,  992500481004273917 ,  87008977519847480 ,  51693992064645277 ,  2003650547507849652 ,  22287303652602331 ,  190810247062830979 ,  377472061970998532 ,  917386381801725448 ,  1136181068839100474 ,  2038984639290140017 ,  174634024003312372 ,  2079079687600218280 ,  1073422539336395469 ,  1987306315998925532 ,  1874668665431381871 ,  1361920845441694957 ,  1683162224318056780 ,  10473023248278586 ,  1530860490196789833 ,  575977160274168109 ,  918539643386970883 ,  1774362235925891719 ,  1888400007004851010 ,  40789515561505379 ,  1857832251959265374 ,  675021787953821584 ,  106733133893107975 ,  1953861378054985731 ,  1070953866245828377 ,  2222446880359117467 ,  1461548026167812171 ,  16138265604203505 ,  1912506943062387421 ,  329353216299863336 ,  525078010985668605 ,  672146028160066026 ,  2031977194431726451 ,  1595267953890040857 ,  637487430586889491 ,  916827911489004845 ,  149818267733359665 ,  1493464582542622151 ,  1613565476354116861 ,  884691330443896709 ,  825029727485475151 ,  2131841408028171624 ,  1741299102392775164 ,  673123420389643988 }, // x^2^544
+
+{ 650595260434093 ,  2023840904481296431 ,  877906432384173152 ,  1372877903116342764 ,  1132086072469897944 ,  1769078188854224937 ,  52807563490868034 ,  2170952981793476199 ,  707429153070303341 ,  2099957153306963001 ,  2117639144903732513 ,  836275377093743167 ,  1926407048955521290 ,  2122475653417157528 ,  1082974797967860090 ,  919988806835997760 ,  2203605265466666373 ,  371539615301099008 ,  1877311067441341839 ,  1461500380341527266 ,  227900964678855414 ,  113127741998718345 ,  36671750931558621 ,  2014411256843863311 ,  278251019318767299 ,  1749393181803373540 ,  1891079138221827725 ,  1013278401837556182 ,  994806615730788245 ,  2032188747625631275 ,  2014638552891966037 ,  1608306796328245285 ,  2148688963469549092 ,  1225769727943179555 ,  1570223974802701813 ,  1797713471169603362 ,  2188119974384942052 ,  615628354278987033 ,  1607943262185807731 ,  307213503242371952 ,  1023562111760654711 ,  580464607713865835 ,  1793252811879465447 ,  1901074353324938286 ,  230131709172987100 ,  260133881375847195 ,  1080276255620584487 ,  1298241461359782648 ,  94451566190278097 ,  2177637070834089953 ,  2131810719696068520 ,  1855054156189641652 ,  78775660297840210 ,  5244073090854553 ,  1944505025672531291 ,  169202024477411109 ,  89994907626413866 ,  170026072334741617 ,  1317855676961151502 ,  1944390845616545815 ,  292177638200902444 ,  1478238690716593299 ,  223245828515187539 ,  144027231296429790 ,  556220394648118897 ,  2233787420792105788 ,  2150779706770653685 ,  2071697474255244411 ,  1376693048470041996 ,  1507200606672055484 ,  716323877517467000 ,  1600830910666594210 ,  2015743675266100533 ,  1554884723622316963 ,  377611538253804115 ,  241605709690220047 ,  1322420573540513490 ,  1195950476070881437 ,  2290250481039101762 ,  1715645554330301241 ,  779234575404553276 ,  1440420854301238909 ,  595693668694543260 ,  1369866388503353449 ,  1109782283075392141 ,  236017212497344160 ,  535731886317083189 ,  1885533100323584499 ,  284595438423368074 ,  1408531323143091675 ,  1477659173978236762 ,  274311660209917610 ,  1508025918704521750 ,  240314883143453517 ,  220559613129343279 ,  1686385790473874255 }, // x^2^545
+
+{ 1150519276069073876 ,  230899542235344618 ,  2188831799991119303 ,  778784692142306276 ,  1309526054283087141 ,  620631905806837199 ,  472843635420737787 ,  1309137859995112880 ,  1134650754027715722 ,  415957654460428265 ,  689424482862721688 ,  2040912033523241859 ,  822676715811098171 ,  1475230989479938648 ,  1858044077218897130 ,  1328947593404133568 ,  2132855367751223522 ,  1219924145941809886 ,  468757535531401873 ,  1254361255153001750 ,  1293507034062580928 ,  775777379467288162 ,  1557342233412146547 ,  1181213595999865024 ,  94542526040664551 ,  1795278621361697191 ,  2188439379986604289 ,  126502833791714952 ,  2109916830914896727 ,  642156065033634895 ,  2095029073557384346 ,  1551666520311743706 ,  2038126385140237307 ,  1962858755041478725 ,  1645093423376691959 ,  2175394307243830073 ,  1145891556503484303 ,  2281255297484678714 ,  1631366909467636125 ,  1260747316092995277 ,  233768572170574792 ,  360795786753967110 ,  242708921770786247 ,  775610321927406996 ,  1218779379828423307 ,  89922883518825905 ,  773955476447773626 ,  1924581240542428747 ,  2136545352759312514 ,  528983824165839898 ,  1950481231197908570 ,  962052591819993583 ,  1971196561382312061 ,  439264668114206125 ,  918019574890309113 ,  1773888468797339080 ,  1479799790765285182 ,  1848126106753484257 ,  73552919776009303 ,  1514915516714152575 ,  1219599949633654612 ,  1813542299245438340 ,  333606868172324658 ,  1560355186462456743 ,  1569338342476646685 ,  498597996213444043 ,  981679234368737961 ,  2249164850404124576 ,  2276320619371457551 ,  1594253561506645038 ,  2087244861632507899 ,  1151084330320547 ,  1566368087174282757 ,  1674644695558170810 ,  935303300302270072 ,  27732487902217748 ,  1988606900340518813 ,  1721390883617959495 ,  1389236950121038959 ,  1376627517919912292 ,  1096542376878143469 ,  16430150001709671 ,  1363569490528408999 ,  1256814312596389995 ,  368089578392444279 ,  2008267333611399369 ,  2176634732530469596 ,  44254170198483665 ,  1614094409810717130 ,  1704719498183789849 ,  612604986487180687 ,  1691311157055762491 ,  315105884020854370 ,  1288725713529737678 ,  1686144250765147431 ,  758881442581709752 }, // x^2^546
+
+{ 562035433121172772 ,  1701440164383885864 ,  748175241762823872 ,  319820265871888252 ,  1968514135592580865 ,  389700469684041285 ,  1881370343352488592 ,  1262717985388686430 ,  139584165317208838 ,  2100501886073511101 ,  1035193560976489717 ,  1554729579915140987 ,  1154405818296680979 ,  1960703028394603527 ,  375278376714701928 ,  1167652384085362637 ,  1277805896558525203 ,  275406058065837075 ,  2051226248846186250 ,  1946986329348670594 ,  921600879652283710 ,  1316367416825400393 ,  71747911779734954 ,  1932595447442697920 ,  1322902014939343496 ,  100368170400774389 ,  2188900503204354326 ,  2275501151862423774 ,  686794355845659148 ,  621612847884532008 ,  517886521647900895 ,  2200608074061279202 ,  91544010893560919 ,  117222686455312977 ,  1573160948620544223 ,  1653023156105625274 ,  1495611525232076118 ,  1981489479311786749 ,  224218917614460062 ,  1173482037333076649 ,  1206140704095536231 ,  834152899282260528 ,  1058132283600703583 ,  1216651329058679441 ,  189201808193851645 ,  1588973274433165640 ,  767169906983254615 ,  555295339955944707 ,  48001796957543390 ,  108185974874320933 ,  228475884071458958 ,  1715529740932165581 ,  1558512041937519354 ,  2182884370686958886 ,  1358644643127941215 ,  687282978694191364 ,  2055162998447010634 ,  1015385099469879323 ,  1339552295100147110 ,  1620977358496000172 ,  69740966147517873 ,  923934202140193179 ,  2122289893601989223 ,  608597420131445666 ,  1417991091752154313 ,  1705261733874619292 ,  2283141779836165070 ,  351446832698203379 ,  1887430179967169091 ,  179225080170029560 ,  1352506413592905172 ,  1090596910835799361 ,  549012188578205859 ,  1151511082533960877 ,  1596339017622299599 ,  355831430965151129 ,  520062200147361848 ,  1501072186933582989 ,  438631562369886411 ,  627298354644066043 ,  608378252908588052 ,  986000034130305298 ,  729502981163349210 ,  678055962079444657 ,  400559508840658228 ,  752756819471676460 ,  972528962665647484 ,  425290516960403336 ,  684187031161624762 ,  2200712575969703126 ,  989843383469840511 ,  1899149317633892048 ,  2277831789771891854 ,  2166725043703795974 ,  1579723191754711647 ,  1819890776606282268 }, // x^2^547
+
+{ 274704516218303989 ,  68226106535735676 ,  988996250786480362 ,  457309946190562710 ,  1217586595488667285 ,  11382098112315607 ,  2186400584626886045 ,  830382032616246258 ,  871529765384885137 ,  1952791821843884175 ,  2051626102545577284 ,  1670089877737742228 ,  1129696556396622125 ,  1988809899276800063 ,  404384755086796380 ,  397396165707865520 ,  2285437526679264294 ,  709324781738890720 ,  1459852023528189163 ,  2145473486476305907 ,  2041848620307466954 ,  566010291770569701 ,  67964118971303759 ,  931575788862930370 ,  1796912695747971757 ,  664613723454310983 ,  717841902588957356 ,  927618511967921645 ,  988799745056043354 ,  832377241492094586 ,  1395627007744958791 ,  800149140681748999 ,  173669117006706692 ,  1415864776303942829 ,  1670117206164702346 ,  723511072873303600 ,  525732328586713167 ,  390307870872215593 ,  1796720926233171729 ,  921168357516076632 ,  2111206443192772497 ,  1966472787779284138 ,  1114367572234332705 ,  2080392682548259368 ,  966157113046586548 ,  1928400452571254206 ,  2229962318548503570 ,  386556311899371341 ,  994339286116310757 ,  2101459633959235007 ,  566921447204280992 ,  1953026006733925150 ,  302136261642905149 ,  1567472807485138897 ,  530284299906616008 ,  72869819433064364 ,  1058622140030664718 ,  439326569797839115 ,  911587874713143822 ,  658365046932288585 ,  1539995408736365393 ,  326166114366475463 ,  2087445469418705948 ,  1169224487579478482 ,  712599684368279995 ,  1885909563092997268 ,  1496243929766400031 ,  2042012704391959485 ,  553172367487592166 ,  1081275175782830881 ,  1616989370718179034 ,  784803993419849747 ,  1019476147511912898 ,  1560119692621031148 ,  1730469978857589281 ,  1978761614142823105 ,  2214639430241358058 ,  530360194496737484 ,  1321381132446818521 ,  635541998902320854 ,  1618905096220311844 ,  339745415308431131 ,  1816705535684217028 ,  1162239112646576910 ,  1436300814078499229 ,  1287897968807474295 ,  1116170808956442507 ,  1047466488799037384 ,  802518739809158709 ,  358147634824915192 ,  724237525528766648 ,  1444162085576041729 ,  611157255651440573 ,  1048528296784815653 ,  347160645339274047 ,  77861826409009967 }, // x^2^548
+
+{ 185591078643033680 ,  510608970490233922 ,  565393207311092820 ,  411984654885111961 ,  488852721156394094 ,  269067623451608956 ,  971168022027515369 ,  677440131002373293 ,  131334380846222361 ,  1566400952462854972 ,  305660833715986554 ,  1203280295560176987 ,  1537402883366148777 ,  679631543982046501 ,  653266282932082795 ,  2161754696572277275 ,  1228935526834947093 ,  1828257648644818237 ,  441538495859513416 ,  1315369482546118038 ,  1991568424754682931 ,  917551261658022336 ,  137326360963631569 ,  1773156133070647792 ,  1530171278070094810 ,  1557243377948021664 ,  1717392041967704748 ,  239778424873502418 ,  727643883931747314 ,  1435326930485272480 ,  1422099679751438823 ,  829697147155344754 ,  1137703226870945199 ,  236550130766008137 ,  843608768019331809 ,  1149373745601475185 ,  702366752179304278 ,  1722519678364351262 ,  1099447752126545944 ,  1244376443175007727 ,  1631531131501858660 ,  1570341745227110293 ,  695320605727259237 ,  1799314525343179344 ,  459678408637654224 ,  977427683552062064 ,  1193632215465065385 ,  787299266638382536 ,  2180624254174780689 ,  1361388734220646364 ,  843914659859737594 ,  1189738980401887954 ,  1291215363293710855 ,  1701680709205494398 ,  453169888188098101 ,  953750498820473443 ,  891391981086791988 ,  919574175183552931 ,  1149976028494885796 ,  931944325099887768 ,  2061793758027473267 ,  1369414019470561085 ,  1235002891988607613 ,  410226759026052626 ,  2060385678530992009 ,  451252602078283699 ,  2280407816954859457 ,  1406900094615648818 ,  731118150713888859 ,  1986946814544358821 ,  35703187606686192 ,  885637260602942477 ,  1838885155782732448 ,  1534698494986466552 ,  1278909320085120765 ,  1543762564668877500 ,  1936748880454805928 ,  1819200754238920151 ,  1366898473381479475 ,  1035940997485653990 ,  1706005700850052710 ,  502323227599959946 ,  357645928930862936 ,  166645618926369013 ,  1833822796673498804 ,  991718723732524309 ,  1734082374703414246 ,  2141730802082507801 ,  1243457771018904158 ,  2008335641069858589 ,  154389363583702937 ,  1650446430474452944 ,  1182959646447379930 ,  622635346411951464 ,  940497175461648010 ,  786557567261474002 }, // x^2^549
+
+{ 1920875189679224707 ,  1643397988084469051 ,  2086751297392957634 ,  1012860077867984973 ,  45528565544651766 ,  1128618743491050962 ,  802254166782173321 ,  305237321601971525 ,  113066597745689623 ,  67810112356563957 ,  317000157735905921 ,  643750861621239455 ,  780459955672416328 ,  620831214183637271 ,  2058432898794641093 ,  30218129576478870 ,  1409921709761035371 ,  574205946182907350 ,  985390964868505636 ,  110051963098421368 ,  1544206873077768874 ,  1619431104935037876 ,  697036806446529828 ,  1499064507186119174 ,  1685208886339256725 ,  1113787318959784208 ,  1728625760170570593 ,  651161651028680140 ,  2170583161033305319 ,  1718960613714297029 ,  821764745751685138 ,  1945860185559376429 ,  1038489523681764667 ,  1114857245207058886 ,  1729282289296808536 ,  467941133110372068 ,  2034234395461142119 ,  928488222699120492 ,  225703298227823288 ,  569447234788076847 ,  2301302384911135408 ,  334685237502539837 ,  1972944122384192247 ,  409584851659049585 ,  1808414702981054739 ,  1908912663504477863 ,  1977175373592546750 ,  1307310076611971055 ,  955189145834774938 ,  1837442620344503521 ,  1433797123345990931 ,  1448603411217510623 ,  1588558755829598811 ,  104812490743162112 ,  203120066171216753 ,  756983704600959488 ,  502365597879195075 ,  234149147773140457 ,  2127144797970031388 ,  1948352385376374377 ,  808189843772268272 ,  685314613553460999 ,  2219155298434439134 ,  2021396814335332990 ,  1244400950328193183 ,  2217317969180880272 ,  586058197407571705 ,  852794298312562991 ,  697400532111289954 ,  322858422298231298 ,  993894488346693670 ,  657607101147730520 ,  1281732680686615160 ,  2223753558888535440 ,  1932442163092990658 ,  1812954880417511367 ,  1698773093905408422 ,  1285816382807336842 ,  1590188751023548705 ,  1957846528815672455 ,  1202992537727584697 ,  1719708084890485533 ,  2007691464393193258 ,  1076386698040881442 ,  682428028738974271 ,  1086819599386602173 ,  1676149798755244443 ,  469303971017097877 ,  954141701012954003 ,  1203623401306265642 ,  1452135104427551724 ,  1581480224513159693 ,  2052621557933721587 ,  2249066144103450659 ,  168042937869627901 ,  687152427701026619 }, // x^2^550
+
+{ 1570384140256366854 ,  1362934078570801316 ,  1138169293248911782 ,  1950038845607712524 ,  1548789838430255024 ,  1522375934499182138 ,  1352587325656711345 ,  2029219131221338281 ,  1250213313006742432 ,  1763291342560484429 ,  1022107461676002297 ,  2190271925806566763 ,  1956619116597644531 ,  1049759107751189392 ,  1013636665160424415 ,  1153788246780846666 ,  1589832907440812858 ,  743340415977476700 ,  1860202774926673161 ,  339540381768232267 ,  77967248495220096 ,  2149644245928549028 ,  408745948402258476 ,  1313675312795529751 ,  2253027541360486567 ,  2225034777327190245 ,  1362874637801381803 ,  1641065667940026870 ,  698404996302924172 ,  889902446254210620 ,  2202489701503273318 ,  642730325458027675 ,  757789436482903163 ,  1111280619800203117 ,  1769249355445575181 ,  2284828265226071801 ,  1428166940015357444 ,  1396909237714216504 ,  1948549757930153433 ,  567652585144679882 ,  1658596997656974913 ,  193515312694204394 ,  1313293117631658050 ,  495393141167280811 ,  2028185766526218945 ,  671377742050334370 ,  2020717516775555675 ,  1467303683470458009 ,  2241391961719345596 ,  1210096924022281341 ,  798606284723806164 ,  310015642463160020 ,  2215391087691531368 ,  2031692816044124382 ,  1108631372595746327 ,  426028654328295451 ,  1258471064409911380 ,  1816390118917228930 ,  518657856787024673 ,  2036271391525377003 ,  442459077468665794 ,  75939513528385959 ,  1355184290407810800 ,  1633483504141981016 ,  1928126198287241623 ,  930477297976228673 ,  1048751950179215137 ,  1819017994528544947 ,  1130833533986680306 ,  1406834503239093954 ,  1969340281064632888 ,  863571252536585466 ,  916565066642703857 ,  257305793571703336 ,  299260226631900595 ,  1416889182698164381 ,  1528599527051611712 ,  1916174674938154771 ,  1472074846016701787 ,  551613469835634008 ,  1604267958337965728 ,  340224874363907530 ,  1974158138316487228 ,  1570980113928984150 ,  407668590398876786 ,  143719484217341921 ,  1833942197997346971 ,  2177448622719768260 ,  805996068482619398 ,  505045855361566785 ,  393922611280733166 ,  2168539939148492733 ,  494795816426705645 ,  947153108442540723 ,  1019133507503594298 ,  961284769485538431 }, // x^2^551
+
+{ 2278419413127575876 ,  237498091436803138 ,  309034743274940138 ,  1283901520473615541 ,  1216664247070579149 ,  1977525905179816375 ,  235731524974467132 ,  1051378977008131673 ,  1713158500937498673 ,  2170624153521339391 ,  344373215500775297 ,  29674488024771692 ,  2243826924145412301 ,  1748166383672810302 ,  1044626473450424962 ,  2142872452941377841 ,  470218272996747311 ,  989410906798966489 ,  2063384622832751460 ,  129865658172450070 ,  1340670780627570053 ,  2038814053100554459 ,  1677764720028416729 ,  800394951436528201 ,  2057962011685955459 ,  1532895200216592648 ,  1938203128774189826 ,  700151131090790103 ,  70093878261633258 ,  712348969301248788 ,  1208380818014676898 ,  553567732633244778 ,  500161785598673938 ,  1782128998543927361 ,  448119903401296843 ,  877176463595424350 ,  1063632368422915527 ,  64438949114497029 ,  1697331339805047180 ,  398093851559932338 ,  788185048040767621 ,  1817909553955692595 ,  48618726169477521 ,  1724396443217417989 ,  1598840911624364431 ,  554387694996794629 ,  491455764600562530 ,  438876306803193119 ,  191856542425137510 ,  2144250083299519602 ,  821781202931087948 ,  300046765344953022 ,  1279191235445497055 ,  118079399583381331 ,  1465095631967776202 ,  1496322417074853391 ,  223008658332443542 ,  305777360120625434 ,  94435142165264812 ,  758375546957678792 ,  251802915123612018 ,  1035784762593390192 ,  576969238113142565 ,  745274328780062221 ,  1626561193301622288 ,  2047136147434796013 ,  1167920296912364885 ,  1481166496575889667 ,  730283322012679580 ,  1354152734048993086 ,  2029244104814202326 ,  1908889977071986203 ,  206964054719517306 ,  102685240932786488 ,  2092804289845183115 ,  451602745998786585 ,  2130530370382017842 ,  1884251526046426169 ,  125072686859141065 ,  921123938736158412 ,  900884445944224815 ,  1931320452631646259 ,  865130341335157749 ,  2205283118640952066 ,  697032702928710439 ,  1178198087226077821 ,  207783599630542815 ,  2135576034606283217 ,  1892594761750891940 ,  586593327570274432 ,  88795699101580466 ,  1661007633812353301 ,  2235273331065637948 ,  87396005398570647 ,  1748712437704285903 ,  1316857998613009862 }, // x^2^552
+
+{ 1332641094303660453 ,  334565635416695574 ,  1353153813304632087 ,  112758602847834367 ,  1104516783933426742 ,  367488554342088056 ,  344908777214501634 ,  1874245358444813319 ,  771203331900114506 ,  2113234542606791199 ,  168289892275665167 ,  1478952507058538507 ,  666381345975121098 ,  839738917354114440 ,  237259485858396626 ,  268488280964270082 ,  663666297180694252 ,  1169478298459841817 ,  1198439000823054700 ,  1538404454122100044 ,  1992129651921344851 ,  2166556965154558819 ,  924103632097503982 ,  222808494840520299 ,  2197322213885821504 ,  688461835410426433 ,  824477862516674431 ,  193096884218870421 ,  1462061004890811930 ,  2026121519616932015 ,  84941699276725154 ,  769469074721173691 ,  1049325740086221121 ,  1210722054214302835 ,  2153378905545481874 ,  1611015651132136561 ,  958637568043215412 ,  2002105983762750091 ,  125177286487014199 ,  941216285970492110 ,  1911063646360177150 ,  201604173568806966 ,  1206266881206234331 ,  494450817458403305 ,  2072861785716473728 ,  153416389666037451 ,  291301488681280498 ,  1547037605682842165 ,  1770963367512198494 ,  1975690967693011294 ,  221365423480847107 ,  953633730337064171 ,  1184902668829285573 ,  1504714198605411429 ,  1931888105200443718 ,  2224502616744740657 ,  185390368061965483 ,  533486728124731714 ,  2068506187429551976 ,  1306941536875004914 ,  2203906495919864881 ,  788046437060680577 ,  692992920363878444 ,  1473133246851394687 ,  1654212072411574773 ,  1508678353903810879 ,  649990455449221917 ,  25597100499695701 ,  389276219830375740 ,  1687288167757490647 ,  1029957883214116797 ,  1380617208294303061 ,  1119652820632968066 ,  49711599162732493 ,  1884502563374618641 ,  622536579964669781 ,  2093007361051989265 ,  1880785979617109146 ,  1836879252227510626 ,  2111072004009158752 ,  1068749511350819924 ,  1559992700097180613 ,  198726676573576244 ,  2128886730318596727 ,  1705597659695536367 ,  1084099293616829722 ,  596031134115882329 ,  1387031573262978559 ,  70706615515122112 ,  16856620426159919 ,  111625715311106276 ,  2069518753172519717 ,  1947891752211551821 ,  486375834542994948 ,  799842915536689613 ,  192504456637278062 }, // x^2^553
+
+{ 241009204576870073 ,  1986088494934514102 ,  518011432559623673 ,  987229695368380113 ,  1953035087356511933 ,  1486112577775660208 ,  721778597686647141 ,  137752851583330946 ,  1141276793833124032 ,  1911588702222573441 ,  512675223344398731 ,  843465542981104658 ,  653489796845390724 ,  1937140901692175767 ,  279618249341772727 ,  2079961678596626252 ,  120502786245133998 ,  2123818651174598187 ,  1577616263470228397 ,  961271580950030959 ,  432137883403463736 ,  1509708274968489795 ,  2149773204504420366 ,  942767642565377482 ,  2208875361822737232 ,  1524661923673584401 ,  150473438696517535 ,  1236237854480163917 ,  874253801610223350 ,  1182221539238458346 ,  2257117241967007389 ,  1169807233668634257 ,  2244072759539742832 ,  358731251434078520 ,  1567621194935955643 ,  2201634912827380607 ,  1303101109834272045 ,  1975336337383259421 ,  1590104067847683717 ,  511410208448465299 ,  155882549435810560 ,  736974363940555099 ,  1208904273159470659 ,  1536213906430661645 ,  2139111451625777621 ,  654402737378677378 ,  1260062805308038574 ,  150096734820143290 ,  2212250736372939761 ,  960953410280177464 ,  1840399880646449361 ,  2154540968285196688 ,  1500867671732678831 ,  1833200398640428868 ,  2282283470771862283 ,  2242553874234377803 ,  1871235534768334171 ,  46143995903202439 ,  562899823484164450 ,  2222285725883649666 ,  1493271794505269388 ,  1879245781364249351 ,  1547033766988337523 ,  103119250162411886 ,  443901126388928157 ,  658301739788889382 ,  2089915349378897912 ,  1992885433117265110 ,  1963277923062414369 ,  1820344579904594707 ,  509865189451954173 ,  2013082872095447824 ,  875177993358663748 ,  230018201129266456 ,  1596975184562277705 ,  1973345572869669555 ,  929179162992336039 ,  2002562085906793890 ,  2001234692060943614 ,  203639379125737294 ,  932117485419738265 ,  246282953546613633 ,  1928157975872268391 ,  215325277709735710 ,  1084909748585018306 ,  238194433632348769 ,  2214191079124124272 ,  294012281134301375 ,  1370641898957209462 ,  2190893135700515234 ,  1067999753291585774 ,  1359790707234478148 ,  133399880934579480 ,  2096174745731287920 ,  344420086059253302 ,  847087131214298862 }, // x^2^554
+
+{ 862808406005895258 ,  835354224140979508 ,  1466354864945586400 ,  1241732104901303615 ,  1183680139498830612 ,  1368021311837793464 ,  1569756719059884255 ,  10658354147999742 ,  414514071894947063 ,  1648377888936888673 ,  2247939180228371859 ,  952154256063730346 ,  969887271468093338 ,  1405235184212931356 ,  741548422091869487 ,  2210543100626245737 ,  1659040165413164848 ,  1888258788846531174 ,  1783661847418340119 ,  1759792356032479207 ,  551582192178899143 ,  607965235775102208 ,  863929972848418481 ,  1980780085186256968 ,  1162915111071686015 ,  669006797806492697 ,  1703702448526729063 ,  904859678930391245 ,  1834418498461429786 ,  1056221720702333466 ,  1033971746070020709 ,  388372012238465586 ,  1337139221794728636 ,  518748851302828231 ,  441355700284206889 ,  842804364685136447 ,  1543034052254509424 ,  721451456169986221 ,  1679812922643047467 ,  1356824930317897862 ,  192343642569548988 ,  180345870858199713 ,  663739191509044801 ,  1475747272330728313 ,  1632948319963509612 ,  1715241219481498494 ,  944537513642232515 ,  298732609864859020 ,  789399581392061648 ,  1868211318414469119 ,  1585881865024478386 ,  1764763243967781846 ,  1062058661533122805 ,  1299771017657191082 ,  1999352598166755958 ,  710919248393874934 ,  1361042902509649631 ,  1380406375065984351 ,  1818291615844790197 ,  660999415480567336 ,  231572267082553576 ,  2094201658739185890 ,  2192293924830553832 ,  2019121083666406234 ,  876345151016960304 ,  2176180013609300457 ,  400274073777351490 ,  2132682729745021180 ,  585612873847840880 ,  2215707786769783151 ,  1250878991535776181 ,  1145469410771544271 ,  510230090176262553 ,  193358166256156197 ,  1593939593936884257 ,  889743046465434399 ,  813960046608191324 ,  453109909168477808 ,  1966698928942668737 ,  2044014175099499993 ,  952851979752834808 ,  826757373227721194 ,  1907196447308294896 ,  1666830654343829331 ,  809502345273692041 ,  632845683792725707 ,  1976138629726330208 ,  1426457471922084331 ,  567783247661929709 ,  1636364011225424657 ,  1002233502709567058 ,  34804894718572663 ,  683419413908484469 ,  1656823985711193421 ,  2121551805514119261 ,  763318675304094740 }, // x^2^555
+
+{ 2284090454903372000 ,  850651920727539092 ,  1346581223889584039 ,  626067607041918862 ,  2288134194115950157 ,  1521537847531463351 ,  487201155318180174 ,  807875148961144892 ,  58283475150608608 ,  990181048971637546 ,  1445938250760306600 ,  1743882408211120880 ,  1259594846059198941 ,  2154299668894337184 ,  320582273039097420 ,  1363176975785077925 ,  95071246055092142 ,  1710833472933576436 ,  480624506038805119 ,  1062330724431321331 ,  89605322284026620 ,  2187493707571825692 ,  1874349058116544029 ,  752893243650118744 ,  1306859280802623357 ,  2161528697644496331 ,  1842356001902484737 ,  1644467770986196445 ,  1650842679617601869 ,  1340126497212641585 ,  1357120256001742769 ,  345101774391819935 ,  1441882903124831603 ,  2100972272104287231 ,  763383044893244468 ,  1588018987361315602 ,  186692477280750453 ,  1710497149378868012 ,  142345314849211360 ,  1437738134655872685 ,  1837936933169275019 ,  923598805868286365 ,  322849365598017636 ,  1809977269750367150 ,  1553144725069560841 ,  210896942716784320 ,  993820148253431820 ,  1399122920851343595 ,  1649744990655105546 ,  272528812328088657 ,  843283829574507564 ,  1301110428079967018 ,  786534216280266668 ,  1931386224310519227 ,  511824219803746002 ,  117313063626138762 ,  2133689489652889304 ,  1327295710444099238 ,  809127670823425859 ,  1279971689227132044 ,  189874831921742568 ,  609043584720942718 ,  1687323289744100425 ,  75164183185479503 ,  2268458747559976181 ,  2012460363344698570 ,  2292952387582477204 ,  933040534630577702 ,  1878730534470246267 ,  164936530490845978 ,  448406382415990241 ,  2187080980436143953 ,  1887057024896441946 ,  555258917189862183 ,  1797829476864777988 ,  1702876109569100493 ,  1784164491230193657 ,  2193279357078602464 ,  721535599356411460 ,  1857997684024531723 ,  657098671321615210 ,  1346057382455531705 ,  2100720182932451567 ,  1260069097567156713 ,  1356310479832886768 ,  536354305059716573 ,  1389916731764685645 ,  869806024412908525 ,  1059555349055405804 ,  452945283435752044 ,  1746528257975595377 ,  606681986058825140 ,  725044407161261558 ,  281464974063398748 ,  1126268084900521915 ,  699960457761169159 }, // x^2^556
+
+{ 1040498457121340352 ,  1702906259388492200 ,  2236443369052643809 ,  744542068628264061 ,  1368955125497217292 ,  206654866729426725 ,  632843109432866239 ,  991014417616202732 ,  2110941651232018265 ,  2283544089168412036 ,  893635716362222042 ,  1066900362094156111 ,  767086471573700389 ,  706774255849210700 ,  1722157244652954004 ,  395012374550052058 ,  54038834202574065 ,  291190604963620050 ,  1245069818707691930 ,  1791482430235217515 ,  744231683641553404 ,  952974485379075211 ,  1243660099194130882 ,  2195499209182445114 ,  746447047467382089 ,  1949251823554814525 ,  1180682437084716205 ,  700019143183641011 ,  1073212691192500161 ,  660593436572857433 ,  1054498021817383845 ,  978881695591095166 ,  1949193021615561500 ,  1871066708691214674 ,  1747445885228141184 ,  1493516897404155130 ,  884075283248569295 ,  260395695219763924 ,  1204019313380663432 ,  937167592939167967 ,  1093429209645738209 ,  2086215042974346371 ,  1454935148629418369 ,  224901185603452593 ,  47311970064630294 ,  534061478011439797 ,  394796028697295965 ,  467819755566342416 ,  2094929161530950976 ,  1504323691465982179 ,  537212581886004515 ,  1252599936554496439 ,  1015304855416156583 ,  282359858295149846 ,  1115044578072917089 ,  369243949746084595 ,  244450631250089342 ,  2081681575850763699 ,  1115288634283893677 ,  958636400995087613 ,  2144995838468733514 ,  50646368667602869 ,  1760981848957330911 ,  526649623582195863 ,  1044653044377793708 ,  536083159660765960 ,  303115250970693083 ,  1325513270668191724 ,  971612912042390008 ,  1726730959789151162 ,  1923585212179083556 ,  2219245482833613099 ,  2141133720017772704 ,  922667224730932309 ,  2291009218382880799 ,  1166546339195046044 ,  847226118962089325 ,  2156844637884572579 ,  2033618360272394337 ,  1887335878935472315 ,  1472379633853325796 ,  2193573216391696748 ,  461937059588159483 ,  1386094634328480179 ,  760890916683067301 ,  1903754142322901008 ,  1667858214718404385 ,  728757312850693263 ,  1188479684623314984 ,  1726226298228655253 ,  1136352000567522731 ,  2253786907551155084 ,  1727131968976091877 ,  704635697331415291 ,  1795701282885024158 ,  41101135339217389 }, // x^2^557
+
+{ 60380545388744152 ,  851129360942482324 ,  1383574207126191496 ,  434010759196664017 ,  1923700707068683318 ,  2038124863899505743 ,  985241519336683794 ,  2197728422202132925 ,  1514080242573266216 ,  722364745006060094 ,  1305016971255950767 ,  1209638447329182122 ,  2277946405421890932 ,  1625849653435116796 ,  810454561569768466 ,  1167669394511529399 ,  1116225716991901929 ,  1044050210097617749 ,  2061231316541249145 ,  514262243577762925 ,  247380894541138099 ,  1790902743750767685 ,  83922422753494985 ,  353296381982461656 ,  226885806712706865 ,  439064997393938953 ,  288024630044069478 ,  1225972463092017078 ,  2002257213791167103 ,  2187359606500298853 ,  761928915742741269 ,  1774728258987778155 ,  1563938951069511165 ,  315989571646063290 ,  792311780779743017 ,  351142438073367708 ,  1702210628564538888 ,  692834303946742383 ,  2112230466685669205 ,  1824262477753280821 ,  1367319444356637608 ,  1607287145216376130 ,  100857960774732076 ,  417427352452898266 ,  166177737021618170 ,  261585789682157329 ,  1775845014357574226 ,  452746619833062797 ,  951468544088219730 ,  774845882879552814 ,  2294496600791520950 ,  623601631448463041 ,  1222250027462928641 ,  267824703460335873 ,  252731163786110117 ,  1981671977614254931 ,  1316777441082733052 ,  1256177729760916732 ,  773208802294836248 ,  48936916186687212 ,  2223851112664427005 ,  591569673634393604 ,  202240047053049647 ,  1625584502163131939 ,  1186042783953099834 ,  89188177688023186 ,  1983369474452531059 ,  2127821760354450184 ,  45867270872932576 ,  1520280234990894073 ,  898992526054966490 ,  414557868165981727 ,  800079267606114689 ,  1993279106276786171 ,  2021657307321194116 ,  1408668818328679888 ,  1043264725110071154 ,  1728514752158311694 ,  267099358472345315 ,  1810775592365054023 ,  2229845104179333359 ,  516913182617390521 ,  1333449876735012119 ,  1690791093326779464 ,  1227061961702715433 ,  672081688667938535 ,  365024317193128587 ,  680315737242486574 ,  463726770083727225 ,  939759869502005141 ,  1179243973576611904 ,  1065550463020419217 ,  88374421753635323 ,  435697333423356193 ,  221122312874635250 ,  1785215514714158034 }, // x^2^558
+
+{ 995319141539784220 ,  816765955352374147 ,  158250715610656041 ,  1174024687369458531 ,  1605443249286313241 ,  1622635736860714224 ,  535929712948574139 ,  1437867631157943388 ,  1481447995362688427 ,  255817946789591778 ,  1737333448321692854 ,  1372314540438170733 ,  16275325614594648 ,  1113082305042273806 ,  1452903481390760760 ,  1919212214250480347 ,  1084065750180179104 ,  2244238735865205909 ,  1507565578076832555 ,  1086046430426607452 ,  731452374392113241 ,  848232801217182621 ,  1112015612805757614 ,  1694042790185546924 ,  266068008281959712 ,  1124197525027513865 ,  1230062227435202349 ,  585537413468892572 ,  1074048793822533569 ,  1015763099877672942 ,  1277524042150449595 ,  1836590624074582833 ,  2094597072728641043 ,  1100787012641432109 ,  1163592191202116603 ,  420693007623726047 ,  1774341207392229962 ,  342041122078692952 ,  1533803187637227974 ,  316524430065518963 ,  591429545264125308 ,  1607250140705515026 ,  1792565560931957983 ,  652891889711482409 ,  1919662465806310735 ,  1231080454551994433 ,  2028288041951548402 ,  2140337290746228505 ,  1997236649996291370 ,  2166457848984195411 ,  2190171981374332353 ,  55823864549258413 ,  1796260907734776589 ,  588890276791625240 ,  412874118735922577 ,  1748006305384726495 ,  480608868127683548 ,  195019181320187875 ,  964980818341514222 ,  393392855237247809 ,  576951346386630479 ,  290004920355703255 ,  606726811901238001 ,  1574593367437027986 ,  579251841878184796 ,  170259347259325136 ,  2071629313566852575 ,  666716651202746699 ,  689262301878286429 ,  2246801169053264941 ,  188270119613511259 ,  821941120958017466 ,  1313889836449656361 ,  86324275965408316 ,  292238805650147192 ,  2169076776648145472 ,  1103020788648104063 ,  2207330069181542198 ,  2100797597619203314 ,  2251226808628519475 ,  2057344387883794953 ,  1835120042940722957 ,  976322208086881965 ,  2184291445578508357 ,  2015030678441853378 ,  1498594984815198656 ,  370977863155664553 ,  1830040792950264074 ,  1644864406370805042 ,  690203583160035582 ,  1900387594323358893 ,  1114921302192554262 ,  1466393731985819734 ,  376679488264694917 ,  1439255534124920257 ,  1822790096648967567 }, // x^2^559
+
+{ 1932917552417283194 ,  672846471092995333 ,  1260453446004097960 ,  201087362769617979 ,  1209294020969490307 ,  1725102072576982983 ,  2116148493362057199 ,  1870139305647187301 ,  1083456903283469357 ,  674327828752983182 ,  2042913612995228885 ,  1096957141766280419 ,  2302334876668826343 ,  738351315958943328 ,  1336546165573379307 ,  1322566572720206825 ,  1232541440270671063 ,  683340981551293525 ,  493616554048664944 ,  982280889243018321 ,  686750516381904575 ,  2166363141080356325 ,  280755374056610016 ,  1496789026501025893 ,  355625050535757197 ,  584994167922335920 ,  1720931804622128870 ,  17890821031007796 ,  769851491706026184 ,  1775733058314446443 ,  1824640648128977333 ,  184435325330730484 ,  1070420388211551284 ,  1529351095108869709 ,  1539430802458477880 ,  968443655117880284 ,  870882758709885450 ,  475007905372932486 ,  538694373635068238 ,  550909991730163168 ,  751497296192154653 ,  1251964106717090358 ,  226777402117848952 ,  62459226542301400 ,  1492520242606883151 ,  84236465959243595 ,  339488848421393726 ,  100873412782653127 ,  1057490694762901706 ,  868563797359897524 ,  2268498833250222615 ,  1859805588247065961 ,  1301987913352273579 ,  1915258005149088704 ,  813698087437188452 ,  2046110862611432249 ,  1499116121199394419 ,  2190978412064203756 ,  2088668649865296341 ,  1452495815368367588 ,  2282421856073626823 ,  925203135852580233 ,  2060734494652748779 ,  1103781269404982553 ,  269659213747910230 ,  1015614658982428417 ,  244969597993141045 ,  566671790117110518 ,  903426046048551789 ,  694450257252155447 ,  545381172229908056 ,  31035974485144446 ,  1156760670332769153 ,  1190708537005270506 ,  786307654501410611 ,  698693552961856041 ,  1898501069205471733 ,  609026154901142618 ,  642715271687406358 ,  1211995940087103112 ,  1275058074253145473 ,  701283309911288829 ,  204041380833460738 ,  2014696174383173393 ,  500907563790536065 ,  1332791020616837631 ,  204120091768779542 ,  2082392180708030237 ,  402930365529221118 ,  1276042390517761202 ,  414816585724490805 ,  1021771704200626039 ,  2129608568985150840 ,  1548934161737994152 ,  1734515015227596210 ,  1178883909385362772 }, // x^2^560
+
+{ 2258135587564726435 ,  1003438932481318611 ,  1820833942583286515 ,  1853592181768962448 ,  48208090393106498 ,  1476485696382804354 ,  712757416232468955 ,  93007892777841625 ,  2299958290053134337 ,  1231288904925353855 ,  2133718022940792619 ,  729837970220408389 ,  2198718658051176263 ,  676504772925807582 ,  694556611478181214 ,  1854002164413873184 ,  643831227022352752 ,  145093069764714444 ,  1539219105308879546 ,  762719484734178173 ,  1292325428441569923 ,  1130434923711423435 ,  672102468560312603 ,  1789571736272276392 ,  2214089471900486148 ,  1361898614449009836 ,  1974505881299857478 ,  174560960216276327 ,  1501465505285744253 ,  1868515281027307950 ,  411004757578472582 ,  934994007328251503 ,  508520065066254879 ,  110670201389238259 ,  167627709991672396 ,  801798858172728670 ,  239450663096152594 ,  1550988975343527226 ,  368298667468507396 ,  1988224300336915782 ,  1605975231371421503 ,  740305834449270956 ,  1745907570177939507 ,  1663763119035556709 ,  22768726245649772 ,  2104455263995126032 ,  44862833961117748 ,  361922123789506335 ,  79494533154298112 ,  2014327195388989280 ,  1309979791917799636 ,  796244636049785831 ,  1068710459588755921 ,  227327040475397302 ,  649370085858082621 ,  696518770820273923 ,  1259436145419686200 ,  940578885523065556 ,  980840168542018379 ,  891118900325611878 ,  2167352421236871647 ,  285945826580839495 ,  781152322633706242 ,  1882604864765844279 ,  1953506446002399009 ,  1111939075382967652 ,  2066898728513400997 ,  684510614290269058 ,  1195194835956111542 ,  1595696536587866477 ,  657400577291254363 ,  2242176202499028077 ,  344760749415264316 ,  1045231657684731874 ,  964684999372418338 ,  1533510301432102026 ,  870154452558731773 ,  347335991026318355 ,  1014206066204550012 ,  1519818224692991563 ,  2251904712631998856 ,  395228372150471764 ,  1635163188538991701 ,  897147891168407235 ,  1924375516350818118 ,  1699722570203099730 ,  1329451527388033297 ,  485746690858898366 ,  1997934652400336764 ,  256883239676234497 ,  365747757269994621 ,  2066880931205667617 ,  998010075417631169 ,  1676166246332197685 ,  797545502863428783 ,  884899778605215043 }, // x^2^561
+
+{ 1906566442434191761 ,  177105780202626434 ,  1739056119168025744 ,  1790218538626400857 ,  1726564290335761666 ,  1392428810894467577 ,  1159262309580621376 ,  1964539271900507655 ,  1271775917958337107 ,  420471625705912738 ,  816971109452219766 ,  390271609171296713 ,  868421396032941535 ,  12819304140757697 ,  1451937762652395775 ,  1001620597635765452 ,  230783843523632967 ,  416973921304733350 ,  321845391423310421 ,  2151678998640888738 ,  1965152112589733294 ,  1015792027926932491 ,  2280221645265358653 ,  1514399972701253419 ,  2040075380609489056 ,  1105928160426945003 ,  945741489836350469 ,  466640871739923344 ,  472542495091730437 ,  412310316866145656 ,  2059804823486088976 ,  1229258884058842464 ,  1859728818454057646 ,  1491418541909237230 ,  1319235098966495539 ,  1829330358080633054 ,  601339363871859596 ,  1396828135588707050 ,  166187569143197719 ,  935226076695743658 ,  2135714524650743104 ,  381465350137957444 ,  1683275076484298769 ,  489913224930423218 ,  338853549320381177 ,  724540200988856619 ,  111757470275016628 ,  1420972377899184360 ,  485037776704214259 ,  1288880074099850396 ,  1519491639539083008 ,  985957718860321513 ,  438904801468591088 ,  1616432460510176192 ,  1065665641648173368 ,  1177011988613247669 ,  293930020601927477 ,  2184053530760937971 ,  1378989458753251959 ,  299761990965609262 ,  1615671975943372982 ,  1192918954533034175 ,  900993909118303715 ,  1564366672145046193 ,  2084808817387402941 ,  670728044630369432 ,  156316226117720565 ,  597367600385213695 ,  1798783386721529231 ,  1966423848471090589 ,  2243533834564849479 ,  153910630108497593 ,  1794239682636358307 ,  1680893835185834343 ,  1894409054782799920 ,  2159794386254946283 ,  677017811183824345 ,  1091610709467029240 ,  606634022426352189 ,  415435004575017025 ,  726801211107794670 ,  2150402505340689524 ,  1857357139887611461 ,  472080674319300925 ,  778727654854528151 ,  1932212407261136854 ,  1211929106513890380 ,  876001575740917636 ,  2122610766891261172 ,  1639984491856816516 ,  1595215215485368125 ,  795635642451560152 ,  1746174127197725489 ,  798613623038823172 ,  886417481097694576 ,  882069505813315436 }, // x^2^562
+
+{ 1286686600187578981 ,  1638844462399495481 ,  2097717194456204353 ,  430692799256703072 ,  1527528302861563212 ,  21960748383286687 ,  1095735426385750314 ,  492841271621959382 ,  1907260898460646631 ,  2169524496392591524 ,  2176627258664356873 ,  880501238363611025 ,  1253488649853128769 ,  430714327156726440 ,  648708319875395700 ,  1844055780599330610 ,  1581032882407396721 ,  1383263467289937695 ,  485968715778129414 ,  1210460061291574672 ,  868606301539932289 ,  1876893505210997172 ,  1152006454813163193 ,  1893118651229495665 ,  1975687202541717680 ,  217160597964729722 ,  1387401983150838005 ,  439109388449061381 ,  1028871503958486075 ,  2035423957245674328 ,  524167298569455969 ,  579329409659310185 ,  727423329511261449 ,  927935752629282390 ,  1345164563674161827 ,  1596999371747510236 ,  634974547261917391 ,  2276102424532109661 ,  1079992569880727535 ,  396685495112617179 ,  2110432995565680151 ,  1001668278174225983 ,  804468167032118089 ,  730023857427461487 ,  1001639184726495114 ,  226154362137107214 ,  486506808569440798 ,  2033861133343583226 ,  2260036251318550267 ,  2067963595291797224 ,  1024215283461767536 ,  139847374254655733 ,  1449100119101407450 ,  914815775417979949 ,  200628625056386613 ,  1099280774638748765 ,  84571169680498695 ,  1405646117779056391 ,  401427006688301514 ,  120045985884685497 ,  1827927233212505561 ,  540725480844628991 ,  2247244504465094390 ,  871035862397071554 ,  993737981661502851 ,  1491190188275657315 ,  971720428085638349 ,  1500257093696630606 ,  2092534952274855283 ,  306762765754240985 ,  1344083602705505794 ,  1908650481362720593 ,  355197521314764584 ,  1341860143603217001 ,  1428519761918866455 ,  2028371413622612802 ,  1278933241069333754 ,  1142491766742521062 ,  2301933560042958064 ,  152778791763423557 ,  1884107151937957593 ,  501695050055898829 ,  688673442879880620 ,  1338669808056151920 ,  1569752731052219360 ,  241290633534874254 ,  1721185372564420738 ,  519544993184327338 ,  148475097294549716 ,  2217714641179245911 ,  565446651149947918 ,  1879699404560255628 ,  1788010463471470319 ,  1323789530060127865 ,  778701048822582796 ,  1551475954840115781 }, // x^2^563
+
+{ 488899765382315223 ,  923439483899001233 ,  1656213533185872076 ,  476909378212676717 ,  786850522209292378 ,  1147248998940303252 ,  1333235314266587555 ,  896989088479337127 ,  612911993567223472 ,  2276634505410203881 ,  1908302786630146469 ,  1186348309170109832 ,  1341981891197065883 ,  1147099078197366217 ,  1857753806472206743 ,  499087892878653106 ,  120227220582943196 ,  96023818720348061 ,  2237844938505414287 ,  66639909189303437 ,  1389439314036907354 ,  3329481879872098 ,  1089305462301084711 ,  230011523292929173 ,  2060988272920697456 ,  1895296566336354476 ,  994772613861828356 ,  2008826716479418530 ,  452741237297019502 ,  1709821124379124577 ,  2294016349734157314 ,  1740321765232227793 ,  725434941712282736 ,  363242067859696992 ,  836601006171606244 ,  2171859924614345588 ,  2121268062650019765 ,  1941768297628981045 ,  1287216290126100466 ,  742610556520659301 ,  339088349447307313 ,  1583239178376375858 ,  2289035114245528220 ,  796096704427344663 ,  187401429673338428 ,  352966090726804366 ,  1685270819989707235 ,  1409053292290370152 ,  2050635648296163298 ,  1791302988064627993 ,  313847375794806752 ,  767653735674460121 ,  345662789381348391 ,  2285968493502941459 ,  420702466786409430 ,  1336260844096380868 ,  1909238523908721422 ,  999934543916782542 ,  280131500114425263 ,  258063015522239491 ,  139035674167145827 ,  453646161015159582 ,  1971170251153189834 ,  539454504929140267 ,  601995319740717389 ,  682274480921959279 ,  1318317330503234974 ,  1480978571201803218 ,  1890997144470324258 ,  131774564193281083 ,  306724442118811660 ,  530975984081798947 ,  1230802412757327721 ,  29846173458986258 ,  435302316390937570 ,  29065770151526526 ,  1195053771344547966 ,  1385831831709046490 ,  2238401508807549619 ,  108276201436507645 ,  2223639691902227988 ,  2051194695220049882 ,  64813226952777200 ,  142545850275181747 ,  847985781016669933 ,  733935454389659519 ,  1845050273525370626 ,  222133511187674189 ,  1397117506001648348 ,  1603574490442658879 ,  1264951604013331193 ,  1715184590299783103 ,  587786928116741283 ,  1327484547853745541 ,  1171686379132163240 ,  1594775775016268335 }, // x^2^564
+
+{ 2046339855739061901 ,  1601277039613638629 ,  705822405001242264 ,  618342672885330682 ,  869651756818214389 ,  636834849850689324 ,  2081673945298343154 ,  1544143259961936895 ,  635104462514257119 ,  850467913291650707 ,  1259255668288698629 ,  1948862129400737862 ,  1227456894574761507 ,  987219709666618594 ,  1969252047223237263 ,  599046319974882742 ,  1502794486520136660 ,  462266593733409257 ,  2235296463235850150 ,  1327116708052719054 ,  1500962498269068527 ,  1319413273466363560 ,  1455246694572008917 ,  1507170033329623667 ,  1767945361991586989 ,  413986215333141983 ,  396351565239620095 ,  265604163082354417 ,  1810492849796608977 ,  1538739023101814715 ,  96085956167402410 ,  374622967711882705 ,  1949446814297411846 ,  2148766023745518059 ,  589039867518287260 ,  559332902590935363 ,  384882554610543183 ,  641965672635738457 ,  702035465194885223 ,  599414319774530095 ,  826484485138609890 ,  1552466204692230613 ,  366232399840515363 ,  119238150301261342 ,  506626004933078479 ,  1716782223512633565 ,  1398650892024555122 ,  695521413096366962 ,  944014726086752172 ,  290568018378093289 ,  986381350380734363 ,  117238805036983305 ,  1449352355892026181 ,  1268263333620480894 ,  1321347366141284169 ,  1584282932468045666 ,  277084438080783312 ,  1918489799301829075 ,  1953141299091633675 ,  1737456118929695187 ,  813705317098174950 ,  919465504241922836 ,  684880279605575061 ,  1013047055581782609 ,  1526190402450935323 ,  1563906025433500580 ,  1778456038893798919 ,  515408173122759837 ,  637989486320270142 ,  2232639511000652926 ,  1590675235368867555 ,  1781676900648993862 ,  772576679224503270 ,  1619425096461241506 ,  1583684740740023748 ,  1421530779368964424 ,  1012643114783234361 ,  347603854446771146 ,  580860297524108702 ,  1245071537294617634 ,  865931135600964886 ,  1858955905146831040 ,  668666156509684513 ,  1075435892313273889 ,  1550754579123601595 ,  503633090805211447 ,  581213246543205146 ,  1062747990007704837 ,  1392349475622158738 ,  2301737723225754520 ,  9448425142783225 ,  191566412915742319 ,  1068421008217120357 ,  448406131493427591 ,  380753249253685704 ,  1773341359448807876 }, // x^2^565
+
+{ 1884426556864648581 ,  891158833119332147 ,  1733992452772056492 ,  1887087427096662536 ,  2247340989986121386 ,  2052255086457370518 ,  564147614589878426 ,  62334304600461139 ,  1363743731551272087 ,  1020755272522183220 ,  1707797487352242195 ,  1712306017052189440 ,  141132367880339459 ,  2203213651174928598 ,  1272889311887573676 ,  544465438277253669 ,  2265861121009991675 ,  182049789297354539 ,  746364501352695794 ,  1242321115356071848 ,  34536356553915104 ,  1694806007218156516 ,  520545076496615379 ,  90518835391864178 ,  969260459784302622 ,  1654577252924339956 ,  1769386829863195640 ,  1209637487115855717 ,  1707184508693857692 ,  1195596118277069844 ,  1078155074917022159 ,  1004250199850506387 ,  1216387145392605611 ,  1894043309558637589 ,  319316856966304182 ,  990711349679646780 ,  2169903467345765582 ,  1231422222233968166 ,  842194235732925116 ,  1960936995458375722 ,  512330250772916049 ,  1094632579219626696 ,  1766222476052264291 ,  1682196770181443454 ,  553837132207830037 ,  106512280372537836 ,  486830600656409249 ,  2264550739997659410 ,  403258511282080381 ,  1555796023727376888 ,  685920926048876899 ,  1387961744865895815 ,  1978663223150287432 ,  2233900337583595838 ,  1345315933226351126 ,  937762990945590916 ,  1597172586280564201 ,  376328024600740517 ,  2023475346115742554 ,  1175160413885205860 ,  668809172237994493 ,  211334954346381992 ,  1201563078168997409 ,  113653149101913307 ,  2256100958851327767 ,  1694548354567061211 ,  562600216469531663 ,  2129699432736533027 ,  346560892026628324 ,  2000419232702199786 ,  604461726542574866 ,  1422290058289136058 ,  1397574438928228534 ,  1809220983715394006 ,  843859232403026984 ,  417667378462730473 ,  1769715042099421999 ,  1542278074408518979 ,  1741198085826996962 ,  1003067151354084826 ,  1155369489986443583 ,  1545075965086172657 ,  314718642810071552 ,  1423338222284735380 ,  1232773234483840337 ,  1900126834928268337 ,  2132924935491099129 ,  749118467675602885 ,  215382816314355228 ,  917807976585201713 ,  2296077594653447967 ,  920388879033270845 ,  1419192239251203719 ,  1586393958059659591 ,  857145179803690971 ,  2148001135579236691 }, // x^2^566
+
+{ 537825092297097689 ,  822200383986347342 ,  973134250678541384 ,  393367975937418178 ,  2288263424887492908 ,  1772904194045758672 ,  686009626464454378 ,  1454811767624152049 ,  618049326749815642 ,  1570340012224926282 ,  2137582034659470788 ,  367298423325214007 ,  260362231822193409 ,  82799001049449986 ,  627933213416518921 ,  1291673150684079702 ,  175391831459125248 ,  1932575334113886045 ,  626046104766010830 ,  2227949104141807984 ,  684481490513393889 ,  235400351169774370 ,  1992708431568226892 ,  1280500978896884218 ,  427024762054763276 ,  924731167361718086 ,  1852044967786871944 ,  1984167270297485815 ,  617560084682289903 ,  1596165989166463176 ,  1660838867948045089 ,  1655404476314551714 ,  554425874365633304 ,  1384379781614736690 ,  1746462028369198156 ,  642021007270836867 ,  193327237248301260 ,  1413273683115520645 ,  1876096314437597820 ,  1966120225795939646 ,  1894371434858197050 ,  1635121646313750210 ,  579029973486412630 ,  1754916105808478248 ,  422286877629375744 ,  1825625795718711063 ,  1819882795921800533 ,  1532482109684672963 ,  29761988210062527 ,  1746132649293426757 ,  333238901706246489 ,  1631900903304918963 ,  1311080006131430742 ,  2154193805896327234 ,  503117119970891278 ,  1854116705563905064 ,  1648714375276285704 ,  1883725476010654523 ,  501312097982872941 ,  1739927089168524529 ,  604700587914901512 ,  390354154442822181 ,  1120281309554239410 ,  1831084154474463036 ,  317687301778211633 ,  220719941033483109 ,  13307530844013721 ,  1314162429703167662 ,  1876954065191592005 ,  754350810135265925 ,  598649771288113091 ,  1467805575720457735 ,  615536338608472734 ,  54058077991726648 ,  160533940435144106 ,  1452557253175986747 ,  816909170364872381 ,  1977483573524551915 ,  884506145590611300 ,  706602149199927132 ,  1308530642633665852 ,  421839359791818443 ,  2022705968646107580 ,  85550635122345197 ,  384201787053425168 ,  1377325124367019554 ,  1626003511818496233 ,  1035983822743642625 ,  39234667912937983 ,  576308629499843537 ,  1950947052843794508 ,  1238778900271801890 ,  1863535376332497643 ,  1301592563590453608 ,  1557085423485923757 ,  656303581676733167 }, // x^2^567
+
+{ 702662064749521947 ,  1272642485626698333 ,  1487292681786723673 ,  679041015998034207 ,  1470992017857354959 ,  1204361839801555846 ,  584364985527372916 ,  2247270509043454205 ,  1821749437566515676 ,  277998870164963809 ,  1278842484886333914 ,  1862568654277962521 ,  1036996405398831886 ,  2236452199284237540 ,  33700345750673109 ,  1968634765596265835 ,  1398329954103607753 ,  245467402167564257 ,  1067551652821979380 ,  1723654583228719360 ,  2276575053905143148 ,  1895832641891083302 ,  1652458546223316129 ,  1358500923990661108 ,  231421471868131649 ,  1106417015553704602 ,  886305551399390771 ,  1550215165025164190 ,  1634134642956303091 ,  2277524159295069808 ,  1895878653264506780 ,  827544265861461112 ,  1746066263758739957 ,  592321157230414909 ,  1275025618979962314 ,  531708275660974608 ,  1466283563411555862 ,  893705527146660934 ,  41264449847262198 ,  2043134133212353299 ,  201543514688711696 ,  216810808669102490 ,  2072429494375268264 ,  1303635545534561428 ,  1780794765185421382 ,  1439554357110047332 ,  1845273943100361784 ,  1185449460310340779 ,  328506939171510966 ,  2099141657559165169 ,  2069129686099909171 ,  1495787695856395687 ,  1520947123164590670 ,  905844948669557494 ,  1029787419647806314 ,  1878611518954695694 ,  1715290221691061626 ,  2004109779345537453 ,  272428686735636630 ,  2252672411086010980 ,  1938054786669801461 ,  2155904976003937317 ,  175595432201197990 ,  1412862000174776147 ,  178305939169567786 ,  183848932697247756 ,  1871717126455649757 ,  1344232092353336162 ,  578715055182145139 ,  701997565540051600 ,  2121357885672728536 ,  519742607046170497 ,  1402529550382034006 ,  79484968098335679 ,  1365735643397798912 ,  1913285255349198474 ,  1906425862291493806 ,  922431829236584932 ,  1743189957174265278 ,  391716553935188090 ,  1208648654897556126 ,  2279137605297876388 ,  1691797944448812189 ,  232496380057021323 ,  673005081215084939 ,  1791050031031830728 ,  1478200770184832988 ,  989367867733387529 ,  608014212577002901 ,  1341106257812743009 ,  2214176261268508510 ,  1343628785545313064 ,  893688478611250029 ,  2124413351195074093 ,  735771765900954434 ,  110428572205440098 }, // x^2^568
+
+{ 2268029038738935458 ,  1466813884115045711 ,  782132317376331750 ,  180522984641821824 ,  2151551724129198261 ,  1537638905075823588 ,  791161116510692648 ,  1434207033323577290 ,  617321882957017240 ,  737048249929416329 ,  1625427598985873371 ,  1528852481391232413 ,  646970574011600552 ,  1994989888966715398 ,  1558305100889672037 ,  1281363130132788009 ,  789274737508721728 ,  1313545659968569294 ,  1951115194639087920 ,  648675639240914707 ,  1975569876403254705 ,  593996782912145200 ,  1601776019704815708 ,  834217288957872335 ,  832570880745723671 ,  1436494673899601708 ,  651767113238963283 ,  405299168087954113 ,  1987936364010597308 ,  855225263370621445 ,  2223710612348777282 ,  1559560542355204657 ,  1860530236184480654 ,  2109354330224993033 ,  2105505034092090093 ,  2007001120430955190 ,  13854335937054897 ,  542148774687942200 ,  96496270948658114 ,  1237467830520317603 ,  1794893925689918845 ,  13113003611911926 ,  869129906797548696 ,  1225192423826772762 ,  2172066780907910946 ,  1287308481799628060 ,  2204808760342004654 ,  286541318664326982 ,  1712764808710422587 ,  1131232217364444008 ,  189873025980398331 ,  1792899056926475621 ,  1765895329787886991 ,  801356292747271880 ,  7064669212092015 ,  2085552600633493045 ,  2105430887740590456 ,  995708101891844359 ,  1712926038356774026 ,  970908359163624664 ,  1482939459262280846 ,  645482020048309745 ,  1694830593383471814 ,  2191813823016484088 ,  428317614714504079 ,  1432742618295193526 ,  464933376940818131 ,  1568927235489197986 ,  1307491803504643343 ,  1455159302756376601 ,  1604311792658767245 ,  2018570115381693536 ,  2009934836393546011 ,  1070598089034743177 ,  2083835720470121172 ,  1670230341326698182 ,  1614167536096437744 ,  2039760586710799577 ,  581432643255527632 ,  315286447786453622 ,  1805058631638138272 ,  918254753347136534 ,  1007939316193338752 ,  1716192152685716856 ,  2266250020640457217 ,  1939868282044576307 ,  2201176548376530607 ,  82079407884012750 ,  659516211725783033 ,  325053494599746731 ,  675206033663480302 ,  412090517171407777 ,  1178324819110577589 ,  772536706838161095 ,  2253334515274508918 ,  1342403696273115914 }, // x^2^569
+
+{ 188419072451040780 ,  1409774010721932835 ,  1855111372804717795 ,  1417377570126766410 ,  2237865219133958172 ,  852915721521477804 ,  2052074161582503571 ,  330881146573693031 ,  2238260670039110233 ,  618911125632726189 ,  175837378738155998 ,  607375306533734678 ,  1115325869304524884 ,  865669158394089914 ,  2223601273937132848 ,  423587724212475969 ,  529395640307704666 ,  151868691704520689 ,  81958647566638036 ,  122910902321470417 ,  2191700248860079198 ,  2045829877200500577 ,  703653670051234848 ,  529001149544262840 ,  2283920289463919359 ,  340269113401506411 ,  2261862947423962589 ,  349871585771354491 ,  909377307524245338 ,  130158808544346917 ,  2037436793055777547 ,  1296850799170499155 ,  33490238141863041 ,  519633118390336672 ,  644577469622936115 ,  1055323329333885236 ,  2303300765798151636 ,  1666894278165354902 ,  1419298794041877016 ,  932797357412842034 ,  1860243452183167052 ,  113796899032602990 ,  89530135757588218 ,  829340319898132048 ,  2147748456543744180 ,  1052827057635713566 ,  1832854113418101659 ,  81110813746454943 ,  1467788587690202298 ,  1088628029468924619 ,  1619809125529878687 ,  972162681368728652 ,  1253002891876542720 ,  508209197826627776 ,  1709348716225682365 ,  224373622766149599 ,  1249404053202865428 ,  2198950839815058608 ,  1446820059951969758 ,  169792591462988871 ,  2004067791389470212 ,  383752672525022017 ,  2203221849928163133 ,  2277270851665035437 ,  1886063214969309065 ,  1253504881768149536 ,  1190521972109726874 ,  947877009498467710 ,  61790944074224156 ,  959961054734698055 ,  760100537876039139 ,  1099932651189565827 ,  2303575522714636436 ,  1447711686295518628 ,  589021505287911112 ,  655965969363320136 ,  1268218519355388008 ,  664522860464523570 ,  1535833613303285497 ,  2128487222829129198 ,  1124860590806900777 ,  275630640641335937 ,  594855763831327788 ,  162702442815933292 ,  2049627274358464810 ,  531006925154105660 ,  113759639679144830 ,  2297413423613683207 ,  953145062265224892 ,  761389651931971526 ,  107777800984022521 ,  839157417760068095 ,  544334655387572160 ,  2019119641974590325 ,  981661349626847003 ,  424977685863610687 }, // x^2^570
+
+{ 1347495910387836037 ,  1772340963247991398 ,  1142309701152041876 ,  739268206376513257 ,  1513882783180574854 ,  2270387638059915498 ,  1538823281998027924 ,  1264478064537954268 ,  1392677089026128950 ,  99319446690906520 ,  1895441713458412494 ,  1290206644491596409 ,  545919345893030937 ,  678816748252499299 ,  2078232947253111311 ,  702112552607871936 ,  384475841669999208 ,  794362313101727314 ,  1882603135036352087 ,  859932539837388590 ,  1003380147895847154 ,  1515225927679399456 ,  195352592441073249 ,  600502373359718580 ,  1800537483510329729 ,  378271801752737507 ,  2156489155349213580 ,  1484235531616949594 ,  440367321880768196 ,  136243494988283496 ,  2097909731847584796 ,  381457904121603116 ,  601667404997333590 ,  337764423144495997 ,  545010779019215067 ,  258675490892205084 ,  20093228525858936 ,  1927715312311683422 ,  1871055116182700811 ,  561483996285111740 ,  1242160802416005006 ,  1726246125439829475 ,  406041274737742290 ,  264980843760470917 ,  1150105723761974732 ,  1656437022856561076 ,  1129116171208188965 ,  1601353361534462628 ,  182463975784382795 ,  649182119622767558 ,  490119908002782442 ,  964116066972194679 ,  456066470877125208 ,  821143462613841273 ,  129866416775227940 ,  2085485290650849209 ,  68667587973848790 ,  1312151166650822877 ,  2267350818847064225 ,  1198550772226837233 ,  230923648075964806 ,  1913085660593061016 ,  2241232227139159874 ,  2083865283221973376 ,  1354179007206250916 ,  2081640839223925980 ,  1916218841562519329 ,  730783829051362581 ,  1751453845189917972 ,  1427367199971249814 ,  1891437206871962535 ,  319735252102823467 ,  803278489200678556 ,  2116661055445571887 ,  1514330904088538897 ,  1838149793331026261 ,  704350432308804690 ,  2133921279026236010 ,  580119811964354359 ,  776346808280007992 ,  1815756982590172725 ,  133909777917952086 ,  1855451030233656904 ,  1936792159453289241 ,  1193998883030669240 ,  1331646812899227477 ,  2129352631170873948 ,  5216819704322962 ,  858683121353501036 ,  417865105238596838 ,  1821785193690849429 ,  980857454910926541 ,  812292959223346659 ,  1087802441572691939 ,  50068242950625723 ,  1505361097717958751 }, // x^2^571
+
+{ 2116731280279781173 ,  27183803594489414 ,  2016279734157245324 ,  698222404971391035 ,  971295667757320933 ,  940515494176765931 ,  591084005982810704 ,  1846569684877782793 ,  2251440313133261431 ,  960375315396465243 ,  1273256788537034643 ,  854151647411695957 ,  417254584115900797 ,  1847407403190416411 ,  1350760926533797713 ,  629070277396562846 ,  1631393031560656294 ,  185250865853653319 ,  2075504863081810347 ,  1360348046442369147 ,  1941925855181855388 ,  749499474152451005 ,  198006340520830481 ,  1157660588268338404 ,  1318522407103641767 ,  824938916800747829 ,  447534707791467173 ,  2000360458281502457 ,  916043830979707368 ,  1015044145625068853 ,  525986888210169600 ,  250739617175841336 ,  436152259839198441 ,  623576433763950971 ,  805937133775659513 ,  1569538345623324922 ,  1452424713389987759 ,  1947053517887328112 ,  1927462730962981341 ,  1327510615312123763 ,  639249354668341089 ,  1103322505264739561 ,  843818326022240148 ,  1669540846773679252 ,  959350993151057236 ,  24540268940259246 ,  1521972859816062557 ,  1330772557280676676 ,  1469732941117442981 ,  458184778844571933 ,  831853341185377902 ,  1805120395623054586 ,  2102122739312126864 ,  462996868449418574 ,  2296416718239988300 ,  1200515961380243280 ,  2163285905286201202 ,  494721668152145525 ,  1274764514891732971 ,  730618964926837965 ,  1898549564702776902 ,  719163106785082572 ,  478116185661476896 ,  2272769723704484412 ,  374630169359637698 ,  351098524056151785 ,  1564793601880610212 ,  671337358161566047 ,  912846531262558690 ,  1380230408986577108 ,  1319571294767055684 ,  35242266867976697 ,  2301256345532080149 ,  1233096578520378476 ,  671531248242417138 ,  1117696471304888426 ,  619960168057193601 ,  1609629029601629297 ,  981841587243839058 ,  478235129959918789 ,  894805108687996652 ,  638645775130726906 ,  1065138428050115577 ,  1808072899745846977 ,  1200209770179604676 ,  916561637229052785 ,  2276444139222054056 ,  282184074315058239 ,  1594297755844975487 ,  232951194070489792 ,  1104761800415615942 ,  553349549184665854 ,  1780249778369152667 ,  871918888760356426 ,  1817320964217660974 ,  1241902201956425697 }, // x^2^572
+
+{ 1350995404454607376 ,  895187311945568893 ,  795293915813471554 ,  59800293481316943 ,  770798945753824628 ,  1814188034167369375 ,  547289388006977425 ,  2141574444170585637 ,  2038711090554789489 ,  649595495882164042 ,  2034357804884126029 ,  1579109422139104383 ,  1651935320556996155 ,  868147573429866326 ,  908636965636886936 ,  2297216731744002530 ,  1644084177414358786 ,  1428528457441533748 ,  888786011146482272 ,  1838169978418911272 ,  1614106488544917686 ,  1526676561071412405 ,  2003761054641677950 ,  548174003820845307 ,  749068572631536437 ,  1624200263356132459 ,  1127929515381947809 ,  1905266555379126569 ,  692754816236042665 ,  697212693067130933 ,  94780463624811396 ,  388593086809951430 ,  142811774070640470 ,  1013992747185995497 ,  2202550343103155734 ,  1046720992264408379 ,  1570133293275476282 ,  633751690877523443 ,  1652783134958004606 ,  1856534033606168605 ,  485067051651158932 ,  495273104041998098 ,  485671062176323641 ,  1253489041112774327 ,  344305385247957390 ,  1072223372836892407 ,  1200449398792029529 ,  2304688368339396239 ,  1634864884158223826 ,  1065266467124305155 ,  2094614342986351699 ,  1214289339583794293 ,  2206640297568621688 ,  823266683756069633 ,  1163820138345019690 ,  707413899219980759 ,  2002009934299025735 ,  1219690300454900585 ,  351517800962649316 ,  284997104530796300 ,  1900450837517887725 ,  1493994879590545640 ,  1688963696523341035 ,  1976277162590068379 ,  1308497153669269021 ,  1402745048663417691 ,  257221586372090452 ,  1871097628447615826 ,  418888604673266067 ,  1823393765682664223 ,  886750100162027767 ,  1675743130226879078 ,  1468009304525077756 ,  1740822264263026191 ,  2062195701440519388 ,  1425324884455312855 ,  462250855224084767 ,  1773552003379739292 ,  476011556167858581 ,  1445623821698373164 ,  361161140233450829 ,  1767607664029849434 ,  637990252903649509 ,  257087974828956994 ,  1101881443281592206 ,  208786486567403640 ,  869496928189729596 ,  1718180289505892092 ,  1824077240429256640 ,  945310809284495696 ,  406160441905437930 ,  1709037114956405845 ,  42844259825846801 ,  126835843533650495 ,  70945983242783141 ,  1739123604154291074 }, // x^2^573
+
+{ 484652283951715570 ,  2264024817921652242 ,  2225467467863048119 ,  2048685575808439423 ,  407945503686086523 ,  942631574929585446 ,  1766657333142113279 ,  1513258723386938278 ,  1390222165879294120 ,  514604372849751271 ,  698964863166977822 ,  1820244719034573643 ,  1235023369137165722 ,  1071024448723450793 ,  1709712500885045251 ,  963730614771118124 ,  1788886697803806618 ,  1064482559462820270 ,  1956229596172880046 ,  1863906684680428875 ,  2110240890113767334 ,  1620376589075987860 ,  1644141752532426192 ,  1181370616701613330 ,  1713282466139220773 ,  670981979720556673 ,  739937186731909326 ,  116064083086942757 ,  631715436780940094 ,  255358119654360325 ,  1484329285008069478 ,  2108004075442836111 ,  641921143588905550 ,  911470394809432207 ,  1262630520540878675 ,  2025407393868457663 ,  1775129403306394095 ,  708288550922690745 ,  1027618871270474641 ,  448061511517738956 ,  1925671223660711662 ,  1959769248926793728 ,  1677746170267711422 ,  354787287906257978 ,  1882228754986206386 ,  782204246838211985 ,  1657615560449037913 ,  2275287369655924245 ,  2158967365244061046 ,  253462198564448667 ,  912965405419539664 ,  2189020273885215577 ,  264232513722974207 ,  2133785939147966267 ,  1611195944361177992 ,  1967295410528083016 ,  1685409224695594106 ,  1808391693739433771 ,  275850203589007696 ,  496677872071575646 ,  178947671154676663 ,  1111066909554864964 ,  14670396402430229 ,  615038470379064061 ,  1483340532053722654 ,  2001242342512835317 ,  924438713982157723 ,  281209924200586871 ,  2146666451559014293 ,  312661254637279634 ,  1043516769452941191 ,  72043366011955722 ,  1745265534617323071 ,  340403129438136414 ,  316441184585150700 ,  764134609207058271 ,  1989067122242669697 ,  1927747706228448360 ,  137557145752553739 ,  2053916706253493726 ,  2106148362383208474 ,  579262308218321512 ,  2056048382554364752 ,  465237870648973662 ,  1894268692732156479 ,  1672167614248167202 ,  2137145902045248725 ,  1718415190544863350 ,  107108863162440801 ,  1274120607574642810 ,  1526521810303582049 ,  1535171956463322844 ,  672518438401736177 ,  1625646881368561044 ,  2149098642794688994 ,  440580652739057678 }, // x^2^574
+
+{ 2189246705442780811 ,  1991187186102068851 ,  1882998313559425287 ,  939489143240472428 ,  904942548390766270 ,  1542816011151221254 ,  470053090051821829 ,  1733309483807551106 ,  1025869858950646789 ,  486563234278976597 ,  332791861169152384 ,  891606196983637295 ,  575698906185584144 ,  427804118118036583 ,  381194026449098462 ,  780528909771924284 ,  727659364892422178 ,  1666624460135366936 ,  857355283171893350 ,  588845092183221013 ,  868656888424140432 ,  1307521508911774659 ,  1971258932825257651 ,  1236331386524974679 ,  684386262733280386 ,  1156654216185136398 ,  1997209518891311642 ,  1715207131274796802 ,  1833386542799960086 ,  1298616055937392793 ,  1411923364711947747 ,  1815647530356761260 ,  1653999667297204704 ,  1436469106256145699 ,  838005267130591498 ,  2025412243432205433 ,  1022347241548283043 ,  1472970813617180154 ,  1007530309012493075 ,  887443321352530767 ,  41178669199150729 ,  631349040397324008 ,  117290746853462078 ,  943549167156535551 ,  2118293535056782019 ,  190153979125631553 ,  2243246038893841494 ,  1428895884900458797 ,  125476500727773626 ,  315746584491829042 ,  706907518879713333 ,  2115864030418076087 ,  382435057568590472 ,  114985840469028821 ,  1135293403126221154 ,  911845012574937887 ,  974843977018207438 ,  203751169083712297 ,  640353646684464005 ,  1024745164913014986 ,  325762512999935879 ,  321817227037564260 ,  813977030709799375 ,  81627928389044610 ,  697169603985728787 ,  871262314081670808 ,  59596887977721222 ,  2041545106817155100 ,  2283142267455084678 ,  756987317412473033 ,  1886040626702985650 ,  1859325295663274691 ,  1576692598534785248 ,  1345028382928289756 ,  1841493641232069634 ,  172626931878956534 ,  2099814688879723317 ,  397100728842126377 ,  1429238480239467056 ,  1450222541787434313 ,  25356643303805684 ,  372302934248004533 ,  1253765979455982480 ,  1284163064151415490 ,  2141532216177670785 ,  739202580352517948 ,  1818113782291607815 ,  1443730525814689751 ,  66760710453402934 ,  363359279204731444 ,  571000358967949776 ,  2131498391376647155 ,  568454268389674943 ,  56717194376357380 ,  1857298280929100320 ,  2147520928005841408 }, // x^2^575
+
+{ 799575370743121469 ,  1650737841421862467 ,  430099657544220832 ,  1724894902864830617 ,  850060071290979347 ,  44515741721083388 ,  1158734413422893212 ,  2177920583637389099 ,  576770463467111352 ,  1022456311322985857 ,  562029635244440259 ,  2090349817925243678 ,  574520214725816975 ,  1715880664411541528 ,  224185930454393385 ,  590093020866697054 ,  981197725868676409 ,  361352719350314175 ,  265691389506285357 ,  1500775777145740680 ,  1647021839209050753 ,  387977464645311215 ,  982096085485678310 ,  1717580856034814515 ,  2047827415406567346 ,  2269648706269928739 ,  1398880080432035612 ,  784986567305403840 ,  2060060215418565687 ,  463081461418664135 ,  1709891335086726374 ,  125842333945420711 ,  489295521786887251 ,  60449096299559567 ,  609937015965058740 ,  856647555591065179 ,  1376208874536751114 ,  1445761257914660741 ,  1450016200138895884 ,  573707965299130190 ,  518015632257337264 ,  1048416370076570465 ,  1486730906561644702 ,  145227953120715111 ,  1269914623363884238 ,  928710429503251127 ,  2272181762458622215 ,  946801882975127188 ,  1798916703216960402 ,  1689875323631154505 ,  2085453980056846609 ,  292304551956690354 ,  2106072304203189754 ,  1116430872728317349 ,  2170632823899208271 ,  545422906316375129 ,  838066892335198792 ,  236591775392319156 ,  385383927106498221 ,  188767204150608452 ,  238070407466498335 ,  924195404552950375 ,  776687548953142893 ,  687214770295109540 ,  903111506181276880 ,  2267529451072294442 ,  247601459538836285 ,  1098463542879975859 ,  795953534819282409 ,  376321141910251264 ,  71798849312325369 ,  1563121885609660788 ,  1323231060503593500 ,  1297780895938852572 ,  2167514864959229442 ,  755331633509933383 ,  2034874119212233744 ,  1364414220185869336 ,  573974336383058677 ,  1369599133612155642 ,  1161241535981411621 ,  1509527057750657919 ,  1106226097399189266 ,  858276116382037238 ,  556799048930053539 ,  1569231641057306482 ,  1500165094648372794 ,  1712151336346496655 ,  691254197782435014 ,  681123565580140126 ,  657213395876653842 ,  1564814688360189991 ,  1521773442744521017 ,  1514098424556219206 ,  1591663234582557810 ,  2045677486809502890 }, // x^2^576
+
+{ 468559152151975631 ,  899099367167394890 ,  10592356220606248 ,  1641394522862576144 ,  1896084694323053028 ,  219442843543999986 ,  814550704064592019 ,  274608099532610945 ,  78421385005385825 ,  439109827986597111 ,  527329983230698402 ,  2218427722356613988 ,  1817005642982355747 ,  1277525386129599410 ,  1352329380053767062 ,  2015401977460408329 ,  347524395059089752 ,  350777921799872475 ,  1701306658687543324 ,  1516238148929860587 ,  1348130848592181515 ,  1660786742037304677 ,  1956045296720052627 ,  1024693416348805369 ,  853104177084974842 ,  2124863470275487578 ,  1397972305217698410 ,  1946399154181479444 ,  779502682517238091 ,  20774972187675442 ,  1639289485083839962 ,  758373075203079261 ,  1096581755945856985 ,  1082703343392634273 ,  453612141628318390 ,  478432645046290181 ,  2047744925926823825 ,  612348307109608785 ,  774221270700962830 ,  314345727699131220 ,  2160016990135362202 ,  1260394940589545528 ,  2158385150187515761 ,  1855785429459060914 ,  811763644377626086 ,  316905386014063827 ,  458337890690546929 ,  2179195274009993392 ,  405400071472560964 ,  117016445342333340 ,  1215377567061579521 ,  1128206911123518311 ,  2011081381895097656 ,  783288824181026390 ,  1815447967734758109 ,  1183966247503732170 ,  1828254571395988663 ,  1134982820778934619 ,  1912169521506538251 ,  1673437426180704604 ,  633859021831765273 ,  633481421978683761 ,  765365616160462711 ,  1284982526537510413 ,  490832920816912243 ,  1569062557166275972 ,  1612459568134472934 ,  1315896257764233845 ,  1286623663745546601 ,  1916036146263987280 ,  71528153131570276 ,  731038003624480285 ,  1955141635225527827 ,  109131267275274206 ,  215570647162480446 ,  1595255111651763555 ,  2305782842452639715 ,  970248893339241904 ,  183614791431660494 ,  672393748344304767 ,  392071328969490329 ,  251647751739101002 ,  216590474766269214 ,  567057799951838278 ,  1291049927301538772 ,  104286439579407694 ,  826940610346391646 ,  1411408821471689439 ,  673805040074476621 ,  526288745171317972 ,  383820362259082855 ,  657277373651945760 ,  214548822849255187 ,  1159062962786664420 ,  1716985864198435520 ,  2082724578384929064 }, // x^2^577
+
+{ 339542296584142190 ,  902921097198977129 ,  569300555858642373 ,  1877193466781951222 ,  131846803079444648 ,  2214294153811779730 ,  1037835742479210662 ,  1060538204295913112 ,  1746562762515882510 ,  721478092094683166 ,  990091078724900860 ,  1249767583712072593 ,  1838902427203050646 ,  1185645707186123633 ,  905059093512119306 ,  1727625662656363795 ,  1778309461641479399 ,  329189664120429768 ,  684676333059966138 ,  1551055483912941834 ,  1905811791565101976 ,  1349929873003869025 ,  260601508962539427 ,  1961058110029160916 ,  505779200545451399 ,  284081284894308754 ,  1135551975697000339 ,  1604006237806408345 ,  1740290231471289121 ,  351244741186090955 ,  1417235997001593886 ,  253681708692289458 ,  573314220499593474 ,  2062781598728253500 ,  1239754164286506847 ,  1094173045520808030 ,  1579047660351694978 ,  1497191775987798954 ,  2270033831146031489 ,  1768244271989098988 ,  579774609857817695 ,  906531785648083933 ,  1461530677493468858 ,  390824180811942024 ,  186881392661238685 ,  338414408367954411 ,  2069673431605083648 ,  1585723305686435800 ,  1207457145471848792 ,  673046277711336974 ,  1768534636044808309 ,  869426266746763205 ,  1437921906098396963 ,  1510688712410391371 ,  433362311000791344 ,  1781305541992101924 ,  1469556668132523829 ,  2090541589926653833 ,  579338273006198852 ,  189711692224156697 ,  1630186292042142493 ,  197432321357899186 ,  766977354215902786 ,  580425121650360152 ,  785114834582052374 ,  2109732862498383622 ,  538984249840123762 ,  1219904207004656048 ,  2030174902093294835 ,  1701256738916693333 ,  1195288389083121237 ,  246812279401832150 ,  2062680766804571754 ,  1411888646140563237 ,  1776685830720286841 ,  124418802007912260 ,  1385053043146201985 ,  909618189350781107 ,  1202535055638449904 ,  2208635209940794046 ,  2100344360172649649 ,  2198664997448828885 ,  552741507957484633 ,  1371260295287387767 ,  1775394603705307190 ,  1117501921834081468 ,  1493085465622831844 ,  1927371502869038152 ,  1407528840844363373 ,  302155923581850064 ,  814804464139250720 ,  668359091182361576 ,  1138745767988280876 ,  1853929514971937579 ,  1252078552294945367 ,  1052426913407419152 }, // x^2^578
+
+{ 210220136785547896 ,  940973058844447708 ,  1591708730526699970 ,  1442846636045860991 ,  2212293799590373988 ,  2018239177052226343 ,  560157799019474150 ,  1176395864504045811 ,  173798046026960119 ,  2178141963840911211 ,  1240404699052524814 ,  1602080353739860076 ,  1824444704306417177 ,  804453581363754255 ,  595503088205266734 ,  441407233243660528 ,  1281809738649782532 ,  2141451115998472556 ,  281612325475158043 ,  1979349766225877966 ,  465803170654709354 ,  1578199661836840209 ,  1431251182422097892 ,  286322025929283739 ,  2283453545335582474 ,  2009865727761469949 ,  151936925572917712 ,  1036519982015365176 ,  1671824549327082042 ,  537189239195682424 ,  880458753598486419 ,  1708815190202917641 ,  1372997657582548526 ,  1019627663085375222 ,  1744942463478621853 ,  2049877356020330575 ,  1365399364771254209 ,  51386398870360165 ,  923900860632686116 ,  98387411997291465 ,  1648980805075918789 ,  56816062207105267 ,  1253075745042515594 ,  1278556099267717768 ,  210088642863963888 ,  334371169586267391 ,  939820735988835329 ,  1693588202502588966 ,  2102035061038730247 ,  569492446721448926 ,  786758834386406091 ,  1620517395835580786 ,  1539453594614518033 ,  1228789101416613234 ,  2165093831973348564 ,  572752942131650000 ,  494213426015480442 ,  615782790000779244 ,  297096063651754622 ,  1063587879418702672 ,  289052398000707833 ,  1243575277942779816 ,  1238921137117385620 ,  2083727025700804902 ,  2121998405645918766 ,  81861439710287870 ,  620073396144035653 ,  1261875981152820034 ,  1433076250871508479 ,  1415068193026162214 ,  1914026284235051052 ,  1547285492863882814 ,  1637831797884763029 ,  2256727695458406889 ,  1258116700326283056 ,  714667879234483750 ,  1498562582799287746 ,  833383474989608866 ,  1982269194235656992 ,  49610478275385671 ,  781128966416459148 ,  760339726400291024 ,  610977784162177797 ,  1686722810724877078 ,  1821286328519870191 ,  725710660783771987 ,  1597737332337988497 ,  128209554933355301 ,  698057485798406463 ,  765673338720847469 ,  115281284816804994 ,  1542846416514141947 ,  743415825179881731 ,  1254455986428917118 ,  548651797334916763 ,  2093748213096344413 }, // x^2^579
+
+{ 2246181687526889 ,  966178644303560204 ,  946607360280281980 ,  2044225598513652928 ,  935946489847994592 ,  2071747373404862596 ,  1076488371162511699 ,  583591935724702083 ,  1126489816735728958 ,  596688099147560001 ,  1693595354198625523 ,  1582591817188209612 ,  111651321625562846 ,  588527520663723497 ,  93733646205975375 ,  1126063262093343733 ,  48308807189620992 ,  1872823622123775480 ,  2272703495408619592 ,  1385519216414321283 ,  987476976825457222 ,  1948327688578270983 ,  76689493774796049 ,  1776441185969706216 ,  1622788940823285803 ,  1195829279529085406 ,  1367719538942753364 ,  2300241642668471815 ,  932258410673889338 ,  1768228010303847936 ,  1463983606411649940 ,  2104450128535254420 ,  1161298675056976514 ,  1716894190973221242 ,  2147457393686073527 ,  1331998384625962558 ,  1011975291461931422 ,  2097419583353169260 ,  1011701256419907873 ,  83095502140725242 ,  446796621136641428 ,  1961115831856241900 ,  630415603244041989 ,  317175823858225698 ,  1480916225301221555 ,  1738207185915811226 ,  1944174192423462334 ,  954941912897868613 ,  437029892361665601 ,  441579817751999831 ,  1354067811932093784 ,  1385640440526590786 ,  1679759185368950147 ,  1323899278071304298 ,  141307015175002969 ,  1893316937856075416 ,  1060782577363989847 ,  958488397774094601 ,  1290265367999893603 ,  463346410885946179 ,  156482547095860498 ,  1751789046180577239 ,  2182495168646739643 ,  1609410075462462796 ,  429179419602038035 ,  1949658857648848043 ,  1483096346459437562 ,  2051080003760543375 ,  1022529844761751299 ,  1560822913579949657 ,  585186702347617863 ,  1773308088161767547 ,  1395606171883458233 ,  1231738542913275695 ,  1551472459737427191 ,  517897697940820375 ,  1579284619948921336 ,  797463457680783696 ,  2204730899169015513 ,  1443904880982602545 ,  608891676161976413 ,  525120657943674676 ,  851738002115711784 ,  1204629264870464292 ,  580243900266144132 ,  1540426410677611476 ,  1176430403227197632 ,  195234903344247817 ,  445173506151085273 ,  233281429705442039 ,  1252131401319666656 ,  1050751932201595945 ,  242320482058016204 ,  443737062049831072 ,  486338663058920128 ,  855059286443401154 }, // x^2^580
+
+{ 275874595205278704 ,  398669968003210620 ,  1583106427659775478 ,  1229766380703882061 ,  2096380863489690680 ,  390290014323868467 ,  1573180633490854705 ,  1173752377758643239 ,  1885429164040162971 ,  76429640435639798 ,  2287109721715229477 ,  2134551876049528218 ,  1889983771562901583 ,  1743823284082408537 ,  455597840961435031 ,  1065164107743420287 ,  1610558647499883194 ,  1185864908780111839 ,  1484515270726927369 ,  997168338058863093 ,  960747940330777184 ,  1878199335098069784 ,  1025813305940365006 ,  1776764470171034078 ,  1990797870232540719 ,  2114303879585133193 ,  936272010975497112 ,  1926283181071937460 ,  2195688415325047121 ,  1170908457718228616 ,  209988861023396474 ,  1265825926861425066 ,  1253524261303468440 ,  326980001347048815 ,  876610312671036917 ,  473653574976824517 ,  2287748628034059409 ,  1317126113331752903 ,  1258949878735838852 ,  1291656346671105053 ,  2207645126280948287 ,  289967492392779728 ,  322864970772087212 ,  963972829262298561 ,  1451939251206302177 ,  701788219134382973 ,  977409146848249090 ,  1658173764436048633 ,  1158433269871171782 ,  195649479731145109 ,  965806175566196767 ,  930221808132241467 ,  126884767532673421 ,  1421149868222111102 ,  1753421450216625187 ,  536963283296622411 ,  1977341681871245057 ,  1583913771375234955 ,  1142735492468043882 ,  1423932806941007597 ,  356611231450332893 ,  1641652110506149903 ,  2018053352135709297 ,  522408491071315783 ,  1298829930430680691 ,  1344115892595005897 ,  1075473827372211710 ,  315614868727211038 ,  1132158932804293849 ,  1888619298752112404 ,  1880122797069402638 ,  1399163126024314768 ,  223134907176814981 ,  1196893229652591480 ,  2188104425741366413 ,  835796381109926244 ,  1616005388295579969 ,  533438010141513451 ,  690038159232997391 ,  1689384257204961342 ,  1822692573371979996 ,  595730864551900034 ,  984288660631054007 ,  1067316211316322441 ,  1306377847581120796 ,  640727622342610456 ,  183197382303232519 ,  496853090346893679 ,  1965679634525119657 ,  569457497935401464 ,  2067897870726408052 ,  1745823607782770883 ,  904763960173498207 ,  1782837605885056257 ,  646798686488413540 ,  2071526620975422291 }, // x^2^581
+
+{ 1376136665022196547 ,  1124090275475994339 ,  1217697937528412675 ,  2019952739075830909 ,  2231990721398581906 ,  2269618954838695124 ,  2123893521665493989 ,  1158273327297933746 ,  1346887609433162969 ,  1321331910826861675 ,  1782828151630840148 ,  522400973097277389 ,  2132727820969246786 ,  1063061196072450512 ,  250351776305352152 ,  1454615103451919573 ,  121595081823754019 ,  950107781664599414 ,  2117879389142523469 ,  584632999974121213 ,  90315296383133468 ,  1023849213995818272 ,  1876117337298396701 ,  2248413557560194686 ,  910983366220418755 ,  198173192620710534 ,  1082035838160904726 ,  227351074931847985 ,  2186614113072790125 ,  1824638887961296492 ,  1227838113600778961 ,  904488948505432156 ,  2108192439441504955 ,  533880388616277583 ,  1348395435261522274 ,  245564747321432121 ,  1002222969471309905 ,  25423087576080106 ,  2080481476498564517 ,  1808800378597421367 ,  647819214971021374 ,  2128623501402870230 ,  997116788215159696 ,  1887765588060373651 ,  1391616143500521443 ,  1175183564242761853 ,  1160993229510910859 ,  1548297524748684784 ,  230530777078942325 ,  2101520146997859352 ,  1721751056653334766 ,  1883192831698121639 ,  768771724094684362 ,  897482116981650367 ,  1652938573262690355 ,  1602255713892193300 ,  139462730370367285 ,  1610323218092627261 ,  680011594169212872 ,  2291049523984814543 ,  721831887675171773 ,  872355641111724717 ,  608969688041861155 ,  1843263290003355129 ,  591015148715639252 ,  2269770118422834405 ,  1134994441465064087 ,  1896612489770003000 ,  548524846951554233 ,  525572148115707089 ,  102473131051701784 ,  1302103290166757906 ,  1015072732343335026 ,  233155702216712842 ,  303753649458021507 ,  2269388276493937538 ,  2273660811948958715 ,  1605840359126360503 ,  515837605400222488 ,  2206594617565952700 ,  1422106846846413418 ,  657644829867114091 ,  229899017082187523 ,  1977084542258405873 ,  1995438312650129948 ,  1139019791073974420 ,  244474798843617813 ,  1238658361701512700 ,  2150853314578728912 ,  1386168559046564927 ,  755046055447916165 ,  58590284261503402 ,  333777289349836762 ,  2046601511115406360 ,  564414116655712396 ,  1835773060039048927 }, // x^2^582
+
+{ 1221412557383524683 ,  2158039024739465980 ,  2284626185711927474 ,  382021232968307793 ,  1387971274768506960 ,  1735704866861114648 ,  199396143616264132 ,  2253444007967773902 ,  984019333409729306 ,  1513769823623755919 ,  2138767770990185287 ,  1280420870475820696 ,  1813113860501925412 ,  948418765252274018 ,  897880908154033123 ,  2073266685536056325 ,  1268583176100793361 ,  130127970501659483 ,  779901865796090561 ,  1005717725330002266 ,  1569300993115000992 ,  252290108809470825 ,  194487925970670366 ,  831079592406469516 ,  291202051671921126 ,  2088582158789980151 ,  1646859882254054429 ,  1735636473571588387 ,  1959149638070852173 ,  502876519339560020 ,  108694310644369015 ,  361407931850036382 ,  1426671939709325501 ,  1154984530238570517 ,  2118498121375228611 ,  1724819725115008957 ,  2278304389209396959 ,  2304726376352161087 ,  2090628496579994856 ,  597368179139456931 ,  348348834773394715 ,  2267725154079901320 ,  622552463755222625 ,  500106874405518406 ,  2108143405502052610 ,  2111990655130609291 ,  249924111123999932 ,  373288827155538771 ,  1596072435330963946 ,  439055499139813563 ,  2266641465707951686 ,  31633450650151224 ,  521535626970163665 ,  2293480649581567697 ,  1495853320832867282 ,  2131822970692628327 ,  1465644103570614356 ,  962701070856740228 ,  1720556483656480720 ,  748014383991096100 ,  1688221772468025523 ,  343038692591493423 ,  1055349892440441325 ,  2138324905796004478 ,  2183970402478440915 ,  2015578545927389727 ,  362506974582726503 ,  827875909504775960 ,  1586062011308888023 ,  550997068153883561 ,  2058575081750543307 ,  416103678037808545 ,  584075712789324296 ,  767285571951895840 ,  1833412788238197521 ,  2045947962209803191 ,  1539194596245694376 ,  407040594700441991 ,  1929064512073547662 ,  1510439645948135006 ,  2036408892445229583 ,  2084011436694794415 ,  881848560783878883 ,  492230551819218074 ,  495512204026068369 ,  564842582383054556 ,  698251516122946794 ,  2302488621659975099 ,  1111153602758925587 ,  1219073612331556045 ,  1872867458936622194 ,  1573276367258206356 ,  173285218143850674 ,  1567723056276664340 ,  263348200529975174 ,  2107324702648259305 }, // x^2^583
+
+{ 928775807174082953 ,  1695182364792281605 ,  2023194101217280117 ,  247957082111224876 ,  1678235047781713100 ,  1955266057443273763 ,  1872197288989447136 ,  160978055243393663 ,  93091441327502704 ,  2291961281138507621 ,  785673704741343350 ,  1217845582818589337 ,  2173758411499812916 ,  1468159240682171538 ,  289788361066282248 ,  789441954851396856 ,  1415987891605264592 ,  1505837559738152754 ,  1999686991675934517 ,  1746132888275817914 ,  2199548724303871074 ,  94489303053288549 ,  452025691286771576 ,  1022648165539053931 ,  2048227419493748538 ,  102703511549481704 ,  2009826194388848452 ,  651935213674093746 ,  1382445535130956494 ,  2249099439393799653 ,  434544592423879518 ,  1218450914248493948 ,  470657548532410423 ,  1021192907613045906 ,  662541104851343615 ,  34264102336085335 ,  829755363007518079 ,  1386751070904402680 ,  322426310318323090 ,  1392025273363286178 ,  912893919188932063 ,  1021171718732579322 ,  276983911927180321 ,  1408362508463202123 ,  1249477119825565814 ,  709926380364545773 ,  6182143403962319 ,  2130345299545702496 ,  2244969219110529811 ,  413631279147942195 ,  1362951384617256477 ,  1110872652438601294 ,  1352012821693020907 ,  49436286484432824 ,  769517518767210309 ,  1614132381208075113 ,  1400155978886285209 ,  1005687907799624827 ,  1819171213368054692 ,  1409824996999895860 ,  696819052246297372 ,  916329451531048678 ,  1349132045750356420 ,  878942711811949555 ,  1091709918054683310 ,  1766763377552533351 ,  125526079776137427 ,  1453615641335485626 ,  1083969705273339156 ,  1834841303362353978 ,  1848891227888704413 ,  126304542836850860 ,  1205697378044853932 ,  86756912837613772 ,  120602877425849132 ,  1364227366716480419 ,  1215968125364637324 ,  487905745583144436 ,  393674896020208986 ,  251628746365773193 ,  910079298271794414 ,  1869828064376818478 ,  608163190643609332 ,  799309259194814478 ,  579150257748176645 ,  1605539251835382997 ,  766422607139365652 ,  830018746599536520 ,  1188469252932788009 ,  205179122363891749 ,  1797483675205185145 ,  1041993241745036534 ,  1343345136513580810 ,  225179019225772058 ,  1106896136264245660 ,  645500271052845476 }, // x^2^584
+
+{ 1081061419627695838 ,  1103961099119573075 ,  1804101499881910568 ,  1932378277546199400 ,  268501693581528563 ,  143314249977337313 ,  2271351718325838601 ,  871939362937064027 ,  883987594920236514 ,  1340562616417799979 ,  1313370860937026615 ,  1338336132287213803 ,  761837483474866212 ,  1467811491792706625 ,  1387988804052214259 ,  665213199239777985 ,  1153890277125956346 ,  863373803795695325 ,  1550349231005547787 ,  1967061489565872858 ,  2024601011731558505 ,  1782618137380653499 ,  1820738654009605976 ,  1978952479637654696 ,  762741600333457775 ,  1222584584935624138 ,  179489422227675371 ,  1376077927130952897 ,  1222811008988126602 ,  1309977171835057766 ,  2165908628211045200 ,  260689008457166463 ,  1177432714555596392 ,  1110981232933650167 ,  2221045703192292265 ,  164579772815117659 ,  2043326971140079072 ,  2097356893550680212 ,  1698523377338259067 ,  865670484255974542 ,  1648220249608409231 ,  2087907473306491094 ,  2173096481873285155 ,  1952333865929672603 ,  2061713386150361599 ,  807041306684870157 ,  417712687068174130 ,  17745918125588393 ,  2228578215214129865 ,  1022712268824424327 ,  2162894104691868047 ,  731982489928261320 ,  1572020091025341015 ,  1668914854360362863 ,  2075303827880994005 ,  2260866543800567508 ,  797271330969215296 ,  1093225464076617440 ,  2294077115661430258 ,  1258275935361363130 ,  1628530241782984423 ,  1835225474159284741 ,  2168376488074306657 ,  1969298056650504786 ,  1228299157527817097 ,  330567584414157508 ,  337081553535954497 ,  1854085207279237765 ,  1518828627464533527 ,  199491724247556123 ,  687671282073144856 ,  726511531292396014 ,  1647350158617734187 ,  604770952243122233 ,  112088267559928877 ,  419978677447450505 ,  2300966962863176707 ,  1607379411999652340 ,  179568085390415652 ,  896125388718973485 ,  210200958133881431 ,  272407662097746784 ,  2053186717338838686 ,  632862929945156559 ,  500428887960260707 ,  1387865570866934152 ,  73931147029234404 ,  164809656345698687 ,  1692566224541989788 ,  351906684203424187 ,  1743655143210604452 ,  912313385196415189 ,  2108198631646626786 ,  1813736377853071597 ,  323090739673695792 ,  1329524048157251981 }, // x^2^585
+
+{ 1314004057253585064 ,  1507689978185565114 ,  1793445004165964903 ,  554760000624908995 ,  997650866884356284 ,  1376145577230208037 ,  1738304172278568004 ,  336240629051951380 ,  2075255453466443567 ,  1643699609988185767 ,  63686963103202519 ,  2178022207708794379 ,  2097080167635119734 ,  310591363642100353 ,  1932269704426841833 ,  1310518906270704769 ,  753933624208669900 ,  455090195858882905 ,  1089981971257320433 ,  136578863829648616 ,  2107299327077327219 ,  1156913927357827920 ,  753547565666609638 ,  119254311177547644 ,  1798264393994924571 ,  1758302662466755387 ,  35116036518284346 ,  1912800683687899587 ,  1848351195833806506 ,  1297419344543195805 ,  493095215004558646 ,  1046496124442947705 ,  1379605052233531625 ,  599827227447219868 ,  1370676405511076788 ,  1366334801873599333 ,  1395039233835443873 ,  427860444072892106 ,  1028889442139053382 ,  522654890475925291 ,  1424231634436026386 ,  210385940247302111 ,  261671781095747063 ,  1433370097989255963 ,  1137980685983317420 ,  1051710605668778418 ,  208549055037024710 ,  1254406658443996909 ,  1419641938077812070 ,  634882297760739702 ,  375684280451100006 ,  1987045275439793092 ,  1505640678477524294 ,  2136639004803785433 ,  1605305488942343524 ,  2304532916299270665 ,  1674426685199292494 ,  548741082132811145 ,  743142768878593901 ,  1869995721316279658 ,  901000391243232886 ,  2192424379293173075 ,  486432286789881359 ,  232683713838733398 ,  827339127543284275 ,  1682356676054163345 ,  649715823396652770 ,  221968553486774313 ,  1456968860123596400 ,  748895289750148360 ,  1543670100160155311 ,  319531286741303785 ,  268025902277799240 ,  1626424650036186479 ,  968810470725765710 ,  1741653476839705667 ,  841756944146996893 ,  1400635531084278484 ,  1863992197401323830 ,  1007343468547834628 ,  1260518632657262553 ,  1485067269296778686 ,  1962407485186311057 ,  872004849117386440 ,  905330896062994916 ,  1859422443565551173 ,  1220722779948847557 ,  809268240764742185 ,  1387482993835184783 ,  753059700427289104 ,  96947044443261111 ,  2049994073835505725 ,  2117417417183246008 ,  976925048072037042 ,  2263552474757333470 ,  2059008788934636104 }, // x^2^586
+
+{ 1260503298600674515 ,  2145770722779674075 ,  811582386524097506 ,  2178795333535576371 ,  958984259289731953 ,  323968551603902777 ,  281721466958378651 ,  1119875339762291022 ,  302169151532839516 ,  1978886416296686896 ,  2242270845204614390 ,  1182462396409721689 ,  3696516815145674 ,  1541296175038843049 ,  154701162970405771 ,  2032821782891048390 ,  652803223501487822 ,  793351112541584894 ,  590222646388482127 ,  1623071558069404822 ,  616001655647410680 ,  1755562812293738925 ,  218256565116535932 ,  911939074446585510 ,  87267319949791968 ,  1157861370910902987 ,  1623963176915844075 ,  672560150157449963 ,  1539010060104972820 ,  899815041422422399 ,  184036374462333287 ,  1545465757997214679 ,  2208620731272800080 ,  326711503706551868 ,  681547998754737335 ,  1821915976532956406 ,  711711713909236128 ,  772382244526231962 ,  1195633746777641441 ,  502134035929970528 ,  1982251903015417300 ,  750752718831491434 ,  833969036450675551 ,  260447159701859891 ,  1363499886542145101 ,  1604297026139640006 ,  1147145673940777500 ,  726007669580222295 ,  1397282953100095628 ,  1673315673429213567 ,  438690246959113112 ,  1714399424628490590 ,  442841915185824919 ,  222091118168435226 ,  1691896963298387313 ,  1114388818682807126 ,  2199206081573562063 ,  1278597689680498101 ,  1452629819741011645 ,  2303722892185248935 ,  1387905259849252232 ,  156836476439013818 ,  453588693122446662 ,  1488199575577372275 ,  1760376554843517992 ,  1692119623223809491 ,  1551709302390579271 ,  1592583918569261133 ,  1394232453928347120 ,  1160806555131879939 ,  535663895261948296 ,  1444418100807125060 ,  854007333098205764 ,  1791780442961354147 ,  2273418234170413570 ,  295125664202717317 ,  264012652662622443 ,  562167169440071633 ,  1279648137650031118 ,  571253553152461426 ,  371981824998540597 ,  547128573482078227 ,  1206804247517075315 ,  280225506535870631 ,  1665662666677163969 ,  566960179645437251 ,  792409386567740466 ,  40283687036480037 ,  1030159765700787055 ,  1935509321155792430 ,  1000962128740171179 ,  1894006315484701856 ,  1668641016405239714 ,  1376322865907148110 ,  1299889580459156471 ,  2196080503653302003 }, // x^2^587
+
+{ 561128271456060162 ,  1460485956612971466 ,  1894746131673113641 ,  1183101996099202705 ,  839010109332505476 ,  1014884414412334757 ,  1866541642967850401 ,  1211747079383945039 ,  1500842993675900142 ,  1281189855962164076 ,  608260918938406759 ,  2260082633883188139 ,  404423132882419513 ,  655496795062626153 ,  1083831756781582672 ,  552860208223198824 ,  1144290010875349555 ,  1907771839103565152 ,  2259176060903638811 ,  1927389669081139656 ,  672160950944926579 ,  1086198473094476065 ,  756289841521796117 ,  781625180585673505 ,  93212109828073798 ,  1559317419366834802 ,  1501674356338810266 ,  2190642975917428560 ,  651096670072945710 ,  1377527163432995192 ,  893485429812019002 ,  584896359639319293 ,  1888841559721495987 ,  1924652595639761784 ,  1844290001040114216 ,  247982790313764970 ,  221742982552218043 ,  1407723978354246716 ,  1994990130810947679 ,  1641434359328681939 ,  804806892573158016 ,  2222115607448032131 ,  1954554143889073348 ,  2278052035450135278 ,  860481984856428002 ,  1677931882943111181 ,  1069767276823908911 ,  1224787651848457546 ,  1278829490026256340 ,  2012873152410147828 ,  1637140155843776436 ,  1707583466920685717 ,  1668128376104364874 ,  646494125352532370 ,  1175308138421660563 ,  1707309989428501576 ,  956863087869599849 ,  1011759536209738991 ,  105987839575605589 ,  628954900198161666 ,  654092659056350062 ,  2228050795450997701 ,  2261835340859389690 ,  1715641059301871805 ,  714897779954223805 ,  1246383833442584611 ,  973074449563123332 ,  258263768704024993 ,  2238403749025332100 ,  1877969764896770092 ,  1318538339736798600 ,  1231671921874502030 ,  1690982303651038436 ,  1641779746763367383 ,  76975209433548809 ,  1094339527026566340 ,  1115602344870896791 ,  982465276198668640 ,  142088829395222115 ,  1662138981016139615 ,  606748663147812755 ,  1185022882717662400 ,  2215939286912375250 ,  505298941110035248 ,  930932531813621555 ,  109436016516697366 ,  774756426950138168 ,  2264874359329132693 ,  595826404530498463 ,  1024181535034563472 ,  1335892207767681200 ,  787089973190096219 ,  1438629411510133958 ,  874173472108533436 ,  1738305510057605170 ,  1448589205730523152 }, // x^2^588
+
+{ 1347912818485591803 ,  2249871959871988571 ,  353233357712534342 ,  1609815920766976649 ,  383298320585107237 ,  615302591457810201 ,  296293315246880805 ,  1294955029019413588 ,  1021212240670241318 ,  32726370113211904 ,  1526522840202344659 ,  1779388816671342424 ,  891853382516657010 ,  894027901213086701 ,  1024388481494174210 ,  318851202740110056 ,  1301915909690507765 ,  2244347406457582403 ,  1931430334029307286 ,  1761791594836302069 ,  1906556318217550481 ,  1515889005422546539 ,  1529809314299966244 ,  723852856098181625 ,  574846201133831419 ,  5384552490965116 ,  2128586581986470378 ,  1072770940861823032 ,  544369454095513905 ,  323591283371527746 ,  187461088819365015 ,  1540452222499589084 ,  866328945906926627 ,  1247310835008924199 ,  1373410695264479196 ,  2278998760331258539 ,  1046104821043317535 ,  2165785609072444307 ,  1045335546354681730 ,  2041973973147427563 ,  520814506209277252 ,  1760982029430045521 ,  1738281497284745645 ,  2003767019265664646 ,  1647835067704374739 ,  2185280325505932436 ,  353639271280916393 ,  2036360987045967513 ,  1245705157965609760 ,  78548273471442540 ,  1062722846734227178 ,  1742004583696092576 ,  636902998289393959 ,  1594202664146608855 ,  770577787094809394 ,  1946714246383448785 ,  2250696485532345282 ,  75474339881147884 ,  1406411175554438543 ,  708913699753600772 ,  1243294991081650916 ,  141017160377170911 ,  1969643251430366742 ,  833107550350443644 ,  1846760576706450396 ,  471174620784513361 ,  2085310378306754975 ,  249192037874652397 ,  1838922193734398301 ,  67076060294596479 ,  1837205879501094835 ,  737064328114129533 ,  831701780719523482 ,  1718046263461833597 ,  425424048252043329 ,  1819160047029673412 ,  1060577394950042483 ,  474129203457674106 ,  1263408796040363461 ,  962799956058423818 ,  1984820034021982764 ,  807348472209735537 ,  587774116659831414 ,  1250470949021991076 ,  1709507521246640087 ,  526795281244791090 ,  382740752198979869 ,  455862729198059598 ,  188753940671151795 ,  2028918226879124039 ,  1634919602903175701 ,  1813947880339900366 ,  700264059097675515 ,  1187427028499326756 ,  40317518103844984 ,  1656137811889223069 }, // x^2^589
+
+{ 1126335933617060454 ,  1117687359551750261 ,  100379228285462950 ,  1996971103256778504 ,  978610241229664593 ,  115300062463638785 ,  2035020636680495969 ,  45370558440441136 ,  1009338258144377104 ,  1737046130150314044 ,  732680413325558543 ,  2281607611012569528 ,  108230443674101918 ,  2278305264575041347 ,  68617125148179649 ,  994354308265071096 ,  951211978018026983 ,  750794497238356225 ,  496504265012544806 ,  1004725680388627433 ,  1399252260072491758 ,  1171626422956055956 ,  205802871603342904 ,  1215856116543203809 ,  1971229022057873069 ,  1993440155486332631 ,  1261897907869210172 ,  1319286132004310809 ,  808548685460425841 ,  2020953703792444608 ,  133430463074323535 ,  1019511218143108727 ,  1204589165514619549 ,  498120032633772185 ,  1394578257187375259 ,  1399906658387580085 ,  1957665675093507421 ,  1956068820114752541 ,  580606003725930132 ,  1624915076979691637 ,  1408538847023387952 ,  1354857202442878936 ,  2106110611042412330 ,  349347519111877643 ,  54771639999554103 ,  266713902121820890 ,  1519113528182856592 ,  149934042639122172 ,  2177679970173164997 ,  1416736229759627644 ,  1481536047990399953 ,  2231166940983381881 ,  395039379893519615 ,  2101225161446393780 ,  675158250234558839 ,  1439905311602108620 ,  1107015408380070552 ,  1850827901805198688 ,  1805218349904461789 ,  801969477283013192 ,  333093953869429436 ,  1482705123709719493 ,  1612025400140635553 ,  401139069200870688 ,  2215803764246660814 ,  1922217310940209478 ,  1518868385980873231 ,  1747847000808779822 ,  664930327478723979 ,  828600504714001934 ,  1310563114868178690 ,  754090538598791838 ,  1646220576252534387 ,  1421286168783206592 ,  2126372657413572795 ,  903473031719368798 ,  1346805566654181274 ,  398623467745196491 ,  537288256219890923 ,  213812388354891104 ,  190541237645731777 ,  2302812049019630005 ,  433589171399799685 ,  813278999305632018 ,  1193253049045398492 ,  370559516192426925 ,  1975514096551021413 ,  47749761277264933 ,  936625753823867274 ,  1378895134360068339 ,  726314072207596195 ,  2058953843771909630 ,  2164419454079084287 ,  1865796057921103187 ,  2009394253561114212 ,  138656261424587723 }, // x^2^590
+
+{ 1738113760655442278 ,  940129339324619636 ,  1962143626363488049 ,  693454564717136985 ,  1342298468334569368 ,  279998779434269537 ,  437386633681759772 ,  1620123404093071532 ,  1320513645258448320 ,  911124024122594214 ,  1662224285581369647 ,  449489440533306654 ,  922361935044247569 ,  2070598089647215624 ,  160328278871981604 ,  1200816772422589989 ,  1821390173535987144 ,  412564898155254286 ,  946577265389634035 ,  808140230243773982 ,  1997500690366837881 ,  469804932796869198 ,  894125012055053893 ,  2236490735900593828 ,  1128801052198091530 ,  1713610582849721758 ,  1406309242339969744 ,  1037819933327551215 ,  1173408508426375358 ,  496384030361515512 ,  1951660049557744945 ,  136528776828816404 ,  2074542479331858101 ,  1335529336312560112 ,  1268573383214428030 ,  612365759818865651 ,  1703912472116472913 ,  78724221411833634 ,  1254339599278970008 ,  194843405486416832 ,  885465939487522476 ,  2039858513144131637 ,  1846842371318310321 ,  899113064288908739 ,  589871360057096362 ,  946228207765144024 ,  349783745168209806 ,  1570468496601111523 ,  1276656707264223037 ,  510559869314488678 ,  282989597981299296 ,  1634544474459013941 ,  998932272874322694 ,  246264590393899513 ,  1439762881024242581 ,  909074388459960174 ,  1155241620005664640 ,  83090783618402301 ,  2244384517453846467 ,  1080657673264160030 ,  1186995345633977535 ,  1965984421998043909 ,  937945616956233519 ,  563855685735670659 ,  519523139787142479 ,  474140835444105465 ,  1674170036145901873 ,  2114141497054716351 ,  1876332867875538363 ,  1050979424898338557 ,  1250394853416409028 ,  1775323672106085083 ,  1799851439526991957 ,  1637087739056611421 ,  1959714815547289545 ,  2057656160840143465 ,  2218689562596810426 ,  1933868925686647375 ,  359360568881622818 ,  1466331619368650814 ,  322875344810885650 ,  811214344810423505 ,  1514068409461764197 ,  1163999169278689363 ,  1724075968681368000 ,  674684795327164611 ,  333787099001091782 ,  492688337267729669 ,  760096310850995514 ,  527530007583411268 ,  1881944491787917552 ,  234482596887907651 ,  1540323516372137666 ,  2253075395886722100 ,  1268574316982249173 ,  1283271587393632191 }, // x^2^591
+
+{ 339044613489820318 ,  1480764058212084904 ,  131514522996145454 ,  55841092027659320 ,  948944452434849693 ,  428021292664092879 ,  627567470981957355 ,  1701468227835584427 ,  2142449045690434653 ,  984808442040186442 ,  153002737703284891 ,  340817122916593547 ,  2095239126678752745 ,  1552362767785196142 ,  1612101692926055960 ,  1235287820290249732 ,  755624733158712003 ,  36678900642297135 ,  1432464299657336478 ,  896058648202941386 ,  2249498287967933114 ,  1753185567061942705 ,  616449896794833777 ,  1925047486623999775 ,  1299395652353273636 ,  2132575591722174270 ,  1163755361879064500 ,  1194507808330712389 ,  1498215140141141989 ,  1261977070129101765 ,  415670406878888427 ,  697282390164936407 ,  1602792107622130134 ,  1935909187929743339 ,  896296898317604402 ,  49075278420036350 ,  2303827479081887307 ,  1529109615099333898 ,  803366306208862895 ,  2084414610228051390 ,  1847455737683754765 ,  2065314031421910578 ,  375407694659875723 ,  1941242552221350533 ,  1887472456459948319 ,  1308188628676524336 ,  1181727737286826700 ,  2116123515562487920 ,  1014304748352949084 ,  1685712559491285005 ,  1149618307732711150 ,  349242428233743559 ,  1863936373714978421 ,  2056550364198251746 ,  1065599950158181505 ,  1482203146558521037 ,  560531140742358363 ,  350629004018160556 ,  1683742728878042525 ,  1489195477169855635 ,  1367172303780279894 ,  1670515360964744521 ,  945994788655028515 ,  739584625019195789 ,  2012676469171106258 ,  48314986152403906 ,  284311886421998823 ,  694931334248466550 ,  1657723068251616071 ,  277842795468298703 ,  242396298583106283 ,  1283443141726669537 ,  1834336283425877749 ,  1941429902235491894 ,  353222478479591648 ,  2231108266018805293 ,  2054678531065108945 ,  959889169816649158 ,  145254719506575411 ,  2169484690428739255 ,  2000389995422118329 ,  432832304994334787 ,  2296389741542682772 ,  1579036245714774667 ,  460427605022702333 ,  2214428854895085183 ,  208234386006607020 ,  54261436549546086 ,  1144421085225598965 ,  1371841005349127841 ,  289108110323029657 ,  603840778316019234 ,  856194535078572855 ,  1081672159015028094 ,  1579597605408290193 ,  1591954430772727420 }, // x^2^592
+
+{ 343936647121103205 ,  1213028140069921341 ,  938511554858866122 ,  1548977998686857966 ,  768491358481792438 ,  1159145507280492387 ,  2071629573005764310 ,  1957766538165388712 ,  1964415346010188404 ,  2133713743176059847 ,  64221997341948773 ,  764159283116821335 ,  2212149892351266431 ,  123166658518928293 ,  1222518252548280806 ,  1183919549432799893 ,  1258445357354358890 ,  1274562846144533839 ,  411467099528671069 ,  227108992385950869 ,  1885275849703514968 ,  551526159876860236 ,  747135361050513096 ,  1891826277465071191 ,  1927365217804403185 ,  878366823410213373 ,  121141940291886935 ,  701131273563706879 ,  1005795806260827396 ,  1132402523986982867 ,  113111921954929255 ,  139679509104384500 ,  685148496309568019 ,  1049812173813159177 ,  1518236252625342670 ,  368121571268873537 ,  121028953785145071 ,  693900669961458065 ,  2118764134056739409 ,  334201279672514825 ,  1018400050007899175 ,  600049024420180023 ,  1218140580358101547 ,  1083067906522132356 ,  326710588666573060 ,  2244006084533426619 ,  1069401554465075937 ,  975329168767591660 ,  1856135449544121465 ,  341761690508095111 ,  1603236910557561440 ,  1548464465542239379 ,  2210787741150008145 ,  1209645221446397499 ,  1876678474201574970 ,  903113208379033605 ,  490149890132530266 ,  745052336260457922 ,  1001175834152723009 ,  574406481288322811 ,  1620738098108733212 ,  2247920149301803013 ,  1396457639183558792 ,  1586058436705782087 ,  1029632974711304291 ,  2060389633215055654 ,  1599640601233108409 ,  952551970644158549 ,  1450996083513164954 ,  952527409971031288 ,  2262621128262630132 ,  951985720538028046 ,  173718130455066104 ,  738537979347610450 ,  99698986575875679 ,  2239936815778894104 ,  1906537236590688988 ,  1723395021100666019 ,  718735987826301125 ,  475178791346239618 ,  82178078176935539 ,  166337808133037152 ,  1699558044433267206 ,  7362171783690762 ,  1408856566638117401 ,  1725285157676576664 ,  558028523038548766 ,  1751343011142584559 ,  1856872940337870098 ,  1209745945658209329 ,  504601284801519166 ,  1305504709817682791 ,  1484647227705414028 ,  1930913555671749246 ,  675569916323013911 ,  1315607326895283012 }, // x^2^593
+
+{ 1503031228923191710 ,  1980265483204132107 ,  168983386368000956 ,  1328313388331250571 ,  210098004406346475 ,  1391683241401047234 ,  782776698332798985 ,  1732592592464486390 ,  1480108996142439960 ,  2121143288581009608 ,  400715922378853718 ,  117708416184099664 ,  1945605130989141773 ,  2002306241499392922 ,  546233212979283258 ,  2132593312719966511 ,  1025595319769301480 ,  1397869027818849714 ,  1101042773077331401 ,  2120182366517751347 ,  797366166204790653 ,  1464767760406784016 ,  1305378294490136745 ,  1677766933305034885 ,  898706541269032589 ,  1271130875167681022 ,  1884617969856214493 ,  1019488119116132518 ,  524526243044750325 ,  1492489520281031454 ,  306441501496354972 ,  944435898812768177 ,  1287981232524065689 ,  1834622757407203455 ,  108113831239884205 ,  1735961629680472237 ,  865523761084074655 ,  1859540977963700881 ,  1966317295694418003 ,  1920572189779914418 ,  1747659260874225019 ,  1402160150741151641 ,  1480393025124424679 ,  2086766772747122944 ,  1476113408403351846 ,  1276688346426269093 ,  1672814353969318881 ,  820561549509547875 ,  1883902514162899803 ,  814179590009689177 ,  256301123444273572 ,  1239159652145960223 ,  2226382792272646901 ,  473000983403880550 ,  457859932001371963 ,  1238808654453640643 ,  197233274335983268 ,  2484623029451675 ,  108719769482821806 ,  1266777408653111076 ,  321529063448372268 ,  83685097695956727 ,  1327207679304339521 ,  538680653932522014 ,  1876798229266367408 ,  864689023263261981 ,  758227359435648487 ,  2178978446728875691 ,  1948974156972416166 ,  1240511572736560310 ,  592825680468086992 ,  782530515269142322 ,  1636270798753932367 ,  345091667546360705 ,  1251074499258368839 ,  1814984873712233240 ,  1703357943731637455 ,  538550375370586191 ,  568057542029567445 ,  710841138495590313 ,  1974286588556231034 ,  1944892479388366775 ,  999880508870259113 ,  1714753358543506285 ,  2278729066823325507 ,  12452923334643193 ,  596027676585533729 ,  1341435839545331442 ,  2133092871535300287 ,  802357976091463977 ,  1794615291510238982 ,  1148710053696519921 ,  724548680187984799 ,  791979165385684905 ,  1071410729190022985 ,  661925612625386995 }, // x^2^594
+
+{ 580713107867530676 ,  522064955522499572 ,  1552097908973033688 ,  825154367294169288 ,  838978437929303489 ,  45176442112243370 ,  786001237708891670 ,  2218997049939446586 ,  2091444507029136782 ,  560218770440352981 ,  60952074156189995 ,  1383461534108950926 ,  415431521073443482 ,  2187316530028257558 ,  1082557894563841502 ,  2068965347292579691 ,  1728327896552605302 ,  1909600449070154403 ,  1982769016718828574 ,  1879983082842419726 ,  847112369023932256 ,  510989225090233746 ,  705603623551619442 ,  1059081799769779661 ,  1345819351775914762 ,  1284203956060182660 ,  1642128061917915989 ,  1328728855122476584 ,  2278721032508498936 ,  103042044498577757 ,  1790539998344640027 ,  635009815209711686 ,  308186918058211950 ,  974696041200062996 ,  1603746945653902885 ,  983682775039826224 ,  1459077499434390413 ,  735645221599239632 ,  640562764441552066 ,  2303389629752594573 ,  1643288847194395988 ,  854243265299033084 ,  1574672997750775692 ,  2041179744041383335 ,  1365825686219639467 ,  1753426537349940450 ,  851457604705229248 ,  1565472021999789381 ,  876436577941721383 ,  293034083053076316 ,  214406394613682022 ,  1264555320264698269 ,  982934727147379438 ,  1165569880417862689 ,  936158875442719548 ,  2302038891820230971 ,  6362483664566705 ,  774353936347666569 ,  1593746814838697886 ,  766145034019939090 ,  882843795835056426 ,  701114101682788031 ,  677618035438821214 ,  521659145238288353 ,  983992530526431316 ,  1784634903382743474 ,  2155209239807642173 ,  1396485572925638215 ,  1682710970550597839 ,  1821623506987620403 ,  48505637574534239 ,  1648126611931276596 ,  676175654556037974 ,  1455791035096821859 ,  301129839763663231 ,  129444139830075224 ,  1738211757073322215 ,  418503012353825705 ,  701419537527895943 ,  238385370164426276 ,  2245144687179989735 ,  327062666506011605 ,  1899647288955451422 ,  130225960207123298 ,  1260969064162807365 ,  1678669810148227057 ,  766665511182163071 ,  1424444451538779077 ,  1963454817625304067 ,  1563723862046905283 ,  941282638660871499 ,  2278122600576491743 ,  299358286258820484 ,  1555041828665690240 ,  1164307844414404385 ,  1030415137034380536 }, // x^2^595
+
+{ 243428191602605210 ,  1958541410099025355 ,  244854017318327576 ,  629703266095941609 ,  1907655983207444198 ,  144201677867147779 ,  55672069733147813 ,  1068173893750802840 ,  1389160486951631009 ,  2105338802380664400 ,  2122155008175094081 ,  1377167407844055588 ,  1900068028239944700 ,  905102751298126063 ,  2101501870949500834 ,  2149530154984287051 ,  1013077968251695931 ,  769270564729742883 ,  1893135668569461617 ,  12836894153846961 ,  1250670290008460113 ,  1871042863223737811 ,  1964990178177639777 ,  1673998678051175129 ,  432681272184529195 ,  1957736947961928246 ,  324452785292650991 ,  1877394391893611015 ,  949657889174813738 ,  669395276097392455 ,  1249066366749933090 ,  2083872101274355424 ,  1791802203928692300 ,  2037515256695579532 ,  914429769920371455 ,  1749545762256064205 ,  1483293821141838279 ,  1239936582445486017 ,  1189590998989545090 ,  2267439542747724900 ,  1612866790155671728 ,  2246749103853521836 ,  1804156918874415730 ,  1479282108737091832 ,  86586150550490156 ,  1051587668187708026 ,  1723819520488998756 ,  1288188477957364434 ,  1343765398698119773 ,  521444099678089865 ,  1210949426009417857 ,  1238940148114580878 ,  825406677080726400 ,  392871120759886719 ,  897679724833209310 ,  466463952185155631 ,  1921130424150973645 ,  1449362060589046710 ,  1479092095167086657 ,  1919957952771137136 ,  1477292226725500404 ,  517419368623076532 ,  1482901182559939332 ,  1114746052843973120 ,  1348109877977492201 ,  1399372515778261956 ,  2137811501083683998 ,  427797615423506116 ,  1653503363772106299 ,  53426597944768617 ,  554630085367944103 ,  966475195654248357 ,  559052411118677403 ,  332734914448589554 ,  1555920011249249130 ,  1396620331606259836 ,  152565842265034198 ,  788965655830841872 ,  765780730963819167 ,  1140807182595568964 ,  207220050002761946 ,  211528687133204966 ,  1981010259213359391 ,  936583641238065574 ,  2189693624965704357 ,  582075468401058130 ,  1415602834359273247 ,  2230049458705627217 ,  205616073661509132 ,  1325792046135534941 ,  171013248282687128 ,  446023501286429130 ,  2143073407687220294 ,  1582415546903717892 ,  1455909623265554779 ,  1944428479616441503 }, // x^2^596
+
+{ 553801610419481793 ,  1912942240686881978 ,  515421775505808807 ,  990219773146855819 ,  2024370123440221294 ,  1068703517814572861 ,  1524911855410795631 ,  1510508049489940660 ,  1618867392191957477 ,  610499630217213192 ,  1086157227276646150 ,  347975886822831961 ,  122868013523202774 ,  810195358400672667 ,  1333655386098685613 ,  2222138218091053287 ,  1347102748067103108 ,  1134666031150492988 ,  1733023281475008426 ,  764628859362318423 ,  1508253189527587088 ,  252703835500201707 ,  1010192400548822828 ,  1234390297176185769 ,  227872884037051612 ,  117098880554497305 ,  669703010435108586 ,  748998016216873886 ,  952791156842339335 ,  1268804432770046285 ,  1436775547086525202 ,  1974541375009378439 ,  332747484137069421 ,  108330116524620280 ,  1634978748551545063 ,  242947544495842724 ,  591047111086022765 ,  2098327147850501215 ,  773443833721000743 ,  1459550139398109477 ,  931364947246768819 ,  2040787401201173185 ,  923046120022939953 ,  1612109577982907806 ,  1211330307011408032 ,  1027053658645557023 ,  1074342640443937032 ,  2073712413230793728 ,  1771864626024122765 ,  1058997598471913308 ,  1055096681038061468 ,  2179963849136736537 ,  1187862022744751649 ,  1262176156527653427 ,  1019983836599710146 ,  1541398289623393123 ,  644514269257082882 ,  815250310731255828 ,  1987059824903712343 ,  164439707459709435 ,  391461481850582305 ,  266372576420270572 ,  442214767725533670 ,  1170889128241786308 ,  2280385495271027776 ,  2014798993324152649 ,  608768798421317137 ,  2267629363424219223 ,  278886358766610458 ,  897800435397779875 ,  1852857790159398867 ,  2216777559341365845 ,  779453778324660625 ,  1914257879161299111 ,  567948485031419108 ,  1975331843759147441 ,  1443314840795304651 ,  1934687519948722846 ,  1593056908076817437 ,  1675867796164255329 ,  2157641093071599323 ,  1855504139559937716 ,  1165913838414207038 ,  668027141783937566 ,  448800809084395707 ,  1176516100498312734 ,  2149833513913277479 ,  1925242404945055140 ,  421735005436840517 ,  124654279147745036 ,  2048657675662506581 ,  892710042834348557 ,  1223898500139966185 ,  831685137419044539 ,  2035023471325064868 ,  1694135169797054766 }, // x^2^597
+
+{ 627867488645259253 ,  1487366780406073241 ,  70239854659000133 ,  1476243180878504867 ,  2226204234217624952 ,  1045683505736553923 ,  173244358834080130 ,  2277634206487831315 ,  1044228222596946856 ,  1014056376412338926 ,  2239762837101526364 ,  1345098435232230370 ,  1993799227275409651 ,  855542894272692648 ,  162645079501817341 ,  1312008002989906873 ,  77530307182690612 ,  1184641300602149294 ,  630074628286470197 ,  1666187339214523937 ,  804246474149894857 ,  1378650447544546910 ,  504901004669221289 ,  1813425989344510795 ,  561445696601971560 ,  1734147660999199990 ,  1422881315926485390 ,  137936473259350577 ,  1467278513103533387 ,  436455752241657528 ,  1206742831114965061 ,  141376729063957871 ,  1837931114577492715 ,  310521677805455098 ,  1425631042177499137 ,  1682908928589963076 ,  2189548870327102358 ,  458064889840301612 ,  1051855792084501970 ,  1234200809903920764 ,  418008435660849352 ,  940679479087578574 ,  1975418128889441402 ,  531502372809820498 ,  605727062676241184 ,  2004835884598910960 ,  456180806429489122 ,  297505353812374962 ,  1682873342909045077 ,  948817162480422560 ,  895583114341394691 ,  934770391583817948 ,  659062393805988149 ,  642689112241598121 ,  667430869573418032 ,  1756484054388980575 ,  2149887448308494057 ,  1280846303644638327 ,  240881603277435446 ,  1218097951039345534 ,  418182642585642760 ,  1807387571933884653 ,  972189511493427559 ,  1090771875231439777 ,  313327615757038597 ,  968853661568044560 ,  674051670359877593 ,  1699737179192243171 ,  1984264747105368665 ,  978189507623127026 ,  2143630314747037266 ,  1671924497449822036 ,  1671078719725539241 ,  329115548949004650 ,  1301699966937557258 ,  388744862623657083 ,  1166796092652689163 ,  698856766618773513 ,  1976272512716413061 ,  1113674327084613244 ,  1085829098794805820 ,  784061903720895237 ,  1584648672122817381 ,  1969315610589467652 ,  124282769807728892 ,  1274751286495261306 ,  1369460958140830046 ,  480284990104434050 ,  1928791806305246649 ,  678772877338628335 ,  630627503254243196 ,  94932944482034596 ,  1268557659718818515 ,  264685294174057795 ,  1445546900724777848 ,  1758005100729426524 }, // x^2^598
+
+{ 2238194508150543257 ,  1649998042368045547 ,  125128743976879666 ,  1392809720211853197 ,  1855247376056530021 ,  701990471479904336 ,  601196643449454224 ,  496022629196715176 ,  563200591694400944 ,  390990478487223040 ,  2178638576945511043 ,  237262631341152871 ,  2005593246666336129 ,  870808796481317368 ,  76197564034091066 ,  1456907974390032584 ,  1459943556807195905 ,  1689325209444736025 ,  1488766662907266298 ,  560231270557217906 ,  1610194926934426741 ,  1159606472619940992 ,  1492957592453415423 ,  754331627017477086 ,  1791201439313338649 ,  2136461295244821461 ,  800328356216292724 ,  746542111215472340 ,  681185449403012272 ,  938453147564692679 ,  432659052507573749 ,  545878045852291403 ,  936686257892590919 ,  1406637558532212401 ,  1798659817740403217 ,  30809505881742248 ,  1397090569422974582 ,  287420726485613191 ,  487262756918768046 ,  1311634144492031207 ,  1681533950034029844 ,  985713311303994935 ,  1326564611789041967 ,  1284825940376140473 ,  2274466419281539157 ,  1880724183379439376 ,  637914846327532425 ,  25032393060234890 ,  98405871106010822 ,  1136883522935176498 ,  424011062374320525 ,  62708936067952681 ,  2184049271403537583 ,  280891017907783673 ,  1681492808574859852 ,  1237009668856056241 ,  1685332346064123588 ,  1438602847960932185 ,  328494154017880588 ,  938139690555681873 ,  2031740750193234631 ,  1785008790613998408 ,  663460123832063168 ,  1786254779826250255 ,  831287473446993272 ,  870121432013547961 ,  1813945066757974936 ,  1122023197662302091 ,  1401130255129708641 ,  2158766955036109674 ,  1857730799029226248 ,  361389816169566111 ,  817068553405938618 ,  1436946659554219298 ,  1836717610489282191 ,  1996878810212642245 ,  953101497360659319 ,  1178431672644322315 ,  459897807708963363 ,  1377669704069837492 ,  1098742928365233756 ,  616025722585568624 ,  401030958887799754 ,  67493843885186834 ,  1708735231781652882 ,  1738963362462262349 ,  881700510559064887 ,  1268400228077574885 ,  1644593573761530561 ,  1084171739746265186 ,  731305712637571084 ,  1395386932173851676 ,  2136840990244182930 ,  1735029139054591171 ,  2045405806326389417 ,  953313226063352188 }, // x^2^599
+
+{ 905051494046677746 ,  848194258853368469 ,  2102024607296843909 ,  2014968440586392128 ,  1885235872831030869 ,  2004257798972384901 ,  547510613771791433 ,  177291336940753864 ,  1977210179194235587 ,  829718893205214882 ,  201377901259572609 ,  1142689017630461395 ,  71117840181475588 ,  1031935334978110883 ,  1484292710781957282 ,  626113617733179689 ,  1907987886758841298 ,  1813708858000252286 ,  1407697526467612390 ,  30469508003503429 ,  1257058109126749067 ,  1664453710600119715 ,  896272458705656440 ,  35480467074834521 ,  862971981807541654 ,  1480165299238401161 ,  1683393512202052451 ,  2294792806845871059 ,  1350106963872872626 ,  1327512932613188883 ,  951133849529719639 ,  1716627020142475389 ,  1347844759184195177 ,  1437643927700864259 ,  1088863928541242151 ,  1776054761709742098 ,  52704460799969371 ,  592030584749001832 ,  456857712229760276 ,  1394443432520200850 ,  1269071740963399338 ,  1828079962872321203 ,  515619739068173160 ,  2147667727050742257 ,  138023824268626601 ,  1679128423315559850 ,  1837290518398430227 ,  87290353218778084 ,  1598480147550391901 ,  161074385636714760 ,  1907145994279758605 ,  931684961824027248 ,  1300788855236391478 ,  698971459860959793 ,  590058937994525216 ,  1952299548692901303 ,  1966946861788861103 ,  926003378773927621 ,  2095482859648701928 ,  1261103656571862716 ,  1360221586045971680 ,  1842180178451655956 ,  735767501244395378 ,  1681640800324657668 ,  1093817188950623913 ,  1620418327466885055 ,  236267980313351387 ,  264808394269566906 ,  1920364858790854163 ,  1369672566290308940 ,  2008575839108395262 ,  1226678892545807230 ,  1155812864275519545 ,  1895279472537184122 ,  1517552829179673417 ,  1880398692196235565 ,  1960281978630837595 ,  241215513685916160 ,  327527971992291982 ,  426707084274305618 ,  1444453136278844850 ,  2218501150620507903 ,  722273839900606683 ,  222422972615421463 ,  1656475201878120668 ,  1581513085811323053 ,  669543289893882244 ,  513801533871320051 ,  1183659769442976947 ,  783473262460132299 ,  1452549352112058513 ,  1518370697454078235 ,  79802611818541340 ,  1802591164897797887 ,  359486103767491723 ,  479093475588848779 }, // x^2^600
+
+{ 986689829772061114 ,  1629265078661182505 ,  2018005802790474566 ,  725443586796667916 ,  1145181865203251203 ,  123292799333848728 ,  18749284977738837 ,  1724677928071014293 ,  209268835503398640 ,  909118388612387226 ,  2127292908116796085 ,  1803488538995381170 ,  1395527072978032011 ,  269418942365912128 ,  34559063150101148 ,  36502694397202067 ,  2196165423867314546 ,  1727272437757716462 ,  295755605358186388 ,  1518835453905235046 ,  3133405087871642 ,  852179940937493894 ,  952163588489741026 ,  547766528594026134 ,  152913760361422236 ,  246725769073391596 ,  66113709745719483 ,  164647219134652792 ,  2277853337297071168 ,  208404528666669499 ,  2040111513624675351 ,  1890162478521660345 ,  320363788177438018 ,  1414868078224439808 ,  1679076834045972256 ,  1479743997947872778 ,  1376156945304957124 ,  1925972821235936193 ,  767574474268619491 ,  1581530855759335838 ,  574748323117349566 ,  795743043702984256 ,  1558502196213293596 ,  364943454283989043 ,  1413752984448143600 ,  1153995571693130355 ,  2244420736119935508 ,  1153869268530369619 ,  1917029022078626177 ,  594042474503471850 ,  1716380478762166283 ,  674779606047216674 ,  210515292810825541 ,  120153130034889885 ,  1886781479064783043 ,  959229686692429624 ,  254611611634678085 ,  734233578343161279 ,  134199821352880650 ,  1864775928734810858 ,  133702035478565254 ,  917006262313656189 ,  2294973972644224097 ,  1602676880246368971 ,  756062463764526372 ,  397498038594539187 ,  302729479839779440 ,  833994553918473024 ,  1004338890277805030 ,  259205436923134297 ,  525020516083157962 ,  1829094081732164940 ,  1213275717313018162 ,  1254356011596248908 ,  226213402484188159 ,  2293266378135542665 ,  1949196240151130799 ,  1052380404572826779 ,  315080812964174060 ,  924756584013215324 ,  2231404287089121785 ,  1190551885248148911 ,  119754215048948533 ,  2278400077658663708 ,  976050094067202896 ,  1455615681032696962 ,  1000458641556372137 ,  1687863620313406196 ,  208345702887372384 ,  734376335568519329 ,  1523216452357031470 ,  1983541413695589646 ,  1484371363078314351 ,  1566235493895598528 ,  24503832980511456 ,  57637068167410074 }, // x^2^601
+
+{ 576753400104510984 ,  2127128012984067046 ,  998789438080840769 ,  1320137690679037940 ,  975684348721508628 ,  1632008789597559435 ,  2283697642633357037 ,  854791641408875757 ,  1660085640767636357 ,  593751143778759397 ,  433846655932711326 ,  1475871125554298796 ,  1512862124945705852 ,  1572538153027093368 ,  172100003206535175 ,  324216640727584511 ,  1206379382487021731 ,  2029597330028761043 ,  352010276811147186 ,  1752465696124767164 ,  489823938684900055 ,  1849200149907398458 ,  1046457836015452968 ,  552274963777233944 ,  2217568139772350674 ,  301984504861533819 ,  1062883619596602237 ,  1046284319835820493 ,  2235207236768101808 ,  384994749430909327 ,  2304365760809205010 ,  2230202393769482962 ,  2149482737988150511 ,  718982913661661263 ,  674053912838534324 ,  673051816250793308 ,  1200142732051063791 ,  1081138238768956831 ,  750798026793261079 ,  353201273810171893 ,  169086278848367511 ,  1205208030169868891 ,  1915716417438513156 ,  1038866781977207989 ,  897968418959662526 ,  894417869499945599 ,  954913032905656300 ,  7115913165752229 ,  2163315011733217873 ,  2097625594293634186 ,  794254073307659083 ,  1418210274873624440 ,  942094671576394090 ,  1552869996766878537 ,  455639031756386219 ,  1569040128739316479 ,  1342538861513008817 ,  1686013206480899869 ,  1683114787380362953 ,  1060072176536872017 ,  1217352792972247881 ,  130333263317368565 ,  494797863332638171 ,  161518443131692284 ,  1014059728164991238 ,  1211428528449677214 ,  2256691339558833427 ,  2206868363439037331 ,  2252232572317520933 ,  1150551936449750482 ,  1306039054546411118 ,  2208368903103379543 ,  733457056783237232 ,  1397662111629825801 ,  702338831908389630 ,  525843957011894809 ,  809231454210833489 ,  771736060857396601 ,  613972410637612976 ,  144387018444488593 ,  1187303508663080113 ,  2291572993542541886 ,  9948347432268563 ,  649743263523088214 ,  1012532529495557449 ,  1169301385215985162 ,  1817846109575323702 ,  1657764777748751362 ,  859238714403421046 ,  131070155197320748 ,  1821939503766955763 ,  259045315943638190 ,  151474799889899358 ,  1645289059483842259 ,  1365664488670270503 ,  81679787691087285 }, // x^2^602
+
+{ 276158124876944915 ,  115548959944490678 ,  651006384145865791 ,  1417523115963028504 ,  734097684984864918 ,  414171528393110848 ,  388344273531333681 ,  850711070091896375 ,  1448924833195679341 ,  325165269022283860 ,  441122313216796413 ,  1922670123471599152 ,  576539618987081747 ,  641800678051624521 ,  896754568638723853 ,  1495976113177103099 ,  248205753304197170 ,  2038509880142898250 ,  389496555440042325 ,  117995121463056530 ,  6644140723078216 ,  1164706414865570001 ,  1129021483753668999 ,  1765640011990298104 ,  2012813494566798496 ,  160379023174542602 ,  599839514307693479 ,  179757915700371726 ,  299793830668625942 ,  1233896474830290337 ,  2259581761083957170 ,  2253655820125021037 ,  1024558241285886558 ,  1672269767119915239 ,  1885165913280420812 ,  835929138954326137 ,  101345440162160076 ,  251170618247083659 ,  1324749452658575194 ,  423607922809532440 ,  1435739822999636497 ,  1214003061185410588 ,  2274291163870358652 ,  1604837781766928706 ,  1781756436070577203 ,  895345793053681960 ,  444117934330030822 ,  847320373376801943 ,  1633819285441884222 ,  259939583746167478 ,  454469887296551177 ,  597289974262909675 ,  2072214384679762079 ,  62659501000958117 ,  783734885343074516 ,  1129222724717070650 ,  1141383689243978076 ,  1069060029198133422 ,  194936028121795640 ,  2225281643415824946 ,  1573194532015798768 ,  838670225534157570 ,  172179586978679671 ,  918532910101894843 ,  733067734000815453 ,  2063509990329970294 ,  146805165306635580 ,  106209143231422738 ,  1973979912122418089 ,  1790655199488572213 ,  1920739035952761508 ,  1843743297118406587 ,  1101143660290647689 ,  666798987209097381 ,  559541866193658604 ,  1335828908521510337 ,  233268542590598351 ,  595899785499203400 ,  1991495671751728917 ,  12167774533204673 ,  1144324426166501434 ,  1687914295028909065 ,  2086946740896056436 ,  1955010021176785142 ,  2017261321030247975 ,  1853209881007881287 ,  1451416706349722675 ,  120347818022336246 ,  1453709999845966611 ,  1050969102544639648 ,  1639919061378595868 ,  1901130242740658706 ,  523500737137502478 ,  1474892299417162752 ,  569698642536720085 ,  1069351330532061416 }, // x^2^603
+
+{ 2026169100027713491 ,  2122636652803747037 ,  1048492848456578635 ,  1927834473591492881 ,  1363978383276114541 ,  864269887376620644 ,  1799127037741107718 ,  639287560323082605 ,  2080116846122820847 ,  1782940845583419250 ,  1802064660752467433 ,  719566963454494728 ,  1811500446932625705 ,  613105244301863321 ,  420370932157166846 ,  509224270537897140 ,  1699418338001529033 ,  2035452829487516029 ,  647680504056013209 ,  2069652385759708897 ,  1224393297860118874 ,  1526728158920208242 ,  1722561117720125697 ,  1347369214092530567 ,  428906358741885003 ,  2083600286727582173 ,  2160274178864949040 ,  62039010100489186 ,  2075460166663032697 ,  1906146278090004926 ,  179430118538269469 ,  472204095836165021 ,  1245837543394078297 ,  1986822926633564029 ,  1701956309307603693 ,  1144351386830433137 ,  2133298297356947788 ,  974687558582868262 ,  1998213297461370455 ,  201124622155337450 ,  455314477502018358 ,  1504881346639206052 ,  1221457834841112812 ,  1899943285633730 ,  79200653035678096 ,  1872939049122110032 ,  753406195423188152 ,  379746521859610913 ,  842489168032497624 ,  2107620029561701746 ,  353811914931805844 ,  642795447663119409 ,  798662209425737118 ,  374117897703769802 ,  1383632069953555234 ,  1848438731163824391 ,  692498038711064927 ,  40247906685619136 ,  451302221274633394 ,  1049104136487846778 ,  682930550859971845 ,  1835287183032169628 ,  532829474709848164 ,  779222906099446305 ,  1898486357050857141 ,  2094161947518115970 ,  1066948138384905420 ,  1864867616358113638 ,  1519405343937100939 ,  827480688485084093 ,  299243842176632563 ,  1348448293789432242 ,  1514526349574592381 ,  1528536257535668295 ,  2012126511803111100 ,  903076131919386482 ,  1478534650073417799 ,  842666025131165682 ,  646357748145716322 ,  1947451878550276646 ,  1706666410880125877 ,  1370513957079451809 ,  1195967359215438360 ,  646412548235182015 ,  1016553342233350847 ,  517585943236565921 ,  951781006289339387 ,  1242983622003009316 ,  2209089511434337430 ,  593616498092137228 ,  1478722485899430515 ,  1827474526947095045 ,  1544032100575720672 ,  1911458082092896545 ,  941360378711721598 ,  2291129292553235453 }, // x^2^604
+
+{ 2038965387657907437 ,  1525520388020638106 ,  1786508871553552957 ,  1698864265095131812 ,  1559642291175266633 ,  984725958249339364 ,  1106473343318787638 ,  994481084821131840 ,  498114977240695260 ,  1524330725420583487 ,  426104075933455851 ,  1936281291701133711 ,  1904858310747726022 ,  836230809902336124 ,  1415949690215640312 ,  2045280216243283344 ,  2083594863383570776 ,  150729039122398056 ,  403774262362011601 ,  211723002196224261 ,  1068668614676413744 ,  1589858313369636015 ,  2170291437964490216 ,  1540111411576140021 ,  485489498146871491 ,  2274109703089970795 ,  134658929576428266 ,  702887581015235609 ,  1586452623247820676 ,  1682159862447363184 ,  1578515298567293054 ,  2103414058740810275 ,  1485045477192571145 ,  760929455347390589 ,  1905061331905214822 ,  52527921561649182 ,  1348476323300970804 ,  55568732622520867 ,  1973304533945815290 ,  573366145824073774 ,  1876827222533771456 ,  307816316681450107 ,  1193411554793109551 ,  1906834081560409027 ,  957190988502614892 ,  1992231777767829064 ,  2126069665967879793 ,  1792213144460152562 ,  330779469242385988 ,  1224557479736766880 ,  2061593414666487581 ,  1807888766123551152 ,  45624451274445346 ,  1025757615556136795 ,  129968049905994201 ,  234022967369615689 ,  724415162012973033 ,  1100760318940062693 ,  762610277751645963 ,  1307120482156129778 ,  1605516057036940080 ,  1436224940990070032 ,  920068302217646453 ,  1288922884711494876 ,  2045581211114552803 ,  156326718223712102 ,  390821948445261490 ,  1670779463129590778 ,  42347253054364940 ,  496410059896721133 ,  1190127982255555261 ,  463475759927570977 ,  1165377014473885126 ,  628274853753675199 ,  2114797835088496752 ,  2216100922790410058 ,  1129677387297930189 ,  1854447401425314594 ,  732233744443879425 ,  653211134548596879 ,  1506638182677708078 ,  154215061633649473 ,  1754562232864298631 ,  611968718399084644 ,  617960392664212264 ,  773132271338488423 ,  229914667828191654 ,  456486865302317888 ,  310901980054368563 ,  2186549674193173379 ,  2104246564411665333 ,  566465949925634479 ,  712312002302299382 ,  671729328205491929 ,  2141567610692219086 ,  2082085588423400988 }, // x^2^605
+
+{ 377374615363699160 ,  90593709535303175 ,  2215009550440835118 ,  2033615502772908399 ,  678053168445763113 ,  1244692609058070960 ,  2222670481361448118 ,  731301128525027838 ,  622665018529840638 ,  2246845507719040535 ,  402436737727430944 ,  1643019531333675951 ,  1296898932960575222 ,  603136656203399704 ,  2288731041700193107 ,  427418830738095185 ,  40695214664816991 ,  106609793603495846 ,  567000569698027171 ,  1957354730454517154 ,  1735985553944783426 ,  1402962086161010151 ,  562261892188178601 ,  1881780633945307867 ,  1493419435220774739 ,  1147760679805701725 ,  1165026714506224404 ,  2281578872440065924 ,  329710931452848463 ,  1316383684793158191 ,  1811738161759055562 ,  2170600131798493629 ,  943682093173785051 ,  1023522084036101778 ,  2199003587626018088 ,  729073548713033848 ,  873254031917772650 ,  1355202601934844973 ,  701086248967283779 ,  335868423203504201 ,  2078113459249237126 ,  202603616860238928 ,  1897044879796277272 ,  1675702379735315326 ,  1539408714520554112 ,  1904426117548059086 ,  1995421670583249334 ,  1955111008747677759 ,  611860238897177083 ,  1839324155411777059 ,  2172674787311515303 ,  598754033644533962 ,  1627540472662635881 ,  817732909708797727 ,  2200514138956655897 ,  1953396925858488288 ,  1886445059798594461 ,  987957315240321068 ,  354102024177068432 ,  1566609220806115291 ,  1609986937558292252 ,  926403103467739633 ,  1012548168401307047 ,  613655312892789310 ,  2100763759562337650 ,  905429453683859558 ,  891470954772729900 ,  1342061599450805517 ,  661079834460369344 ,  481511018238458561 ,  2228271965466027634 ,  1597845191889997298 ,  1070542554007423301 ,  1688461431362886748 ,  1042705085142269692 ,  853498530454740770 ,  953115127392224748 ,  725709242293018432 ,  52651137129913465 ,  84274499563091599 ,  888446963640189920 ,  1966159078981761115 ,  514783502572053482 ,  1332483000930669144 ,  1815880155583682731 ,  300065129522061080 ,  1103414029887098798 ,  778234904187495732 ,  1138937853794954956 ,  1751040620471418621 ,  1905071221661887026 ,  1938945239623591194 ,  1666721489898536975 ,  981291176498402440 ,  452947459434725437 ,  1753367353325987989 }, // x^2^606
+
+{ 1804861493567442289 ,  76821438067103584 ,  502453323622809010 ,  707863941974668701 ,  66330477542976246 ,  198375859741387961 ,  2227343401244982409 ,  1110297198369980871 ,  2172434799539658227 ,  1659895990578643270 ,  1651709911689894729 ,  398484664472788275 ,  2043577637367946872 ,  1947487629591144215 ,  2198268628853941803 ,  2057712927554545315 ,  435244844144498832 ,  1549820963225116450 ,  404076675359283610 ,  1481356584618101407 ,  440221260973254307 ,  2034785762692692537 ,  344936425829637545 ,  2199617952238161038 ,  738667010769025411 ,  108624035883360113 ,  1026995487026032002 ,  650958509342679251 ,  1975624472618115639 ,  1488090679566069345 ,  1110683334104744085 ,  1164638845978078769 ,  2148528146021408071 ,  19439548410168110 ,  437422622661844538 ,  307454581056055387 ,  429319913413347637 ,  2015604084647353978 ,  683905882838731242 ,  2175941047869958360 ,  1708927710154935094 ,  985406625805108815 ,  1595569559350659659 ,  556805960148254114 ,  2121587190175121231 ,  1359090379110235442 ,  1205980609288457740 ,  485776243178557182 ,  1054045495584125586 ,  939031997674102706 ,  2217945272545170761 ,  1858988346017741065 ,  2108938110916645569 ,  2277767342765898633 ,  1765710203952304182 ,  1810045582979068874 ,  1547300564883475945 ,  191671065453187625 ,  469791022484437492 ,  1213931605818623331 ,  2049676033052986014 ,  1785164387192430593 ,  1464940465921427500 ,  1355979413217320172 ,  775248513877760945 ,  1579608491900099044 ,  726044722684498924 ,  1364780346799551222 ,  1991241810166259284 ,  1406395989935731213 ,  274213414760666995 ,  496279395691872329 ,  1362436498138334389 ,  379288903124590938 ,  1926762268723534772 ,  1143649931354737019 ,  325449804621697023 ,  422019650499506210 ,  1650992864540201642 ,  179995199397194812 ,  1619494738362492555 ,  2259362432663595794 ,  2113337666547771301 ,  24134846258493393 ,  1440336997029318686 ,  1240239312741995527 ,  2002247630992452772 ,  110022105177324332 ,  246315918857294246 ,  2266154093648317705 ,  2105795216519313066 ,  429047338372139643 ,  910109091523633363 ,  942804358470290030 ,  1552519555070646420 ,  220038815008862504 }, // x^2^607
+
+{ 623831925932380037 ,  600982882388826624 ,  2130510596743186872 ,  2038659985867880173 ,  505654557536239236 ,  1529886803412132252 ,  2103747297260283465 ,  1577041698659262076 ,  871750769716458347 ,  2067403165643597767 ,  290336307183938124 ,  409066059646040331 ,  1361249484346773457 ,  1362898308406925643 ,  1678755842644066590 ,  456854542823885024 ,  349849251729942600 ,  847041745361744926 ,  2055084881410604466 ,  117356453231007307 ,  145483006245871669 ,  857915240017668565 ,  1534651868392749576 ,  635652267133299087 ,  1682973347539137332 ,  2299762989084499417 ,  1206924506083131664 ,  2028955052018616541 ,  2146976683155168598 ,  395305586628888273 ,  1631391172760183921 ,  139862045644708446 ,  1506648829574622004 ,  1299639545626595853 ,  710346204327456199 ,  257305458164969613 ,  1139728999287144491 ,  213702173140004234 ,  708950536601134305 ,  1955874526066309680 ,  612600944025110353 ,  1177754026951749429 ,  1940120249607647062 ,  1134215834587338273 ,  2191468425673489603 ,  40772815324380222 ,  636907680951471716 ,  1883206252210525106 ,  1257697609117528430 ,  1032983690174340356 ,  135347281158737280 ,  1501257968700274835 ,  1428952362633194591 ,  531059448103700732 ,  1487057686520203141 ,  1495982641093970356 ,  491678806791025331 ,  642126053667789127 ,  778564865001759714 ,  129325229681200570 ,  1482433830521979000 ,  42825363690140709 ,  662803131608687012 ,  208547636495669732 ,  439936331861508487 ,  1683646573759255788 ,  1677269705918278928 ,  1689690568060065675 ,  1339394031159135983 ,  294668370665908312 ,  2146567796723996929 ,  1201197829865599828 ,  2052863810275003931 ,  390875815736467547 ,  2264426855653213288 ,  645130484307207375 ,  373596370790107486 ,  387937830269921690 ,  1183082999616222871 ,  915248317624718253 ,  1091928932794141891 ,  162719507969474238 ,  869917503532265618 ,  2232009696623270521 ,  172325774076937271 ,  814736359251751890 ,  2212422085672239779 ,  1334110645769164625 ,  1609319344182926998 ,  284173468169124317 ,  716183034018527605 ,  1760168309847979693 ,  25783934658202097 ,  1604948495243202006 ,  1779750858338619468 ,  157299926732237705 }, // x^2^608
+
+{ 961205169700328629 ,  1464876856680755558 ,  772115483043678191 ,  771162532391877245 ,  1853668289607801239 ,  1474751930294693911 ,  1767993193117400144 ,  383141682372778597 ,  2175629955412504842 ,  2208046760657606145 ,  1228249842524068540 ,  901907477288311207 ,  852443582785520791 ,  1972917129468538506 ,  232163493845699879 ,  371217796133834860 ,  598798149831778951 ,  1136445216369887644 ,  93797056888223609 ,  1363946246735895418 ,  462463516210752864 ,  939114784772332464 ,  1456786633211059720 ,  2064664270770659554 ,  1974216458505506233 ,  142800421005425105 ,  2148941862996989821 ,  234958396725734473 ,  1576442493761778575 ,  367251615822296590 ,  2155700072885155231 ,  1369597192364678985 ,  113335904941180983 ,  514255814647500648 ,  448111021715208216 ,  713067020209318276 ,  1309856003119494940 ,  1378698245567798804 ,  64575424992343359 ,  1062333128331459325 ,  468805385505095050 ,  2274742122457054217 ,  2225748550078770288 ,  752544587775107002 ,  2035880722039180245 ,  1443894597382002547 ,  1162132931604889203 ,  802397648910329897 ,  841653095553938882 ,  2107794186236235577 ,  1536042787773997274 ,  1648477892697989475 ,  2227212228012779235 ,  167413578883293137 ,  317347950422916155 ,  581849235594983291 ,  1336635006769379681 ,  469714794594881801 ,  1057026284574309480 ,  828728856055865278 ,  1329122466958855452 ,  156668764518701409 ,  1882951745409275015 ,  79720013297273395 ,  1190516754895340780 ,  153417941401003679 ,  204307840982047717 ,  2089835979300313843 ,  1566424914237934103 ,  856045327303725312 ,  833546178341909788 ,  1167716685536359417 ,  1697334836369575180 ,  2290067326235721559 ,  153205622504485536 ,  1326127064547758580 ,  1728631625491728320 ,  429451021518713126 ,  1453509632482413631 ,  1563051403296621366 ,  1988893297259659403 ,  1716547992644787552 ,  1762890849891998322 ,  1740230332917614409 ,  1347884122699651 ,  1364757984754286665 ,  2233322274571197924 ,  113110414412024426 ,  696593655312584270 ,  1106533023434137143 ,  1162661550893150021 ,  1226156739916668090 ,  247867296402171985 ,  1281731166275245419 ,  1042350586927832223 ,  1892699965586051044 }, // x^2^609
+
+{ 2244971758895803314 ,  2269442510717506652 ,  1833683453554402404 ,  1644759818911769371 ,  1842814403303223500 ,  442918863998670111 ,  1953546000383134671 ,  244760486797138613 ,  1448618752969819749 ,  1224525880184820100 ,  1170510156276012947 ,  886230935799301695 ,  34388067351460670 ,  1434046121428339979 ,  602670373981473586 ,  1049012239760437 ,  1850074236859725941 ,  704754046602363153 ,  1523651998490092230 ,  1540026570562937203 ,  1090980032936087739 ,  104848056533396138 ,  1446675656271656118 ,  439868281415466685 ,  243786372070781119 ,  1800191843096925064 ,  13329523547227409 ,  1951340122770618807 ,  667392617866369156 ,  1133566953005626758 ,  483620546835476569 ,  1335788656002839490 ,  188727677240638578 ,  731376009865109072 ,  1866312748244005621 ,  1960167788677168950 ,  1621908265213417393 ,  303172067688214088 ,  509549224337955917 ,  901587883994824402 ,  1544513021659806465 ,  1947874790671591770 ,  561826156002485626 ,  295052142342493187 ,  1873300442442611801 ,  813319405695303143 ,  370973499103150760 ,  1156222683547650404 ,  2205754719037090357 ,  1277240562996501427 ,  1004367954163501256 ,  1053315664566660008 ,  1974301923193852696 ,  1047907207380209877 ,  1515217020289323064 ,  149609523853132626 ,  191486321383204791 ,  284140566010934099 ,  1414491996537374278 ,  1763442615692185746 ,  735757797367184778 ,  1123364527701369218 ,  237742295583131669 ,  1114161331272102678 ,  1062844259771526470 ,  695876308178412021 ,  80218227311391792 ,  93521880716502549 ,  824139516688747886 ,  1588799062698765192 ,  996368214053633856 ,  1994080692886033480 ,  646570631801379422 ,  1493084602089166073 ,  1396393456711206470 ,  1798860366834473952 ,  828759463233289123 ,  1215222621036821067 ,  749664847656059385 ,  1273714287794018793 ,  761363643353081436 ,  2305188569523483207 ,  8995283625723319 ,  229446304499216449 ,  584311665394036775 ,  1149339698238399084 ,  811637735733251469 ,  1345685092180466612 ,  542120993331825895 ,  1967260270592535069 ,  246067110534318390 ,  2196250308591266920 ,  2257116675375323326 ,  865617604076605068 ,  445748840831088000 ,  1808104267999222803 }, // x^2^610
+
+{ 2034941901161112216 ,  1407962175023312125 ,  1657383837063994953 ,  1584262617947152954 ,  1018048757355589056 ,  1135894073478782003 ,  1003044927516248886 ,  74809060824507710 ,  2028768201780710389 ,  996486364694033474 ,  2280376753795596802 ,  468423789902594327 ,  1905963506067579541 ,  586591833402932289 ,  612275197234141556 ,  48450835839567949 ,  1783876451021959055 ,  1793596833501338542 ,  2219782713830202148 ,  856596109568786244 ,  1656896274132704905 ,  989114940675157844 ,  772375078517897294 ,  369383744942517045 ,  430403560383144634 ,  2020542663644334027 ,  2060823441774303537 ,  551397603105443758 ,  1000369477687989066 ,  1965093423310443333 ,  508392135354338023 ,  1314352737425874632 ,  2009521896130064942 ,  1536350439936076464 ,  2188122117123350434 ,  1290734227174275846 ,  1079895480923525904 ,  1316371395253387515 ,  300365038210059762 ,  1066300018104640990 ,  323904654872288833 ,  565794271430432513 ,  1473364428428349903 ,  2225582269752289191 ,  1613248546704573320 ,  1875783548933030806 ,  1208035778999338510 ,  47996794128587791 ,  1002024548826076761 ,  323890549928910227 ,  1931185775820439872 ,  2164269954693587703 ,  1820444643542735577 ,  1924701579025066430 ,  1406372483522969355 ,  1480699332211554825 ,  1395131807657860934 ,  966937340001521409 ,  1147144965334038119 ,  1353070435933650554 ,  229489327841556586 ,  720251665928356436 ,  2287865174908895989 ,  560150253139157076 ,  535007733845443202 ,  183655681974278186 ,  1517041220001344499 ,  440580644481798122 ,  1172514716659256696 ,  372705340459465050 ,  2229388030988817122 ,  1043156478376398831 ,  1913156758361860133 ,  937577497350932302 ,  2107891597335742809 ,  2002536284401787405 ,  1648104021785454361 ,  705408436042724269 ,  832421686329235339 ,  1970642264288610571 ,  1856228951494439678 ,  1733524820454955820 ,  925933265720745309 ,  1465086043647789106 ,  10345150911302569 ,  443113653161458526 ,  1288491623745776040 ,  2292587993699005749 ,  1559972023016060668 ,  498383760549351381 ,  832078169886167988 ,  438540296546103637 ,  214725027619044832 ,  1994738908757118304 ,  1221972461566442428 ,  914878660247645500 }, // x^2^611
+
+{ 70190313210466609 ,  1563212962317488236 ,  2115662882615799853 ,  276751862607950294 ,  506347852878276249 ,  1802393686899495410 ,  801107279202453115 ,  1263864232592795241 ,  260339320037180398 ,  1515911234974454736 ,  1899726051648507855 ,  1813954711490042128 ,  642106353824380726 ,  48681100393036240 ,  526168074537260902 ,  533813390142999425 ,  136719624903920358 ,  1268090476469667562 ,  1915062414926563736 ,  664076198279781036 ,  1955483010199964027 ,  584150381538435758 ,  189574687000333859 ,  2129800015697742032 ,  1425804947437332769 ,  11612564864931605 ,  113243668064700111 ,  688363284115700395 ,  2037334807397681092 ,  260844382756389970 ,  619740540127532597 ,  856553689025968174 ,  1622209864367842342 ,  1814298041508038794 ,  2168870127563266441 ,  1587116375410195991 ,  418084750849406204 ,  499505445629360510 ,  859647404581913052 ,  230623095338918694 ,  1048044247783509241 ,  1555996189552659954 ,  536537946766969119 ,  1274883660811141620 ,  223824565425887415 ,  1852885383034463987 ,  202643370093701238 ,  900899171255279330 ,  1578513910184441808 ,  2249622954320383633 ,  439796717079696484 ,  606856554156073940 ,  1213663575314946505 ,  2179170431575507897 ,  1953962329695002262 ,  1686502754529798899 ,  1326419635484731899 ,  1575192613686909848 ,  1082011250715774349 ,  507456258490129626 ,  2189817020296846248 ,  1614324362553839722 ,  1818372809358883789 ,  2035254674674119444 ,  1546643575010442342 ,  1819902501094764566 ,  1172591671814246648 ,  1925672295004769362 ,  841753535276280267 ,  762690090879614031 ,  335464851818809424 ,  558549223298296356 ,  404655988171716859 ,  2253625901873138707 ,  1816957222652210578 ,  597291548465532675 ,  1170103423378722737 ,  634536689043738058 ,  79269346637174416 ,  2282559586025684585 ,  1689395773035583176 ,  2103504700984276901 ,  1725114835725635378 ,  1455969655456319445 ,  381715610164613439 ,  43262451883673817 ,  1143971866824720159 ,  1118485906473814872 ,  606961707318039712 ,  2031009340128508521 ,  1885036337942592347 ,  2218209936298840926 ,  1994645607607726456 ,  227245374727875531 ,  2015971219587256831 ,  1685746496469842442 }, // x^2^612
+
+{ 1856143929834309180 ,  264232703477811599 ,  896235935481375387 ,  344302020429814582 ,  2040536718463726020 ,  465574072547006193 ,  2099338068975015987 ,  434439251219093920 ,  833488332551260201 ,  1623803001716970959 ,  2153374393271707247 ,  1130810687025441448 ,  1087000575987821753 ,  250037389488807124 ,  15049076419816682 ,  1328573184694818932 ,  2110626987255167031 ,  766370256613860340 ,  2136968037777297484 ,  342459674552390539 ,  1554799821925430759 ,  2182849601103047281 ,  2211728393430092664 ,  1656404546921127893 ,  144709737662636212 ,  638632358649516340 ,  769274355220238292 ,  2043921570352033945 ,  1519667283075387440 ,  1023424753727809918 ,  914371700306390715 ,  101952310609605794 ,  1886117451573505566 ,  1144337596870843488 ,  1442811663395054929 ,  1802346939809185146 ,  1624275039864249203 ,  570986684708632637 ,  1359601106940719322 ,  66197379644810937 ,  1639127796682344540 ,  983860097825519010 ,  1228090595320689064 ,  1669512232050376292 ,  1953420004027711193 ,  412534615768998893 ,  1189698021022603330 ,  165213455418554933 ,  406981765348140889 ,  8994867159164525 ,  246208397884581838 ,  1955004565315445163 ,  1009790185873401863 ,  758200890392342318 ,  2170666641469959244 ,  2241150705604013761 ,  1820856386462304550 ,  1647573552500728729 ,  1770340828175712976 ,  386749648282819872 ,  115180839455568978 ,  1237555991290108291 ,  2087456373879203085 ,  1429032300527913572 ,  1853914145866302329 ,  1465907174041838491 ,  1417731498127628646 ,  429464921986587025 ,  2019464316115602729 ,  1306219538215056401 ,  285165482378814837 ,  1026141962678075910 ,  830987305811840738 ,  2148476896209143562 ,  1151810022451339226 ,  1495767805627194570 ,  1228846221995790744 ,  1228540784845256024 ,  1857608978301299823 ,  2246573422632906960 ,  2236318758781498468 ,  1293294768970733873 ,  1358639069581251865 ,  1754435736740954922 ,  579097740104293015 ,  953931960988428 ,  584365580561217662 ,  1589173459360218459 ,  1624362266205366187 ,  117782670099319614 ,  1571688007312852175 ,  684578454882984425 ,  44888978407010033 ,  514997579788401597 ,  1970707114304023341 ,  848122669122979621 }, // x^2^613
+
+{ 1785045540257459675 ,  830839065052815961 ,  1632691336480900912 ,  452944347252187047 ,  721590151125411485 ,  1309656209223884454 ,  2060180575393453032 ,  692322120222745244 ,  1681941255271160056 ,  802258381040878774 ,  2254997244622739730 ,  1106565242151222446 ,  120955617734456067 ,  1150017513664526781 ,  1929810234154043566 ,  2026124310432524519 ,  1721048341616377522 ,  2290617934750372191 ,  443605473350843395 ,  278159533290876681 ,  1969906532321368848 ,  79355701085929770 ,  1060871267048626565 ,  2050579020170547904 ,  26311750201237518 ,  2202453692181770263 ,  55256323468907321 ,  1143534531984894312 ,  936156890390834563 ,  1661026695120049624 ,  1354595296123984918 ,  539414278179542878 ,  779148104064491012 ,  1255976268730865784 ,  1859837899138685923 ,  1859610320664121319 ,  799354305835832195 ,  1678617882646595848 ,  1955231198831697913 ,  2127415504147812305 ,  1991828927225584365 ,  1543051346035216074 ,  496674605933721092 ,  357958492765957663 ,  1835007142179222278 ,  1816151400881567584 ,  181833814495086146 ,  1845565338702032023 ,  488811442079680295 ,  617134292975468274 ,  973041803637393674 ,  658939504095049583 ,  657543693242619619 ,  55984172167107372 ,  1967837568378699008 ,  711840679969038248 ,  1647442249072277730 ,  1613484930299568922 ,  643069787996152339 ,  2203618635082370414 ,  294586133619877392 ,  1616111876366601029 ,  2292708040827071113 ,  1378526861010806985 ,  596138526695133819 ,  70449566548558668 ,  292704549119790422 ,  1622907939026838221 ,  286250125152780084 ,  1960433833934388068 ,  2105319468384896875 ,  1655673104421638589 ,  1500911109771825461 ,  1011467849520074238 ,  161839782999898803 ,  493062632622643989 ,  2170652999743698686 ,  2195699715222815607 ,  1591949804415671251 ,  139226743143810195 ,  51272319513763075 ,  860487436289523938 ,  306823983048834118 ,  818114698087974683 ,  2257092314061611749 ,  22640591671745636 ,  1209650977354358634 ,  2115551601012003018 ,  2002503949714115118 ,  1946122819476630715 ,  462462796434589607 ,  470183574669588787 ,  870021890338804680 ,  894886488348962278 ,  664444415348394975 ,  880124375861770892 }, // x^2^614
+
+{ 1171318674575538472 ,  1144963284503300266 ,  1159078175356459957 ,  701741843482654751 ,  1714825951139960499 ,  2037227230482764138 ,  1360793739899824688 ,  1647414227405340708 ,  1158000990923415464 ,  1500615701946586608 ,  821096601130326290 ,  802082942909190003 ,  1304366081693053183 ,  1177808726459387488 ,  1807474953103160220 ,  2173138633596386920 ,  298772084417700741 ,  1970992074221454166 ,  208313515464654512 ,  648631565728186621 ,  776629213298915398 ,  355814020269539697 ,  2181279509043905423 ,  1482899495417058338 ,  1235485294012292874 ,  1191191491521345985 ,  64657004218266019 ,  1907494958916914510 ,  173606220486766505 ,  1458687113351332211 ,  494377202074586303 ,  1080512284484892162 ,  233947771178059133 ,  1700793962008552587 ,  2294212953755008113 ,  993228174486855528 ,  2260534589249411085 ,  1007560895668154308 ,  1729544444191863203 ,  1710174385773135481 ,  495997526711075727 ,  1601873712316003260 ,  194918064842665052 ,  1364884415124743849 ,  917595739965378380 ,  83060990826310511 ,  1045174194555672494 ,  2174081491368322812 ,  2305614011925192734 ,  740631405750781570 ,  665275616109422743 ,  1943589280859074546 ,  243356645394227860 ,  673024004969226176 ,  106242309644862709 ,  1753644038884161559 ,  1139796530924482611 ,  1129192878239022359 ,  1755696068018066009 ,  214305063121964952 ,  210583217071563015 ,  1072304682552699381 ,  477795807843304960 ,  454129123700813616 ,  48234093234426689 ,  1428653648626041882 ,  830131469755324861 ,  2194256230482078402 ,  339056852748466524 ,  56152987845689041 ,  884275384712822454 ,  2038224078034834647 ,  703457111912762416 ,  1357460400169602808 ,  719651642965861802 ,  692372549611566430 ,  576448792567819386 ,  954856013627817233 ,  2067476959613904915 ,  314432264767041116 ,  1451086802444815113 ,  2302300425367983932 ,  2109762306128550097 ,  4089850921896649 ,  1504787264905786206 ,  192866539176470520 ,  266871175392941043 ,  1610484133096476352 ,  1556736866306463265 ,  891877730169859514 ,  234115470073708091 ,  1165246403429189654 ,  2165778361838044774 ,  1590854485505165244 ,  790926444626070062 ,  885956755838140945 }, // x^2^615
+
+{ 443367600959502471 ,  1487342378361836841 ,  1055465845622697657 ,  937621193481748299 ,  1273228097694775489 ,  1945062748735552525 ,  2254894552992404705 ,  1683882962839613724 ,  2029204275868179366 ,  947746766601191053 ,  1405989872102803447 ,  2226721282825098762 ,  1023561894817755354 ,  914953343897035976 ,  2065763036535791815 ,  1354311357913819607 ,  1986461400333631243 ,  1385079410016726968 ,  802604390545276844 ,  1607105957572105731 ,  1943414608890952868 ,  1228039741529538278 ,  1091691709476888348 ,  844559277776946496 ,  455873647737364556 ,  56018292205513977 ,  374569024420279942 ,  777187888522682516 ,  1110080528763610909 ,  1893302023037377693 ,  1840182444443467015 ,  1632265456623598158 ,  1653858620124017111 ,  2235110201613631184 ,  1221276016424021765 ,  2294328168681912812 ,  1004188700732721037 ,  349964496785942402 ,  2250170453835557133 ,  1078025029871913218 ,  1864273434238904273 ,  1079788344973881676 ,  194110348448324726 ,  2194502169846287667 ,  1469321393203669409 ,  845809183156732966 ,  817554932294929615 ,  228681784598611253 ,  1912937651390941018 ,  1557377260638561673 ,  639936834122446761 ,  2164511656443342290 ,  763078359826061607 ,  1519208193819879971 ,  984860812132309680 ,  2015635797728754396 ,  63267778669658340 ,  411731737927368626 ,  1329950831243483076 ,  1032130550299016411 ,  1238060350656047500 ,  153496862420265234 ,  1482810283880869937 ,  738249032707138865 ,  1296076843138332608 ,  769708673226018830 ,  1513413548379738444 ,  783881721975147226 ,  1776373348064429256 ,  245408658110931805 ,  175878796691817518 ,  1129440864535458500 ,  591964201966381363 ,  1705959669163939236 ,  2248538440387455243 ,  972626851031853296 ,  1855443295162826412 ,  518883448431445698 ,  831921550395416178 ,  767184465584977127 ,  833313659470717417 ,  272834294222659978 ,  1815633101549018037 ,  764338007661288178 ,  1088918988541328127 ,  1722583640618061642 ,  1720389908626020483 ,  1819160348866269961 ,  1583717150679299367 ,  125263920226543501 ,  1089931646580418370 ,  921234343366676250 ,  1989769143568527294 ,  1758114204303834581 ,  440297970820213746 ,  550142063875511316 }, // x^2^616
+
+{ 1342975103710870617 ,  1336357507723999080 ,  392762187751950274 ,  109444912747405734 ,  1636586636112452552 ,  1437757081835197919 ,  1754423481122574370 ,  1111230953778360999 ,  1635460745503918017 ,  689280751897201609 ,  778079085797444721 ,  691002497615426934 ,  1770626581674516895 ,  1654170449733174537 ,  857071096406480050 ,  1396881652450152830 ,  762268569014678852 ,  1302266731206989330 ,  1927415468314433182 ,  1716180271578156973 ,  266444695319037157 ,  1999834845676868550 ,  975013473423392719 ,  181366764180364213 ,  1784655638161284726 ,  2300161421319525413 ,  1224796461916451919 ,  1396847146744641784 ,  1286101979310876425 ,  1409432116372585266 ,  288617769790502831 ,  1998120242011377479 ,  863492204627609786 ,  313029728654939418 ,  744096913024144146 ,  2295835532506181624 ,  1738156594200308344 ,  1271632319276451917 ,  1488517807260124975 ,  1420129379047707175 ,  842420074643590239 ,  1022647180180067243 ,  731160366327843771 ,  1448203066733536532 ,  1963959820684673137 ,  527121244867415295 ,  1153028127780278763 ,  90694795481132244 ,  1096871909132817287 ,  1488506932881972727 ,  1898461327445741983 ,  1941428180169065357 ,  1209034244571738738 ,  1410972213680722388 ,  1736901262186758895 ,  1646616646226302866 ,  1982025224918433726 ,  744490358689624416 ,  2110702715347220276 ,  883477896331818312 ,  2039294371633969223 ,  219925504554191074 ,  217969149409517625 ,  122196049538292385 ,  48016996083301641 ,  284962157277553931 ,  973991103858254972 ,  934633139233032733 ,  2149858547109434321 ,  2210367493816770510 ,  1580070294215712896 ,  608209612224787828 ,  262886854073799491 ,  2034680206392155391 ,  716047864234281217 ,  885967149075710498 ,  359802436814111932 ,  2064165456604158445 ,  274120340940412229 ,  1584001491499336049 ,  459777091275847076 ,  359935242842312247 ,  838340302488676757 ,  2276780442771628759 ,  1728279795440558360 ,  1080477076639747898 ,  2084820847874696739 ,  1223212794664518716 ,  653588515255156729 ,  932171390936815158 ,  164661099873426848 ,  947741305374392553 ,  2177813212526447751 ,  200297966418817254 ,  193100056610167850 ,  2087460427023022699 }, // x^2^617
+
+{ 1381981683408797897 ,  933781061919952936 ,  1010309269874046185 ,  2214547908363502026 ,  2276474306704055972 ,  729499420116582108 ,  229850047055590762 ,  146560432298374166 ,  1682730612212087841 ,  101537455110315993 ,  259984534573114878 ,  588363814298981057 ,  911869566181053019 ,  878867555236578143 ,  1018780902400599991 ,  1437263629516302126 ,  1446309041664758319 ,  1209817174656800085 ,  1697409642605384930 ,  2048878884286375452 ,  2028532391151957698 ,  125674814719136052 ,  447266931553196432 ,  167239746497789497 ,  312183575284593531 ,  1139685855317401491 ,  241784847697570318 ,  2104446515886901862 ,  495557760139088129 ,  663714168969112882 ,  1649892344855042416 ,  1855173825601418634 ,  1731469158549438967 ,  1483091554405548638 ,  2169129458447586764 ,  811879787541520149 ,  47467836850356132 ,  524669777694555064 ,  90609607449711349 ,  1023849988239885185 ,  2116599410031569244 ,  278612043310059535 ,  1747295862055793509 ,  1045439371644054127 ,  2141626043697499680 ,  885368430207737364 ,  1789329948105601534 ,  782811373237010842 ,  235924299105275949 ,  1890945686170183200 ,  251107177468257490 ,  1970188494666491903 ,  947578391346344697 ,  913376788005723731 ,  2047710715115240558 ,  958892823323789512 ,  704157828066096725 ,  1766134086122460980 ,  2304498921877558999 ,  1572482437643013737 ,  1178330292474917065 ,  1245038049052199628 ,  1127581987566641453 ,  1258117952584091770 ,  804116602856475374 ,  304476018104868560 ,  340198974486129325 ,  692214037354160558 ,  341244043479124419 ,  1986717352490364256 ,  615297378924534722 ,  1481079482665410603 ,  1145714789812192184 ,  2190488206335537779 ,  1996404178762342317 ,  932418399027092026 ,  2015638316891720153 ,  617233285677875729 ,  1641425343731149943 ,  1298686567057438415 ,  1313280518672350750 ,  1837852076159312302 ,  1021282358164873170 ,  1207666374820333722 ,  24492833716609450 ,  1530513300193185447 ,  1818386644669632282 ,  2031228081828851227 ,  1063137642930661218 ,  1840967676665505351 ,  1651376392614994756 ,  1417463864988238177 ,  1026738397492714344 ,  1262240646055110595 ,  590219581907098332 ,  1380944787564533327 }, // x^2^618
+
+{ 1022976175227454607 ,  1600349060451802769 ,  1264287272416382811 ,  1249898539671498179 ,  1375556555416936377 ,  483125269049798907 ,  796800747257097719 ,  1078307446691459551 ,  172015261445660621 ,  1664058737913034945 ,  1599715618838776752 ,  2142691306745500224 ,  1559248676333167834 ,  1498771904378239239 ,  517424219994295134 ,  1412159533964872595 ,  1105406285466212502 ,  1573144425996349556 ,  454238815381404723 ,  1749441667231938638 ,  931538285367348095 ,  383723545951730395 ,  1353321923742500160 ,  1422701196033247198 ,  857807475953670074 ,  221103160012754326 ,  2243605556840797699 ,  1452104821914615826 ,  875840525980085455 ,  1597985210886066097 ,  858283071652025519 ,  1290910069157297627 ,  704467608389781403 ,  349332214028262463 ,  1793640818852205185 ,  1840425950244543051 ,  451228876095759064 ,  605874012050567428 ,  510410092769260223 ,  2278345532373682918 ,  756400064438203073 ,  1168854664467680954 ,  1663109767159172931 ,  759978776979941373 ,  60778424423175425 ,  1688642859367857471 ,  2022201967879126925 ,  1581531337925295140 ,  1021697851918274033 ,  454561949187168220 ,  2063909697429403028 ,  322884286630000726 ,  320087351855064780 ,  809975502145780843 ,  307846553290274572 ,  594604265165116371 ,  1005837419437939817 ,  1983073324041537389 ,  896930454448884057 ,  67068766764769338 ,  1844991847263494598 ,  2027925087963402454 ,  132096320558329220 ,  945202142766148069 ,  1454692490878623099 ,  1485605361432011115 ,  2114507130148066168 ,  377456003380485054 ,  62242695621556791 ,  109857737532732686 ,  1021182559662167469 ,  1091864299654259504 ,  1078897886824342878 ,  1725028715498471892 ,  560579517712288609 ,  504575829468847908 ,  1710369512538399649 ,  2016282201279406635 ,  2122868590260261470 ,  778317997194370419 ,  1179548830355225344 ,  112503851123396279 ,  178864764044988235 ,  9473708463688937 ,  1481347660817004584 ,  624114171896553737 ,  52568690285250421 ,  1859810036463396472 ,  1502607380197209539 ,  5470382358920992 ,  66966497137918212 ,  829084764143829375 ,  1352622764069960061 ,  131219500579917012 ,  993626517070660972 ,  221952343883660745 }, // x^2^619
+
+{ 1679142401922947227 ,  188688093581992885 ,  328390695308660015 ,  1355404339546206696 ,  1000956613668920320 ,  2289395818416605127 ,  1256514973602428591 ,  2188183442416203453 ,  2231903766228291694 ,  960434172437104416 ,  1264297644931888610 ,  2233729826631429857 ,  1464104949518467030 ,  599104306782896940 ,  1441544179599189813 ,  7721889310336708 ,  1139247502658797281 ,  1600545703528271846 ,  2054850538467264679 ,  202985644493523750 ,  1312398296272586443 ,  1257932291571026033 ,  601428903712633207 ,  1250224574696935066 ,  1311623642139099326 ,  472762495120976461 ,  1179127890610213754 ,  448712324870211485 ,  150702803624948205 ,  1984849593042450470 ,  453009994307580658 ,  751750902087830892 ,  1384813604063182207 ,  925404010299627729 ,  1734374028838762628 ,  304713455685178208 ,  1018346744279635269 ,  1729446910309939448 ,  2145849825896211662 ,  1870690078982964300 ,  1000967159009188961 ,  295617633950935240 ,  782304553958995824 ,  1873774309689522261 ,  2073261592465634096 ,  658425683847952271 ,  1588581811712496318 ,  1116608244319760909 ,  383300206068396718 ,  587094017473725595 ,  1081039627582984928 ,  511182236751896629 ,  2007228421282395594 ,  668208987405390599 ,  2190428910173699628 ,  1836172156732176631 ,  1895723636395065549 ,  118154691447089069 ,  2029093457306824081 ,  558236565468080883 ,  1971016946345652690 ,  1667098403847477639 ,  613536292679480461 ,  1277560432651150025 ,  1768011549722447538 ,  1035338283439256378 ,  1527102483907205891 ,  1088331741614796380 ,  86335044018446288 ,  53426273611510986 ,  576896804246494832 ,  2166143062234346626 ,  1335039967871212218 ,  801504094492972736 ,  1040102927723506579 ,  332403215684538902 ,  1295276758391638342 ,  1097926052223902361 ,  1951935892617605058 ,  871772627560454249 ,  1974749610086968330 ,  725454027698535848 ,  1867725928164273943 ,  332803191574269414 ,  697265974168793242 ,  284067810117151477 ,  1599081516343998308 ,  960757434569259602 ,  2163509367945795967 ,  1961069888599806216 ,  2158209541673004595 ,  1119900859257856242 ,  806350429193906263 ,  1520716203726817933 ,  1797995467146619725 ,  888908766660547175 }, // x^2^620
+
+{ 2175287905951297478 ,  2121797468042849248 ,  427282829306271820 ,  500140891716536115 ,  75374712118881036 ,  1542884041757313145 ,  2128985111424751025 ,  1669907661204377936 ,  1277903782707733076 ,  1348315060319522862 ,  66286566347290092 ,  210930815525648918 ,  431449123315574328 ,  886226229793187215 ,  642558119972251202 ,  464205381200087897 ,  1330217828514528108 ,  1389250647360991141 ,  654437389486197739 ,  1487692924910616473 ,  855413139910309371 ,  900002438329846649 ,  541030051833187651 ,  1309973033230833551 ,  1153325153152159064 ,  1195054064979818225 ,  168261421946382045 ,  860854468296882606 ,  1639510377687835913 ,  28585226643866184 ,  268987844377762556 ,  761718174824045833 ,  621851916969121883 ,  155203645712533947 ,  2142445852641361158 ,  1282015124643435073 ,  199745406188743651 ,  1702105351037369635 ,  1553717893377829830 ,  1276956492221846992 ,  580091933836177835 ,  1586576729872860865 ,  361398712170755681 ,  2160239751876188640 ,  1075989848095342533 ,  9602933496659480 ,  490534422733482827 ,  550763381844359608 ,  520513645110857379 ,  895245589099872152 ,  1480664922372246197 ,  334539902431868564 ,  1248240001030647064 ,  328616805382072401 ,  1455296328046142797 ,  1944562135720341647 ,  1128240700540076756 ,  1165419549342436912 ,  2297760210444734813 ,  892953458694448214 ,  859303820392922903 ,  1381180582341819833 ,  2086651610026618062 ,  26678051406189290 ,  2242424163763356880 ,  1375105235917294931 ,  2056782600991714881 ,  2256619751831368305 ,  2107331600586475159 ,  1126858961243949722 ,  915256424920683316 ,  1672317765934119296 ,  955412436655593614 ,  1990901183046099714 ,  1013407569678683708 ,  642602044858363641 ,  1775379048995756312 ,  462097126432825789 ,  988309597266952645 ,  1274336039077157116 ,  893013500337332309 ,  912887165486863456 ,  683970375202715735 ,  2188391020779430086 ,  15062145714816150 ,  1767585616142910650 ,  2029310945407811553 ,  259112721517906594 ,  2130487692116946431 ,  1734163309058164348 ,  407743621883965165 ,  118987390943239199 ,  2137703367659279864 ,  1760698241989278920 ,  731904285698461647 ,  807522553901236221 }, // x^2^621
+
+{ 1633451854505365269 ,  917159180314029467 ,  1983345616227478687 ,  202842769310006952 ,  1728474266891651598 ,  255259949648368413 ,  359446299013560574 ,  1355346480476554090 ,  1265737919154551473 ,  341940755748390556 ,  2013927671013996926 ,  936406659112308752 ,  1764349577907942414 ,  186993228517215032 ,  1218224603988007255 ,  1793530800858886670 ,  1101982048224989770 ,  2073490933972469492 ,  620596116526198419 ,  1318798525513051400 ,  1271923731348139112 ,  612348695925898695 ,  656646092412014511 ,  1752521394980886753 ,  1146600561365563381 ,  1767674485483651987 ,  1566787426247568871 ,  698172595278837077 ,  1745512585608724743 ,  1764783418009409898 ,  2224451538963316389 ,  524715074692666301 ,  245188269552900386 ,  1797219347306334893 ,  2009740205233767920 ,  1014440883741158738 ,  129167538897927838 ,  330732708570085184 ,  2250545945966316946 ,  1938004999103031465 ,  963277107548151421 ,  1141104883498944768 ,  1371597687119419658 ,  2284136141362146467 ,  403593046049245114 ,  1914222417973463771 ,  166419044024972101 ,  1232633364222083928 ,  2007142083374243532 ,  2218461235748531042 ,  639407563372839922 ,  1921689814529396994 ,  1332612682753142427 ,  355959358252811627 ,  1478653915927008658 ,  1361719364082749990 ,  240783567094967581 ,  176993149042587930 ,  282294353133775718 ,  2272983812305458565 ,  1303585939610597754 ,  1115039152626194382 ,  2303853440952716149 ,  470875587936363878 ,  280139817653536689 ,  1490159024439086442 ,  971050510860890383 ,  1240380322816104165 ,  1491612286232225698 ,  2200412981412245908 ,  1898242634948144030 ,  19106200383071127 ,  749808719324769056 ,  1138736415036082314 ,  412527659056533959 ,  1757055425258838359 ,  1469223225224973701 ,  886581807041689259 ,  2246634663072149973 ,  582341562362892535 ,  2142868069024657880 ,  980479028021507688 ,  821736902742163830 ,  2235686617562633347 ,  1626189139272015421 ,  469234550326443816 ,  585289756489396086 ,  1721188963069434406 ,  1115551488742497852 ,  1339403614666742743 ,  213879560772699166 ,  1617562515534085348 ,  2022634529895715696 ,  1421184437939334437 ,  1661009236764128522 ,  1008009283860776020 }, // x^2^622
+
+{ 1042036977245586138 ,  114926074874414664 ,  258633807275846138 ,  859333160038633408 ,  743570617330390121 ,  299964018564993128 ,  1116954623206732747 ,  636635048179037970 ,  1272297229726686640 ,  1056454388173453311 ,  1506743229693885210 ,  375557940264539641 ,  280274276310601150 ,  2144265607000500060 ,  232192460533823460 ,  1540394167955545144 ,  1977567743157028377 ,  1345048780584977332 ,  468301420264330028 ,  1881980272481218062 ,  2002662495063087510 ,  578909270404544886 ,  33485877455799763 ,  1626935863677910879 ,  361500364687184213 ,  2034566775132873884 ,  183218217146785467 ,  1628490032917199311 ,  1510876887888593729 ,  1172116795895863885 ,  1482536980174540707 ,  1598140911130448229 ,  1533940585668171521 ,  185132690942515691 ,  1814640024647552113 ,  693023275080564356 ,  1361965470870108737 ,  1107182289182199093 ,  866676578929697510 ,  11015714846217592 ,  1290336939596348049 ,  363303949550140780 ,  204491249546990692 ,  2188142721189639879 ,  115024386080718397 ,  1241564179647863671 ,  73138060793652907 ,  1731183915442622789 ,  912398855178370354 ,  1230405211003019188 ,  321524584707297248 ,  869484590624849327 ,  51237628509955917 ,  1537340666159512734 ,  402035137583257929 ,  2108434105579414620 ,  1324623739438956782 ,  292838567545435293 ,  537349270246836813 ,  75219204811723626 ,  207201657365132776 ,  1072598850510999923 ,  1481216172628104643 ,  1596892596181603794 ,  914439747179127918 ,  407518020279719676 ,  1597407514535513057 ,  456796330968293331 ,  1954949981917558343 ,  132821842277875564 ,  1759209180134090680 ,  1341880185310452358 ,  120374237608597288 ,  611271312098553498 ,  447576704633434975 ,  1592107364456973301 ,  249167665322483543 ,  2183138301905676764 ,  676640763993944340 ,  924777576013941243 ,  12495733266535987 ,  1829172372498604278 ,  200930881307784550 ,  1694282989709308923 ,  733937487952534584 ,  1865291578639386210 ,  1922884293644985957 ,  2296806698778909593 ,  512802905966061886 ,  1354300579305684428 ,  1709962130420154989 ,  447904076943593924 ,  1731966628973970310 ,  523308116390468665 ,  1530101583505770110 ,  128721208782876600 }, // x^2^623
+
+{ 2206371824750089786 ,  1039998943003415254 ,  2176815650605943216 ,  1390634349578402106 ,  1447754039463081830 ,  548255807617765576 ,  367123944964981538 ,  440737706731661200 ,  627692377994520366 ,  1241066812952448611 ,  1871110260962672866 ,  1216185960009033663 ,  1622041902270477568 ,  465558195073888610 ,  945449199178588598 ,  256693451549812138 ,  1053519838615594516 ,  700268998142866369 ,  1069990778938940562 ,  65100548317016654 ,  1931415608516990746 ,  1250407787988933020 ,  978840742050484518 ,  1228256347972786226 ,  964702154208115475 ,  175927613119212851 ,  776273127913475199 ,  985251114869212610 ,  471692779641811605 ,  97783072968562956 ,  1738150463643796491 ,  1568361841705797063 ,  1392217111107526882 ,  1178405428181793354 ,  345548152998666371 ,  2130745746562131901 ,  1819614981552890285 ,  360991821612016303 ,  186608044389959874 ,  2143328316634903183 ,  268514046314465030 ,  1975105619674726315 ,  1674366897896096656 ,  571179572283824313 ,  2295930209365987916 ,  1832244935081769451 ,  2230777645535246971 ,  503816312191145775 ,  1116469258356890267 ,  1058687453759771711 ,  3338640051220631 ,  604615325000795202 ,  1470904253051571151 ,  2108401661258959079 ,  1139760376236988264 ,  1873478570833938423 ,  1179264599128805778 ,  765626293622863509 ,  957510328448992687 ,  1818866977667285222 ,  137623921575609044 ,  898926040028382209 ,  1897928736433142272 ,  1892583160524104281 ,  926481509546985111 ,  1250808085948643249 ,  2161148283360091352 ,  184485557056561900 ,  1699999502027261401 ,  873316218537208222 ,  1050724930239148090 ,  86886583603229235 ,  118215448247893654 ,  1487867490222660915 ,  522395403510177176 ,  1251110580812256411 ,  463023017863229949 ,  25457670458587419 ,  479428786739792551 ,  1694671141755183848 ,  1721386314265231888 ,  7985835505779589 ,  848794099368064060 ,  1291684028896534161 ,  584736834359906242 ,  2192390755407394589 ,  2045810018100597982 ,  214599084111974849 ,  2111098798829674009 ,  80666580789991782 ,  1390922504479153436 ,  792702422196657627 ,  1853392064674437911 ,  35606212516321922 ,  526730552448115505 ,  744846247347009373 }, // x^2^624
+
+{ 1395806813248526901 ,  1813614164116836722 ,  566182474049996970 ,  2246859558013904429 ,  1605403372871384357 ,  2088454148355347034 ,  1709071395689507139 ,  1583342900799934969 ,  1560412412380897469 ,  630703833736684039 ,  289328534060970626 ,  1301474314514242173 ,  277103204471803250 ,  1590543691352817619 ,  910489598819239362 ,  1072688951272858965 ,  1080117613203671527 ,  1986179515089021856 ,  309525515413992994 ,  384822348095307929 ,  1967134119311395292 ,  1102008054322273754 ,  613557968812638521 ,  1015517862288252343 ,  157246900678723317 ,  2293056991191953933 ,  2057151508430830445 ,  1142912086646788870 ,  1422698876245379716 ,  1622378608842512459 ,  1886308576098122220 ,  474522982032045705 ,  1056781870923428692 ,  1792286732928910543 ,  1224345665445729708 ,  648572620765689535 ,  1617319955717828415 ,  491482813622416420 ,  1221919694361899166 ,  989924149909266853 ,  1886810541637242839 ,  1554784675392143171 ,  1439218638241344265 ,  1659017923024551288 ,  2064839432262090573 ,  56756450908206000 ,  1897172331172808476 ,  1567411913637456032 ,  449389638681519329 ,  995695018197632143 ,  858726359852792817 ,  2147036783229773287 ,  38939805864889550 ,  2148697912392177659 ,  1903077352410199538 ,  130267268060393411 ,  130801669400307163 ,  1876504092817017679 ,  1422403313327131381 ,  1728119158735186454 ,  3389103993043603 ,  1443820121940612009 ,  1364917581290712473 ,  23665470349223567 ,  1777004591439835426 ,  18999960087097879 ,  880069627767684314 ,  590115534197337679 ,  992833858869191812 ,  799301376432922970 ,  68214504679639700 ,  1300336754883542640 ,  1521691240868418199 ,  1178448461648534048 ,  883069537363061313 ,  2299812688863406069 ,  1229333192394883426 ,  2210674926936487845 ,  1618775090145915998 ,  764771318743959135 ,  970398663023167686 ,  1151354517135072311 ,  2194161693951875119 ,  1055413002923950728 ,  1123064169906931084 ,  621895571825039902 ,  2035761606791476006 ,  2007131433919569 ,  111611777194797281 ,  838746189496106348 ,  523335634409943054 ,  2234626755859922361 ,  515767685652127094 ,  1414252701528884864 ,  1598876869600887921 ,  1682454276091022212 }, // x^2^625
+
+{ 1752498140296859347 ,  1123870027663145481 ,  1237587078288655597 ,  1968419115714062421 ,  14230969255816487 ,  2098900779668227712 ,  1143599773198197300 ,  1507312698547966642 ,  1481973054469757890 ,  322898870306143862 ,  1204586106208132062 ,  1806562400099352914 ,  2221925530056077241 ,  631981700640198802 ,  1878411962595715562 ,  1441080422266224776 ,  1097019626282370192 ,  1103039769806989666 ,  1588060065249211809 ,  1209630072655196776 ,  1849776242411451804 ,  950389097744898395 ,  1710055163381746640 ,  838365879878989269 ,  2122712623093752233 ,  492781672445596445 ,  1323197896564208387 ,  1842094782120453775 ,  1075923694551034929 ,  1936602104134693136 ,  154996569976062513 ,  465528219805248898 ,  553125111465486601 ,  154567250408339212 ,  2300189219492792637 ,  1571539009619855971 ,  1539039485665927044 ,  1199292384971379461 ,  370538550293426259 ,  1216545058662776715 ,  1963488163594497148 ,  2237227917901127362 ,  140233322036510055 ,  232649606809576520 ,  1191373325825299825 ,  1597336105197495027 ,  1932057307253269232 ,  1764341806001491711 ,  1950163024924930351 ,  1389232274441059336 ,  1012763332491385016 ,  927125787370445963 ,  1700132775346123349 ,  1853841417547399151 ,  1591571616956057273 ,  387966813391950428 ,  1291357096641181824 ,  1646366213457236957 ,  342465215328555229 ,  802795134144848263 ,  1887852598921195682 ,  150980556820537322 ,  1679020730382527187 ,  1201842506769565076 ,  1897351270934007322 ,  2159717255450106408 ,  897695269065751562 ,  1331644043017294376 ,  1506128726857511466 ,  402618026454537794 ,  1622113271839002174 ,  1742804679231513646 ,  1020042324433157000 ,  719048949261215018 ,  1833900680265354414 ,  930957178967431442 ,  290254482921145586 ,  1164184858879680155 ,  1898094182479523521 ,  1455110528475165600 ,  505847646238158289 ,  1457301127705441771 ,  947405805154304109 ,  1536098778152716349 ,  1221772249853001380 ,  1919873251180709369 ,  1879798318858899774 ,  1285397400407006141 ,  2148669001875080749 ,  547422672316403859 ,  324176348126237924 ,  1437290191669952170 ,  1069508278762983404 ,  1882677639161769458 ,  432214948598315574 ,  1673712223659947636 }, // x^2^626
+
+{ 26402794845532520 ,  18240065092395636 ,  480702367436723496 ,  1896521161473120263 ,  523216264002500769 ,  1480005117954075762 ,  1670913927373262393 ,  424905718950381289 ,  842789258698793096 ,  2012435644849536432 ,  1387882896951889337 ,  2167575914388239256 ,  1887917104640007187 ,  395533879092261681 ,  1437829373243526117 ,  1349599450450998869 ,  2175357854937344156 ,  127597237181503783 ,  157312246831002614 ,  588333919130391487 ,  972475386751091730 ,  1179028261442921621 ,  1915547824769475940 ,  1042260581720213125 ,  156716209420606983 ,  1099356497540910678 ,  106754565777635313 ,  1827942561583411136 ,  1487606458582675916 ,  1005977953238410213 ,  1702774899673658906 ,  443095202030675505 ,  799518568980444056 ,  28668867963589769 ,  2220157378364994308 ,  1430181314237304048 ,  1792703214377245907 ,  648351024627354217 ,  228461004584418125 ,  862076513272014808 ,  139197772310559932 ,  1944592074835245718 ,  2035362098139752150 ,  1259846155547006663 ,  835945637926267887 ,  2209172736195373292 ,  29370628875912598 ,  2225354863523863450 ,  1784829036767642039 ,  175283961093629325 ,  2134592905170179692 ,  409111333674209685 ,  880096116904016727 ,  90376863027221627 ,  685505403859555798 ,  1942213031744634963 ,  1268739125309878536 ,  1238059878310019029 ,  1747961283643110848 ,  1173963943116280203 ,  2276608333062517372 ,  1355838737766366003 ,  358813624326375419 ,  315506419299623270 ,  2168339755119213203 ,  480037940447842558 ,  1154471654621354187 ,  1986621341268273195 ,  605311077137578407 ,  2121439550930045131 ,  1954435258965258068 ,  2066172872792876737 ,  680618636282285699 ,  2011205568204846302 ,  2279779804349790125 ,  58281130047436205 ,  1235556981741535579 ,  895323520095940892 ,  1818782272075985872 ,  1410468593577254732 ,  2244870842428018692 ,  1892649667203703373 ,  2059494889324899262 ,  48269402840768842 ,  1426677114792968525 ,  303757774273227860 ,  1739718002648046043 ,  319481212031361456 ,  1922498356597399992 ,  496311029084736468 ,  1124658913377695078 ,  491891949581669017 ,  2275696146768774359 ,  748239877121312290 ,  1342426008072831365 ,  1085704803983063592 }, // x^2^627
+
+{ 1597651351502185107 ,  2170153184280920150 ,  2243087498954611870 ,  334797607677835920 ,  139243328873043643 ,  1964348893752427925 ,  697557630092825006 ,  1387465286332019043 ,  902587585175596035 ,  164787174586836947 ,  135935548144242786 ,  278980337065491933 ,  903460652870603577 ,  1341548114218557755 ,  496068951970145114 ,  2043674471491866225 ,  20159136017850666 ,  62913581125157634 ,  2305781052242010753 ,  1579870365693530650 ,  1740584047943221353 ,  807778824818133940 ,  1156455151388361515 ,  1874478893825503341 ,  754863465316567777 ,  1685453505629291478 ,  32627040472577052 ,  137865062841214906 ,  1859855015163992762 ,  351017868207364163 ,  1176849978168398184 ,  711242907876944198 ,  982289225940656895 ,  444556474100866881 ,  1136569075727798686 ,  2224735564940190303 ,  507513814145450573 ,  973183192196235307 ,  1800231033709453984 ,  1244259928911844382 ,  484749787630359803 ,  4569927866971617 ,  1221538487968803940 ,  1385700840471616122 ,  365030348403450672 ,  1519760319953058255 ,  1966689903315415629 ,  1098976853624085944 ,  262382654354615498 ,  181516159662755370 ,  823923383026812751 ,  571757685358489762 ,  2136907731693097875 ,  897517707879020315 ,  1952642009551307879 ,  1079273549421683144 ,  1810715046165810730 ,  1969403487128578089 ,  1669710527951620734 ,  1490614992691579816 ,  1236777227398536669 ,  2188138303261376884 ,  2242646438150204888 ,  750110001305538683 ,  843674458139968800 ,  494904343877837880 ,  1573150480947611150 ,  977057136211004268 ,  1464507587567331662 ,  564276558045255662 ,  1791778866102300633 ,  985366250198596011 ,  665290082991887372 ,  767833861898774339 ,  1931620694365370759 ,  345647455197673015 ,  1692201592044217588 ,  776275347181621063 ,  192423797708558068 ,  1795011081552043496 ,  610482622862638271 ,  1561448563330538664 ,  676224166956382025 ,  832106893311923407 ,  1647239686561134816 ,  1519778390859129803 ,  489848873945594706 ,  1224899530403254962 ,  1576999869322254550 ,  1524856255851048224 ,  988159889141072830 ,  1417304256912421901 ,  1105289489609292463 ,  1494887771513940934 ,  504923506919219165 ,  422199596806871266 }, // x^2^628
+
+{ 1007415420168030805 ,  873009365662159445 ,  1431055162824110541 ,  793411374060743623 ,  1892682138547792180 ,  457061230794492108 ,  421178491205878280 ,  1018700531525882413 ,  2115979662677163206 ,  839312904026602635 ,  498414884123250493 ,  703869627302530264 ,  307253523464970053 ,  1820703919860630790 ,  2169070314385763554 ,  1397989560819919234 ,  1079335711117075505 ,  1591054033407220662 ,  1655335550329541010 ,  367761355311309458 ,  1069926935894737718 ,  1569080310687594330 ,  2241431937902550067 ,  842355962386998364 ,  246261990521422915 ,  2235391852989288705 ,  2206721070234984722 ,  1841709736047817774 ,  682462102705947873 ,  814929266647022571 ,  1577999179663672033 ,  169606108493340395 ,  874182153642299070 ,  1381823911472286592 ,  453856143703882973 ,  250584179533079179 ,  1379001262201077395 ,  922697836740699949 ,  1246267763977116639 ,  138135077682623363 ,  1393922675667097998 ,  119821577001177883 ,  1455483972601687814 ,  1478304362557534502 ,  2104679364220527675 ,  1338266729864996826 ,  1276733500644964252 ,  1333986741501269503 ,  383645331015303875 ,  1614881179118942041 ,  362559043068514350 ,  2085022586792174521 ,  1953042639356326690 ,  615675036021633958 ,  1553798465945288714 ,  971742277916893592 ,  2074476802142979478 ,  1754410834245618864 ,  120224410633416237 ,  1411730573488304970 ,  1017701630422836470 ,  1544536054432526958 ,  73250994088711430 ,  1595569362046575873 ,  466108002893802767 ,  573800792325321957 ,  637034222131854292 ,  1586653417159226780 ,  498254946869314580 ,  1872259167260244687 ,  2238600184026984442 ,  827042601553245121 ,  346326908675466786 ,  2008372203212544006 ,  861080216047305191 ,  988298123500205877 ,  11098933977951671 ,  644976760718078044 ,  1643727580077582576 ,  1089016450785855507 ,  1681294115154285626 ,  280590427477291282 ,  378247897207882771 ,  1675352628343388555 ,  2086135156022554902 ,  1759061095630588190 ,  694670935430934109 ,  1193805431370004779 ,  478650829882874314 ,  1183154259453075422 ,  196331246332631935 ,  2271000481642780793 ,  953502530937545680 ,  462372839581556793 ,  719042509301405389 ,  838398095322874615 }, // x^2^629
+
+{ 863553837445320854 ,  1524915290239812207 ,  1704885444895886125 ,  517575354836763177 ,  1965856784073490726 ,  1950272976302244883 ,  375490544873041018 ,  522191582527799746 ,  90963280357999011 ,  1970234466302962335 ,  903471391699104664 ,  31081391526461317 ,  464500201396956848 ,  888221950342764637 ,  1620881343836216979 ,  452197581143728084 ,  229696770936559107 ,  870242214184948276 ,  518228042326606984 ,  548157210650888061 ,  15239570145873974 ,  1044918930534265484 ,  371112554293094933 ,  22858041898096611 ,  1569923932669309135 ,  572386544583144670 ,  19323003056673998 ,  1753741538363236375 ,  2081728940850091593 ,  1300829407795749149 ,  968675125143064973 ,  425927840508253270 ,  392544769379596923 ,  1274414580282602215 ,  1452721673328045178 ,  671965349744955650 ,  1692306005403483825 ,  1500760710199972828 ,  1327994786339309563 ,  298513701785756834 ,  1545326593755589594 ,  1923735698103801803 ,  1480892288345978693 ,  944950972722240372 ,  1512176235894179158 ,  598482114096935170 ,  789741675539908737 ,  1549238607007659853 ,  1208590933395526205 ,  2247865488578591826 ,  554981999892933769 ,  1709517386863704105 ,  580998561782753311 ,  2115495702147830906 ,  569505825634887023 ,  2250577328934865666 ,  2004968333832246445 ,  2276475758406219579 ,  337625166198481909 ,  2119758887772015347 ,  2252573642885888692 ,  1191868297247725803 ,  1821500939681028545 ,  1204757748074714341 ,  1929626463812221652 ,  2074405666230351366 ,  412655177574564259 ,  264786165139624560 ,  290741236135361966 ,  422491889632677356 ,  1637989310652135792 ,  893064052810595967 ,  1694333636527664131 ,  1106271413729202905 ,  1686828888512255891 ,  2071822891207719101 ,  267774842248732673 ,  1552550560318912340 ,  1059653717068924651 ,  2268679408055684755 ,  2090809561337427684 ,  2250392674745514319 ,  340465158920467549 ,  1086289454116403450 ,  1199886172167436318 ,  863057337389061704 ,  585061396480449709 ,  1752463998803362007 ,  1108915555660340388 ,  1532271753734043429 ,  873036925154812678 ,  2259937531501743456 ,  1654137322283805231 ,  783282991982193529 ,  2291371387453579378 ,  1067347884799814815 }, // x^2^630
+
+{ 336218859572676829 ,  782267940149018944 ,  167870614346193704 ,  2256100086587732529 ,  859559242957459453 ,  825483890029732343 ,  1995683851375177716 ,  296983320605160587 ,  1105020447255667966 ,  772938883204631840 ,  1279617036148316553 ,  2091239377627410167 ,  1991041205376999138 ,  628261565012464051 ,  510283099727277064 ,  273395349208057284 ,  35397430377098819 ,  2098508948533220293 ,  2011655441472609390 ,  1402483133954534882 ,  1350765189964881627 ,  1553248087765160211 ,  947350095706441181 ,  2146890938928259570 ,  549184360484600647 ,  1914522042171289196 ,  1924296709335368717 ,  1895847537551704296 ,  1685836657286782292 ,  1507720756025085717 ,  539621472991226502 ,  2215273585496905307 ,  671046556616729601 ,  1057953014903777295 ,  1618729576857868347 ,  880792686135017096 ,  1421718370512279530 ,  1262569322833561221 ,  1649775526481720047 ,  659458178397341453 ,  68044649787696365 ,  2071595775330282543 ,  2250461180819668888 ,  77504715553377931 ,  2285981917027967432 ,  1040400698631995888 ,  148203274116562658 ,  929630739234122378 ,  190535262420264812 ,  274697713270326467 ,  1937163345102138389 ,  288202670831330659 ,  1699545551480076950 ,  1138851183956685951 ,  1060546240906107726 ,  1867395351191839078 ,  224627794305111842 ,  1834711161474646828 ,  753736950675968615 ,  795513021962246740 ,  2281871252936456166 ,  1013443172413122696 ,  303638766711090870 ,  1664624679402894334 ,  68555484279130625 ,  269072478864945555 ,  1133974132040940367 ,  669385276784835662 ,  2295809651699904399 ,  599040598862169641 ,  471291880465510229 ,  952553106255790585 ,  885757096890463961 ,  78070915157268085 ,  1086929713675670063 ,  1528609403655140058 ,  1712590403261365758 ,  1209108990943256587 ,  1216481707276556497 ,  1878462725468480149 ,  1849358570069077806 ,  1851490161525114242 ,  1834766260488699487 ,  1270848506713076902 ,  431619663727568114 ,  1570044634126720199 ,  2222188677148372311 ,  434431663676025810 ,  1874532926041873199 ,  1125849372932684439 ,  1150681585780973797 ,  2206485709443339013 ,  657769145881294820 ,  1512863116103807008 ,  2141271362110210547 ,  172466401548210303 }, // x^2^631
+
+{ 1537661493831476876 ,  478524648515514448 ,  958843988424937639 ,  1733098383117539726 ,  1474512323190294497 ,  998347805408725301 ,  139686533021102762 ,  679373619038473274 ,  252318575111467910 ,  486021596414507413 ,  803262819365391399 ,  700425640316835424 ,  333316810751103263 ,  369931072817370169 ,  44307254186596836 ,  875424394367652197 ,  235088506287493649 ,  447586274380521842 ,  1204864574337312117 ,  316881482721102337 ,  566482181312506498 ,  1201580953143195908 ,  950277018200319686 ,  662465158465786421 ,  765842537084609081 ,  590976882267412926 ,  2146972888921267267 ,  1683459997772173523 ,  1549138206440077442 ,  670419952156012344 ,  1121760023739936621 ,  1977146649596446276 ,  1914763106796487863 ,  1257412619830317682 ,  1543199268830329813 ,  1303225198283411421 ,  1007769664883773999 ,  786909237415651461 ,  510347939431675730 ,  2142878469752024577 ,  2184109500020971803 ,  2164504186849753633 ,  1415174780497652519 ,  844459736970833435 ,  1695243985393461969 ,  1029050652475724073 ,  844029990315475242 ,  81816238263810390 ,  2008050243927364644 ,  1326146105732890791 ,  255718892330782866 ,  966153557446807133 ,  2047198197370219516 ,  633637318849578181 ,  2101118512859411515 ,  748797749289016892 ,  1761789508285045395 ,  309333230621380498 ,  1097506077479337125 ,  267400196318213997 ,  2275968367948879396 ,  1636538608738660157 ,  2082642482595281229 ,  971742976672187749 ,  2054478081333937373 ,  1585579564199147890 ,  740008158987053192 ,  1076314526191567010 ,  961330003572351493 ,  17249467695987719 ,  1793625391866509221 ,  1034053536798630217 ,  1299394565434236745 ,  2248170280438372304 ,  1142904719156546224 ,  1922026634493025762 ,  1466035192383139537 ,  75445540312358314 ,  1144915057912576724 ,  2120847385865035417 ,  1867808681511576266 ,  1623577725651129789 ,  429180986743440547 ,  864339486649320803 ,  258073128009003708 ,  1815492356617372393 ,  1100750453162217941 ,  998608324501753411 ,  1241359169553692181 ,  1388267106676036925 ,  180977078345163664 ,  1622490530454209139 ,  1491799739191534153 ,  138833124077462962 ,  272262880135002863 ,  164188801452505396 }, // x^2^632
+
+{ 1167784771328596159 ,  137131862781335936 ,  575948694149602519 ,  2145235925093945069 ,  1569138635219357449 ,  1773043689067440473 ,  127618678556101651 ,  1421185203386879399 ,  2127472538075081521 ,  293881772968516923 ,  877648673999310444 ,  816667744240913087 ,  1903257918648130097 ,  1956975465838022725 ,  1864310095234468411 ,  1581207549862449349 ,  811886345019411004 ,  1330075996125841787 ,  1909357950267226006 ,  1854270802651069007 ,  1602270291103260290 ,  419771564435918126 ,  1407157668168826392 ,  888153480486766877 ,  1976695520137192459 ,  1065651241155940340 ,  215973813538160698 ,  127706636541615956 ,  2087993215848483657 ,  924990876931435227 ,  766526400572394249 ,  904454929155828013 ,  311399899947918018 ,  745573616167277004 ,  635862328669023807 ,  656149841462068805 ,  537200542921256506 ,  392337708910854756 ,  1001913909614266168 ,  1540663540217682476 ,  237872272247426886 ,  1539738353071387290 ,  370295626878584587 ,  1413211561913979091 ,  845065248048554134 ,  383607891852550597 ,  766784211959993005 ,  1202543291071555135 ,  679420186559078452 ,  555386613488533117 ,  108646271599862027 ,  1152772378579166084 ,  1478804984213159001 ,  120061139259630595 ,  2181928396651080923 ,  1518969902625478896 ,  812281776903248083 ,  188760538532725498 ,  1168695351275472117 ,  1728768485738318863 ,  1637423555184369899 ,  2159905267267846278 ,  2128191163583940094 ,  1072708892662807848 ,  404524787546810182 ,  295642196512478188 ,  161556348443330009 ,  2179239395090631842 ,  2215524828466426607 ,  1809700804648155680 ,  665877816825836230 ,  1069083635164308919 ,  568995418426905001 ,  1905204425005072548 ,  1563578169938173437 ,  1665365885331176152 ,  1652562685928813616 ,  1910657401321410089 ,  163746373143789666 ,  725592045509455796 ,  605301537486472291 ,  135385557570511909 ,  42677809030448761 ,  568755930203949742 ,  2069232056780876145 ,  2236887492387110243 ,  1846619160127040950 ,  805398451015755145 ,  1746347831341700858 ,  1134248932552470887 ,  1335101566726437191 ,  927142048043152423 ,  1482804242999645779 ,  780897430638606644 ,  501741620807345943 ,  2095123785050158263 }, // x^2^633
+
+{ 353113761168916472 ,  497424399798396941 ,  457415602691646086 ,  794807872788428877 ,  1202049525172394579 ,  215634644997082846 ,  840601092732755416 ,  1121978530580523088 ,  393539570293379235 ,  1161367950997813708 ,  55769336219591422 ,  2013666542100482431 ,  116768707271620914 ,  2139292632769389662 ,  373493617168710294 ,  532133838798093291 ,  1511876591303934289 ,  2246784854167860149 ,  1072338283868742058 ,  1561855695441146684 ,  1922738433833837992 ,  1364321382919845361 ,  1955613292978444417 ,  1550916068908213368 ,  163101386127572491 ,  1102654221536501115 ,  1189721924897508005 ,  100893939304338211 ,  679529838675020130 ,  2085806291991598551 ,  1568301627817095802 ,  1324403133905222285 ,  1473278651926400468 ,  438565733863940135 ,  734251505881818270 ,  1939886428974187239 ,  666810126677110162 ,  913163589924329796 ,  2111624323321883594 ,  114336243581858348 ,  1590386594072258389 ,  1636629934438130661 ,  1337265219297215686 ,  1255004209819730512 ,  1622943669821253329 ,  1958534550687755919 ,  24398062109306096 ,  863848486945091552 ,  45109141572609026 ,  544792958405049763 ,  992435760446826570 ,  205720384815378200 ,  1215238258449987829 ,  503477700856512635 ,  2259344484583590525 ,  848622793360495892 ,  1173908002511475429 ,  1415991285317876408 ,  70557323637506080 ,  738849328569082219 ,  1103637690542111737 ,  1147239803158121246 ,  2071038446033801572 ,  2181814739984600755 ,  1278844635289587489 ,  480440429320615954 ,  2260502901110320423 ,  1299868241461096214 ,  95029392885671418 ,  1733306229486651743 ,  183980716317566672 ,  1380025318279661290 ,  591945080443395514 ,  654442981447054840 ,  398208551384875200 ,  1053423769589850067 ,  574575203521067406 ,  740339616351964669 ,  1414016315036469223 ,  37519353753443050 ,  1010469397636569226 ,  436310837265288240 ,  1162438103869086454 ,  1189215521038830042 ,  1813636415960196674 ,  604329365093948014 ,  443392477488411157 ,  192487775302004169 ,  2051043630958932910 ,  539520690256951134 ,  1475757615124690276 ,  1557637232074101568 ,  1916806718734137894 ,  1487927652660405593 ,  140947509016013751 ,  2061566204560706545 }, // x^2^634
+
+{ 2175583409237383355 ,  903436514257292915 ,  691834271758211305 ,  1879321568112784333 ,  707487266895934314 ,  2192878559766821919 ,  2155693979930690286 ,  2163575933452851410 ,  489529968973859141 ,  1756113315609117579 ,  163431878148132190 ,  1771960365009936207 ,  459833644913418693 ,  878293730743151355 ,  2098284572912157211 ,  1893510907607400143 ,  2135604212354811572 ,  282830253945900161 ,  4645665386599467 ,  253190633023523297 ,  480342849856012730 ,  382855396588719840 ,  2042943826964058473 ,  290292202182885272 ,  734270471349024814 ,  2238075076829412819 ,  904648440190898637 ,  1384830027547174068 ,  1095184604124267079 ,  1748496232789769085 ,  1292427678358743379 ,  2229565711069730110 ,  2305827047774212335 ,  1747085376445713362 ,  1603912518716306505 ,  697696015884513269 ,  763103237825747635 ,  202265336546063641 ,  2026826195637865684 ,  1477229776270863505 ,  949463289752236752 ,  1812800457715370758 ,  113441563845998694 ,  155605042879245315 ,  1907262849185419310 ,  176824363295018418 ,  1082865457330668023 ,  839945154459652104 ,  1886079451301788707 ,  806027894138821437 ,  866311906484914456 ,  1845668291771420856 ,  1697050132423023771 ,  2161244985690363951 ,  947613707995023604 ,  684653071981464507 ,  440202069455340375 ,  76064646931083639 ,  404582324489711242 ,  1727941328966695975 ,  1604143398757071412 ,  269928547252476958 ,  2167783894397913522 ,  1376397191194226117 ,  1150381406154262075 ,  952756099317126884 ,  2114090602386962679 ,  410344387048976623 ,  2217336212388631033 ,  888396054853782390 ,  1472868055538316486 ,  663243393050359441 ,  541310886518891410 ,  413865630920911479 ,  741827475996379377 ,  1498230864760967978 ,  36225870391240388 ,  521417413687261973 ,  1784266094393943297 ,  1073365765627558959 ,  1926447703065310135 ,  125178917767669979 ,  2110990788944065969 ,  51577456185618323 ,  1997600259825251547 ,  1299071081523069412 ,  470360353778122539 ,  558945635212908214 ,  196334968873975643 ,  76862782298854231 ,  1208770374091159394 ,  821608028191193306 ,  851000063622261737 ,  2267229562481241672 ,  1828242825772463607 ,  341765083200095212 }, // x^2^635
+
+{ 388722999576781806 ,  2190847906462931900 ,  223881999900337675 ,  116618255405313767 ,  1270141569527694558 ,  1017291586863887162 ,  942358258049003594 ,  1235116301832588757 ,  411599439873442828 ,  72063832947106282 ,  493666433823327717 ,  1438873693762877328 ,  1955554008757353198 ,  680815565285773484 ,  968808745116317581 ,  2155786475978129454 ,  537009909743225062 ,  1298667561125043315 ,  2242410720759891539 ,  1448143742052249942 ,  1979197093785025854 ,  89290694301866449 ,  567625670419899612 ,  814884986581962934 ,  676518736619728248 ,  1381502791512769261 ,  2194152624475945776 ,  1510464309056037928 ,  651359961248354715 ,  1926111870703810644 ,  581244044744661566 ,  1378846447847075534 ,  612341912965901021 ,  1641589779864946393 ,  1596189507704367150 ,  1258231099281713936 ,  94240889572595776 ,  1562386439928118562 ,  901841975131671218 ,  550113234960993241 ,  2130574713470398952 ,  215084523598172315 ,  2071820732613794859 ,  934364473411328533 ,  455930163737951708 ,  2008629093463532098 ,  1710538446736319615 ,  580992315152221628 ,  1991940920114892402 ,  1827593851124381065 ,  1399784869327071406 ,  643373756025172375 ,  1826861175585529119 ,  1857784696396181972 ,  1047426944453572625 ,  823509561403372159 ,  173044754363677348 ,  518814858071300389 ,  1724849283387103613 ,  1260765710104205401 ,  504241162158578394 ,  723998535843005184 ,  294285616339808118 ,  1410332282049985882 ,  2131139696277132602 ,  997730898233077572 ,  1241185904846048281 ,  2170037026496266065 ,  381820540467735964 ,  405012381346380899 ,  474299938791661036 ,  783585958531476277 ,  1440732966305564606 ,  1143363273360641631 ,  536215856087061013 ,  1809181312383655981 ,  1312198992309774954 ,  159178508714839654 ,  2223356173789512238 ,  1296236071623851441 ,  1863590087441684315 ,  1865677669659355442 ,  2112463127979454989 ,  1968661874466582643 ,  2110457315092548365 ,  811860845195277626 ,  1207505044151132081 ,  1602672020037450892 ,  1304652606813142789 ,  1374866668732776070 ,  1812202369741239651 ,  1067800131260283202 ,  1939652650439655154 ,  2281299172662868987 ,  188524020859261367 ,  264370086262244665 }, // x^2^636
+
+{ 1651538161670076559 ,  965293734370733740 ,  609746048787710253 ,  1693876433433648374 ,  662516270192194603 ,  2071739645397819483 ,  119049100403309394 ,  963239283186424858 ,  60365515800864552 ,  881901675040256841 ,  841692287334649878 ,  144362443284304907 ,  1248400240674288106 ,  1834617556028290692 ,  1856702159516108637 ,  150388094881087925 ,  29060959120295612 ,  473976697043197332 ,  1963619977642402526 ,  1505793562602996834 ,  1076442686030528608 ,  284094598339559111 ,  1624936545002023476 ,  1929532381997347595 ,  1722841907925870711 ,  1145523567523868612 ,  744850759481967803 ,  2241897212061200176 ,  604468891313856859 ,  1735505228611455912 ,  418180349598000797 ,  52970372113096707 ,  1636850062892550428 ,  2010816669528883592 ,  1317016759976412417 ,  647508631823468184 ,  1582540954926962663 ,  2003904793958062489 ,  439810569893059534 ,  1983328907969860435 ,  395936008685537309 ,  441379056212239866 ,  1065603136975263267 ,  1632863199362958426 ,  1506188905865270273 ,  97717060396920441 ,  2005394759069525031 ,  357879914902606245 ,  1051547805805029306 ,  6986462762010346 ,  1717839847893588390 ,  271887568806963115 ,  456319287970371612 ,  1169634625550601553 ,  2207694218688249319 ,  2003552970850468695 ,  629133343085596869 ,  1472675735803230743 ,  103525706349991118 ,  64710868811013159 ,  1390603590761046669 ,  1080873113379096669 ,  663645423652330028 ,  826509519273512453 ,  103194723535631689 ,  2221368256077414261 ,  2298156963439410635 ,  1978867986954582351 ,  859943962705434211 ,  2282057999312116468 ,  1746740217352593557 ,  1139311238506524846 ,  522654698228883045 ,  1231167637787026176 ,  1723979736210439764 ,  1391181176740273242 ,  1900480760502931792 ,  1242709794163582737 ,  2100975388189468048 ,  2285935059375622838 ,  852019332882767384 ,  1099520443633301236 ,  462735162568559822 ,  201492829475142053 ,  1552885065982056423 ,  540815603552604441 ,  757667417004272916 ,  335214869121585084 ,  721597773478717880 ,  308854326334016115 ,  1878903002652847726 ,  2113635210669940771 ,  494705919491441531 ,  2094160960336410475 ,  2079448824894056721 ,  129637887103489123 }, // x^2^637
+
+{ 634525507503214584 ,  497558696174281235 ,  1654467476508865186 ,  777886457449276996 ,  1150118791993881000 ,  2296464393475404713 ,  1216064355240538340 ,  933041624276208898 ,  1401319091470191702 ,  150011728942219383 ,  916284688130340717 ,  1174342052035325573 ,  1887721006871912137 ,  899190764160707062 ,  54861857961153408 ,  1531699988357834803 ,  2294931073150385213 ,  1012353222420314544 ,  609758278962665698 ,  1392056806682010389 ,  2096964732569527636 ,  1128993183852629449 ,  964652509027291766 ,  795811311396354565 ,  679158707407723027 ,  1334257539599331739 ,  789196940157819621 ,  1931657749334316782 ,  42569386020662525 ,  459165837707235848 ,  2018562716730287551 ,  706044950905986247 ,  930307641812789128 ,  286127293118427260 ,  1304820623913333453 ,  2280327330820583057 ,  1082356792505108219 ,  106552088260929585 ,  691127439639595946 ,  1382072719042070457 ,  410226618913945029 ,  164319833215963037 ,  576178077159098820 ,  1574339090234414598 ,  2194370904821471876 ,  485184362892442804 ,  1109954425240456733 ,  657588370162598689 ,  742257966955592784 ,  1648959543083902535 ,  1446980454946852665 ,  706152500380681096 ,  1021005622986106934 ,  33224235775924719 ,  525606481751732678 ,  143002296591444088 ,  104563687727821227 ,  109444272836869694 ,  831447961178848913 ,  1832727674787106813 ,  141637512443120814 ,  314939403573571447 ,  105607672744226146 ,  1332727093450104914 ,  1725131212923744710 ,  2222058769538079498 ,  1267550349047314022 ,  1072664695282134607 ,  917334735533233530 ,  689933742289738563 ,  553933035804397208 ,  22267590900879871 ,  2026367758801701706 ,  935347704212982264 ,  653770091908849040 ,  1688577523298088889 ,  2247987999782324141 ,  1123805516496292448 ,  313643784000175672 ,  2097688972824314426 ,  1011009153805289361 ,  1940130407927547484 ,  410250162794626138 ,  2103463694670268640 ,  14890713328388384 ,  468586634731125238 ,  488437582156122728 ,  224288748056946775 ,  1613168654645981155 ,  2155493195828796406 ,  1100980654293462843 ,  493575869865320614 ,  2281998495414654392 ,  2062221133657203242 ,  1232092066302810318 ,  860805868677851102 }, // x^2^638
+
+{ 1840237971034986825 ,  104343649544263271 ,  1702617785318896800 ,  103382966725118075 ,  1744329493774664599 ,  964460407605285202 ,  1297491302023832187 ,  1219420514422912680 ,  1933708748439931856 ,  1254386586762795191 ,  852125549411696201 ,  207987160392226000 ,  676427964679019542 ,  469743015087570767 ,  2293032896125609451 ,  156427166128096726 ,  1152243409391733094 ,  510605864179617105 ,  172813917311687025 ,  916321601957659510 ,  170539571908019027 ,  1941617068268330180 ,  856855910298034294 ,  2106716503647358426 ,  1370782895261187709 ,  1096461867071680813 ,  262099338848135932 ,  814212104872517974 ,  2228187474371771184 ,  2153154117610420137 ,  2135727921616045596 ,  371976508068339777 ,  122574002045881996 ,  845234994692000201 ,  396930463770727821 ,  52060679299838248 ,  1482732745936631441 ,  1059448074467836268 ,  35387247719134251 ,  423839970707059731 ,  462334486400528134 ,  459786816660602622 ,  1004804258901057951 ,  2156259449784737589 ,  1473677527502554485 ,  1070808101202751987 ,  1396971268513291071 ,  437209927806294868 ,  1817328372272630527 ,  1206158476191415736 ,  1083071871613197089 ,  1716268219994469323 ,  89238372438839737 ,  71826515518094947 ,  2140052810887377832 ,  1336218878645756294 ,  499092163036567693 ,  1831287163958638476 ,  1246835341705963579 ,  955231421533996039 ,  1685740254544094453 ,  1259871360983054718 ,  1897432932097477744 ,  1168928696958246390 ,  1256000262288252624 ,  1346117450069317843 ,  1473567682205355128 ,  42247987028564209 ,  2129094545122700304 ,  1062407378800338027 ,  883928117655102189 ,  1393558045055152080 ,  1900479468727084547 ,  1890983211091239583 ,  1934974795213063610 ,  1846255026009947489 ,  1132008544018006027 ,  1619926511066707195 ,  1184274226631664634 ,  860865218078085543 ,  660503721303875931 ,  2194451876507749850 ,  2215177181894270457 ,  704681421473367081 ,  832679982765661838 ,  600061029072754377 ,  1325841638621048581 ,  1905596841323920922 ,  2115499486839205893 ,  152356331790774535 ,  1169695628053418428 ,  202783218847759373 ,  959784270127786159 ,  1328278860557857712 ,  1638622316001743136 ,  1112293906849245777 } // x^2^639
+
+};
+
@@ -0,0 +1,149 @@
+/*
+ *  MIXMAX - generator of the skipping coefficients
+ *
+ *  Prints the table of polynomials x^(2^(512+r)) mod p, r = 0..127, where p is the
+ *  characteristic polynomial of the MIXMAX matrix with the given N, SPECIAL and SPECIALMUL,
+ *  coefficients low to high, in the format of mixmax_skip_N*.c, so that the output can be
+ *  #include'd by apply_bigskip:
+ *
+ *      ./skipgen 240 487013230256099140 51 > mixmax_skip_N240.c
+ *
+ *  SPECIAL may be negative, as for N=256 with SPECIAL=-1 (mixmax_skip_N256.oldS.c).
+ *  p is found with the Berlekamp-Massey algorithm from the sequence of one component of
+ *  A^k e_0, and the powers of x by repeated squaring mod p, all in arithmetic mod 2^61-1.
+ *  The program stops with an error if the minimal polynomial does not have degree N.
+ *  For N <= 10 the period is shorter than the skips, and the output says so.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <vector>
+
+typedef uint64_t myuint;
+typedef std::vector<myuint> poly;
+
+constexpr int BITS = 61;
+constexpr myuint M61 = 2305843009213693951ULL;
+
+static myuint mulmod(myuint a, myuint b){ return (myuint)(((__uint128_t)a * b) % M61); }
+static myuint addmod(myuint a, myuint b){ myuint s = a + b; return (s >= M61) ? s - M61 : s; }
+static myuint submod(myuint a, myuint b){ return (a >= b) ? a - b : a + M61 - b; }
+
+static myuint inverse(myuint a){
+    // a^(M61-2), by Fermat
+    myuint r = 1, e = M61 - 2;
+    while (e){
+        if (e & 1) { r = mulmod(r, a); }
+        a = mulmod(a, a);
+        e >>= 1;
+    }
+    return r;
+}
+
+struct matrix_A
+{
+    // one step of the MIXMAX recurrence, as in iterate_raw_vec, on canonical residues
+    int N;
+    myuint special;      // SPECIAL mod M61
+    myuint mul;          // 2^SPECIALMUL, or 0 if SPECIALMUL is 0
+
+    void iterate(poly& Y) const {
+        myuint sum = 0;
+        for (int i=0; i<N; i++){ sum = addmod(sum, Y[i]); }
+        myuint temp2 = Y[1], tempP = 0, tempV = sum;
+        Y[0] = sum;
+        for (int i=1; i<N; i++){
+            myuint tempPO = mulmod(tempP, mul);
+            tempP = addmod(tempP, Y[i]);
+            tempV = addmod(addmod(tempV, tempP), tempPO);
+            Y[i] = tempV;
+        }
+        Y[2] = addmod(Y[2], mulmod(special, temp2));
+    }
+};
+
+static poly charpoly(const matrix_A& A){
+    // monic, low to high, N+1 coefficients
+    int N = A.N;
+    poly s(2*N), C(2*N+1, 0), B(2*N+1, 0), T, Y(N, 0);
+    Y[0] = 1;
+    for (int k=0; k<2*N; k++){ s[k] = Y[1]; A.iterate(Y); }
+    C[0] = B[0] = 1;
+    int L = 0, m = 1;
+    myuint b = 1;
+    for (int n=0; n<2*N; n++){
+        myuint d = s[n];
+        for (int i=1; i<=L; i++){ d = addmod(d, mulmod(C[i], s[n-i])); }
+        if (d == 0) { m++; continue; }
+        myuint coef = mulmod(d, inverse(b));
+        bool grow = (2*L <= n);
+        if (grow) { T = C; }
+        for (int i=0; i+m<=2*N; i++){ C[i+m] = submod(C[i+m], mulmod(coef, B[i])); }
+        if (grow) { L = n+1-L; B = T; b = d; m = 1; } else { m++; }
+    }
+    if (L != N){
+        fprintf(stderr, "skipgen: the minimal polynomial has degree %d, not N=%d: no skipping for these parameters\n", L, N);
+        exit(1);
+    }
+    poly P(N+1);
+    for (int k=0; k<=N; k++){ P[k] = C[N-k]; }
+    return P;
+}
+
+static poly square_mod(const poly& a, const poly& P){
+    int N = (int)a.size();
+    poly prod(2*N-1, 0);
+    for (int i=0; i<N; i++){
+        if (a[i] == 0) { continue; }
+        for (int j=0; j<N; j++){ prod[i+j] = addmod(prod[i+j], mulmod(a[i], a[j])); }
+    }
+    for (int k=2*N-2; k>=N; k--){     // x^N = -(P[0] + P[1] x + ... + P[N-1] x^(N-1))
+        myuint c = prod[k];
+        if (c == 0) { continue; }
+        for (int j=0; j<N; j++){ prod[k-N+j] = submod(prod[k-N+j], mulmod(c, P[j])); }
+    }
+    prod.resize(N);
+    return prod;
+}
+
+int main(int argc, char* argv[]){
+    if (argc != 4){
+        fprintf(stderr, "usage: %s N SPECIAL SPECIALMUL > mixmax_skip_N<N>.c\n", argv[0]);
+        return 1;
+    }
+    int N = atoi(argv[1]);
+    long long special = strtoll(argv[2], NULL, 10);
+    int specialmul = atoi(argv[3]);
+    if (N < 3 || specialmul < 0 || specialmul >= BITS){
+        fprintf(stderr, "skipgen: need N >= 3 and 0 <= SPECIALMUL < %d\n", BITS);
+        return 1;
+    }
+    matrix_A A{N, (special < 0) ? M61 - (myuint)(-special) % M61 : (myuint)special % M61,
+               (specialmul == 0) ? 0 : ((myuint)1 << specialmul)};
+    poly P = charpoly(A);
+
+    poly X(N, 0);         // x^(2^0), then squared up to x^(2^512)
+    if (N > 1) { X[1] = 1; }
+    for (int e=0; e<512; e++){ X = square_mod(X, P); }
+
+    printf("/*\n *  MIXMAX\n *  A Pseudo-Random Number Generator\n *\n"
+           " *  The code is released under GNU Lesser General Public License (LGPL) v3\n *\n */\n\n\n");
+    printf("/*\n skipping coefficients for N=%d, m=", N);
+    if (specialmul) { printf("2^%d+1", specialmul); } else { printf("1"); }
+    printf(" and s=%lld, low to high order, a0 + a1*x + ... + a%d*x^%d\n made by skipgen.cpp\n", special, N-1, N-1);
+    if (BITS*N <= 640){
+        // the period is below (2^61)^N, so the offsets ID*2^512 of the streams are taken mod a shorter period
+        printf(" CAUTION: the period is shorter than the skips, streams are not guaranteed to be disjoint\n");
+        fprintf(stderr, "skipgen: for N=%d the period is shorter than 2^640, streams are not guaranteed to be disjoint\n", N);
+    }
+    printf(" */\n\n\n{\n");
+    for (int r=0; r<128; r++){
+        printf("\n{ ");
+        for (int i=0; i<N; i++){ printf("%llu%s", (unsigned long long)X[i], (i < N-1) ? " ,  " : " "); }
+        printf("}%s // x^2^%d\n", (r < 127) ? "," : "", 512 + r);
+        X = square_mod(X, P);
+    }
+    printf("\n};\n\n");
+    return 0;
+}
@@ -0,0 +1,182 @@
+/*
+$HOME/bin/bin/g++ -std=gnu++17 -g -Iinclude -Wall -Wextra -o test_counter_based_engine test_counter_based_engine.cpp
+*/
+
+#include <random>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <ext/counter_based_engine.h>
+#include <ext/dirichlet_distribution.h>
+
+//  The known answers of Random123 for the zero, all-ones and pi
+//  key and counter.
+template<typename Engine>
+  int
+  test_kat(const char* name,
+	   const typename Engine::counter_type& ctr,
+	   const typename Engine::key_type& key,
+	   const typename Engine::counter_type& expect)
+  {
+    typename Engine::function_type f(key);
+    auto y = f(ctr);
+    if (y == expect)
+      return 0;
+    std::cout << name << ": known answer FAILED:" << std::hex;
+    for (auto w : y)
+      std::cout << ' ' << w;
+    std::cout << std::dec << '\n';
+    return 1;
+  }
+
+template<typename Engine>
+  int
+  test_engine(const char* name)
+  {
+    int errors = 0;
+    Engine a, b;
+
+    //  discard is the same as that many calls, in any split.
+    for (int i = 0; i < 4321; ++i)
+      a();
+    b.discard(1);
+    b.discard(4000);
+    b.discard(320);
+    if (a != b || a() != b())
+      ++errors;
+
+    //  fill must give what repeated calls give, for any length.
+    std::vector<typename Engine::result_type> out(1003);
+    for (std::size_t n : {std::size_t(3), std::size_t(8), std::size_t(13), out.size()})
+      {
+	a.fill(out.data(), n);
+	for (std::size_t k = 0; k < n; ++k)
+	  if (out[k] != b())
+	    ++errors;
+	if (a != b)
+	  ++errors;
+      }
+
+    //  The bulk path carries into the high words of the counter as the
+    //  one at a time path does.
+    typename Engine::counter_type c{};
+    c[0] = std::numeric_limits<typename Engine::result_type>::max() - 5;
+    Engine d(typename Engine::key_type{}, c), e = d;
+    d.fill(out.data(), 16 * Engine::word_count);
+    for (std::size_t k = 0; k < 16 * Engine::word_count; ++k)
+      if (out[k] != e())
+	++errors;
+    if (d.counter()[0] != 10 || d.counter()[1] != 1)
+      ++errors;
+
+    //  Random access: number k of stream s, from s and k alone.
+    const unsigned long long k = 1000003;
+    Engine g(typename Engine::key_type{42});
+    g.discard(k);
+    const auto gk = g();
+    typename Engine::counter_type ck{};
+    ck[0] = typename Engine::result_type(k / Engine::word_count);
+    Engine h(typename Engine::key_type{42}, ck);
+    h.discard(k % Engine::word_count);
+    if (h() != gk)
+      ++errors;
+
+    //  the state survives the streams.
+    std::stringstream str;
+    str << a;
+    Engine m;
+    str >> m;
+    if (m != a || m() != a())
+      ++errors;
+
+    std::seed_seq seq{1, 2, 3};
+    Engine p(seq), q;
+    q.seed(seq);
+    if (p != q)
+      ++errors;
+
+    std::cout << name << ": " << (errors ? "FAILED" : "ok") << " (" << errors << " mismatches)\n";
+    return errors;
+  }
+
+//  The 10000th number of a default-constructed engine, as std::philox_engine.
+template<typename Engine>
+  int
+  test_10000(const char* name, typename Engine::result_type expect)
+  {
+    Engine e;
+    e.discard(9999);
+    const auto x = e();
+    std::cout << name << ": 10000th " << x << (x == expect ? " ok" : " FAILED") << '\n';
+    return x == expect ? 0 : 1;
+  }
+
+int
+main()
+{
+  using namespace __gnu_cxx;
+
+  int errors = 0;
+  errors += test_kat<philox2x32>("philox2x32", {0, 0}, {0}, {0xff1dae59u, 0x6cd10df2u});
+  errors += test_kat<philox4x32>("philox4x32", {0, 0, 0, 0}, {0, 0},
+				 {0x6627e8d5u, 0xe169c58du, 0xbc57ac4cu, 0x9b00dbd8u});
+  errors += test_kat<philox4x32>("philox4x32", {~0u, ~0u, ~0u, ~0u}, {~0u, ~0u},
+				 {0x408f276du, 0x41c83b0eu, 0xa20bc7c6u, 0x6d5451fdu});
+  errors += test_kat<philox4x32>("philox4x32",
+				 {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+				 {0xa4093822u, 0x299f31d0u},
+				 {0xd16cfe09u, 0x94fdccebu, 0x5001e420u, 0x24126ea1u});
+  errors += test_kat<philox4x64>("philox4x64", {0, 0, 0, 0}, {0, 0},
+				 {0x16554d9eca36314cULL, 0xdb20fe9d672d0fdcULL,
+				  0xd7e772cee186176bULL, 0x7e68b68aec7ba23bULL});
+  errors += test_kat<philox4x64>("philox4x64",
+				 {0x243f6a8885a308d3ULL, 0x13198a2e03707344ULL,
+				  0xa4093822299f31d0ULL, 0x082efa98ec4e6c89ULL},
+				 {0x452821e638d01377ULL, 0xbe5466cf34e90c6cULL},
+				 {0xa528f45403e61d95ULL, 0x38c72dbd566e9788ULL,
+				  0xa5a1610e72fd18b5ULL, 0x57bd43b5e52b7fe6ULL});
+  errors += test_kat<threefry2x64>("threefry2x64", {0, 0}, {0, 0},
+				   {0xc2b6e3a8c2c69865ULL, 0x6f81ed42f350084dULL});
+  errors += test_kat<threefry4x64>("threefry4x64", {0, 0, 0, 0}, {0, 0, 0, 0},
+				   {0x09218ebde6c85537ULL, 0x55941f5266d86105ULL,
+				    0x4bd25e16282434dcULL, 0xee29ec846bd2e40bULL});
+  errors += test_kat<threefry4x64>("threefry4x64",
+				   {0x243f6a8885a308d3ULL, 0x13198a2e03707344ULL,
+				    0xa4093822299f31d0ULL, 0x082efa98ec4e6c89ULL},
+				   {0x452821e638d01377ULL, 0xbe5466cf34e90c6cULL,
+				    0xbe5466cf34e90c6cULL, 0xc0ac29b7c97c50ddULL},
+				   {0xa7e8fde591651bd9ULL, 0xbaafd0c30138319bULL,
+				    0x84a5c1a729e685b9ULL, 0x901d406ccebc1ba4ULL});
+  errors += test_kat<threefry2x32>("threefry2x32", {0, 0}, {0, 0}, {0x6b200159u, 0x99ba4efeu});
+  errors += test_kat<threefry4x32>("threefry4x32", {0, 0, 0, 0}, {0, 0, 0, 0},
+				   {0x9c6ca96au, 0xe17eae66u, 0xfc10ecd4u, 0x5256a7d8u});
+
+  errors += test_10000<philox4x32>("philox4x32", 1955073260u);
+  errors += test_10000<philox4x64>("philox4x64", 3409172418970261260ULL);
+
+  errors += test_engine<philox2x32>("philox2x32");
+  errors += test_engine<philox4x32>("philox4x32");
+  errors += test_engine<philox2x64>("philox2x64");
+  errors += test_engine<philox4x64>("philox4x64");
+  errors += test_engine<threefry2x32>("threefry2x32");
+  errors += test_engine<threefry4x32>("threefry4x32");
+  errors += test_engine<threefry2x64>("threefry2x64");
+  errors += test_engine<threefry4x64>("threefry4x64");
+
+  //  A particle regenerates its draws from (id, step) with nothing stored.
+  dirichlet_distribution<3> dir{1.0, 2.0, 3.0};
+  auto draw = [&dir](std::uint32_t id, std::uint32_t step)
+  {
+    philox4x32 urng({id, 0}, {step, 0, 0, 0});
+    return dir(urng);
+  };
+  auto d1 = draw(17, 5);
+  draw(17, 6);
+  draw(18, 5);
+  if (d1 != draw(17, 5))
+    ++errors;
+  std::cout << "dirichlet at (17, 5): " << d1[0] << ' ' << d1[1] << ' ' << d1[2] << '\n';
+
+  return errors ? 1 : 0;
+}
@@ -8,6 +8,7 @@ $HOME/bin/bin/g++ -std=gnu++11 -g -Iinclude -Wall -Wextra -o test_dirichlet_dist
 #include <fstream>
 
 #include <ext/dirichlet_distribution.h>
+#include <ext/xoshiro_engine.h>
 #include <ext/simplex.h>
 #include "test_simplex.h"
 
@@ -26,7 +27,7 @@ template<typename RealType = double>
     tri<RealType> tri1({-1, 3, 5}, {7, 2, -2}, {3, 3, -3});
 
     std::random_device rd;
-    std::mt19937 gen(rd());
+    __gnu_cxx::xoshiro256starstar gen(rd());
 
     for (int i = 0; i < 1000; ++i)
       {
@@ -86,7 +87,7 @@ template<typename RealType = double>
     tetra<RealType> tetra1({6, 6, 6}, {-1, 3, 5}, {7, 2, -2}, {3, 3, -3});
 
     std::random_device rd;
-    std::mt19937 gen(rd());
+    __gnu_cxx::xoshiro256starstar gen(rd());
 
     for (int i = 0; i < 100000; ++i)
       {
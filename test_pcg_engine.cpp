@@ -0,0 +1,91 @@
+/*
+$HOME/bin/bin/g++ -std=gnu++17 -g -Iinclude -Wall -Wextra -o test_pcg_engine test_pcg_engine.cpp
+*/
+
+#include <random>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <ext/pcg_engine.h>
+
+template<typename Engine>
+  int
+  test_pcg(const char* name,
+	   const std::vector<typename Engine::result_type>& expected)
+  {
+    int errors = 0;
+    Engine a(42, 54), b(42, 54);
+
+    //  the first words of the reference implementation, seed 42, stream 54.
+    for (auto __x : expected)
+      if (a() != __x)
+	++errors;
+    b.discard(expected.size());
+    if (a != b)
+      ++errors;
+
+    //  fill must give what repeated calls give, for any length.
+    std::vector<typename Engine::result_type> out(1003);
+    for (std::size_t n : {std::size_t(3), std::size_t(8), std::size_t(13), out.size()})
+      {
+	a.fill(out.data(), n);
+	for (std::size_t k = 0; k < n; ++k)
+	  if (out[k] != b())
+	    ++errors;
+	if (a != b)
+	  ++errors;
+      }
+
+    //  discard is the same as that many calls, backstep undoes it.
+    Engine c = a;
+    for (int i = 0; i < 12345; ++i)
+      a();
+    c.discard(12345);
+    if (a != c)
+      ++errors;
+    c.backstep(12345);
+    c.discard(12345);
+    if (a != c || a() != c())
+      ++errors;
+
+    //  streams with the same seed differ.
+    Engine s1(7, 1), s2(7, 2);
+    if (s1() == s2() && s1() == s2())
+      ++errors;
+
+    //  the state survives the streams.
+    std::stringstream str;
+    str << a;
+    Engine d;
+    str >> d;
+    if (d != a || d() != a())
+      ++errors;
+
+    std::seed_seq seq{1, 2, 3};
+    Engine e(seq), f;
+    f.seed(seq);
+    if (e != f)
+      ++errors;
+
+    std::cout << name << ": " << (errors ? "FAILED" : "ok") << " (" << errors << " mismatches)\n";
+    return errors;
+  }
+
+int
+main()
+{
+  int errors = 0;
+  //  pcg32 and pcg64 as pcg32-demo and pcg64 of pcg-cpp print them,
+  //  pcg64_dxsm as numpy's PCG64DXSM, seeded by pcg_cm_srandom_r(42, 54).
+  errors += test_pcg<__gnu_cxx::pcg32>("pcg32",
+    { 0xa15c02b7, 0x7b47f409, 0xba1d3330, 0x83d2f293, 0xbfa4784b, 0xcbed606e });
+  errors += test_pcg<__gnu_cxx::pcg64>("pcg64",
+    { 0x86b1da1d72062b68, 0x1304aa46c9853d39, 0xa3670e9e0dd50358,
+      0xf9090e529a7dae00, 0xc85b9fd837996f2c, 0x606121f8e3919196 });
+  errors += test_pcg<__gnu_cxx::pcg64_dxsm>("pcg64_dxsm",
+    { 0xf0847c9518bddb90, 0x8e7d5f5514ba8aaa, 0x86fbd36f8028f6fd,
+      0x8d14b6edbe9f740a, 0xa85b2896c7cad55d, 0x8ca3894a1d9227bb });
+
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,102 @@
+/*
+$HOME/bin/bin/g++ -std=gnu++17 -g -Iinclude -Wall -Wextra -o test_ranluxpp_engine test_ranluxpp_engine.cpp
+*/
+
+#include <random>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <ext/ranluxpp_engine.h>
+
+//  expect: the first three numbers after seed(default_seed) and the
+//  10000th, from x <- a^p x mod m in exact integers.
+template<typename Engine>
+  int
+  test_ranluxpp(const char* name,
+		std::initializer_list<typename Engine::result_type> expect,
+		typename Engine::result_type expect10000)
+  {
+    int errors = 0;
+    Engine a, b;
+
+    std::cout << name << ": ";
+    for (auto x : expect)
+      {
+	const auto y = a();
+	std::cout << ' ' << y;
+	if (y != x)
+	  ++errors;
+      }
+    std::cout << '\n';
+    b.discard(expect.size());
+    if (a != b)
+      ++errors;
+
+    Engine c;
+    c.discard(9999);
+    if (c() != expect10000)
+      ++errors;
+
+    //  fill must give what repeated calls give, for any length.
+    std::vector<typename Engine::result_type> out(1003);
+    for (std::size_t n : {std::size_t(3), std::size_t(Engine::block_size), out.size()})
+      {
+	a.fill(out.data(), n);
+	for (std::size_t k = 0; k < n; ++k)
+	  if (out[k] != b())
+	    ++errors;
+	if (a != b)
+	  ++errors;
+      }
+
+    //  discard is the same as calls, within a block and past many.
+    Engine d = a;
+    for (unsigned long long z : {1ULL, 5ULL, 24ULL, 1000ULL, 100001ULL})
+      {
+	d.discard(z);
+	for (unsigned long long k = 0; k < z; ++k)
+	  a();
+	if (d != a || d() != a())
+	  ++errors;
+      }
+
+    //  the state survives the streams.
+    std::stringstream str;
+    str << a;
+    Engine e;
+    str >> e;
+    if (e != a || e() != a())
+      ++errors;
+
+    std::seed_seq seq{1, 2, 3};
+    Engine f(seq), g;
+    g.seed(seq);
+    if (f != g)
+      ++errors;
+
+    std::cout << name << ": " << (errors ? "FAILED" : "ok") << " (" << errors << " mismatches)\n";
+    return errors;
+  }
+
+int
+main()
+{
+  using namespace __gnu_cxx;
+
+  int errors = 0;
+
+  errors += test_ranluxpp<ranluxpp48>("ranluxpp48",
+	{231163748871910ULL, 36318282547828ULL, 121256779326080ULL},
+	145053844576139ULL);
+  errors += test_ranluxpp<ranluxpp24>("ranluxpp24",
+	{2289382u, 13778433u, 5538420u}, 2267089u);
+
+  //  Seeds are streams 2^96 multiplications apart.
+  ranluxpp48 s1(1);
+  for (auto x : {98571255020127ULL, 80302009610761ULL, 122969407365825ULL})
+    if (s1() != x)
+      ++errors;
+
+  return errors ? 1 : 0;
+}
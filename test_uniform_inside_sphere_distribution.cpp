@@ -9,6 +9,7 @@ LD_LIBRARY_PATH=/home/ed/bin/lib64:$LD_LIBRARY_PATH ./test_uniform_inside_sphere
 #include <regex>
 
 #include <ext/uniform_inside_sphere_distribution.h>
+#include <ext/xoshiro_engine.h>
 
 const char* header =
 R"(#Inventor V2.1 ascii
@@ -66,7 +67,7 @@ template<std::size_t Dim>
   void
   insphplot(std::ostream & iv, double radius = 1.0)
   {
-    std::default_random_engine re; // the default engine
+    __gnu_cxx::xoshiro256starstar re;
     __gnu_test::uniform_inside_sphere_distribution<Dim> isd(radius);
 
     auto gen = std::bind(isd, re);
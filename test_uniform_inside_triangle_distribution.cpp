@@ -3,6 +3,7 @@ $HOME/bin/bin/g++ -std=gnu++11 -g -Iinclude -Wall -Wextra -o test_uniform_inside
 */
 
 #include <random>
+#include <array>
 #include <iostream>
 #include <iomanip>
 #include <fstream>
@@ -0,0 +1,108 @@
+/*
+$HOME/bin/bin/g++ -std=gnu++17 -g -Iinclude -Wall -Wextra -o test_uniform_real_adaptor test_uniform_real_adaptor.cpp
+*/
+
+#include <random>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+#include <ext/uniform_real_adaptor.h>
+#include <ext/xoshiro_engine.h>
+#include <ext/pcg_engine.h>
+
+//  An engine of __w bits that always gives the same number, and counts
+//  its calls.
+template<typename _UIntType, std::size_t __w>
+  struct constant_engine
+  {
+    typedef _UIntType result_type;
+
+    static constexpr result_type
+    min()
+    { return 0; }
+
+    static constexpr result_type
+    max()
+    { return ~_UIntType(0) >> (std::numeric_limits<_UIntType>::digits - __w); }
+
+    result_type
+    operator()()
+    {
+      ++calls;
+      return value;
+    }
+
+    result_type value;
+    std::size_t calls = 0;
+  };
+
+//  The least and greatest numbers of the adaptor, from the engine at its
+//  min() and max(), and the calls of the engine for each number.
+template<typename _Engine, typename _RealType>
+  int
+  test_ends(const char* name, std::size_t expect_calls)
+  {
+    using namespace __gnu_cxx;
+    using co = uniform_real_adaptor<_Engine, _RealType>;
+    using oc = uniform_real_adaptor<_Engine, _RealType,
+				    unit_interval::open_closed>;
+    constexpr std::size_t p = std::numeric_limits<_RealType>::digits;
+    const _RealType ulp = std::ldexp(_RealType(1), -int(p));
+
+    int errors = 0;
+    if (!co::by_bits)
+      ++errors;
+
+    _Engine lo{_Engine::min()}, hi{_Engine::max()};
+    co colo(lo), cohi(hi);
+    oc oclo(lo), ochi(hi);
+    if (colo() != _RealType(0) || cohi() != _RealType(1) - ulp)
+      ++errors;
+    if (oclo() != ulp || ochi() != _RealType(1))
+      ++errors;
+    if (lo.calls != 2 * expect_calls || hi.calls != 2 * expect_calls)
+      ++errors;
+
+    std::cout << std::setw(24) << name << ": "
+	      << (errors ? "FAILED" : "ok") << " (" << errors << " mismatches)\n";
+    return errors;
+  }
+
+int
+main()
+{
+  using namespace __gnu_cxx;
+
+  int errors = 0;
+
+  errors += test_ends<constant_engine<std::uint64_t, 64>, double>("64 bits, double", 1);
+  errors += test_ends<constant_engine<std::uint32_t, 32>, double>("32 bits, double", 2);
+  errors += test_ends<constant_engine<std::uint32_t, 24>, double>("24 bits, double", 3);
+  errors += test_ends<constant_engine<std::uint32_t, 32>, float>("32 bits, float", 1);
+  errors += test_ends<constant_engine<std::uint64_t, 61>, long double>("61 bits, long double", 2);
+  errors += test_ends<constant_engine<std::uint32_t, 1>, float>("1 bit, float", 24);
+
+  //  Engines not of all of [0, 2^w) go by generate_canonical.
+  static_assert(!uniform_real_adaptor<std::minstd_rand, double>::by_bits, "");
+  static_assert(uniform_real_adaptor<std::mt19937, double>::by_bits, "");
+  static_assert(uniform_real_adaptor<std::ranlux24, float>::by_bits, "");
+  static_assert(uniform_real_adaptor<xoshiro256starstar, double>::by_bits, "");
+  static_assert(uniform_real_adaptor<pcg32, double>::by_bits, "");
+
+  //  In [0, 1) and (0, 1] by either path.
+  std::minstd_rand m;
+  xoshiro256starstar x;
+  uniform_real_adaptor<std::minstd_rand, double> mco(m);
+  uniform_real_adaptor<std::minstd_rand, double, unit_interval::open_closed> moc(m);
+  uniform_real_adaptor<xoshiro256starstar, double, unit_interval::open_closed> xoc(x);
+  for (int k = 0; k < 100000; ++k)
+    {
+      const double u = mco(), v = moc(), w = xoc();
+      if (u < 0 || u >= 1 || v <= 0 || v > 1 || w <= 0 || w > 1)
+	++errors;
+    }
+
+
+  return errors ? 1 : 0;
+}
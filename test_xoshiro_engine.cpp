@@ -0,0 +1,151 @@
+/*
+$HOME/bin/bin/g++ -std=gnu++17 -g -Iinclude -Wall -Wextra -o test_xoshiro_engine test_xoshiro_engine.cpp
+*/
+
+#include <random>
+#include <vector>
+#include <sstream>
+#include <iostream>
+
+#include <ext/xoshiro_engine.h>
+
+//  expect: the first three numbers after seed(12345), from the reference
+//  algorithms of Blackman and Vigna seeded by splitmix64.
+template<typename Engine>
+  int
+  test_xoshiro(const char* name,
+	       std::initializer_list<typename Engine::result_type> expect)
+  {
+    int errors = 0;
+    Engine a(12345), b(12345);
+
+    std::cout << name << ": ";
+    for (auto x : expect)
+      {
+	const auto y = a();
+	std::cout << ' ' << y;
+	if (y != x)
+	  ++errors;
+      }
+    std::cout << '\n';
+    b.discard(expect.size());
+    if (a != b)
+      ++errors;
+
+    //  fill must give what repeated calls give, for any length.
+    std::vector<typename Engine::result_type> out(1003);
+    for (std::size_t n : {std::size_t(3), std::size_t(8), out.size()})
+      {
+	a.fill(out.data(), n);
+	for (std::size_t k = 0; k < n; ++k)
+	  if (out[k] != b())
+	    ++errors;
+	if (a != b)
+	  ++errors;
+      }
+
+    //  A jump is a polynomial in the step, so it commutes with it,
+    //  and the streams it makes differ.
+    Engine c = a, d = a;
+    c.jump();
+    c.discard(1000);
+    d.discard(1000);
+    d.jump();
+    if (c != d || c == a)
+      ++errors;
+    c.long_jump();
+    d.discard(10);
+    d.long_jump();
+    c.discard(10);
+    if (c != d)
+      ++errors;
+
+    //  the state survives the streams.
+    std::stringstream str;
+    str << a;
+    Engine e;
+    str >> e;
+    if (e != a || e() != a())
+      ++errors;
+
+    std::seed_seq seq{1, 2, 3};
+    Engine f(seq), g;
+    g.seed(seq);
+    if (f != g)
+      ++errors;
+
+    std::cout << name << ": " << (errors ? "FAILED" : "ok") << " (" << errors << " mismatches)\n";
+    return errors;
+  }
+
+//  The state after jump() and after long_jump() from the state @p start,
+//  as the step matrix over GF(2), squared w n / 2 and 3 w n / 4 times,
+//  gives it.
+template<typename Engine>
+  int
+  test_jump(const char* name, const char* start,
+	    const char* jumped, const char* long_jumped)
+  {
+    int errors = 0;
+    Engine a, b, c, d;
+    std::istringstream(start) >> a;
+    b = a;
+    std::istringstream(jumped) >> c;
+    std::istringstream(long_jumped) >> d;
+    a.jump();
+    if (a != c)
+      ++errors;
+    b.long_jump();
+    if (b != d)
+      ++errors;
+
+    std::cout << name << " jumps: " << (errors ? "FAILED" : "ok") << " (" << errors << " mismatches)\n";
+    return errors;
+  }
+
+int
+main()
+{
+  using namespace __gnu_cxx;
+
+  int errors = 0;
+
+  //  The first output of xoshiro256** from the state 1 2 3 4 is 11520.
+  xoshiro256starstar x;
+  std::istringstream("1 2 3 4") >> x;
+  if (x() != 11520)
+    ++errors;
+
+  errors += test_jump<xoshiro128plusplus>("xoshiro128", "1 2 3 4",
+	"2843103750 2038079848 1533207345 44816753",
+	"1611968294 2125834322 966769569 3193880526");
+  errors += test_jump<xoshiro256plusplus>("xoshiro256", "1 2 3 4",
+	"10122426448480695249 8079205330032121950 7289065458748526725 9477464255293849680",
+	"678511610814637056 15850499779492529430 6002989639035333134 3559352929785830385");
+  errors += test_jump<xoshiro512plusplus>("xoshiro512", "1 2 3 4 5 6 7 8",
+	"3901530218709351804 7204267891390322048 12423743538045794722 16055749994260943424 "
+	"8239227947213081352 14300398557866211693 4041563825329243491 14941071041802606168",
+	"12062540774212671173 934305735801837987 5408397127032936856 4114378098592402167 "
+	"16611379974567096209 7605069237349847131 13714387727439103582 15834236375561840486");
+
+  errors += test_xoshiro<xoshiro256starstar>("xoshiro256starstar",
+	{13720838825685603483ULL, 2398916695208396998ULL, 17770384849984869256ULL});
+  errors += test_xoshiro<xoshiro256plusplus>("xoshiro256plusplus",
+	{10201931350592234856ULL, 3780764549115216544ULL, 1570246627180645737ULL});
+  errors += test_xoshiro<xoshiro256plus>("xoshiro256plus",
+	{5703686706282124394ULL, 15181128508879479020ULL, 11713703072819584576ULL});
+  errors += test_xoshiro<xoshiro512starstar>("xoshiro512starstar",
+	{13720838825685603483ULL, 2398916695208396998ULL, 13647826338920190534ULL});
+  errors += test_xoshiro<xoshiro512plusplus>("xoshiro512plusplus",
+	{15187454245883409268ULL, 3039211871274424259ULL, 5794322677829218177ULL});
+  errors += test_xoshiro<xoshiro512plus>("xoshiro512plus",
+	{4660058023890748349ULL, 8792001536748815263ULL, 1842296837841553621ULL});
+  errors += test_xoshiro<xoshiro128starstar>("xoshiro128starstar",
+	{2314518269u, 2498321016u, 2055377852u});
+  errors += test_xoshiro<xoshiro128plusplus>("xoshiro128plusplus",
+	{3385349263u, 298465146u, 210322161u});
+  errors += test_xoshiro<xoshiro128plus>("xoshiro128plus",
+	{3728731781u, 3131324368u, 1839595756u});
+
+  return errors ? 1 : 0;
+}